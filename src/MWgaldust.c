@@ -459,6 +459,205 @@ double GALextinct(double RV, double AV, double WAVE, int OPT) {
 }  // end of GALextinct
 
 
+// Aug 2026: memo cache for GALextinct_list. Each entry stores the
+// extinction curve for one (RV,AV,OPT) on one wavelength grid,
+// keyed on the grid pointer (filter/SED lambda arrays are stable
+// for the life of the job). Oldest entry is recycled when full, so
+// repeated epochs and filters of the same event hit the cache and
+// do zero polynomial work.
+#define MXCACHE_GALEXTINCT 40
+struct {
+  int     NENTRY ;                      // entries filled so far
+  int     IROTATE ;                     // next slot to recycle
+  double  RV[MXCACHE_GALEXTINCT], AV[MXCACHE_GALEXTINCT] ;
+  int     OPT[MXCACHE_GALEXTINCT], NLAM[MXCACHE_GALEXTINCT] ;
+  double *WAVE_PTR[MXCACHE_GALEXTINCT] ; // key: input grid pointer
+  double  WAVE0[MXCACHE_GALEXTINCT] ;    // key: first & last lambda,
+  double  WAVE1[MXCACHE_GALEXTINCT] ;    //  to catch re-used buffers
+  double *XTMAG[MXCACHE_GALEXTINCT] ;    // cached curve
+} GALEXTINCT_CACHE = { 0 } ;
+
+
+// ===========================
+void GALextinct_list(double RV, double AV, int NLAM, double *WAVE_LIST,
+		     int OPT, double *XTMAG_LIST) {
+
+  // Created Aug 2026
+  // Batch version of GALextinct: fill XTMAG_LIST[0:NLAM-1] with
+  // extinction mags for every wavelength in WAVE_LIST, for one
+  // (RV,AV) and color-law OPT. Curves are memoized per
+  // (RV,AV,OPT,grid) so per-epoch refills of the SED extinction
+  // tables cost a memcpy instead of NLAM polynomial evaluations.
+
+  int i, icache ;
+  size_t MEMD = NLAM * sizeof(double);
+  //  char fnam[] = "GALextinct_list" ;
+
+  // ------------------- BEGIN --------------
+
+  if ( NLAM <= 0 ) { return ; }
+
+  // check cache for this curve
+  for(icache=0; icache < GALEXTINCT_CACHE.NENTRY; icache++ ) {
+    if ( GALEXTINCT_CACHE.WAVE_PTR[icache] == WAVE_LIST &&
+	 GALEXTINCT_CACHE.RV[icache]  == RV  &&
+	 GALEXTINCT_CACHE.AV[icache]  == AV  &&
+	 GALEXTINCT_CACHE.OPT[icache] == OPT &&
+	 GALEXTINCT_CACHE.NLAM[icache] == NLAM &&
+	 GALEXTINCT_CACHE.WAVE0[icache] == WAVE_LIST[0] &&
+	 GALEXTINCT_CACHE.WAVE1[icache] == WAVE_LIST[NLAM-1] ) {
+      memcpy(XTMAG_LIST, GALEXTINCT_CACHE.XTMAG[icache], MEMD);
+      return ;
+    }
+  }
+
+  // compute curve; independent iterations for the optimizer
+  for(i=0; i < NLAM; i++ )
+    { XTMAG_LIST[i] = GALextinct(RV, AV, WAVE_LIST[i], OPT); }
+
+  // store in cache, recycling the oldest slot when full
+  if ( GALEXTINCT_CACHE.NENTRY < MXCACHE_GALEXTINCT ) {
+    icache = GALEXTINCT_CACHE.NENTRY ;
+    GALEXTINCT_CACHE.NENTRY++ ;
+  }
+  else {
+    icache = GALEXTINCT_CACHE.IROTATE ;
+    GALEXTINCT_CACHE.IROTATE =
+      ( GALEXTINCT_CACHE.IROTATE + 1 ) % MXCACHE_GALEXTINCT ;
+    free( GALEXTINCT_CACHE.XTMAG[icache] );
+  }
+
+  GALEXTINCT_CACHE.RV[icache]       = RV ;
+  GALEXTINCT_CACHE.AV[icache]       = AV ;
+  GALEXTINCT_CACHE.OPT[icache]      = OPT ;
+  GALEXTINCT_CACHE.NLAM[icache]     = NLAM ;
+  GALEXTINCT_CACHE.WAVE_PTR[icache] = WAVE_LIST ;
+  GALEXTINCT_CACHE.WAVE0[icache]    = WAVE_LIST[0] ;
+  GALEXTINCT_CACHE.WAVE1[icache]    = WAVE_LIST[NLAM-1] ;
+  GALEXTINCT_CACHE.XTMAG[icache]    = (double*)malloc(MEMD);
+  memcpy(GALEXTINCT_CACHE.XTMAG[icache], XTMAG_LIST, MEMD);
+
+  return ;
+
+} // end GALextinct_list
+
+
+
+// ===========================================================
+// Aug 2026: optional in-memory cache of the full SFD98 Ebv maps
+// (NGP+SGP, ~130 MB total) so that repeated MWgaldust calls with
+// random sky coords do no FITS I/O; see init_MWgaldust_cache.
+
+struct {
+  int    USE ;          // set after successful init
+  HSIZE  nHead[2]  ;    // FITS header; 0=NGP, 1=SGP
+  uchar *pHead[2]  ;
+  DSIZE  NAXIS[2][2] ;  // image dimensions per hemisphere
+  float *pImage[2] ;    // full image per hemisphere
+} MWDUST_CACHE = { 0 } ;
+
+
+void init_MWgaldust_cache(void) {
+
+  // Created Aug 2026
+  // Read full SFD98 Ebv maps (both hemispheres) into MWDUST_CACHE
+  // so that MWgaldust() becomes pure arithmetic; intended for sims
+  // that randomize sky coordinates each event.
+
+  int    ihemi, numAxes ;
+  DSIZE  nData ;
+  DSIZE *pNaxis ;
+  double MB = 0.0 ;
+  char   pFile[2][MAX_FILE_NAME_LEN];
+  char fnam[] = "init_MWgaldust_cache" ;
+
+  // --------- BEGIN -----------
+
+  if ( MWDUST_CACHE.USE ) { return; }
+
+  sprintf(pFile[0],"%s/MWDUST/SFD_dust_4096_ngp.fits",
+	  getenv("SNDATA_ROOT") );
+  sprintf(pFile[1],"%s/MWDUST/SFD_dust_4096_sgp.fits",
+	  getenv("SNDATA_ROOT") );
+
+  for (ihemi=0; ihemi < 2; ihemi++) {
+
+    fits_read_file_fits_r4_(pFile[ihemi],
+			    &MWDUST_CACHE.nHead[ihemi],
+			    &MWDUST_CACHE.pHead[ihemi],
+			    &nData, &MWDUST_CACHE.pImage[ihemi] );
+
+    fits_compute_axes_(&MWDUST_CACHE.nHead[ihemi],
+		       &MWDUST_CACHE.pHead[ihemi], &numAxes, &pNaxis);
+
+    if ( numAxes < 2 || nData != pNaxis[0]*pNaxis[1] ) {
+      sprintf(c1err,"Unexpected map: numAxes=%d, nData=%ld",
+	      numAxes, (long)nData );
+      sprintf(c2err,"Check %s", pFile[ihemi] );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    MWDUST_CACHE.NAXIS[ihemi][0] = pNaxis[0] ;
+    MWDUST_CACHE.NAXIS[ihemi][1] = pNaxis[1] ;
+    fits_free_axes_(&numAxes, &pNaxis);
+
+    MB += (double)nData * sizeof(float) * 1.0E-6 ;
+  }
+
+  MWDUST_CACHE.USE = 1 ;
+
+  printf("\t Cache full SFD98 dust maps in memory (%.0f MB) \n", MB );
+  fflush(stdout);
+
+  return ;
+
+} // end init_MWgaldust_cache
+
+void init_mwgaldust_cache__(void) { init_MWgaldust_cache(); }
+
+
+double MWgaldust_cacheval(double gall, double galb) {
+
+  // Created Aug 2026
+  // Return E(B-V) at galactic (gall,galb) from MWDUST_CACHE
+  // with the same bilinear interpolation as lambert_getval
+  // (qInterp=1), but with no file access.
+
+  int    ihemi = ( galb >= 0.0 ) ? 0 : 1 ;  // 0=NGP, 1=SGP
+  int    xPix, yPix ;
+  DSIZE  N0 = MWDUST_CACHE.NAXIS[ihemi][0] ;
+  DSIZE  N1 = MWDUST_CACHE.NAXIS[ihemi][1] ;
+  float *pImg = MWDUST_CACHE.pImage[ihemi] ;
+  float  xr, yr, dx, dy ;
+  double val ;
+
+  // --------- BEGIN -----------
+
+  lambert_lb2fpix( (float)gall, (float)galb,
+		   MWDUST_CACHE.nHead[ihemi], MWDUST_CACHE.pHead[ihemi],
+		   &xr, &yr );
+
+  xPix = (int)(xr);
+  yPix = (int)(yr);
+  dx = xPix - xr + 1.0;
+  dy = yPix - yr + 1.0;
+
+  /* Force pixel values to fall within the image boundaries */
+  if (xPix < 0)     { xPix = 0;    dx = 1.0; }
+  if (yPix < 0)     { yPix = 0;    dy = 1.0; }
+  if (xPix >= N0-1) { xPix = N0-2; dx = 0.0; }
+  if (yPix >= N1-1) { yPix = N1-2; dy = 0.0; }
+
+  val =
+       dx  *    dy  * (double)pImg[ xPix   + (yPix  )*N0 ]
+  + (1-dx) *    dy  * (double)pImg[ xPix+1 + (yPix  )*N0 ]
+  +    dx  * (1-dy) * (double)pImg[ xPix   + (yPix+1)*N0 ]
+  + (1-dx) * (1-dy) * (double)pImg[ xPix+1 + (yPix+1)*N0 ] ;
+
+  return val ;
+
+} // end MWgaldust_cacheval
+
 
 // ========== FUNCTION TO RETURN EBV(SFD) =================
 void MWgaldust(
@@ -526,6 +725,18 @@ void MWgaldust(
    // Translate from RA and DEC to galactic
 
    slaEqgal(RA,DEC,&tmpl,&tmpb);
+
+   // Aug 2026: if full maps are cached in memory (see
+   // init_MWgaldust_cache), interpolate from the cache and
+   // skip all FITS access.
+   if ( MWDUST_CACHE.USE ) {
+     dustval = MWgaldust_cacheval(tmpl, tmpb);
+     for (imap=0; imap < 5; imap++ )
+       { galxtinct[imap] = RV[imap] * dustval ; }
+     *galebmv = dustval;
+     return;
+   }
+
    nGal = 1;
    pGall = ccvector_build_(nGal);
    pGalb = ccvector_build_(nGal);
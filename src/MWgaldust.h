@@ -32,6 +32,11 @@ xxxxxxxxxx */
 
 // functions moved from sntools.c (Sep 2013)
 double GALextinct (double  RV, double  AV, double  WAVE, int  OPT);
+
+// Aug 2026: batch version with per-(RV,AV,OPT,grid) memo cache;
+// fills XTMAG_LIST[0:NLAM-1] for entire wavelength grid.
+void GALextinct_list(double RV, double AV, int NLAM, double *WAVE_LIST,
+		     int OPT, double *XTMAG_LIST);
 double galextinct_(double *RV, double *AV, double *WAVE, int *OPT);
 
 void   text_MWoption(  char *what, int  OPT, char *TEXT) ; // return TEXT
@@ -42,6 +47,11 @@ void   modify_MWEBV_SFD  (int OPT, double RA, double DECL,    // (I)
 void   modify_mwebv_sfd__(int *OPT, double *RA, double *DECL,
 			  double *MWEBV, double *MWEBV_ERR) ;
 
+// Aug 2026: optional in-memory cache of full SFD98 dust maps
+void   init_MWgaldust_cache(void);
+void   init_mwgaldust_cache__(void);
+double MWgaldust_cacheval(double gall, double galb);
+
 // =======================================
 
 #ifndef __INCinterface_h
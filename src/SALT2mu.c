@@ -329,13 +329,27 @@ redchi2_tol   or sig1tol = tolerance (0.02) on chi2/dof-1
 prescale_simdata=<preScale>  # pre scale for sim data
 prescale_simcc=<preScale>    # pre-scale only the simulated CC
 nthread=<n>                  # use pthread for multiple cores on same node
+ncore_minos=<n>              # fork MINOS param scans onto <n> cores
+opt_gradient=<opt>           # analytic dchi2/dpar for MINUIT;
+                             #  1=verify first, 2=trust (Gaussian chi2 only)
 
 NSPLITRAN=[NRAN] = number of independent sub-samples to run SALT2mu.
                   A separate fitres file is created for each sub-sample.
-JOBID_SPLITRAN=[JOBID] 
+JOBID_SPLITRAN=[JOBID]
    --> do only this splitran job, JOBID=1,2 ... NSPLITRAN
    --> write summary file if JOBID > NSPLITRAN
 
+nbootstrap=[K]       # load data+biasCor once, then fit K bootstrap
+                     # replicas in-process; replica i writes
+                     # [prefix]-BOOT[iii].fitres etc.
+seed_bootstrap=[SEED]  # random seed for resampling (default 12345)
+
+datafile_override_syst=s1.dat,s2.dat,...
+     # load data+biasCor once; fit nominal, then one refit per file
+     # with that override applied by itself. M0DIF shifts w.r.t. the
+     # nominal fit are summed into a z-bin covariance written to
+     # [prefix].MUCOV in the COV: format read by wfit (mucovar option).
+
 iflag_duplicate=1  # 0=ignore, 1=abort, 2=merge
 
 snid_mucovdump='5944'  # after each fit iteration, full muCOV dump 
@@ -918,6 +932,7 @@ Default output files (can change names with "prefix" argument)
 #include <gsl/gsl_fit.h>  // Jun 13 2016
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>   // Aug 2026: for ncore_minos fork option
 
 #define USE_THREAD   // Sep 2020 : used in SUBPROCESS mode
 
@@ -932,6 +947,7 @@ Default output files (can change names with "prefix" argument)
 //#define BBC_VERSION  3   // Jul 3 2020: add SUBPROCESS functions
 #define BBC_VERSION  4     // Sep 2020: add pthread option
 #define MXTHREAD    20
+#define MXCORE_MINOS 64    // Aug 2026: max forked cores for MINOS scans
 
 #define EVENT_TYPE_DATA     1
 #define EVENT_TYPE_BIASCOR  2
@@ -1131,6 +1147,65 @@ int  NDATA_BIASCORCUT[2][MXNUM_SAMPLE]; // track biascor reject for data
 int MAXSN ;
 int NJOB_SPLITRAN; // number of random split-jobs
 
+// Aug 2026: in-process bootstrap resampling (see nbootstrap= key).
+// Data and biasCor are loaded once; each replica refits with
+// per-event multiplicities drawn with replacement.
+struct {
+  int  NJOB ;  // current replica, 1 to INPUTS.nbootstrap
+  int *WGT ;   // per-event multiplicity for current replica
+} BOOTSTRAP ;
+
+// Aug 2026: in-process systematics engine (see datafile_override_syst=).
+// Data and biasCor are loaded once; fit 0 is nominal, then fit k
+// restores the nominal data columns and applies override file k by
+// itself. M0DIF shifts w.r.t. the nominal fit are summed into a z-bin
+// covariance that wfit reads with its mucovar option.
+#define MXCOL_SYSTVAR 8
+struct {
+  int      NJOB ;       // current fit: 0=nominal, then 1 to nfile_syst
+  int      IFILE_AUTOSTORE[MXFILE_AUTOSTORE]; // autoStore slot per variant
+
+  int      NCOL ;                      // number of snapshotted columns
+  float   *PTRCOL[MXCOL_SYSTVAR];      // TABLEVAR column pointers
+  float   *VAL_NOMINAL[MXCOL_SYSTVAR]; // nominal copy of each column
+
+  int      HASH_SIZE ;  // power of 2; see hash_CID
+  int     *HASH_ISN ;   // CID-hash --> data isn (-9 => empty slot)
+
+  double **M0DIF_STORE ; // M0DIF[ifit][iz]
+} SYSTVAR ;
+
+// Aug 2026: CUTWIN cuts compiled per event_type (see compile_CUTWIN).
+// Variable lookups, usesim checks and DOFLAG logic are resolved once;
+// the per-event loop in reject_CUTWIN is then plain window compares,
+// re-ordered periodically so the strongest rejector is tested first.
+#define NEVT_REORDER_CUTWIN 10000   // re-sort cuts every NEVT events
+struct {
+  bool   COMPILED ;              // true after compile_CUTWIN
+  int    DOFLAG_ORIG[MXCUTWIN] ; // to detect stale compilation
+  int    NCUT ;                  // number of active cuts
+  int    ICUT_ORIG[MXCUTWIN] ;   // index into INPUTS.CUTWIN_XXX arrays
+  int    DOFLAG[MXCUTWIN] ;      // resolved APPLY or FITWGT0
+  double LO[MXCUTWIN], HI[MXCUTWIN] ;
+  int    NFAIL[MXCUTWIN] ;       // measured rejection count
+  int    NEVT ;                  // events since last re-order
+} CUTWIN_COMPILED[MXEVENT_TYPE] ;
+
+// Aug 2026: contiguous SoA copy of fcn-critical data columns
+// (see prep_fcn_SOA). TABLEVAR carries dozens of columns, so the
+// handful read per event in the chi2 loop is spread over many cache
+// lines; pack them into dedicated arrays, and flatten the
+// pointer-chased covmat_tot[isn][3][3] into one block, so the chi2
+// loop streams a few contiguous arrays only.
+struct {
+  bool       VALID ;   // false -> re-pack before next fcn call
+  int        NSN ;     // size of malloc'd arrays (0 -> not malloc'd)
+  float     *zhd, *logmass, *zmuerr, *mumodel, *pIa ;
+  float     *mB, *x1, *c ;
+  short int *IDSAMPLE, *SIM_NONIA_INDEX ;
+  double    *covmat_tot ;  // flattened [9*isn + 3*ipar + ipar2]
+} FCN_SOA ;
+
 int    NSIMDATA,NSIMCC ;  // used to implement prescale_sim[Data,CC]
 double PIFAC; 
 
@@ -1408,6 +1483,14 @@ struct {
   MUZMAP_DEF  MUZMAP ;
   double PCC_biasCorScale[MXNUM_SAMPLE] ; // scale Prob_CC due to biasCor cut
 
+  // Aug 2026: cached mumodel = 5*log10(dl)+25 per TABLEVAR_CUTS event,
+  // rebuilt in setup_DMUPDF_CCprior only when cosPar changes (fixed in
+  // standard BBC fits). Avoids re-running the luminosity-distance
+  // integral for every CC event, sample and fit iteration.
+  double *MUMODEL_CUTS ;
+  double  cosPar_cache[NCOSPAR] ;
+  bool    valid_MUMODEL_CUTS ;
+
   float MEMORY;  // Mbytes
 } INFO_CCPRIOR;
 
@@ -1489,8 +1572,11 @@ struct INPUTS {
   int  nfile_data;
   char **dataFile;  
 
-  int nfile_data_override ; 
+  int nfile_data_override ;
   char **dataFile_override ; // e.g, change all VPEC, VPEC_ERR
+
+  int nfile_syst ;       // Aug 2026: number of systematic variant files
+  char **dataFile_syst ; // each file defines one override variant
   
   bool   cat_only;    // cat fitres files and do nothing else
   char   cat_file_out[MXCHAR_FILENAME] ;
@@ -1499,6 +1585,9 @@ struct INPUTS {
   int    write_csv ;  // M0DIF formatted for CosmoMC
 
   int    minos;
+  int    ncore_minos; // Ncore for forked MINOS scans (Aug 2026)
+  int    opt_gradient; // analytic dchi2/dpar for MINUIT (Aug 2026)
+  int    opt_profile; // write fit-timing profile to fitres (Aug 2026)
 
   int    nmax_tot ;   // Nmax to fit for all
   int    nmax[MXIDSURVEY];   // idem by survey
@@ -1642,6 +1731,9 @@ struct INPUTS {
   int NSPLITRAN ;       // number of random subsets to split jobs
   int JOBID_SPLITRAN ;  // do only this JOBID among NSPLITRAN
 
+  int nbootstrap ;      // number of in-process bootstrap replicas (Aug 2026)
+  int seed_bootstrap ;  // random seed for bootstrap resampling
+
   int iflag_duplicate;
 
   char   PREFIX[100] ; // out file names = [PREFIX].extension
@@ -1659,6 +1751,13 @@ struct INPUTS {
 } INPUTS ;
 
 
+// Aug 2026: open-address hash set over INPUTS.cidList_data so that
+// selectCID_data is O(1) per event instead of a linear list scan.
+// Built on demand (rebuilt if more CID files are read); uses the
+// shared HASH_STRING utilities in sntools.c.
+HASH_STRING_DEF CIDHASH_DATA ;
+
+
 // Nov 2017: define COSMODL storage for fast dl lookup
 struct {
   int USE;
@@ -1729,7 +1828,9 @@ struct {
   int IPARMAP_MN[MAXPAR];  // map minuit ipar to user ipar
   int IPARMAPINV_MN[MAXPAR];
 
-} FITINP ; 
+  int DOFLAG_GRADIENT ; // 1 -> fcn supplies dchi2/dpar (Aug 2026)
+
+} FITINP ;
 
 
 typedef struct {
@@ -1772,9 +1873,54 @@ typedef struct {
   double nsnfitIa, nsnfitcc ;   // note double for sum of BBC Probs
   int    nsnfit, nsnfit_truecc ;
 
+  double gradsum[MAXPAR] ;  // dchi2/dpar sums; opt_gradient (Aug 2026)
+
 } thread_chi2sums_def ;
 
 
+#ifdef USE_THREAD
+// Aug 2026: persistent thread pool so that fcn() re-uses the same
+// worker threads on every MINUIT call instead of paying
+// pthread_create+join overhead on each of ~10^4 fcn calls.
+struct {
+  bool            ACTIVE ;            // true after workers are launched
+  pthread_t       thread[MXTHREAD] ;
+  pthread_mutex_t mutex ;
+  pthread_cond_t  cond_work ;         // fcn -> workers: new xval ready
+  pthread_cond_t  cond_done ;         // workers -> fcn: sums ready
+  long long       ncall ;             // work generation = fcn-call count
+  int             ndone ;             // Nworker finished for current ncall
+  thread_chi2sums_def *thread_chi2sums ; // points to fcn's local array
+} FCN_THREADPOOL ;
+#endif
+
+
+// Aug 2026: fit-timing profile (opt_profile=1): wall time and
+// fcn-call count for each MINUIT command, plus cumulative time in
+// fcn(), biasCor interpolation and CCprior evaluation. The biasCor
+// and CCprior timers are filled only for nthread=1 so there are no
+// clock calls or races inside the threaded chi2 loop.
+#define MXSTAGE_FITPROF 100
+struct {
+  double    T_FCN, T_BIASCOR, T_CCPRIOR ;    // cumulative seconds
+  long long NCALL_BIASCOR, NCALL_CCPRIOR ;
+  int       NSTAGE ;
+  char      STAGE_NAME[MXSTAGE_FITPROF][20] ;
+  int       STAGE_ITER[MXSTAGE_FITPROF] ;      // NFIT_ITER of stage
+  int       STAGE_NCALL_FCN[MXSTAGE_FITPROF] ; // fcn calls in stage
+  double    STAGE_T[MXSTAGE_FITPROF] ;         // wall sec in stage
+} FITPROF ;
+
+
+// Aug 2026: asymmetric errors from forked per-parameter MINOS scans
+// (ncore_minos > 1); merged into printout by exec_mnpout_mnerrs.
+struct {
+  int    USE ;             // true if exec_minos_fork filled errors
+  bool   VALID[MAXPAR] ;   // true if scan for this ipar succeeded
+  double EPLUS[MAXPAR], EMINUS[MAXPAR] ;
+} MINOS_FORK ;
+
+
 // define fit results
 struct {
   int NSNFIT ;        // Number of SN used in fit; was nsnacc
@@ -1891,11 +2037,15 @@ double sum_ZPOLY_COVMAT(double Z, double *polyPar) ;
 void parse_CUTWIN(char *item);
 void parse_FIELDLIST(char *item);
 int  reject_CUTWIN(int EVENT_TYPE, int *DOFLAG_CUTWIN, double *CUTVAL_LIST);
+void compile_CUTWIN(int EVENT_TYPE, int *DOFLAG_CUTWIN);  // Aug 2026
 int  usesim_CUTWIN(char *varName) ;
 int  set_DOFLAG_CUTWIN(int ivar, int icut, int isData );
 
+unsigned int hash_CID(char *cid);         // Aug 2026: -> hash_string
+void build_cidHash_data(void);            // Aug 2026
+
 void parse_sntype(char *item);
-void parse_cidFile_data(int OPT, char *item); 
+void parse_cidFile_data(int OPT, char *item);
 void parse_prescale_biascor(char *item);
 void parse_powzbin(char *item) ;
 void parse_IDSAMPLE_SELECT(char *item);
@@ -2074,6 +2224,14 @@ void  write_NWARN(FILE *fp, int FLAG) ;
 
 int   SPLITRAN_ACCEPT(int isn, int snid);
 void  SPLITRAN_cutmask(void);
+void  BOOTSTRAP_prep(void);   // Aug 2026
+
+void  SYSTVAR_prep(void);          // Aug 2026, in-process systematics
+void  SYSTVAR_apply(void);
+void  SYSTVAR_store_M0DIF(void);
+void  SYSTVAR_write_mucov(void);
+
+void  prep_fcn_SOA(void);          // Aug 2026, pack chi2-loop columns
 
 
 /* xxxxxxxxxx Mark delete Dec 2020 xxxxxxxxx 
@@ -2110,6 +2268,8 @@ double rombint(double f(double z, double *cosPar),
 double avemag0_calc(int opt_dump);
 void   M0dif_calc(void) ;
 double fcn_M0(int n, double *M0LIST );
+int    fcn_M0_izwgt(int n, int *izlist, double *wgtlist); // Aug 2026
+void   prep_fcn_gradient(void);                           // Aug 2026
 
 void   muerr_renorm(void);
 void   printCOVMAT(FILE *fp, int NPAR, int NPARz_write);
@@ -2149,12 +2309,17 @@ void rs_(void *n, int *nm,double *err,double *w, bool *matz,
            double *z,double *fv1,double *fv2,int *ierr);  
 
 //MINUIT function definitions
+double walltime_fitprof(void);
+void   update_stage_fitprof(char *stageName, int ncall_fcn, double t_sec);
+void   write_fitprof(FILE *fout);
+
 void mninit_(const int* ird,const int* iwr,const int* isav);
 void mnparm_(const int* nun, const char chnam[], const double* stval,
 	     const double* step, const double* bnd1, const double* bnd2,
 	     int* ierflg, int nchnam);
 void exec_mnparm(void); // local shell function to call mnparm_
 void exec_mnpout_mnerrs(void); // loop over params and store VAL and ERR
+void exec_minos_fork(void);    // forked per-param MINOS (ncore_minos>1)
 
 void mnseti_(const char ctitle[], int nctitle);
 
@@ -2164,6 +2329,11 @@ void mnpout_(const int* num, char chnam[], double* val, double* error,
 
 void *MNCHI2FUN(void *thread);
 
+#ifdef USE_THREAD
+void  init_fcn_threadpool(void);
+void *exec_fcn_threadpool(void *id);
+#endif
+
 typedef void (mfcn)( int* npar, double grad[], double* fval,
 	 double xval[], int* iflag, void*);
 void mncomd_(mfcn *fcn, char *text, int *icondn, const int *opt, int len);
@@ -2381,6 +2551,11 @@ void SALT2mu_DRIVER_INIT(int argc, char **argv) {
   // prepare input
   prep_input_driver();
 
+  // Aug 2026: for fixed cosPar, build dl-vs-z lookup consumed by
+  // cosmodl_forFit; must come before read_data so that the per-event
+  // mumodel loads in compute_more_TABLEVAR use it.
+  prep_cosmodl_lookup();
+
   //  test_zmu_solve();
   //  test_muerrz(); // xxxx
 
@@ -2423,6 +2598,9 @@ void SALT2mu_DRIVER_INIT(int argc, char **argv) {
   SUBPROCESS_INIT();
 #endif
 
+  // Aug 2026: prep in-process systematics engine
+  if ( INPUTS.nfile_syst > 0 ) { SYSTVAR_prep(); }
+
   t_end_init = time(NULL);
 
   return ;
@@ -2463,14 +2641,29 @@ void SALT2mu_DRIVER_EXEC(void) {
   DOFIT_FLAG = FITFLAG_CHI2 ; 
   printmsg_fitStart(FP_STDOUT);
   
-  if ( INPUTS.NSPLITRAN > 1 ) { 
+  if ( INPUTS.NSPLITRAN > 1 ) {
     SPLITRAN_cutmask();     // check for random sub-samples
     prep_input_repeat();  // re-initialize a few things (May 2019)
   }
 
+  // Aug 2026: draw bootstrap multiplicities for next replica
+  if ( INPUTS.nbootstrap > 0 ) {
+    BOOTSTRAP.NJOB++ ;
+    BOOTSTRAP_prep();
+    if ( BOOTSTRAP.NJOB > 1 ) { prep_input_repeat(); }
+  }
+
+  // Aug 2026: apply next systematic override variant (fit 0 = nominal)
+  if ( INPUTS.nfile_syst > 0 && SYSTVAR.NJOB > 0 ) {
+    SYSTVAR_apply();
+    prep_input_repeat();
+  }
+
   setup_zbins_fit();    // set z-bins for data and biasCor
 
   FITRESULT.NCALL_FCN = 0 ;
+  memset(&FITPROF, 0, sizeof(FITPROF) );  // reset profile (Aug 2026)
+  memset(&MINOS_FORK, 0, sizeof(MINOS_FORK) );
   mninit_(&inf,&outf,&savef);
 
   strcpy(mcom,"SET PRI -1");     len = strlen(mcom);
@@ -2485,30 +2678,51 @@ void SALT2mu_DRIVER_EXEC(void) {
   // use FCN call and make chi2-outlier cut (Jul 19 2019)
   applyCut_chi2max();
 
+  // check option for analytic dchi2/dpar in MIGRAD (Aug 2026)
+  prep_fcn_gradient();
+
   FITRESULT.NFIT_ITER = 0 ;
 
   // print stats for data after ALL cuts are applied
   print_eventStats(EVENT_TYPE_DATA);
   
   // Beginning of DOFIT loop
+
+  double t_stage;  int ncall_stage;  // for opt_profile (Aug 2026)
+
   while ( DOFIT_FLAG != FITFLAG_DONE  ) {
 
     //Miniut MINIMIZE (find minimum chi-squared)
     strcpy(mcom,"SIM 1000");   len = strlen(mcom);
+    t_stage = walltime_fitprof();  ncall_stage = FITRESULT.NCALL_FCN ;
     mncomd_(fcn, mcom, &icondn, &null, len);  fflush(FP_STDOUT);
+    update_stage_fitprof("SIMPLEX", FITRESULT.NCALL_FCN - ncall_stage,
+			 walltime_fitprof() - t_stage );
 
     strcpy(mcom,"MINI");   len = strlen(mcom);
-    mncomd_(fcn,mcom,&icondn,&null,len);  fflush(FP_STDOUT); 
+    t_stage = walltime_fitprof();  ncall_stage = FITRESULT.NCALL_FCN ;
+    mncomd_(fcn,mcom,&icondn,&null,len);  fflush(FP_STDOUT);
+    update_stage_fitprof("MINIMIZE", FITRESULT.NCALL_FCN - ncall_stage,
+			 walltime_fitprof() - t_stage );
 
     //Minuit MINOS (compute errors)
     strcpy(mcom,STRING_MINUIT_ERROR[INPUTS.minos]);
 
-    len = strlen(mcom); 
-    mncomd_(fcn, mcom, &icondn, &null, len);  fflush(FP_STDOUT);
+    len = strlen(mcom);
+    t_stage = walltime_fitprof();  ncall_stage = FITRESULT.NCALL_FCN ;
+    if ( INPUTS.minos && INPUTS.ncore_minos > 1 )
+      { exec_minos_fork(); }   // Aug 2026: scan params on forked cores
+    else
+      { mncomd_(fcn, mcom, &icondn, &null, len);  fflush(FP_STDOUT); }
+    update_stage_fitprof(mcom, FITRESULT.NCALL_FCN - ncall_stage,
+			 walltime_fitprof() - t_stage );
 
     //Final call to FCN at minimum of chi-squared
     strcpy(mcom,"CALL FCN 3");  len = strlen(mcom);
+    t_stage = walltime_fitprof();  ncall_stage = FITRESULT.NCALL_FCN ;
     mncomd_(fcn, mcom, &icondn, &null, len);   fflush(FP_STDOUT);
+    update_stage_fitprof("CALLFCN3", FITRESULT.NCALL_FCN - ncall_stage,
+			 walltime_fitprof() - t_stage );
 
     mnstat_(&chi2min, &fedm, &errdef, &npari, &nparx, &istat);
     ndof = FITRESULT.NSNFIT - npari; 
@@ -2529,6 +2743,72 @@ void SALT2mu_DRIVER_EXEC(void) {
 } // end SALT2mu_DRIVER_EXEC
 
 
+// ==================================
+double walltime_fitprof(void) {
+  // Created Aug 2026: wall time (sec) on monotonic clock,
+  // for opt_profile instrumentation.
+  struct timespec t ;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1.0E-9*(double)t.tv_nsec ;
+}
+
+// ==================================
+void update_stage_fitprof(char *stageName, int ncall_fcn, double t_sec) {
+
+  // Created Aug 2026
+  // Append one MINUIT-command record (name, Nfcn, wall sec) to the
+  // FITPROF stage list; no-op unless opt_profile input is set.
+
+  int NSTAGE = FITPROF.NSTAGE ;
+  // ---------- BEGIN ------------
+
+  if ( INPUTS.opt_profile == 0 )   { return; }
+  if ( NSTAGE >= MXSTAGE_FITPROF ) { return; } // silently stop appending
+
+  sprintf(FITPROF.STAGE_NAME[NSTAGE], "%.16s", stageName);
+  FITPROF.STAGE_ITER[NSTAGE]      = FITRESULT.NFIT_ITER ;
+  FITPROF.STAGE_NCALL_FCN[NSTAGE] = ncall_fcn ;
+  FITPROF.STAGE_T[NSTAGE]         = t_sec ;
+  FITPROF.NSTAGE++ ;
+
+  return ;
+
+} // end update_stage_fitprof
+
+// ==================================
+void write_fitprof(FILE *fout) {
+
+  // Created Aug 2026
+  // Write machine-readable timing profile (opt_profile input)
+  // as comment block in fitres output: one line per MINUIT command
+  // with fcn-call count and wall time, then cumulative totals for
+  // fcn, biasCor interp and CCprior. biasCor/CCprior totals are
+  // valid only for nthread=1 (see MNCHI2FUN).
+
+  int i ;
+  // ---------- BEGIN ------------
+
+  fprintf(fout,"# FITPROF_BEGIN \n");
+  for(i=0; i < FITPROF.NSTAGE; i++ ) {
+    fprintf(fout,"# FITPROF_STAGE: ITER=%d NAME=%s NCALL_FCN=%d "
+	    "T_SEC=%.3f \n",
+	    FITPROF.STAGE_ITER[i], FITPROF.STAGE_NAME[i],
+	    FITPROF.STAGE_NCALL_FCN[i], FITPROF.STAGE_T[i] );
+  }
+  fprintf(fout,"# FITPROF_FCN:     NCALL=%d  T_SEC=%.3f \n",
+	  FITRESULT.NCALL_FCN, FITPROF.T_FCN );
+  fprintf(fout,"# FITPROF_BIASCOR: NCALL=%lld  T_SEC=%.3f \n",
+	  FITPROF.NCALL_BIASCOR, FITPROF.T_BIASCOR );
+  fprintf(fout,"# FITPROF_CCPRIOR: NCALL=%lld  T_SEC=%.3f \n",
+	  FITPROF.NCALL_CCPRIOR, FITPROF.T_CCPRIOR );
+  fprintf(fout,"# FITPROF_END \n");
+  fflush(fout);
+
+  return ;
+
+} // end write_fitprof
+
+
 // ***********************************************
 int SALT2mu_DRIVER_SUMMARY(void) {
 
@@ -2581,9 +2861,22 @@ int SALT2mu_DRIVER_SUMMARY(void) {
   outFile_driver();
 
   //---------
-  if ( NJOB_SPLITRAN < INPUTS.NSPLITRAN  &&  INPUTS.JOBID_SPLITRAN<0 ) 
+  if ( NJOB_SPLITRAN < INPUTS.NSPLITRAN  &&  INPUTS.JOBID_SPLITRAN<0 )
     { return(FLAG_EXEC_REPEAT); }
 
+  // Aug 2026: more bootstrap replicas to fit
+  if ( INPUTS.nbootstrap > 0 && BOOTSTRAP.NJOB < INPUTS.nbootstrap )
+    { return(FLAG_EXEC_REPEAT); }
+
+  // Aug 2026: store M0DIF for systematics engine; check for more
+  // variants, and write covariance after the last one.
+  if ( INPUTS.nfile_syst > 0 ) {
+    SYSTVAR_store_M0DIF();
+    if ( SYSTVAR.NJOB < INPUTS.nfile_syst )
+      { SYSTVAR.NJOB++ ;  return(FLAG_EXEC_REPEAT); }
+    SYSTVAR_write_mucov();
+  }
+
 #ifdef USE_SUBPROCESS
   if ( SUBPROCESS.USE ) {
     printf("%s CHI2_MIN = %.2f   <M0> = %.4f  NFIT_ITER=%d\n",
@@ -2741,7 +3034,11 @@ void exec_mnpout_mnerrs(void) {
     else  {
       mnerrs_(&iMN, &eplus, &eminus, &eparab, &globcc);
 
-      if ( fabs(eplus) > 1.0E-6 && fabs(eminus) > 1.0E-6 ) 
+      // Aug 2026: asymmetric errors from forked MINOS scans
+      if ( MINOS_FORK.USE && MINOS_FORK.VALID[ipar] )
+	{ eplus = MINOS_FORK.EPLUS[ipar];  eminus = MINOS_FORK.EMINUS[ipar]; }
+
+      if ( fabs(eplus) > 1.0E-6 && fabs(eminus) > 1.0E-6 )
 	{ PARERR = 0.5*( fabs(eplus) + fabs(eminus) ) ; }
       else
 	{ PARERR = eparab; } // Apr 15 2020 : better than nothing
@@ -2785,6 +3082,141 @@ void exec_mnpout_mnerrs(void) {
 } // end exec_mnpout_mnerrs
 
 
+// ***********************************************
+void exec_minos_fork(void) {
+
+  // Created Aug 2026
+  // Replace the single serial "MINOS" command with per-parameter
+  // "MINOS 0 <parno>" scans distributed over INPUTS.ncore_minos
+  // forked processes. Each child inherits a copy-on-write snapshot
+  // of the converged MIGRAD state, so the scans are independent;
+  // the asymmetric errors come back through a pipe and are merged
+  // into the printout by exec_mnpout_mnerrs. Threads cannot be used
+  // here because MINUIT (fortran common blocks) and fcn (INFO_DATA,
+  // FITINP ...) communicate through global state.
+  //
+  // Known caveat (same as any distributed MINOS): if a child finds
+  // a lower minimum during its scan, the improved minimum is not
+  // propagated back to the parent.
+
+  int NCORE    = INPUTS.ncore_minos ;
+  int NPAR_VAR = 0, NPAR_DONE = 0 ;
+  int LEN_VARNAME = 10 ;
+  int LIST_IMN[MAXPAR] ;
+  int fd_pipe[MXCORE_MINOS][2] ;
+  pid_t LIST_PID[MXCORE_MINOS], pid ;
+  double PARVAL, PARERR, bnd1, bnd2 ;
+  double eplus, eminus, eparab, globcc ;
+  int ipar, iMN, iv, icore, icondn, len, status, i ;
+  const int null = 0 ;
+  char text[100], mcom[40] ;
+  char fnam[] = "exec_minos_fork" ;
+
+  struct { int parno ;  double eplus, eminus ; } record ;
+
+  // ----------- BEGIN -----------
+
+  MINOS_FORK.USE = 0 ;
+
+  // collect external MINUIT numbers of variable parameters
+  for ( ipar=0; ipar < FITINP.NFITPAR_ALL; ipar++ ) {
+    iMN = ipar + 1 ;   text[0] = 0 ;
+    mnpout_(&iMN, text, &PARVAL, &PARERR, &bnd1,&bnd2, &iv, LEN_VARNAME);
+    if ( iv > 0 ) { LIST_IMN[NPAR_VAR] = iMN ;  NPAR_VAR++ ; }
+  }
+
+  if ( NCORE > NPAR_VAR     ) { NCORE = NPAR_VAR ; }
+  if ( NCORE > MXCORE_MINOS ) { NCORE = MXCORE_MINOS ; }
+
+  // fall back to serial MINOS if there is nothing to distribute
+  if ( NCORE < 2 ) {
+    strcpy(mcom,"MINOS");   len = strlen(mcom);
+    mncomd_(fcn, mcom, &icondn, &null, len);  fflush(FP_STDOUT);
+    return ;
+  }
+
+  fprintf(FP_STDOUT, " %s: scan %d variable params on %d forked cores\n",
+	  fnam, NPAR_VAR, NCORE );
+  fflush(FP_STDOUT);
+
+  for ( icore=0; icore < NCORE; icore++ ) {
+
+    if ( pipe(fd_pipe[icore]) != 0 ) {
+      sprintf(c1err,"pipe() failed for icore=%d", icore);
+      sprintf(c2err,"Try smaller ncore_minos (current=%d)",
+	      INPUTS.ncore_minos );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    pid = fork();
+
+    if ( pid < 0 ) {
+      sprintf(c1err,"fork() failed for icore=%d", icore);
+      sprintf(c2err,"Try smaller ncore_minos (current=%d)",
+	      INPUTS.ncore_minos );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    if ( pid == 0 ) {
+      // child: run every NCORE'th parameter scan and write the
+      // asymmetric errors to the pipe.
+      close(fd_pipe[icore][0]);
+
+      INPUTS.nthread = 1 ;  // worker threads are not inherited by fork
+
+      // silence MINUIT scan chatter; dup2 of fd 1 also covers the
+      // fortran unit-6 writes that freopen would miss.
+      FILE *fpnull = fopen("/dev/null","w");
+      if ( fpnull != NULL ) { dup2(fileno(fpnull), 1); }
+
+      for ( i = icore; i < NPAR_VAR; i += NCORE ) {
+	iMN = LIST_IMN[i] ;
+	sprintf(mcom, "MINOS 0 %d", iMN);   len = strlen(mcom);
+	mncomd_(fcn, mcom, &icondn, &null, len);
+	mnerrs_(&iMN, &eplus, &eminus, &eparab, &globcc);
+
+	record.parno  = iMN ;
+	record.eplus  = eplus ;
+	record.eminus = eminus ;
+	write(fd_pipe[icore][1], &record, sizeof(record));
+      }
+
+      close(fd_pipe[icore][1]);
+      _exit(0);
+    }
+
+    // parent
+    close(fd_pipe[icore][1]);
+    LIST_PID[icore] = pid ;
+
+  } // end icore loop
+
+  // read error records from each child until its pipe closes
+  for ( icore=0; icore < NCORE; icore++ ) {
+    while ( read(fd_pipe[icore][0], &record, sizeof(record))
+	    == sizeof(record) ) {
+      ipar = record.parno - 1 ;
+      MINOS_FORK.EPLUS[ipar]  = record.eplus ;
+      MINOS_FORK.EMINUS[ipar] = record.eminus ;
+      MINOS_FORK.VALID[ipar]  =
+	( fabs(record.eplus) > 1.0E-12 || fabs(record.eminus) > 1.0E-12 );
+      if ( MINOS_FORK.VALID[ipar] ) { NPAR_DONE++ ; }
+    }
+    close(fd_pipe[icore][0]);
+    waitpid(LIST_PID[icore], &status, 0);
+  }
+
+  MINOS_FORK.USE = 1 ;
+
+  fprintf(FP_STDOUT, " %s: stored MINOS errors for %d of %d params.\n",
+	  fnam, NPAR_DONE, NPAR_VAR );
+  fflush(FP_STDOUT);
+
+  return ;
+
+} // end exec_minos_fork
+
+
 // ***********************************************
 void setup_BININFO_redshift(void) {
 
@@ -3483,14 +3915,15 @@ void check_duplicate_SNID(void) {
   // 1 -> abort
   // 2 -> merge fitparams and cov into one LC
   //
+  // Aug 2026: replace z-sort plus nested scan with a single pass
+  // over rows using an open-address hash on SNID; a duplicate is
+  // still defined as same SNID and same zhd.
 
   int  iflag   = INPUTS.iflag_duplicate;
   int  MXSTORE = MXSTORE_DUPLICATE ;
-  int  isn, isn2, nsn, MEMD, MEMI, MEMB;
-  int  unsort, unsort2, *unsortList, ORDER_SORT   ;
-  bool IS_SIM, LDMP ;
-  double *zList ;
-  bool   *IS_DUPL;
+  int  isn, isn2, nsn, MEMI, HSIZE, h ;
+  int  unsort, *HASH_ISN, *HASH_IDUP ;
+  bool IS_SIM ;
   char fnam[] = "check_duplicate_SNID" ;
 
   // ----------- BEGIN -----------
@@ -3505,23 +3938,16 @@ void check_duplicate_SNID(void) {
   if ( IS_SIM ) { return; }
   // xxx mark delete  if ( IS_SIM && iflag == IFLAG_DUPLICATE_IGNORE) { return; }
 
-  MEMD = (nsn+1) * sizeof(double)  ;
-  MEMI = (nsn+1) * sizeof(int)     ;
-  MEMB = (nsn+1) * sizeof(bool)    ;
-  zList      = (double *)malloc(MEMD); // allocate redshift list
-  unsortList = (int    *)malloc(MEMI); // allocate sorted list
-  IS_DUPL    = (bool   *)malloc(MEMB);
-
-  for(isn=0; isn<nsn; isn++)  {
-    zList[isn] = (double)INFO_DATA.TABLEVAR.zhd[isn]; 
-    IS_DUPL[isn] = false;
-  }
-  
-
-  ORDER_SORT = + 1 ; // increasing order
-  sortDouble( nsn, zList, ORDER_SORT, unsortList ) ;
+  // HASH_ISN[slot]  = first row with this SNID+zhd (-9 => empty)
+  // HASH_IDUP[slot] = duplicate-set index (-9 => no duplicate yet)
+  HSIZE = 64 ;
+  while ( HSIZE < 2*nsn ) { HSIZE *= 2 ; }
+  MEMI      = HSIZE * sizeof(int) ;
+  HASH_ISN  = (int*)malloc(MEMI);
+  HASH_IDUP = (int*)malloc(MEMI);
+  for(h=0; h < HSIZE; h++ ) { HASH_ISN[h] = HASH_IDUP[h] = -9 ; }
 
-  bool SAME, SAME_z, SAME_SNID, FOUND_DUPL ;
+  bool SAME_z, SAME_SNID, FOUND_DUPL ;
   int   NTMP, idup ;
   double z, z2 ;
   char *snid, *snid2 ;
@@ -3534,55 +3960,43 @@ void check_duplicate_SNID(void) {
   NDUPL_SET = NDUPL_TOT = NDUPL_SN = 0 ;
   for(idup=0; idup < MXSTORE; idup++ )  {  NDUPL_LIST[idup] = 0 ; }
 
-  for ( isn=0; isn < nsn-1; isn++ ) {
-    unsort  = unsortList[isn];
-    z      = INFO_DATA.TABLEVAR.zhd[unsort];
-    snid   = INFO_DATA.TABLEVAR.name[unsort];    
-
-    if ( IS_DUPL[isn] ) { continue; }
-    isn2 = isn  ;      z2 = z;   FOUND_DUPL=false;
-
-    while ( z == z2 && isn2 < nsn-1 ) {
-      isn2++ ;
-      unsort2    = unsortList[isn2];
-      z2         = INFO_DATA.TABLEVAR.zhd[unsort2];
-      snid2      = INFO_DATA.TABLEVAR.name[unsort2];
-      SAME_SNID  = ( strcmp(snid,snid2) == 0 );
-
-      if ( IS_DUPL[isn2] ) { continue; }
-      if ( !SAME_SNID    ) { continue; }
-
-      // we have a duplicate
-      NDUPL_TOT++ ; 
-      IS_DUPL[isn] = IS_DUPL[isn2] = true; 
-
-      /* xxx
-      if ( isn < 10 ) {
-	printf(" xxx %s: compare %s/%s  %d/%d  FOUND=%d\n", 
-	       fnam, snid, snid2, isn,isn2, FOUND_DUPL ); fflush(stdout);
-      }
-      xxxxxx*/
-
-      if ( NDUPL_SET >= MXSTORE ) { continue; }
-
-      // store this duplicate
-      if ( !FOUND_DUPL ) {
-	// first duplicate for isn; store isn info
-	FOUND_DUPL = true;
-	NDUPL_SET++ ;  // increment number of duplicate sets
-	NDUPL_SN++ ;
-	NTMP = NDUPL_LIST[NDUPL_SET-1] ;
-	UNSORT_DUPL[NDUPL_SET-1][NTMP] = unsort ;
-	NDUPL_LIST[NDUPL_SET-1]++ ;
-      }
-
-      // always store isn2 info
-      NTMP = NDUPL_LIST[NDUPL_SET-1] ;
-      if( NTMP < MXSTORE ) { UNSORT_DUPL[NDUPL_SET-1][NTMP] = unsort2 ; }
-      NDUPL_LIST[NDUPL_SET-1]++ ;
+  for ( isn=0; isn < nsn; isn++ ) {
+    z      = INFO_DATA.TABLEVAR.zhd[isn];
+    snid   = INFO_DATA.TABLEVAR.name[isn];
+    h      = (int)( hash_CID(snid) & (unsigned int)(HSIZE-1) );
+
+    FOUND_DUPL = false ;
+    while ( (isn2 = HASH_ISN[h]) >= 0 ) {
+      snid2     = INFO_DATA.TABLEVAR.name[isn2];
+      z2        = INFO_DATA.TABLEVAR.zhd[isn2];
+      SAME_SNID = ( strcmp(snid,snid2) == 0 );
+      SAME_z    = ( z == z2 ) ;
+      if ( SAME_SNID && SAME_z ) { FOUND_DUPL = true ; break ; }
+      h++ ;  if ( h == HSIZE ) { h = 0 ; }
+    }
+
+    // first time this SNID+zhd is seen -> intern row and move on
+    if ( !FOUND_DUPL ) { HASH_ISN[h] = isn ;  continue ; }
+
+    // we have a duplicate of row isn2
+    NDUPL_TOT++ ;
+
+    if ( HASH_IDUP[h] < 0 && NDUPL_SET < MXSTORE ) {
+      // first duplicate for isn2; open new set and store isn2
+      HASH_IDUP[h] = NDUPL_SET ;
+      UNSORT_DUPL[NDUPL_SET][0] = isn2 ;
+      NDUPL_LIST[NDUPL_SET] = 1 ;
+      NDUPL_SET++ ;   NDUPL_SN++ ;
+    }
+
+    idup = HASH_IDUP[h] ;
+    if ( idup >= 0 ) {
+      NTMP = NDUPL_LIST[idup] ;
+      if ( NTMP < MXSTORE ) { UNSORT_DUPL[idup][NTMP] = isn ; }
+      NDUPL_LIST[idup]++ ;
       NDUPL_SN++ ;
-      
-    }  // end z==z2 (isn2 loop)
+    }
+
   } // end loop over isn
 
   // - - - - -
@@ -3638,7 +4052,7 @@ void check_duplicate_SNID(void) {
 
 
  DONE:
-  free(zList);  free(unsortList);
+  free(HASH_ISN);  free(HASH_IDUP);
 
   return;
 
@@ -4054,9 +4468,8 @@ void fcn(int *npar, double grad[], double *fval, double xval[],
   int  NSN_DATA    = INFO_DATA.TABLEVAR.NSN_ALL ;
   int  nthread     = INPUTS.nthread ;
   int  NFITPAR_ALL = FITINP.NFITPAR_ALL ; // Ncospar + Nzbin
-  int  ipar, t, rc, NERR, NSN_per_thread, isn_min, isn_max ;
+  int  ipar, t, NSN_per_thread, isn_min, isn_max ;
 
-  pthread_t thread[MXTHREAD];
   thread_chi2sums_def  thread_chi2sums[MXTHREAD];
   char fnam[] = "fnam";
 
@@ -4070,6 +4483,12 @@ void fcn(int *npar, double grad[], double *fval, double xval[],
     if ( isinf(xval[ipar]) ) { *fval = 1.0E14; return; }
   }
 
+  double t_fcn_start = 0.0 ;  // opt_profile (Aug 2026)
+  if ( INPUTS.opt_profile ) { t_fcn_start = walltime_fitprof(); }
+
+  // Aug 2026: re-pack contiguous SoA columns if anything changed
+  if ( !FCN_SOA.VALID ) { prep_fcn_SOA(); }
+
   if ( nthread == 1 ) 
     { NSN_per_thread = NSN_DATA; }
   else
@@ -4095,33 +4514,27 @@ void fcn(int *npar, double grad[], double *fval, double xval[],
       { thread_chi2sums[t].xval_fcn[ipar] = xval[ipar];   }
 
     if ( nthread == 1 )
-      {  MNCHI2FUN(&thread_chi2sums);  } 
-#ifdef USE_THREAD
-    else  { 
-      rc = pthread_create(&thread[t], NULL, MNCHI2FUN, 
-			  &thread_chi2sums[t] ) ; 
-    }
-#endif
+      {  MNCHI2FUN(&thread_chi2sums);  }
+
   }  // end t loop over threads
 
-  // - - - - - - - 
+  // - - - - - - -
 #ifdef USE_THREAD
-  // for threads, wait for them all to finish
+  // Aug 2026: hand current xval to persistent worker pool and wait
+  // for all partial sums; replaces pthread_create+join per fcn call.
   if ( nthread > 1 ) {
-    NERR = 0 ;
-    for ( t = 0; t < nthread; t++ ) { 
-      rc = pthread_join(thread[t], NULL); 
-      if ( rc != 0 ) {
-	NERR++; 
-	printf(" ERROR: thread return errcode=%d for t=%d\n", rc,t); }
-    }
-
-    if ( NERR > 0 ) {
-      sprintf(c1err,"%d thread return code errors", NERR);
-      sprintf(c2err,"NCALL_FCN=%d", FITRESULT.NCALL_FCN );
-      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
-    }  
-  } // end ntrhread>1
+    if ( !FCN_THREADPOOL.ACTIVE ) { init_fcn_threadpool(); }
+
+    pthread_mutex_lock(&FCN_THREADPOOL.mutex);
+    FCN_THREADPOOL.thread_chi2sums = thread_chi2sums ; // on fcn stack
+    FCN_THREADPOOL.ndone = 0 ;
+    FCN_THREADPOOL.ncall++ ;
+    pthread_cond_broadcast(&FCN_THREADPOOL.cond_work);
+    while ( FCN_THREADPOOL.ndone < nthread )
+      { pthread_cond_wait(&FCN_THREADPOOL.cond_done,
+			  &FCN_THREADPOOL.mutex); }
+    pthread_mutex_unlock(&FCN_THREADPOOL.mutex);
+  } // end nthread>1
 #endif
 
   // ===============================================
@@ -4141,6 +4554,15 @@ void fcn(int *npar, double grad[], double *fval, double xval[],
     chi2sum_tot   += thread_chi2sums[t].chi2sum_tot ;
   }
 
+  // Aug 2026: return analytic derivatives when MINUIT asks (iflag=2)
+  if ( *iflag == 2 && FITINP.DOFLAG_GRADIENT ) {
+    for ( ipar=0; ipar < FITINP.NFITPAR_ALL; ipar++ ) {
+      grad[ipar] = 0.0 ;
+      for ( t = 0; t < nthread; t++ )
+	{ grad[ipar] += thread_chi2sums[t].gradsum[ipar] ; }
+    }
+  }
+
 
   // load globals
   FITRESULT.NSNFIT        = nsnfit ;
@@ -4162,10 +4584,91 @@ void fcn(int *npar, double grad[], double *fval, double xval[],
   
   *fval = chi2sum_tot;
 
+  if ( INPUTS.opt_profile )
+    { FITPROF.T_FCN += walltime_fitprof() - t_fcn_start ; }
+
   return ;
-    
+
 } // end fcn for pthread
 
+
+// =================================================================
+void init_fcn_threadpool(void) {
+
+  // Created Aug 2026
+  // Launch INPUTS.nthread persistent worker threads for fcn().
+  // Workers block on cond_work between fcn calls and live until
+  // the process exits; there is no teardown.
+
+  int nthread = INPUTS.nthread ;
+  int t, rc ;
+  char fnam[] = "init_fcn_threadpool" ;
+
+  // ----------- BEGIN ----------------
+
+  pthread_mutex_init(&FCN_THREADPOOL.mutex,     NULL);
+  pthread_cond_init (&FCN_THREADPOOL.cond_work, NULL);
+  pthread_cond_init (&FCN_THREADPOOL.cond_done, NULL);
+  FCN_THREADPOOL.ncall = 0 ;
+  FCN_THREADPOOL.ndone = 0 ;
+
+  for ( t = 0; t < nthread; t++ ) {
+    rc = pthread_create(&FCN_THREADPOOL.thread[t], NULL,
+			exec_fcn_threadpool, (void *)(long)t ) ;
+    if ( rc != 0 ) {
+      sprintf(c1err,"pthread_create returned errcode=%d for t=%d", rc, t);
+      sprintf(c2err,"Check nthread=%d input", nthread );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+
+  FCN_THREADPOOL.ACTIVE = true ;
+
+  printf("\t %s: launched %d persistent chi2 threads \n",
+	 fnam, nthread ); fflush(stdout);
+
+  return ;
+
+} // end init_fcn_threadpool
+
+
+// =================================================================
+void *exec_fcn_threadpool(void *id) {
+
+  // Created Aug 2026
+  // Worker loop for persistent thread pool: wait for fcn() to
+  // publish a new work generation (ncall), run MNCHI2FUN on this
+  // thread's event block, then report partial sums via ndone.
+
+  int id_thread = (int)(long)id ;
+  long long ncall_last = 0 ;
+
+  // ----------- BEGIN ----------------
+
+  while ( true ) {
+
+    pthread_mutex_lock(&FCN_THREADPOOL.mutex);
+    while ( FCN_THREADPOOL.ncall == ncall_last )
+      { pthread_cond_wait(&FCN_THREADPOOL.cond_work,
+			  &FCN_THREADPOOL.mutex); }
+    ncall_last = FCN_THREADPOOL.ncall ;
+    pthread_mutex_unlock(&FCN_THREADPOOL.mutex);
+
+    MNCHI2FUN( &FCN_THREADPOOL.thread_chi2sums[id_thread] );
+
+    pthread_mutex_lock(&FCN_THREADPOOL.mutex);
+    FCN_THREADPOOL.ndone++ ;
+    if ( FCN_THREADPOOL.ndone == INPUTS.nthread )
+      { pthread_cond_signal(&FCN_THREADPOOL.cond_done); }
+    pthread_mutex_unlock(&FCN_THREADPOOL.mutex);
+
+  } // end while over work generations
+
+  return (void *) 0 ;
+
+} // end exec_fcn_threadpool
+
+
 // =================================================================
 void *MNCHI2FUN(void *thread) {
 
@@ -4202,6 +4705,14 @@ void *MNCHI2FUN(void *thread) {
   double muerr_raw, muerrsq_raw, muerrsq_tmp, muerr_update, muerrsq_update ; 
   double chi2evt, chi2evt_Ia, scalePIa, scalePCC, nsnfitIa=0.0, nsnfitcc=0.0;
   int    n, nsnfit, nsnfit_truecc, ipar, ipar2 ;
+  int    wboot;   double xwboot;  // bootstrap multiplicity (Aug 2026)
+
+  // analytic-gradient locals; opt_gradient (Aug 2026)
+  int    DOGRAD = ( FITINP.DOFLAG_GRADIENT && iflag == 2 );
+  double *gradsum = thread_chi2sums->gradsum ;
+  double VECG[NLCPAR], dsig2_da, dsig2_db, dchi2_da, dchi2_db, dchi2_dM0 ;
+  double wgt_M0[2];   int nz_M0, iz_M0[2], kz ;
+
   int    cutmask, idsample, SIM_NONIA_INDEX, IS_SIM ; 
   int    ia, ib, ig, optmask_muerrsq ;
   int    dumpFlag_muerrsq=0, DUMPFLAG=0 ;
@@ -4209,6 +4720,11 @@ void *MNCHI2FUN(void *thread) {
   bool   set_fitwgt0;
   MUZMAP_DEF  *CCPRIOR_MUZMAP ;
 
+  // opt_profile timers; nthread=1 only to avoid clocking inside
+  // worker threads (Aug 2026)
+  int    DO_FITPROF = ( INPUTS.opt_profile && nthread == 1 );
+  double t_prof = 0.0 ;
+
   int  ILCPAR_MIN = INFO_BIASCOR.ILCPAR_MIN ;
   int  ILCPAR_MAX = INFO_BIASCOR.ILCPAR_MAX ;  
 
@@ -4274,12 +4790,23 @@ void *MNCHI2FUN(void *thread) {
   nsnfit      = nsnfit_truecc = 0 ;
   nsnfitIa    = nsnfitcc      = 0.0 ;
 
+  if ( DOGRAD )
+    { for(ipar=0; ipar < MAXPAR; ipar++) { gradsum[ipar] = 0.0; } }
+
   // - - - - - - - - - - - - - - - - -
   for ( n = isn_min; n < isn_max; n++ ) {
 
-    cutmask  = INFO_DATA.TABLEVAR.CUTMASK[n] ; 
+    cutmask  = INFO_DATA.TABLEVAR.CUTMASK[n] ;
     if ( cutmask ) { continue; }
 
+    // Aug 2026: bootstrap multiplicity; 0 -> event not in replica
+    wboot = 1 ;
+    if ( INPUTS.nbootstrap > 0 ) {
+      wboot = BOOTSTRAP.WGT[n] ;
+      if ( wboot == 0 ) { continue; }
+    }
+    xwboot = (double)wboot ;
+
     set_fitwgt0 = INFO_DATA.set_fitwgt0[n];
 
     // - - - - -
@@ -4290,32 +4817,32 @@ void *MNCHI2FUN(void *thread) {
     INFO_DATA.muerr[n]     = -999. ;    
     INFO_DATA.muerr_raw[n] = -999. ;  // no scale and no sigInt
     INFO_DATA.muerr_vpec[n] = -999. ;  // muerr from vpec only
+    // Aug 2026: hot columns come from the contiguous FCN_SOA pack
     name     = INFO_DATA.TABLEVAR.name[n] ;
-    idsample = (int)INFO_DATA.TABLEVAR.IDSAMPLE[n] ;
-    z        = (double)INFO_DATA.TABLEVAR.zhd[n] ;     
-    logmass  = (double)INFO_DATA.TABLEVAR.logmass[n];
+    idsample = (int)FCN_SOA.IDSAMPLE[n] ;
+    z        = (double)FCN_SOA.zhd[n] ;
+    logmass  = (double)FCN_SOA.logmass[n];
     //    zerr     = (double)INFO_DATA.TABLEVAR.zhderr[n] ;
-    zmuerr   = (double)INFO_DATA.TABLEVAR.zmuerr[n] ; // for muerr calc
-    mb       = (double)INFO_DATA.TABLEVAR.fitpar[INDEX_mB][n] ;
-    x1       = (double)INFO_DATA.TABLEVAR.fitpar[INDEX_x1][n] ;
-    c        = (double)INFO_DATA.TABLEVAR.fitpar[INDEX_c][n] ;
-    mumodel_store   = (double)INFO_DATA.TABLEVAR.mumodel[n] ; 
+    zmuerr   = (double)FCN_SOA.zmuerr[n] ; // for muerr calc
+    mb       = (double)FCN_SOA.mB[n] ;
+    x1       = (double)FCN_SOA.x1[n] ;
+    c        = (double)FCN_SOA.c[n] ;
+    mumodel_store   = (double)FCN_SOA.mumodel[n] ;
 
-    SIM_NONIA_INDEX = (int)INFO_DATA.TABLEVAR.SIM_NONIA_INDEX[n];
+    SIM_NONIA_INDEX = (int)FCN_SOA.SIM_NONIA_INDEX[n];
     IS_SIM          = (INFO_DATA.TABLEVAR.IS_SIM == true);
-    
-    if ( USE_CCPRIOR ) { 
-      PTOTRAW_Ia  = (double)INFO_DATA.TABLEVAR.pIa[n] ; 
+
+    if ( USE_CCPRIOR ) {
+      PTOTRAW_Ia  = (double)FCN_SOA.pIa[n] ;
     }
     muBias_zinterp = INFO_DATA.muBias_zinterp[n] ; 
     muerrsq_last   = INFO_DATA.muerrsq_last[n] ;
     muerr_last     = INFO_DATA.muerr_last[n] ;
 
+    double *cov8 = &FCN_SOA.covmat_tot[9*n] ;  // flattened (Aug 2026)
     for(ipar=0; ipar < NLCPAR; ipar++ ) {
-      for(ipar2=0; ipar2 < NLCPAR; ipar2++ ) 
-	{ covmat_tot[ipar][ipar2] = 
-	    INFO_DATA.TABLEVAR.covmat_tot[n][ipar][ipar2] ; 
-	}
+      for(ipar2=0; ipar2 < NLCPAR; ipar2++ )
+	{ covmat_tot[ipar][ipar2] = cov8[3*ipar+ipar2] ; }
     }
             
     for(ia=0; ia<MXa; ia++ ) {
@@ -4384,6 +4911,7 @@ void *MNCHI2FUN(void *thread) {
     muBias = muBiasErr = 0.0 ;  muCOVscale=1.0 ; 
 
     if ( NDIM_BIASCOR >= 5 ) {
+      if ( DO_FITPROF ) { t_prof = walltime_fitprof(); }
       get_muBias(name, &BIASCORLIST,      // (I) misc inputs
 		 FITPARBIAS_ALPHABETA,    // (I) bias at each a,b,g
 		 MUCOVSCALE_ALPHABETA,    // (I) muCOVscale at each a,b
@@ -4391,7 +4919,11 @@ void *MNCHI2FUN(void *thread) {
 		 fitParBias,     // (O) interp bias on mB,x1,c
 		 &muBias,        // (O) interp bias on mu
 		 &muBiasErr,     // (O) stat-error on above
-		 &muCOVscale );  // (O) scale bias on muCOV     
+		 &muCOVscale );  // (O) scale bias on muCOV
+      if ( DO_FITPROF ) {
+	FITPROF.T_BIASCOR += walltime_fitprof() - t_prof ;
+	FITPROF.NCALL_BIASCOR++ ;
+      }
     }
     else if ( NDIM_BIASCOR == 1 ) {
       muBias  = muBias_zinterp ; 
@@ -4438,23 +4970,60 @@ void *MNCHI2FUN(void *thread) {
     INFO_DATA.M0[n]       = M0 ;
 
     if ( !USE_CCPRIOR  ) {
-      // original SALT2mu chi2 with only spec-confirmed SNIa 
-      nsnfit++ ;      nsnfitIa  = (double)nsnfit ;
+      // original SALT2mu chi2 with only spec-confirmed SNIa
+      nsnfit += wboot ;      nsnfitIa  = (double)nsnfit ;
       chi2evt_Ia    = sqmures/muerrsq ;
-      chi2sum_Ia   += chi2evt_Ia ;
+      chi2sum_Ia   += xwboot * chi2evt_Ia ;
       chi2evt       = chi2evt_Ia ;
 
       // check option to add log(sigma) term for 5D biasCor
-      if ( INPUTS.fitflag_sigmb == 2 ) 
-      	{ chi2evt  += log(muerrsq/muerrsq_last); } 
+      if ( INPUTS.fitflag_sigmb == 2 )
+      	{ chi2evt  += log(muerrsq/muerrsq_last); }
 
       if ( iflag == 3 ) { INFO_DATA.probcc_beams[n] = 0.0 ; } // Dec 2020
-    } 
+
+      // Aug 2026: analytic dchi2/dpar for MINUIT (opt_gradient);
+      // prep_fcn_gradient has verified that muBias, muCOVscale and
+      // gammaDM do not depend on floated params, so only mures(a,b,M0)
+      // and muerrsq(a,b) contribute.
+      if ( DOGRAD ) {
+	dsig2_da = dsig2_db = 0.0 ;
+	if ( !set_fitwgt0 ) {
+	  VECG[0] = 1.0;  VECG[1] = alpha;  VECG[2] = -beta ;
+	  for(ipar=0; ipar < NLCPAR; ipar++ ) {
+	    dsig2_da +=
+	      VECG[ipar] * ( covmat_tot[ipar][1] + covmat_tot[1][ipar] );
+	    dsig2_db -=
+	      VECG[ipar] * ( covmat_tot[ipar][2] + covmat_tot[2][ipar] );
+	  }
+	  dsig2_da *= muCOVscale ;    dsig2_db *= muCOVscale ;
+	}
+
+	dchi2_da  = ( 2.0*mures*x1    - chi2evt_Ia*dsig2_da )/muerrsq ;
+	dchi2_db  = ( 2.0*mures*(-c)  - chi2evt_Ia*dsig2_db )/muerrsq ;
+	dchi2_dM0 = -2.0*mures/muerrsq ;
+
+	if ( INPUTS.fitflag_sigmb == 2 ) {
+	  dchi2_da += dsig2_da/muerrsq ;     // from log(muerrsq) term
+	  dchi2_db += dsig2_db/muerrsq ;
+	}
+
+	gradsum[IPAR_ALPHA0] += xwboot * dchi2_da ;
+	gradsum[IPAR_BETA0]  += xwboot * dchi2_db ;
+	gradsum[3]           += xwboot * z * dchi2_da ;  // dalpha/dz
+	gradsum[4]           += xwboot * z * dchi2_db ;  // dbeta/dz
+
+	nz_M0 = fcn_M0_izwgt(n, iz_M0, wgt_M0);
+	for(kz=0; kz < nz_M0; kz++ )
+	  { gradsum[MXCOSPAR+iz_M0[kz]] += xwboot*wgt_M0[kz]*dchi2_dM0 ; }
+      }
+
+    }
     
     if ( USE_CCPRIOR  ) {
       // BEAMS-like chi2 = -2ln [ PIa + PCC ]
       DUMPFLAG = 0 ; // (n == 45 && FITRESULT.NCALL_FCN < 3700);
-      nsnfit++ ;
+      nsnfit += wboot ;
 
       if ( INPUTS.ipar[IPAR_scalePCC] <= 1 ) {
 	scalePCC    = scalePROB_fitpar ;
@@ -4480,14 +5049,19 @@ void *MNCHI2FUN(void *thread) {
       dPdmu_Ia   = ( exp(-0.5*chi2evt_Ia) ) * (PIFAC/muerr_update) ; 
       Prob_Ia    = PTOT_Ia * dPdmu_Ia ;
 
+      if ( DO_FITPROF ) { t_prof = walltime_fitprof(); }
       if ( USE_CCPRIOR_H11 ) {
-	dPdmu_CC = prob_CCprior_H11(n, mures, &xval[IPAR_H11], 
+	dPdmu_CC = prob_CCprior_H11(n, mures, &xval[IPAR_H11],
 				    &sqsigCC, &sigCC_chi2penalty );
       }
       else { // CC prob from sim
-	dPdmu_CC = prob_CCprior_sim(idsample, CCPRIOR_MUZMAP, 
+	dPdmu_CC = prob_CCprior_sim(idsample, CCPRIOR_MUZMAP,
 				    z, mures, DUMPFLAG );
       }
+      if ( DO_FITPROF ) {
+	FITPROF.T_CCPRIOR += walltime_fitprof() - t_prof ;
+	FITPROF.NCALL_CCPRIOR++ ;
+      }
       Prob_CC   = PTOT_CC * dPdmu_CC ;
 
       Prob_SUM  = Prob_Ia + Prob_CC ; // BEAMS prob in Eq. 6 of BBC paper
@@ -4512,9 +5086,9 @@ void *MNCHI2FUN(void *thread) {
       if ( Prob_SUM > 0.0 ) {
 	ProbRatio_Ia = Prob_Ia / Prob_SUM ;
 	ProbRatio_CC = Prob_CC / Prob_SUM ;
-	nsnfitIa    +=  ProbRatio_Ia ; 
-	nsnfitcc    +=  ProbRatio_CC ; 
-	chi2sum_Ia  += (ProbRatio_Ia * chi2evt_Ia) ; 
+	nsnfitIa    +=  xwboot * ProbRatio_Ia ;
+	nsnfitcc    +=  xwboot * ProbRatio_CC ;
+	chi2sum_Ia  += xwboot * (ProbRatio_Ia * chi2evt_Ia) ;
 	
 	if ( iflag == 3 ) { INFO_DATA.probcc_beams[n] = ProbRatio_CC;}
 
@@ -4528,7 +5102,7 @@ void *MNCHI2FUN(void *thread) {
 
     } // end CCprios.USE if block
 
-    chi2sum_tot      += chi2evt;
+    chi2sum_tot      += xwboot * chi2evt;
     INFO_DATA.chi2[n] = chi2evt; // store each chi2 to allow for outlier cut
 
     // check things on final pass
@@ -4558,7 +5132,7 @@ void *MNCHI2FUN(void *thread) {
 				  optmask_dump );
       }
       
-      if ( IS_SIM && SIM_NONIA_INDEX > 0 ) { nsnfit_truecc++ ; } 
+      if ( IS_SIM && SIM_NONIA_INDEX > 0 ) { nsnfit_truecc += wboot ; } 
 
       // store reference errors for 1/sigma term
       if ( DOFIT_FLAG == FITFLAG_CHI2 ) {
@@ -4748,9 +5322,123 @@ double fcn_M0(int n, double *M0LIST) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
   }
 
-  return(M0);
+  return(M0);
+
+} // end fcn_M0
+
+// ================================
+int fcn_M0_izwgt(int n, int *izlist, double *wgtlist) {
+
+  // Created Aug 2026
+  // Return number of M0(z) bins that fcn_M0 uses for data index 'n',
+  // along with the bin indices and interpolation weights, so that
+  // the analytic gradient (opt_gradient) can load dchi2/dM0 into
+  // the right z-bin params. Must mirror the fcn_M0 logic above.
+
+  int iz0, iz1, NBINz ;
+  double zdata, zbin0, zbin1, zfrac, *ptr_zM0 ;
+  //  char fnam[] = "fcn_M0_izwgt" ;
+
+  // ----------- BEGIN ----------
+
+  iz0   = INFO_DATA.TABLEVAR.IZBIN[n];
+
+  if ( INPUTS.uM0 == M0FITFLAG_CONSTANT ||
+       INPUTS.uM0 == M0FITFLAG_ZBINS_FLAT ) {
+    izlist[0] = iz0 ;   wgtlist[0] = 1.0 ;
+    return(1);
+  }
+
+  // linear interp between z bins (M0FITFLAG_ZBINS_INTERP)
+  zdata   = INFO_DATA.TABLEVAR.zhd[n];
+  ptr_zM0 = INFO_BIASCOR.zM0 ;
+  NBINz   = INPUTS.BININFO_z.nbin ;
+  zbin0   = ptr_zM0[iz0];
+
+  if ( iz0 == 0 )              { iz1 = iz0 + 1 ; }
+  else if ( iz0 == NBINz-1 )   { iz1 = iz0 - 1 ; }
+  else if ( zdata > zbin0 )    { iz1 = iz0 + 1 ; }
+  else                         { iz1 = iz0 - 1 ; }
+
+  // fcn_M0 returns constant M0_DEFAULT if interp bin is not floated
+  if ( FITINP.ISFLOAT_z[iz1] == 0 ) { return(0); }
+
+  zbin1 = ptr_zM0[iz1];
+  zfrac = ( zdata - zbin0 ) / ( zbin1 - zbin0 ) ;
+
+  izlist[0] = iz0 ;   wgtlist[0] = 1.0 - zfrac ;
+  izlist[1] = iz1 ;   wgtlist[1] = zfrac ;
+  return(2);
+
+} // end fcn_M0_izwgt
+
+// ================================
+void prep_fcn_gradient(void) {
+
+  // Created Aug 2026
+  // Check whether the analytic dchi2/dpar computed in MNCHI2FUN is
+  // exact for the requested fit options; if so, set
+  // FITINP.DOFLAG_GRADIENT and tell MINUIT to use the FCN-supplied
+  // derivatives so that each gradient costs one fcn call instead of
+  // ~2 x NFITPAR_FLOAT numerical-difference calls.
+  //   opt_gradient=1 -> MINUIT first verifies derivatives against
+  //                     finite differences (recommended for A/B)
+  //   opt_gradient=2 -> trust derivatives without verification
+  //
+  // The gradient is exact only for the Gaussian SNIa-only chi2
+  // where muBias, muCOVscale and gammaDM do not depend on floated
+  // params; anything else falls back to numerical derivatives
+  // with an explicit warning.
+
+  int  icondn, len, ipar ;
+  const int null = 0 ;
+  char mcom[20], *disable = NULL ;
+  char fnam[] = "prep_fcn_gradient" ;
+
+  // ----------- BEGIN -----------
+
+  FITINP.DOFLAG_GRADIENT = 0 ;
+  if ( INPUTS.opt_gradient == 0 ) { return; }
+
+  if ( INFO_CCPRIOR.USE )
+    { disable = "CC prior (BEAMS likelihood)" ; }
+  else if ( INPUTS.opt_biasCor & (MASK_BIASCOR_5D | MASK_BIASCOR_1D5DCUT) )
+    { disable = "alpha/beta-dependent biasCor map" ; }
+  else if ( INPUTS.FLOAT_COSPAR )
+    { disable = "floated cosmology params" ; }
+  else {
+    // only alpha, beta, their dz slopes and M0(z) bins may float
+    for ( ipar = IPAR_GAMMA0; ipar < MXCOSPAR; ipar++ ) {
+      if ( INPUTS.ipar[ipar] )
+	{ disable = "floated param outside alpha,beta,M0" ; }
+    }
+  }
+
+  if ( disable != NULL ) {
+    fprintf(FP_STDOUT,"\n %s WARNING: opt_gradient=%d disabled by %s;\n"
+	    "\t fall back to numerical derivatives.\n",
+	    fnam, INPUTS.opt_gradient, disable );
+    fflush(FP_STDOUT);
+    return ;
+  }
 
-} // end fcn_M0
+  FITINP.DOFLAG_GRADIENT = 1 ;
+
+  if ( INPUTS.opt_gradient >= 2 )
+    { strcpy(mcom,"SET GRA 1"); }  // trust without checking
+  else
+    { strcpy(mcom,"SET GRA");   }  // MINUIT verifies each derivative
+
+  fprintf(FP_STDOUT,"\n %s: enable analytic dchi2/dpar with '%s'\n",
+	  fnam, mcom );
+  fflush(FP_STDOUT);
+
+  len = strlen(mcom);
+  mncomd_(fcn, mcom, &icondn, &null, len);   fflush(FP_STDOUT);
+
+  return ;
+
+} // end prep_fcn_gradient
 
 // ==================================================
 void get_INTERPWGT_abg(double alpha, double beta, double gammadm, int DUMPFLAG,
@@ -5306,7 +5994,10 @@ void set_defaults(void) {
   INPUTS.write_yaml = 0 ;
   INPUTS.write_csv  = 0 ;
 
-  INPUTS.minos      = 1 ;
+  INPUTS.minos       = 1 ;
+  INPUTS.ncore_minos = 1 ;
+  INPUTS.opt_gradient = 0 ;
+  INPUTS.opt_profile = 0 ;
   INPUTS.nfile_data = 0 ;
   INPUTS.nfile_data_override = 0 ;
   sprintf(INPUTS.PREFIX,     "NONE" );
@@ -5340,6 +6031,14 @@ void set_defaults(void) {
   INPUTS.NSPLITRAN      = 1; // default is all SN in one job
   INPUTS.JOBID_SPLITRAN = -9;
 
+  INPUTS.nbootstrap     = 0;     // Aug 2026: no resampling by default
+  INPUTS.seed_bootstrap = 12345;
+
+  INPUTS.nfile_syst = 0;         // Aug 2026: no systematic variants
+  SYSTVAR.NJOB = 0;  SYSTVAR.NCOL = 0;  SYSTVAR.M0DIF_STORE = NULL ;
+  BOOTSTRAP.NJOB = 0;  BOOTSTRAP.WGT = NULL ;
+  FCN_SOA.VALID = false;  FCN_SOA.NSN = 0 ;  // Aug 2026
+
   INPUTS.iflag_duplicate = IFLAG_DUPLICATE_ABORT ;
 
 
@@ -5395,6 +6094,7 @@ void set_defaults(void) {
   INPUTS.ncidFile_data   = 0;
   INPUTS.ncidList_data   = 0;
   INPUTS.acceptFlag_cidFile_data = 0 ;
+  CIDHASH_DATA.SIZE      = 0 ;  // Aug 2026: cid-hash built on demand
 
   INPUTS.nmax_tot = 999888777 ;
   for(isurvey=0; isurvey<MXIDSURVEY; isurvey++ ) 
@@ -13782,9 +14482,34 @@ void setup_DMUPDF_CCprior(int IDSAMPLE, TABLEVAR_DEF *TABLEVAR,
   gDM  = MUZMAP->gammadm;
   M0   = MUZMAP->M0 ;
 
-  if ( NDIM_BIASCOR >= 5 ) 
+  if ( NDIM_BIASCOR >= 5 )
     { get_INTERPWGT_abg(a,b,gDM, 0, &INTERPWGT,fnam ); } // returns INTERPWGT
-   
+
+  // Aug 2026: refresh per-event mumodel cache only if cosPar changed;
+  // cache applies to the standard TABLEVAR_CUTS sample only.
+  int  i, NSN_ALL   = TABLEVAR->NSN_ALL ;
+  bool USE_CACHE    = ( TABLEVAR == &INFO_CCPRIOR.TABLEVAR_CUTS );
+  bool REFRESH      = !INFO_CCPRIOR.valid_MUMODEL_CUTS ;
+  for(i=0; i < NCOSPAR; i++ ) {
+    if ( INFO_CCPRIOR.cosPar_cache[i] != MUZMAP->cosPar[i] )
+      { REFRESH = true ; }
+  }
+
+  if ( USE_CACHE && REFRESH ) {
+    if ( INFO_CCPRIOR.MUMODEL_CUTS == NULL ) {
+      INFO_CCPRIOR.MUMODEL_CUTS =
+	(double*) malloc( NSN_ALL * sizeof(double) );
+    }
+    for(icc=0; icc < NSN_ALL; icc++ ) {
+      z  = TABLEVAR->zhd[icc] ;
+      dl = cosmodl_forFit(z, z, MUZMAP->cosPar) ;
+      INFO_CCPRIOR.MUMODEL_CUTS[icc] = 5.0*log10(dl) + 25.0 ;
+    }
+    for(i=0; i < NCOSPAR; i++ )
+      { INFO_CCPRIOR.cosPar_cache[i] = MUZMAP->cosPar[i] ; }
+    INFO_CCPRIOR.valid_MUMODEL_CUTS = true ;
+  }
+
   for(icc=0; icc < TABLEVAR->NSN_ALL ; icc++ ) {  
 
     // require correct IDSAMPLE to continue
@@ -13835,9 +14560,13 @@ void setup_DMUPDF_CCprior(int IDSAMPLE, TABLEVAR_DEF *TABLEVAR,
     } // end biasCor if-block
     
 
-    // compute mucos for each SIM CC event
-    dl       = cosmodl_forFit(z, z, MUZMAP->cosPar) ;
-    mumodel  = 5.0*log10(dl) + 25.0 ;
+    // compute mucos for each SIM CC event (cached mumodel, Aug 2026)
+    if ( USE_CACHE )
+      { mumodel = INFO_CCPRIOR.MUMODEL_CUTS[icc] ; }
+    else {
+      dl      = cosmodl_forFit(z, z, MUZMAP->cosPar) ;
+      mumodel = 5.0*log10(dl) + 25.0 ;
+    }
     mumodel += muBias ;     // add bias
     dmu      = mu - mumodel ;
     imu      = IBINFUN(dmu, &MUZMAP->DMUBIN, 0, "" );
@@ -14396,16 +15125,36 @@ int IBINFUN(double VAL, BININFO_DEF *BIN, int OPT, char *MSG_ABORT ) {
   // If OPT == 1  abort if VAL is outside range
   // If OPT == 2  if VAL is outside, return edge bin (do not abort)
   // If OPT == 7  dump
-  
+  //
+  // Aug 2026: for uniform grids, seek bin arithmetically in O(1)
+  //   instead of scanning; verify the guess against lo/hi so that
+  //   non-uniform grids (e.g., user z bins) fall back to the scan.
+  //   Removes the dominant startup cost of matching each biasCor
+  //   event to its 5D cell with per-dimension linear searches.
+
   int ibin, IBIN, nbin;
   int LDMP = ( OPT == 7 ) ;
-  double lo, hi;  
+  double lo, hi;
   char fnam[] = "IBINFUN" ;
   // --------- BEGIN -----------
 
   IBIN = -9; ibin=0;
   nbin = BIN->nbin ;
-  
+
+  if ( BIN->binSize > 0.0 && VAL >= BIN->lo[0] && !LDMP ) {
+    ibin = (int)( (VAL - BIN->lo[0]) / BIN->binSize ) ;
+    if ( ibin >= 0 && ibin < nbin ) {
+      lo = BIN->lo[ibin] ;
+      hi = BIN->hi[ibin] ;  if ( ibin==nbin-1 ) { hi += 1.0E-10; }
+      // require VAL above previous bin so boundary values return the
+      // same (lower) bin as the scan below
+      if ( VAL >= lo && VAL <= hi &&
+	   ( ibin == 0 || VAL > BIN->hi[ibin-1] ) )
+	{ return(ibin); }
+    }
+    ibin = 0 ;  // guess failed (non-uniform bins); do full scan
+  }
+
   if ( LDMP ) {
     printf(" 1. xxx %s DUMP: nbin=%d  VAL(%s)=%f \n",
 	   fnam, nbin, BIN->varName, VAL);
@@ -14811,6 +15560,39 @@ void setbit_CUTMASK(int isn, int bitnum, TABLEVAR_DEF *TABLEVAR ) {
 } // end setbit_CUTMASK 
 
 
+// ===========================================
+unsigned int hash_CID(char *cid) {
+
+  // Created Aug 2026
+  // djb2 string hash for CID lookup maps; see CIDHASH_DATA
+  // and check_duplicate_SNID.
+  // Now a thin wrapper over shared hash_string in sntools.c.
+
+  return hash_string(cid);
+
+} // end hash_CID
+
+
+// ===========================================
+void build_cidHash_data(void) {
+
+  // Created Aug 2026
+  // Build hash set over INPUTS.cidList_data so that each
+  // selectCID_data call is O(1) instead of a linear list scan.
+  // Called after each parse_cidFile_data (rebuilds if more CID
+  // files are read); uses shared HASH_STRING utils in sntools.c.
+
+  //  char fnam[] = "build_cidHash_data" ;
+
+  // ------- BEGIN -------------
+
+  build_HASH_STRING(&CIDHASH_DATA,
+		    INPUTS.ncidList_data, INPUTS.cidList_data);
+  return ;
+
+} // end build_cidHash_data
+
+
 // ===========================================
 int selectCID_data(char *cid){
 
@@ -14821,23 +15603,23 @@ int selectCID_data(char *cid){
 
   int ncidList   = INPUTS.ncidList_data ;
   int acceptFlag = INPUTS.acceptFlag_cidFile_data ;
-  int ACCEPT = 1, REJECT = 0, i ;
+  int ACCEPT = 1, REJECT = 0 ;
   bool MATCH ;
-  char *tmpCID;
   //  char fnam[] = "selectCID_data";
 
   // ------- BEGIN -------------
 
   if ( ncidList == 0 ) { return ACCEPT ; }
 
-  for (i = 0; i < ncidList; i++) {
-    tmpCID = INPUTS.cidList_data[i];
-    MATCH = (strcmp(cid,tmpCID)==0) ;
-    if ( MATCH ) {
-      if ( acceptFlag > 0 )  { return ACCEPT; }
-      else     	             { return REJECT; }
-    }
-  } // end i loop over cids
+  // Aug 2026: O(1) hash lookup replaces linear scan over cidList
+  if ( CIDHASH_DATA.SIZE == 0 ) { build_cidHash_data(); }
+
+  MATCH = ( index_HASH_STRING(&CIDHASH_DATA, cid) >= 0 ) ;
+
+  if ( MATCH ) {
+    if ( acceptFlag > 0 )  { return ACCEPT; }
+    else     	           { return REJECT; }
+  }
 
   // - - - - - - 
   // if there are no cid matches to file:
@@ -15206,9 +15988,18 @@ int ppar(char* item) {
   if ( uniqueOverlap(item,"errmask_write=") ) // allow legacy name
     { sscanf(&item[14],"%i", &INPUTS.cutmask_write ); return(1); }
 
-  if ( uniqueOverlap(item,"minos=") ) 
+  if ( uniqueOverlap(item,"minos=") )
     { sscanf(&item[6],"%i", &INPUTS.minos ); return(1); }
 
+  if ( uniqueOverlap(item,"ncore_minos=") )
+    { sscanf(&item[12],"%i", &INPUTS.ncore_minos ); return(1); }
+
+  if ( uniqueOverlap(item,"opt_gradient=") )
+    { sscanf(&item[13],"%i", &INPUTS.opt_gradient ); return(1); }
+
+  if ( uniqueOverlap(item,"opt_profile=") )
+    { sscanf(&item[12],"%i", &INPUTS.opt_profile ); return(1); }
+
 
   // - - - - - -
   // allow two different keys for data file name
@@ -15226,12 +16017,23 @@ int ppar(char* item) {
     parse_commaSepList("DATAFILE_OVERRIDE", &item[18], 
 		       MXFILE_BIASCOR, MXCHAR_FILENAME, 
 		       &INPUTS.nfile_data_override, &INPUTS.dataFile_override);
-    if ( IGNOREFILE(INPUTS.dataFile_override[0]) ) 
+    if ( IGNOREFILE(INPUTS.dataFile_override[0]) )
       { INPUTS.nfile_data_override = 0; }
 
     return(1);
   }
 
+  // Aug 2026: each file is a separate systematic variant to fit
+  if ( uniqueOverlap(item,"datafile_override_syst=") ) {
+    parse_commaSepList("DATAFILE_OVERRIDE_SYST", &item[23],
+		       MXFILE_AUTOSTORE, MXCHAR_FILENAME,
+		       &INPUTS.nfile_syst, &INPUTS.dataFile_syst);
+    if ( IGNOREFILE(INPUTS.dataFile_syst[0]) )
+      { INPUTS.nfile_syst = 0; }
+
+    return(1);
+  }
+
   // - - - - - - - 
   // allow two different keys to define biasCor file name
   char keyList_biasCor[2][20] = { "simfile_bias=", "simfile_biascor=" } ;
@@ -15600,11 +16402,16 @@ int ppar(char* item) {
   if ( uniqueOverlap(item,"NDUMPLOG=")) 
     { sscanf(&item[9],"%d", &INPUTS.NDUMPLOG ); return(1); }
 
-  if ( uniqueOverlap(item,"NSPLITRAN=")) 
+  if ( uniqueOverlap(item,"NSPLITRAN="))
     { sscanf(&item[10],"%d", &INPUTS.NSPLITRAN); return(1); }
-  if ( uniqueOverlap(item,"JOBID_SPLITRAN=")) 
+  if ( uniqueOverlap(item,"JOBID_SPLITRAN="))
     { sscanf(&item[15],"%d", &INPUTS.JOBID_SPLITRAN); return(1); }
 
+  if ( uniqueOverlap(item,"nbootstrap="))  // Aug 2026
+    { sscanf(&item[11],"%d", &INPUTS.nbootstrap); return(1); }
+  if ( uniqueOverlap(item,"seed_bootstrap="))
+    { sscanf(&item[15],"%d", &INPUTS.seed_bootstrap); return(1); }
+
   if ( uniqueOverlap(item,"iflag_duplicate=")) 
     { sscanf(&item[16],"%d", &INPUTS.iflag_duplicate ); return(1); }
 
@@ -15800,11 +16607,14 @@ void parse_cidFile_data(int OPT, char *fileName) {
 	   fnam, NCID_EXPECT, fileName);
   }
   else {
-    printf("  %s: Reject %d  CIDs in %s\n", 
+    printf("  %s: Reject %d  CIDs in %s\n",
 	   fnam, NCID_EXPECT, fileName);
   }
   fflush(stdout);
 
+  // Aug 2026: intern CIDs into hash set for selectCID_data
+  build_cidHash_data();
+
   return ;
 
 } // END of parse_cidFile_data()
@@ -16425,66 +17235,132 @@ int reject_CUTWIN(int EVENT_TYPE, int *DOFLAG_CUTWIN, double *CUTVAL_LIST) {
   //
   // CUTVAL_LIST is array of values to apply CUTWIN
   //
-  // Jan 22 2021: 
+  // Jan 22 2021:
   //   rename apply_CUTWIN -> reject_CUTWIN, and return reject flag
   //   with similar meaning as DOFLAG_CUTWIN.
-  
-  int IS_DATA    = ( EVENT_TYPE == EVENT_TYPE_DATA );
-  int IS_BIASCOR = ( EVENT_TYPE == EVENT_TYPE_BIASCOR );
-  int IS_CCPRIOR = ( EVENT_TYPE == EVENT_TYPE_CCPRIOR );
+  //
+  // Aug 2026: evaluate compiled cut list (see compile_CUTWIN) so the
+  //   per-event loop is plain window compares with early exit.
 
-  int LDMP = 0 ; // (OPT==666);
-  int icut, reject, DOFLAG ;
-  double CUTVAL, *CUTWIN ;
-  char *NAME;
+  int icut, j, reject, DOFLAG ;
+  double CUTVAL ;
+  size_t MEMCMP = INPUTS.NCUTWIN * sizeof(int);
   char fnam[] = "reject_CUTWIN" ;
 
-  
   // ------------- BEGIN -----------
 
-  if ( LDMP ) { printf(" xxx --------------------------- \n"); }
+  // (re)compile cut list if DOFLAG instructions changed
+  if ( !CUTWIN_COMPILED[EVENT_TYPE].COMPILED ||
+       memcmp(CUTWIN_COMPILED[EVENT_TYPE].DOFLAG_ORIG,
+	      DOFLAG_CUTWIN, MEMCMP) != 0 )
+    { compile_CUTWIN(EVENT_TYPE, DOFLAG_CUTWIN); }
 
   reject = 0 ;    // init to pass cuts
 
+  for(j=0; j < CUTWIN_COMPILED[EVENT_TYPE].NCUT; j++ ) {
+
+    icut   = CUTWIN_COMPILED[EVENT_TYPE].ICUT_ORIG[j] ;
+    CUTVAL = CUTVAL_LIST[icut];
+
+    if ( CUTVAL < CUTWIN_COMPILED[EVENT_TYPE].LO[j] ||
+	 CUTVAL > CUTWIN_COMPILED[EVENT_TYPE].HI[j] ) {
+      CUTWIN_COMPILED[EVENT_TYPE].NFAIL[j]++ ;
+      DOFLAG = CUTWIN_COMPILED[EVENT_TYPE].DOFLAG[j] ;
+      // once reject is set to DOFLAG_CUTWIN_APPLY it cannot change
+      // (e.g., to DOFLAG_CUTWIN_FITWGT0), so exit the loop there.
+      if ( DOFLAG == DOFLAG_CUTWIN_APPLY )
+	{ reject = DOFLAG ;  break ; }
+      if ( reject == 0 )  { reject = DOFLAG ; }
+    }
+  }
+
+  // periodically re-order cuts by measured rejection power so the
+  // early exit above fires as soon as possible.
+  CUTWIN_COMPILED[EVENT_TYPE].NEVT++ ;
+  if ( CUTWIN_COMPILED[EVENT_TYPE].NEVT >= NEVT_REORDER_CUTWIN ) {
+    int    NCUT = CUTWIN_COMPILED[EVENT_TYPE].NCUT, k ;
+    int    itmp;  double dtmp;
+    CUTWIN_COMPILED[EVENT_TYPE].NEVT = 0 ;
+    for(j=1; j < NCUT; j++ ) {      // insertion sort, descending NFAIL
+      for(k=j; k > 0; k-- ) {
+	if ( CUTWIN_COMPILED[EVENT_TYPE].NFAIL[k] <=
+	     CUTWIN_COMPILED[EVENT_TYPE].NFAIL[k-1] ) { break ; }
+	itmp = CUTWIN_COMPILED[EVENT_TYPE].NFAIL[k];
+	CUTWIN_COMPILED[EVENT_TYPE].NFAIL[k] =
+	  CUTWIN_COMPILED[EVENT_TYPE].NFAIL[k-1];
+	CUTWIN_COMPILED[EVENT_TYPE].NFAIL[k-1] = itmp;
+	itmp = CUTWIN_COMPILED[EVENT_TYPE].ICUT_ORIG[k];
+	CUTWIN_COMPILED[EVENT_TYPE].ICUT_ORIG[k] =
+	  CUTWIN_COMPILED[EVENT_TYPE].ICUT_ORIG[k-1];
+	CUTWIN_COMPILED[EVENT_TYPE].ICUT_ORIG[k-1] = itmp;
+	itmp = CUTWIN_COMPILED[EVENT_TYPE].DOFLAG[k];
+	CUTWIN_COMPILED[EVENT_TYPE].DOFLAG[k] =
+	  CUTWIN_COMPILED[EVENT_TYPE].DOFLAG[k-1];
+	CUTWIN_COMPILED[EVENT_TYPE].DOFLAG[k-1] = itmp;
+	dtmp = CUTWIN_COMPILED[EVENT_TYPE].LO[k];
+	CUTWIN_COMPILED[EVENT_TYPE].LO[k] =
+	  CUTWIN_COMPILED[EVENT_TYPE].LO[k-1];
+	CUTWIN_COMPILED[EVENT_TYPE].LO[k-1] = dtmp;
+	dtmp = CUTWIN_COMPILED[EVENT_TYPE].HI[k];
+	CUTWIN_COMPILED[EVENT_TYPE].HI[k] =
+	  CUTWIN_COMPILED[EVENT_TYPE].HI[k-1];
+	CUTWIN_COMPILED[EVENT_TYPE].HI[k-1] = dtmp;
+      }
+    }
+  }
+
+  return(reject);
+
+} // end reject_CUTWIN
+
+
+// **************************************************
+void compile_CUTWIN(int EVENT_TYPE, int *DOFLAG_CUTWIN) {
+
+  // Created Aug 2026
+  // Resolve CUTWIN instructions for this EVENT_TYPE into a compact
+  // list of window compares for reject_CUTWIN: drop ignored cuts,
+  // resolve the usesim_CUTWIN string check once (biasCor/CCprior),
+  // and store cut ranges contiguously. Called on the first event
+  // and again if the DOFLAG instructions change (e.g. SPLITRAN).
+
+  int IS_DATA = ( EVENT_TYPE == EVENT_TYPE_DATA );
+  int icut, DOFLAG, NCUT=0 ;
+  char *NAME ;
+  char fnam[] = "compile_CUTWIN" ;
+
+  // ------------- BEGIN -----------
+
   for(icut=0; icut < INPUTS.NCUTWIN; icut++ ) {
-   
+
     DOFLAG = DOFLAG_CUTWIN[icut] ;
     if ( DOFLAG == DOFLAG_CUTWIN_IGNORE ) { continue; }
 
-    // if not data (i.e.,  biasCor & CCprior), DOFLAG must be
+    // if not data (i.e., biasCor & CCprior), DOFLAG must be
     // "APPLY". The FITWGT0 feature works only for data.
     if ( !IS_DATA ) { DOFLAG = DOFLAG_CUTWIN_APPLY; }
 
-    CUTVAL = CUTVAL_LIST[icut];
-    CUTWIN = &INPUTS.CUTWIN_RANGE[icut][0];
-    NAME   = INPUTS.CUTWIN_NAME[icut] ;
-
-    if ( LDMP ) {
-      printf(" xxx cut on %s = %f  (cutwin=%.3f to %.3f, EVENT_TYPE=%d)\n",
-	     NAME, CUTVAL, CUTWIN[0], CUTWIN[1], EVENT_TYPE ); 
-    }
-
     // check SIM-option to skip SIM_TYPE_INDEX
-    if( (IS_BIASCOR || IS_CCPRIOR) && !usesim_CUTWIN(NAME)  ) 
-      { continue ; }
+    NAME = INPUTS.CUTWIN_NAME[icut] ;
+    if ( !IS_DATA && !usesim_CUTWIN(NAME) ) { continue ; }
 
-    if ( CUTVAL < CUTWIN[0] || CUTVAL > CUTWIN[1] ) { 
-      // be careful here; once reject is set to DOFLAG_CUTWIN_APPLY,
-      // the reject flag cannot be changed (e.g, to DOFLAG_CUTWIN_FITWGT0)
-      if ( reject != DOFLAG_CUTWIN_APPLY )  {  reject = DOFLAG ; }
-    }
+    CUTWIN_COMPILED[EVENT_TYPE].ICUT_ORIG[NCUT] = icut ;
+    CUTWIN_COMPILED[EVENT_TYPE].DOFLAG[NCUT]    = DOFLAG ;
+    CUTWIN_COMPILED[EVENT_TYPE].LO[NCUT] = INPUTS.CUTWIN_RANGE[icut][0];
+    CUTWIN_COMPILED[EVENT_TYPE].HI[NCUT] = INPUTS.CUTWIN_RANGE[icut][1];
+    CUTWIN_COMPILED[EVENT_TYPE].NFAIL[NCUT] = 0 ;
+    NCUT++ ;
   }
 
-  // - - - - 
-  if (LDMP ) { 
-    printf(" xxx ---> reject = %d\n", reject ); 
-    fflush(stdout); debugexit(fnam);
-  } 
-
-  return(reject);
+  CUTWIN_COMPILED[EVENT_TYPE].NCUT     = NCUT ;
+  CUTWIN_COMPILED[EVENT_TYPE].NEVT     = 0 ;
+  CUTWIN_COMPILED[EVENT_TYPE].COMPILED = true ;
+  memcpy(CUTWIN_COMPILED[EVENT_TYPE].DOFLAG_ORIG, DOFLAG_CUTWIN,
+	 INPUTS.NCUTWIN * sizeof(int) );
 
+  return ;
 
-} // end reject_CUTWIN
+} // end compile_CUTWIN
 
 // **************************************************
 int set_DOFLAG_CUTWIN(int ivar, int icut, int isData) {
@@ -16696,6 +17572,332 @@ int SPLITRAN_ACCEPT(int isn, int snid) {
 } // end of SPLITRAN_ACCEPT
 
 
+// **************************************************
+void BOOTSTRAP_prep(void) {
+
+  // Created Aug 2026
+  // Draw per-event multiplicities for bootstrap replica
+  // BOOTSTRAP.NJOB by sampling, with replacement, among events that
+  // pass cuts. fcn() multiplies each event's chi2 contribution by
+  // its multiplicity (0 -> dropped), so every replica re-uses the
+  // data and biasCor loaded once at init. The seed is a function of
+  // (seed_bootstrap, NJOB) so each replica is reproducible on its own.
+
+  int NSN_DATA = INFO_DATA.TABLEVAR.NSN_ALL ;
+  int n, i, NUSE, idraw ;
+  int *USE_LIST ;
+  char fnam[] = "BOOTSTRAP_prep" ;
+
+  // ------------------ BEGIN ---------------
+
+  if ( BOOTSTRAP.WGT == NULL )
+    { BOOTSTRAP.WGT = (int*) malloc( NSN_DATA * sizeof(int) ); }
+
+  USE_LIST = (int*) malloc( NSN_DATA * sizeof(int) );
+
+  NUSE = 0 ;
+  for ( n=0; n < NSN_DATA; n++ ) {
+    BOOTSTRAP.WGT[n] = 0 ;
+    if ( INFO_DATA.TABLEVAR.CUTMASK[n] == 0 )
+      { USE_LIST[NUSE] = n;  NUSE++ ; }
+  }
+
+  if ( NUSE == 0 ) {
+    sprintf(c1err,"No events pass cuts for bootstrap replica %d",
+	    BOOTSTRAP.NJOB );
+    sprintf(c2err,"Check cuts and nbootstrap=%d", INPUTS.nbootstrap);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  srandom( (unsigned)(INPUTS.seed_bootstrap + 7919*BOOTSTRAP.NJOB) );
+  for ( i=0; i < NUSE; i++ ) {
+    idraw = (int)( random() % NUSE ) ;
+    BOOTSTRAP.WGT[ USE_LIST[idraw] ]++ ;
+  }
+
+  free(USE_LIST);
+
+  fprintf(FP_STDOUT,
+	  "\n BOOTSTRAP replica %d of %d : "
+	  "resample %d events with replacement.\n",
+	  BOOTSTRAP.NJOB, INPUTS.nbootstrap, NUSE );
+  fflush(FP_STDOUT);
+
+  return ;
+
+} // end of BOOTSTRAP_prep
+
+
+// **************************************************
+void SYSTVAR_prep(void) {
+
+  // Created Aug 2026
+  // Prepare in-process systematics engine (datafile_override_syst=):
+  // snapshot the nominal data columns that an override can touch,
+  // load each variant file into its own autoStore slot, and build a
+  // CID-hash so each variant is applied without re-reading the data.
+  // Fit 0 is nominal; fit k restores the nominal columns and applies
+  // override file k by itself (see SYSTVAR_apply).
+
+  int  NSN_DATA = INFO_DATA.TABLEVAR.NSN_ALL ;
+  int  nfile    = INPUTS.nfile_syst ;
+  int  nzbin    = INPUTS.nzbin ;
+  int  OPTMASK  = 4 ; // append each file in autoStore
+  int  MEMF     = NSN_DATA * sizeof(float);
+  int  NCOL, icol, ifile, ifit, isn, h, NROW ;
+  char *ptrFile, *snid ;
+  char VARLIST_OVER[] = "VPEC,VPEC_ERR,HOST_LOGMASS,zHEL" ;
+  char fnam[] = "SYSTVAR_prep" ;
+
+  // ------------------ BEGIN ---------------
+
+  print_banner(fnam);
+
+  if ( INPUTS.NSPLITRAN > 1 || INPUTS.nbootstrap > 0 ) {
+    sprintf(c1err,"datafile_override_syst does not work with");
+    sprintf(c2err,"NSPLITRAN=%d or nbootstrap=%d",
+	    INPUTS.NSPLITRAN, INPUTS.nbootstrap );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  // snapshot nominal value of each column that an override can change
+  NCOL = 0 ;
+  SYSTVAR.PTRCOL[NCOL] = INFO_DATA.TABLEVAR.vpec    ; NCOL++ ;
+  SYSTVAR.PTRCOL[NCOL] = INFO_DATA.TABLEVAR.vpecerr ; NCOL++ ;
+  SYSTVAR.PTRCOL[NCOL] = INFO_DATA.TABLEVAR.logmass ; NCOL++ ;
+  SYSTVAR.PTRCOL[NCOL] = INFO_DATA.TABLEVAR.zhd     ; NCOL++ ;
+  SYSTVAR.PTRCOL[NCOL] = INFO_DATA.TABLEVAR.zhderr  ; NCOL++ ;
+  SYSTVAR.PTRCOL[NCOL] = INFO_DATA.TABLEVAR.mumodel ; NCOL++ ;
+  SYSTVAR.NCOL = NCOL ;
+
+  for(icol=0; icol < NCOL; icol++ ) {
+    SYSTVAR.VAL_NOMINAL[icol] = (float*) malloc(MEMF);
+    memcpy(SYSTVAR.VAL_NOMINAL[icol], SYSTVAR.PTRCOL[icol], MEMF);
+  }
+
+  // build CID-hash --> data isn (same hash as check_duplicate_SNID)
+  SYSTVAR.HASH_SIZE = 64 ;
+  while ( SYSTVAR.HASH_SIZE < 2*NSN_DATA ) { SYSTVAR.HASH_SIZE *= 2; }
+  SYSTVAR.HASH_ISN = (int*) malloc( SYSTVAR.HASH_SIZE * sizeof(int) );
+  for(h=0; h < SYSTVAR.HASH_SIZE; h++ ) { SYSTVAR.HASH_ISN[h] = -9 ; }
+
+  for(isn=0; isn < NSN_DATA; isn++ ) {
+    snid = INFO_DATA.TABLEVAR.name[isn];
+    h    = (int)(hash_CID(snid) & (unsigned int)(SYSTVAR.HASH_SIZE-1));
+    while ( SYSTVAR.HASH_ISN[h] >= 0 ) {
+      h++ ;  if ( h == SYSTVAR.HASH_SIZE ) { h = 0; }
+    }
+    SYSTVAR.HASH_ISN[h] = isn ;
+  }
+
+  // load each variant file into its own autoStore slot
+  for(ifile=0; ifile < nfile; ifile++ ) {
+    ptrFile = INPUTS.dataFile_syst[ifile];
+    ENVreplace(ptrFile,fnam,1);
+    NROW = SNTABLE_AUTOSTORE_INIT(ptrFile,"OVERRIDE",
+				  VARLIST_OVER, OPTMASK);
+    SYSTVAR.IFILE_AUTOSTORE[ifile] = NFILE_AUTOSTORE - 1 ;
+    printf("\t stored %d rows from %s \n", NROW, ptrFile);
+    fflush(stdout);
+  }
+
+  // store M0DIF for nominal fit and each variant fit
+  SYSTVAR.M0DIF_STORE = (double**) malloc( (nfile+1)*sizeof(double*) );
+  for(ifit=0; ifit <= nfile; ifit++ )
+    { SYSTVAR.M0DIF_STORE[ifit] = (double*) malloc(nzbin*sizeof(double)); }
+
+  printf("\t fit nominal sample + %d systematic variants.\n", nfile);
+  fflush(stdout);
+
+  return ;
+
+} // end of SYSTVAR_prep
+
+
+// **************************************************
+void SYSTVAR_apply(void) {
+
+  // Created Aug 2026
+  // Restore nominal data columns, then apply systematic override file
+  // SYSTVAR.NJOB by itself. Same column rules as read_data_override:
+  // VPEC [VPEC_ERR] updates zHD [zHDERR], zHEL shifts zHD, and any
+  // zHD change updates mumodel. zHD cannot be overridden directly.
+
+  int  NSN_DATA = INFO_DATA.TABLEVAR.NSN_ALL ;
+  int  NJOB     = SYSTVAR.NJOB ;
+  int  IFILE    = SYSTVAR.IFILE_AUTOSTORE[NJOB-1];
+  int  NROW     = SNTABLE_AUTOSTORE[IFILE].NROW ;
+  int  NVAR     = SNTABLE_AUTOSTORE[IFILE].NVAR ;
+  int  IVAR_VPEC=-9, IVAR_VPECERR=-9, IVAR_LOGMASS=-9, IVAR_zHEL=-9 ;
+  int  icol, ivar, irow, isn, h, NCHANGE=0 ;
+  bool override_zhd ;
+  double dval, zhd_orig, zhel_orig, zhd_over, zhel_over, dl ;
+  char *varName, *snid ;
+  char fnam[] = "SYSTVAR_apply" ;
+
+  // ------------------ BEGIN ---------------
+
+  // restore nominal columns from snapshot
+  for(icol=0; icol < SYSTVAR.NCOL; icol++ ) {
+    memcpy(SYSTVAR.PTRCOL[icol], SYSTVAR.VAL_NOMINAL[icol],
+	   NSN_DATA * sizeof(float) );
+  }
+
+  // locate override columns in this variant file
+  for(ivar=0; ivar < NVAR; ivar++ ) {
+    if ( !SNTABLE_AUTOSTORE[IFILE].EXIST[ivar] ) { continue ; }
+    varName = SNTABLE_AUTOSTORE[IFILE].VARNAME[ivar];
+    if ( strcmp(varName,"VPEC")         == 0 ) { IVAR_VPEC    = ivar; }
+    if ( strcmp(varName,"VPEC_ERR")     == 0 ) { IVAR_VPECERR = ivar; }
+    if ( strcmp(varName,"HOST_LOGMASS") == 0 ) { IVAR_LOGMASS = ivar; }
+    if ( strcmp(varName,"zHEL")         == 0 ) { IVAR_zHEL    = ivar; }
+  }
+
+  if ( IVAR_VPEC >= 0 && IVAR_zHEL >= 0 ) {
+    sprintf(c1err,"Cannot override both VPEC and zHEL; pick one");
+    sprintf(c2err,"Check %s", INPUTS.dataFile_syst[NJOB-1] );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  for(irow=0; irow < NROW; irow++ ) {
+
+    // find data index from CID-hash built in SYSTVAR_prep
+    snid = SNTABLE_AUTOSTORE[IFILE].CCID[irow];
+    h    = (int)(hash_CID(snid) & (unsigned int)(SYSTVAR.HASH_SIZE-1));
+    isn  = -9 ;
+    while ( SYSTVAR.HASH_ISN[h] >= 0 ) {
+      if ( strcmp(INFO_DATA.TABLEVAR.name[SYSTVAR.HASH_ISN[h]],snid)==0 )
+	{ isn = SYSTVAR.HASH_ISN[h];  break ; }
+      h++ ;  if ( h == SYSTVAR.HASH_SIZE ) { h = 0; }
+    }
+    if ( isn < 0 ) { continue ; } // override CID not in data sample
+
+    zhd_orig     = (double)INFO_DATA.TABLEVAR.zhd[isn];
+    zhel_orig    = (double)INFO_DATA.TABLEVAR.zhel[isn];
+    zhd_over     = zhd_orig ;
+    override_zhd = false ;
+
+    if ( IVAR_VPEC >= 0 ) {
+      dval     = SNTABLE_AUTOSTORE[IFILE].DVAL[IVAR_VPEC][irow];
+      zhd_over = zhd_data_override(isn,dval);
+      INFO_DATA.TABLEVAR.vpec[isn] = (float)dval ;
+      INFO_DATA.TABLEVAR.zhd[isn]  = (float)zhd_over ;
+      override_zhd = true ;
+    }
+
+    if ( IVAR_VPECERR >= 0 ) {
+      dval = SNTABLE_AUTOSTORE[IFILE].DVAL[IVAR_VPECERR][irow];
+      INFO_DATA.TABLEVAR.zhderr[isn]  =
+	(float)zhderr_data_override(isn,dval);
+      INFO_DATA.TABLEVAR.vpecerr[isn] = (float)dval ;
+    }
+
+    if ( IVAR_LOGMASS >= 0 ) {
+      dval = SNTABLE_AUTOSTORE[IFILE].DVAL[IVAR_LOGMASS][irow];
+      INFO_DATA.TABLEVAR.logmass[isn] = (float)dval ;
+    }
+
+    if ( IVAR_zHEL >= 0 ) {
+      dval     = SNTABLE_AUTOSTORE[IFILE].DVAL[IVAR_zHEL][irow];
+      zhd_over = zhd_orig + (dval - zhel_orig);
+      INFO_DATA.TABLEVAR.zhd[isn] = (float)zhd_over ;
+      override_zhd = true ;
+    }
+
+    // if zhd is modified, update mumodel (as in read_data_override)
+    if ( override_zhd ) {
+      zhel_over = zhel_orig + (zhd_over - zhd_orig);
+      dl = cosmodl_forFit(zhel_over, zhd_over, INPUTS.COSPAR);
+      INFO_DATA.TABLEVAR.mumodel[isn] = (float)(5.0*log10(dl) + 25.0);
+    }
+
+    NCHANGE++ ;
+
+  } // end irow loop
+
+  fprintf(FP_STDOUT,
+	  "\n SYSTVAR fit %d of %d : override %d of %d events from %s\n",
+	  NJOB, INPUTS.nfile_syst, NCHANGE, NSN_DATA,
+	  INPUTS.dataFile_syst[NJOB-1] );
+  fflush(FP_STDOUT);
+
+  FCN_SOA.VALID = false ;  // columns changed; re-pack SoA block
+
+  return ;
+
+} // end of SYSTVAR_apply
+
+
+// **************************************************
+void SYSTVAR_store_M0DIF(void) {
+
+  // Created Aug 2026:
+  // store fitted M0DIF vs. z-bin for current systematics fit.
+
+  int iz, NJOB = SYSTVAR.NJOB ;
+  for(iz=0; iz < INPUTS.nzbin; iz++ )
+    { SYSTVAR.M0DIF_STORE[NJOB][iz] = FITRESULT.M0DIF[iz]; }
+
+  return ;
+
+} // end of SYSTVAR_store_M0DIF
+
+
+// **************************************************
+void SYSTVAR_write_mucov(void) {
+
+  // Created Aug 2026
+  // Sum M0DIF shifts w.r.t. the nominal fit into a z-bin covariance,
+  //   COV(i,j) = sum_k [M0DIF_k(i)-M0DIF_0(i)] * [M0DIF_k(j)-M0DIF_0(j)]
+  // and write the off-diagonal elements in the COV: format read by
+  // wfit:read_mucovar(). The CID for z-bin iz is the ROW number (iz+1)
+  // in the [prefix].M0DIF file, so wfit can run on the nominal M0DIF
+  // output with this covariance file.
+
+  int  nfile = INPUTS.nfile_syst ;
+  int  nzbin = INPUTS.nzbin ;
+  int  iz0, iz1, ifit ;
+  double cov, d0, d1 ;
+  FILE *fp ;
+  char outFile[MXCHAR_FILENAME];
+  char fnam[] = "SYSTVAR_write_mucov" ;
+
+  // ------------------ BEGIN ---------------
+
+  sprintf(outFile,"%s.MUCOV", INPUTS.PREFIX );
+  fp = fopen(outFile,"wt");
+
+  if ( !fp )  {
+    sprintf(c1err,"Could not open MUCOV-outFile");
+    sprintf(c2err,"%s", outFile);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  fprintf(FP_STDOUT, "\n Write M0DIF syst covariance to %s \n", outFile);
+  fflush(FP_STDOUT);
+
+  fprintf(fp,"# M0DIF covariance from %d systematic variants.\n", nfile);
+  fprintf(fp,"# CID = ROW number in [prefix].M0DIF file.\n\n");
+
+  for(iz0=0; iz0 < nzbin; iz0++ ) {
+    for(iz1=iz0+1; iz1 < nzbin; iz1++ ) {
+      cov = 0.0 ;
+      for(ifit=1; ifit <= nfile; ifit++ ) {
+	d0 = SYSTVAR.M0DIF_STORE[ifit][iz0] - SYSTVAR.M0DIF_STORE[0][iz0];
+	d1 = SYSTVAR.M0DIF_STORE[ifit][iz1] - SYSTVAR.M0DIF_STORE[0][iz1];
+	cov += d0 * d1 ;
+      }
+      fprintf(fp,"COV: %d %d  %12.5le \n", iz0+1, iz1+1, cov );
+    }
+  }
+
+  fclose(fp);
+
+  return ;
+
+} // end of SYSTVAR_write_mucov
+
+
 /* xxxxxxxxxx mark delete Dec 2020 xxxxxxxxxxxx
 
 // **************************************************
@@ -17845,11 +19047,84 @@ void recalc_dataCov(void) {
 
   } // end of n-loop over data
 
+  FCN_SOA.VALID = false ;  // Aug 2026: covmat changed; re-pack SoA block
+
   return ;
 
 }  // end recalc_dataCov
 
 
+// *******************************************************
+void prep_fcn_SOA(void) {
+
+  // Created Aug 2026
+  // Pack the data columns read per event in the chi2 loop
+  // (MNCHI2FUN) into the contiguous FCN_SOA arrays, and flatten
+  // covmat_tot[isn][3][3] into one malloc block. Called lazily
+  // from fcn() whenever FCN_SOA.VALID is false; invalidated after
+  // recalc_dataCov, SYSTVAR_apply and prep_input_repeat so that
+  // column updates between fits are picked up.
+
+  int  NSN = INFO_DATA.TABLEVAR.NSN_ALL ;
+  TABLEVAR_DEF *TABLEVAR = &INFO_DATA.TABLEVAR ;
+  int  MEMF = NSN * sizeof(float);
+  int  MEMS = NSN * sizeof(short int);
+  int  n, ipar, ipar2 ;
+  double *cov8 ;
+  char fnam[] = "prep_fcn_SOA" ;
+
+  // ----------- BEGIN ----------------
+
+  if ( FCN_SOA.NSN == 0 ) {
+    FCN_SOA.zhd        = (float     *) malloc(MEMF);
+    FCN_SOA.logmass    = (float     *) malloc(MEMF);
+    FCN_SOA.zmuerr     = (float     *) malloc(MEMF);
+    FCN_SOA.mumodel    = (float     *) malloc(MEMF);
+    FCN_SOA.pIa        = (float     *) malloc(MEMF);
+    FCN_SOA.mB         = (float     *) malloc(MEMF);
+    FCN_SOA.x1         = (float     *) malloc(MEMF);
+    FCN_SOA.c          = (float     *) malloc(MEMF);
+    FCN_SOA.IDSAMPLE        = (short int *) malloc(MEMS);
+    FCN_SOA.SIM_NONIA_INDEX = (short int *) malloc(MEMS);
+    FCN_SOA.covmat_tot = (double *) malloc( NSN * 9 * sizeof(double) );
+    FCN_SOA.NSN        = NSN ;
+  }
+
+  if ( NSN != FCN_SOA.NSN ) {
+    sprintf(c1err,"NSN_ALL=%d changed since malloc for NSN=%d",
+	    NSN, FCN_SOA.NSN );
+    sprintf(c2err,"Something is really messed up.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  memcpy(FCN_SOA.zhd,     TABLEVAR->zhd,     MEMF);
+  memcpy(FCN_SOA.logmass, TABLEVAR->logmass, MEMF);
+  memcpy(FCN_SOA.zmuerr,  TABLEVAR->zmuerr,  MEMF);
+  memcpy(FCN_SOA.mumodel, TABLEVAR->mumodel, MEMF);
+  memcpy(FCN_SOA.pIa,     TABLEVAR->pIa,     MEMF);
+  memcpy(FCN_SOA.mB,      TABLEVAR->fitpar[INDEX_mB], MEMF);
+  memcpy(FCN_SOA.x1,      TABLEVAR->fitpar[INDEX_x1], MEMF);
+  memcpy(FCN_SOA.c,       TABLEVAR->fitpar[INDEX_c],  MEMF);
+  memcpy(FCN_SOA.IDSAMPLE,        TABLEVAR->IDSAMPLE,        MEMS);
+  memcpy(FCN_SOA.SIM_NONIA_INDEX, TABLEVAR->SIM_NONIA_INDEX, MEMS);
+
+  for(n=0; n < NSN; n++ ) {
+    cov8 = &FCN_SOA.covmat_tot[9*n] ;
+    for(ipar=0; ipar < NLCPAR; ipar++ ) {
+      for(ipar2=0; ipar2 < NLCPAR; ipar2++ ) {
+	cov8[3*ipar+ipar2] =
+	  (double)TABLEVAR->covmat_tot[n][ipar][ipar2] ;
+      }
+    }
+  }
+
+  FCN_SOA.VALID = true ;
+
+  return ;
+
+} // end prep_fcn_SOA
+
+
 // *******************************************************
 double next_covFitPar(double redchi2, double parval_orig, double parval_step) {
 
@@ -17984,7 +19259,8 @@ void outFile_driver(void) {
   char *prefix   = INPUTS.PREFIX ;
 
   char tmpFile1[200], tmpFile2[200], tmpFile3[200], tmpFile[200];
-  char fnam[] = "outFile_driver" ; 
+  char prefix_local[200];
+  char fnam[] = "outFile_driver" ;
 
   // --------------- BEGIN -------------
 
@@ -18005,9 +19281,22 @@ void outFile_driver(void) {
 #endif
  
 
+  // Aug 2026: each bootstrap replica gets its own file prefix
+  if ( INPUTS.nbootstrap > 0 ) {
+    sprintf(prefix_local, "%s-BOOT%3.3d", prefix, BOOTSTRAP.NJOB );
+    prefix = prefix_local ;
+  }
+
+  // Aug 2026: each systematics variant gets its own file prefix;
+  // nominal fit (NJOB=0) keeps the plain prefix.
+  if ( INPUTS.nfile_syst > 0 && SYSTVAR.NJOB > 0 ) {
+    sprintf(prefix_local, "%s-SYST%3.3d", prefix, SYSTVAR.NJOB );
+    prefix = prefix_local ;
+  }
+
   if ( strlen(prefix) > 0 && !IGNOREFILE(prefix)  ) {
 
-    sprintf(tmpFile1,"%s.fitres", prefix ); 
+    sprintf(tmpFile1,"%s.fitres", prefix );
     sprintf(tmpFile2,"%s.M0DIF",  prefix ); 
     sprintf(tmpFile3,"%s.COV",    prefix );  // Dec 2 2020
 
@@ -18468,6 +19757,7 @@ void write_fitres_driver(char* fileName) {
     fprintf(fout,"# NCALL_FCN: %d \n", FITRESULT.NCALL_FCN );
     fprintf(fout,"# CPU: %.2f minutes\n",
 	    (t_end_fit-t_start_fit)/60.0  );
+    if ( INPUTS.opt_profile ) { write_fitprof(fout); }  // Aug 2026
     if ( INPUTS.blindFlag > 0 && ISDATA_REAL ) 
       { write_blindFlag_message(fout); }      
     fprintf(fout,"# MU-RESIDUAL NOTE: MURES = MU-(MUMODEL+M0DIF) \n");
@@ -19610,6 +20900,24 @@ double cosmodl_forFit(double zhel, double zcmb, double *cosPar) {
 
   // -------------- BEGIN -------------
 
+  // Aug 2026: when cosPar matches the fixed input cosmology, read dl
+  // from the z-binned lookup built in prep_cosmodl_lookup instead of
+  // integrating; covers the load-time mumodel pass and every
+  // fixed-cosmology evaluation (CC prior, biasCor, contamination).
+  if ( COSMODL_LOOKUP.USE && zhel == zcmb &&
+       cosPar[0] == INPUTS.COSPAR[0] && cosPar[1] == INPUTS.COSPAR[1] &&
+       cosPar[2] == INPUTS.COSPAR[2] && cosPar[3] == INPUTS.COSPAR[3] ) {
+    double t = ( zcmb - COSMODL_LOOKUP.ZMIN )/COSMODL_LOOKUP.ZBIN - 0.5 ;
+    int    iz = (int)t ;
+    if ( t >= 0.0 && iz < COSMODL_LOOKUP.NBZ-1 ) {
+      double frac = t - (double)iz ;
+      dl = COSMODL_LOOKUP.dl[iz] +
+	frac * ( COSMODL_LOOKUP.dl[iz+1] - COSMODL_LOOKUP.dl[iz] ) ;
+      return(dl);
+    }
+    // outside table range -> fall through to direct calculation
+  }
+
   OL = cosPar[0];
 
   if ( OL > OL_extrap[0] ) {
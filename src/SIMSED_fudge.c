@@ -208,9 +208,9 @@
 #include "sntools_genSmear.h"
 #include "MWgaldust.h"
 
+#include "genmag_SEDtools.h"   // must come before genmag_SIMSED.h
 #include "genmag_SIMSED.h"
-#include "genmag_SEDtools.h"
-#include "genmag_SALT2.h" 
+#include "genmag_SALT2.h"
 
 // =========== DECLARE FUNCTIONS ==================
 void  parse_args(int argc, char **argv);
@@ -2427,9 +2427,28 @@ void sedFudge_color(int ised) {
   }
 
   // loop over color bins
-  NcBIN = INPUTS.NBIN_COLORPAR; 
-  NsBIN = INPUTS.NBIN_SHAPEPAR; 
+  NcBIN = INPUTS.NBIN_COLORPAR;
+  NsBIN = INPUTS.NBIN_SHAPEPAR;
+
+  // Aug 2026: the color/shape/poly fudges and B transmission depend
+  // only on lambda (per color/shape bin), but were re-evaluated for
+  // every day; hoist them into per-lambda tables so the day loop
+  // reduces to table multiplies.
+  int NLAM = TEMP_SEDMODEL.NLAM ;
+  int MEMD = NLAM * sizeof(double);
+  double *CFUDGE_LAM    = (double*) malloc(MEMD);
+  double *SFUDGE_LAM    = (double*) malloc(MEMD);
+  double *POLYFUDGE_LAM = (double*) malloc(MEMD);
+  double *BTRANS_LAM    = (double*) malloc(MEMD);
 
+  for ( ilam = 0; ilam < NLAM; ilam++ ) {
+    lam = TEMP_SEDMODEL.LAM[ilam];
+    POLYFUDGE_LAM[ilam] = FLUXFUDGE_LAMPOLY(lam);
+    if ( lam > 3500. && lam < 6000. )
+      { BTRANS_LAM[ilam] = filterTrans_BessB(lam); }
+    else
+      { BTRANS_LAM[ilam] = 0.0 ; }
+  }
 
   for ( isbin = 1; isbin <= NsBIN; isbin++ ) {
 
@@ -2442,9 +2461,26 @@ void sedFudge_color(int ised) {
       fflush(stdout);
     }
 
+    // load per-lambda shape fudge for this shape bin (Aug 2026)
+    for ( ilam = 0; ilam < NLAM; ilam++ ) {
+      lam = TEMP_SEDMODEL.LAM[ilam];
+      if ( DOSALT2 || INPUTS.NBIN_SHAPEPAR > 1 )
+	{ SFUDGE_LAM[ilam] = shapeFudge(lam,sval); }
+      else if ( IPAR_S2x1 > 0 ) {
+	x1 = SEDMODEL.PARVAL[ised][IPAR_S2x1];
+	SFUDGE_LAM[ilam] = shapeFudge(lam,x1);
+      }
+      else
+	{ SFUDGE_LAM[ilam] = 1.0 ; }
+    }
+
     for ( icbin = 1; icbin <= NcBIN; icbin++ ) {
 
       cval  = INPUTS.COLORPAR_VALUE[icbin] ;
+
+      // load per-lambda color fudge for this color bin (Aug 2026)
+      for ( ilam = 0; ilam < NLAM; ilam++ )
+	{ CFUDGE_LAM[ilam] = colorFudge(TEMP_SEDMODEL.LAM[ilam],cval); }
       
       // create name of new SED file 
 
@@ -2475,33 +2511,25 @@ void sedFudge_color(int ised) {
 	  flux     = TEMP_SEDSMOOTH.FLUX[iday][ilam] ;
 	  fluxerr  = TEMP_SEDSMOOTH.FLUXERR[iday][ilam] ;
 
-	  // get color fudge
-	  cfudge  = colorFudge(lam,cval); 
-
-	  // get lambda-polynominal fduge
-	  polyfudge = FLUXFUDGE_LAMPOLY(lam);
+	  // color, shape & lambda-poly fudges from per-lambda tables
+	  cfudge    = CFUDGE_LAM[ilam] ;
+	  sfudge    = SFUDGE_LAM[ilam] ;
+	  polyfudge = POLYFUDGE_LAM[ilam] ;
 
-	  // get shape fudge
+	  // get shape flux-correction
 	  if ( DOSALT2 ) {
 	    Flux_M0   = flux ;
 	    Flux_M1   = SALT2_TABLE.SEDFLUX[1][iday][ilam] ;
 	    x1        = sval ;
 	    flux_new  = Flux_M0 + (x1 * Flux_M1) ;
-	    sfudge    = shapeFudge(lam,x1); // correct flux for Phillips
 	    shapecor  = flux_new/flux ;
 	    polyfudge = 1.0 ;
 	  }
 	  else if ( INPUTS.NBIN_SHAPEPAR > 1 ) {
-	    sfudge   = shapeFudge(lam,sval); 
 	    shapecor = stretchFlux(stretch,iday,ilam)/flux ;
 	  }
-	  else if ( IPAR_S2x1 > 0 ) {
-	    x1       = SEDMODEL.PARVAL[ised][IPAR_S2x1];
-	    sfudge   = shapeFudge(lam,x1); 
-	    shapecor = 1.0 ;
-	  }
-	  else 
-	    { sfudge = shapecor = 1.0 ; }
+	  else
+	    { shapecor = 1.0 ; }
 
 	  // multiply all fudges into grand fudge
 	  fudge   = polyfudge * cfudge * sfudge * shapecor ;
@@ -2536,7 +2564,7 @@ void sedFudge_color(int ised) {
 	  if ( INPUTS.IPAR_PEAKMB > 0 &&  lam > 3500. && lam < 6000. ) {
 
 	    //	    Btrans      = Btransfun(lam); // xxx removed Aug 25 2013
-	    Btrans      = filterTrans_BessB(lam);
+	    Btrans      = BTRANS_LAM[ilam] ;
 
 	    if ( iday == IDAY_PEAK ) {
 	      FBsum0     += Btrans * flux ;  // energy-flux sum => no lambda
@@ -2580,6 +2608,9 @@ void sedFudge_color(int ised) {
     } // NBIN loop over color values
   } // NBIN loop over shape values
 
+  free(CFUDGE_LAM);  free(SFUDGE_LAM);
+  free(POLYFUDGE_LAM);  free(BTRANS_LAM);
+
   fprintf(fp_sedinfo,"\n" );
 
   fflush(stdout);
@@ -30,6 +30,11 @@
       by LAM rebinning must be uniform.
     + must use single quotes around arguments with ()
 
+  Aug 2026:
+    copy-free rebin: select DAY/LAM bins to keep, then write output
+    directly from the input SED arrays (no second SED copy in memory),
+    with a large stdio buffer on the output stream.
+
  ***********/
 
 
@@ -44,8 +49,8 @@
 //#include "sntools_cosmology.h"
 #include "MWgaldust.h"
 
-#include "genmag_SIMSED.h"
 #include "genmag_SEDtools.h"
+#include "genmag_SIMSED.h"
 
 
 // ========= GLOBAL DECLARATIONS ============
@@ -78,7 +83,13 @@ FILE  *FP_SEDINFO_INP;
 FILE  *FP_SEDINFO_OUT;
 
 SEDMODEL_FLUX_DEF  TEMP_SEDMODEL_INP ;
-SEDMODEL_FLUX_DEF  TEMP_SEDMODEL_OUT ;
+
+// Aug 2026: keep/discard flags per input bin; output SED is written
+// directly from TEMP_SEDMODEL_INP using these flags (no output copy).
+struct {
+  int NDAY_OUT, NLAM_OUT ;
+  int *KEEP_DAY, *KEEP_LAM ;
+} REBIN_INFO ;
 
 void  parse_args(int argc, char **argv);
 void  parse_REBIN_DAY(char *string, int rebin);
@@ -108,14 +119,13 @@ int main(int argc, char **argv) {
   // create output directory and open new SED.INFO file
   make_OUTDIR_SIMSED();
 
-  // allocate TEMP array to read SED 
+  // allocate TEMP array to read SED
   malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL_INP,
 			  MXBIN_DAY_REBIN, MXBIN_LAM_REBIN, MXBIN_SED_REBIN);
 
-  // malloc rebinned array
-  malloc_SEDFLUX_SEDMODEL(&TEMP_SEDMODEL_OUT,
-			  MXBIN_DAY_REBIN, MXBIN_LAM_REBIN, MXBIN_SED_REBIN);
-
+  // allocate keep/discard flags per input bin (Aug 2026)
+  REBIN_INFO.KEEP_DAY = (int*) malloc ( MXBIN_DAY_REBIN * sizeof(int) );
+  REBIN_INFO.KEEP_LAM = (int*) malloc ( MXBIN_LAM_REBIN * sizeof(int) );
 
   SIMSED_DRIVER();
 
@@ -377,25 +387,22 @@ void  SIMSED_DRIVER(void) {
 // **********************************************
 void  rebin_SED(void) {
 
-  // Do the rebinning here and modify global TEMP_SEDMODEL
-  //
+  // Select DAY and LAM bins to keep, and load REBIN_INFO flags;
+  // write_rebinned_SED streams the kept bins directly from
+  // TEMP_SEDMODEL_INP, so no output copy is made here (Aug 2026).
 
   int NDAY_INP = TEMP_SEDMODEL_INP.NDAY;
   int NLAM_INP = TEMP_SEDMODEL_INP.NLAM;
 
-  int *KEEP_DAY, *KEEP_LAM ;
+  int *KEEP_DAY = REBIN_INFO.KEEP_DAY ;
+  int *KEEP_LAM = REBIN_INFO.KEEP_LAM ;
   int NDAY_OUT, NLAM_OUT;
-  int iday, ilam, iday_out, ilam_out, jflux, nskip, irebin, REBIN;
-  double DAY, LAM, FLUX, DAYMIN, DAYMAX ;
-  char fnam[] = "rebin_SED" ;
+  int iday, ilam, nskip, irebin, REBIN;
+  double DAY, LAM, DAYMIN, DAYMAX ;
+  //  char fnam[] = "rebin_SED" ;
 
   // ---------------- BEGIN -------------
 
-  // allocate flag per DAY and LAM bin indicatig KEEP or DISCARD
-
-  KEEP_DAY = (int*) malloc ( NDAY_INP * sizeof(int) );
-  KEEP_LAM = (int*) malloc ( NLAM_INP * sizeof(int) );
-
   NDAY_OUT = NLAM_OUT = 0 ;
 
   // select DAY bins to keep
@@ -422,7 +429,7 @@ void  rebin_SED(void) {
       KEEP_DAY[iday] = 1;  NDAY_OUT++ ;
 
   }
-  TEMP_SEDMODEL_OUT.NDAY = NDAY_OUT ;
+  REBIN_INFO.NDAY_OUT = NDAY_OUT ;
 
 
   // select lam bins to keep
@@ -439,38 +446,7 @@ void  rebin_SED(void) {
 
     KEEP_LAM[ilam] = 1;  NLAM_OUT++ ;
   }
-  TEMP_SEDMODEL_OUT.NLAM = NLAM_OUT ;
-
-  // ------------------------------------------
-  // transfer SEDMODEL_INP to SEDMODEL_OUT
-
-  iday_out = ilam_out = 0 ;
-  for(iday=0; iday < NDAY_INP; iday++ ) {
-
-    ilam_out = 0 ;
-    if ( KEEP_DAY[iday] == 0 ) { continue ; }
-
-    for (ilam=0; ilam < NLAM_INP; ilam++ ) {
-      if ( KEEP_LAM[ilam] == 0 ) { continue ; }
-
-      jflux = NLAM_INP*iday + ilam;
-      DAY   = TEMP_SEDMODEL_INP.DAY[iday] ;
-      LAM   = TEMP_SEDMODEL_INP.LAM[ilam] ;
-      FLUX  = TEMP_SEDMODEL_INP.FLUX[jflux];
-      
-      jflux = NLAM_OUT*iday_out + ilam_out ;
-      TEMP_SEDMODEL_OUT.DAY[iday_out] = DAY ;
-      TEMP_SEDMODEL_OUT.LAM[ilam_out] = LAM ;
-      TEMP_SEDMODEL_OUT.FLUX[jflux]   = FLUX ;
-      
-      ilam_out++ ;
-    } // end ilam
-    iday_out++ ;
-
-  } // end iday
-
-  
-  free(KEEP_DAY); free(KEEP_LAM);
+  REBIN_INFO.NLAM_OUT = NLAM_OUT ;
 
   return;
 
@@ -479,15 +455,18 @@ void  rebin_SED(void) {
 // **********************************************
 void  write_rebinned_SED(char *sed_fileName) {
 
-  // write TEMP_SEDMODEL_OUT array to sed_fileName in output directory.
+  // Write kept bins of TEMP_SEDMODEL_INP to sed_fileName in output
+  // directory, streaming directly from the input arrays using the
+  // REBIN_INFO keep-flags (Aug 2026; no rebinned copy in memory).
+
+  int NDAY_INP = TEMP_SEDMODEL_INP.NDAY;
+  int NLAM_INP = TEMP_SEDMODEL_INP.NLAM;
 
-  int NDAY = TEMP_SEDMODEL_OUT.NDAY;
-  int NLAM = TEMP_SEDMODEL_OUT.NLAM;
-  
   int  iday, ilam, jflux;
   char SED_FILENAME[MXPATHLEN];
   double DAY, LAM, FLUX;
   FILE *fp;
+  static char WRITE_BUFFER[1<<20]; // 1 MB stdio buffer for output
 
   char fnam[] = "write_rebinned_SED" ;
   // ---------- BEGIN --------
@@ -495,20 +474,24 @@ void  write_rebinned_SED(char *sed_fileName) {
 
   // construct full SED file name, including output path
   sprintf(SED_FILENAME, "%s/%s", INPUTS.OUTDIR_SIMSED, sed_fileName);
-  
+
   fp = fopen(SED_FILENAME,"wt");
   if ( !fp ) {
     sprintf(c1err,"Could not open output SED file:");
     sprintf(c2err,"%s", SED_FILENAME);
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
   }
+  setvbuf(fp, WRITE_BUFFER, _IOFBF, sizeof(WRITE_BUFFER) );
+
+  for(iday=0; iday < NDAY_INP; iday++ ) {
+    if ( REBIN_INFO.KEEP_DAY[iday] == 0 ) { continue ; }
+    DAY = TEMP_SEDMODEL_INP.DAY[iday];
 
-  for(iday=0; iday < NDAY; iday++ ) {
-    for (ilam=0; ilam < NLAM; ilam++ ) {
-      jflux = NLAM*iday + ilam;
-      DAY   = TEMP_SEDMODEL_OUT.DAY[iday];
-      LAM   = TEMP_SEDMODEL_OUT.LAM[ilam];
-      FLUX  = TEMP_SEDMODEL_OUT.FLUX[jflux];
+    for (ilam=0; ilam < NLAM_INP; ilam++ ) {
+      if ( REBIN_INFO.KEEP_LAM[ilam] == 0 ) { continue ; }
+      jflux = NLAM_INP*iday + ilam;
+      LAM   = TEMP_SEDMODEL_INP.LAM[ilam];
+      FLUX  = TEMP_SEDMODEL_INP.FLUX[jflux];
       fprintf(fp,"%7.3f  %8.3f  %10.4E \n", DAY, LAM, FLUX );
     }
   }
@@ -36,6 +36,13 @@
               Removes chance that some random arrays are the same.
 
  Jun 1 2014  MXRAN_MJDARRAY -> 2000 (was 1000)
+
+ Aug 2026: add optional cache of per-entry results (OPTMASK bit 4);
+           identical cadence entries (keyed by content hash of the
+           MJD & M5SIG lists) re-use the stored FoM instead of
+           regenerating NRAN random arrays. Candidate-cadence
+           evaluations repeat most LIBIDs unchanged between
+           iterations, so this removes nearly all of the cost.
 ************************/
 
 #define MAXRAN_MJDARRAY 2000   // max length of internal MJD arrays
@@ -47,6 +54,10 @@
 
 #define MJDGAP_IGNORE_DEFAULT 100. // ignore MJD gaps longer than this
 
+// Aug 2026: OPTMASK bit and hash-table size for per-entry FoM cache
+#define OPTMASK_cadence_CACHE  4       // re-use FoM for identical entries
+#define NSLOT_CACHE_SNCADENCEFOM 65536 // must be power of 2
+
 // define parameter indices if user passes parameters
 #define IPAR_cadence_NRAN_MJDARRAY  0 // number of random MJD arrays
 #define IPAR_cadence_M5SIG_AVG      1 // <M5SIG> (5-sigma limiting mag)
@@ -68,6 +79,14 @@
 //char MSGERR1[80];
 //char MSGERR2[80];
 
+// Aug 2026: open-address cache of FoM vs. entry-content hash;
+// malloc'd on first cached call (~1 MB).
+struct {
+  int NCALL, NSTORE, NREUSE ;
+  unsigned long long *HASH_LIST ;  // 0 => empty slot
+  double             *FOM_LIST ;
+} CACHE_SNCADENCEFOM = { 0, 0, 0, NULL, NULL } ;
+
 double cadence_randMJD (double MJDMIN, double MJDMAX);
 
 double cadence_eqMJD (int k, int N, double MJDMIN, double MJDMAX);
@@ -93,6 +112,11 @@ double SNcadenceFoM (int OPTMASK,
 
 double GaussRan_FOM(void) ; // does NOT use RANLIST
 
+unsigned long long hash_SNcadenceFoM(int Nobs, double *MJDLIST,
+				     double *M5SIGLIST, double *parList,
+				     int OPT_PARAM );   // Aug 2026
+void dump_cache_SNcadenceFoM(void);                    // Aug 2026
+
 
 
 // **************************************************
@@ -133,6 +157,61 @@ double GaussRan_FOM(void) {
   return G ;
 }  // end of Gaussran
 
+
+// ============================================
+unsigned long long hash_SNcadenceFoM(int Nobs, double *MJDLIST,
+				     double *M5SIGLIST, double *parList,
+				     int OPT_PARAM ) {
+
+  // Created Aug 2026
+  // Return 64-bit FNV-1a hash over the content of a cadence entry:
+  // Nobs, MJD list, M5SIG list, and (if used) the parameter list.
+  // Entries with identical content give identical FoM statistics,
+  // so the hash is used to re-use previously computed results.
+
+  unsigned long long H = 1469598103934665603ULL ;
+  unsigned char *ptr ;
+  int ib, NPAR=0 ;
+  //  char fnam[] = "hash_SNcadenceFoM" ;
+
+  // ------------ BEGIN ------------
+
+  ptr = (unsigned char*)&Nobs ;
+  for(ib=0; ib < sizeof(int); ib++ )
+    { H ^= (unsigned long long)ptr[ib];  H *= 1099511628211ULL; }
+
+  ptr = (unsigned char*)MJDLIST ;
+  for(ib=0; ib < Nobs*sizeof(double); ib++ )
+    { H ^= (unsigned long long)ptr[ib];  H *= 1099511628211ULL; }
+
+  ptr = (unsigned char*)M5SIGLIST ;
+  for(ib=0; ib < Nobs*sizeof(double); ib++ )
+    { H ^= (unsigned long long)ptr[ib];  H *= 1099511628211ULL; }
+
+  if ( OPT_PARAM ) { NPAR = NPAR_SNCADENCEFOM ; }
+  ptr = (unsigned char*)parList ;
+  for(ib=0; ib < NPAR*sizeof(double); ib++ )
+    { H ^= (unsigned long long)ptr[ib];  H *= 1099511628211ULL; }
+
+  if ( H == 0 ) { H = 1; }   // 0 is reserved for empty slot
+
+  return H ;
+
+} // end hash_SNcadenceFoM
+
+
+// ============================================
+void dump_cache_SNcadenceFoM(void) {
+
+  // Created Aug 2026: print cache summary (e.g., at end of job).
+  printf("   SNcadenceFoM cache: %d calls, %d re-used, %d stored \n",
+	 CACHE_SNCADENCEFOM.NCALL, CACHE_SNCADENCEFOM.NREUSE,
+	 CACHE_SNCADENCEFOM.NSTORE );
+  fflush(stdout);
+  return ;
+
+} // end dump_cache_SNcadenceFoM
+
 // ============================================
 double cadence_randMJD (double MJDMIN, double MJDMAX) {
   // function returns random MJD: MJDMIN<=MJD<=MJDMAX
@@ -444,8 +523,8 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
  ***/
 
 
-  int 
-    OPT_PARAM, OPT_DUMP 
+  int
+    OPT_PARAM, OPT_DUMP, OPT_CACHE
     ,i,j,k,it
     ,belowBins    // Number of FoMs of random arrays below the given FoM
     ,ind[MAXRAN_MJDARRAY]    // array for indexes of sorted elements
@@ -480,6 +559,9 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
 
   double result;    // save fraction of FoM bins above the current FoM
 
+  unsigned long long HASH=0 ;   // Aug 2026: content hash for cache
+  int ISLOT = -9 ;              // cache slot to fill; -9 => do not store
+
   char BANNER[100];
   char fnam[] = "SNcadenceFoM" ;
 
@@ -488,6 +570,7 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
   // check OPTMASK bits
   OPT_PARAM = (OPTMASK & 1) ;
   OPT_DUMP  = (OPTMASK & 2) ;
+  OPT_CACHE = (OPTMASK & OPTMASK_cadence_CACHE) ;  // Aug 2026
 
 
   // define a few quick things from the inputs
@@ -499,6 +582,39 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
     return result;
   }
 
+  // Aug 2026: check cache of previously evaluated entries;
+  // identical content => identical FoM statistics, so skip the
+  // NRAN_t random-array generation and return the stored value.
+  if ( OPT_CACHE ) {
+
+    if ( CACHE_SNCADENCEFOM.HASH_LIST == NULL ) {
+      int MEMH = NSLOT_CACHE_SNCADENCEFOM * sizeof(unsigned long long);
+      int MEMD = NSLOT_CACHE_SNCADENCEFOM * sizeof(double);
+      CACHE_SNCADENCEFOM.HASH_LIST = (unsigned long long*)malloc(MEMH);
+      CACHE_SNCADENCEFOM.FOM_LIST  = (double*)malloc(MEMD);
+      for(i=0; i < NSLOT_CACHE_SNCADENCEFOM; i++ )
+	{ CACHE_SNCADENCEFOM.HASH_LIST[i] = 0 ; }
+    }
+
+    CACHE_SNCADENCEFOM.NCALL++ ;
+    HASH = hash_SNcadenceFoM(Nobs, MJDLIST, M5SIGLIST,
+			     parList, OPT_PARAM );
+
+    // linear probe; leave ISLOT=-9 (no store) if table is full
+    if ( CACHE_SNCADENCEFOM.NSTORE < NSLOT_CACHE_SNCADENCEFOM ) {
+      j = (int)( HASH & (NSLOT_CACHE_SNCADENCEFOM-1) );
+      while ( CACHE_SNCADENCEFOM.HASH_LIST[j] != 0 ) {
+	if ( CACHE_SNCADENCEFOM.HASH_LIST[j] == HASH ) {
+	  CACHE_SNCADENCEFOM.NREUSE++ ;
+	  return CACHE_SNCADENCEFOM.FOM_LIST[j] ;
+	}
+	j = (j+1) & (NSLOT_CACHE_SNCADENCEFOM-1) ;
+      }
+      ISLOT = j ;   // empty slot; fill after FoM is computed
+    }
+
+  } // end OPT_CACHE
+
 
   // Fill in the arrays for epochs by the values of the epochs
   for ( i=0; i < Nobs; i++ ) {
@@ -757,6 +873,13 @@ double SNcadenceFoM( int OPTMASK, int Nobs, double *MJDLIST, double *M5SIGLIST,
   //printf("     FoM_0= %f \n", ResultFoM_0);
   //printf(" === Bins above the FoM: %f \n", result);
 
+  // Aug 2026: store result for re-use on identical entries
+  if ( OPT_CACHE && ISLOT >= 0 ) {
+    CACHE_SNCADENCEFOM.HASH_LIST[ISLOT] = HASH ;
+    CACHE_SNCADENCEFOM.FOM_LIST[ISLOT]  = result ;
+    CACHE_SNCADENCEFOM.NSTORE++ ;
+  }
+
   return result;
 
 } // end of SNcadenceFoM
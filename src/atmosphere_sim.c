@@ -64,6 +64,14 @@
    replace HFILE_OPEN call with wrapper TABLEFILE_OPEN call.
     --> compiles & links, but not tested.
 
+ Aug 2026:
+   cache effective-throughput curves per (change,filter) so that the
+   per-lambda curve construction in get_SYNMAG_raw runs once instead
+   of once per SED x redshift, and compute the nominal (change-
+   independent) SYNMAGs only on the first change. Large sweeps of
+   atmospheric states now scale with NCHANGES x NFILT spectral
+   curve-builds instead of NCHANGES x NSED x NFILT x NZBIN.
+
 *****************************************/
 
 #include <stdio.h>
@@ -111,6 +119,9 @@ void loopShell(char *copt);
 void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) ;
 void get_SYNMAG_colorcor(int ised, int ichange, int ifilt, int iz) ;
 
+void get_EFFTRANS_CHANGE(int ichange, int ifilt,          // Aug 2026
+			 double **ptrTrans, double **ptrAtmRatio );
+
 void GET_FILTER_TRANS ( int ifilt, int imod, int ifrac, double *ftrans ) ; 
 
 void get_colorcor(int ichange, int ifilt);
@@ -271,8 +282,16 @@ double SYNMAG_avecXT[MXFILTCAL][MXSEDCAL][MXZBIN] ; // filter includes atmos
 
 // define mag changes from atmosph using nominal filter trans;
 // effectively the SED changes based on the atmos changes
-double SYNMAG_change_raw[MXCHANGES+1][MXFILTCAL][MXSEDCAL][MXZBIN] ; 
-double SYNMAG_change_colorcor[MXCHANGES+1][MXFILTCAL][MXSEDCAL][MXZBIN] ; 
+double SYNMAG_change_raw[MXCHANGES+1][MXFILTCAL][MXSEDCAL][MXZBIN] ;
+double SYNMAG_change_colorcor[MXCHANGES+1][MXFILTCAL][MXSEDCAL][MXZBIN] ;
+
+// Aug 2026: effective-throughput curves vs. (change,filter);
+// computed once in get_EFFTRANS_CHANGE and re-used for every
+// SED and redshift (they do not depend on either).
+struct {
+  double *TRANS[MXCHANGES+1][MXFILTCAL] ;    // NULL => not computed
+  double *ATMRATIO[MXCHANGES+1][MXFILTCAL] ;
+} EFFTRANS_CACHE ;
 
 int FLAGTMP;
 
@@ -418,6 +437,14 @@ void atmoshpere_init(void) {
 
   FLAGTMP = 0;
 
+  // Aug 2026: effective-throughput cache filled on demand
+  for ( i=0; i <= MXCHANGES; i++ ) {
+    for ( imod=0; imod < MXFILTCAL; imod++ ) {
+      EFFTRANS_CACHE.TRANS[i][imod]    = NULL ;
+      EFFTRANS_CACHE.ATMRATIO[i][imod] = NULL ;
+    }
+  }
+
   GLOBAL_LAMBDA_MIN =  9999999. ;
   GLOBAL_LAMBDA_MAX = -9999999. ;
 
@@ -1046,18 +1073,12 @@ void loopShell(char *copt) {
 // ****************************************************************
 void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) {
 
-  double 
-    *ptrFlux, *ptrTrans
-    ,z, mag, magxt, trans
-    ,TRnominal, TRchange,  lam
-    ,TR_ratio
-    ,atmRatio[MXLAMINT]
-    ,tmpTrans[MXLAMINT]
+  double
+    *ptrFlux, *ptrTrans, *ptrAtmRatio
+    ,z, mag, magxt
     ;
 
-  int ilam ;
-
-  char fnam[] = "get_SYNMAG_raw" ;
+  //  char fnam[] = "get_SYNMAG_raw" ;
 
   // ------------ BEGIN ------------
 
@@ -1067,16 +1088,21 @@ void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) {
   z         = INPUTS.ARRAY_REDSHIFT[iz];
   ptrFlux   = SED[ised].FLUX_REBIN ;  // rest-frame SED
 
-  // mag with no atmos extinction
-  ptrTrans  = FILTER[ifilt].TRANS_REBIN ;
-  mag       = SYNMAG( z,  ptrlam_rebin, ptrTrans, ptrFlux, ONEARRAY );
+  // Aug 2026: the nominal mags do not depend on ichange,
+  // so compute them only on the first change.
+  if ( ichange == 1 ) {
 
-  // mag with nominal atmos extinction
-  ptrTrans  = FILTER[ifilt].TRANSTOT_REBIN ;
-  magxt     = SYNMAG( z, ptrlam_rebin, ptrTrans, ptrFlux, ONEARRAY );
+    // mag with no atmos extinction
+    ptrTrans  = FILTER[ifilt].TRANS_REBIN ;
+    mag       = SYNMAG( z,  ptrlam_rebin, ptrTrans, ptrFlux, ONEARRAY );
 
-  SYNMAG_sansXT[ifilt][ised][iz] = mag;    // without atmos extinction
-  SYNMAG_avecXT[ifilt][ised][iz] = magxt;  // with atmos extinction
+    // mag with nominal atmos extinction
+    ptrTrans  = FILTER[ifilt].TRANSTOT_REBIN ;
+    magxt     = SYNMAG( z, ptrlam_rebin, ptrTrans, ptrFlux, ONEARRAY );
+
+    SYNMAG_sansXT[ifilt][ised][iz] = mag;    // without atmos extinction
+    SYNMAG_avecXT[ifilt][ised][iz] = magxt;  // with atmos extinction
+  }
 
   /*
   printf("\t mag(%s-%s, z=%4.2f) = %7.4f  -> %7.4f (with AtmosXtinc)\n",
@@ -1084,8 +1110,48 @@ void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) {
   */
 
   // --------------
+  // Aug 2026: effective throughput & SED-ratio curves depend only
+  // on (ichange,ifilt); fetch from cache (computed on first use)
+  // instead of rebuilding them for every SED and redshift.
+
+  get_EFFTRANS_CHANGE(ichange, ifilt, &ptrTrans, &ptrAtmRatio);
+
+  magxt = SYNMAG( z, ptrlam_rebin, ptrTrans, ptrFlux, ptrAtmRatio ) ;
+  SYNMAG_change_raw[ichange][ifilt][ised][iz] = magxt ;
+
+
 
-  for ( ilam=0; ilam < MXLAMINT; ilam++ ) {     
+} // end of get_SYNMAG_raw
+
+
+// ****************************************************************
+void get_EFFTRANS_CHANGE(int ichange, int ifilt,
+			 double **ptrTrans, double **ptrAtmRatio ) {
+
+  // Created Aug 2026
+  // Return effective filter transmission and SED atmos-ratio curves
+  // for atmosphere-change 'ichange' and filter 'ifilt'; computed on
+  // first call and cached since they depend on neither SED nor
+  // redshift. This is the per-lambda loop that used to live in
+  // get_SYNMAG_raw.
+
+  double *tmpTrans, *atmRatio ;
+  double trans, TRnominal, TRchange, TR_ratio, lam ;
+  int ilam, MEMD = MXLAMINT * sizeof(double) ;
+  char fnam[] = "get_EFFTRANS_CHANGE" ;
+
+  // ------------ BEGIN ------------
+
+  if ( EFFTRANS_CACHE.TRANS[ichange][ifilt] != NULL ) {
+    *ptrTrans    = EFFTRANS_CACHE.TRANS[ichange][ifilt] ;
+    *ptrAtmRatio = EFFTRANS_CACHE.ATMRATIO[ichange][ifilt] ;
+    return ;
+  }
+
+  tmpTrans = (double*) malloc(MEMD);
+  atmRatio = (double*) malloc(MEMD);
+
+  for ( ilam=0; ilam < MXLAMINT; ilam++ ) {
     lam = LAMBDA_REBIN[ilam] ;
 
     tmpTrans[ilam] =  0.0 ; // init entire array (May 2013)
@@ -1096,9 +1162,9 @@ void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) {
 
     trans     = FILTER[ifilt].TRANSTOT_REBIN[ilam] ;
     TRnominal = MODTRAN.AtmTRANS_REBIN[IMOD_TOTAL][ilam];
-    TRchange  = MODTRAN.AtmTRANS_CHANGE[ichange][ilam]; 
+    TRchange  = MODTRAN.AtmTRANS_CHANGE[ichange][ilam];
 
-    if ( TRnominal > 0.0 ) 
+    if ( TRnominal > 0.0 )
       { TR_ratio  = TRchange/TRnominal ; }
     else
       { TR_ratio = 0.0 ; }
@@ -1113,16 +1179,19 @@ void get_SYNMAG_raw(int ised, int ichange, int ifilt, int iz) {
     }
     else {
       sprintf(c1err,"Invalid OPT_FILTCOR = %d", INPUTS.OPT_FILTCOR );
-      errmsg(SEV_FATAL, 0, fnam, c1err, "" ); 
+      errmsg(SEV_FATAL, 0, fnam, c1err, "" );
     }
-  }   // ilam 
-  
-  magxt = SYNMAG( z, ptrlam_rebin, tmpTrans, ptrFlux, atmRatio ) ;
-  SYNMAG_change_raw[ichange][ifilt][ised][iz] = magxt ;
+  }   // ilam
 
+  EFFTRANS_CACHE.TRANS[ichange][ifilt]    = tmpTrans ;
+  EFFTRANS_CACHE.ATMRATIO[ichange][ifilt] = atmRatio ;
 
+  *ptrTrans    = tmpTrans ;
+  *ptrAtmRatio = atmRatio ;
 
-} // end of get_SYNMAG_raw
+  return ;
+
+} // end of get_EFFTRANS_CHANGE
 
 
 // ****************************************************************
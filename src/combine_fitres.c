@@ -129,6 +129,10 @@
 
  Jan 4 2021: add print_stats() for NEVT, NEVT_MISSING, NEVT_COMMON
 
+ Aug 2026: reduce peak memory on large combines: contiguous string-column
+           blocks (no per-cell malloc), and no float storage for string
+           or skipped columns. See fitres_malloc_flt/str.
+
 ******************************/
 
 #include <stdio.h>
@@ -976,17 +980,17 @@ void freeVar_TMP(int ifile, int NVARTOT, int NVARSTR, int MAXLEN) {
   // Aug 2013
   // Free _TMP arrays so that they can be re-allocated
   // with a different number of variables and SN.
+  //
+  // Aug 2026: string cells share one block per column (see
+  // fitres_malloc_str), so free the block via cell 0.
 
-  int ivar, isn ;
+  int ivar ;
 
   for ( ivar=0; ivar < NVARTOT; ivar++ ) {
 
     if ( ivar < NVARSTR ) {
-
-      for ( isn=0; isn < MAXLEN; isn++ ) 
-	{ free(FITRES_VALUES.STR_TMP[ivar][isn]) ; }
-
-      free( FITRES_VALUES.STR_TMP[ivar]  ) ;
+      free( FITRES_VALUES.STR_TMP[ivar][0] ) ;
+      free( FITRES_VALUES.STR_TMP[ivar]    ) ;
     }
 
     free( FITRES_VALUES.FLT_TMP[ivar] ) ;
@@ -1001,11 +1005,16 @@ void freeVar_TMP(int ifile, int NVARTOT, int NVARSTR, int MAXLEN) {
 // =====================================
 void  fitres_malloc_flt(int ifile, int NVAR, int MAXLEN) {
 
-  // allocate memory for FITRES_VALUES.TMP to read current 
-  // fitres file, and extend memory for FITRES_VALUES.FLT_ALL 
+  // allocate memory for FITRES_VALUES.TMP to read current
+  // fitres file, and extend memory for FITRES_VALUES.FLT_ALL
   // to store all fitres values.
   // NVAR is the number of variables to read from this fitres file.
   // MAXLEN is an estimate of the max array length to allocate.
+  //
+  // Aug 2026: allocate FLT_ALL columns only for numeric variables
+  //   that survive SKIP_VARNAME; string and skipped columns used to
+  //   get a never-read float array each (MAXLEN*4 bytes per column
+  //   per file), which added up when combining many large files.
 
   int ivar, isn, IVAR_ALL, NTOT, MEMF ;
   //  char fnam[] = "fitres_malloc_flt" ;
@@ -1023,25 +1032,38 @@ void  fitres_malloc_flt(int ifile, int NVAR, int MAXLEN) {
   NTOT = NVARALL_FITRES + NVAR + 1 ;
   MEMF = sizeof(float*) * NTOT ;
 
-  if (ifile == 0 ) 
+  if (ifile == 0 )
     { FITRES_VALUES.FLT_ALL = (float**)malloc(MEMF); }
-  else  
+  else
     { FITRES_VALUES.FLT_ALL = (float**)realloc(FITRES_VALUES.FLT_ALL,MEMF); }
 
-  
+  for ( isn=0; isn < MAXLEN; isn++ )  { USEDCID[isn] = false ; }
+
+  // IVAR_ALL advances only for variables kept in the combined table,
+  // mirroring the IVARTOT logic in ADD_FITRES_VARLIST.
+  IVAR_ALL = NVARALL_FITRES ;
+
   for ( ivar=0; ivar < NVAR; ivar++ ) {
 
     MEMF = sizeof(float  ) * MAXLEN ;
-    IVAR_ALL = NVARALL_FITRES + ivar ;
 
     FITRES_VALUES.FLT_TMP[ivar]     = (float  *)malloc(MEMF);
-    FITRES_VALUES.FLT_ALL[IVAR_ALL] = (float  *)malloc(MEMF);    
+    for ( isn=0; isn < MAXLEN; isn++ )
+      { FITRES_VALUES.FLT_TMP[ivar][isn] = INPUTS.NULLVAL_FLOAT ; }
 
-    for ( isn=0; isn < MAXLEN; isn++ ) {
-      USEDCID[isn] = false ;
-      FITRES_VALUES.FLT_TMP[ivar][isn]     = INPUTS.NULLVAL_FLOAT ;
-      FITRES_VALUES.FLT_ALL[IVAR_ALL][isn] = INPUTS.NULLVAL_FLOAT ;
+    if ( SKIP_VARNAME(ifile,ivar) ) { continue ; }
+
+    if ( READTABLE_POINTERS.ICAST_STORE[ivar] == ICAST_C ) {
+      // string values live in STR_ALL; don't waste a float column
+      FITRES_VALUES.FLT_ALL[IVAR_ALL] = NULL ;
     }
+    else {
+      FITRES_VALUES.FLT_ALL[IVAR_ALL] = (float  *)malloc(MEMF);
+      for ( isn=0; isn < MAXLEN; isn++ )
+	{ FITRES_VALUES.FLT_ALL[IVAR_ALL][isn] = INPUTS.NULLVAL_FLOAT ; }
+    }
+
+    IVAR_ALL++ ;
   }
 
 
@@ -1059,10 +1081,17 @@ void  fitres_malloc_str(int ifile, int NVAR, int MAXLEN) {
   // be there.
   //
   // Apr 27 2020: init STR_ALL and STR_TMP to 'NULL'
+  //
+  // Aug 2026: each column is now one contiguous MAXLEN*MXSTRLEN block
+  //   instead of MAXLEN separate malloc calls per column; the per-cell
+  //   pointers index into the block. Removes ~16-32 bytes of allocator
+  //   overhead per cell and the heap fragmentation that came with
+  //   millions of 60-byte allocations on large combines.
 
   //  char fnam[] = "fitres_malloc_str" ;
   int ivar, IVAR_ALL, isn, MEMC, NTOT ;
-  
+  char *blkTMP, *blkALL ;
+
   // ---------- BEGIN ------------
 
   printf("\t Allocate string memory for NVAR=%d and MAXLEN=%d \n",
@@ -1090,16 +1119,19 @@ void  fitres_malloc_str(int ifile, int NVAR, int MAXLEN) {
     // allocate SN-dimension
     MEMC = sizeof(char*) * MAXLEN ;
     FITRES_VALUES.STR_TMP[ivar]      = (char**)malloc(MEMC);
-    FITRES_VALUES.STR_ALL[IVAR_ALL]  = (char**)malloc(MEMC);    
+    FITRES_VALUES.STR_ALL[IVAR_ALL]  = (char**)malloc(MEMC);
+
+    // one contiguous char block per column; cell pointers index into it
+    MEMC   = MXSTRLEN * MAXLEN * sizeof(char) ;
+    blkTMP = (char*)malloc(MEMC);
+    blkALL = (char*)malloc(MEMC);
 
-    // allocate chars for each string argument
-    MEMC = MXSTRLEN * sizeof(char)  ;
     for ( isn=0; isn < MAXLEN; isn++ ) {
-      FITRES_VALUES.STR_TMP[ivar][isn]     = (char*)malloc(MEMC);
-      FITRES_VALUES.STR_ALL[IVAR_ALL][isn] = (char*)malloc(MEMC);
+      FITRES_VALUES.STR_TMP[ivar][isn]     = blkTMP + (isn*MXSTRLEN) ;
+      FITRES_VALUES.STR_ALL[IVAR_ALL][isn] = blkALL + (isn*MXSTRLEN) ;
       sprintf(FITRES_VALUES.STR_TMP[ivar][isn],"%s"    , DEFAULT_NULLVAL_STRING) ;
       sprintf(FITRES_VALUES.STR_ALL[IVAR_ALL][isn],"%s", DEFAULT_NULLVAL_STRING) ;
-   
+
     } // isn
   }  // ivar
 
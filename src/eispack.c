@@ -12369,6 +12369,15 @@ int rs ( int n, double a[], double w[], bool matz, double z[] )
   double *fv1;
   double *fv2;
   int ierr;
+/*
+  Aug 2026: the symmetric problems SNANA feeds through here (filter
+  covariances, mucov) are tiny; route them to the fixed-size Jacobi
+  kernel and keep the tred/tql path as the large-N fallback.
+*/
+  if ( 0 < n && n <= RS_SMALL_NMAX )
+  {
+    return rs_small ( n, a, w, matz, z );
+  }
 
   fv1 = ( double * ) malloc ( n * sizeof ( double ) );
 
@@ -17208,3 +17217,184 @@ int tsturm ( int n, double *eps1, double d[], double e[], double e2[],
 
   return ierr;
 }
+/******************************************************************************/
+
+int rs_small ( int n, double a[], double w[], bool matz, double z[] )
+
+/******************************************************************************/
+/*
+  Purpose:
+
+    RS_SMALL computes eigenvalues and eigenvectors of a small symmetric matrix.
+
+  Discussion:
+
+    RS_SMALL is a drop-in replacement for RS for matrix orders up to
+    RS_SMALL_NMAX.  It runs a cyclic Jacobi iteration on fixed-size
+    stack arrays, avoiding the heap traffic and the tred2/tql2 call
+    chain of the full eispack path; for the small dense covariance
+    problems this is both faster and better conditioned.
+
+    The calling convention, the ascending eigenvalue order, and the
+    eigenvector storage (eigenvector K occupies Z[K*N] ... Z[K*N+N-1])
+    match RS exactly, and the input matrix A is not modified.
+
+  Modified:
+
+    29 August 2026
+
+  Parameters:
+
+    Input, int N, the order of the matrix, 1 <= N <= RS_SMALL_NMAX.
+
+    Input, double A[N*N], the real symmetric matrix.
+
+    Input, bool MATZ, is false if only eigenvalues are desired,
+    and true if both eigenvalues and eigenvectors are desired.
+
+    Output, double W[N], the eigenvalues in ascending order.
+
+    Output, double Z[N*N], contains the eigenvectors, if MATZ
+    is true.
+
+    Output, int RS_SMALL, is zero on normal completion, and N+1
+    if the Jacobi sweeps fail to converge.
+*/
+{
+  double acopy[RS_SMALL_NMAX*RS_SMALL_NMAX];
+  double v[RS_SMALL_NMAX*RS_SMALL_NMAX];
+  double off, norm, apq, app, aqq, theta, t, c, s, tau, g, h;
+  int i, j, k, p, q, sweep;
+  const int SWEEP_MAX = 50;
+
+  for ( i = 0; i < n * n; i++ )
+  {
+    acopy[i] = a[i];
+    v[i] = 0.0;
+  }
+  for ( i = 0; i < n; i++ )
+  {
+    v[i*n+i] = 1.0;
+  }
+
+  norm = 0.0;
+  for ( i = 0; i < n * n; i++ )
+  {
+    norm = norm + acopy[i] * acopy[i];
+  }
+
+  for ( sweep = 0; sweep < SWEEP_MAX; sweep++ )
+  {
+    off = 0.0;
+    for ( p = 0; p < n - 1; p++ )
+    {
+      for ( q = p + 1; q < n; q++ )
+      {
+        off = off + 2.0 * acopy[p*n+q] * acopy[p*n+q];
+      }
+    }
+    if ( off <= 1.0E-28 * norm )
+    {
+      break;
+    }
+
+    for ( p = 0; p < n - 1; p++ )
+    {
+      for ( q = p + 1; q < n; q++ )
+      {
+        apq = acopy[p*n+q];
+        if ( apq == 0.0 )
+        {
+          continue;
+        }
+        app = acopy[p*n+p];
+        aqq = acopy[q*n+q];
+        theta = 0.5 * ( aqq - app ) / apq;
+        t = 1.0 / ( fabs ( theta ) + sqrt ( theta * theta + 1.0 ) );
+        if ( theta < 0.0 )
+        {
+          t = - t;
+        }
+        c = 1.0 / sqrt ( t * t + 1.0 );
+        s = t * c;
+        tau = s / ( 1.0 + c );
+
+        acopy[p*n+p] = app - t * apq;
+        acopy[q*n+q] = aqq + t * apq;
+        acopy[p*n+q] = 0.0;
+        acopy[q*n+p] = 0.0;
+
+        for ( i = 0; i < n; i++ )
+        {
+          if ( i != p && i != q )
+          {
+            g = acopy[i*n+p];
+            h = acopy[i*n+q];
+            acopy[i*n+p] = g - s * ( h + g * tau );
+            acopy[i*n+q] = h + s * ( g - h * tau );
+            acopy[p*n+i] = acopy[i*n+p];
+            acopy[q*n+i] = acopy[i*n+q];
+          }
+        }
+        for ( i = 0; i < n; i++ )
+        {
+          g = v[i*n+p];
+          h = v[i*n+q];
+          v[i*n+p] = g - s * ( h + g * tau );
+          v[i*n+q] = h + s * ( g - h * tau );
+        }
+      }
+    }
+  }
+
+  if ( sweep == SWEEP_MAX )
+  {
+    printf ( "\n" );
+    printf ( "RS_SMALL - Fatal error!\n" );
+    printf ( "  No convergence after %d Jacobi sweeps.\n", SWEEP_MAX );
+    return n + 1;
+  }
+/*
+  Sort eigenvalues into ascending order, carrying the vectors along.
+*/
+  for ( i = 0; i < n; i++ )
+  {
+    w[i] = acopy[i*n+i];
+  }
+  for ( i = 0; i < n - 1; i++ )
+  {
+    k = i;
+    for ( j = i + 1; j < n; j++ )
+    {
+      if ( w[j] < w[k] )
+      {
+        k = j;
+      }
+    }
+    if ( k != i )
+    {
+      t = w[k];
+      w[k] = w[i];
+      w[i] = t;
+      for ( j = 0; j < n; j++ )
+      {
+        t = v[j*n+k];
+        v[j*n+k] = v[j*n+i];
+        v[j*n+i] = t;
+      }
+    }
+  }
+
+  if ( matz )
+  {
+    for ( k = 0; k < n; k++ )
+    {
+      for ( i = 0; i < n; i++ )
+      {
+        z[k*n+i] = v[i*n+k];
+      }
+    }
+  }
+
+  return 0;
+}
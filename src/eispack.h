@@ -101,6 +101,11 @@ int rg_ort ( int n, double a[], double wr[], double wi[], bool matz,
 int rgg ( int n, double a[], double b[], double alfr[], double alfi[], 
   double beta[], bool matz, double z[] );
 int rs ( int n, double a[], double w[], bool matz, double z[] );
+
+/* Aug 2026: fast fixed-size kernel for small dense symmetric problems;
+   selected automatically inside rs() for n <= RS_SMALL_NMAX. */
+# define RS_SMALL_NMAX 8
+int rs_small ( int n, double a[], double w[], bool matz, double z[] );
 int rsb ( int n, int mb, double a[], double w[], bool matz, double z[] );
 int rsg ( int n, double a[], double b[], double w[], bool matz, double z[] );
 int rsgab ( int n, double a[], double b[], double w[], bool matz, double z[] );
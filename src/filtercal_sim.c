@@ -54,8 +54,6 @@ void open_output(void);
 
 double SYNMAG( double z, double *ptrlam, double *ptrtrans, double *ptrflux );
 
-void MAGEVAL(int ised, int ifilt, int iz, int isig, int istp, int ioff);
-
 void FILTCAL_CURVE (
 		    int ifilt, 
 		    double LAM_STEP, double LAM_SIGMA, double LAM_START,
@@ -76,6 +74,7 @@ void   DUMP_FILTER(int ifilt, int isig, int istp,  double *TRANS_REBIN );
 #define MXLAM_SED    4000  // max # input lambda bins for SED
 #define MXLAMINT    20000  // max # lambda bins for integration
 #define MXBIN         100  // max # bins for Z, LAMSTEP, LAMSIGMA
+#define MXCHAR_OUTROW 80   // Aug 2026: max length of buffered output row
 
 #define FNU_AB  3.631E-20 // flat Fnu for AB, erg/cm^2*s*Hz
 
@@ -84,7 +83,6 @@ double GLOBAL_LAMBDA_MAX; //  used to limit SED range that is read
 
 
 FILE *fpout ;
-double  MAGDIF_MAX ;
 
 
 struct INPUTS {
@@ -189,6 +187,15 @@ int main(int argc, char **argv) {
   double *ptrflux, *ptrtrans ;
   double z, mag;
 
+  // Aug 2026: locals for the restructured sweep loop
+  int    NZ, NSIG, NSTP, NOFF, NROW_BLOCK, NBIN_FILTCAL, irow ;
+  double OFFSETFRAC, LAM_OFF, LAM_START, LAM_SIGMA, LAM_STEP, LAM_AVG ;
+  double Z, magref, magdif, absmagdif ;
+  double FILTCAL_LAMBDA[MXLAM_FILT], FILTCAL_TRANS[MXLAM_FILT];
+  double FILTCAL_REBIN[MXLAMINT];
+  double MAGDIF_MAX_Z[MXBIN];
+  char  *OUTROW_BLOCK ;
+
   // ---------------- BEGIN ---------------
 
   sprintf(BANNER,"Begin execution of filtercal_sim.exe " );
@@ -284,34 +291,106 @@ int main(int argc, char **argv) {
 
   // -----------------------------------------------------------
   // BIG LOOP over each filter, sed & filter-calib properties
+  //
+  // Aug 2026: the measured filter curve depends only on
+  // (ifilt,isig,istp,ioff), so it is computed once per realization
+  // and re-used for every SED and redshift instead of being
+  // recomputed NSED*NZ times (was done per call in MAGEVAL, which
+  // this loop replaces).  Output rows
+  // are buffered per (sed,filter) block and written in the
+  // original (z,sigma,step,offset) order.
+
+  NZ   = INPUTS.NBIN_REDSHIFT ;
+  NSIG = INPUTS.NBIN_LAMCAL_SIGMA ;
+  NSTP = INPUTS.NBIN_LAMCAL_STEP ;
+  NOFF = INPUTS.NBIN_LAMCAL_OFFSETFRAC ;
+  NROW_BLOCK   = NZ * NSIG * NSTP * (NOFF+1) ;
+  OUTROW_BLOCK = (char*) malloc ( NROW_BLOCK * MXCHAR_OUTROW );
 
   for ( ised=1; ised <= INPUTS.NSED; ised++ ) {
     for ( ifilt=1; ifilt <= INPUTS.NFILT; ifilt++ ) {
 
       printf("   Process filtercal for %s-%s  Z = ",
 	     INPUTS.sedName[ised], INPUTS.filterName[ifilt] );
-
-      for ( iz=1; iz <= INPUTS.NBIN_REDSHIFT; iz++ ) {
-
-	printf(" %4.2f", INPUTS.ARRAY_REDSHIFT[iz] ); 
-	fflush(stdout);
-
-	for ( isig=1; isig <= INPUTS.NBIN_LAMCAL_SIGMA; isig++ ) {
-	  for ( istp=1; istp <= INPUTS.NBIN_LAMCAL_STEP;  istp++ ) {
-	    for ( ioff=1; ioff <= INPUTS.NBIN_LAMCAL_OFFSETFRAC+1; ioff++ ) {
-
-	      MAGEVAL(ised,ifilt,iz,isig,istp,ioff);
-
-	    }// LAM OFFSET-FRAC
-	  }  // LAM STEP
-	}   // LAM SIGMA
-      }     // REDSHIFT
-
-        printf("\n");
+      for ( iz=1; iz <= NZ; iz++ )
+	{ printf(" %4.2f", INPUTS.ARRAY_REDSHIFT[iz] ); }
+      fflush(stdout);
+
+      for ( isig=1; isig <= NSIG; isig++ ) {
+	for ( istp=1; istp <= NSTP;  istp++ ) {
+
+	  LAM_SIGMA  = INPUTS.ARRAY_LAMSIGMA[isig];
+	  LAM_STEP   = INPUTS.ARRAY_LAMSTEP[istp];
+
+	  for ( iz=1; iz <= NZ; iz++ )  { MAGDIF_MAX_Z[iz] = 0.0 ; }
+
+	  for ( ioff=1; ioff <= NOFF; ioff++ ) {
+
+	    OFFSETFRAC = INPUTS.ARRAY_LAMOFFSETFRAC[ioff];
+	    LAM_OFF    = OFFSETFRAC * LAM_STEP ;
+	    LAM_START  = FILTER[ifilt].LAMBDA_MEAN + LAM_OFF ;
+
+	    // measure filter curve for this realization (once)
+	    FILTCAL_CURVE(ifilt, LAM_STEP, LAM_SIGMA, LAM_START
+			  ,&NBIN_FILTCAL, FILTCAL_LAMBDA, FILTCAL_TRANS
+			  ,&LAM_AVG );
+
+	    filtercal_rebin(NBIN_FILTCAL, FILTCAL_LAMBDA, FILTCAL_TRANS,
+			    FILTCAL_REBIN );
+
+	    // use measured curve for synthetic mag at every redshift
+	    for ( iz=1; iz <= NZ; iz++ ) {
+	      Z      = INPUTS.ARRAY_REDSHIFT[iz];
+	      mag    = SYNMAG( Z, LAMBDA_INTEG, FILTCAL_REBIN,
+			       SED[ised].FLUX_INTEG );
+	      magref = MAGREF[ifilt][ised][iz] ;
+	      magdif = mag - magref ;
+
+	      absmagdif = fabs(magdif) ;
+	      if ( absmagdif > MAGDIF_MAX_Z[iz] )
+		{ MAGDIF_MAX_Z[iz] = absmagdif ; }
+
+	      irow = ( ((iz-1)*NSIG + isig-1)*NSTP + istp-1 )*(NOFF+1)
+		+ (ioff-1) ;
+	      sprintf(&OUTROW_BLOCK[irow*MXCHAR_OUTROW],
+		      "%2d  %2d  %4.2f  %4.0f  %4.0f  %4.0f %6.0f %7.4f \n"
+		      ,ifilt, ised, Z, LAM_SIGMA, LAM_STEP, LAM_OFF
+		      ,LAM_AVG, magdif );
+	    } // REDSHIFT
+
+	    // check for filter dump
+	    if ( ised == 1 && ioff == 1 )
+	      { DUMP_FILTER ( ifilt, isig, istp, FILTCAL_REBIN ); }
+
+	  } // LAM OFFSET-FRAC
+
+	  // special last ioff bin stores max |magdif| over offsets
+	  OFFSETFRAC = INPUTS.ARRAY_LAMOFFSETFRAC[NOFF+1];
+	  for ( iz=1; iz <= NZ; iz++ ) {
+	    Z      = INPUTS.ARRAY_REDSHIFT[iz];
+	    magdif = MAGDIF_MAX_Z[iz] ;
+	    irow = ( ((iz-1)*NSIG + isig-1)*NSTP + istp-1 )*(NOFF+1)
+	      + NOFF ;
+	    sprintf(&OUTROW_BLOCK[irow*MXCHAR_OUTROW],
+		    "%2d  %2d  %4.2f  %4.0f  %4.0f  %4.0f %6.0f %7.4f \n"
+		    ,ifilt, ised, Z, LAM_SIGMA, LAM_STEP, OFFSETFRAC
+		    ,LAM_AVG, magdif );
+	  }
+
+	}  // LAM STEP
+      }   // LAM SIGMA
+
+      // write buffered rows in the original order
+      for ( irow=0; irow < NROW_BLOCK; irow++ )
+	{ fprintf(fpout,"%s", &OUTROW_BLOCK[irow*MXCHAR_OUTROW] ); }
+
+      printf("\n");
 
     }       // filter
   }         // SED
 
+  free(OUTROW_BLOCK);
+
 
   filtercal_end();
 
@@ -1053,98 +1132,6 @@ double SYNMAG( double z, double *ptrlam, double *ptrtrans, double *ptrflux ) {
 
 } // end of SYNMAG
 
-// ****************************************************************
-void MAGEVAL(int ised, int ifilt, int iz, int isig, int istp, int ioff) {
-
-  /****
-   Use input indices to extract parameters for measuring
-   filter response and measuring synthetic mag.
-  ***/
-
-
-  int       NBIN_FILTCAL    ;
-
-  double 
-    Z
-    ,OFFSETFRAC
-    ,LAM_OFF
-    ,LAM_START
-    ,LAM_SIGMA
-    ,LAM_STEP
-    ,LAM_AVG
-    ,mag, magdif, absmagdif, magref
-    ,FILTCAL_LAMBDA[MXLAM_FILT]
-    ,FILTCAL_TRANS[MXLAM_FILT]
-    ,FILTCAL_REBIN[MXLAMINT]
-    , *ptrlam
-    , *ptrtrans
-    , *ptrflux 
-    ;
-
-  // --------- BEGIN ---------
-
-
-  Z          = INPUTS.ARRAY_REDSHIFT[iz];
-  OFFSETFRAC = INPUTS.ARRAY_LAMOFFSETFRAC[ioff];
-  LAM_SIGMA  = INPUTS.ARRAY_LAMSIGMA[isig];
-  LAM_STEP   = INPUTS.ARRAY_LAMSTEP[istp];
-  LAM_OFF    = OFFSETFRAC * LAM_STEP ;
-  LAM_START  = FILTER[ifilt].LAMBDA_MEAN + LAM_OFF ;
-
-  // check special ioff bin that means to store max magdif
-  if ( ioff == 1 )  MAGDIF_MAX = 0.0 ;
-
-  if (  ioff == INPUTS.NBIN_LAMCAL_OFFSETFRAC+1 ) {
-    LAM_OFF  = OFFSETFRAC ;
-    magdif   = MAGDIF_MAX ;
-    goto UPDATE_OUTFILE ;
-  }
-
-  FILTCAL_CURVE(ifilt, LAM_STEP, LAM_SIGMA, LAM_START           // inputs
-		,&NBIN_FILTCAL    // (O) Number of filter bin
-		,FILTCAL_LAMBDA   // (O) array of lambdas
-		,FILTCAL_TRANS    // (O) array of transmission
-		,&LAM_AVG );      // (O) average lambda
-
-  /***
-  for ( i=0; i < NBIN_FILTCAL;  i++ ) {
-    printf(" xxxxx  FILTER_CURVE point %2d LAM=%6.0f  TRANS=%6.3f \n",
-	   i, FILTCAL_LAMBDA[i], FILTCAL_TRANS[i] );
-  }
-  ***/
-
-  // rebin measured curve to prepare for integration
-
-  filtercal_rebin(NBIN_FILTCAL, FILTCAL_LAMBDA, FILTCAL_TRANS,  // inputs 
-		  FILTCAL_REBIN );  // output
-
-  // use measured curve to compute synthetic mag for this SED
-
-  ptrlam   = LAMBDA_INTEG ;
-  ptrtrans = FILTCAL_REBIN ;
-  ptrflux  = SED[ised].FLUX_INTEG ;
- 
-  mag    = SYNMAG( Z, ptrlam, ptrtrans, ptrflux );
-  magref = MAGREF[ifilt][ised][iz] ;
-  magdif = mag - magref ;
-
-  absmagdif = fabs(magdif) ;
-  if ( absmagdif > MAGDIF_MAX )  MAGDIF_MAX = absmagdif ;
-
- UPDATE_OUTFILE:
-
-  fprintf(fpout,"%2d  %2d  %4.2f  %4.0f  %4.0f  %4.0f %6.0f %7.4f \n"
-	  ,ifilt, ised, Z, LAM_SIGMA, LAM_STEP, LAM_OFF, LAM_AVG, magdif );
-
-
-  // check for filter dump
-  if ( iz == 1 && ised == 1 && ioff == 1 ) 
-    DUMP_FILTER ( ifilt, isig, istp, ptrtrans );
-
-
-} // end of MAGEVAL
-
-
 // ************************************************
 void  FILTCAL_CURVE(
 		    int ifilt            // (I) filter index
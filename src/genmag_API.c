@@ -0,0 +1,276 @@
+/**********************************************
+  Created Aug 2026
+
+  Implementation of the library-mode genmag API; see genmag_API.h
+  for the calling sequence. This layer only orchestrates existing
+  driver code (genmag_SEDtools, genmag_SALT2, genmag_SIMSED,
+  sntools_genSmear); it holds no model tables of its own.
+
+**********************************************/
+
+#include "sntools.h"
+#include "sntools_genSmear.h"
+#include "genmag_SEDtools.h"
+#include "genmag_SALT2.h"
+#include "genmag_SIMSED.h"
+#include "genmag_API.h"
+
+#define MXPAR_GENMAG_API 40  // max NPAR for SIMSED surface params
+
+// =============================================
+int init_primary_genmag_API(char *name, int NLAM,
+			    double *LAM, double *FLUX) {
+
+  // Created Aug 2026
+  // Register primary reference spectrum (e.g., BD17, AB);
+  // thin wrapper so services need not include genmag_SEDtools.h.
+
+  //  char fnam[] = "init_primary_genmag_API" ;
+
+  // ----------- BEGIN -------------
+
+  return init_primary_SEDMODEL(name, NLAM, LAM, FLUX);
+
+} // end init_primary_genmag_API
+
+
+// =============================================
+int init_filter_genmag_API(int ifilt_obs, char *filterName,
+			   char *surveyName, double magprimary,
+			   int NLAM, double *LAM, double *TRANS) {
+
+  // Created Aug 2026
+  // Register one filter transmission for absolute index ifilt_obs.
+  // Same transmission is used for SN and reference (no lam shift).
+
+  double LAMSHIFT = 0.0 ;
+  int istat;
+  //  char fnam[] = "init_filter_genmag_API" ;
+
+  // ----------- BEGIN -------------
+
+  istat = init_filter_SEDMODEL(ifilt_obs, filterName, surveyName,
+			       magprimary, NLAM, LAM, TRANS, TRANS,
+			       LAMSHIFT );
+  if ( istat == 0 ) { GENMAG_API.NFILTDEF++ ; }
+  return istat;
+
+} // end init_filter_genmag_API
+
+
+// =============================================
+void init_zrange_genmag_API(double zmin, double zmax) {
+
+  // Created Aug 2026
+  // Set redshift range for SEDMODEL flux-integral tables.
+
+  int NZBIN = 100 ;
+  //  char fnam[] = "init_zrange_genmag_API" ;
+
+  // ----------- BEGIN -------------
+
+  GENMAG_API.ZRANGE[0] = zmin ;
+  GENMAG_API.ZRANGE[1] = zmax ;
+  init_redshift_SEDMODEL(NZBIN, zmin, zmax);
+  return;
+
+} // end init_zrange_genmag_API
+
+
+// =============================================
+void init_MWXT_genmag_API(int OPT_COLORLAW, double RV) {
+  init_MWXT_SEDMODEL(OPT_COLORLAW, RV);
+}
+
+
+// =============================================
+int init_genmag_API(char *MODEL_NAME, char *SURVEY, int OPTMASK) {
+
+  // Created Aug 2026
+  // One-time init of requested model only; filters and primary
+  // must be registered first. Returns 0 on success.
+
+  char MODEL_EXTRAP[] = "" ;
+  char PATH_BINARY[]  = "" ;
+  char kcorFile[]     = "" ;
+  int  istat = 0 ;
+  char fnam[] = "init_genmag_API" ;
+
+  // ----------- BEGIN -------------
+
+  if ( GENMAG_API.NFILTDEF == 0 ) {
+    sprintf(c1err,"No filters registered for model=%s", MODEL_NAME);
+    sprintf(c2err,"Call init_filter_genmag_API first.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  sprintf(GENMAG_API.MODEL_NAME, "%s", MODEL_NAME);
+  sprintf(GENMAG_API.SURVEY,     "%s", SURVEY);
+
+  // default z-range if service never set one
+  if ( GENMAG_API.ZRANGE[1] == 0.0 )
+    { init_zrange_genmag_API(0.001, 4.0); }
+
+  if ( strstr(MODEL_NAME,"SALT2") != NULL ) {
+    GENMAG_API.INDEX_MODEL = MODEL_SALT2 ;
+    istat = init_genmag_SALT2(MODEL_NAME, MODEL_EXTRAP, OPTMASK);
+    if ( istat != 0 ) { return istat; }
+  }
+  else if ( strstr(MODEL_NAME,"SIMSED") != NULL ) {
+    GENMAG_API.INDEX_MODEL = MODEL_SIMSED ;
+    istat = init_genmag_SIMSED(MODEL_NAME, PATH_BINARY, SURVEY,
+			       kcorFile, OPTMASK);
+    if ( istat == 0 ) { return 1 ; } // SIMSED convention: 0 = fail
+  }
+  else {
+    sprintf(c1err,"Unknown model class for MODEL_NAME='%s'", MODEL_NAME);
+    sprintf(c2err,"Expecting name to contain SALT2 or SIMSED.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  GENMAG_API.INIT_DONE = true ;
+  return 0 ;
+
+} // end init_genmag_API
+
+
+// =============================================
+int init_genSmear_API(char *smearModel, double SIGCOH, int ISEED) {
+
+  // Created Aug 2026
+  // Optional init of intrinsic-scatter model; follows the
+  // standalone pattern in SIMSED_fudge.c::init_SMEARMODEL.
+  // ISEED seeds the internal random stream used to draw the
+  // per-event smear randoms (see prep_event_genmag_API).
+
+  char SMEAR_SCALE_STRING[] = "1.0" ;
+  int  NSTREAM = 1, NGAURAN, NFLATRAN ;
+  char fnam[] = "init_genSmear_API" ;
+
+  // ----------- BEGIN -------------
+
+  init_random_seed(ISEED, NSTREAM);
+  init_genSmear_FLAGS(MASK_GENSMEAR_APPLY, SMEAR_SCALE_STRING);
+
+  if ( strcmp(smearModel,"G10") == 0 ) {
+    init_genSmear_SALT2(GENMAG_API.MODEL_NAME, "G10", SIGCOH,
+			GENMAG_API.ZRANGE);
+  }
+  else if ( strcmp(smearModel,"C11") == 0 ) {
+    init_genSmear_Chotard11(0);
+  }
+  else if ( strcmp(smearModel,"COH") == 0 ) {
+    init_genSmear_COH("");
+  }
+  else {
+    sprintf(c1err,"Invalid smearModel = '%s'", smearModel);
+    sprintf(c2err,"Valid library-mode models: G10 C11 COH");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  get_NRAN_genSmear(&NGAURAN, &NFLATRAN);
+  init_genSmear_randoms(NGAURAN, NFLATRAN);
+
+  GENMAG_API.USE_GENSMEAR = true ;
+  return 0 ;
+
+} // end init_genSmear_API
+
+
+// =============================================
+void prep_event_genmag_API(int CID) {
+
+  // Created Aug 2026
+  // Advance randoms for next event; required before genmag_API
+  // when a genSmear model is initialized.
+
+  double rmin = -3.0, rmax = 3.0, RANFIX = -999.0 ;
+  //  char fnam[] = "prep_event_genmag_API" ;
+
+  // ----------- BEGIN -------------
+
+  if ( !GENMAG_API.USE_GENSMEAR ) { return; }
+
+  fill_RANLISTs();
+  load_genSmear_randoms(CID, rmin, rmax, RANFIX);
+  return;
+
+} // end prep_event_genmag_API
+
+
+// =============================================
+int genmag_API(int ifilt_obs, double z, double mwebv,
+	       int NPAR, double *parList,
+	       int Nobs, double *Tobs_list,
+	       double *magobs_list, double *magerr_list) {
+
+  // Created Aug 2026
+  // Evaluate broadband mags (and errors) for one filter at a
+  // list of Tobs; see genmag_API.h for parList packing.
+  // Returns 0 on success.
+
+  int OPTMASK = 0 ;
+  double x0, x1, c, RV_host=0.0, AV_host=0.0 ;
+  int    iflagpar[MXPAR_GENMAG_API], iparmap[MXPAR_GENMAG_API];
+  int    NLUMIPAR, ipar, index_sed ;
+  char fnam[] = "genmag_API" ;
+
+  // ----------- BEGIN -------------
+
+  if ( !GENMAG_API.INIT_DONE ) {
+    sprintf(c1err,"Must call init_genmag_API before genmag_API");
+    sprintf(c2err,"Check calling sequence in service code.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  if ( GENMAG_API.INDEX_MODEL == MODEL_SALT2 ) {
+
+    if ( NPAR != 3 && NPAR != 5 ) {
+      sprintf(c1err,"Invalid NPAR=%d for SALT2", NPAR);
+      sprintf(c2err,"Expecting x0,x1,c [,RV_host,AV_host]");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+    x0 = parList[0];  x1 = parList[1];  c = parList[2];
+    if ( NPAR == 5 ) { RV_host = parList[3];  AV_host = parList[4]; }
+
+    genmag_SALT2(OPTMASK, ifilt_obs, x0, x1, x1, c, mwebv,
+		 RV_host, AV_host, z, z,
+		 Nobs, Tobs_list, magobs_list, magerr_list);
+  }
+  else if ( GENMAG_API.INDEX_MODEL == MODEL_SIMSED ) {
+
+    NLUMIPAR = NPAR - 1 ;
+    if ( NLUMIPAR < 1 || NLUMIPAR >= MXPAR_GENMAG_API ) {
+      sprintf(c1err,"Invalid NPAR=%d for SIMSED", NPAR);
+      sprintf(c2err,"Expecting x0 + at least one surface param.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+    // continuous interp over all surface params, in model order
+    for(ipar=0; ipar < NLUMIPAR; ipar++ ) {
+      iflagpar[ipar] = OPTMASK_GEN_SIMSED_PARAM ;
+      iparmap[ipar]  = ipar ;
+    }
+    genmag_SIMSED(OPTMASK, ifilt_obs, parList[0],
+		  NLUMIPAR, iflagpar, iparmap, &parList[1],
+		  RV_host, AV_host, mwebv, z,
+		  Nobs, Tobs_list, magobs_list, magerr_list,
+		  &index_sed );
+  }
+  else {
+    sprintf(c1err,"Invalid INDEX_MODEL=%d", GENMAG_API.INDEX_MODEL);
+    sprintf(c2err,"MODEL_NAME = '%s'", GENMAG_API.MODEL_NAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  return 0 ;
+
+} // end genmag_API
+
+
+// =============================================
+void get_genSmear_API(double Trest, double c, double x1,
+		      int NLam, double *Lam, double *magSmear) {
+  get_genSmear(Trest, c, x1, NLam, Lam, magSmear);
+}
+
+// END
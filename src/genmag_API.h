@@ -0,0 +1,69 @@
+/**********************************************
+  Created Aug 2026
+
+  "Library mode" API over the genmag model drivers so that external
+  services can evaluate the exact SNANA models (SALT2, SIMSED) and
+  the genSmear intrinsic-scatter models without the full snlc_sim
+  initialization and its sim-input globals.
+
+  Startup is trimmed to the requested model: the embedding service
+  registers the primary reference and filter transmissions directly
+  with arrays (no kcor file), then calls init_genmag_API once and
+  genmag_API per evaluation.
+
+  Build as shared library with "make libgenmag" (see src/Makefile).
+
+  Beware: the underlying drivers store model tables in globals, so
+  there is one model per process and evaluations must be serialized
+  by the caller; there is no per-handle thread safety.
+
+**********************************************/
+
+// info for the one-and-only model handle (drivers use globals)
+struct {
+  bool INIT_DONE ;
+  int  INDEX_MODEL ;          // MODEL_SALT2 or MODEL_SIMSED
+  char MODEL_NAME[MXPATHLEN]; // model name or full model path
+  char SURVEY[60] ;
+  int  NFILTDEF ;             // number of registered filters
+  bool USE_GENSMEAR ;
+  double ZRANGE[2] ;          // from init_zrange_genmag_API
+} GENMAG_API ;
+
+
+// ------ function declarations ------
+
+// registration of primary ref, filters, z-range, Galactic color law;
+// call these before init_genmag_API.
+int  init_primary_genmag_API(char *name, int NLAM,
+			     double *LAM, double *FLUX);
+int  init_filter_genmag_API(int ifilt_obs, char *filterName,
+			    char *surveyName, double magprimary,
+			    int NLAM, double *LAM, double *TRANS);
+void init_zrange_genmag_API(double zmin, double zmax);
+void init_MWXT_genmag_API(int OPT_COLORLAW, double RV);
+
+// one-time model init; MODEL_NAME is a model name or full path
+// containing 'SALT2' or 'SIMSED'.
+int  init_genmag_API(char *MODEL_NAME, char *SURVEY, int OPTMASK);
+
+// optional intrinsic-scatter model (G10, C11, COH)
+int  init_genSmear_API(char *smearModel, double SIGCOH, int ISEED);
+
+// call once per event to advance randoms for genSmear
+void prep_event_genmag_API(int CID);
+
+// evaluate broadband mags for one filter and a list of Tobs.
+// parList packing:
+//   SALT2 :  x0, x1, c [, RV_host, AV_host]   (NPAR=3 or 5)
+//   SIMSED:  x0, then NPAR-1 SED-surface params (continuous interp)
+int  genmag_API(int ifilt_obs, double z, double mwebv,
+		int NPAR, double *parList,
+		int Nobs, double *Tobs_list,
+		double *magobs_list, double *magerr_list);
+
+// pass-through of get_genSmear for spectral services
+void get_genSmear_API(double Trest, double c, double x1,
+		      int NLam, double *Lam, double *magSmear);
+
+// END
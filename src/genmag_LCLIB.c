@@ -1538,12 +1538,16 @@ void forceTemplateRows_LCLIB(void) {
 
   // start by finding last Search DAY that occurs
   // before LCLIB_EVENT.DAY_RANDOM.
+  // (Aug 2026: binary search since DAY list is sorted)
 
-  //  for(row=FIRSTROW_S; row < NROW; row++ ) {
-  for(row=FIRSTROW_S; row < NEW_LASTROW_S; row++ ) {
-    if ( LCLIB_EVENT.DAY[row] < LCLIB_EVENT.DAY_RANDOM ) 
-      { NEW_FIRSTROW_S = row; }
+  int lo, hi, mid ;
+  lo = FIRSTROW_S ;  hi = NEW_LASTROW_S ;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2 ;
+    if ( LCLIB_EVENT.DAY[mid] < LCLIB_EVENT.DAY_RANDOM )
+      { lo = mid+1; } else { hi = mid; }
   }
+  if ( lo-1 >= FIRSTROW_S ) { NEW_FIRSTROW_S = lo-1; }
 
 
   // now go back in time to cover template time range that occurs
@@ -1589,10 +1593,13 @@ void forceTemplateRows_LCLIB(void) {
 
 
   DAYMIN_T = LCLIB_EVENT.DAY[NEW_LASTROW_T] - LCLIB_INFO.EPRANGE_TEMPLATE;
-  for(row=FIRSTROW_S; row < NEW_LASTROW_T; row++ ) {
-    if ( LCLIB_EVENT.DAY[row] < DAYMIN_T ) 
-      { NEW_FIRSTROW_T = row; } 
+  lo = FIRSTROW_S ;  hi = NEW_LASTROW_T ;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2 ;
+    if ( LCLIB_EVENT.DAY[mid] < DAYMIN_T )
+      { lo = mid+1; } else { hi = mid; }
   }
+  if ( lo-1 >= FIRSTROW_S ) { NEW_FIRSTROW_T = lo-1; }
 
   if ( NEW_FIRSTROW_S < 0 ) { ERRFLAG=1; }
   if ( NEW_FIRSTROW_T < 0 ) { ERRFLAG=2; }
@@ -2521,17 +2528,24 @@ double magInterp_LCLIB(double T, int NROW, double *DAYLIST,
 		       short int *I2MAG) {
 
   // interpolate mag at epoch T.
-  
-  double mag, DAY, DAYFRAC, DAYSTEP, m0, m1 ;
-  int    row, ROW ;
+  //
+  // Aug 2026: binary search over the sorted DAY list replaces the
+  // scan from row 0; the DAY sequence is validated to be increasing
+  // when each event is read, so the bin found here is identical.
+
+  double mag, DAYFRAC, DAYSTEP, m0, m1 ;
+  int    row, ROW, lo, hi, mid ;
   char fnam[] = "magInterp_LCLIB" ;
 
   // --------------- BEGIN ---------------
 
-  // find DAYLIST bin containing T
-  row=0;    DAY = DAYLIST[row] ;
-  while ( DAY < (T+1.0E-5) && row < NROW-1 ) 
-    { row++ ;   DAY = DAYLIST[row];   }
+  // find first row with DAYLIST >= T (clamped to NROW-1)
+  lo = 0 ;  hi = NROW-1 ;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2 ;
+    if ( DAYLIST[mid] < (T+1.0E-5) ) { lo = mid+1; } else { hi = mid; }
+  }
+  row = lo ;
 
   ROW = row-1;
   if ( ROW < 0 || ROW >= NROW ) {
@@ -71,7 +71,7 @@ void init_genmag_NON1ASED(int isparse, INPUTS_NON1ASED_DEF *INP_NON1ASED) {
 
   double UVLAM     = INPUTS_SEDMODEL.UVLAM_EXTRAPFLUX ;
   int   DO_GENGRID = ( INP_NON1ASED->IFLAG_GEN == IFLAG_GENGRID ) ;
-  int ifilt, ifilt_obs, NZBIN, NON1A_INDEX ;
+  int ifilt, ifilt_obs, NZBIN, NON1A_INDEX, RDFLAG_BINARY ;
   double Trange[2], Lrange[2] ;
   char sedcomment[40], *sedFile ;
   //  char fnam[] = "init_genmag_NON1ASED"  ;
@@ -131,28 +131,44 @@ void init_genmag_NON1ASED(int isparse, INPUTS_NON1ASED_DEF *INP_NON1ASED) {
 
   sprintf(sedcomment,"NON1A-%3.3d", NON1A_INDEX );
 
-  rd_sedFlux(sedFile, sedcomment, Trange, Lrange
-	     ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL
-	     ,SEDMODEL.OPTMASK
-	     ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
-	     ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
-	     ,TEMP_SEDMODEL.FLUX,  TEMP_SEDMODEL.FLUXERR );
-
-  if ( UVLAM > 0.0 ) { UVLAM_EXTRAPFLUX_SEDMODEL(UVLAM, &TEMP_SEDMODEL); } 
+  // check option to read prepared template from binary cache (Aug 2026)
+  RDFLAG_BINARY = 0 ;
+  if ( INP_NON1ASED->OPT_BINARY )
+    { RDFLAG_BINARY = rd_NON1ASED_BINARY(sedFile, sedcomment,
+					 Trange, Lrange); }
+
+  if ( RDFLAG_BINARY == 0 ) {
+    rd_sedFlux(sedFile, sedcomment, Trange, Lrange
+	       ,MXBIN_DAYSED_SEDMODEL, MXBIN_LAMSED_SEDMODEL
+	       ,SEDMODEL.OPTMASK
+	       ,&TEMP_SEDMODEL.NDAY, TEMP_SEDMODEL.DAY, &TEMP_SEDMODEL.DAYSTEP
+	       ,&TEMP_SEDMODEL.NLAM, TEMP_SEDMODEL.LAM, &TEMP_SEDMODEL.LAMSTEP
+	       ,TEMP_SEDMODEL.FLUX,  TEMP_SEDMODEL.FLUXERR );
+
+    if ( UVLAM > 0.0 ) { UVLAM_EXTRAPFLUX_SEDMODEL(UVLAM, &TEMP_SEDMODEL); }
+  }
 
-  SEDMODEL.LAMSTEP[0]          = TEMP_SEDMODEL.LAMSTEP ; // Nov 17 2016  
-  SEDMODEL.LAMSTEP[ISED_NON1A] = TEMP_SEDMODEL.LAMSTEP ; // Nov 17 2016  
+  SEDMODEL.LAMSTEP[0]          = TEMP_SEDMODEL.LAMSTEP ; // Nov 17 2016
+  SEDMODEL.LAMSTEP[ISED_NON1A] = TEMP_SEDMODEL.LAMSTEP ; // Nov 17 2016
   SEDMODEL.FLUXSCALE           = INP_NON1ASED->FLUXSCALE[NON1A_INDEX] ;
 
-  // make sure that DAY=0 at peak (Oct 30 2014)
+  if ( RDFLAG_BINARY == 0 ) {
 
-  int OPTMASK_EXPLODE = INPUTS_SEDMODEL.OPTMASK_T0SHIFT_EXPLODE ;
-  int OPTMASK_PEAKMAG = ( SEDMODEL.OPTMASK & OPTMASK_T0SHIFT_PEAKMAG ) ;  
-  if ( OPTMASK_EXPLODE >= 0 ) {
-    T0shiftExplode_SEDMODEL(OPTMASK_EXPLODE, &TEMP_SEDMODEL, 1); 
-  }
-  else if ( OPTMASK_PEAKMAG > 0 ) {
-    T0shiftPeak_SEDMODEL(&TEMP_SEDMODEL,1); 
+    // make sure that DAY=0 at peak (Oct 30 2014)
+
+    int OPTMASK_EXPLODE = INPUTS_SEDMODEL.OPTMASK_T0SHIFT_EXPLODE ;
+    int OPTMASK_PEAKMAG = ( SEDMODEL.OPTMASK & OPTMASK_T0SHIFT_PEAKMAG ) ;
+    if ( OPTMASK_EXPLODE >= 0 ) {
+      T0shiftExplode_SEDMODEL(OPTMASK_EXPLODE, &TEMP_SEDMODEL, 1);
+    }
+    else if ( OPTMASK_PEAKMAG > 0 ) {
+      T0shiftPeak_SEDMODEL(&TEMP_SEDMODEL,1);
+    }
+
+    // update cache with prepared (rebinned+shifted) template so that
+    // the next job skips the slow text-read above
+    if ( INP_NON1ASED->OPT_BINARY )
+      { wr_NON1ASED_BINARY(sedFile, Trange, Lrange); }
   }
 
 
@@ -172,6 +188,156 @@ void init_genmag_NON1ASED(int isparse, INPUTS_NON1ASED_DEF *INP_NON1ASED) {
 } // end of init_genmag_NON1ASED
 
 
+// *****************************************
+long size_SED_FILE_NON1ASED(char *sedFile) {
+
+  // Created Aug 2026
+  // Return size (bytes) of sedFile, or of gzipped sedFile;
+  // returns zero if neither exists. Used as staleness key
+  // for the binary template cache.
+
+  long SEDSIZE = 0 ;
+  char sedFile_gz[MXPATHLEN];
+  struct stat statbuf ;
+
+  // ----------- BEGIN -----------
+
+  if ( stat(sedFile, &statbuf) == 0 )
+    { SEDSIZE = (long)statbuf.st_size ; }
+  else {
+    sprintf(sedFile_gz, "%s.gz", sedFile );
+    if ( stat(sedFile_gz, &statbuf) == 0 )
+      { SEDSIZE = (long)statbuf.st_size ; }
+  }
+
+  return(SEDSIZE);
+
+} // end size_SED_FILE_NON1ASED
+
+
+// *****************************************
+int rd_NON1ASED_BINARY(char *sedFile, char *sedComment,
+		       double *Trange, double *Lrange) {
+
+  // Created Aug 2026
+  // Try to read prepared (rebinned & T0-shifted) template from
+  // binary cache <sedFile>.BINARY and unpack into TEMP_SEDMODEL,
+  // skipping the slow text-read in rd_sedFlux.
+  //
+  // The cache header is keyed on the rebin options (Trange, Lrange,
+  // SEDMODEL.OPTMASK, UVLAM, T0-shift option) and on the size of the
+  // source SED file; any mismatch means the cache is stale and this
+  // function quietly returns 0 so that the caller re-reads the text
+  // file and re-writes the cache.
+  //
+  // Function returns 1 if TEMP_SEDMODEL is filled from cache.
+
+  double UVLAM = INPUTS_SEDMODEL.UVLAM_EXTRAPFLUX ;
+  int    OPTMASK_EXPLODE = INPUTS_SEDMODEL.OPTMASK_T0SHIFT_EXPLODE ;
+
+  int  IVER, OPTMASK, OPTEXP, NRD, MATCH ;
+  long SEDSIZE, SEDSIZE_RD ;
+  double Trange_RD[2], Lrange_RD[2], UVLAM_RD ;
+  char binFile[MXPATHLEN];
+  FILE *fpbin ;
+  //  char fnam[] = "rd_NON1ASED_BINARY" ;
+
+  // ----------- BEGIN -----------
+
+  sprintf(binFile, "%s.BINARY", sedFile );
+  fpbin = fopen(binFile,"rb");
+  if ( fpbin == NULL ) { return 0; }
+
+  SEDSIZE = size_SED_FILE_NON1ASED(sedFile);
+
+  NRD  = fread(&IVER,       sizeof(int),    1, fpbin );
+  NRD += fread(&OPTMASK,    sizeof(int),    1, fpbin );
+  NRD += fread(&OPTEXP,     sizeof(int),    1, fpbin );
+  NRD += fread( Trange_RD,  sizeof(double), 2, fpbin );
+  NRD += fread( Lrange_RD,  sizeof(double), 2, fpbin );
+  NRD += fread(&UVLAM_RD,   sizeof(double), 1, fpbin );
+  NRD += fread(&SEDSIZE_RD, sizeof(long),   1, fpbin );
+
+  MATCH = ( NRD == 9
+	    && IVER       == IVERSION_NON1ASED_BINARY
+	    && OPTMASK    == SEDMODEL.OPTMASK
+	    && OPTEXP     == OPTMASK_EXPLODE
+	    && Trange_RD[0] == Trange[0] && Trange_RD[1] == Trange[1]
+	    && Lrange_RD[0] == Lrange[0] && Lrange_RD[1] == Lrange[1]
+	    && UVLAM_RD   == UVLAM
+	    && SEDSIZE_RD == SEDSIZE  &&  SEDSIZE > 0 );
+
+  if ( !MATCH ) { fclose(fpbin); return 0; }
+
+  NRD = fread(&NSEDBINARY, sizeof(int), 1, fpbin );
+  if ( NRD != 1 || NSEDBINARY <= 0 || NSEDBINARY > MXBIN_SED_SEDMODEL )
+    { fclose(fpbin); return 0; }
+
+  NRD = fread(SEDBINARY, sizeof(float), NSEDBINARY, fpbin );
+  fclose(fpbin);
+  if ( NRD != NSEDBINARY ) { return 0; }
+
+  pack_SEDBINARY(-1);  // transfer SEDBINARY to TEMP_SEDMODEL struct
+
+  printf("  Read %s template from binary cache. \n", sedComment );
+  fflush(stdout);
+
+  return 1;
+
+} // end rd_NON1ASED_BINARY
+
+
+// *****************************************
+void wr_NON1ASED_BINARY(char *sedFile, double *Trange, double *Lrange) {
+
+  // Created Aug 2026
+  // Write prepared template (TEMP_SEDMODEL) to binary cache
+  // <sedFile>.BINARY; see rd_NON1ASED_BINARY for the header key.
+  // Write to temp file and rename so that concurrent jobs never
+  // see a partial cache; quietly give up if the model directory
+  // is not writeable.
+
+  double UVLAM = INPUTS_SEDMODEL.UVLAM_EXTRAPFLUX ;
+  int    OPTMASK_EXPLODE = INPUTS_SEDMODEL.OPTMASK_T0SHIFT_EXPLODE ;
+
+  int  IVER = IVERSION_NON1ASED_BINARY ;
+  long SEDSIZE ;
+  char binFile[MXPATHLEN], binFile_tmp[MXPATHLEN];
+  FILE *fpbin ;
+  //  char fnam[] = "wr_NON1ASED_BINARY" ;
+
+  // ----------- BEGIN -----------
+
+  SEDSIZE = size_SED_FILE_NON1ASED(sedFile);
+  if ( SEDSIZE == 0 ) { return; }
+
+  sprintf(binFile,     "%s.BINARY",      sedFile );
+  sprintf(binFile_tmp, "%s.BINARY_tmp%d", sedFile, getpid() );
+
+  fpbin = fopen(binFile_tmp,"wb");
+  if ( fpbin == NULL ) { return; }   // e.g., read-only model dir
+
+  pack_SEDBINARY(+1);   // transfer TEMP_SEDMODEL to SEDBINARY array
+
+  fwrite(&IVER,            sizeof(int),    1, fpbin );
+  fwrite(&SEDMODEL.OPTMASK,sizeof(int),    1, fpbin );
+  fwrite(&OPTMASK_EXPLODE, sizeof(int),    1, fpbin );
+  fwrite( Trange,          sizeof(double), 2, fpbin );
+  fwrite( Lrange,          sizeof(double), 2, fpbin );
+  fwrite(&UVLAM,           sizeof(double), 1, fpbin );
+  fwrite(&SEDSIZE,         sizeof(long),   1, fpbin );
+
+  fwrite(&NSEDBINARY, sizeof(int),   1,          fpbin );
+  fwrite( SEDBINARY,  sizeof(float), NSEDBINARY, fpbin );
+
+  fclose(fpbin);
+  rename(binFile_tmp, binFile);
+
+  return ;
+
+} // end wr_NON1ASED_BINARY
+
+
 // *****************************************
 void genmag_NON1ASED (
 		   int index             // (I) NON1A class
@@ -22,6 +22,13 @@ void copy_NON1ASED(int i1, int i2,
 // xxx mark delete void init_genmag_NON1ASED(int NON1A_INDEX, char *sedFile ) ;
 void init_genmag_NON1ASED(int isparse, INPUTS_NON1ASED_DEF *INP_NON1ASED);
 
+// Aug 2026: binary cache of prepared templates (GENMODEL_MSKOPT bit0)
+#define IVERSION_NON1ASED_BINARY 1
+long size_SED_FILE_NON1ASED(char *sedFile);
+int  rd_NON1ASED_BINARY(char *sedFile, char *sedComment,
+			double *Trange, double *Lrange);
+void wr_NON1ASED_BINARY(char *sedFile, double *Trange, double *Lrange);
+
 void genmag_NON1ASED ( int index, int ifilt_obs, 
 		       double mwebv,  double z, double x0,
 		       double RVhost, double AVhost,
@@ -29,9 +29,14 @@
   Feb 20 2021 RK - fix bug in genmag_PySEDMODEL that was preventing
                    BYOSED params from being returned.
 
-  Mar 19 2021 RK - pass "RANSEED <ISEED>" via ARGLIST to 
+  Mar 19 2021 RK - pass "RANSEED <ISEED>" via ARGLIST to
             init_genmag_PySEDMODEL.
 
+  Aug 2026 - cache fetched SEDs per event (see SEDCACHE_PySEDMODEL)
+            so that each Trest crosses the C-Python boundary once
+            per event instead of once per filter; interpreter
+            round-trips dominate Python-model sims.
+
  *****************************************/
 
 #include  <stdio.h> 
@@ -324,8 +329,9 @@ void genmag_PySEDMODEL(int EXTERNAL_ID, double zHEL, double zCMB, double MU,
   int    NEWEVT_FLAG_TMP ;
   int    DUMPFLAG_HOSTPAR = 0 ; 
 
-  int    NLAM, o, ipar ;
-  double Tobs, Trest, FLUXSUM_OBS, FspecDUM[2], magobs ; 
+  int    NLAM, o, ipar, iep, icache, NEP, MEMD ;
+  double Tobs, Trest, FLUXSUM_OBS, FspecDUM[2], magobs ;
+  double *ptrLAM, *ptrSED ;
   char   pyFORMAT_STRING_HOSTPAR[100] ;;
   char fnam[] = "genmag_PySEDMODEL" ;
 
@@ -344,6 +350,15 @@ void genmag_PySEDMODEL(int EXTERNAL_ID, double zHEL, double zCMB, double MU,
   if ( EXTERNAL_ID != Event_PySEDMODEL.LAST_EXTERNAL_ID )
     { NEWEVT_FLAG=1; }
 
+  // Aug 2026: new event -> discard SEDs cached for previous event
+  if ( NEWEVT_FLAG ) {
+    for(iep=0; iep < SEDCACHE_PySEDMODEL.NEP; iep++ ) {
+      free(SEDCACHE_PySEDMODEL.LAM_LIST[iep]);
+      free(SEDCACHE_PySEDMODEL.SED_LIST[iep]);
+    }
+    SEDCACHE_PySEDMODEL.NEP = 0 ;
+  }
+
 
   // RK - check internal flag to dump host params
   if ( DUMPFLAG_HOSTPAR && NEWEVT_FLAG ) {
@@ -386,21 +401,49 @@ void genmag_PySEDMODEL(int EXTERNAL_ID, double zHEL, double zCMB, double MU,
   for(o=0; o < NOBS; o++ ) {
     Tobs  = TOBS_list[o];
     Trest = Tobs/z1;
-    if (o == 0 ) 
+    if (o == 0 )
       { NEWEVT_FLAG_TMP = NEWEVT_FLAG; }
     else
       { NEWEVT_FLAG_TMP = 0; }
-    
-    fetchSED_PySEDMODEL(EXTERNAL_ID, NEWEVT_FLAG_TMP, Trest, 
-			MXLAM_PySEDMODEL, HOSTPAR_LIST, &NLAM, LAM, SED, 
-			pyFORMAT_STRING_HOSTPAR);  
+
+    // Aug 2026: check if an earlier filter already fetched the SED
+    // at this Trest; if so, skip the C-Python round trip.
+    icache = -9 ;  NEP = SEDCACHE_PySEDMODEL.NEP ;
+    for(iep=0; iep < NEP; iep++ ) {
+      if ( fabs(SEDCACHE_PySEDMODEL.TREST_LIST[iep] - Trest) < 1.0E-9 )
+	{ icache = iep ;  break ; }
+    }
+
+    if ( icache >= 0 ) {
+      NLAM   = SEDCACHE_PySEDMODEL.NLAM_LIST[icache] ;
+      ptrLAM = SEDCACHE_PySEDMODEL.LAM_LIST[icache] ;
+      ptrSED = SEDCACHE_PySEDMODEL.SED_LIST[icache] ;
+    }
+    else {
+      fetchSED_PySEDMODEL(EXTERNAL_ID, NEWEVT_FLAG_TMP, Trest,
+			  MXLAM_PySEDMODEL, HOSTPAR_LIST, &NLAM, LAM, SED,
+			  pyFORMAT_STRING_HOSTPAR);
+      ptrLAM = LAM ;  ptrSED = SED ;
+
+      // store copy for remaining filters of this event
+      if ( NEP < MXEP_SEDCACHE_PySEDMODEL ) {
+	MEMD = NLAM * sizeof(double);
+	SEDCACHE_PySEDMODEL.TREST_LIST[NEP] = Trest ;
+	SEDCACHE_PySEDMODEL.NLAM_LIST[NEP]  = NLAM ;
+	SEDCACHE_PySEDMODEL.LAM_LIST[NEP]   = (double*)malloc(MEMD);
+	SEDCACHE_PySEDMODEL.SED_LIST[NEP]   = (double*)malloc(MEMD);
+	memcpy(SEDCACHE_PySEDMODEL.LAM_LIST[NEP], LAM, MEMD);
+	memcpy(SEDCACHE_PySEDMODEL.SED_LIST[NEP], SED, MEMD);
+	SEDCACHE_PySEDMODEL.NEP++ ;
+      }
+    }
     Event_PySEDMODEL.NLAM = NLAM ;
 
     // integrate redshifted SED to get observer-frame flux in IFILT_OBS band.
     // FLUXSUM_OBS is returned (ignore FspecDUM)
-    INTEG_zSED_PySEDMODEL(0, IFILT_OBS, Tobs, zHEL, x0,RV_host,AV_host, 
-			  NLAM, LAM, SED, 
-			  &FLUXSUM_OBS, FspecDUM ); // <= returned 
+    INTEG_zSED_PySEDMODEL(0, IFILT_OBS, Tobs, zHEL, x0,RV_host,AV_host,
+			  NLAM, ptrLAM, ptrSED,
+			  &FLUXSUM_OBS, FspecDUM ); // <= returned
 
     // convert calibrated flux into true magnitude
     if ( FLUXSUM_OBS > FLUXSUM_MIN ) 
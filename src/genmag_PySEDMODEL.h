@@ -41,6 +41,20 @@ struct {
 } Event_PySEDMODEL ;
 
 
+// Aug 2026: per-event cache of fetched SEDs. The sim calls
+// genmag_PySEDMODEL once per filter, so without the cache the same
+// Trest crosses the C-Python boundary once per filter; with it,
+// once per event. Cache is reset on each new EXTERNAL_ID.
+#define MXEP_SEDCACHE_PySEDMODEL 100
+struct {
+  int     NEP ;                                  // cached epochs
+  double  TREST_LIST[MXEP_SEDCACHE_PySEDMODEL] ;
+  int     NLAM_LIST[MXEP_SEDCACHE_PySEDMODEL] ;
+  double *LAM_LIST[MXEP_SEDCACHE_PySEDMODEL] ;   // malloc per slot
+  double *SED_LIST[MXEP_SEDCACHE_PySEDMODEL] ;
+} SEDCACHE_PySEDMODEL ;
+
+
 // ===========================================
 // function declarations
 void load_PySEDMODEL_CHOICE_LIST(void);
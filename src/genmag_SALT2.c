@@ -213,7 +213,7 @@ int init_genmag_SALT2(char *MODEL_VERSION, char *MODEL_EXTRAP_LATETIME,
 		      int OPTMASK) {
 
   double Trange[2], Lrange[2];
-  int  ised;
+  int  ised, ifilt;
   int  retval = 0   ;
   int  ABORT_on_LAMRANGE_ERROR = 0;
   int  ABORT_on_BADVALUE_ERROR = 1;
@@ -240,10 +240,21 @@ int init_genmag_SALT2(char *MODEL_VERSION, char *MODEL_EXTRAP_LATETIME,
   ALLOW_NEGFLUX_SALT2 = true;      // default
   if ( OPTMASK & OPTMASK_SALT2_NONEGFLUX ) {
     // Mar 24 2021: if "GENMODEL_MSKOPT: 16"
-    ALLOW_NEGFLUX_SALT2 = false ;    
+    ALLOW_NEGFLUX_SALT2 = false ;
     printf("\t OPTMASK=%d -> Force neg Flam to Flam=0\n", OPTMASK);
   }
 
+  FINTEG_CACHE_SALT2.USE = false ;
+  if ( OPTMASK & OPTMASK_SALT2_FINTEG_CACHE ) {
+    // Aug 2026: if "GENMODEL_MSKOPT: 256"
+    init_FINTEG_CACHE_SALT2();
+  }
+
+  // Aug 2026: invalidate per-filter rest-frame lambda maps in case
+  // filters are re-defined; see prep_LAMMAP_INTEG_SALT2().
+  for(ifilt=0; ifilt < MXFILT_SEDMODEL; ifilt++ )
+    { FILTER_LAMMAP_SALT2[ifilt].z = -9.0 ; }
+
   // summarize filter info
   filtdump_SEDMODEL();
 
@@ -758,8 +769,8 @@ void fill_SALT2_TABLE_COLORLAW(void) {
   // color and rest-frame wavelength. The lambda bins
   // are the same bins as for the SED.
 
-  int NLAMSED, NCBIN, ilam, ic, I8, I8p;
-  double LAM, CMIN, CMAX, CSTEP, CVAL, xc, CCOR ;
+  int NLAMSED, NCBIN, ic, I8, I8p;
+  double CMIN, CMAX, CSTEP, CVAL, xc ;
 
   char fnam[] = "fill_SALT2_TABLE_COLORLAW";
   
@@ -798,11 +809,9 @@ void fill_SALT2_TABLE_COLORLAW(void) {
     SALT2_TABLE.COLOR[ic] = CVAL ;
     SALT2_TABLE.COLORLAW[ic] = (double*)malloc(I8*NLAMSED);
 
-    for ( ilam=0; ilam < NLAMSED; ilam++ ) {
-      LAM  = SALT2_TABLE.LAMSED[ilam];
-      CCOR = SALT2colorCor(LAM,CVAL);
-      SALT2_TABLE.COLORLAW[ic][ilam] = CCOR ;
-    } // ilam
+    // batch kernel evaluates colorlaw over contiguous LAMSED array
+    SALT2colorCor_batch(NLAMSED, SALT2_TABLE.LAMSED, CVAL,
+			SALT2_TABLE.COLORLAW[ic] );
   } //  ic
 
   // sanity checks on color-table
@@ -918,6 +927,28 @@ void read_SALT2errmaps(double Trange[2], double Lrange[2] ) {
 
   }   //  imap
 
+  // Aug 2026: check if all maps share the same Trest/lambda binning;
+  // if so, get_SALT2_ERRMAP computes bilinear indices & weights once
+  // per query and reuses them for every map.
+  ERRMAP_SHARE_BINNING_SALT2 = true ;
+  for ( imap=1; imap < INDEX_ERRMAP_COLORDISP; imap++ ) {
+    if ( SALT2_ERRMAP[imap].NDAY != SALT2_ERRMAP[0].NDAY )
+      { ERRMAP_SHARE_BINNING_SALT2 = false ; }
+    if ( SALT2_ERRMAP[imap].NLAM != SALT2_ERRMAP[0].NLAM )
+      { ERRMAP_SHARE_BINNING_SALT2 = false ; }
+    if ( fabs(SALT2_ERRMAP[imap].DAYMIN - SALT2_ERRMAP[0].DAYMIN) > 1.0E-6 )
+      { ERRMAP_SHARE_BINNING_SALT2 = false ; }
+    if ( fabs(SALT2_ERRMAP[imap].LAMMIN - SALT2_ERRMAP[0].LAMMIN) > 1.0E-6 )
+      { ERRMAP_SHARE_BINNING_SALT2 = false ; }
+    if ( fabs(SALT2_ERRMAP[imap].DAYSTEP - SALT2_ERRMAP[0].DAYSTEP) > 1.0E-6 )
+      { ERRMAP_SHARE_BINNING_SALT2 = false ; }
+    if ( fabs(SALT2_ERRMAP[imap].LAMSTEP - SALT2_ERRMAP[0].LAMSTEP) > 1.0E-6 )
+      { ERRMAP_SHARE_BINNING_SALT2 = false ; }
+  }
+  if ( ERRMAP_SHARE_BINNING_SALT2 ) {
+    printf("\t Error maps share Trest/lam binning -> "
+	   "single bin-search per query.\n");  fflush(stdout);
+  }
 
 } // end of read_SALT2errmaps
 
@@ -2130,6 +2161,87 @@ double SALT2colorCor(double lam_rest, double c ) {
 } // end of SALT2colorCor
 
 
+// **********************************************
+void SALT2colorCor_batch(int NLAM, double *lam_rest, double c,
+			 double *ccor ) {
+
+  // Created Aug 2026
+  // Batch variant of SALT2colorCor: evaluate colorlaw flux
+  // correction for contiguous array of NLAM rest wavelengths and
+  // fill *ccor. Colorlaw-version dispatch, parameter unpacking and
+  // sanity checks are hoisted out of the wavelength loop (the first
+  // element goes through the checked scalar function) so that the
+  // remaining loop is tight enough for the compiler to vectorize.
+
+  int    IVER = INPUT_SALT2_INFO.COLORLAW_VERSION ;
+  double cc   = c - INPUT_SALT2_INFO.COLOR_OFFSET ;
+  double *colorPar = INPUT_SALT2_INFO.COLORLAW_PARAMS ;
+  double lam, lr, val ;
+  int    ilam ;
+  char fnam[] = "SALT2colorCor_batch" ;
+
+  // -------- BEGIN ---------
+
+  if ( NLAM <= 0 ) { return ; }
+
+  // scalar call for first element runs all sanity checks
+  // (and the abort for invalid COLORLAW_VERSION)
+  ccor[0] = SALT2colorCor(lam_rest[0], c);
+
+  if ( IVER == 0 ) {
+    double LAM_B = colorPar[0] ;
+    double LAM_V = colorPar[1] ;
+    double COR0  = colorPar[2] ;
+    double COR1  = colorPar[3] ;
+    double denominator = 1.0 + COR0 + COR1 ;
+
+    for ( ilam=1; ilam < NLAM; ilam++ ) {
+      lr  = (lam_rest[ilam] - LAM_B)/( LAM_V - LAM_B );
+      val = ( lr + lr*lr*COR0 + lr*lr*lr*COR1 ) / denominator ;
+      ccor[ilam] = pow(10.0, 0.4 * cc * val );
+    }
+  }
+  else if ( IVER == 1 ) {
+    double LAM_B   = colorPar[ICLPAR_REFLAM_CL0] ;
+    double LAM_V   = colorPar[ICLPAR_REFLAM_CL1] ;
+    double LAM_MIN = colorPar[ICLPAR_LAM_MIN] ;
+    double LAM_MAX = colorPar[ICLPAR_LAM_MAX] ;
+    int    nparams = (int)colorPar[ICLPAR_NPAR_POLY] ;
+    double *params = &colorPar[ICLPAR_POLY] ;
+    double constant = log(10.0)/2.5 ;
+    double alpha    = 1.0 ;
+    int    i ;
+
+    for ( i=0; i < nparams; i++ ) { alpha -= params[i] ; }
+
+    // pre-compute UV/IR linear-extrapolation constants
+    double rlmin = (LAM_MIN - LAM_B) / ( LAM_V - LAM_B );
+    double rlmax = (LAM_MAX - LAM_B) / ( LAM_V - LAM_B );
+    double Pmin  = SALT2colorfun_pol (rlmin, nparams, params, alpha);
+    double dPmin = SALT2colorfun_dpol(rlmin, nparams, params, alpha);
+    double Pmax  = SALT2colorfun_pol (rlmax, nparams, params, alpha);
+    double dPmax = SALT2colorfun_dpol(rlmax, nparams, params, alpha);
+
+    for ( ilam=1; ilam < NLAM; ilam++ ) {
+      lam = lam_rest[ilam] ;
+      lr  = (lam - LAM_B) / ( LAM_V - LAM_B );
+
+      if ( lam >= LAM_MIN && lam <= LAM_MAX )
+	{ val = SALT2colorfun_pol(lr, nparams, params, alpha) ; }
+      else if ( lam < LAM_MIN )
+	{ val = Pmin + dPmin*(lr - rlmin) ; }   // extrapolate to UV
+      else
+	{ val = Pmax + dPmax*(lr - rlmax) ; }   // extrapolate to IR
+
+      ccor[ilam] = exp(cc * constant * val);
+    }
+  }
+
+  return ;
+
+} // end of SALT2colorCor_batch
+
+
 
 // ****************************************************************
 void genmag_SALT2(
@@ -2636,6 +2748,11 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 
   int  DO_SPECTROGRAPH = ( ifilt_obs == JFILT_SPECTROGRAPH ) ;
 
+  long long icache = -9 ;
+  unsigned long long KEYCACHE = 0 ;
+  FINTEG_CACHE_ROW_SALT2 *ptrCache ;
+  FILTER_LAMMAP_SALT2_DEF *LAMMAP = NULL ;
+
   char *cfilt ;
   char fnam[] = "INTEG_zSED_SALT2" ;
 
@@ -2664,7 +2781,31 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
   MODELNORM_Fspec  = LAMFILT_STEP * SEDMODEL.FLUXSCALE ;
   MODELNORM_Finteg = LAMFILT_STEP * SEDMODEL.FLUXSCALE / hc8 ;
 
-  // for SED find rest-frame 'iday' and DAYFRAC used to 
+  // check option to re-use cached integrals for this quantized
+  // (filter,z,Trest,c,MWEBV) tuple; x0 and x1 are applied after
+  // the FINTEG_DONE label, so a hit skips only the lambda loop.
+  if ( FINTEG_CACHE_SALT2.USE ) {
+    icache = check_FINTEG_CACHE_SALT2(OPT_SPEC, ifilt_obs, z, Trest, c,
+				      RV_host, AV_host, &KEYCACHE );
+    if ( icache >= 0 ) {
+      ptrCache = &FINTEG_CACHE_SALT2.ROW[icache] ;
+      if ( ptrCache->KEY == KEYCACHE ) {
+	FINTEG_CACHE_SALT2.NHIT++ ;
+	for(ised=0; ised<2; ised++ ) {
+	  Finteg_filter[ised] = ptrCache->Finteg_filter[ised] ;
+	  Finteg_forErr[ised] = ptrCache->Finteg_forErr[ised] ;
+	}
+	Fnorm_SALT3 = ptrCache->Fnorm_SALT3 ;
+	goto FINTEG_DONE ;
+      }
+    }
+  }
+
+  // Aug 2026: for real filters, fetch obs->rest lambda mapping that
+  // is resampled once per (filter,z) instead of once per epoch.
+  if ( !DO_SPECTROGRAPH ) { LAMMAP = prep_LAMMAP_INTEG_SALT2(ifilt,z); }
+
+  // for SED find rest-frame 'iday' and DAYFRAC used to
   // interpolate SED in TREST-space.
   DAYSTEP = SALT2_TABLE.DAYSTEP ;
   DAYMIN  = SALT2_TABLE.DAY[0]  ;
@@ -2725,11 +2866,17 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 
   for ( ilamobs=0; ilamobs < NLAMFILT; ilamobs++ ) {
 
-    // fetch LAM and TRANS with utility to account for spectrograph
-    get_LAMTRANS_SEDMODEL(ifilt,ilamobs, &LAMOBS, &TRANS);
-    // xxx mark delete    TRANS  = FILTER_SEDMODEL[ifilt].transSN[ilamobs] ;
+    if ( LAMMAP != NULL ) {
+      // Aug 2026: filter grid pre-resampled onto SED lambda grid
+      LAMOBS = LAMMAP->LAMOBS[ilamobs] ;
+      TRANS  = LAMMAP->TRANS[ilamobs] ;
+    }
+    else {
+      // fetch LAM and TRANS with utility to account for spectrograph
+      get_LAMTRANS_SEDMODEL(ifilt,ilamobs, &LAMOBS, &TRANS);
+    }
 
-    if ( TRANS < 1.0E-12 && OPT_SPEC==0) 
+    if ( TRANS < 1.0E-12 && OPT_SPEC==0)
       { continue ; } // Jul 2013 - skip zeros for leakage
 
     MWXT_FRAC  = SEDMODEL_TABLE_MWXT_FRAC[ifilt][ilamobs] ;
@@ -2740,13 +2887,17 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
     else 
       { HOSTXT_FRAC = 1.0 ; } // standard SALT2 model has no host extinction
 
-    // xxx    LAMOBS     = FILTER_SEDMODEL[ifilt].lam[ilamobs] ;
-    LAMSED     = LAMOBS / z1 ;  // rest-frame lambda
-    LAMSED_MIN = LAMSED_MAX = LAMSED ;  // default is no sub-bins 
-
-    // Jan 2021: bail if outside model range 
-    if ( LAMSED <= SALT2_TABLE.LAMMIN ) { continue ; }
-    if ( LAMSED >= SALT2_TABLE.LAMMAX ) { continue ; } 
+    if ( LAMMAP != NULL ) {
+      LAMSED = LAMMAP->LAMSED[ilamobs] ;   // rest-frame lambda
+      if ( LAMMAP->ILAMSED[ilamobs] < 0 ) { continue ; } // outside model
+    }
+    else {
+      LAMSED = LAMOBS / z1 ;  // rest-frame lambda
+      // Jan 2021: bail if outside model range
+      if ( LAMSED <= SALT2_TABLE.LAMMIN ) { continue ; }
+      if ( LAMSED >= SALT2_TABLE.LAMMAX ) { continue ; }
+    }
+    LAMSED_MIN = LAMSED_MAX = LAMSED ;  // default is no sub-bins
 
     LDMP = 0; // (OPT_SPEC>0 && ifilt_obs==2 );
 
@@ -2767,11 +2918,18 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
       if ( LAMSED <= SALT2_TABLE.LAMMIN ) { continue ; }
       if ( LAMSED >= SALT2_TABLE.LAMMAX ) { continue ; } 
 
-      // get rest-frame lambda index and interp-fraction for SED space
-      LAMDIF  = LAMSED - SALT2_TABLE.LAMMIN ;
-      ilamsed = (int)(LAMDIF/LAMSED_STEP);
-      LAMDIF  = LAMSED - SALT2_TABLE.LAMSED[ilamsed] ;
-      FRAC_INTERP_LAMSED = LAMDIF / LAMSED_STEP ; // 0-1
+      if ( LAMMAP != NULL ) {
+	// Aug 2026: index and fraction resampled once per (filter,z)
+	ilamsed            = LAMMAP->ILAMSED[ilamobs] ;
+	FRAC_INTERP_LAMSED = LAMMAP->FRAC_INTERP[ilamobs] ;
+      }
+      else {
+	// get rest-frame lambda index and interp-fraction for SED space
+	LAMDIF  = LAMSED - SALT2_TABLE.LAMMIN ;
+	ilamsed = (int)(LAMDIF/LAMSED_STEP);
+	LAMDIF  = LAMSED - SALT2_TABLE.LAMSED[ilamsed] ;
+	FRAC_INTERP_LAMSED = LAMDIF / LAMSED_STEP ; // 0-1
+      }
 
       if ( LDMP ) { 
 	printf(" xxx -------------- %s DUMP ------------- \n", fnam ); 
@@ -2901,7 +3059,20 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 
   } // end ilamobs loop over obs filter
 
-  // - - - - - - - - - - 
+  // cache integrals for next epoch with same quantized tuple
+  if ( icache >= 0 ) {
+    ptrCache = &FINTEG_CACHE_SALT2.ROW[icache] ;
+    ptrCache->KEY = KEYCACHE ;
+    for(ised=0; ised<2; ised++ ) {
+      ptrCache->Finteg_filter[ised] = Finteg_filter[ised] ;
+      ptrCache->Finteg_forErr[ised] = Finteg_forErr[ised] ;
+    }
+    ptrCache->Fnorm_SALT3 = Fnorm_SALT3 ;
+  }
+
+ FINTEG_DONE:
+
+  // - - - - - - - - - -
   // compute total flux in filter
   *Finteg  = x0 * ( Finteg_filter[0] + x1 * Finteg_filter[1] );
   *Finteg *= MODELNORM_Finteg ;
@@ -2925,6 +3096,185 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 } // end of INTEG_zSED_SALT2
 
 
+// **********************************************
+void init_FINTEG_CACHE_SALT2(void) {
+
+  // Created Aug 2026
+  // Malloc and zero the hash table used to memoize the
+  // filter-projected flux integrals of INTEG_zSED_SALT2 over
+  // quantized (filter,z,Trest,c,MWEBV) tuples. Production runs
+  // generate millions of epochs with nearly identical tuples,
+  // so caching the lambda integral gives a large CPU saving.
+  // Enabled with "GENMODEL_MSKOPT: 256".
+
+  long long MEMTOT ;
+  char fnam[] = "init_FINTEG_CACHE_SALT2" ;
+
+  // ----------- BEGIN ---------------
+
+  MEMTOT = (long long)NROW_FINTEG_CACHE_SALT2
+    * (long long)sizeof(FINTEG_CACHE_ROW_SALT2);
+
+  FINTEG_CACHE_SALT2.ROW =
+    (FINTEG_CACHE_ROW_SALT2*) malloc_largeTable((size_t)MEMTOT);
+
+  if ( FINTEG_CACHE_SALT2.ROW == NULL ) {
+    sprintf(c1err,"Could not malloc %lld MB for Finteg cache",
+	    MEMTOT/1000000 );
+    sprintf(c2err,"Remove OPTMASK_SALT2_FINTEG_CACHE bit "
+	    "from GENMODEL_MSKOPT");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  memset(FINTEG_CACHE_SALT2.ROW, 0, MEMTOT);  // KEY=0 => empty rows
+  FINTEG_CACHE_SALT2.USE   = true ;
+  FINTEG_CACHE_SALT2.NCALL = FINTEG_CACHE_SALT2.NHIT = 0 ;
+
+  printf("\t Cache INTEG_zSED_SALT2 integrals (%lld MB) \n",
+	 MEMTOT/1000000 );
+  fflush(stdout);
+
+} // end init_FINTEG_CACHE_SALT2
+
+
+// **********************************************
+long long check_FINTEG_CACHE_SALT2(int OPT_SPEC, int ifilt_obs, double z,
+				   double Trest, double c,
+				   double RV_host, double AV_host,
+				   unsigned long long *KEY ) {
+
+  // Created Aug 2026
+  // Return hash-table row for the quantized tuple, or -9 if this
+  // call cannot be cached. The integrals are reusable only when
+  // they depend on nothing beyond (filter,z,Trest,c,MWEBV):
+  //  + no spectrum option
+  //  + no intrinsic-scatter (genSmear) model
+  //  + no host-galaxy extinction
+  //  + negative fluxes allowed (NONEGFLUX clipping depends on x1)
+  // Quantization steps (see genmag_SALT2.h) keep the model error
+  // well below a milli-mag.
+
+  double MWEBV = SEDMODEL_MWEBV_LAST ;
+  long long  iz, iT, ic, iE, hash ;
+
+  // ----------- BEGIN ---------------
+
+  FINTEG_CACHE_SALT2.NCALL++ ;
+
+  if ( OPT_SPEC > 0 )                        { return(-9); }
+  if ( istat_genSmear() )                    { return(-9); }
+  if ( RV_host > 1.0E-9 && AV_host > 1.0E-9 ){ return(-9); }
+  if ( !ALLOW_NEGFLUX_SALT2 )                { return(-9); }
+  if ( z     < 1.0E-9  )                     { return(-9); }
+  if ( MWEBV < 0.0     )                     { return(-9); }
+  if ( ifilt_obs < 1 || ifilt_obs >= 128 )   { return(-9); }
+
+  // quantize tuple; ln(z) binning keeps the relative-distance
+  // error constant over the full redshift range.
+  iz = (long long)( log(z)/DLOGZ_FINTEG_CACHE )        + 50000 ;
+  iT = (long long)( (Trest+200.0)/DTREST_FINTEG_CACHE  + 0.5 ) ;
+  ic = (long long)( (c+2.0)/DCOLOR_FINTEG_CACHE        + 0.5 ) ;
+  iE = (long long)( MWEBV/DMWEBV_FINTEG_CACHE          + 0.5 ) ;
+
+  if ( iz < 0 || iz >= 0x10000 ) { return(-9); }  // 16 bits
+  if ( iT < 0 || iT >= 0x2000  ) { return(-9); }  // 13 bits
+  if ( ic < 0 || ic >= 0x1000  ) { return(-9); }  // 12 bits
+  if ( iE < 0 || iE >= 0x1000  ) { return(-9); }  // 12 bits
+
+  // pack tuple; ifilt_obs>=1 guarantees KEY != 0
+  *KEY = (unsigned long long)ifilt_obs
+    | ( (unsigned long long)iz << 7  )
+    | ( (unsigned long long)iT << 23 )
+    | ( (unsigned long long)ic << 36 )
+    | ( (unsigned long long)iE << 48 ) ;
+
+  hash = (long long)( ( (*KEY) * 0x9E3779B97F4A7C15ULL ) >> 40 ) ;
+  return( hash & (NROW_FINTEG_CACHE_SALT2-1) );
+
+} // end check_FINTEG_CACHE_SALT2
+
+
+// **********************************************
+FILTER_LAMMAP_SALT2_DEF *prep_LAMMAP_INTEG_SALT2(int ifilt, double z) {
+
+  // Created Aug 2026
+  // Return map of obs-frame filter grid for 'ifilt' resampled onto
+  // the rest-frame SED lambda grid at redshift 'z'. For each filter
+  // bin the map stores the rest-frame lambda along with the SED
+  // lambda index and interp fraction; these depend only on (filter,z),
+  // so the map is rebuilt only when z changes and is re-used for
+  // every epoch of the same SN. Removes the per-epoch index
+  // arithmetic from the integration loop of INTEG_zSED_SALT2.
+
+  FILTER_LAMMAP_SALT2_DEF *MAP = &FILTER_LAMMAP_SALT2[ifilt] ;
+  int    NLAM        = FILTER_SEDMODEL[ifilt].NLAM ;
+  double z1          = 1.0 + z ;
+  double LAMSED_STEP = SALT2_TABLE.LAMSTEP ;
+  int    ilam, ilamsed, MEMD, MEMI ;
+  double LAMOBS, LAMSED, LAMDIF, FRAC ;
+  char fnam[] = "prep_LAMMAP_INTEG_SALT2" ;
+
+  // ----------- BEGIN ---------------
+
+  if ( MAP->z == z && MAP->NLAM == NLAM ) { return(MAP); }
+
+  if ( MAP->NLAM != NLAM ) {
+    if ( MAP->NLAM > 0 ) {
+      free(MAP->LAMOBS);  free(MAP->TRANS);   free(MAP->LAMSED);
+      free(MAP->ILAMSED); free(MAP->FRAC_INTERP);
+    }
+    MEMD = NLAM * sizeof(double);
+    MEMI = NLAM * sizeof(int);
+    MAP->LAMOBS      = (double*) malloc(MEMD);
+    MAP->TRANS       = (double*) malloc(MEMD);
+    MAP->LAMSED      = (double*) malloc(MEMD);
+    MAP->ILAMSED     = (int   *) malloc(MEMI);
+    MAP->FRAC_INTERP = (double*) malloc(MEMD);
+    MAP->NLAM        = NLAM ;
+  }
+
+  for(ilam=0; ilam < NLAM; ilam++ ) {
+
+    LAMOBS = FILTER_SEDMODEL[ifilt].lam[ilam] ;
+    LAMSED = LAMOBS / z1 ;   // rest-frame lambda
+
+    MAP->LAMOBS[ilam] = LAMOBS ;
+    MAP->TRANS[ilam]  = FILTER_SEDMODEL[ifilt].transSN[ilam] ;
+    MAP->LAMSED[ilam] = LAMSED ;
+
+    // flag bins outside the SED model range
+    if ( LAMSED <= SALT2_TABLE.LAMMIN || LAMSED >= SALT2_TABLE.LAMMAX ) {
+      MAP->ILAMSED[ilam]     = -9 ;
+      MAP->FRAC_INTERP[ilam] = 0.0 ;
+      continue ;
+    }
+
+    // rest-frame lambda index and interp fraction in SED space;
+    // same arithmetic as the original per-epoch loop.
+    LAMDIF  = LAMSED - SALT2_TABLE.LAMMIN ;
+    ilamsed = (int)(LAMDIF/LAMSED_STEP);
+    LAMDIF  = LAMSED - SALT2_TABLE.LAMSED[ilamsed] ;
+    FRAC    = LAMDIF / LAMSED_STEP ;   // 0-1
+
+    if ( FRAC < -1.0E-8 || FRAC > 1.0000000001 ) {
+      sprintf(c1err,"Invalid FRAC_INTERP_LAMSED=%le for %s",
+	      FRAC, FILTER_SEDMODEL[ifilt].name );
+      sprintf(c2err,"ilam=%d  LAMOBS=%.2f  LAMSED=%.2f  z=%.4f",
+	      ilam, LAMOBS, LAMSED, z );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    MAP->ILAMSED[ilam]     = ilamsed ;
+    MAP->FRAC_INTERP[ilam] = FRAC ;
+
+  } // end ilam
+
+  MAP->z = z ;
+  return(MAP);
+
+} // end prep_LAMMAP_INTEG_SALT2
+
+
 // **********************************************
 double SALT2x0calc(
 		   double alpha   // (I)
@@ -3010,12 +3360,18 @@ void get_SALT2_ERRMAP(double Trest, double Lrest, double *ERRMAP ) {
 
   Jun 2, 2011: renamed from get_SALT2modelerr to get_SALT2_ERRMAP().
 
-  Sep 9 2019: 
+  Sep 9 2019:
     + protect iday_min and ilam_min from being negative. Negative indices
       can occur because ERRMAPs don't always cover SED range.
-           
+
+  Aug 2026:
+    + if maps share Trest/lam binning (ERRMAP_SHARE_BINNING_SALT2,
+      checked in read_SALT2errmaps), compute the sandwich indices
+      once per query and reuse them for all maps.
+
   ***/
 
+  bool SHARE_BINNING = ERRMAP_SHARE_BINNING_SALT2 ;
   int imap, jval, iday_min, iday_max, ilam_min, ilam_max ;
   int NLAM, NDAY, IND, IERR ;
 
@@ -3026,6 +3382,8 @@ void get_SALT2_ERRMAP(double Trest, double Lrest, double *ERRMAP ) {
 
   // ------------ BEGIN --------
 
+  iday_min = iday_max = ilam_min = ilam_max = 0 ;
+
   for ( imap=0; imap < NERRMAP; imap++ ) {
 
     if ( imap >= INDEX_ERRMAP_COLORDISP ) { continue ; }
@@ -3039,20 +3397,23 @@ void get_SALT2_ERRMAP(double Trest, double Lrest, double *ERRMAP ) {
     NLAM  = SALT2_ERRMAP[imap].NLAM ;
     NDAY  = SALT2_ERRMAP[imap].NDAY ;
 
-    // get indices that sandwhich Trest and Lrest
+    // get indices that sandwhich Trest and Lrest;
+    // skip for imap>0 if all maps share the same binning (Aug 2026)
 
-    iday_min = (int)((Trest - TMIN)/TSTEP) ;
-    if ( iday_min >= NDAY-1 ) { iday_min = NDAY - 2 ; }
-    if ( iday_min <  0      ) { iday_min = 0; } // Sep 9 2019
-    iday_max = iday_min + 1;
+    if ( imap == 0 || !SHARE_BINNING ) {
 
-    ilam_min = (int)((Lrest - LMIN)/LSTEP) ;
-    if ( ilam_min >= NLAM-1 ) { ilam_min = NLAM - 2 ; }
-    if ( ilam_min <  0      ) { ilam_min = 0;         }
-    ilam_max = ilam_min + 1;
+      iday_min = (int)((Trest - TMIN)/TSTEP) ;
+      if ( iday_min >= NDAY-1 ) { iday_min = NDAY - 2 ; }
+      if ( iday_min <  0      ) { iday_min = 0; } // Sep 9 2019
+      iday_max = iday_min + 1;
 
-    
-    // Aug 27, 2009: 
+      ilam_min = (int)((Lrest - LMIN)/LSTEP) ;
+      if ( ilam_min >= NLAM-1 ) { ilam_min = NLAM - 2 ; }
+      if ( ilam_min <  0      ) { ilam_min = 0;         }
+      ilam_max = ilam_min + 1;
+    }
+
+    // Aug 27, 2009:
     // interpolate Trest at LAM-MIN
     jval  = NLAM*iday_min + ilam_min ;
     val0  = SALT2_ERRMAP[imap].VALUE[jval];
@@ -3130,129 +3491,125 @@ int gencovar_SALT2(int MATSIZE, int *ifiltobsList, double *epobsList,
   //  ARRRRRRRRRGH !!!
   //
   //  July 2016: add new inputs args RV_host & AV_host
-
-  int  icovar, irow, icol, ifilt_obs, ifilt_row, ifilt_col, ifilt ;
-  int ISDIAG, LDMP ;
+  //
+  //  Aug 2026: restructure from a dense MATSIZE^2 loop with per-cell
+  //  branching to an O(MATSIZE) precompute pass plus a structured
+  //  fill, exploiting the actual sparsity of this model: off-diagonal
+  //  covariance is non-zero only for same-passband pairs and is the
+  //  same constant FAC*cDisp^2 for every such pair, so only the
+  //  diagonal needs a model evaluation. Epochs clamped to the same
+  //  error-map boundary (DAYMIN/DAYMAX) reuse the previous magerr
+  //  instead of repeating the INTEG_zSED_SALT2 integral; output
+  //  values are identical to the old dense loop.
+
+  int  irow, icol, ifilt_obs, ifilt_row, ifilt_col, ifilt ;
 
   double z1    = 1.0 + z;
   double invZ1 = 1.0/z1;
 
-  double 
-    COV_TMP,  COV_DIAG, meanlam_obs, meanlam_rest
+  double
+    COV_DIAG, meanlam_obs, meanlam_rest
     ,cDisp[MXFILT_SEDMODEL]
+    ,COVOFF[MXFILT_SEDMODEL]          // same-band off-diagonal value
+    ,DIAG[MXFIT_COVAR_SALT2]          // diagonal magerr^2 per row
+    ,TREST_LAST[MXFILT_SEDMODEL]      // memo: last clamped Trest per band
+    ,COVDIAG_LAST[MXFILT_SEDMODEL]    // memo: last diagonal per band
     ,Finteg, Finteg_errPar, FspecDum[10], magerr
-    ,Tobs, Trest, Trest_tmp, Trest_row, Trest_col
+    ,Tobs, Trest, Trest_tmp
     ,FAC = 1.17882   //  [ 2.5/ln(10) ]^2
     ;
 
-    char *cfilt, cdum0[40], cdum1[40];
-
     char fnam[] = "gencovar_SALT2" ;
 
   // -------------- BEGIN -----------------
-  
-  icovar = 0 ;
 
-  // init  cDisp to -9 in each filter
+  if ( MATSIZE > MXFIT_COVAR_SALT2 ) {
+    sprintf(c1err,"MATSIZE=%d exceeds bound of %d",
+	    MATSIZE, MXFIT_COVAR_SALT2 );
+    sprintf(c2err,"Check MXFIT_COVAR_SALT2 in genmag_SALT2.h");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  // init per-band caches
   for(ifilt=1; ifilt <= NFILT_SEDMODEL; ifilt++) {
     ifilt_obs = FILTER_SEDMODEL[ifilt].ifilt_obs ;
-    cDisp[ifilt_obs] = -9.0 ;
+    cDisp[ifilt_obs]        = -9.0 ;
+    TREST_LAST[ifilt_obs]   = -99999.0 ;
+    COVDIAG_LAST[ifilt_obs] = -9.0 ;
   }
 
+  // -----------------------------------------------
+  // pass 1: one loop over epochs to get the color-dispersion
+  // term per band and the diagonal magerr^2 per epoch.
 
   for ( irow=0; irow < MATSIZE; irow++ ) {
-    for ( icol=0; icol < MATSIZE; icol++ ) {
 
-      Tobs  = *(epobsList+irow) ;  Trest_row  = Tobs * invZ1 ;
-      Tobs  = *(epobsList+icol) ;  Trest_col  = Tobs * invZ1 ;
-      ISDIAG = ( irow == icol ) ;
-
-      meanlam_rest  = -9.0 ;
-      ifilt_row     = *(ifiltobsList+irow);
-      ifilt_col     = *(ifiltobsList+icol);
-      COV_TMP       = 0.0 ; 
-      COV_DIAG      = 0.0 ;
-
-      // get cDisp for this filter; avoid repeating SALT2colorDisp calls
-      if ( cDisp[ifilt_row] < -1.0 ) {
-	ifilt         = IFILTMAP_SEDMODEL[ifilt_row] ;
-	meanlam_obs   = FILTER_SEDMODEL[ifilt].mean ;  // mean lambda
-	meanlam_rest  = meanlam_obs * invZ1 ; 
-	cDisp[ifilt_row] = SALT2colorDisp(meanlam_rest,fnam);    
-      }
+    ifilt_row     = *(ifiltobsList+irow);
+    ifilt         = IFILTMAP_SEDMODEL[ifilt_row] ;
+    meanlam_obs   = FILTER_SEDMODEL[ifilt].mean ;  // mean lambda
+    meanlam_rest  = meanlam_obs * invZ1 ;
 
-      // set covariances only for same passband.
-      if ( ifilt_col == ifilt_row ) 
-	{ COV_TMP = FAC * pow(cDisp[ifilt_row],2.0);  }
-
-      // check for local dump option
-      LDMP  = (COV_TMP != 0.0 || ISDIAG) && 
-	(fabs(Trest_row) < -1.0 && fabs(Trest_col) < -1.0); 
-
-      if ( LDMP ) 
-	{ printf(" xxx ############ COV_MODEL DUMP ############### \n"); }
-
-      // diagonal-only term
-      if ( ISDIAG ) {
-	Tobs          = *(epobsList+irow) ;  
-	Trest         = Tobs * invZ1 ;
-	ifilt         = IFILTMAP_SEDMODEL[ifilt_row] ;
-	cfilt         = FILTER_SEDMODEL[ifilt].name ;
-	meanlam_obs   = FILTER_SEDMODEL[ifilt].mean ;  // mean lambda
-	meanlam_rest  = meanlam_obs * invZ1 ; 
-
-
-	// make sure that Trest is within the map range
-	if ( Trest > SALT2_ERRMAP[0].DAYMAX ) 
-	  { Trest_tmp = SALT2_ERRMAP[0].DAYMAX ; }
-	else if ( Trest < SALT2_ERRMAP[0].DAYMIN ) 
-	  { Trest_tmp = SALT2_ERRMAP[0].DAYMIN ; }
-	else
-	  { Trest_tmp = Trest ; }
-
-	Trest = Trest_tmp ;
-	Tobs  = Trest * z1 ;
-
-	INTEG_zSED_SALT2(0,ifilt_row,z,Tobs, x0, x1, c,      // input
-			 RV_host, AV_host,                   // input
-			 &Finteg, &Finteg_errPar, FspecDum); // returned
-
-	magerr = SALT2magerr(Trest, meanlam_rest, z, x1, 
-			     Finteg_errPar, LDMP );
-	COV_DIAG = magerr*magerr ;
-	COV_TMP = COV_DIAG ;
-      }
-      
-      covar[icovar] = COV_TMP ;  // load output array  
-      icovar++ ;                   // increment local pointer
+    // get cDisp for this band; avoid repeating SALT2colorDisp calls
+    if ( cDisp[ifilt_row] < -1.0 ) {
+      cDisp[ifilt_row]  = SALT2colorDisp(meanlam_rest,fnam);
+      COVOFF[ifilt_row] = FAC * pow(cDisp[ifilt_row],2.0);
+    }
 
-      if ( LDMP && COV_TMP != 0.0  ) {
+    // make sure that Trest is within the map range
+    Tobs  = *(epobsList+irow) ;
+    Trest = Tobs * invZ1 ;
+    if ( Trest > SALT2_ERRMAP[0].DAYMAX )
+      { Trest_tmp = SALT2_ERRMAP[0].DAYMAX ; }
+    else if ( Trest < SALT2_ERRMAP[0].DAYMIN )
+      { Trest_tmp = SALT2_ERRMAP[0].DAYMIN ; }
+    else
+      { Trest_tmp = Trest ; }
 
-	ifilt         = IFILTMAP_SEDMODEL[ifilt_row] ;
-	cfilt         = FILTER_SEDMODEL[ifilt].name ;
-	sprintf(cdum0,"%s:Tobs=%7.3f", cfilt, Tobs);
+    Trest = Trest_tmp ;
+    Tobs  = Trest * z1 ;
 
-	ifilt         = IFILTMAP_SEDMODEL[ifilt_col] ;
-	cfilt         = FILTER_SEDMODEL[ifilt].name ;
-	sprintf(cdum1,"%s:Tobs=%7.3f", cfilt, Tobs);
- 
-	printf(" xxx COV_MAGERR[ %s , %s ] = %le \n", cdum0,cdum1, COV_TMP );
-
-	if ( ISDIAG ) {
-	  printf(" xxx ----------------- \n");
-	  printf(" xxx COV_DIAGON[ %s , %s ] = %le \n", cdum0,cdum1, COV_DIAG);
-	  printf(" xxx meanlam_rest = %f  z=%f  x1=%f  errPar=%f \n",
-		 meanlam_rest, z, x1, Finteg_errPar );
-	  printf(" xxx ----------------- \n");
-	}
+    // reuse previous diagonal when clamping maps this epoch onto
+    // the same Trest as the previous epoch of the same band
+    if ( COVDIAG_LAST[ifilt_row] > -1.0 &&
+	 Trest == TREST_LAST[ifilt_row] ) {
+      DIAG[irow] = COVDIAG_LAST[ifilt_row] ;
+      continue ;
+    }
 
-	fflush(stdout);
-      }
+    INTEG_zSED_SALT2(0,ifilt_row,z,Tobs, x0, x1, c,      // input
+		     RV_host, AV_host,                   // input
+		     &Finteg, &Finteg_errPar, FspecDum); // returned
+
+    magerr = SALT2magerr(Trest, meanlam_rest, z, x1,
+			 Finteg_errPar, 0 );
+    COV_DIAG   = magerr*magerr ;
+    DIAG[irow] = COV_DIAG ;
+
+    TREST_LAST[ifilt_row]   = Trest ;
+    COVDIAG_LAST[ifilt_row] = COV_DIAG ;
+
+  } // irow
+
+  // -----------------------------------------------
+  // pass 2: fill output matrix from the structure;
+  // non-zero off-diagonals exist only within the same band.
+
+  for ( irow=0; irow < MATSIZE; irow++ ) {
+    ifilt_row = *(ifiltobsList+irow);
+    for ( icol=0; icol < MATSIZE; icol++ ) {
+      ifilt_col = *(ifiltobsList+icol);
+
+      if ( irow == icol )
+	{ covar[icol + irow*MATSIZE] = DIAG[irow] ; }
+      else if ( ifilt_col == ifilt_row )
+	{ covar[icol + irow*MATSIZE] = COVOFF[ifilt_row] ; }
+      else
+	{ covar[icol + irow*MATSIZE] = 0.0 ; }
 
     } // icol
   } //  irow
 
-  return SUCCESS ; 
+  return SUCCESS ;
 
 } // end of gencovar_SALT2
 
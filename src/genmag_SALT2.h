@@ -35,12 +35,53 @@
 #define OPTMASK_SALT2_DISABLE_WAVESHIFT   8  // disable WAVESHIFT keys
 #define OPTMASK_SALT2_NONEGFLUX          16  // flux<0 -> 0 (as in DC2)
 #define OPTMASK_SALT2_ABORT_LAMRANGE     64  // abort on bad model-LAMRANGE
+#define OPTMASK_SALT2_FINTEG_CACHE      256  // memoize INTEG_zSED_SALT2
 
-int  NCALL_DBUG_SALT2 ; 
+int  NCALL_DBUG_SALT2 ;
 int  RELAX_IDIOT_CHECK_SALT2;
 bool ISMODEL_SALT2, ISMODEL_SALT3 ;
 bool ALLOW_NEGFLUX_SALT2;
 
+// lazy cache of filter-projected flux integrals, keyed by quantized
+// (filter, z, Trest, c, MWEBV) tuple; see OPTMASK_SALT2_FINTEG_CACHE.
+// Quantization steps are chosen so that the worst-case model error
+// is well below a milli-mag (Aug 2026).
+#define NROW_FINTEG_CACHE_SALT2  0x100000   // hash-table rows (2^20)
+#define DLOGZ_FINTEG_CACHE    0.0002  // ln(z) step
+#define DTREST_FINTEG_CACHE   0.05    // Trest step, days
+#define DCOLOR_FINTEG_CACHE   0.001   // color step
+#define DMWEBV_FINTEG_CACHE   0.0005  // MWEBV step
+
+typedef struct {
+  unsigned long long KEY ;  // packed quantized tuple; 0 => empty row
+  double Finteg_filter[2], Finteg_forErr[2], Fnorm_SALT3 ;
+} FINTEG_CACHE_ROW_SALT2 ;
+
+struct {
+  bool USE ;                      // set by OPTMASK in init_genmag_SALT2
+  FINTEG_CACHE_ROW_SALT2 *ROW ;   // malloc'ed hash table
+  long long NCALL, NHIT ;         // monitor cache efficiency
+} FINTEG_CACHE_SALT2 ;
+
+// Aug 2026: obs-frame filter grid resampled onto the rest-frame SED
+// lambda grid. The SED lambda index and interp fraction of each filter
+// bin depend only on (filter,z), so they are computed once per redshift
+// (prep_LAMMAP_INTEG_SALT2) and re-used for every epoch instead of
+// being re-derived inside the integration loop of INTEG_zSED_SALT2.
+// The SPECTROGRAPH pseudo-filter keeps the on-the-fly path because its
+// bins are further subdivided in rest-frame lambda.
+typedef struct {
+  double  z ;            // redshift of stored map (-9 => not built)
+  int     NLAM ;         // number of obs-frame filter bins
+  double *LAMOBS ;       // obs-frame lambda per bin
+  double *TRANS ;        // filter transmission (transSN) per bin
+  double *LAMSED ;       // rest-frame lambda = LAMOBS/(1+z)
+  int    *ILAMSED ;      // SED lambda index per bin; -9 => outside model
+  double *FRAC_INTERP ;  // SED lambda interp fraction per bin
+} FILTER_LAMMAP_SALT2_DEF ;
+
+FILTER_LAMMAP_SALT2_DEF FILTER_LAMMAP_SALT2[MXFILT_SEDMODEL] ;
+
 /**********************************************
   Init Information
 ***********************************************/
@@ -79,6 +120,11 @@ struct SALT2_ERRMAP {
   double  RANGE_FOUND[2] ;  // actual min/max for each map
 } SALT2_ERRMAP[NERRMAP]; // SALT2_VAR[2], SALT2_COVAR, SALT2_ERRSCALE ;
 
+// Aug 2026: true if error maps 0-3 share the same Trest/lambda
+// binning; get_SALT2_ERRMAP then computes the bilinear indices and
+// weights once per query and reuses them for all maps.
+bool ERRMAP_SHARE_BINNING_SALT2 ;
+
 #define CALIB_SALT2_MAGSHIFT  1
 #define CALIB_SALT2_WAVESHIFT 2
 #define MXSHIFT_CALIB_SALT2 100
@@ -233,7 +279,9 @@ void errorSummary_SALT2(void) ;
 void  fill_SALT2_TABLE_SED(int ised);
 void  fill_SALT2_TABLE_COLORLAW(void);   
 
-double SALT2colorCor(double lam_rest, double c); 
+double SALT2colorCor(double lam_rest, double c);
+void   SALT2colorCor_batch(int NLAM, double *lam_rest, double c,
+			   double *ccor );
 
 double SALT2x0calc(double alpha, double beta, double x1, double c, 
 		   double dlmag );
@@ -259,6 +307,14 @@ void init_BADVAL_SALT2errmap(int imap);
 
 void get_SALT2_ERRMAP(double Trest, double Lrest, double *ERRMAP );
 
+void      init_FINTEG_CACHE_SALT2(void);
+long long check_FINTEG_CACHE_SALT2(int OPT_SPEC, int ifilt_obs, double z,
+				   double Trest, double c,
+				   double RV_host, double AV_host,
+				   unsigned long long *KEY );
+
+FILTER_LAMMAP_SALT2_DEF *prep_LAMMAP_INTEG_SALT2(int ifilt, double z);
+
 void load_mBoff_SALT2(void);
 
 void test_SALT2colorlaw1(void);
@@ -280,6 +336,10 @@ void INTEG_zSED_SALT2(int OPT_SPEC, int ifilt_obs, double z, double Tobs,
 		      double *Finteg, double *Finteg_errPar, 
 		      double *Fspec );
 
+// Aug 2026: bound on covariance-matrix row size in gencovar_SALT2;
+// matches MXFIT_DATA in snlc_fit.car
+#define MXFIT_COVAR_SALT2 1500
+
 int gencovar_SALT2(int MATSIZE, int *ifilt_obs, double *epobs, 
 		   double z, double x0, double x1, double c, double mwebv, 
 		   double RV_host, double AV_host, double *covar );
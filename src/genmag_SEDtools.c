@@ -554,7 +554,9 @@ void malloc_FLUXTABLE_SEDMODEL( int NFILT, int NZBIN, int NLAMPOW,
   NBTOT_SEDMODEL_FLUXTABLE = N1DBINOFF_SEDMODEL_FLUXTABLE[0] ;
   ISIZE_SEDMODEL_FLUXTABLE = NBTOT_SEDMODEL_FLUXTABLE * isize ;
 
-  PTR_SEDMODEL_FLUXTABLE =  (float*)malloc(ISIZE_SEDMODEL_FLUXTABLE);
+  // Aug 2026: malloc_largeTable allows optional huge-page backing
+  PTR_SEDMODEL_FLUXTABLE =
+    (float*)malloc_largeTable( (size_t)ISIZE_SEDMODEL_FLUXTABLE );
 
   printf("  %s : allocate %6.2f Mb of memory for integral-flux tables. \n", 
 	 fnam, 1.E-6*(double)ISIZE_SEDMODEL_FLUXTABLE );
@@ -776,13 +778,15 @@ void init_flux_SEDMODEL(int ifilt_obs, int ised) {
 
   int  ilampow, iep, ifilt, ilamfilt, iz ;
   int  NLAMFILT, NLAMSED, EPMIN, EPMAX, N, NZBIN, index ;
+  int  ilamsed, jflux ;  // Aug 2026
 
-  double 
+  double
     lamsed, lamobs, lampow, trans, day, z, z1, logzdif
     ,LOGZMIN, LOGZMAX, LOGZBIN, FLUX, tmp, mag, mutmp, x0tmp
     ,LAMOBS_MIN, LAMOBS_MAX, LAMOBS_STEP, SEDMODELNORM
     ,LAMTPOW[MXLAMPOW_SEDMODEL+1]
-    ,hc8, TDUM=-99.9
+    ,LAMDIF, FRAC_INTERP_LAM, F0, F1   // Aug 2026
+    ,hc8
     ;
 
 
@@ -983,18 +987,39 @@ void init_flux_SEDMODEL(int ifilt_obs, int ised) {
 	lampow *= lamobs ;
       } 
 
+      // Aug 2026: specialized epoch kernel; this is the fixed-index
+      // (IEP>=0) path of getFluxLam_SEDMODEL with the lambda-bin
+      // index and interpolation fraction hoisted out of the epoch
+      // loop -- they depend only on (lamobs,z) -- so the inner loop
+      // is two table reads and a lerp per epoch with no branches.
+      LAMDIF    = lamsed - SEDMODEL.LAMMIN[ised] ;
+      ilamsed   = (int)(LAMDIF/TEMP_SEDMODEL.FINEBIN_LAMSTEP) ;
+      if ( ilamsed > NLAMSED-1 ) { ilamsed = NLAMSED-1 ; }
+      FRAC_INTERP_LAM = ( lamsed - TEMP_SEDMODEL.FINEBIN_LAM[ilamsed] )
+	/ TEMP_SEDMODEL.FINEBIN_LAMSTEP ;
+
+      if ( FRAC_INTERP_LAM < -1.0E-8 || FRAC_INTERP_LAM > 1.000000001 ) {
+	sprintf(c1err,"FRAC_LAM=%f for LAMSED=%6.2f(%d), z=%3f",
+		FRAC_INTERP_LAM, lamsed, ilamsed, z );
+	sprintf(c2err,"ISED=%d, ifilt_obs=%d", ised, ifilt_obs);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ;
+      }
+
       // loop over epochs, and compte flux
       for ( iep=EPMIN ; iep <= EPMAX ; iep++ ) {
 
 	// get flux at this epoch and obs-wavelength
-	FLUX = getFluxLam_SEDMODEL(ised, iep, TDUM, lamobs, z, fnam) ; 
+	jflux = NLAMSED*iep + ilamsed ;
+	F0    = TEMP_SEDMODEL.FINEBIN_FLUX[jflux];
+	F1    = TEMP_SEDMODEL.FINEBIN_FLUX[jflux+1];
+	FLUX  = F0 + FRAC_INTERP_LAM*(F1-F0) ;
 
 	for ( ilampow=0; ilampow <= NLAMPOW_SEDMODEL; ilampow++ ) {
 	  tmp   = LAMTPOW[ilampow] * FLUX ;
 	  index = INDEX_SEDMODEL_FLUXTABLE(ifilt,iz,ilampow,iep,ised);
 	  PTR_SEDMODEL_FLUXTABLE[index] += tmp ;
-	} 
-	  
+	}
+
       }  // end iep loop over epochs
     } // end ilam loop over SED-lambda bins in rest-frame
   } // end of iz loop
@@ -2038,37 +2063,107 @@ void pack_SEDBINARY(int OPT) {
 
 
 // =======================================================
-int get_SEDMODEL_INDICES( int IPAR, double LUMIPAR, 
+void prep_SEDMODEL_INDICES(void) {
+
+  // Created Aug 2026
+  // Build sorted list of distinct PARVAL grid nodes for each SED
+  // parameter, along with the first (lowest) SED index at each node.
+  // Called on the first get_SEDMODEL_INDICES call, after the SED
+  // surfaces are loaded; the bracketing SED indices then come from
+  // a binary search over the few distinct nodes instead of a scan
+  // over all NSURFACE SEDs for every generated event.
+
+  int NSED = SEDMODEL.NSURFACE ;
+  int ipar, ised, j, lo, hi, mid, NNODE ;
+  double parval ;
+  double *ptrVAL ;
+  int    *ptrSED ;
+  //  char fnam[] = "prep_SEDMODEL_INDICES" ;
+
+  // ------------ BEGIN ----------------
+
+  for(ipar=0; ipar < SEDMODEL.NPAR; ipar++ ) {
+
+    ptrVAL = (double*) malloc( NSED * sizeof(double) );
+    ptrSED = (int   *) malloc( NSED * sizeof(int)    );
+    NNODE  = 0 ;
+
+    for ( ised = 1; ised <= NSED ; ised++ ) {
+      parval = SEDMODEL.PARVAL[ised][ipar];
+
+      // binary search for sorted insertion point
+      lo = 0;  hi = NNODE ;
+      while ( lo < hi ) {
+	mid = (lo+hi)/2 ;
+	if ( ptrVAL[mid] < parval ) { lo = mid+1; } else { hi = mid; }
+      }
+
+      // skip duplicate node; first ised at this value is kept
+      if ( lo < NNODE && ptrVAL[lo] == parval ) { continue; }
+
+      for(j=NNODE; j > lo; j-- )
+	{ ptrVAL[j] = ptrVAL[j-1];  ptrSED[j] = ptrSED[j-1]; }
+      ptrVAL[lo] = parval ;
+      ptrSED[lo] = ised ;
+      NNODE++ ;
+    }
+
+    SEDMODEL_NODE.NNODE[ipar]       = NNODE ;
+    SEDMODEL_NODE.PARVAL_NODE[ipar] = ptrVAL ;
+    SEDMODEL_NODE.ISED_NODE[ipar]   = ptrSED ;
+  }
+
+  SEDMODEL_NODE.PREPFLAG = 1 ;
+
+  return ;
+
+} // end prep_SEDMODEL_INDICES
+
+
+int get_SEDMODEL_INDICES( int IPAR, double LUMIPAR,
 			 int *ILOSED, int *IHISED) {
 
   // for input paramater IPAR with value LUMIPAR,
-  // return SED indices (I0SED and I1SED) that 
+  // return SED indices (I0SED and I1SED) that
   // bracket this LUMIPAR value.
   //
+  // Aug 2026: binary search over sorted distinct PARVAL nodes
+  // (see prep_SEDMODEL_INDICES) replaces the scan over all SEDs;
+  // returned indices are identical since the old scan also kept
+  // the first SED achieving each minimum difference.
 
-  int ised;
-  double     parval ,dif1, mindif1, dif0, mindif0  ;
+  int NNODE, lo, hi, mid, jhi, jlo ;
+  double *ptrVAL ;
   //  char fnam[] = "get_SEDMODEL_INDICES" ;
 
   // ------------ BEGIN ----------------
 
+  if ( !SEDMODEL_NODE.PREPFLAG ) { prep_SEDMODEL_INDICES(); }
+
   *ILOSED = *IHISED = -9 ;
-  mindif0 = mindif1 = 9999999.;
 
-  for ( ised = 1; ised <= SEDMODEL.NSURFACE ; ised++ ) {
-    parval = SEDMODEL.PARVAL[ised][IPAR];
+  NNODE  = SEDMODEL_NODE.NNODE[IPAR];
+  ptrVAL = SEDMODEL_NODE.PARVAL_NODE[IPAR];
 
-    dif1 = parval - LUMIPAR;
-    if ( dif1 >= 0.0  &&  dif1 < mindif1 ) {
-      mindif1 = dif1 ;
-      *IHISED = ised ;
-    }
-    dif0 = LUMIPAR - parval ;
-    if ( dif0 >= 0.0  &&  dif0 < mindif0 ) {
-      mindif0 = dif0 ;
-      *ILOSED = ised ;
-    }
+  // find first node with PARVAL >= LUMIPAR
+  lo = 0;  hi = NNODE ;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2 ;
+    if ( ptrVAL[mid] < LUMIPAR ) { lo = mid+1; } else { hi = mid; }
   }
+  jhi = lo ;
+
+  if ( jhi < NNODE )
+    { *IHISED = SEDMODEL_NODE.ISED_NODE[IPAR][jhi] ; }
+
+  // last node with PARVAL <= LUMIPAR
+  if ( jhi < NNODE && ptrVAL[jhi] == LUMIPAR )
+    { jlo = jhi ; }
+  else
+    { jlo = jhi - 1 ; }
+
+  if ( jlo >= 0 )
+    { *ILOSED = SEDMODEL_NODE.ISED_NODE[IPAR][jlo] ; }
 
 
   if ( *ILOSED <= 0 || *IHISED <= 0 )
@@ -2343,18 +2438,23 @@ void fill_TABLE_MWXT_SEDMODEL(double RV, double mwebv) {
   NBSPEC = SPECTROGRAPH_SEDMODEL.NBLAM_TOT ;
   if ( NBSPEC>0 ) { ifilt_min=0; } else { ifilt_min=1; }
 
+  // Aug 2026: batch+memoized extinction curve per filter grid
+  double *XTMAG_LIST ;
   for(ifilt=ifilt_min; ifilt <= NFILT_SEDMODEL; ifilt++) {
-   
-    NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ; 
+
+    NLAMFILT = FILTER_SEDMODEL[ifilt].NLAM ;
+
+    XTMAG_LIST = (double*)malloc(I8*NLAMFILT);
+    GALextinct_list(RV, AV, NLAMFILT, FILTER_SEDMODEL[ifilt].lam,
+		    OPT_COLORLAW, XTMAG_LIST );
 
     for ( ilam=0; ilam < NLAMFILT; ilam++ ) {
-      LAMOBS     = FILTER_SEDMODEL[ifilt].lam[ilam] ;
-      XT_MAG     = GALextinct ( RV, AV, LAMOBS, OPT_COLORLAW ) ;
-      arg        = -0.4*XT_MAG ;
+      arg        = -0.4*XTMAG_LIST[ilam] ;
       XT_FRAC    = pow(TEN,arg);    // flux-fraction thru MW
       SEDMODEL_TABLE_MWXT_FRAC[ifilt][ilam]  = XT_FRAC ;
 
     } // ilam
+    free(XTMAG_LIST);
   } // ifilt
   
 
@@ -2445,19 +2545,31 @@ void fill_TABLE_HOSTXT_SEDMODEL(double RV, double AV, double z) {
   NBSPEC = SPECTROGRAPH_SEDMODEL.NBLAM_TOT ;
   if ( NBSPEC>0 ) { ifilt_min=0; } else { ifilt_min=1; }
 
+  // Aug 2026: batch+memoized extinction per rest-frame grid; the
+  // memo key includes the end wavelengths, so each z has its own
+  // cached curve even though the scratch buffer is re-used.
+  double *LAMREST_LIST, *XTMAG_LIST ;
   for(ifilt=ifilt_min; ifilt <= NFILT_SEDMODEL; ifilt++) {
     NLAMFILT  = FILTER_SEDMODEL[ifilt].NLAM ;
     ifilt_obs = FILTER_SEDMODEL[ifilt].ifilt_obs ;
 
+    LAMREST_LIST = (double*)malloc(I8*NLAMFILT);
+    XTMAG_LIST   = (double*)malloc(I8*NLAMFILT);
+    for ( ilam=0; ilam < NLAMFILT; ilam++ ) {
+      LAMOBS              = FILTER_SEDMODEL[ifilt].lam[ilam] ;
+      LAMREST_LIST[ilam]  = LAMOBS/(1.0 + z);
+    }
+
+    GALextinct_list(RV, AV, NLAMFILT, LAMREST_LIST,
+		    OPT_COLORLAW, XTMAG_LIST );
+
     for ( ilam=0; ilam < NLAMFILT; ilam++ ) {
-      LAMOBS     = FILTER_SEDMODEL[ifilt].lam[ilam] ;
-      LAMREST    = LAMOBS/(1.0 + z);
-      XT_MAG     = GALextinct ( RV, AV, LAMREST, OPT_COLORLAW ) ;
-      arg        = -0.4*XT_MAG ;
+      arg        = -0.4*XTMAG_LIST[ilam] ;
       XT_FRAC    = pow(TEN,arg);    // flux-fraction thru host
       SEDMODEL_TABLE_HOSTXT_FRAC[ifilt][ilam]  = XT_FRAC ;
     } // ilam
 
+    free(LAMREST_LIST);  free(XTMAG_LIST);
   } // ifilt
 
   SEDMODEL_HOSTXT_LAST.RV = RV ; // 7.14.2020
@@ -184,6 +184,17 @@ struct SEDMODEL {
 } SEDMODEL ;
 
 
+// Aug 2026: sorted distinct PARVAL nodes per parameter, built lazily
+// by get_SEDMODEL_INDICES so that bracketing SED indices come from a
+// binary search instead of scanning all NSURFACE SEDs per call.
+struct {
+  int     PREPFLAG ;                       // 1 after nodes are built
+  int     NNODE[MXPAR_SEDMODEL] ;          // Ndistinct values per ipar
+  double *PARVAL_NODE[MXPAR_SEDMODEL] ;    // sorted distinct values
+  int    *ISED_NODE[MXPAR_SEDMODEL] ;      // first ised at each value
+} SEDMODEL_NODE ;
+
+
 // Aug 2013: move MWXT table from genmag_SALT2.h to here
 double **SEDMODEL_TABLE_MWXT_FRAC ;
 double SEDMODEL_MWEBV_LAST ;
@@ -341,7 +352,8 @@ void pack_SEDBINARY(int OPT); // OP+1 => PACK;  OPT=-1 => UNPACK
 long int INDEX_SEDMODEL_FLUXTABLE(int ifilt, int iz, 
 			     int ilampow, int iep, int  ised);
 
-int get_SEDMODEL_INDICES( int IPAR, double LUMIPAR, 
+void prep_SEDMODEL_INDICES(void);
+int get_SEDMODEL_INDICES( int IPAR, double LUMIPAR,
 			 int *ILOSED, int *IHISED);
 
 void check_sedflux_bins(int ised, char *VARNAME, 
@@ -136,11 +136,13 @@ int init_genmag_SIMSED(char *VERSION      // SIMSED version
 
   // OPTMASK +=  1 --> create binary file
   // OPTMASK += 64 --> test mode only, no binary, no time-stamp checks
+  // OPTMASK += 256 -> defer reading each SED until it is first sampled
   //
   // Aug 18 2020: check kcor file with .gz
+  // Aug 2026: check OPTMASK_INIT_SIMSED_LAZY to defer SED-reading.
 
-  int 
-    OPT_BINARY, OPT_TESTMODE, NZBIN, IZSIZE
+  int
+    OPT_BINARY, OPT_TESTMODE, OPT_LAZYLOAD, NZBIN, IZSIZE, NSED_INIT
     ,ifilt, ifilt_obs, ised, istat
     ,retval = SUCCESS
     ,WRFLAG_SEDBINARY  // for global SEDs
@@ -171,8 +173,13 @@ int init_genmag_SIMSED(char *VERSION      // SIMSED version
   // get local logicals for bit-mask  options
   OPT_BINARY      = ( OPTMASK &  OPTMASK_INIT_SIMSED_BINARY   ) ;
   OPT_TESTMODE    = ( OPTMASK &  OPTMASK_INIT_SIMSED_TESTMODE ) ;
+  OPT_LAZYLOAD    = ( OPTMASK &  OPTMASK_INIT_SIMSED_LAZY     ) ;
   ISBATCH_SIMSED  = ( OPTMASK &  OPTMASK_INIT_SIMSED_BATCH    ) ;
 
+  SIMSED_LAZYLOAD.USEFLAG = 0 ;
+  SIMSED_LAZYLOAD.NLOADED = 0 ;
+  SIMSED_LAZYLOAD.FPBIN   = NULL ;
+
   if ( NFILT_SEDMODEL == 0  && OPT_TESTMODE==0 ) {
     sprintf(c1err,"No filters defined ?!?!?!? " );
     sprintf(c2err,"Need to call init_filter_SEDMODEL");
@@ -295,9 +302,36 @@ int init_genmag_SIMSED(char *VERSION      // SIMSED version
 			      SEDMODEL.MXDAY, SEDMODEL.NSURFACE );
   fflush(stdout);
 
+  // -------------------------------------------------
+  // check option to defer reading each SED until it is first sampled
+  // by the generator (Aug 2026). Needs existing SED.BINARY so that
+  // each SED record can be fseek'd later; do full init if either
+  // binary must still be created. If the flux-table binary already
+  // exists there is nothing left to defer.
+
+  if ( OPT_LAZYLOAD && RDFLAG_SEDBINARY && RDFLAG_TABBINARY == 0 ) {
+
+    if ( WRFLAG_TABBINARY ) {
+      // skip making flux-table binary; lazy mode fills table on the fly
+      fclose(fpbin2);  remove(bin2File);
+      WRFLAG_TABBINARY = 0 ;
+      printf("\t Skip making flux-table binary (deferred SED-reading). \n");
+    }
+
+    init_SIMSED_LAZYLOAD(fpbin1);
+  }
+  else if ( OPT_LAZYLOAD ) {
+    printf("\n  WARNING(%s): cannot defer SED-reading; \n"
+	   "\t need existing SED.BINARY and no flux-table binary. \n", fnam);
+    fflush(stdout);
+  }
+
   // ------- Now read the spectral templates -----------
 
-  for ( ised = 1 ; ised <= SEDMODEL.NSURFACE ; ised++ ) {
+  NSED_INIT = SEDMODEL.NSURFACE ;
+  if ( SIMSED_LAZYLOAD.USEFLAG ) { NSED_INIT = 0; } // SEDs load on demand
+
+  for ( ised = 1 ; ised <= NSED_INIT ; ised++ ) {
     
     sprintf(tmpFile, "%s/%s", SIMSED_PATHMODEL, SEDMODEL.FILENAME[ised] );
     sprintf(sedcomment,"(ised=%d/%d)", ised, SEDMODEL.NSURFACE );
@@ -394,7 +428,9 @@ int init_genmag_SIMSED(char *VERSION      // SIMSED version
 
   fflush(stdout);
 
-  if ( WRFLAG_SEDBINARY || RDFLAG_SEDBINARY ) {  fclose(fpbin1);  }
+  // keep SED.BINARY open for lazy mode; load_SED_SIMSED fseeks here later
+  if ( (WRFLAG_SEDBINARY || RDFLAG_SEDBINARY) && !SIMSED_LAZYLOAD.USEFLAG )
+    {  fclose(fpbin1);  }
 
 
   // write binary integral-flux table to current directory;
@@ -423,8 +459,13 @@ int init_genmag_SIMSED(char *VERSION      // SIMSED version
 
   // ===========================================
   printf("\n");
-  printf(" Global DAY range: %.2f to %.2f \n",
-	 SEDMODEL.DAYMIN_ALL, SEDMODEL.DAYMAX_ALL);
+  if ( SIMSED_LAZYLOAD.USEFLAG ) {
+    printf(" Global DAY range: deferred until SEDs are loaded. \n");
+  }
+  else {
+    printf(" Global DAY range: %.2f to %.2f \n",
+	   SEDMODEL.DAYMIN_ALL, SEDMODEL.DAYMAX_ALL);
+  }
 
   printf("  %s : Done. \n", fnam );
   fflush(stdout);
@@ -513,6 +554,130 @@ void open_TABBINARY(char *binFile, FILE **fpbin, int *RDFLAG, int *WRFLAG) {
 
 } // end open_TABBINARY
 
+
+// ******************************************************
+void init_SIMSED_LAZYLOAD(FILE *fpbin) {
+
+  // Created Aug 2026
+  // Prepare lazy SED-loading: one pass over the already-open
+  // SED.BINARY (read mode) to record the fseek-offset of each
+  // SED record; only the small record headers are read here.
+  // The SED surfaces themselves are read later by load_SED_SIMSED,
+  // the first time each SED is sampled by the generator.
+  //
+  // Input: fpbin = SED.BINARY file pointer (stays open).
+
+  int ised, NRD, NSEDTMP ;
+  char sedFile[MXPATHLEN];
+  char fnam[] = "init_SIMSED_LAZYLOAD" ;
+
+  // ----------- BEGIN -----------
+
+  SIMSED_LAZYLOAD.USEFLAG = 1 ;
+  SIMSED_LAZYLOAD.NLOADED = 0 ;
+  SIMSED_LAZYLOAD.FPBIN   = fpbin ;
+
+  for ( ised = 1; ised <= SEDMODEL.NSURFACE; ised++ ) {
+
+    SIMSED_LAZYLOAD.ISLOADED[ised] = 0 ;
+    SIMSED_LAZYLOAD.OFFSET[ised]   = ftell(fpbin);
+
+    NRD  = fread( sedFile,  sizeof(sedFile), 1, fpbin );
+    NRD += fread(&NSEDTMP,  sizeof(int),     1, fpbin );
+    if ( NRD != 2 || NSEDTMP <= 0 ) {
+      sprintf(c1err,"Could not read binary record header for ised=%d of %d",
+	      ised, SEDMODEL.NSURFACE );
+      sprintf(c2err,"Try deleting SED.BINARY file.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+    }
+
+    // skip over packed SED fluxes
+    fseek(fpbin, (long)NSEDTMP * sizeof(float), SEEK_CUR );
+  }
+
+  printf("\n  Defer SED-reading: %d SED surfaces will load on demand. \n",
+	 SEDMODEL.NSURFACE );
+  fflush(stdout);
+
+  return ;
+
+} // end init_SIMSED_LAZYLOAD
+
+
+// ******************************************************
+void load_SED_SIMSED(int ised) {
+
+  // Created Aug 2026
+  // For lazy mode (see OPTMASK_INIT_SIMSED_LAZY), load SED surface
+  // 'ised' the first time it is sampled: fseek to its record in
+  // SED.BINARY, read the packed SED, and compute the filter-integral
+  // flux table for this SED only. Does nothing if lazy mode is off
+  // or if this SED is already loaded.
+
+  int ifilt, ifilt_obs ;
+  FILE *fpbin ;
+  char tmpFile[MXPATHLEN], sedFile[MXPATHLEN];
+  char fnam[] = "load_SED_SIMSED" ;
+
+  // ----------- BEGIN -----------
+
+  if ( SIMSED_LAZYLOAD.USEFLAG  == 0 ) { return ; }
+  if ( SIMSED_LAZYLOAD.ISLOADED[ised] ) { return ; }
+
+  fpbin = SIMSED_LAZYLOAD.FPBIN ;
+  fseek(fpbin, SIMSED_LAZYLOAD.OFFSET[ised], SEEK_SET );
+
+  // same record-read and sanity checks as in init_genmag_SIMSED
+  sprintf(tmpFile, "%s/%s", SIMSED_PATHMODEL, SEDMODEL.FILENAME[ised] );
+  fread(sedFile, sizeof(sedFile), 1, fpbin );
+  if ( strcmp(tmpFile,sedFile) != 0 ) {
+    printf("\n\n");
+    printf("BINARY   SED File: '%s' \n", sedFile );
+    printf("EXPECTED SED File: '%s' \n", tmpFile );
+    sprintf(c1err,"binary SED file does not match expected file.");
+    sprintf(c2err,"Try deleting SED.BINARY file.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
+  fread( &NSEDBINARY, sizeof(int   ),   1,        fpbin );
+  fread( SEDBINARY,   sizeof(float ), NSEDBINARY, fpbin );
+  pack_SEDBINARY(-1);  // transfer SEDBINARY to TEMP_SEDMODEL struct
+
+  if ( TEMP_SEDMODEL.NDAY > SEDMODEL.MXDAY ) {
+    sprintf(c1err,"NDAY=%d exceeds expected bound of %d",
+	    TEMP_SEDMODEL.NDAY, SEDMODEL.MXDAY ) ;
+    sprintf(c2err,"Check DAY bins for SED.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
+  if ( TEMP_SEDMODEL.NLAM > MXBIN_LAMSED_SEDMODEL ) {
+    sprintf(c1err,"NLAM=%d exceeds bound of %d",
+	    TEMP_SEDMODEL.NLAM, MXBIN_LAMSED_SEDMODEL ) ;
+    sprintf(c2err,"Check LAMBDA bins for SED.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
+  // fill flux-integral table for this SED only
+  init_FINEBIN_SEDMODEL(ised);
+
+  for(ifilt=1; ifilt <= NFILT_SEDMODEL; ifilt++) {
+    ifilt_obs = FILTER_SEDMODEL[ifilt].ifilt_obs ;
+    init_flux_SEDMODEL(ifilt_obs,ised);
+  }
+  init_FINEBIN_SEDMODEL(-1);  // free FINEBIN memory alloc.
+
+  SIMSED_LAZYLOAD.ISLOADED[ised] = 1 ;
+  SIMSED_LAZYLOAD.NLOADED++ ;
+
+  printf("\t Load deferred SED surface %d (NLOAD=%d of %d) \n",
+	 ised, SIMSED_LAZYLOAD.NLOADED, SEDMODEL.NSURFACE );
+  fflush(stdout);
+
+  return ;
+
+} // end load_SED_SIMSED
+
+
 // ******************************************************
 void read_SIMSED_flux(char *sedFile, char *sedComment) {
 
@@ -1399,6 +1564,8 @@ double nextgrid_flux_SIMSED (
   }
 
 
+  load_SED_SIMSED(ISED);  // no-op unless lazy mode, Aug 2026
+
   Sinterp = get_flux_SEDMODEL( ISED, 0, ifilt_obs, z, Trest);
 
   ISED_SEDMODEL = ISED; // set globa, Mar 6 2017
@@ -1490,6 +1657,7 @@ double interp_flux_SIMSED(
   if ( SEDMODEL.NSURFACE == 1 ) {
     ISED = 1;
     ISED_SEDMODEL = ISED; // set globa, Mar 6 2017
+    load_SED_SIMSED(ISED);  // no-op unless lazy mode, Aug 2026
     Sinterp = get_flux_SEDMODEL( ISED, 0, ifilt_obs, z, Trest);
 
     // load *lumipar array
@@ -1537,6 +1705,36 @@ double interp_flux_SIMSED(
   
   NPAR = SEDMODEL.NPAR ;
   if( NGRIDONLY == NPAR-num_pars_baggage ) {
+
+    // Aug 2026: check last-matched node before scanning all surfaces;
+    // every epoch & filter of an event (and repeated grid nodes in
+    // GRIDONLY productions) lands on the same node, so this skips
+    // the O(NSURFACE*NPAR) search almost always.
+    static int ISED_CACHE_GRIDONLY = -9 ;
+    if ( ISED_CACHE_GRIDONLY > 0 ) {
+      NMATCH = 0 ;
+      for(j=0; j < NPAR; j++ ) {
+	if ( pars_baggage[j] ) { continue ; }
+	range      = SEDMODEL.PARVAL_MAX[j] - SEDMODEL.PARVAL_MIN[j] ;
+	ipar_model = iparmap[j];
+	parval     = SEDMODEL.PARVAL[ISED_CACHE_GRIDONLY][ipar_model];
+	diff       = (parval - lumipar[j]) / range ;
+	if ( fabs(diff) < 0.0001 ) { NMATCH++ ; }
+      }
+      if ( NMATCH == NGRIDONLY ) {
+	ISED = ISED_CACHE_GRIDONLY ;
+	load_SED_SIMSED(ISED);  // no-op unless lazy mode, Aug 2026
+	Sinterp = get_flux_SEDMODEL(ISED, 0, ifilt_obs, z, Trest);
+	ISED_SEDMODEL = ISED;
+
+	// load *lumipar array
+	for ( ipar=0; ipar < SEDMODEL.NPAR ; ipar++ )
+	  { lumipar[ipar] = SEDMODEL.PARVAL[ISED][ipar];  }
+
+	return(Sinterp) ;
+      }
+    }
+
     for ( ISED = 1; ISED <= SEDMODEL.NSURFACE ; ISED++ ) {
       
       NMATCH = 0 ;
@@ -1555,8 +1753,10 @@ double interp_flux_SIMSED(
 	
 	if ( fabs(diff) < 0.0001 ) { NMATCH++ ; }
       }
-      if ( NMATCH == NGRIDONLY ) { 
-	Sinterp = get_flux_SEDMODEL(ISED, 0, ifilt_obs, z, Trest);	
+      if ( NMATCH == NGRIDONLY ) {
+	ISED_CACHE_GRIDONLY = ISED ;  // Aug 2026
+	load_SED_SIMSED(ISED);  // no-op unless lazy mode, Aug 2026
+	Sinterp = get_flux_SEDMODEL(ISED, 0, ifilt_obs, z, Trest);
 	ISED_SEDMODEL = ISED; // set globa, Mar 6 2017
 
 	// load *lumipar array
@@ -1808,6 +2008,7 @@ double interp_flux_SIMSED(
        * multiply term by distance weightings for each
        * dimension.
        */
+      load_SED_SIMSED(corners[i] + 1);  // no-op unless lazy mode, Aug 2026
       term = get_flux_SEDMODEL(corners[i] + 1, 0, ifilt_obs, z, Trest);
       ISED_SEDMODEL = corners[0]+1;
       
@@ -1921,6 +2122,9 @@ double interp1D_flux_SIMSED(
 
   ilampow = 0;
 
+  load_SED_SIMSED(I0SED);  // no-op unless lazy mode, Aug 2026
+  load_SED_SIMSED(I1SED);
+
   S0int = get_flux_SEDMODEL(I0SED, ilampow, ifilt_obs, z, Trest );
   S1int = get_flux_SEDMODEL(I1SED, ilampow, ifilt_obs, z, Trest );
   
@@ -10,6 +10,7 @@
 #define OPTMASK_INIT_SIMSED_BINARY    1  // --> make binary file
 #define OPTMASK_INIT_SIMSED_TESTMODE  64 // used by SIMSED_check program
 #define OPTMASK_INIT_SIMSED_BATCH    128 // batch mode -> abort on stale binary
+#define OPTMASK_INIT_SIMSED_LAZY     256 // defer SED-read to first use (Aug 2026)
 
 
 #define INFO_SIMSED_FILENAME  "SED.INFO" 
@@ -46,6 +47,19 @@ char SIMSED_PATHMODEL[MXPATHLEN];
 char SIMSED_KCORFILE[MXPATHLEN];
 char SIMSED_PATHBINARY[MXPATHLEN]; // July 30 2017
 
+// Aug 2026: info for lazy SED-loading (see OPTMASK_INIT_SIMSED_LAZY).
+// Record fseek-offset of each SED record in SED.BINARY so that each
+// SED surface is read (and its flux-integrals computed) only when
+// it is first sampled by the generator; init time then scales with
+// the number of SEDs used instead of with the full grid size.
+struct {
+  int   USEFLAG ;               // T => lazy SED-loading is active
+  FILE *FPBIN ;                 // SED.BINARY left open in read mode
+  long  OFFSET[MXSEDMODEL];     // fseek offset of each SED record
+  int   ISLOADED[MXSEDMODEL];   // T => this SED surface is loaded
+  int   NLOADED ;               // number of SED surfaces loaded so far
+} SIMSED_LAZYLOAD ;
+
 /**********************************************
    Function Declarations
 **********************************************/
@@ -66,6 +80,9 @@ void dump_SIMSED_INFO(void);
 void open_SEDBINARY(char *fileName, FILE **fpbin, int *RDFLAG, int *WRFLAG);
 void open_TABBINARY(char *fileName, FILE **fpbin, int *RDFLAG, int *WRFLAG);
 
+void init_SIMSED_LAZYLOAD(FILE *fpbin);
+void load_SED_SIMSED(int ised);
+
 void read_SIMSED_TABBINARY(FILE *fp, char *binFile);
 
 void genmag_SIMSED(int OPTMASK, int ifilt, double x0, 
@@ -223,8 +223,22 @@ int init_genmag_mlcs2k2(
 
       if ( NFILT_MLCS2k2 == 1 ) {
 	// store min/max Trest for template
-	TMINDAY_MLCS2k2 = TEMPLATE_DAYS_MLCS2k2[0] ;  
-	TMAXDAY_MLCS2k2 = TEMPLATE_DAYS_MLCS2k2[NDAY_MLCS2k2-1] ; 
+	TMINDAY_MLCS2k2 = TEMPLATE_DAYS_MLCS2k2[0] ;
+	TMAXDAY_MLCS2k2 = TEMPLATE_DAYS_MLCS2k2[NDAY_MLCS2k2-1] ;
+
+	// Aug 2026: flag uniform day grid for fast JDATES lookup
+	DAYBIN_MLCS2k2 = -9.0 ;
+	if ( NDAY_MLCS2k2 > 1 ) {
+	  double DAYBIN_TMP =
+	    (TMAXDAY_MLCS2k2-TMINDAY_MLCS2k2)/(double)(NDAY_MLCS2k2-1) ;
+	  DAYBIN_MLCS2k2 = DAYBIN_TMP ;
+	  for ( jdum=1; jdum < NDAY_MLCS2k2; jdum++ ) {
+	    tmp_day = TEMPLATE_DAYS_MLCS2k2[jdum]
+	            - TEMPLATE_DAYS_MLCS2k2[jdum-1] ;
+	    if ( fabs(tmp_day - DAYBIN_TMP) > 1.0E-6 )
+	      { DAYBIN_MLCS2k2 = -9.0 ; }
+	  }
+	}
       }
       else {
 	tmpmin = TEMPLATE_DAYS_MLCS2k2[0] ; 
@@ -404,6 +418,11 @@ void JDATES ( double Trest, int *j1, int *j2 ) {
 
   // return integer indices j1 and j2 such that
   // TEMPLATE_DAYS_MLCS2k2[j1,j2] bracket Trest
+  //
+  // Aug 2026: start from index arithmetic on the uniform day grid
+  // (set in init_genmag_mlcs2k2) and adjust against the actual day
+  // values, instead of scanning all days from the start; same j1,j2
+  // as the old scan, but O(1) per call on a uniform grid.
 
   int j;
 
@@ -412,15 +431,23 @@ void JDATES ( double Trest, int *j1, int *j2 ) {
   *j1 = 0 ;  // init
   *j2 = 1 ;
 
-  for(j=0; j < NDAY_MLCS2k2; j++ ) {
-    if ( TEMPLATE_DAYS_MLCS2k2[j] > Trest ){
-      *j1 = j-1 ;
-      *j2 = j ;
-      break ;
-    }
-  }
+  if ( DAYBIN_MLCS2k2 > 0.0 )
+    { j = (int)((Trest - TMINDAY_MLCS2k2)/DAYBIN_MLCS2k2) + 1 ; }
+  else
+    { j = 1 ; }  // non-uniform day grid; advance below
 
-  if ( *j1 < 0 ) { *j1=0; *j1=1 ; }
+  if ( j < 1 )              { j = 1 ; }
+  if ( j > NDAY_MLCS2k2 )   { j = NDAY_MLCS2k2 ; }
+
+  // settle on first index with TEMPLATE_DAYS > Trest
+  while ( j < NDAY_MLCS2k2 && TEMPLATE_DAYS_MLCS2k2[j] <= Trest ) { j++ ; }
+  while ( j > 1 && TEMPLATE_DAYS_MLCS2k2[j-1] > Trest )           { j-- ; }
+
+  // leave init values if no day exceeds Trest (as in the old scan)
+  if ( j < NDAY_MLCS2k2 && TEMPLATE_DAYS_MLCS2k2[j] > Trest ) {
+    *j1 = j-1 ;
+    *j2 = j ;
+  }
 
 }  // end of JDATES
 
@@ -28,6 +28,7 @@ double TEMPLATE_DAYS_MLCS2k2[MAXDAYS_MLCS2k2];
 int    NDAY_MLCS2k2;
 int    NFILT_MLCS2k2; // either 5 or 6-9
 double TMINDAY_MLCS2k2, TMAXDAY_MLCS2k2 ;
+double DAYBIN_MLCS2k2 ; // uniform day-bin size; < 0 if grid not uniform
 char   FILTSTRING_MLCS2k2[20]  ;
 char   PATHMODEL_MLCS2k2[200] ;
 int    IDAYPEAK_MLCS2k2 ;  // day-index for peakmag
@@ -154,6 +154,81 @@ double tLCLAF(double zS, double lobs) {
     
 }
 
+void prep_Inoue_table(double lobsmin, double lobsmax, int nlobs,
+                      double zmin, double zmax, int nz) {
+    /* Aug 2026: precompute transmission exp(-tau) on a uniform
+       (lobs,zS) grid so that repeated IGM evaluations inside
+       wavelength loops become a bilinear lookup (get_Inoue_trans)
+       instead of four Lyman-series/continuum summations per call.
+       Call after read_Inoue_coeffs(). */
+
+    int iz, il;
+    double zS, lobs, tau;
+
+    INOUE_TABLE_NLOBS   = nlobs;
+    INOUE_TABLE_NZ      = nz;
+    INOUE_TABLE_LOBSMIN = lobsmin;
+    INOUE_TABLE_DLOBS   = (lobsmax - lobsmin) / (double)(nlobs - 1);
+    INOUE_TABLE_ZMIN    = zmin;
+    INOUE_TABLE_DZ      = (zmax - zmin) / (double)(nz - 1);
+
+    if (INOUE_TABLE_TRANS != NULL) { free(INOUE_TABLE_TRANS); }
+    INOUE_TABLE_TRANS = malloc(sizeof(double)*nz*nlobs);
+    if (INOUE_TABLE_TRANS == NULL) {
+        fprintf(stderr,"  Can't allocate Inoue transmission table!\n");
+        exit(1);
+    }
+
+    for (iz=0; iz<nz; ++iz) {
+        zS = zmin + (double)iz * INOUE_TABLE_DZ;
+        for (il=0; il<nlobs; ++il) {
+            lobs = lobsmin + (double)il * INOUE_TABLE_DLOBS;
+            tau  = tLSLAF(zS,lobs) + tLCLAF(zS,lobs)
+                 + tLSDLA(zS,lobs) + tLCDLA(zS,lobs);
+            INOUE_TABLE_TRANS[iz*nlobs + il] = exp(-tau);
+        }
+    }
+
+}
+
+double get_Inoue_trans(double zS, double lobs) {
+    /* Return IGM transmission exp(-tau) via bilinear interpolation
+       of the table filled by prep_Inoue_table; arguments outside the
+       table range are clamped to the grid edges.  Falls back to the
+       direct summations if no table has been prepared. */
+
+    int iz, il, nlobs;
+    double xz, xl, fz, fl, t00, t01, t10, t11, tau;
+
+    if (INOUE_TABLE_TRANS == NULL) {
+        tau = tLSLAF(zS,lobs) + tLCLAF(zS,lobs)
+            + tLSDLA(zS,lobs) + tLCDLA(zS,lobs);
+        return exp(-tau);
+    }
+
+    nlobs = INOUE_TABLE_NLOBS;
+
+    xz = (zS   - INOUE_TABLE_ZMIN)    / INOUE_TABLE_DZ;
+    xl = (lobs - INOUE_TABLE_LOBSMIN) / INOUE_TABLE_DLOBS;
+    if (xz < 0.0) { xz = 0.0; }
+    if (xl < 0.0) { xl = 0.0; }
+    if (xz > (double)(INOUE_TABLE_NZ-1)) { xz = (double)(INOUE_TABLE_NZ-1); }
+    if (xl > (double)(nlobs-1))          { xl = (double)(nlobs-1); }
+
+    iz = (int)xz;   if (iz > INOUE_TABLE_NZ-2) { iz = INOUE_TABLE_NZ-2; }
+    il = (int)xl;   if (il > nlobs-2)          { il = nlobs-2; }
+    fz = xz - (double)iz;
+    fl = xl - (double)il;
+
+    t00 = INOUE_TABLE_TRANS[ iz   *nlobs + il  ];
+    t01 = INOUE_TABLE_TRANS[ iz   *nlobs + il+1];
+    t10 = INOUE_TABLE_TRANS[(iz+1)*nlobs + il  ];
+    t11 = INOUE_TABLE_TRANS[(iz+1)*nlobs + il+1];
+
+    return   t00*(1.0-fz)*(1.0-fl) + t01*(1.0-fz)*fl
+           + t10*fz*(1.0-fl)       + t11*fz*fl;
+}
+
 // int main() {
 //     double zS = 5.;
 //     double lrest, lobs, tau;
@@ -22,3 +22,13 @@ double tLCLAF();
 double tLSDLA();
 double tLCDLA();
 
+//// Aug 2026: optional precomputed transmission table over (lobs,zS)
+//// with bilinear interpolation; avoids the per-call Lyman-series
+//// summations when IGM attenuation is needed inside lambda loops.
+double *INOUE_TABLE_TRANS;    // NULL until prep_Inoue_table is called
+int    INOUE_TABLE_NLOBS, INOUE_TABLE_NZ;
+double INOUE_TABLE_LOBSMIN, INOUE_TABLE_DLOBS;
+double INOUE_TABLE_ZMIN,    INOUE_TABLE_DZ;
+void   prep_Inoue_table();
+double get_Inoue_trans();
+
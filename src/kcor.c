@@ -256,13 +256,21 @@ int main(int argc, char **argv) {
   // read SN spectra and filter responses
   if ( kcor_ini() != SUCCESS ) { madend(1) ;  }
 
+  // Aug 2026: compute per-filter & SED content hashes; written to
+  // output header and used for incremental regeneration.
+  compute_hash_kcor();
+
   // allocate memory for multi-dimensional arrays.
   if ( malloc_ini() != SUCCESS ) { madend(1) ; }
 
-  // determine SN color mag vs. day for each filter 
+  // determine SN color mag vs. day for each filter
   if ( snmag() != SUCCESS ) { madend(1) ; }
 
-  //  do K-cor grid vs. redshifts, and days 
+  // Aug 2026: check option to copy tables of unchanged filters
+  // from a previous output instead of recomputing them.
+  prep_incremental_kcor();
+
+  //  do K-cor grid vs. redshifts, and days
   if ( kcor_grid() != SUCCESS ) { madend(1) ;  }
 
   // write output 
@@ -364,6 +372,7 @@ int rd_input(void) {
   INPUTS.N_OUTFILE = 0 ;
   sprintf(INPUTS.OUTFILE[0],     "NULL" );
   sprintf(INPUTS.OUTFILE[1],     "NULL" );
+  sprintf(INPUTS.INCREMENTAL_FILE, "NULL" );
   FILTSYSTEM.NAME[0]      = 0 ;
   FILTSYSTEM.INDX       = 0;
 
@@ -765,9 +774,14 @@ int rd_input(void) {
 
     if ( strcmp(c_get,"OUTFILE:")==0 ) {
       i = INPUTS.N_OUTFILE ;
-      readchar ( fp_input, INPUTS.OUTFILE[i] ); 
+      readchar ( fp_input, INPUTS.OUTFILE[i] );
       INPUTS.N_OUTFILE++ ;
     }
+
+    // Aug 2026: previous output for incremental regeneration
+    if ( strcmp(c_get,"INCREMENTAL_FILE:")==0 )
+      { readchar ( fp_input, INPUTS.INCREMENTAL_FILE ); }
+
     // -----------
 
     if ( strcmp(c_get,"DUMP_SNMAG:")==0 ) 
@@ -1303,7 +1317,11 @@ void kcor_input_override(int OPT) {
 
     // -----------------
     if ( strcmp( ARGV_LIST[i],"OUTFILE") == 0 ) {
-      i++ ; sscanf(ARGV_LIST[i] , "%s", INPUTS.OUTFILE[0] ); 
+      i++ ; sscanf(ARGV_LIST[i] , "%s", INPUTS.OUTFILE[0] );
+    }
+
+    if ( strcmp( ARGV_LIST[i],"INCREMENTAL_FILE") == 0 ) {
+      i++ ; sscanf(ARGV_LIST[i] , "%s", INPUTS.INCREMENTAL_FILE );
     }
     // ----------
 
@@ -3214,6 +3232,16 @@ int kcor_grid (void) {
 	    else
 	      { FLAG_MAGOBS = 0; }
 
+	    // Aug 2026: skip evaluation if this table was copied from
+	    // a previous output (both filters unchanged) and the obs
+	    // mags are already filled; see prep_incremental_kcor().
+	    if ( INCREMENTAL_KCOR.SKIP_TABLE[ikcor] && FLAG_MAGOBS == 0 ) {
+	      kcor = (double)R4KCOR_GRID.VALUE[ikcor][i_av][i_z][i_epoch] ;
+	      if ( kcor > kcormax ) { kcormax = kcor ; }
+	      if ( kcor < kcormin ) { kcormin = kcor ; }
+	      continue ;
+	    }
+
             kcor_eval( OPT
 		       ,av, z, epoch
 		       ,ifilt_rest, ifilt_obs 
@@ -3283,6 +3311,303 @@ int kcor_grid (void) {
 } // end of kcor_grid
 
 
+// *************************************************
+unsigned long long hash_data_kcor(unsigned long long hash,
+				  int NVAL, double *data) {
+
+  // Created Aug 2026
+  // Return FNV-1a hash over the raw bytes of *data.
+  // Pass hash=0 to start a new hash, or a previous return
+  // value to chain several arrays into one hash.
+
+  unsigned char *ptr = (unsigned char*)data ;
+  int i, NBYTE = NVAL * (int)sizeof(double) ;
+
+  // -------------- BEGIN --------------
+
+  if ( hash == 0 ) { hash = 0xCBF29CE484222325ULL ; }
+
+  for ( i=0; i < NBYTE; i++ ) {
+    hash ^= (unsigned long long)ptr[i] ;
+    hash *= 0x100000001B3ULL ;
+  }
+  return hash ;
+
+} // end of hash_data_kcor
+
+
+// *************************************************
+void compute_hash_kcor(void) {
+
+  // Created Aug 2026
+  // Compute content hash for each filter (LAMBDA+TRANS) and for the
+  // SN SED (EPOCH+FLUX_WAVE). The hashes are written to the output
+  // FITS header so that a later kcor job can detect which filters
+  // changed and re-use the unchanged tables (INCREMENTAL_FILE key).
+
+  int ifilt, iep, NBL ;
+  unsigned long long hash ;
+  //  char fnam[] = "compute_hash_kcor" ;
+
+  // -------------- BEGIN --------------
+
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+    NBL  = FILTER[ifilt].NBIN_LAMBDA ;
+    hash = hash_data_kcor(0,    NBL, &FILTER[ifilt].LAMBDA[1] );
+    hash = hash_data_kcor(hash, NBL, &FILTER[ifilt].TRANS[1]  );
+    FILTER[ifilt].HASH = hash ;
+  }
+
+  hash = hash_data_kcor(0, SNSED.NEPOCH, &SNSED.EPOCH[1] );
+  for ( iep=1; iep <= SNSED.NEPOCH; iep++ ) {
+    hash = hash_data_kcor(hash, SNSED.NBIN_LAMBDA,
+			  &SNSED.FLUX_WAVE[iep][1] );
+  }
+  SNSED.HASH = hash ;
+
+  return ;
+
+} // end of compute_hash_kcor
+
+
+// *************************************************
+void prep_incremental_kcor(void) {
+
+  // Created Aug 2026
+  // If the user supplied an INCREMENTAL_FILE (previous kcor output
+  // in fits format), compare its per-filter content hashes against
+  // the current filters. Kcor tables whose rest- and obs-frame
+  // filters are both unchanged are copied from the previous file,
+  // along with the obs-frame mags + MW slopes of each unchanged
+  // filter, so that kcor_grid re-evaluates only tables involving a
+  // changed filter. Tables are copied only if the SN SED and the
+  // full AV x z x Trest binning match the previous file exactly.
+  //
+  // Any problem with the previous file (missing, no hash keys,
+  // different binning ...) falls back to full regeneration with a
+  // warning instead of aborting.
+
+  char  *prevFile = INPUTS.INCREMENTAL_FILE ;
+  long   NROW_EXPECT, NROW ;
+  int    istat, anynul, icol, irow ;
+  int    i, ifilt, ikcor, ifilt_rest, ifilt_obs, lenf ;
+  int    iav, iz, iday ;
+  int    NBT, NBZ, NBAV, NFILT_PREV ;
+  float  TMIN, TMAX, ZMIN, ZMAX, AVMIN, AVBIN, fnull = 0.0 ;
+  float *BUF_VAL, *BUF_MAG, *BUF_SLP ;
+  unsigned long long hash_prev ;
+  fitsfile *fp ;
+  char   KEYNAME[40], KEYVAL[80], NAME_PREV[80], LABEL[80] ;
+  char   MAGSYS[60], CFILT[2] ;
+  char   fnam[] = "prep_incremental_kcor" ;
+
+  // -------------- BEGIN --------------
+
+  INCREMENTAL_KCOR.USE = INCREMENTAL_KCOR.MATCH_GRID = 0 ;
+  INCREMENTAL_KCOR.NSKIP_TABLE = INCREMENTAL_KCOR.NSKIP_MAG = 0 ;
+  for ( ifilt=0; ifilt < MXFILTDEF; ifilt++ )
+    { INCREMENTAL_KCOR.MATCH_FILTER[ifilt] = 0 ; }
+  for ( ikcor=0; ikcor < MXKCOR; ikcor++ )
+    { INCREMENTAL_KCOR.SKIP_TABLE[ikcor] = 0 ; }
+
+  if ( strcmp(prevFile,"NULL") == 0 ) { return ; }
+
+  printf("\n  %s: compare against previous output \n\t %s \n",
+	 fnam, prevFile );
+  fflush(stdout);
+
+  istat = 0 ;
+  fits_open_file(&fp, prevFile, READONLY, &istat);
+  if ( istat != 0 ) {
+    printf("\t WARNING: cannot open previous output "
+	   "-> full regeneration.\n");
+    fflush(stdout);
+    return ;
+  }
+
+  // - - - - - - - - - - - - - - - - - -
+  // require identical AV x z x Trest binning and SN SED
+
+  istat = 0 ;
+  fits_read_key(fp, TINT,   "NBT",   &NBT,   NULL, &istat );
+  fits_read_key(fp, TFLOAT, "TMIN",  &TMIN,  NULL, &istat );
+  fits_read_key(fp, TFLOAT, "TMAX",  &TMAX,  NULL, &istat );
+  fits_read_key(fp, TINT,   "NBZ",   &NBZ,   NULL, &istat );
+  fits_read_key(fp, TFLOAT, "ZMIN",  &ZMIN,  NULL, &istat );
+  fits_read_key(fp, TFLOAT, "ZMAX",  &ZMAX,  NULL, &istat );
+  fits_read_key(fp, TINT,   "NBAV",  &NBAV,  NULL, &istat );
+  fits_read_key(fp, TFLOAT, "AVMIN", &AVMIN, NULL, &istat );
+  fits_read_key(fp, TFLOAT, "AVBIN", &AVBIN, NULL, &istat );
+  fits_read_key(fp, TSTRING,"SEDHASH", KEYVAL, NULL, &istat );
+
+  sprintf(c1err, "%016llX", SNSED.HASH );
+
+  INCREMENTAL_KCOR.MATCH_GRID =
+    ( istat == 0
+      && NBT  == SNSED.NEPOCH
+      && fabsf(TMIN  - (float)SNSED.TREST_MIN)       < 1.0E-4
+      && fabsf(TMAX  - (float)SNSED.TREST_MAX)       < 1.0E-4
+      && NBZ  == INPUTS.NBIN_REDSHIFT
+      && fabsf(ZMIN  - (float)INPUTS.REDSHIFT_MIN)   < 1.0E-6
+      && fabsf(ZMAX  - (float)INPUTS.REDSHIFT_MAX)   < 1.0E-6
+      && NBAV == INPUTS.NBIN_AV
+      && fabsf(AVMIN - (float)INPUTS.AV_MIN)         < 1.0E-6
+      && fabsf(AVBIN - (float)INPUTS.AV_BINSIZE)     < 1.0E-6
+      && strcmp(KEYVAL,c1err) == 0 ) ;
+
+  if ( !INCREMENTAL_KCOR.MATCH_GRID ) {
+    printf("\t WARNING: binning or SN SED changed "
+	   "-> full regeneration.\n");
+    fflush(stdout);
+    fits_close_file(fp, &istat);
+    return ;
+  }
+
+  // - - - - - - - - - - - - - - - - - -
+  // match previous filters by name and compare content hashes
+
+  istat = 0 ;
+  fits_read_key(fp, TINT, "NFILTERS", &NFILT_PREV, NULL, &istat );
+  if ( istat != 0 ) { fits_close_file(fp, &istat); return ; }
+
+  for ( i=1; i <= NFILT_PREV; i++ ) {
+
+    istat = 0 ;
+    sprintf(KEYNAME, "FILT%3.3d", i );
+    fits_read_key(fp, TSTRING, KEYNAME, NAME_PREV, NULL, &istat );
+    sprintf(KEYNAME, "HASH%3.3d", i );
+    fits_read_key(fp, TSTRING, KEYNAME, KEYVAL,    NULL, &istat );
+    if ( istat != 0 ) { continue ; } // e.g., file predates hash keys
+
+    sscanf(KEYVAL, "%llX", &hash_prev );
+
+    for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+      if ( strcmp(FILTER[ifilt].name,NAME_PREV) == 0 &&
+	   FILTER[ifilt].HASH == hash_prev )
+	{ INCREMENTAL_KCOR.MATCH_FILTER[ifilt] = 1 ; }
+    }
+  }
+
+  // - - - - - - - - - - - - - - - - - -
+  // copy kcor tables for which both filters are unchanged;
+  // row order matches the loops in wr_fits_KCOR.
+
+  NROW_EXPECT = (long)INPUTS.NBIN_AV * (long)INPUTS.NBIN_REDSHIFT
+    * (long)SNSED.NEPOCH ;
+
+  istat = 0 ;
+  fits_movnam_hdu(fp, BINARY_TBL, "KCOR", 0, &istat );
+  fits_get_num_rows(fp, &NROW, &istat );
+  if ( istat != 0 || NROW != NROW_EXPECT ) {
+    printf("\t WARNING: bad KCOR table in previous output "
+	   "-> full regeneration.\n");
+    fflush(stdout);
+    fits_close_file(fp, &istat);
+    return ;
+  }
+
+  BUF_VAL = (float*) malloc( NROW * sizeof(float) );
+
+  for ( ikcor=1; ikcor <= NKCOR; ikcor++ ) {
+
+    index_filter(ikcor, &ifilt_rest, &ifilt_obs );
+    if ( !INCREMENTAL_KCOR.MATCH_FILTER[ifilt_rest] ) { continue ; }
+    if ( !INCREMENTAL_KCOR.MATCH_FILTER[ifilt_obs]  ) { continue ; }
+
+    istat = 0 ;
+    fits_get_colnum(fp, CASEINSEN, KCORSYM[ikcor], &icol, &istat );
+    if ( istat != 0 ) { continue ; }  // kcor not in previous file
+
+    fits_read_col(fp, TFLOAT, icol, 1L, 1L, NROW,
+		  &fnull, BUF_VAL, &anynul, &istat );
+    if ( istat != 0 ) { continue ; }
+
+    irow = 0 ;
+    for ( iav=1;  iav  <= INPUTS.NBIN_AV;       iav++  ) {
+    for ( iz=1;   iz   <= INPUTS.NBIN_REDSHIFT; iz++   ) {
+    for ( iday=1; iday <= SNSED.NEPOCH;         iday++ ) {
+      R4KCOR_GRID.VALUE[ikcor][iav][iz][iday] = BUF_VAL[irow] ;
+      irow++ ;
+    } } }
+
+    INCREMENTAL_KCOR.SKIP_TABLE[ikcor] = 1 ;
+    INCREMENTAL_KCOR.NSKIP_TABLE++ ;
+
+  } // end ikcor
+
+  free(BUF_VAL);
+
+  // - - - - - - - - - - - - - - - - - -
+  // copy obs-frame mags + MW slopes of each unchanged filter;
+  // row order matches the loops in wr_fits_MAGS.
+
+  istat = 0 ;
+  fits_movnam_hdu(fp, BINARY_TBL, "MAG+MWXTCOR", 0, &istat );
+  fits_get_num_rows(fp, &NROW, &istat );
+  if ( istat != 0 || NROW != NROW_EXPECT ) {
+    // no mags -> nothing re-usable; kcor_grid recomputes everything
+    for ( ikcor=0; ikcor < MXKCOR; ikcor++ )
+      { INCREMENTAL_KCOR.SKIP_TABLE[ikcor] = 0 ; }
+    INCREMENTAL_KCOR.NSKIP_TABLE = 0 ;
+    printf("\t WARNING: bad MAG table in previous output "
+	   "-> full regeneration.\n");
+    fflush(stdout);
+    fits_close_file(fp, &istat);
+    return ;
+  }
+
+  BUF_MAG = (float*) malloc( NROW * sizeof(float) );
+  BUF_SLP = (float*) malloc( NROW * sizeof(float) );
+
+  for ( ifilt=1; ifilt <= NFILTDEF; ifilt++ ) {
+
+    if ( !INCREMENTAL_KCOR.MATCH_FILTER[ifilt] ) { continue ; }
+
+    lenf = strlen(FILTER[ifilt].name);
+    sprintf(CFILT,  "%c", FILTER[ifilt].name[lenf-1]   );
+    sprintf(MAGSYS, "%s", FILTER[ifilt].MAGSYSTEM_NAME );
+
+    istat = 0 ;
+    sprintf(LABEL, "MAGOBS_%s(%s)", CFILT, MAGSYS );
+    fits_get_colnum(fp, CASEINSEN, LABEL, &icol, &istat );
+    fits_read_col(fp, TFLOAT, icol, 1L, 1L, NROW,
+		  &fnull, BUF_MAG, &anynul, &istat );
+
+    sprintf(LABEL, "MWXT_SLOPE_%s(%s)", CFILT, MAGSYS );
+    fits_get_colnum(fp, CASEINSEN, LABEL, &icol, &istat );
+    fits_read_col(fp, TFLOAT, icol, 1L, 1L, NROW,
+		  &fnull, BUF_SLP, &anynul, &istat );
+
+    if ( istat != 0 ) { continue ; }
+
+    irow = 0 ;
+    for ( iav=1;  iav  <= INPUTS.NBIN_AV;       iav++  ) {
+    for ( iz=1;   iz   <= INPUTS.NBIN_REDSHIFT; iz++   ) {
+    for ( iday=1; iday <= SNSED.NEPOCH;         iday++ ) {
+      SNSED.R4MAG_OBS[0][ifilt][iav][iz][iday] = BUF_MAG[irow] ;
+      SNSED.MW_dXT_dEBV[ifilt][iav][iz][iday]  = (double)BUF_SLP[irow] ;
+      irow++ ;
+    } } }
+
+    INCREMENTAL_KCOR.NSKIP_MAG++ ;
+
+  } // end ifilt
+
+  free(BUF_MAG);  free(BUF_SLP);
+
+  istat = 0 ;
+  fits_close_file(fp, &istat);
+  INCREMENTAL_KCOR.USE = 1 ;
+
+  printf("  %s: re-use %d of %d kcor tables and mags for %d filters.\n",
+	 fnam, INCREMENTAL_KCOR.NSKIP_TABLE, NKCOR,
+	 INCREMENTAL_KCOR.NSKIP_MAG );
+  fflush(stdout);
+
+  return ;
+
+} // end of prep_incremental_kcor
+
 
 // *************************************************
 void kcor_eval(int opt                // (I) K cor option ("E" or "N")
@@ -4579,9 +4904,25 @@ void wr_fits_HEAD(fitsfile *fp) {
     // xxxx sprintf(MSG,"Filter name; SURVEY=%s", FILTER[ifilt].SURVEY_NAMES);
     sprintf(MSG,"name; SURVEY=%s", FILTER[ifilt].SURVEY_NAMES);
     fits_update_key(fp, TSTRING, KEYNAME, FILTER[ifilt].name,
-		    MSG, &istat );    
+		    MSG, &istat );
    }
 
+  // Aug 2026: per-filter and SED content hashes; a later kcor job
+  // with INCREMENTAL_FILE pointing here re-uses the tables whose
+  // hashes match (see prep_incremental_kcor).
+  for ( ifilt = 1; ifilt <= NFILTDEF ; ifilt++ ) {
+    sprintf(KEYNAME,"HASH%3.3d", ifilt);
+    sprintf(KEYVAL, "%016llX",   FILTER[ifilt].HASH );
+    istat = 0 ;
+    fits_update_key(fp, TSTRING, KEYNAME, KEYVAL,
+		    "content hash of filter trans", &istat );
+  }
+
+  sprintf(KEYVAL, "%016llX", SNSED.HASH );
+  istat = 0 ;
+  fits_update_key(fp, TSTRING, "SEDHASH", KEYVAL,
+		  "content hash of SN SED", &istat );
+
   if ( NKCOR > 0 ) {
     // RV used for MW extinction and warping
     float RV = (float)INPUTS.RV_MWCOLORLAW;
@@ -87,6 +87,10 @@ struct INPUTS {
   char OUTFILE[MXOUTFILE][200];    // (I) xxx.his and or xxx.fits
   char FORMAT_FLAG[MXOUTFILE];     // internally set; format flag(s)
 
+  // Aug 2026: previous kcor-output (fits) for incremental regeneration;
+  // tables whose filters are unchanged are copied instead of recomputed.
+  char INCREMENTAL_FILE[200];      // (I) previous kcor output
+
   char FILTPATH[200];             // (I) path for filter trans files 
   char FILTPATH_ORIG[200];        // (I) idem before ENVreplace (7/2020)
   char FILTPATH_replace1[200];   
@@ -219,6 +223,9 @@ struct SNSED {
   // define change in obs mag w.r.t. MW E(B-V)
   double ****MW_dXT_dEBV ;
 
+  // Aug 2026: content hash of EPOCH+FLUX_WAVE for incremental regen
+  unsigned long long HASH ;
+
 } SNSED ;
 
 
@@ -332,6 +339,10 @@ struct  FILTER
 
   OOB_DEF OOB; // out-of-band info
 
+  // Aug 2026: content hash of LAMBDA+TRANS, written to the output
+  // header so a later run can detect which filters changed.
+  unsigned long long HASH ;
+
 } FILTER[MXFILTDEF] ;
 
 
@@ -341,10 +352,20 @@ double FILTER_LAMBDA_MIN; // min lambda ...
 
 struct R4KCOR_GRID {
   float ****VALUE ;
-  float ****REDSHIFT ;         // z in same bins 
-  float ****EPOCH ;            // rest frame day in same bins 
+  float ****REDSHIFT ;         // z in same bins
+  float ****EPOCH ;            // rest frame day in same bins
 } R4KCOR_GRID ;
 
+// Aug 2026: bookkeeping for incremental regeneration from a previous
+// kcor output (INCREMENTAL_FILE key); see prep_incremental_kcor().
+struct INCREMENTAL_KCOR {
+  int USE ;                      // previous file read OK
+  int MATCH_GRID ;               // binning + SN SED match previous file
+  int MATCH_FILTER[MXFILTDEF] ;  // filter hash matches previous file
+  int SKIP_TABLE[MXKCOR] ;       // kcor table copied from previous file
+  int NSKIP_TABLE, NSKIP_MAG ;   // summary counters
+} INCREMENTAL_KCOR ;
+
 
 // K cor list applies to the grid and to the lightcurve list
 int  NKCOR;                    // (I) No. K correction matrices to make 
@@ -391,6 +412,12 @@ void  set_kcorFile_format(void) ;
 int   malloc_ini(void);
 int   kcor_out(void) ;
 int   kcor_grid(void) ;
+
+// Aug 2026: incremental regeneration utilities
+unsigned long long hash_data_kcor(unsigned long long hash,
+				  int NVAL, double *data);
+void  compute_hash_kcor(void);
+void  prep_incremental_kcor(void);
 void  primarymag_zp(int iprim);  // integrated fluxes, mags, and zero points/
 void  primarymag_zp2(int iprim);
 void  primarymag_summary(int iprim); 
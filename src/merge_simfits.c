@@ -0,0 +1,176 @@
+/* ====================================
+
+  Created Aug 2026
+
+  Merge GENVERSION fragments written as HEAD/PHOT fits file pairs
+  (e.g., parallel sim jobs writing the same GENVERSION in pieces)
+  into a single HEAD/PHOT pair. The PHOT tables are row-concatenated
+  without decoding the photometry payload (cfitsio raw row copy);
+  only the PTROBS_MIN[MAX] light-curve pointers in the appended HEAD
+  rows are read back and shifted so that they index the merged PHOT
+  table. Global header keys come from the first fragment.
+
+  This replaces script-level merges that parse and rewrite every
+  event; see MERGE_SNFITSIO_SPLIT in sntools_dataformat_fits.c for
+  the underlying merge.
+
+  Each input argument is a HEAD fits file; the matching PHOT file
+  name is derived by replacing HEAD -> PHOT, per the sim file-name
+  convention [VERSION]_HEAD.FITS & [VERSION]_PHOT.FITS.
+
+  USAGE:
+  merge_simfits.exe -outPrefix <MERGED_VERSION> \
+       <headFile1> <headFile2> ...
+     [creates MERGED_VERSION_HEAD.FITS and MERGED_VERSION_PHOT.FITS]
+
+===================================== */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include "sntools.h"
+#include "fitsio.h"
+#include "sntools_dataformat_fits.h"
+
+// -------- global variables ------------
+
+#define MXFILE_MERGE 1000   // max number of HEAD/PHOT pairs to merge
+
+struct {
+  int  NFILE_MERGE ;
+  char *HEADFILE_LIST[MXFILE_MERGE];
+  char *PHOTFILE_LIST[MXFILE_MERGE];
+  char OUTPREFIX[MXPATHLEN];
+} INPUTS ;
+
+// ------- function prototypes ----------
+
+void parse_args_merge(int argc, char **argv);
+void photFile_from_headFile(char *headFile, char *photFile);
+
+// =============================
+int main(int argc, char **argv) {
+
+  char headFile_out[MXPATHLEN], photFile_out[MXPATHLEN];
+  //  char fnam[] = "main" ;
+
+  // ------------ BEGIN ------------
+
+  sprintf(BANNER,"Begin execution of merge_simfits.exe" );
+  print_banner(BANNER);
+
+  parse_args_merge(argc, argv);
+
+  sprintf(headFile_out, "%s_HEAD.FITS", INPUTS.OUTPREFIX );
+  sprintf(photFile_out, "%s_PHOT.FITS", INPUTS.OUTPREFIX );
+
+  MERGE_SNFITSIO_SPLIT(INPUTS.NFILE_MERGE,
+		       INPUTS.HEADFILE_LIST, INPUTS.PHOTFILE_LIST,
+		       headFile_out, photFile_out );
+
+  printf("\n Created %s \n", headFile_out);
+  printf(" Created %s \n",   photFile_out);
+  printf("\n Done. \n"); fflush(stdout);
+
+  return(0);
+
+} // end of main
+
+
+// =============================
+void parse_args_merge(int argc, char **argv) {
+
+  int i, NFILE=0 ;
+  char fnam[] = "parse_args_merge" ;
+
+  // ------------ BEGIN ------------
+
+  INPUTS.OUTPREFIX[0] = 0 ;
+
+  if ( argc < 4 ) {
+    sprintf(c1err,"Must give -outPrefix and at least 2 HEAD files;");
+    sprintf(c2err,"see usage in merge_simfits.c");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  i = 1;
+  while ( i < argc ) {
+
+    if ( strcmp(argv[i],"-outPrefix") == 0 ) {
+      i++ ; sprintf(INPUTS.OUTPREFIX, "%s", argv[i] );
+      i++ ; continue ;
+    }
+
+    // anything else is a HEAD fits file
+    if ( NFILE >= MXFILE_MERGE ) {
+      sprintf(c1err,"NFILE exceeds bound MXFILE_MERGE=%d", MXFILE_MERGE);
+      sprintf(c2err,"Reduce number of fragments or raise bound.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    INPUTS.HEADFILE_LIST[NFILE] = (char*) malloc(MXPATHLEN*sizeof(char));
+    INPUTS.PHOTFILE_LIST[NFILE] = (char*) malloc(MXPATHLEN*sizeof(char));
+    sprintf(INPUTS.HEADFILE_LIST[NFILE], "%s", argv[i] );
+    photFile_from_headFile(INPUTS.HEADFILE_LIST[NFILE],
+			   INPUTS.PHOTFILE_LIST[NFILE] );
+    NFILE++ ;  i++ ;
+  }
+
+  INPUTS.NFILE_MERGE = NFILE ;
+
+  if ( strlen(INPUTS.OUTPREFIX) == 0 ) {
+    sprintf(c1err,"Missing required -outPrefix argument.");
+    sprintf(c2err,"see usage in merge_simfits.c");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  if ( NFILE < 2 ) {
+    sprintf(c1err,"Only %d HEAD file(s) given; need at least 2.", NFILE);
+    sprintf(c2err,"Nothing to merge.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  printf("   Merge %d HEAD/PHOT file pairs -> %s_[HEAD,PHOT].FITS \n",
+	 NFILE, INPUTS.OUTPREFIX ); fflush(stdout);
+
+  return ;
+
+} // end parse_args_merge
+
+
+// =============================
+void photFile_from_headFile(char *headFile, char *photFile) {
+
+  // Replace last occurrence of HEAD with PHOT to get the photometry
+  // file name that pairs with input *headFile; abort if headFile
+  // does not contain HEAD.
+
+  char *ptrHEAD, *ptrLast=NULL, *ptr ;
+  int  lenPrefix ;
+  char fnam[] = "photFile_from_headFile" ;
+
+  // ------------ BEGIN ------------
+
+  ptr = headFile ;
+  while ( (ptrHEAD = strstr(ptr,"HEAD")) != NULL )
+    { ptrLast = ptrHEAD;  ptr = ptrHEAD + 1 ; }
+
+  if ( ptrLast == NULL ) {
+    sprintf(c1err,"Cannot find 'HEAD' in file name");
+    sprintf(c2err,"%s", headFile );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  lenPrefix = (int)(ptrLast - headFile) ;
+  sprintf(photFile, "%.*sPHOT%s", lenPrefix, headFile, ptrLast+4 );
+
+  return ;
+
+} // end photFile_from_headFile
@@ -94,6 +94,7 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
   int   OPT_FLUXREF_AVG  = ( INPUTS.OPTMASK == 2 ) ;
 
   int   obs, Nobs[MXSEASON], Ndof[MXSEASON] ;
+  int   IOBS_BEGIN[MXSEASON], IOBS_END[MXSEASON] ; // Aug 2026
   int   *INDX_SORT, *INDX_SORT2,  *ISEASON;
   int   Nseason, iSeason, i, isort, Ntmp ;
   double MJD_LAST, XN, MJD, SNR, CHI2, WGT, SUMCHI2[MXSEASON] ;
@@ -159,12 +160,14 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
 
     MJD = MJD_LIST[isort] ;
     if ( MJD > MJD_LAST + INPUTS.TGAP ) {
-      iSeason++ ;      
-      MJDMIN[iSeason] = MJD ;
+      iSeason++ ;
+      MJDMIN[iSeason]     = MJD ;
+      IOBS_BEGIN[iSeason] = obs ; // Aug 2026: sorted position of 1st epoch
     }
     MJD_LAST = MJD ;
-    ISEASON[isort]  = iSeason;
-    MJDMAX[iSeason] = MJD ;
+    ISEASON[isort]    = iSeason;
+    MJDMAX[iSeason]   = MJD ;
+    IOBS_END[iSeason] = obs ;  // Aug 2026: sorted position of last epoch
     
     // compute weighted avg
     ERR   = FLUXERR_LIST[isort] ;
@@ -214,10 +217,14 @@ void GET_MULTISEASON(char *CCID, int NOBS, double *MJD_LIST,
     xxxxxxxxxxxx */
 
 
-    // build chi2_list for this season
-    for(obs=0; obs < NOBS; obs++ ) {
+    // build chi2_list for this season.
+    // Aug 2026: seasons are contiguous in MJD-sorted order, so loop
+    // over this season's sorted range (recorded in the sweep above)
+    // instead of re-scanning all NOBS epochs per season; epochs with
+    // FLUXERR <= 0 inside the range were never assigned a season.
+    for(obs=IOBS_BEGIN[iSeason]; obs <= IOBS_END[iSeason]; obs++ ) {
       isort = INDX_SORT[obs] ;
-      if ( iSeason == ISEASON[isort] ) {
+      if ( FLUXERR_LIST[isort] > 0.0 ) {
 	Nobs[iSeason]++ ;  
 	Ntmp = Nobs[iSeason] ;
 
@@ -471,8 +471,27 @@ double ***PSNID_MODEL_EPOCH, ****PSNID_MODEL_MAG, ****PSNID_MODEL_MAGERR,
 
 
 double PSNID_BIGN=1.e30, PSNID_SMALLN=1.e-30, PSNID_SPECZSIG=20.0;
+
+// Aug 2026: chi2-loop in psnid_best_calc_chisq quits early when the
+// accumulated chi2 exceeds this value; grid-compare sets it to the
+// current minimum on refinement passes, and back to PSNID_BIGN on the
+// final pass where exact chi2 is needed for the evidence sums.
+double PSNID_CHISQ_EARLYSTOP=1.e30;
 double PSNID_BASE_COLOR[PSNID_NTYPES];
 
+// Aug 2026: the interpolated model light curves depend only on the
+// GRID + namelist options, except for the additive Galactic extinction
+// that changes with each event. Cache the filled tensors per type after
+// the first event and just update the MW-extinction term in place for
+// later events (see psnid_best_model_cache_fetch), so the expensive
+// get_template_lc interpolation runs once per type instead of per event.
+struct PSNID_MODEL_CACHE_DEF {
+  int    VALID ;
+  double MWXTMAG[MXFILTINDX] ;  // MW extinction baked into MAG
+  double ***EPOCH ;
+  double ****MAG, ****MAGERR, ****EXTINCT, ****MWEXTINCT ;
+} PSNID_MODEL_CACHE[PSNID_NTYPES];
+
 
 struct SIMVAR_PSNID {
   int N, MODEL, ITYPE ;    
@@ -568,6 +587,8 @@ void psnid_best_setup_searchgrid();
 
 void psnid_best_model_alloc();
 void psnid_best_model_free();
+int  psnid_best_model_cache_fetch(int typeindex);
+void psnid_best_model_cache_store(int typeindex);
 
 void psnid_best_split_nonia_types(int *types, int optdebug);
 void psnid_best_set_grid_limits(int typeindex);
@@ -919,10 +940,15 @@ int PSNID_BEST_DOFIT(char *CCID, int NOBS, int *IFILT,
     // skip this type if there are no templates
     if ( PSNID_NGRID[i] == 0 ) { continue ; }
 
-    // set limits, allocate memory, and fill in global model arrays
+    // set limits, allocate memory, and fill in global model arrays;
+    // after the first event the interpolated model is re-used from
+    // the per-type cache and only the MW extinction is updated.
     psnid_best_set_grid_limits(i);
-    psnid_best_model_alloc();
-    psnid_best_set_grid_values(i, nonia_types);
+    if ( psnid_best_model_cache_fetch(i) == 0 ) {
+      psnid_best_model_alloc();
+      psnid_best_set_grid_values(i, nonia_types);
+      psnid_best_model_cache_store(i);
+    }
 
     // flag early and late epochs
     for (j=0; j<=NOBS; j++) { useobs[j] = 1 ; }  // use all points by default
@@ -973,7 +999,8 @@ int PSNID_BEST_DOFIT(char *CCID, int NOBS, int *IFILT,
     //////////////////////////////////////////////////////////////////
 
 
-    psnid_best_model_free();
+    // NOTE: model tensors are NOT freed here; they live on in
+    // PSNID_MODEL_CACHE for the next event (Aug 2026).
 
   }  // end i loop over PSNID_NTYPES
 
@@ -1815,6 +1842,92 @@ void psnid_best_model_free()
 // end of psnid_best_model_free
 
 
+/**********************************************************************/
+int psnid_best_model_cache_fetch(int typeindex)
+/**********************************************************************/
+{
+  // Created Aug 2026
+  // If the interpolated model tensors for this type were already
+  // built for an earlier event, point the global PSNID_MODEL_XXX
+  // arrays at the cached copies and update the additive Galactic
+  // extinction (the only per-event piece) in place.
+  // Function returns 1 if the cache is used; 0 on the first event
+  // for each type, in which case the caller must fill the tensors
+  // and call psnid_best_model_cache_store.
+
+  int    m, mfilt, this_filt, d, z, t ;
+  double XTMW, DIF ;
+  struct PSNID_MODEL_CACHE_DEF *CACHE = &PSNID_MODEL_CACHE[typeindex] ;
+
+  // ------------- BEGIN -------------
+
+  if ( CACHE->VALID == 0 ) { return 0 ; }
+
+  PSNID_MODEL_EPOCH     = CACHE->EPOCH ;
+  PSNID_MODEL_MAG       = CACHE->MAG ;
+  PSNID_MODEL_MAGERR    = CACHE->MAGERR ;
+  PSNID_MODEL_EXTINCT   = CACHE->EXTINCT ;
+  PSNID_MODEL_MWEXTINCT = CACHE->MWEXTINCT ;
+
+  // replace MW extinction of previous event with that of current event
+  for (m=1; m<=PSNID_NFILTER; m++) {
+    mfilt     = m-1 ;
+    this_filt = PSNID_INPUTS.IFILTLIST[mfilt];
+    if ( PSNID_INPUTS.USEFILT[this_filt] == 0 ) { continue ; }
+
+    XTMW = psnid_best_mwxtmag(mfilt);
+    DIF  = XTMW - CACHE->MWXTMAG[m] ;
+    if ( DIF == 0.0 ) { continue ; }
+
+    for (d=1; d<=PSNID_MAXNL; d++) {
+      for (z=1; z<=PSNID_MAXNZ; z++) {
+	for (t=1; t<=PSNID_MAXND; t++) {
+	  PSNID_MODEL_MAG[m][d][z][t] += DIF ;
+	}
+      }
+    }
+    CACHE->MWXTMAG[m] = XTMW ;
+  }
+
+  return 1 ;
+}
+// end of psnid_best_model_cache_fetch
+
+
+/**********************************************************************/
+void psnid_best_model_cache_store(int typeindex)
+/**********************************************************************/
+{
+  // Created Aug 2026
+  // Store freshly filled model tensors (and the MW extinction baked
+  // into them) in the per-type cache; see psnid_best_model_cache_fetch.
+
+  int m, mfilt, this_filt ;
+  struct PSNID_MODEL_CACHE_DEF *CACHE = &PSNID_MODEL_CACHE[typeindex] ;
+
+  // ------------- BEGIN -------------
+
+  CACHE->EPOCH     = PSNID_MODEL_EPOCH ;
+  CACHE->MAG       = PSNID_MODEL_MAG ;
+  CACHE->MAGERR    = PSNID_MODEL_MAGERR ;
+  CACHE->EXTINCT   = PSNID_MODEL_EXTINCT ;
+  CACHE->MWEXTINCT = PSNID_MODEL_MWEXTINCT ;
+
+  for (m=1; m<=PSNID_NFILTER; m++) {
+    mfilt     = m-1 ;
+    this_filt = PSNID_INPUTS.IFILTLIST[mfilt];
+    CACHE->MWXTMAG[m] = 0.0 ;
+    if ( PSNID_INPUTS.USEFILT[this_filt] == 1 )
+      { CACHE->MWXTMAG[m] = psnid_best_mwxtmag(mfilt); }
+  }
+
+  CACHE->VALID = 1 ;
+
+  return ;
+}
+// end of psnid_best_model_cache_store
+
+
 /**********************************************************************/
 void psnid_best_setup_searchgrid()
 /**********************************************************************/
@@ -1954,6 +2067,7 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
     mina=1, maxa=1, astep=1, mini=1, maxi=1, minu=1, maxu=1, ustep=1;
   int npeak;
   double peak_guess, chisq, chisqlo, chisqloz, chisqlozu, chisq_z, wgt;
+  double chisq_prior;
   double istep = 1.0;
   double *c_grid, *z_grid, *u_grid, ushift;
   double *fit_epoch, **fit_mag, **fit_magerr;
@@ -2270,22 +2384,43 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
 
 	  for (a = mina; a <= maxa; a = a + astep) {  // colorpar
 
+	    // Aug 2026: model mags depend on (z,u,d,a) but not on Tmax,
+	    // so build them once here instead of per Tmax step below;
+	    // only fit_epoch needs updating inside the Tmax loop.
+	    for (t = 1; t <= PSNID_MAXND; t++) {
+	      for (f = 1; f <= PSNID_NFILTER; f++) {
+		// apply extinction and dmu
+		fit_mag[f][t]    = PSNID_MODEL_MAG[f][d][z][t] -
+		  (c_grid[a]-PSNID_BASE_COLOR[itype])*PSNID_MODEL_EXTINCT[f][d][z][t] + ushift;
+		fit_magerr[f][t] = PSNID_MODEL_MAGERR[f][d][z][t];
+	      }
+	    }
+
+	    // PRIORS: photo-z(host) and AV terms are also Tmax-independent
+	    chisq_prior = 0.0 ;
+	    if ( DOPRIOR_ZPHOT ) { chisq_prior += chisq_z ; }
+	    if (PSNID_USE_AV_PRIOR == 1) {
+	      pav = psnid_best_avprior1(itype, c_grid[a]);
+	      chisq_prior += -2.0*PSNID_INPUTS.AV_PRIOR_STR*log(pav);
+	    }
+
 	    for (i = mini; i <= maxi; i++) {           // peak MJD (RK fix?)
 	      //   for (i = mini; i < maxi; i++) {  // peak MJD (bug?)
 
 	      // shift model along time axis
 	      peak_guess   = PSNID_PEAK_START + i*istep;
-	      for (t = 1; t <= PSNID_MAXND; t++) {
-		fit_epoch[t] = PSNID_MODEL_EPOCH[d][z][t] + peak_guess;
-		for (f = 1; f <= PSNID_NFILTER; f++) {
-		  // apply extinction and dmu
-		  fit_mag[f][t]    = PSNID_MODEL_MAG[f][d][z][t] -
-		    (c_grid[a]-PSNID_BASE_COLOR[itype])*PSNID_MODEL_EXTINCT[f][d][z][t] + ushift;
-		  fit_magerr[f][t] = PSNID_MODEL_MAGERR[f][d][z][t];
-		}
-	      }
-	      
-	      optDebug = (ipass > PSNID_NITER && itype == 0 ) ; 
+	      for (t = 1; t <= PSNID_MAXND; t++)
+		{ fit_epoch[t] = PSNID_MODEL_EPOCH[d][z][t] + peak_guess; }
+
+	      optDebug = (ipass > PSNID_NITER && itype == 0 ) ;
+
+	      // allow chi2 loop to quit as soon as this model cannot beat
+	      // the current minimum; final pass needs exact chi2 for the
+	      // evidence sums, so no early quit there.
+	      if ( ipass < PSNID_NITER )
+		{ PSNID_CHISQ_EARLYSTOP = chisqlo - chisq_prior ; }
+	      else
+		{ PSNID_CHISQ_EARLYSTOP = PSNID_BIGN ; }
 
 	      // calculate chi-squared between data and model
 	      chisq = 0.0;
@@ -2297,17 +2432,7 @@ void psnid_best_grid_compare(int itype, int zpind, int nobs,
 				    fit_epoch, fit_mag, fit_magerr,
 				    &ngood, &chisq, optDebug, 0);
 
-	      //////////////////////////
-	      //  PRIORS
-
-	      // photo-z(host)
-	      if ( DOPRIOR_ZPHOT ) { chisq += chisq_z ; } 
-
-	      // AV
-	      if (PSNID_USE_AV_PRIOR == 1) {
-		pav = psnid_best_avprior1(itype, c_grid[a]);
-		chisq += -2.0*PSNID_INPUTS.AV_PRIOR_STR*log(pav);
-	      }
+	      chisq += chisq_prior ;  // see priors above Tmax loop
 
 
 	      // make sure the fit doesn't favor a model with all 99.99
@@ -2539,12 +2664,22 @@ void psnid_best_calc_chisq(int nobs, int *useobs,
   double data_flux, data_fluxe, model_flux, model_fluxe, mjd;
   double MJDDIF_MODEL, MJDDIF_DATA, tFrac, MAGDIF, ERRDIF ;
   double SQFERR, FDIF ;
-  int *chisq_ind;
-  double *chisq_obs;
-
+  // Aug 2026: re-use chi2-per-obs buffers across the many calls per SN
+  // instead of malloc/free on each call; grow if nobs increases.
+  static int     nobs_malloc = 0 ;
+  static int    *chisq_ind = NULL ;
+  static double *chisq_obs = NULL ;
+
+  if ( nobs > nobs_malloc ) {
+    if ( nobs_malloc > 0 ) {
+      free_dvector(chisq_obs, 1, nobs_malloc);
+      free_ivector(chisq_ind, 1, nobs_malloc);
+    }
+    chisq_obs = dvector(1,nobs);
+    chisq_ind = ivector(1,nobs);
+    nobs_malloc = nobs ;
+  }
 
-  chisq_obs = dvector(1,nobs);
-  chisq_ind = ivector(1,nobs);
   for (t=1; t<=nobs; t++) {
     chisq_obs[t] = 0.0;
     chisq_ind[t] = 0;
@@ -2640,9 +2775,15 @@ void psnid_best_calc_chisq(int nobs, int *useobs,
 
 	chisq_obs[t+1] = chisq_tmp;
 	*chisq        += chisq_tmp ; // increment output chisq
-      
+
 	count++;
 
+	// Aug 2026: grid-search callers only need to know that this
+	// model loses, so bail once chi2 exceeds the caller's current
+	// minimum. Outlier rejection & debug need every epoch.
+	if ( *chisq > PSNID_CHISQ_EARLYSTOP &&
+	     doReject == 0 && optDebug == 0 )  { break ; }
+
 	if ( optDebug ) { 
 	  NOBS_FILT[this_filt]++ ; 
 	  CHISQ_FILT[this_filt]+= chisq_tmp ; 
@@ -2716,10 +2857,6 @@ void psnid_best_calc_chisq(int nobs, int *useobs,
     }
   }
 
-  free_dvector(chisq_obs, 1,nobs);
-  free_ivector(chisq_ind, 1,nobs);
-
-
   return;
 }
 // end of psnid_best_calc_chisq
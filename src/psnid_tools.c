@@ -99,6 +99,7 @@ void PSNID_USER_INPUT(int NVAR, double *input_array, char *input_string ) {
   cosPar[ICOSPAR_HzFUN_wa] = 0.0 ;
   VBOSE = 1;
   init_HzFUN_INFO(VBOSE, cosPar, "", &PSNID_INPUTS.HzFUN_INFO);
+  init_HzFUN_CACHE(&PSNID_INPUTS.HzFUN_INFO); // Aug 2026: fixed cosmology
 
   ivar++ ; dval = input_array[ivar];
   PSNID_INPUTS.OPT_DEBUG = (int)dval ;
@@ -141,6 +141,12 @@
 
  Mar 01 2021: adapt to work for NEA column replacing 3 PSF columns.
 
+ Aug 2026:
+   + replace fixed MXMJD arrays with malloc'd per-LIBID storage that
+     grows on demand -> memory scales with the densest cadence and
+     the MXMJD abort is gone (10-yr LSST baseline no longer needs
+     hand-split inputs).
+
 ***************************************/
 
 #include <stdio.h>
@@ -153,7 +159,7 @@
 #include "sntools.h" 
 #include "simlib_tools.c"
 
-#define MXMJD     100000    // max MJDs per LIBID
+#define MXOBS_INIT  10000   // initial malloc size for MJDs per LIBID
 #define MXLIBID   6000
 #define MWEBV_MAX  2.0     // reject fields with such large MWEBV
 #define MXLINE_HEADER 30   // max lines for simlib header
@@ -227,16 +233,17 @@ struct SIMLIB_INPUT {
   char  FIELDNAME[20];
   float INFO_HEAD[NPAR_HEAD];  // RA,DECL, MWEBV, PIXSIZE, Z, PEAKMJD
 
-  double   MJD[MXMJD];   // June 2018
-  char STRING_IDEXPT[MXMJD][20]; // Apr 2018
-  int  NEXPOSE_IDEXPT[MXMJD];    // Jan 2021
-  int  IDEXPT[MXMJD];
+  // Aug 2026: malloc'd per-LIBID arrays (see malloc_SIMLIB_OBS)
+  double   *MJD;   // June 2018
+  char (*STRING_IDEXPT)[20]; // Apr 2018
+  int  *NEXPOSE_IDEXPT;    // Jan 2021
+  int  *IDEXPT;
 
-  char FILTNAME[MXMJD][2];
-  int  IFILT[MXMJD];
+  char (*FILTNAME)[2];
+  int  *IFILT;
 
   // info is: MJD, CCDGAIN, CCDNOISE, SKYSIG, PSF[0-2], ZPTAVG, ZPTSIG, MAG
-  float INFO_MJD[MXMJD][NPAR_MJD];
+  float (*INFO_MJD)[NPAR_MJD];
 
   bool REFAC_DOCANA ;
 
@@ -250,18 +257,23 @@ struct SIMLIB_OUTPUT {
   char  FIELDNAME[20];
   float INFO_HEAD[NPAR_HEAD];  // RA,DECL, MWEBV, PIXSIZE, Z, PEAKMJD
 
-  double   MJD[MXMJD];  //  June 2017
-  char STRING_IDEXPT[MXMJD][20]; // April 2018
-  int  NEXPOSE_IDEXPT[MXMJD];    // Jan 2021
-  int  IDEXPT[MXMJD] ;
+  // Aug 2026: malloc'd per-LIBID arrays (see malloc_SIMLIB_OBS)
+  double   *MJD;  //  June 2017
+  char (*STRING_IDEXPT)[20]; // April 2018
+  int  *NEXPOSE_IDEXPT;    // Jan 2021
+  int  *IDEXPT ;
+
+  char (*FILTNAME)[2];
 
-  char FILTNAME[MXMJD][2];
- 
   // info is: MJD, CCDGAIN, CCDNOISE, SKYSIG, PSF[0-2], ZPTAVG, ZPTSIG, MAG
-  float INFO_MJD[MXMJD][NPAR_MJD];
+  float (*INFO_MJD)[NPAR_MJD];
 
 } SIMLIB_OUTPUT ;
 
+// Aug 2026: current malloc size of per-LIBID arrays (grows on demand)
+int MXOBS_SIMLIB = 0 ;
+int *OBSMIN_COADD, *OBSMAX_COADD ;  // measure -> obs-range maps
+
 // Jan 2021: store info for summary
 struct {
   double MJD_MAX, MJD_MIN;
@@ -271,6 +283,7 @@ struct {
 // declare functions
 
 void  parse_args(int argc, char **argv);
+void  malloc_SIMLIB_OBS(int MXOBS);
 void  SIMLIB_open_read();
 void  SIMLIB_read(int *RDSTAT);
 void  SIMLIB_coadd(void);
@@ -301,6 +314,8 @@ int main(int argc, char **argv) {
 
   parse_args(argc, argv );
 
+  malloc_SIMLIB_OBS(MXOBS_INIT); // Aug 2026
+
   SIMLIB_INPUT.REFAC_DOCANA = true ; // Feb 25 2021
 
   if ( LTRACE > 0 ) dmp_trace_main("01");
@@ -556,6 +571,76 @@ void  parse_args(int argc, char **argv) {
 } // end of function parse_args
 
 
+// ********************************************
+void malloc_SIMLIB_OBS(int MXOBS) {
+
+  // Created Aug 2026
+  // Allocate (first call) or re-allocate (MXOBS > MXOBS_SIMLIB)
+  // the per-LIBID observation arrays for SIMLIB_INPUT and
+  // SIMLIB_OUTPUT, plus the OBSMIN/OBSMAX measure maps used by
+  // SIMLIB_coadd. Memory scales with the densest cadence instead
+  // of a compile-time MXMJD bound, so monster LSST LIBIDs no
+  // longer abort or require splitting the input by hand.
+  // Contents are preserved on re-alloc; only one LIBID is held
+  // at a time so the growth cost is negligible.
+
+  char fnam[] = "malloc_SIMLIB_OBS" ;
+
+  // ----------- BEGIN -----------
+
+  if ( MXOBS <= MXOBS_SIMLIB ) { return ; }
+
+  if ( MXOBS_SIMLIB > 0 ) {
+    printf("\t %s: grow per-LIBID arrays: MXOBS = %d -> %d \n",
+	   fnam, MXOBS_SIMLIB, MXOBS );
+    fflush(stdout);
+  }
+
+  SIMLIB_INPUT.MJD =
+    (double*)realloc(SIMLIB_INPUT.MJD, MXOBS*sizeof(double));
+  SIMLIB_INPUT.STRING_IDEXPT =
+    (char(*)[20])realloc(SIMLIB_INPUT.STRING_IDEXPT, MXOBS*20*sizeof(char));
+  SIMLIB_INPUT.NEXPOSE_IDEXPT =
+    (int*)realloc(SIMLIB_INPUT.NEXPOSE_IDEXPT, MXOBS*sizeof(int));
+  SIMLIB_INPUT.IDEXPT =
+    (int*)realloc(SIMLIB_INPUT.IDEXPT, MXOBS*sizeof(int));
+  SIMLIB_INPUT.FILTNAME =
+    (char(*)[2])realloc(SIMLIB_INPUT.FILTNAME, MXOBS*2*sizeof(char));
+  SIMLIB_INPUT.IFILT =
+    (int*)realloc(SIMLIB_INPUT.IFILT, MXOBS*sizeof(int));
+  SIMLIB_INPUT.INFO_MJD =
+    (float(*)[NPAR_MJD])realloc(SIMLIB_INPUT.INFO_MJD,
+				MXOBS*NPAR_MJD*sizeof(float));
+
+  SIMLIB_OUTPUT.MJD =
+    (double*)realloc(SIMLIB_OUTPUT.MJD, MXOBS*sizeof(double));
+  SIMLIB_OUTPUT.STRING_IDEXPT =
+    (char(*)[20])realloc(SIMLIB_OUTPUT.STRING_IDEXPT, MXOBS*20*sizeof(char));
+  SIMLIB_OUTPUT.NEXPOSE_IDEXPT =
+    (int*)realloc(SIMLIB_OUTPUT.NEXPOSE_IDEXPT, MXOBS*sizeof(int));
+  SIMLIB_OUTPUT.IDEXPT =
+    (int*)realloc(SIMLIB_OUTPUT.IDEXPT, MXOBS*sizeof(int));
+  SIMLIB_OUTPUT.FILTNAME =
+    (char(*)[2])realloc(SIMLIB_OUTPUT.FILTNAME, MXOBS*2*sizeof(char));
+  SIMLIB_OUTPUT.INFO_MJD =
+    (float(*)[NPAR_MJD])realloc(SIMLIB_OUTPUT.INFO_MJD,
+				MXOBS*NPAR_MJD*sizeof(float));
+
+  OBSMIN_COADD = (int*)realloc(OBSMIN_COADD, MXOBS*sizeof(int));
+  OBSMAX_COADD = (int*)realloc(OBSMAX_COADD, MXOBS*sizeof(int));
+
+  if ( SIMLIB_OUTPUT.INFO_MJD == NULL || OBSMAX_COADD == NULL ) {
+    sprintf(c1err,"Could not malloc per-LIBID arrays");
+    sprintf(c2err,"MXOBS = %d", MXOBS);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  MXOBS_SIMLIB = MXOBS ;
+
+  return ;
+
+} // end of malloc_SIMLIB_OBS
+
 
 // *************************************
 void SIMLIB_open_read(void) {
@@ -834,13 +919,9 @@ void SIMLIB_read(int *RDSTAT) {
       SIMLIB_INPUT.NMJD_ACCEPT = NMJD_ACCEPT ;
       NMJD  = NMJD_ACCEPT ;
 
-      if ( NMJD >= MXMJD ) {
-	sprintf(c1err,"NMJD=%d exceeds array bound at LIBID=%d. ", 
-	       NMJD, LIBID);
-	sprintf(c2err,"MXMJD = %d", MXMJD);
-	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
-	// xxxx	MADABORT();
-      }
+      // Aug 2026: grow arrays instead of MXMJD abort
+      if ( NMJD >= MXOBS_SIMLIB-1 )
+	{ malloc_SIMLIB_OBS(2*MXOBS_SIMLIB); }
 
       SIMLIB_INPUT.MJD[NMJD]      = MJD ;  // June 2017, use double
 
@@ -946,7 +1027,7 @@ void SIMLIB_coadd(void) {
   // Jan 07, 2021: sum NEXPOSE and write proper IDEXPT string
 
   int  i, obs, ipar, NOBS_IN, NMEASURE, OVPFILT, IDEXPT, NEXPOSE ;
-  int  OBSMIN[MXMJD], OBSMAX[MXMJD]    ;
+  int  *OBSMIN = OBSMIN_COADD, *OBSMAX = OBSMAX_COADD ; // Aug 2026
 
   char *cfilt, *cfilt_last ;
 
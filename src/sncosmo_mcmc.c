@@ -2,6 +2,8 @@
 #define MAXSN 100000
 //Maximum number of mcmc samples
 #define MAXCHAIN 100000
+//Maximum number of parallel MCMC walkers
+#define MAXWALKER 100
 //Cosmological parameters for SN=4
 #define NCOSPAR 4
 #define NGITER 10
@@ -17,6 +19,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
 #include "sntools.h"
 #include "sntools_output.h"
 
@@ -39,8 +42,11 @@ double cosmodl(double z);
 double distance(double p[NCOSPAR],double z);
 double inc(double z);
 
+void *mcmc_walker(void *varg);
+
 //Generic mathematical functions
 void gengauss(double r[2]);
+void gengauss_r(unsigned int *seedp, double r[2]);
 void invert(double matrix[],int n);
 void jacobi(double A[],int N,double D[],double V[],int *NROT);
 void ludcmp(double* a, const int n, const int ndim, int* indx, 
@@ -201,7 +207,7 @@ int npt;
 double zdata[MAXSN];
 double mudata[MAXSN];
 double sigma[MAXSN];
-double delmu[MAXSN];
+__thread double delmu[MAXSN];  // scratch filled by like(); per-walker
 double z_val[MAXSN];
 double z_sig[MAXSN];
 double mu_val[MAXSN];
@@ -217,14 +223,29 @@ int npoints;
 double planck_cov_matrix[NCOSPAR][NCOSPAR];
 
 double RNORM;
-double omega_k, omega_l, omega_m, wde, wa;
+// cosmology state + scratch below are written on every call to like();
+// thread-local so ensemble walkers can evaluate likelihoods concurrently
+__thread double omega_k, omega_l, omega_m, wde, wa;
 double H0;
 int nz = 2000;
-double dtab[2000];
-  double cmb_chisq;
-  double sn_chisq;
-  double bao_chi;
-  double pl_chisq;
+__thread double dtab[2000];
+  __thread double cmb_chisq;
+  __thread double sn_chisq;
+  __thread double bao_chi;
+  __thread double pl_chisq;
+
+// number of parallel MCMC walkers (NUM_WALKERS key; default 1 = serial)
+int nwalker;
+
+// per-walker state for the threaded chain in domcmc
+typedef struct {
+  int    id ;              // walker index 0 .. nwalker-1
+  int    nsamp ;           // accepted samples this walker must produce
+  int    offset ;          // first slot in the shared chain arrays
+  unsigned int seed ;      // private state for rand_r
+  double parstart[NCOSPAR];
+  double *eigval, *eigvec ;
+} WALKER_DEF ;
 
 int main(int argc,char* argv[])
 {
@@ -1167,7 +1188,77 @@ double chainpar[4][MAXCHAIN])
  jacobi(parvar,npar,eigval,eigvec,&nrot);
 
   for (i=0;i<npar;++i) eigval[i] = sqrt(eigval[i]);
-  
+
+  // Aug 2026: ensemble mode (NUM_WALKERS key). Each walker advances its
+  // own Metropolis chain in a thread, sharing the read-only data/model
+  // globals and writing to a private slice of the chain arrays.
+  if (nwalker > 1)
+    {
+      pthread_t  tid[MAXWALKER];
+      static WALKER_DEF walker[MAXWALKER];
+      int iw, nw, quota, nextoff, ntot;
+
+      nw = nwalker;
+      if (nw > MAXWALKER) nw = MAXWALKER;
+      quota = chain_length/nw;
+      if (quota < 1) { nw = 1; quota = chain_length; }
+
+      if (debug>=1) printf("Running %i parallel MCMC walkers\n",nw);
+
+      nextoff = 0;
+      for (iw=0;iw<nw;++iw)
+	{
+	  walker[iw].id     = iw;
+	  walker[iw].nsamp  = quota;
+	  if (iw==0) walker[iw].nsamp += chain_length - quota*nw;
+	  walker[iw].offset = nextoff;
+	  nextoff          += walker[iw].nsamp;
+	  walker[iw].seed   = (unsigned int)rand();
+	  walker[iw].eigval = eigval;
+	  walker[iw].eigvec = eigvec;
+
+	  // scatter starting points along the proposal eigenvectors;
+	  // walker 0 starts exactly at parini as in the serial chain
+	  for (i=0;i<NCOSPAR;++i) walker[iw].parstart[i] = parini[i];
+	  if (iw>0)
+	    {
+	      gotnew=0;
+	      while(!gotnew)
+		{
+		  gotnew=1;
+		  gengauss(g3);
+		  gengauss(&g3[2]);
+		  for (i=0;i<NCOSPAR;++i)
+		    {
+		      walker[iw].parstart[i] = parini[i];
+		      ie = ipar[i]-1;
+		      if (ie<0) continue;
+		      for (j=0;j<NCOSPAR;++j)
+			{
+			  je = ipar[j]-1;
+			  if (je<0) continue;
+			  walker[iw].parstart[i] += eigvec[ie*npar+je]*eigval[je]*g3[je];
+			}
+		    }
+		  for (i=0;i<NCOSPAR;++i)
+		    if (walker[iw].parstart[i]<in_parmin[i] ||
+			walker[iw].parstart[i]>in_parmax[i]) gotnew=0;
+		}
+	    }
+	}
+
+      for (iw=0;iw<nw;++iw)
+	pthread_create(&tid[iw],NULL,mcmc_walker,&walker[iw]);
+
+      ntot = 0;
+      for (iw=0;iw<nw;++iw)
+	{
+	  pthread_join(tid[iw],NULL);
+	  ntot += walker[iw].nsamp;
+	}
+      return(ntot);
+    }
+
   logzero = 1.0e30;
   maxlike=logzero;
   curlike=logzero;
@@ -1257,6 +1348,77 @@ double chainpar[4][MAXCHAIN])
      }
    return(numaccept);
 }
+void *mcmc_walker(void *varg)
+{
+  // Aug 2026: one Metropolis chain of the walker ensemble; same
+  // algorithm as the serial loop in domcmc, but with re-entrant random
+  // numbers (rand_r) and a private slice [offset,offset+nsamp) of the
+  // shared chain arrays, so walkers never need a lock.
+  WALKER_DEF *w = (WALKER_DEF *)varg;
+  double parc[NCOSPAR], parn[NCOSPAR], g3[NCOSPAR];
+  double logzero, curlike, loglike, u;
+  int numaccept, numpropose, mult, i, j, ie, je, gotnew, islot;
+
+  logzero = 1.0e30;
+  mult = 1;
+  numaccept = 0;
+  numpropose = 0;
+
+  for (i=0;i<NCOSPAR;++i) parc[i] = w->parstart[i];
+  curlike = 0.5*like(parc);
+
+  while (numaccept < w->nsamp)
+    {
+      ++numpropose;
+
+      if (debug==1 && numpropose%5000==0)
+	printf("walker %i: numaccepted=%i, numproposed=%i \n",
+	       w->id,numaccept,numpropose);
+
+      // get new proposed point and likelihood
+      gotnew=0;
+      while(!gotnew)
+	{
+	  gotnew=1;
+	  gengauss_r(&w->seed,g3);
+	  gengauss_r(&w->seed,&g3[2]);
+	  for (i=0;i<NCOSPAR;++i)
+	    {
+	      parn[i] = parc[i];
+	      ie = ipar[i]-1;
+	      if (ie<0) continue;
+	      for (j=0;j<NCOSPAR;++j)
+		{
+		  je = ipar[j]-1;
+		  if (je<0) continue;
+		  parn[i]=parn[i]+w->eigvec[ie*npar+je]*w->eigval[je]*g3[je];
+		}
+	    }
+	  for (i=0;i<NCOSPAR;++i) if (parn[i]<in_parmin[i] || parn[i]>in_parmax[i]) gotnew=0;
+	}
+      loglike = 0.5*like(parn);
+
+      // metropolis hastings, as in the serial chain
+      u = rand_r(&w->seed)/RNORM;
+      if ((loglike != logzero) && (curlike>loglike || u<exp(-loglike+curlike)))
+	{
+	  islot = w->offset + numaccept;
+	  chainmult[islot] = mult;
+	  chainlike[islot] = curlike;
+	  for (i=0;i<NCOSPAR;++i) chainpar[i][islot] = parc[i];
+	  ++numaccept;
+
+	  curlike=loglike;
+	  for (i=0;i<NCOSPAR;++i) parc[i]=parn[i];
+	  mult=1;
+	}
+      else
+	{
+	  mult=mult+1;
+	}
+    }
+  return NULL;
+}
 void getCovMatrix(int numsamp,double params[NCOSPAR],double covmatrix[NCOSPAR][NCOSPAR],char fname[])
 {
   int i, j, n;
@@ -1533,6 +1695,8 @@ int readinputfile(FILE* finput)
   nsamps = 50000;
   ninit = 1000;
   ntrain = 5000;
+  // Number of parallel MCMC walkers (1 = original serial chain)
+  nwalker = 1;
   // intrinsic error
   sigint = 0.08;
   // cheat=.true. means use simulated value (not light curve fit value)
@@ -1648,6 +1812,7 @@ int readinputfile(FILE* finput)
       if (!strncmp(instring,"NUM_SAMPLES:",12)) sscanf(&instring[12],"%i",&nsamps);
       if (!strncmp(instring,"NUM_INITIAL:",12)) sscanf(&instring[12],"%i",&ninit);
       if (!strncmp(instring,"NUM_TRAIN:",10)) sscanf(&instring[10],"%i",&ntrain);
+      if (!strncmp(instring,"NUM_WALKERS:",12)) sscanf(&instring[12],"%i",&nwalker);
 
 
       if (!strncmp(instring,"H0:",3)) sscanf(&instring[4],"%lf",&in_H0);
@@ -2120,7 +2285,17 @@ void gengauss(double r[2])
   r[1] = radius*sin(phi);
   return;
 }
-void ludcmp(double* a, const int n, const int ndim, int* indx, 
+void gengauss_r(unsigned int *seedp, double r[2])
+{
+  // Re-entrant gengauss for the walker threads (rand_r instead of rand)
+  double radius, phi;
+  radius = sqrt(-2.0*log(rand_r(seedp)/RNORM));
+  phi = TWOPI*rand_r(seedp)/RNORM;
+  r[0] = radius*cos(phi);
+  r[1] = radius*sin(phi);
+  return;
+}
+void ludcmp(double* a, const int n, const int ndim, int* indx,
        double* d, int* icon)
 {
   /* System generated locals */
@@ -60,6 +60,8 @@
 #define WRITE_MASK_SIM_SNRMON   16  // write SNR(MAGMONITOR)
 #define WRITE_MASK_SIM_MODELPAR 32  // write model par for SIMSED, LCLIB
 #define WRITE_MASK_COMPACT    64  // suppress non-essential PHOT output
+#define WRITE_MASK_SPEC_COMPACT 128 // 1 row/spectrum, quantized FLAM (Aug 2026)
+#define WRITE_MASK_FITS_GZ  256  // write gzip-compressed FITS files (Aug 2026)
 
 #define OPT_ZPTSIG_TRUN  1   // option to use ZPTSIG from template
 #define OPT_ZPTSIG_SRUN  2   // idem for search run
@@ -57,6 +57,7 @@
 #include <gsl/gsl_matrix.h>
 #include <gsl/gsl_sort.h>
 #include <sys/stat.h>
+#include <sys/wait.h>   // for NFORK_GEN (parallel event generation)
 
 // include C code
 #include "SNcadenceFoM.c"
@@ -208,9 +209,16 @@ int main(int argc, char **argv) {
   if ( (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_PLUSNBR)>0 ) 
     { rewrite_HOSTLIB_plusNbr(); }
 
+  // check option to fork parallel generation processes AFTER the
+  // heavy one-time init so that SIMLIB/HOSTLIB/kcor tables are
+  // shared copy-on-write instead of re-read per job (Aug 2026).
+  if ( INPUTS.NFORK_GEN > 1 ) { init_GENFORK(); }
+
   // create/init output sim-files
   init_simFiles(&SIMFILE_AUX);
 
+  init_accept_monitor();  // Aug 2026: z-binned acceptance counters
+
   // check option to dump rest-frame mags
  SIMLIB_DUMP:
   if ( INPUTS.USEFLAG_DMPTREST ) { DUMP_GENMAG_DRIVER() ; }
@@ -229,7 +237,11 @@ int main(int argc, char **argv) {
 
   t_end_init = time(NULL); // Mar 15 2020
 
-  for ( ilc = 1; ilc <= INPUTS.NGEN ; ilc++ ) {
+  // Aug 2026: resume from checkpoint after all one-time init so
+  // that random streams and SIMLIB are in their post-init state.
+  if ( SIMCHECKPOINT.RESTART_FLAG ) { restart_from_checkpoint(); }
+
+  for ( ilc = SIMCHECKPOINT.ILC_START; ilc <= INPUTS.NGEN ; ilc++ ) {
 
     NGENLC_TOT++;
 
@@ -244,7 +256,9 @@ int main(int argc, char **argv) {
     if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID ) 
       { fill_RANLISTs(); }      // init list of random numbers for each SN    
 
-    gen_event_driver(ilc); 
+    SIMTIMER_START(ITIMER_SIM_GENEVENT);
+    gen_event_driver(ilc);
+    SIMTIMER_STOP(ITIMER_SIM_GENEVENT);
 
     if ( GENLC.STOPGEN_FLAG ) { NGENLC_TOT--;  goto ENDLOOP ; }
 
@@ -274,6 +288,8 @@ int main(int argc, char **argv) {
       goto GENEFF;
     }
 
+    update_accept_monitor(0);   // count in-range generated event
+
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("06", ilc) ; }
 
   GETMAGS:
@@ -292,7 +308,9 @@ int main(int argc, char **argv) {
 
 
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("07", ilc) ; }
+    SIMTIMER_START(ITIMER_SIM_GENMAG);
     GENMAG_DRIVER();   // July 2016
+    SIMTIMER_STOP(ITIMER_SIM_GENMAG);
 
     if ( GENMAG_CUT() == 0  ) {
       gen_event_reject(&ilc, &SIMFILE_AUX, "GENMAG");
@@ -304,12 +322,16 @@ int main(int argc, char **argv) {
     // generate spectra before broadband fluxes in case TEXPOSE
     // is computed from requested SNR; TEXPOSE is then used for
     // synthetic bands.
-    GENSPEC_DRIVER(); 
+    SIMTIMER_START(ITIMER_SIM_GENSPEC);
+    GENSPEC_DRIVER();
+    SIMTIMER_STOP(ITIMER_SIM_GENSPEC);
 
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("09", ilc) ; }
 
     // convert generated mags into observed fluxes
-    GENFLUX_DRIVER(); 
+    SIMTIMER_START(ITIMER_SIM_GENFLUX);
+    GENFLUX_DRIVER();
+    SIMTIMER_STOP(ITIMER_SIM_GENFLUX);
 
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("10", ilc) ; }
 
@@ -325,12 +347,14 @@ int main(int argc, char **argv) {
     // check if search finds this SN:
     GENLC.SEARCHEFF_MASK = 3 ;
     if ( GENLC.IFLAG_GENSOURCE != IFLAG_GENGRID  ) {
+      SIMTIMER_START(ITIMER_SIM_TRIGGER);
       LOAD_SEARCHEFF_DATA();
-      GENLC.SEARCHEFF_MASK = 
+      GENLC.SEARCHEFF_MASK =
 	gen_SEARCHEFF(GENLC.CID                 // (I) ID for dump/abort
 		      ,&GENLC.SEARCHEFF_SPEC     // (O)
 		      ,&GENLC.SEARCHEFF_zHOST    // (O) Mar 2018
 		      ,&GENLC.MJD_TRIGGER ) ;    // (O)
+      SIMTIMER_STOP(ITIMER_SIM_TRIGGER);
     }
 
     for ( i=1; i<= GENRAN_INFO.NLIST_RAN ; i++ )  
@@ -351,7 +375,10 @@ int main(int argc, char **argv) {
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("11", ilc) ; }
 
     // check option to apply CUT windows
-    if ( gen_cutwin() != SUCCESS  && GENLC.ACCEPTFLAG_FORCE==0 ) {
+    SIMTIMER_START(ITIMER_SIM_CUTWIN);
+    int istat_cutwin = gen_cutwin();
+    SIMTIMER_STOP(ITIMER_SIM_CUTWIN);
+    if ( istat_cutwin != SUCCESS  && GENLC.ACCEPTFLAG_FORCE==0 ) {
       gen_event_reject(&ilc, &SIMFILE_AUX, "CUTWIN");
       goto GENEFF;
     }
@@ -371,7 +398,9 @@ int main(int argc, char **argv) {
     if ( INPUTS.TRACE_MAIN ) { dmp_trace_main("13", ilc) ; }
 
     // update SNDATA files & auxiliary files
+    SIMTIMER_START(ITIMER_SIM_OUTPUT);
     update_simFiles(&SIMFILE_AUX);
+    SIMTIMER_STOP(ITIMER_SIM_OUTPUT);
 
     GENLC.ACCEPTFLAG = 1 ;  // Added Dec 2015
 
@@ -381,6 +410,14 @@ int main(int argc, char **argv) {
 
     if ( INPUTS.NGENTOT_LC > 0 ) { screen_update(); }
 
+    if ( INPUTS.CHECKPOINT_NEVT > 0 &&
+	 ilc % INPUTS.CHECKPOINT_NEVT == 0 ) {
+      // flush aux streams so on-disk files cover checkpointed state
+      if ( INPUTS.FORMAT_MASK > 0 )        { fflush(SIMFILE_AUX.FP_LIST); }
+      if ( INPUTS.NVAR_SIMGEN_DUMP >= 0 )  { fflush(SIMFILE_AUX.FP_DUMP); }
+      wr_checkpoint(ilc);
+    }
+
     GENLC.STOPGEN_FLAG = geneff_calc();  // calc generation effic & error  
     if ( GENLC.STOPGEN_FLAG )  { goto ENDLOOP; }
     
@@ -489,9 +526,11 @@ void simEnd(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
   end_simFiles(SIMFILE_AUX);
 
-  if ( NAVWARP_OVERFLOW[0] > 0 ) 
+  if ( NAVWARP_OVERFLOW[0] > 0 )
     { printf("%s", WARNING_AVWARP_OVERFLOW ); }
 
+  dump_accept_monitor();  // Aug 2026: z-binned acceptance table
+
   if ( NGEN_REJECT.NEPOCH == NGENLC_TOT ) {
     sprintf ( c1err, "Every generated event fails NEPOCH>=%d .",
 	      (int)INPUTS.CUTWIN_NEPOCH[0] );
@@ -499,12 +538,100 @@ void simEnd(SIMFILE_AUX_DEF *SIMFILE_AUX) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
 
+  SIMTIMER_SUMMARY();  // no-op unless OPT_SIMTIMER (Aug 2026)
+
+  // Aug 2026: summarize mag-triage option
+  if ( INPUTS.GENMAG_TRIAGE_DMAG > 0.001 && NEPCHECK_GENMAG_TRIAGE > 0 ) {
+    double frac = (double)NEPSKIP_GENMAG_TRIAGE /
+      (double)NEPCHECK_GENMAG_TRIAGE ;
+    printf("  GENMAG_TRIAGE_DMAG=%.2f: "
+	   "skipped model mag for %d of %d epochs (%.1f%%)\n",
+	   INPUTS.GENMAG_TRIAGE_DMAG, NEPSKIP_GENMAG_TRIAGE,
+	   NEPCHECK_GENMAG_TRIAGE, 100.0*frac );
+  }
+
   printf("\n DONE with snlc_sim.\n");
   fflush(stdout);
-  
+
 } // end of simEnd
 
 
+// *************************
+void SIMTIMER_START(int itimer) {
+
+  // Created Aug 2026
+  // Record wall-time at start of instrumented stage 'itimer';
+  // no-op (one branch) unless sim-input OPT_SIMTIMER is set.
+
+  struct timespec t ;
+  // ----------- BEGIN ------------
+  if ( INPUTS.OPT_SIMTIMER == 0 ) { return; }
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  SIMTIMER.T_START[itimer] = (double)t.tv_sec + 1.0E-9*(double)t.tv_nsec ;
+  return ;
+} // end SIMTIMER_START
+
+
+// *************************
+void SIMTIMER_STOP(int itimer) {
+
+  // add elapsed time since matching SIMTIMER_START to stage sum
+
+  struct timespec t ;
+  double t_now;
+  // ----------- BEGIN ------------
+  if ( INPUTS.OPT_SIMTIMER == 0 ) { return; }
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  t_now = (double)t.tv_sec + 1.0E-9*(double)t.tv_nsec ;
+  SIMTIMER.T_SUM[itimer] += ( t_now - SIMTIMER.T_START[itimer] );
+  SIMTIMER.NCALL[itimer]++ ;
+  return ;
+} // end SIMTIMER_STOP
+
+
+// *************************
+void SIMTIMER_SUMMARY(void) {
+
+  // Created Aug 2026
+  // Print cumulative per-stage timing table (OPT_SIMTIMER option).
+  // Percentages are w.r.t. generation wall time (after init);
+  // stages can nest, so columns need not add up to 100%.
+
+  int    itimer ;
+  double t_gen, T, pct, ms_per_call ;
+  char NAME_TIMER[NTIMER_SIM][16] =
+    { "GENEVENT", "SIMLIB_READ", "GENMAG", "GENSPEC",
+      "GENFLUX", "TRIGGER", "CUTWIN", "OUTPUT" } ;
+
+  // ----------- BEGIN ------------
+
+  if ( INPUTS.OPT_SIMTIMER == 0 ) { return; }
+
+  t_gen = (double)(t_end - t_end_init);
+  if ( t_gen < 1.0E-9 ) { t_gen = 1.0E-9; }
+
+  print_banner(" SIMTIMER: per-stage timing summary ");
+  printf("    %-12s %12s %12s %10s %7s\n",
+	 "STAGE", "NCALL", "T_SUM(sec)", "ms/call", "%WALL" );
+
+  for(itimer=0; itimer < NTIMER_SIM; itimer++ ) {
+    T = SIMTIMER.T_SUM[itimer] ;
+    if ( SIMTIMER.NCALL[itimer] == 0 ) { continue; }
+    ms_per_call = 1.0E3 * T / (double)SIMTIMER.NCALL[itimer] ;
+    pct         = 100.0 * T / t_gen ;
+    printf("    %-12s %12lld %12.3f %10.4f %6.1f%%\n",
+	   NAME_TIMER[itimer], SIMTIMER.NCALL[itimer],
+	   T, ms_per_call, pct );
+  }
+  printf("    (generation wall time = %.1f sec; stages may nest)\n",
+	 t_gen );
+  fflush(stdout);
+
+  return ;
+
+} // end SIMTIMER_SUMMARY
+
+
 // *************************
 int LUPDGEN(int N) {
   // May 27, 2009
@@ -623,8 +750,22 @@ void set_user_defaults(void) {
   INPUTS.DASHBOARD_DUMPFLAG = false ;
 
   INPUTS.TRACE_MAIN = 0;
+  INPUTS.OPT_SIMTIMER = 0 ;
+  INPUTS.CHECKPOINT_NEVT = 0 ;
+  INPUTS.RESTART_CHECKPOINT_FILE[0] = 0 ;
+  SIMCHECKPOINT.RESTART_FLAG = false ;
+  SIMCHECKPOINT.ILC_START    = 1 ;
+  SIMCHECKPOINT.FILENAME[0]  = 0 ;
   INPUTS.DEBUG_FLAG = 0 ;
 
+  // Aug 2026: zero per-stage timers (harmless if OPT_SIMTIMER stays off)
+  int itimer;
+  for(itimer=0; itimer < NTIMER_SIM; itimer++ ) {
+    SIMTIMER.T_SUM[itimer]   = 0.0 ;
+    SIMTIMER.T_START[itimer] = 0.0 ;
+    SIMTIMER.NCALL[itimer]   = 0 ;
+  }
+
   INPUTS.RESTORE_DES3YR       = false; // Mar 2020
   INPUTS.RESTORE_HOSTLIB_BUGS = false; // Nov 2019
   INPUTS.RESTORE_FLUXERR_BUGS = false; // Jan 2020
@@ -678,6 +819,7 @@ void set_user_defaults(void) {
   INPUTS.CIDRAN_MIN = 0 ;
   INPUTS.JOBID      = 0;         // for batch only
   INPUTS.NJOBTOT    = 0;         // for batch only
+  INPUTS.NFORK_GEN  = 0;         // no forked generation by default
   INPUTS.NSUBSAMPLE_MARK = 0 ;
 
   // Mar 2020: use updated cosmoparameters defined in sntools.h
@@ -741,6 +883,8 @@ void set_user_defaults(void) {
 
   INPUTS.TGRIDSTEP_MODEL_INTERP = 0.0 ;
 
+  INPUTS.GENMAG_TRIAGE_DMAG = 0.0 ; // Aug 2026: default is off
+
   sprintf(INPUTS.STRETCH_TEMPLATE_FILE,"BLANK");
 
   init_GENGAUSS_ASYM( &INPUTS.GENGAUSS_SHAPEPAR, zero ); 
@@ -840,6 +984,7 @@ void set_user_defaults(void) {
   INPUTS.RV_MWCOLORLAW       = RV_MWDUST ;
   INPUTS.OPT_MWCOLORLAW      = OPT_MWCOLORLAW_ODON94 ; // default
   INPUTS.OPT_MWEBV           = OPT_MWEBV_FILE   ;      // default
+  INPUTS.MWDUST_CACHE_FLAG   = 0 ;    // default: no in-memory SFD98 maps
   INPUTS.APPLYFLAG_MWEBV     = 0 ;    // default: do NOT correct fluxes
   INPUTS.MWEBV_FLAG          = 1 ;    // default is to do MW extinction
   INPUTS.MWEBV_SIGRATIO      =  0.16;  // default ERR(MWEBV)/MWEBV
@@ -1328,7 +1473,7 @@ int read_input_file(char *input_file) {
   //     (to match YAML syntax for refactored submit script)
 
   int MSKOPT = MSKOPT_PARSE_WORDS_FILE + MSKOPT_PARSE_WORDS_IGNORECOMMENT ;
-  int  iwd, NWD_FILE, NWD_READ, LENWD, INIT_FLAG_STRING ;
+  int  iwd, NWD_FILE, NWD_READ, INIT_FLAG_STRING ;
   FILE *fp;
   char tmpWord[MXPATHLEN];  
   char  stringSource[] = "sim-input file" ;
@@ -1357,14 +1502,18 @@ int read_input_file(char *input_file) {
   NWD_FILE = store_PARSE_WORDS(MSKOPT,input_file);
 
   // copy input file contents to another [WORDLIST] buffer because
-  // store_PARSE_WORDS may be used later to parse some of the input
+  // store_PARSE_WORDS may be used later to parse some of the input.
+  // Aug 2026: carve word slots out of one arena block instead of
+  // one malloc per word (words cannot exceed MXCHARWORD_PARSE_WORDS,
+  // so every slot has the same capacity as before).
+  int MEMWD = MXCHARWORD_PARSE_WORDS + 10 ;
+  char *arena ;
   INPUTS.NWORDLIST = NWD_FILE ;
   INPUTS.WORDLIST  = (char**) malloc ( sizeof(char*) * NWD_FILE );
-  for(iwd=0; iwd < NWD_FILE; iwd++ ) {    
+  arena            = (char *) malloc ( sizeof(char ) * MEMWD * NWD_FILE );
+  for(iwd=0; iwd < NWD_FILE; iwd++ ) {
     get_PARSE_WORD(0,iwd,tmpWord);
-    LENWD = strlen(tmpWord) ;
-    if ( LENWD < MXCHARWORD_PARSE_WORDS ) { LENWD = MXCHARWORD_PARSE_WORDS; }
-    INPUTS.WORDLIST[iwd] = (char*) malloc ( sizeof(char) * (LENWD+10) );
+    INPUTS.WORDLIST[iwd] = arena + iwd * MEMWD ;
     sprintf(INPUTS.WORDLIST[iwd], "%s", tmpWord );
   }
 
@@ -1433,7 +1582,17 @@ int parse_input_key_driver(char **WORDS, int keySource ) {
   }
 
   else if ( keyMatchSim(1, "TRACE_MAIN", WORDS[0], keySource) ) {
-    N++;  sscanf(WORDS[N], "%d", &INPUTS.TRACE_MAIN ) ; 
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.TRACE_MAIN ) ;
+  }
+  else if ( keyMatchSim(1, "OPT_SIMTIMER", WORDS[0], keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.OPT_SIMTIMER ) ;
+  }
+  else if ( keyMatchSim(1, "CHECKPOINT_NEVT", WORDS[0], keySource) ) {
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.CHECKPOINT_NEVT ) ;
+  }
+  else if ( keyMatchSim(1, "RESTART_CHECKPOINT", WORDS[0], keySource) ) {
+    N++;  sscanf(WORDS[N], "%s", INPUTS.RESTART_CHECKPOINT_FILE ) ;
+    SIMCHECKPOINT.RESTART_FLAG = true ;
   }
   else if ( keyMatchSim(1, "DEBUG_FLAG", WORDS[0], keySource) ) {
     N++;  sscanf(WORDS[N], "%d", &INPUTS.DEBUG_FLAG) ; 
@@ -1720,6 +1879,9 @@ int parse_input_key_driver(char **WORDS, int keySource ) {
   else if ( keyMatchSim(1,"TGRIDSTEP_MODEL_INTERP", WORDS[0],keySource) ) {
     N++;  sscanf(WORDS[N], "%f", &INPUTS.TGRIDSTEP_MODEL_INTERP );
   }
+  else if ( keyMatchSim(1,"GENMAG_TRIAGE_DMAG", WORDS[0],keySource) ) {
+    N++;  sscanf(WORDS[N], "%f", &INPUTS.GENMAG_TRIAGE_DMAG );
+  }
   // - - - - - SIMSED - - - - 
   else if ( strstr(WORDS[0],"SIMSED") != NULL ) {
     N += parse_input_SIMSED(WORDS,keySource); 
@@ -1887,6 +2049,9 @@ int parse_input_key_driver(char **WORDS, int keySource ) {
     INPUTS.OPT_MWEBV = abs(ITMP);
     if ( ITMP < 0 ) { INPUTS.APPLYFLAG_MWEBV=1; } // correct FLUXCAL
   }
+  else if ( keyMatchSim(1, "MWDUST_CACHE_FLAG", WORDS[0],keySource) ) {
+    N++; sscanf(WORDS[N], "%d", &INPUTS.MWDUST_CACHE_FLAG );
+  }
 
 
   else if ( keyMatchSim(1, "GENSIGMA_MWEBV_RATIO", WORDS[0],keySource) ) {
@@ -2241,6 +2406,10 @@ int parse_input_key_driver(char **WORDS, int keySource ) {
     // total number of batch jobs
     N++;  sscanf(WORDS[N], "%d", &INPUTS.NJOBTOT );
   }
+  else if ( keyMatchSim(1, "NFORK_GEN",  WORDS[0],keySource) ) {
+    // number of forked event-generation processes
+    N++;  sscanf(WORDS[N], "%d", &INPUTS.NFORK_GEN );
+  }
   // - - - - ABORT ON OBSOLETE KEYS - - - - 
   else {
     parse_input_OBSOLETE(WORDS,keySource);
@@ -5183,7 +5352,13 @@ void prep_user_input(void) {
   OPT  = INPUTS.OPT_MWEBV ;
   text_MWoption(PARNAME_EBV, OPT, INPUTS.STR_MWEBV ); // return STR
   if ( OPT == 0 ) { INPUTS.MWEBV_FLAG = 0; } // turn off
-  
+
+  // Aug 2026: option to cache full SFD98 maps in memory so that
+  // gen_MWEBV does no FITS I/O in the event loop.
+  if ( INPUTS.MWDUST_CACHE_FLAG && INPUTS.MWEBV_FLAG &&
+       OPT >= OPT_MWEBV_SFD98 )
+    { init_MWgaldust_cache(); }
+
   // --------------------------------------------------
   // check exposure time for each filter
   for ( ifilt=0; ifilt < MXFILTINDX ; ifilt++ ) {
@@ -5375,6 +5550,8 @@ void prep_user_input(void) {
   WRFLAG_FITS      = 0 ;
   WRFLAG_FILTERS   = 0 ;
   WRFLAG_COMPACT   = 0 ;
+  WRFLAG_SPEC_COMPACT = 0 ;
+  WRFLAG_FITS_GZ   = 0 ;
 
   // check for whether to write FULL, TERSE, FITS, etc ,
   // EXCEPT for the GRID-GEN option (for psnid ...), 
@@ -5387,9 +5564,14 @@ void prep_user_input(void) {
     WRFLAG_FITS      = ( INPUTS.FORMAT_MASK  & WRMASK_FITS      ) ;
     WRFLAG_FILTERS   = ( INPUTS.FORMAT_MASK  & WRMASK_FILTERS   ) ;
     WRFLAG_COMPACT   = ( INPUTS.FORMAT_MASK  & WRMASK_COMPACT   ) ;
+    WRFLAG_SPEC_COMPACT = ( INPUTS.FORMAT_MASK & WRMASK_SPEC_COMPACT ) ;
+    WRFLAG_FITS_GZ   = ( INPUTS.FORMAT_MASK  & WRMASK_FITS_GZ   ) ;
   }
   if ( WRFLAG_BLINDTEST ) { INPUTS.WRITE_MASK  = WRITE_MASK_LCMERGE ; }
   if ( WRFLAG_COMPACT   ) { INPUTS.WRITE_MASK += WRITE_MASK_COMPACT ; }
+  if ( WRFLAG_SPEC_COMPACT )
+    { INPUTS.WRITE_MASK += WRITE_MASK_SPEC_COMPACT ; }
+  if ( WRFLAG_FITS_GZ   ) { INPUTS.WRITE_MASK += WRITE_MASK_FITS_GZ ; }
   if ( INPUTS.MAGMONITOR_SNR) { 
     SNDATA.MAGMONITOR_SNR = INPUTS.MAGMONITOR_SNR ;
     sprintf(SNDATA.VARNAME_SNRMON, "SIM_SNRMAG%2.2d", SNDATA.MAGMONITOR_SNR);
@@ -5546,8 +5728,13 @@ void prep_user_cosmology(void) {
   
   // init structure that gets passed later to cosmology functions
   int VBOSE = 1;
-  init_HzFUN_INFO(VBOSE, cosPar, HzFUN_FILE, 
-		  &INPUTS.HzFUN_INFO ); // <== returned 
+  init_HzFUN_INFO(VBOSE, cosPar, HzFUN_FILE,
+		  &INPUTS.HzFUN_INFO ); // <== returned
+
+  // Aug 2026: one cosmology per sim job -> tabulate z-integrals once
+  // so rate-init and per-event dLmag calls interpolate instead of
+  // re-integrating.
+  init_HzFUN_CACHE(&INPUTS.HzFUN_INFO);
 
   return;
 
@@ -5583,6 +5770,12 @@ void prep_user_CUTWIN(void) {
     }
     // load structure
     INPUTS.CUTWIN_SNRMAX_NFILT[i] = NFILT_CUT ;
+
+    // Aug 2026: pre-parse filter string into ifilt_obs list so
+    // gen_cutwin does not re-parse it for every event.
+    INPUTS.CUTWIN_SNRMAX_NFILTLIST[i] =
+      PARSE_FILTLIST( INPUTS.CUTWIN_SNRMAX_FILTERS[i],
+		      INPUTS.CUTWIN_SNRMAX_IFILTLIST[i] );
   }
 
 
@@ -5591,16 +5784,31 @@ void prep_user_CUTWIN(void) {
   int IFILT_OBS ;
   char cfilt[2];
   INPUTS.CUTWIN_EPOCHS_NFILT = NFILT;
+  for(i=0; i < MXFILTINDX; i++ )
+    { INPUTS.CUTWIN_EPOCHS_LFILT[i] = false ; } // Aug 2026
   if ( NFILT > 0 ) {
     sprintf(CFILT,"%s", INPUTS.CUTWIN_EPOCHS_FILTERS);
     for(i=0; i < NFILT; i++ ) {
       sprintf(cfilt, "%c", CFILT[i] ) ;
       IFILT_OBS = INTFILTER(cfilt);
       INPUTS.CUTWIN_EPOCHS_IFILTLIST[i] = IFILT_OBS;
+      INPUTS.CUTWIN_EPOCHS_LFILT[IFILT_OBS] = true ; // Aug 2026
     }
   } // end NFILT>0 if block
 
 
+  // Aug 2026: idem for SATURATE and NOSATURATE filter strings.
+  for ( i=0; i < INPUTS.NCUTWIN_SATURATE; i++ ) {
+    INPUTS.CUTWIN_SATURATE_NFILTLIST[i] =
+      PARSE_FILTLIST( INPUTS.CUTWIN_SATURATE_FILTERS[i],
+		      INPUTS.CUTWIN_SATURATE_IFILTLIST[i] );
+  }
+  for ( i=0; i < INPUTS.NCUTWIN_NOSATURATE; i++ ) {
+    INPUTS.CUTWIN_NOSATURATE_NFILTLIST[i] =
+      PARSE_FILTLIST( INPUTS.CUTWIN_NOSATURATE_FILTERS[i],
+		      INPUTS.CUTWIN_NOSATURATE_IFILTLIST[i] );
+  }
+
   return ;
 
 } // end prep_user_CUTWIN
@@ -6293,6 +6501,242 @@ void prep_simpath(void) {
 }  // end of prep_simpath
 
 
+// *************************************
+void init_GENFORK(void) {
+
+  // Created Aug 2026
+  // Implement NFORK_GEN option to fork parallel event-generation
+  // processes AFTER the one-time init (SIMLIB/HOSTLIB/kcor/genmodel)
+  // so the large read-only tables are shared copy-on-write instead
+  // of being re-read by each batch job. Each child process
+  //   + generates NGEN/NFORK events
+  //   + writes its own [GENVERSION]-FORKnnn output version
+  //   + re-seeds its random streams (deterministic per fork index)
+  //   + re-opens the SIMLIB and uses the JOBID/NJOBTOT logic in
+  //     SIMLIB_findStart() to read its own LIBID range.
+  // Parent waits for the children and generates nothing itself;
+  // for FITS format the parent then merges the FORKnnn versions
+  // into a single [GENVERSION] (see merge_GENFORK), so a forked
+  // production looks like one job downstream.
+
+  int  NFORK = INPUTS.NFORK_GEN ;
+  int  ifork, NGEN_SUM=0, NGEN_FORK ;
+  int  NDONE=0, NFAIL=0, wstat ;
+  pid_t pid ;
+  char GENVERSION_ORIG[200];
+  char fnam[] = "init_GENFORK" ;
+
+  // ----------- BEGIN -----------
+
+  sprintf(BANNER,"%s: fork %d event-generation processes", fnam, NFORK );
+  print_banner(BANNER);
+
+  if ( INPUTS.NJOBTOT > 0 ) {
+    sprintf(c1err,"Cannot mix NFORK_GEN=%d with batch NJOBTOT=%d",
+	    NFORK, INPUTS.NJOBTOT );
+    sprintf(c2err,"Remove either NFORK_GEN or JOBID/NJOBTOT keys.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID ) {
+    sprintf(c1err,"Cannot use NFORK_GEN with GENSOURCE: GRID");
+    sprintf(c2err,"Remove NFORK_GEN key.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  sprintf(GENVERSION_ORIG, "%s", INPUTS.GENVERSION);
+
+  for ( ifork=1; ifork <= NFORK; ifork++ ) {
+
+    // split NGEN among forks; last fork picks up the remainder
+    if ( ifork < NFORK )
+      { NGEN_FORK = INPUTS.NGEN / NFORK ; }
+    else
+      { NGEN_FORK = INPUTS.NGEN - NGEN_SUM ; }
+    NGEN_SUM += NGEN_FORK ;
+
+    fflush(stdout);
+    pid = fork();
+
+    if ( pid < 0 ) {
+      sprintf(c1err,"fork %d of %d failed.", ifork, NFORK );
+      sprintf(c2err,"Check process limits on this node.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    if ( pid == 0 ) {
+      // child: prepare private output version, randoms and SIMLIB
+      // range, then return to main and generate events as usual.
+      prep_GENFORK_child(ifork, NGEN_FORK, GENVERSION_ORIG);
+      return ;
+    }
+
+  } // end ifork loop
+
+  // parent: wait for all children, then quit without generating.
+  while ( NDONE < NFORK ) {
+    pid = wait(&wstat);
+    if ( pid < 0 ) { break ; }
+    NDONE++ ;
+    if ( !WIFEXITED(wstat) || WEXITSTATUS(wstat) != 0 ) { NFAIL++ ; }
+  }
+
+  if ( NFAIL > 0 ) {
+    sprintf(c1err,"%d of %d forked generation jobs failed.", NFAIL, NFORK);
+    sprintf(c2err,"Check stdout above for child abort messages.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  printf("\n %s: all %d forked generation jobs done. \n", fnam, NFORK);
+  fflush(stdout);
+
+  // merge per-fork FITS output into single version
+  merge_GENFORK(GENVERSION_ORIG);
+
+  exit(0);  // parent writes no events
+
+} // end init_GENFORK
+
+
+// *************************************
+void prep_GENFORK_child(int ifork, int NGEN_FORK, char *GENVERSION_ORIG) {
+
+  // Created Aug 2026
+  // Called by forked child process 'ifork' (1 to NFORK_GEN) to
+  // prepare its private output version, event count, random seed
+  // and SIMLIB read-range. See init_GENFORK().
+
+  int  NFORK = INPUTS.NFORK_GEN ;
+  int  lenpath ;
+  char fnam[] = "prep_GENFORK_child" ;
+
+  // ----------- BEGIN -----------
+
+  // private output version per fork
+  sprintf(INPUTS.GENVERSION, "%s-FORK%3.3d", GENVERSION_ORIG, ifork );
+  sprintf(INPUTS.GENPREFIX,  "%s", INPUTS.GENVERSION );
+  init_VERSION(INPUTS.GENVERSION);
+
+  // strip parent /GENVERSION subdir from PATH_SNDATA_SIM,
+  // then re-append private subdir with prep_simpath().
+  lenpath = strlen(PATH_SNDATA_SIM) - strlen(GENVERSION_ORIG) - 1 ;
+  PATH_SNDATA_SIM[lenpath] = 0 ;
+  prep_simpath();
+
+  // generate this fork's share of events
+  INPUTS.NGEN = NGEN_FORK ;
+  if ( INPUTS.NGEN_LC    > 0 ) { INPUTS.NGEN_LC    = NGEN_FORK ; }
+  if ( INPUTS.NGENTOT_LC > 0 ) { INPUTS.NGENTOT_LC = NGEN_FORK ; }
+
+  // avoid CID collisions among forks
+  INPUTS.CIDOFF += (ifork-1) * NGEN_FORK ;
+
+  // independent & deterministic random streams per fork
+  init_random_seed(INPUTS.ISEED + 7919*(ifork-1), INPUTS.NSTREAM_RAN);
+
+  // re-open SIMLIB so each fork has its own file handle;
+  // SIMLIB_findStart() uses JOBID/NJOBTOT to pick the LIBID range
+  // the same way as for batch jobs.
+  INPUTS.JOBID   = ifork ;
+  INPUTS.NJOBTOT = NFORK ;
+  if ( fp_SIMLIB != NULL ) { fclose(fp_SIMLIB);  fp_SIMLIB = NULL ; }
+  SIMLIB_readGlobalHeader_TEXT();
+  SIMLIB_findStart();
+
+  printf("\t fork %2.2d: NGEN=%d  GENVERSION=%s \n",
+	 ifork, NGEN_FORK, INPUTS.GENVERSION );
+  fflush(stdout);
+
+} // end prep_GENFORK_child
+
+
+// *************************************
+void merge_GENFORK(char *GENVERSION_ORIG) {
+
+  // Created Aug 2026
+  // Called by init_GENFORK parent after all children finish:
+  // row-concatenate the per-fork HEAD/PHOT fits files into a single
+  // [GENVERSION] output version (MERGE_SNFITSIO_SPLIT fixes the
+  // PTROBS pointers) and write its .LIST & .README so that a forked
+  // production is consumed downstream like one job. The FORKnnn
+  // sub-versions are left in place for debugging.
+
+  int  NFORK = INPUTS.NFORK_GEN ;
+  int  ifork, lenpath, isys ;
+  char **headFile_list, **photFile_list ;
+  char headFile_out[MXPATHLEN], photFile_out[MXPATHLEN];
+  char pathBase[MXPATHLEN], listFile[MXPATHLEN], cmd[2*MXPATHLEN];
+  char VERSION_FORK[2*MXPATHLEN];
+  FILE *fp ;
+  char fnam[] = "merge_GENFORK" ;
+
+  // ----------- BEGIN -----------
+
+  if ( !WRFLAG_FITS ) {
+    printf("\t TEXT format -> skip merge; keep per-fork versions.\n");
+    fflush(stdout);  return ;
+  }
+  if ( SPECTROGRAPH_USEFLAG ) {
+    printf("\t SPECTROGRAPH output -> skip merge; "
+	   "keep per-fork versions.\n");
+    fflush(stdout);  return ;
+  }
+
+  // base path = PATH_SNDATA_SIM without /GENVERSION subdir
+  sprintf(pathBase, "%s", PATH_SNDATA_SIM);
+  lenpath = strlen(pathBase) - strlen(GENVERSION_ORIG) - 1 ;
+  pathBase[lenpath] = 0 ;
+
+  headFile_list = (char**) malloc( NFORK * sizeof(char*) );
+  photFile_list = (char**) malloc( NFORK * sizeof(char*) );
+  for(ifork=1; ifork <= NFORK; ifork++ ) {
+    headFile_list[ifork-1] = (char*) malloc( 2*MXPATHLEN*sizeof(char) );
+    photFile_list[ifork-1] = (char*) malloc( 2*MXPATHLEN*sizeof(char) );
+    sprintf(VERSION_FORK, "%s-FORK%3.3d", GENVERSION_ORIG, ifork);
+    sprintf(headFile_list[ifork-1], "%s/%s/%s_HEAD.FITS",
+	    pathBase, VERSION_FORK, VERSION_FORK );
+    sprintf(photFile_list[ifork-1], "%s/%s/%s_PHOT.FITS",
+	    pathBase, VERSION_FORK, VERSION_FORK );
+  }
+
+  sprintf(headFile_out, "%s/%s_HEAD.FITS",
+	  PATH_SNDATA_SIM, INPUTS.GENPREFIX );
+  sprintf(photFile_out, "%s/%s_PHOT.FITS",
+	  PATH_SNDATA_SIM, INPUTS.GENPREFIX );
+
+  MERGE_SNFITSIO_SPLIT(NFORK, headFile_list, photFile_list,
+		       headFile_out, photFile_out );
+
+  // write LIST file pointing to merged header file
+  sprintf(listFile, "%s/%s.LIST", PATH_SNDATA_SIM, GENVERSION_ORIG );
+  fp = fopen(listFile, "wt");
+  if ( fp == NULL ) {
+    sprintf(c1err,"Could not open LIST file for merged version:");
+    sprintf(c2err,"%s", listFile);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+  fprintf(fp, "%s_HEAD.FITS", INPUTS.GENPREFIX );
+  fclose(fp);
+
+  // copy README from first fork so readers find one
+  sprintf(VERSION_FORK, "%s-FORK%3.3d", GENVERSION_ORIG, 1 );
+  sprintf(cmd, "cp %s/%s/%s.README %s/%s.README",
+	  pathBase, VERSION_FORK, VERSION_FORK,
+	  PATH_SNDATA_SIM, GENVERSION_ORIG );
+  isys = system(cmd);
+
+  for(ifork=0; ifork < NFORK; ifork++ )
+    { free(headFile_list[ifork]); free(photFile_list[ifork]); }
+  free(headFile_list); free(photFile_list);
+
+  printf("\t Merged output version: %s \n", GENVERSION_ORIG );
+  fflush(stdout);
+
+  return ;
+
+} // end merge_GENFORK
+
+
 // ************************************
 void genperfect_override(void) {
 
@@ -6996,6 +7440,7 @@ void init_simvar(void) {
 
   NGENLC_TOT = NGENLC_WRITE = NGENSPEC_TOT = NGENSPEC_WRITE = 0;
   NGENFLUX_DRIVER = 0 ;
+  NEPSKIP_GENMAG_TRIAGE = NEPCHECK_GENMAG_TRIAGE = 0 ;
 
   NGEN_REJECT.GENRANGE  = 0;
   NGEN_REJECT.GENMAG    = 0;
@@ -7143,11 +7588,13 @@ void  init_GENLC(void) {
   // Jul 20 2019: add skip for repeated strong lens images
 
   int epoch, ifilt, ifilt_obs, i, obs, imjd, NEP_RESET ;
+  int NOBS_RESET, NMJD_RESET ;  // Aug 2026 (see NEP_RESET comment)
   char fnam[] = "init_GENLC" ;
 
   // -------------- BEGIN ---------------
 
   GENLC.PEAKMAG_TRIGGER_FLAG = 0 ;
+  GENLC.GENMAG_TRIAGE_VALID  = 0 ;  // Aug 2026
   GENLC.ACCEPTFLAG_LAST  = GENLC.ACCEPTFLAG ;
   GENLC.ACCEPTFLAG       = 0 ;
   GENLC.ACCEPTFLAG_FORCE = 0 ;
@@ -7313,6 +7760,7 @@ void  init_GENLC(void) {
     GENLC.OBSFLAG_WRITE[epoch] = false ;
 
     sprintf(GENLC.FIELDNAME[epoch],"%s", FIELD_NONAME );
+    GENLC.IFIELD_OVP[epoch]   = -9 ;  // Aug 2026
 
     GENLC.MJD[epoch]          = NULLFLOAT ;
     GENLC.epoch_obs[epoch]   = NULLFLOAT ;
@@ -7353,9 +7801,15 @@ void  init_GENLC(void) {
 
 
   // init GENSPEC stuff
+  // Aug 2026: as with NEP_RESET, only spectra filled by the previous
+  // event need re-initialization after the first full reset.
   if ( INPUTS.SPECTROGRAPH_OPTIONS.DOFLAG_SPEC ) {
+    if ( NGENLC_TOT == 1 || GENSPEC.NMJD_TOT >= MXSPEC )
+      { NMJD_RESET = MXSPEC ; }
+    else
+      { NMJD_RESET = GENSPEC.NMJD_TOT ; }
     GENSPEC.NMJD_TOT = 0 ;
-    for(imjd=0; imjd < MXSPEC; imjd++ )  { GENSPEC_INIT(1,imjd); }
+    for(imjd=0; imjd < NMJD_RESET; imjd++ )  { GENSPEC_INIT(1,imjd); }
   }
 
   // keep track of last coord to skip parts of gen_MWEBV
@@ -7387,9 +7841,20 @@ void  init_GENLC(void) {
   GENLC.REDSHIFT_FLAG         = REDSHIFT_FLAG_NONE ;
   GENLC.VPEC = GENLC.VPEC_SMEAR = 0.0 ;
 
-  sprintf(GENLC.SNTYPE_NAME, "UNKNOWN" ); 
+  sprintf(GENLC.SNTYPE_NAME, "UNKNOWN" );
+
+  // Aug 2026: limit reset to entries touched by the previous cadence
+  // (same NEP_RESET idea); SIMLIB_OBS_RAW.NOBS still holds the
+  // previous event's count here. Full reset on first event so the
+  // PTR_FIELDNAME/PTR_BAND pointers are set for every slot.
+  if ( NGENLC_TOT == 1 )
+    { NOBS_RESET = MXOBS_SIMLIB ; }
+  else {
+    NOBS_RESET = SIMLIB_OBS_RAW.NOBS + 2 ;
+    if ( NOBS_RESET > MXOBS_SIMLIB ) { NOBS_RESET = MXOBS_SIMLIB ; }
+  }
 
-  for(i=0; i < MXOBS_SIMLIB; i++ ) {
+  for(i=0; i < NOBS_RESET; i++ ) {
     SIMLIB_OBS_GEN.IFILT_OBS[i]  = -9 ;
     SIMLIB_OBS_GEN.MJD[i]        = -99. ;
     SIMLIB_OBS_GEN.CCDGAIN[i]    = -99. ;
@@ -7882,11 +8347,82 @@ void  init_genSpec(void) {
     GENSPEC.RANGauss_NOISE_TEMPLATE[ilam] = (double*) malloc(MEMD) ;
   }
 
+  // pre-compute Gaussian lambda-smear weights (Aug 2026)
+  GENSPEC_LAMSMEAR_TABLE_INIT();
 
   return ;
 
 } // end init_genSpec
 
+
+// *****************************************************
+void GENSPEC_LAMSMEAR_TABLE_INIT(void) {
+
+  // Created Aug 2026
+  // Pre-compute Gaussian lambda-smear weights for GENSPEC_LAMSMEAR.
+  // The resolution kernel depends only on the static spectrograph
+  // table (LAMAVG, LAMSIGMA, bin edges) and the NLAMSIGMA option,
+  // so the GaussIntegral calls are done once per lambda bin here
+  // instead of for every flux deposit of every event.
+
+  int    NBLAM   = INPUTS_SPECTRO.NBIN_LAM ;
+  double NSIGLAM = INPUTS.SPECTROGRAPH_OPTIONS.NLAMSIGMA ;
+
+  int    ilam, ilam2, ilam_tmp, NBIN2, i2 ;
+  double LAMAVG, LAMSIGMA, LAMBIN, LAMSIG0, LAMSIG1, GINT ;
+  long long MEMTOT = 0 ;
+  char fnam[] = "GENSPEC_LAMSMEAR_TABLE_INIT" ;
+
+  // ------------ BEGIN ------------
+
+  GENSPEC_LAMSMEAR_TABLE.USEFLAG    = 0 ;
+  GENSPEC_LAMSMEAR_TABLE.NBIN2_LIST = (int    *) malloc(NBLAM*sizeof(int)   );
+  GENSPEC_LAMSMEAR_TABLE.GINT_LIST  = (double**) malloc(NBLAM*sizeof(double*));
+
+  for(ilam=0; ilam < NBLAM; ilam++ ) {
+
+    LAMAVG   = INPUTS_SPECTRO.LAMAVG_LIST[ilam] ;
+    LAMSIGMA = INPUTS_SPECTRO.LAMSIGMA_LIST[ilam] ;
+
+    // for LAMBIN, avoid edge bin which can be artificially small
+    // (same logic as in GENSPEC_LAMSMEAR)
+    ilam_tmp = ilam;  if ( ilam == NBLAM-1 ) { ilam_tmp = NBLAM-2; }
+    LAMBIN   = INPUTS_SPECTRO.LAMBIN_LIST[ilam_tmp] ;
+
+    NBIN2 = (int)(NSIGLAM*LAMSIGMA/LAMBIN) ;
+    GENSPEC_LAMSMEAR_TABLE.NBIN2_LIST[ilam] = NBIN2 ;
+    GENSPEC_LAMSMEAR_TABLE.GINT_LIST[ilam]  =
+      (double*) malloc( (2*NBIN2+1) * sizeof(double) );
+    MEMTOT += (2*NBIN2+1) * sizeof(double) ;
+
+    i2 = 0 ;
+    for(ilam2 = ilam-NBIN2; ilam2 <= ilam+NBIN2; ilam2++ ) {
+      GINT = 0.0 ;
+      if ( ilam2 >= 0 && ilam2 < NBLAM ) {
+	if ( LAMSIGMA > 0.0 ) {
+	  LAMSIG0 = (INPUTS_SPECTRO.LAMMIN_LIST[ilam2]-LAMAVG)/LAMSIGMA ;
+	  LAMSIG1 = (INPUTS_SPECTRO.LAMMAX_LIST[ilam2]-LAMAVG)/LAMSIGMA ;
+	  GINT = GaussIntegral(LAMSIG0,LAMSIG1);
+	}
+	else if ( ilam2 == ilam )  // LAMSIGMA=0 -> all flux in same bin
+	  { GINT = 1.0 ; }
+      }
+      GENSPEC_LAMSMEAR_TABLE.GINT_LIST[ilam][i2] = GINT ;
+      i2++ ;
+    }
+
+  } // end ilam
+
+  GENSPEC_LAMSMEAR_TABLE.USEFLAG = 1 ;
+
+  printf("\t %s: store %.2f MB of lambda-smear weights. \n",
+	 fnam, 1.0E-6*(double)MEMTOT );
+  fflush(stdout);
+
+  return ;
+
+} // end GENSPEC_LAMSMEAR_TABLE_INIT
+
 // *****************************************************
 void GENSPEC_DRIVER(void) {
 
@@ -8612,25 +9148,55 @@ void GENSPEC_TEXPOSE_TAKE_SPECTRUM(int imjd) {
     goto CLEANUP ;
   }
 
-  // assume SNR is linear function of sqrt(TEXPOSE);
-  // iterate until convergence.
+  // Aug 2026: walk the tabulated TEXPOSE grid to bracket SNR_REQUEST
+  // (SNR is monotonic in TEXPOSE), then seed the refinement loop with
+  // a sqrt-law interpolation inside the bracketing grid bin:
   //    SNR ~ SNR0 + (SNR1-SNR0) * sqrt[(T-T0)/(T1-T0)]
-  //    T -> T0 + (T1-T0) * [ (SNR-SNR0)/(SNR1-SNR0) ]^2 
-  // 
+  //    T -> T0 + (T1-T0) * [ (SNR-SNR0)/(SNR1-SNR0) ]^2
+  // The tight bracket replaces the old blind scale-and-creep search
+  // from the full TEXPOSE range, so the loop below typically
+  // converges in one or two full SNR evaluations.
+
+  int    ib, NBT = INPUTS_SPECTRO.NBIN_TEXPOSE ;
+  double T0=TEXPOSE_MIN, T1=TEXPOSE_MAX ;
+  double SNR0=SNR_MIN, SNR1=SNR_MAX, T_TMP, SNR_TMP ;
+
+  for(ib=1; ib < NBT-1; ib++ ) {
+    T_TMP = INPUTS_SPECTRO.TEXPOSE_LIST[ib] ;
+
+    if ( GENSPEC.NMJD_PROC == 0 && SCALE > 0.01 ) {
+      TEXPOSE_T = T_TMP * SCALE ;
+      if ( TEXPOSE_T <= TEXPOSE_MIN ) { TEXPOSE_T = TEXPOSE_MIN; }
+      if ( TEXPOSE_T >= TEXPOSE_MAX ) { TEXPOSE_T = TEXPOSE_MAX; }
+      GENSPEC.TEXPOSE_TEMPLATE = TEXPOSE_T ;
+    }
+
+    GENSPEC.TEXPOSE_LIST[imjd] = T_TMP ;
+    GENSPEC_OBSFLUX_INIT(imjd,ILAM_MIN,ILAM_MAX);
+    SNR_TMP = GENSPEC_SMEAR(imjd,LAMMIN_OBS,LAMMAX_OBS);
+
+    if ( LDMP ) {
+      printf(" xxx grid ib=%2d: Texpose=%6.1f  SNR=%6.2f \n",
+	     ib, T_TMP, SNR_TMP ); fflush(stdout);
+    }
+
+    if ( SNR_TMP < SNR_REQUEST )
+      { T0 = T_TMP ;  SNR0 = SNR_TMP ; }      // below request; keep walking
+    else
+      { T1 = T_TMP ;  SNR1 = SNR_TMP ; break ; } // bracket found
+  }
 
-  double T0=TEXPOSE_MIN, T1=TEXPOSE_MAX, TDIF_LAST=T1-T0;
-  double SNR0=SNR_MIN, SNR1=SNR_MAX;
   double argSNR, last_tol, last_TEXPOSE, sgn=0.0 ;
   double tol=99.0 , tol_converge = 0.03 ;
-  int    NITER=0, MAXITER=40, FLAG_TEXPOSE=0 ;  
+  int    NITER=0, MAXITER=40, FLAG_TEXPOSE=0 ;
 
   TEXPOSE = 0.0;
 
   while ( fabs(tol) > tol_converge ) {
 
-    if ( NITER==0 ) 
+    if ( NITER==0 )
       { FLAG_TEXPOSE=0 ; }
-    else if ( sgn == 0.0 ) 
+    else if ( sgn == 0.0 )
       { FLAG_TEXPOSE=1 ; }
     else
       { FLAG_TEXPOSE=2 ; }
@@ -8639,16 +9205,9 @@ void GENSPEC_TEXPOSE_TAKE_SPECTRUM(int imjd) {
     last_TEXPOSE = TEXPOSE ;
 
     if ( FLAG_TEXPOSE == 0 ) {
-      if ( GENSPEC.NMJD_PROC == 0 ) {
-	// first epoch is always closest to peak
-	argSNR  = (SNR_REQUEST - SNR0)/(SNR1 - SNR0);
-	TEXPOSE = T0 + TDIF_LAST * (argSNR*argSNR) ;
-	TEXPOSE *= 2.0 ; // guess from added template noise
-      }
-      else  { 
-	// best guess is that TEXPOSE is similar to TEXPOSE_TEMPLATE
-	TEXPOSE = GENSPEC.TEXPOSE_TEMPLATE*1.2 ; 
-      }
+      // sqrt-law interpolation inside bracketing grid bin
+      argSNR  = (SNR_REQUEST - SNR0)/(SNR1 - SNR0);
+      TEXPOSE = T0 + (T1-T0) * (argSNR*argSNR) ;
     }
     else if ( FLAG_TEXPOSE == 1 ) {
       // keep scaling by SNR-ratio until we go too far
@@ -8932,23 +9491,37 @@ void  GENSPEC_LAMSMEAR(int imjd, int ilam, double GenFlux,
   ilam_tmp = ilam;  if ( ilam == NBLAM-1 ) { ilam_tmp = NBLAM-2; }
   LAMBIN   = INPUTS_SPECTRO.LAMBIN_LIST[ilam_tmp] ;
 
-  NBIN2    = (int)(NSIGLAM*LAMSIGMA/LAMBIN) ;  
-  SUM_GINT = 0.0 ; 
+  // Aug 2026: use pre-computed smear weights, except for noNOISE
+  // option which forces LAMSIGMA=0 above.
+  int     USE_TABLE = ( GENSPEC_LAMSMEAR_TABLE.USEFLAG && noNOISE == 0 );
+  double *ptrGINT   = NULL ;
+  if ( USE_TABLE ) {
+    NBIN2   = GENSPEC_LAMSMEAR_TABLE.NBIN2_LIST[ilam] ;
+    ptrGINT = GENSPEC_LAMSMEAR_TABLE.GINT_LIST[ilam] ;
+  }
+  else
+    { NBIN2 = (int)(NSIGLAM*LAMSIGMA/LAMBIN) ; }
+
+  SUM_GINT = 0.0 ;
   NRAN     = 0 ;
 
   // loop over neighbor bins to smear flux over lambda bins
   for(ilam2=ilam-NBIN2; ilam2 <= ilam+NBIN2; ilam2++ ) {
     if ( ilam2 <  0     ) { continue ; }
     if ( ilam2 >= NBLAM ) { continue ; }
-    
-    GINT = 1.0 ;
-    if ( LAMSIGMA > 0.0 ) {
-      LAMSIG0 = (INPUTS_SPECTRO.LAMMIN_LIST[ilam2]-LAMAVG)/LAMSIGMA ;
-      LAMSIG1 = (INPUTS_SPECTRO.LAMMAX_LIST[ilam2]-LAMAVG)/LAMSIGMA ;
-      GINT = GaussIntegral(LAMSIG0,LAMSIG1); 
+
+    if ( USE_TABLE )
+      { GINT = ptrGINT[ilam2-(ilam-NBIN2)] ; }
+    else {
+      GINT = 1.0 ;
+      if ( LAMSIGMA > 0.0 ) {
+	LAMSIG0 = (INPUTS_SPECTRO.LAMMIN_LIST[ilam2]-LAMAVG)/LAMSIGMA ;
+	LAMSIG1 = (INPUTS_SPECTRO.LAMMAX_LIST[ilam2]-LAMAVG)/LAMSIGMA ;
+	GINT = GaussIntegral(LAMSIG0,LAMSIG1);
+      }
+      else if ( ilam != ilam2 ) // LAMSIGMA=0; dump all flux in same bin
+	{ GINT = 0.0 ; }
     }
-    else if ( ilam != ilam2 ) // LAMSIGMA=0; dump all flux in same bin
-      { GINT = 0.0 ; }
 
     SUM_GINT += GINT ; // for debug only; should be 1 except near edges    
     GINT_SQRT = sqrt(GINT);
@@ -9373,7 +9946,9 @@ void gen_event_driver(int ilc) {
 
     // read entry from libray after generated PEAKMJD and redshift ;
     // see comment above.
+    SIMTIMER_START(ITIMER_SIM_SIMLIB);
     SIMLIB_READ_DRIVER();
+    SIMTIMER_STOP(ITIMER_SIM_SIMLIB);
 
     GENLC.CID   = GENLC.CIDOFF + ilc ; 
     if ( GENLC.NEPOCH < NEPMIN ) { return ; }
@@ -10044,11 +10619,11 @@ void gen_filtmap(int ilc) {
   // Feb 01, 2014: check ALLSKIP flag and increment NGEN_ALLSKIP
   // Sep 26 2017: give WARNING only if SIMLIB.NOBS > 0
 
-  int  colopt, irank, istat, ALLSKIP, NDOFILT_ZERO=0;
+  int  colopt, irank, ALLSKIP, NDOFILT_ZERO=0;
   int  ifilt, ifilt_obs, ifilt_rest1, ifilt_rest2, ifilt_rest3, ep  ;
 
   float  z4, lamdif4[10];
-  double z, ztmp, lamz ;
+  double z, ztmp ;
   char fnam[] = "gen_filtmap" ;
 
   // ------------- BEGIN ----------
@@ -10070,32 +10645,17 @@ void gen_filtmap(int ilc) {
       continue ;
     }
 
-    // skip this filter if it's outside the valid rest-frame
-    // wavelength range of the model (Feb 2012)
-    lamz = INPUTS.LAMAVG_OBS[ifilt_obs]/(1.0+z);
-    if ( lamz < GENLC.RESTLAM_MODEL[0] || lamz > GENLC.RESTLAM_MODEL[1] ) {
-      GENLC.DOFILT[ifilt_obs] = 0; 
-      NDOFILT_ZERO++ ; 
-      NSKIP_FILTER[ifilt_obs]++ ; 
+    // skip this filter if z is outside its precomputed valid range;
+    // Aug 2026: replaces per-event rest-wavelength range test and
+    // IFILTSTAT_SEDMODEL call (see init_ZVALID_GENFILT).
+    if ( z < ZVALID_GENFILT.ZMIN[ifilt_obs] ||
+	 z > ZVALID_GENFILT.ZMAX[ifilt_obs] ) {
+      GENLC.DOFILT[ifilt_obs] = 0;
+      NDOFILT_ZERO++ ;
+      NSKIP_FILTER[ifilt_obs]++ ;
       continue ;
     }
 
-    // check if this filter is valid for SALT2/SIMSED model in observer-frame.
-    if ( INDEX_GENMODEL == MODEL_SALT2  || 
-	 INDEX_GENMODEL == MODEL_SIMSED	||
-	 INDEX_GENMODEL == MODEL_NON1ASED   // 9.24.2017
-	 ) {
-      istat = IFILTSTAT_SEDMODEL(ifilt_obs, z) ; 
-      if ( istat == 0 ) {
-	GENLC.DOFILT[ifilt_obs] = 0 ;
-	NDOFILT_ZERO++ ;
-	NSKIP_FILTER[ifilt_obs]++ ; 
-	continue ;
-      }
-
-      //  printf(" xxxx ifilt_obs=%d  z=%f  istat=%d \n",ifilt_obs,z8,istat);
-    }
-
     if ( GENFRAME_OPT  == GENFRAME_REST  ) {
 
       irank = 1;
@@ -10986,6 +11546,18 @@ void wr_SIMGEN_YAML(SIMFILE_AUX_DEF *SIMFILE_AUX) {
     fprintf(fp, "NGENSPEC_WRITE:  %d\n",    NGENSPEC_WRITE );
     fprintf(fp, "CPU_MINUTES:     %.2f\n",  t_gen/60.0     );
     fprintf(fp, "ABORT_IF_ZERO:   %d\n",    NGENLC_WRITE   );
+
+    // Aug 2026: machine-readable cut stats so submit scripts stop
+    // scraping them out of the README text.
+    fprintf(fp, "GENEFF:          %.5f\n",  GENLC.GENEFF    );
+    fprintf(fp, "GENEFF_ERR:      %.5f\n",  GENLC.GENEFFERR );
+    fprintf(fp, "NGEN_REJECT:\n");
+    fprintf(fp, "  GENRANGE:      %d\n",  NGEN_REJECT.GENRANGE  );
+    fprintf(fp, "  GENMAG:        %d\n",  NGEN_REJECT.GENMAG    );
+    fprintf(fp, "  HOSTLIB:       %d\n",  NGEN_REJECT.HOSTLIB   );
+    fprintf(fp, "  SEARCHEFF:     %d\n",  NGEN_REJECT.SEARCHEFF );
+    fprintf(fp, "  CUTWIN:        %d\n",  NGEN_REJECT.CUTWIN    );
+    fprintf(fp, "  NEPOCH:        %d\n",  NGEN_REJECT.NEPOCH    );
     fclose(fp);
 
     return;
@@ -11068,7 +11640,9 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
     // (for faster writing)
     SIMFILE_AUX->OUTLINE = (char *) malloc( 50 + sizeof(char)*NVAR*20 );
     // open file and write header
-    if ( (SIMFILE_AUX->FP_DUMP = fopen(ptrFile, "wt")) == NULL ) {       
+    // (append without re-writing header on checkpoint restart, Aug 2026)
+    char *mode_DUMP = SIMCHECKPOINT.RESTART_FLAG ? "at" : "wt" ;
+    if ( (SIMFILE_AUX->FP_DUMP = fopen(ptrFile, mode_DUMP)) == NULL ) {
       sprintf ( c1err, "Cannot open SIMGEN dump file :" );
       sprintf ( c2err," '%s' ", ptrFile );
       errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
@@ -11085,11 +11659,30 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
       pvar = INPUTS.VARNAME_SIMGEN_DUMP[ivar] ;
       INDEX_SIMGEN_DUMP[ivar] = MATCH_INDEX_SIMGEN_DUMP(pvar);
       if ( strstr(pvar,"WIDTH") ) { GENLC.NWIDTH_SIMGEN_DUMP++; }
+
+      // Aug 2026: resolve r8 output format once (not per event)
+      IFMT_SIMGEN_DUMP[ivar] = IFMT_SIMGEN_DUMP_DEFAULT ;
+      if ( strstr(pvar,"MJD") != NULL )
+	{ IFMT_SIMGEN_DUMP[ivar] = IFMT_SIMGEN_DUMP_MJD ; }
+      else if ( strstr(pvar,"RA") != NULL || strstr(pvar,"DEC") != NULL )
+	{ IFMT_SIMGEN_DUMP[ivar] = IFMT_SIMGEN_DUMP_COORD ; }
+
     } // end of ivar loop over user variables
     if ( GENLC.NWIDTH_SIMGEN_DUMP>0 ) { init_lightCurveWidth(); }
 
-    // - - - - - - - - - 
+    // Aug 2026: init double-buffered writer
+    SIMGEN_DUMP_WRITER.BUF[0] = (char*)malloc(MXCHAR_BUF_SIMGEN_DUMP);
+    SIMGEN_DUMP_WRITER.BUF[1] = (char*)malloc(MXCHAR_BUF_SIMGEN_DUMP);
+    SIMGEN_DUMP_WRITER.IBUF   = 0 ;
+    SIMGEN_DUMP_WRITER.LEN    = 0 ;
+    SIMGEN_DUMP_WRITER.THREAD_ACTIVE = false ;
+    SIMGEN_DUMP_WRITER.FP     = SIMFILE_AUX->FP_DUMP ;
+
+    // - - - - - - - - -
     // now write header info to dump file.
+    // (header already present on checkpoint restart)
+    if ( SIMCHECKPOINT.RESTART_FLAG ) { return; }
+
     fprintf(fp, "#\n"  );
     fprintf(fp, "# Simulation SUMMARY: one row per event. \n");
     fprintf(fp, "#  MODEL:     %s \n", INPUTS.GENMODEL   );
@@ -11152,18 +11745,29 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
     }
 
 
-    sprintf(SIMFILE_AUX->OUTLINE, "SN: " );
-
     NVAR = INPUTS.NVAR_SIMGEN_DUMP ; // update NVAR
+
+    // Aug 2026: serialize row into in-memory buffer with a cursor
+    // (no per-cell strcat re-scan); swap buffers first if this row
+    // might not fit, so a background thread flushes the full one.
+    if ( SIMGEN_DUMP_WRITER.LEN + 50 + NVAR*40 > MXCHAR_BUF_SIMGEN_DUMP )
+      { swap_SIMGEN_DUMP_BUFFER(SIMFILE_AUX); }
+
+    char *ptrRow, *pc ;
+    ptrRow = &SIMGEN_DUMP_WRITER.BUF[SIMGEN_DUMP_WRITER.IBUF]
+                                    [SIMGEN_DUMP_WRITER.LEN] ;
+    pc = ptrRow ;
+    pc += sprintf(pc, "SN: " );
+
     for ( ivar=0; ivar < NVAR; ivar++ ) {
 
       pvar  = INPUTS.VARNAME_SIMGEN_DUMP[ivar] ;
       index = INDEX_SIMGEN_DUMP[ivar] ;
 
       if ( index < 0 || index > NVAR_SIMGEN_DUMP ) {
-	sprintf(c1err,"invalid index=%d for var='%s' ivar=%d", 
+	sprintf(c1err,"invalid index=%d for var='%s' ivar=%d",
 		index, pvar, ivar );
-	errmsg(SEV_FATAL, 0, fnam, c1err, "" ); 
+	errmsg(SEV_FATAL, 0, fnam, c1err, "" );
       }
 
       r4   = *SIMGEN_DUMP[index].PTRVAL4 ;
@@ -11171,49 +11775,57 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
       i4   = *SIMGEN_DUMP[index].PTRINT4 ;
       i8   = *SIMGEN_DUMP[index].PTRINT8 ;
       str  =  SIMGEN_DUMP[index].PTRCHAR ;  // 7.30.2014
-      
-      if ( r4 != SIMGEN_DUMMY.VAL4 )  
-	{ sprintf(cval," %.5le",  r4 ); }
 
-      else if ( r8 != SIMGEN_DUMMY.VAL8 )  { 
+      if ( r4 != SIMGEN_DUMMY.VAL4 )
+	{ pc += sprintf(pc," %.5le",  r4 ); }
+
+      else if ( r8 != SIMGEN_DUMMY.VAL8 )  {
 	ir8 = (long long)r8 ;
 
-	if ( strstr(pvar,"MJD") != NULL ) 
-	  {  sprintf(cval," %.3f", r8 ); }
-	else if ( strstr(pvar,"RA") != NULL ) 
-	  {  sprintf(cval," %.6f", r8 ); }
-	else if ( strstr(pvar,"DEC") != NULL ) 
-	  {  sprintf(cval," %.6f", r8 ); }
+	// Aug 2026: format resolved at init; no strstr per event
+	if ( IFMT_SIMGEN_DUMP[ivar] == IFMT_SIMGEN_DUMP_MJD )
+	  {  pc += sprintf(pc," %.3f", r8 ); }
+	else if ( IFMT_SIMGEN_DUMP[ivar] == IFMT_SIMGEN_DUMP_COORD )
+	  {  pc += sprintf(pc," %.6f", r8 ); }
 	else if ( (r8 - ir8) == 0.0 ) // it's really an integer
-	  {  sprintf(cval," %lld", ir8 ); }
+	  {  pc += sprintf(pc," %lld", ir8 ); }
 	else
-	  { sprintf(cval," %.5le", r8 );  }
+	  { pc += sprintf(pc," %.5le", r8 );  }
       }
-      else if ( i4 != SIMGEN_DUMMY.IVAL4 )  
-	{  sprintf(cval," %d",  i4 ); }
+      else if ( i4 != SIMGEN_DUMMY.IVAL4 )
+	{  pc += sprintf(pc," %d",  i4 ); }
 
-      else if ( i8 != SIMGEN_DUMMY.IVAL8 )  
-	{  sprintf(cval," %lld",  i8 ); }
+      else if ( i8 != SIMGEN_DUMMY.IVAL8 )
+	{  pc += sprintf(pc," %lld",  i8 ); }
 
       else if ( strcmp(str,SIMGEN_DUMMY.CVAL) != 0 )
-	{  sprintf(cval," %s",  str ); }   // 7.30.2014
+	{  pc += sprintf(pc," %s",  str ); }   // 7.30.2014
 
       else {
 	sprintf(c1err,"no value for variable %d (%s)", ivar, pvar);
-	errmsg(SEV_FATAL, 0, fnam, c1err, "" ); 
+	errmsg(SEV_FATAL, 0, fnam, c1err, "" );
       }
 
-      strcat(SIMFILE_AUX->OUTLINE,cval);
-
     } // end of ivar loop
 
-    fprintf(fp, "%s\n", SIMFILE_AUX->OUTLINE );
-    fflush(fp);
+    *pc++ = '\n' ;
+    SIMGEN_DUMP_WRITER.LEN += (int)(pc - ptrRow);
+    NLINE_WRITTEN_SIMGEN_DUMP++ ;
 
   } // end of OPT_DUMP=2 if-block
 
 
   if ( OPT_DUMP == 3 ) {
+    // Aug 2026: wait for pending background flush, then write
+    // whatever is left in the active buffer.
+    if ( SIMGEN_DUMP_WRITER.THREAD_ACTIVE )
+      { pthread_join(SIMGEN_DUMP_WRITER.THREAD, NULL); }
+    if ( SIMGEN_DUMP_WRITER.LEN > 0 ) {
+      fwrite(SIMGEN_DUMP_WRITER.BUF[SIMGEN_DUMP_WRITER.IBUF],
+	     1, SIMGEN_DUMP_WRITER.LEN, SIMFILE_AUX->FP_DUMP );
+    }
+    free(SIMGEN_DUMP_WRITER.BUF[0]);
+    free(SIMGEN_DUMP_WRITER.BUF[1]);
     free(SIMFILE_AUX->OUTLINE);
     fclose(SIMFILE_AUX->FP_DUMP);
     printf("  %s\n", ptrFile );
@@ -11224,6 +11836,56 @@ void wr_SIMGEN_DUMP(int OPT_DUMP, SIMFILE_AUX_DEF *SIMFILE_AUX) {
 } // end of wr_SIMGEN_DUMP
 
 
+// ******************************************
+void *flush_SIMGEN_DUMP_BUFFER(void *arg) {
+
+  // Created Aug 2026
+  // Background-thread worker: write the filled dump buffer while
+  // the main thread keeps generating into the other buffer.
+
+  fwrite( (char*)arg, 1, SIMGEN_DUMP_WRITER.LEN_FLUSH,
+	  SIMGEN_DUMP_WRITER.FP );
+  return NULL ;
+
+} // end flush_SIMGEN_DUMP_BUFFER
+
+
+// ******************************************
+void swap_SIMGEN_DUMP_BUFFER(SIMFILE_AUX_DEF *SIMFILE_AUX) {
+
+  // Created Aug 2026
+  // Active dump buffer is full: wait for any previous background
+  // flush to finish, swap buffers, and launch a background flush
+  // of the full one.
+
+  int IBUF_FULL = SIMGEN_DUMP_WRITER.IBUF ;
+  char fnam[] = "swap_SIMGEN_DUMP_BUFFER" ;
+
+  // ----------- BEGIN -----------
+
+  if ( SIMGEN_DUMP_WRITER.THREAD_ACTIVE )
+    { pthread_join(SIMGEN_DUMP_WRITER.THREAD, NULL); }
+
+  SIMGEN_DUMP_WRITER.LEN_FLUSH = SIMGEN_DUMP_WRITER.LEN ;
+  SIMGEN_DUMP_WRITER.IBUF      = 1 - IBUF_FULL ;
+  SIMGEN_DUMP_WRITER.LEN       = 0 ;
+
+  if ( pthread_create(&SIMGEN_DUMP_WRITER.THREAD, NULL,
+		      flush_SIMGEN_DUMP_BUFFER,
+		      (void*)SIMGEN_DUMP_WRITER.BUF[IBUF_FULL] ) == 0 )
+    { SIMGEN_DUMP_WRITER.THREAD_ACTIVE = true ; }
+  else {
+    // thread create failed; flush synchronously and carry on
+    SIMGEN_DUMP_WRITER.THREAD_ACTIVE = false ;
+    fwrite( SIMGEN_DUMP_WRITER.BUF[IBUF_FULL], 1,
+	    SIMGEN_DUMP_WRITER.LEN_FLUSH, SIMGEN_DUMP_WRITER.FP );
+  }
+
+  return ;
+
+} // end swap_SIMGEN_DUMP_BUFFER
+
+
 // ******************************************
 int MATCH_INDEX_SIMGEN_DUMP(char *varName ) {
 
@@ -11340,6 +12002,7 @@ void PREP_SIMGEN_DUMP(int OPT_DUMP) {
 
   NVAR_SIMGEN_DUMP = 0 ;
   NEVT_SIMGEN_DUMP = 0 ;
+  NLINE_WRITTEN_SIMGEN_DUMP = 0 ;
 
   SIMGEN_DUMMY.VAL4  = -987.0 ;
   SIMGEN_DUMMY.VAL8  = -987.0 ;
@@ -12842,14 +13505,29 @@ double genz_hubble ( double zmin, double zmax, RATEPAR_DEF *RATEPAR ) {
     }
 
     if ( FIRST ) {
-      printf("  Found Max dN/dz * wgt = %e at z = %8.3f \n", 
+      printf("  Found Max dN/dz * wgt = %e at z = %8.3f \n",
 	     RATEPAR->ZGENWGT_MAX, z_atmax); fflush(stdout);
     }
 
+    // Aug 2026: tabulate inverse-CDF so z-draws below are lookups
+    if ( !INPUTS.USE_SIMLIB_DISTANCE )
+      { init_zCDF_RATEPAR(zmin, zmax, RATEPAR); }
+
   }  // end of ZGENWGT_MAX if-block
 
 
   // =======================================
+  // Aug 2026: for physical and ZPOLY distributions, draw z from the
+  // pre-computed inverse-CDF table instead of rejection sampling;
+  // rejection remains only for the trivial flat cases below.
+
+  if ( !INPUTS.USE_SIMLIB_DISTANCE && RATEPAR->ZCDF_NZBIN > 0 ) {
+    wran1 = FlatRan1( 1 );
+    zran  = genz_zCDF(wran1, RATEPAR);
+    RATEPAR->ZGENMIN_STORE = zmin ;
+    RATEPAR->ZGENMAX_STORE = zmax ;
+    return(zran) ;
+  }
 
  PICKRAN:
 
@@ -12895,33 +13573,135 @@ double genz_hubble ( double zmin, double zmax, RATEPAR_DEF *RATEPAR ) {
 
 
 // *******************************************
-double genz_wgt(double z, RATEPAR_DEF *RATEPAR ) {
+void init_zCDF_RATEPAR(double zmin, double zmax, RATEPAR_DEF *RATEPAR ) {
+
+  // Created Aug 2026
+  // Tabulate normalized cumulative z-distribution for *RATEPAR
+  // between zmin and zmax so that genz_zCDF can return a random
+  // redshift with a table lookup + interpolation instead of
+  // rejection sampling (each rejection trial costs a dVdz and
+  // rate-model evaluation). Called from genz_hubble whenever the
+  // generation z-range changes.
+
+  int NZBIN  = 2000 ;
+  int ISPOLY = ( strcmp(RATEPAR->NAME,"ZPOLY") == 0 ) ;
+  int iz, MEMD = (NZBIN+1) * sizeof(double);
+  double dz, z, w, wlast, WSUM ;
+  char fnam[] = "init_zCDF_RATEPAR" ;
 
-  /*********
-   Created Dec 17, 2007 by R.Kessler
+  // ----------- BEGIN ------------
 
-   Compute weight factor on Hubble distribution.
-   Options are 
+  // malloc table on first use; later calls just overwrite.
+  if ( RATEPAR->ZCDF_NZBIN == 0 ) {
+    RATEPAR->ZCDF_Z_LIST   = (double*) malloc(MEMD);
+    RATEPAR->ZCDF_CDF_LIST = (double*) malloc(MEMD);
+  }
+  RATEPAR->ZCDF_NZBIN = NZBIN ;
 
-    - rate model
-    - z^zwgt
+  dz = ( zmax - zmin ) / (double)NZBIN ;
 
-   Feb 03, 2014: ZPOLY now has z^3 term.
+  // accumulate trapezoidal integral of dN/dz at each grid point
+  WSUM = wlast = 0.0 ;
+  for(iz=0; iz <= NZBIN; iz++ ) {
+    z = zmin + dz * (double)iz ;
 
-   Aug 30 2017: use global scale (DNDZ_ALLSCALE) for all models.
-                Needed for SIMSED since these models can be either
-                Ia or NON1A.
-   June 14 2019:
-     Apply DNDZ_SCALE[1] to SIMSED models in addition to NON1A models.
+    if ( ISPOLY ) {
+      w = eval_GENPOLY(z, &RATEPAR->MODEL_ZPOLY, fnam) ;
+    }
+    else {
+      w  = dVdz (z, &INPUTS.HzFUN_INFO);
+      w /= (1.0+z);          // time dilation factor
+      w *= genz_wgt(z,RATEPAR) ;
+    }
 
-  *******/
+    if ( w < 0.0 ) { w = 0.0 ; }
+    if ( iz > 0  ) { WSUM += 0.5*(w+wlast)*dz ; }
+    RATEPAR->ZCDF_Z_LIST[iz]   = z ;
+    RATEPAR->ZCDF_CDF_LIST[iz] = WSUM ;
+    wlast = w ;
+  }
 
-  double w, zexp, wpoly ;
-  char fnam[] = "genz_wgt" ;
+  if ( WSUM <= 0.0 ) {
+    print_preAbort_banner(fnam);
+    printf("\t RATE MODEL = '%s' \n", RATEPAR->NAME );
+    sprintf(c1err,"Integrated dN/dz*wgt = %le ?!?!?", WSUM);
+    sprintf(c2err,"zmin=%f zmax=%f", zmin, zmax);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
 
-  // ------ BEGIN ---------
+  // normalize CDF to 0-1; force exact endpoints so that
+  // quickBinSearch range check cannot fail from round-off.
+  for(iz=0; iz <= NZBIN; iz++ )
+    { RATEPAR->ZCDF_CDF_LIST[iz] /= WSUM ; }
+  RATEPAR->ZCDF_CDF_LIST[0]     = 0.0 ;
+  RATEPAR->ZCDF_CDF_LIST[NZBIN] = 1.0 ;
 
-  if ( RATEPAR->NMODEL_ZRANGE <= 0 ) { return(0.0); }
+  return ;
+
+} // end init_zCDF_RATEPAR
+
+
+// *******************************************
+double genz_zCDF(double ran, RATEPAR_DEF *RATEPAR ) {
+
+  // Created Aug 2026
+  // Return redshift for which the cumulative z-distribution
+  // equals 'ran' (0-1), using the lookup table prepared by
+  // init_zCDF_RATEPAR.
+
+  int    NZBIN = RATEPAR->ZCDF_NZBIN ;
+  int    iz ;
+  double c0, c1, z0, z1, frac ;
+  char fnam[] = "genz_zCDF" ;
+
+  // ----------- BEGIN ------------
+
+  iz = quickBinSearch(ran, NZBIN+1, RATEPAR->ZCDF_CDF_LIST, fnam);
+  if ( iz > NZBIN-1 ) { iz = NZBIN-1 ; }
+
+  c0 = RATEPAR->ZCDF_CDF_LIST[iz] ;
+  c1 = RATEPAR->ZCDF_CDF_LIST[iz+1] ;
+  z0 = RATEPAR->ZCDF_Z_LIST[iz] ;
+  z1 = RATEPAR->ZCDF_Z_LIST[iz+1] ;
+
+  if ( c1 > c0 )
+    { frac = ( ran - c0 ) / ( c1 - c0 ) ; }
+  else
+    { frac = 0.5 ; }  // flat CDF segment (zero rate)
+
+  return ( z0 + frac*(z1-z0) ) ;
+
+} // end genz_zCDF
+
+
+// *******************************************
+double genz_wgt(double z, RATEPAR_DEF *RATEPAR ) {
+
+  /*********
+   Created Dec 17, 2007 by R.Kessler
+
+   Compute weight factor on Hubble distribution.
+   Options are 
+
+    - rate model
+    - z^zwgt
+
+   Feb 03, 2014: ZPOLY now has z^3 term.
+
+   Aug 30 2017: use global scale (DNDZ_ALLSCALE) for all models.
+                Needed for SIMSED since these models can be either
+                Ia or NON1A.
+   June 14 2019:
+     Apply DNDZ_SCALE[1] to SIMSED models in addition to NON1A models.
+
+  *******/
+
+  double w, zexp, wpoly ;
+  char fnam[] = "genz_wgt" ;
+
+  // ------ BEGIN ---------
+
+  if ( RATEPAR->NMODEL_ZRANGE <= 0 ) { return(0.0); }
 
   w = 1.0 ;
 
@@ -12984,7 +13764,11 @@ void  init_RATEPAR ( RATEPAR_DEF *RATEPAR ) {
 
 
   RATEPAR->ZGENWGT_MAX = 0.0;
-  RATEPAR->ZGENMIN_STORE =  RATEPAR->ZGENMAX_STORE = 0.0 ; 
+  RATEPAR->ZGENMIN_STORE =  RATEPAR->ZGENMAX_STORE = 0.0 ;
+
+  RATEPAR->ZCDF_NZBIN    = 0 ;    // Aug 2026: no inverse-CDF table yet
+  RATEPAR->ZCDF_Z_LIST   = NULL ;
+  RATEPAR->ZCDF_CDF_LIST = NULL ;
 
 } // end init_RATEPAR
 
@@ -13900,6 +14684,173 @@ void  SIMLIB_prep_fluxerrScale_LEGACY(void) {
 } // end SIMLIB_prep_fluxerrScale_LEGACY
 
 
+// *************************************
+void SIMLIB_buildIndex(void) {
+
+  // Created Aug 2026
+  // Build byte-offset index of every LIBID in the SIMLIB so that
+  // SIMLIB_findStart can fseek directly to the start LIBID instead
+  // of parsing every cadence before it. With a 100k-cadence SIMLIB
+  // the index scan is a single fgets pass (a few seconds), and later
+  // jobs skip even that by reading the <SIMLIB>.INDEX sidecar file;
+  // the sidecar is re-built if the SIMLIB size changes. If the
+  // sidecar cannot be written (e.g., read-only $SNDATA_ROOT/simlib)
+  // the in-memory index is still used.
+  //
+  // Do nothing for gzipped SIMLIB because fseek does not work on
+  // the pipe from snana_openTextFile.
+
+  static int BUILT = 0 ;
+  int  NLIBID=0, MEMTOT=0, ID, MEMI, MEMO ;
+  long long OFFSET, SIMLIB_SIZE ;
+  FILE *fp ;
+  struct stat statbuf ;
+  time_t t0 = time(NULL);
+  char indexFile[MXPATHLEN+20], LINE[200] ;
+  //  char fnam[] = "SIMLIB_buildIndex" ;
+
+  // ----------- BEGIN -----------
+
+  if ( BUILT ) { return ; }
+  BUILT = 1 ;   SIMLIB_INDEX.NLIBID = 0 ;
+
+  if ( INPUTS.SIMLIB_GZIPFLAG ) { return ; }
+
+  if ( stat(INPUTS.SIMLIB_OPENFILE, &statbuf) != 0 ) { return ; }
+  SIMLIB_SIZE = (long long)statbuf.st_size ;
+
+  sprintf(indexFile, "%s.INDEX", INPUTS.SIMLIB_OPENFILE );
+
+  // check for valid sidecar left by a previous job
+  if ( SIMLIB_readIndexFile(indexFile,SIMLIB_SIZE) ) { return ; }
+
+  // scan SIMLIB with private file pointer; fp_SIMLIB stays put
+  fp = fopen(INPUTS.SIMLIB_OPENFILE, "rt");
+  if ( fp == NULL ) { return ; }
+
+  OFFSET = (long long)ftell(fp);
+  while ( fgets(LINE, 200, fp) != NULL ) {
+
+    if ( strncmp(LINE,"LIBID:",6) == 0  &&
+	 sscanf(&LINE[6], "%d", &ID) == 1 ) {
+
+      if ( NLIBID >= MEMTOT ) {
+	MEMTOT += MALLOCSIZE_SIMLIB_INDEX ;
+	MEMI    = MEMTOT * sizeof(int);
+	MEMO    = MEMTOT * sizeof(long long);
+	SIMLIB_INDEX.LIBID  = (int      *)realloc(SIMLIB_INDEX.LIBID, MEMI);
+	SIMLIB_INDEX.OFFSET = (long long*)realloc(SIMLIB_INDEX.OFFSET,MEMO);
+      }
+      SIMLIB_INDEX.LIBID[NLIBID]  = ID ;
+      SIMLIB_INDEX.OFFSET[NLIBID] = OFFSET ;
+      NLIBID++ ;
+    }
+
+    OFFSET = (long long)ftell(fp);
+  }
+  fclose(fp);
+
+  SIMLIB_INDEX.NLIBID = NLIBID ;
+
+  printf("\t Built SIMLIB index for %d LIBIDs (%d seconds)\n",
+	 NLIBID, (int)(time(NULL)-t0) );  fflush(stdout);
+
+  if ( NLIBID > 0 ) { SIMLIB_writeIndexFile(indexFile,SIMLIB_SIZE); }
+
+  return ;
+
+} // end SIMLIB_buildIndex
+
+
+// *************************************
+int SIMLIB_readIndexFile(char *indexFile, long long SIMLIB_SIZE) {
+
+  // Created Aug 2026
+  // Read binary SIMLIB index from *indexFile into SIMLIB_INDEX.
+  // Returns 1 on success; returns 0 (and leaves SIMLIB_INDEX empty)
+  // if there is no sidecar, or if the magic/version/size key does
+  // not match the current SIMLIB --> caller re-builds the index.
+
+  FILE *fp ;
+  int  MAGIC=0, VERSION=0, NLIBID=0, MEMI, MEMO ;
+  long long TEXTSIZE = 0 ;
+  //  char fnam[] = "SIMLIB_readIndexFile" ;
+
+  // ----------- BEGIN -----------
+
+  fp = fopen(indexFile, "rb");
+  if ( fp == NULL ) { return(0); }
+
+  fread(&MAGIC,    sizeof(int),       1, fp);
+  fread(&VERSION,  sizeof(int),       1, fp);
+  fread(&TEXTSIZE, sizeof(long long), 1, fp);
+  fread(&NLIBID,   sizeof(int),       1, fp);
+
+  if ( MAGIC    != MAGIC_SIMLIB_INDEX    ||
+       VERSION  != VERSION_SIMLIB_INDEX  ||
+       TEXTSIZE != SIMLIB_SIZE           ||
+       NLIBID   <= 0 ) {
+    fclose(fp);  return(0);    // stale or foreign file; re-build
+  }
+
+  MEMI = NLIBID * sizeof(int);
+  MEMO = NLIBID * sizeof(long long);
+  SIMLIB_INDEX.LIBID  = (int      *)realloc(SIMLIB_INDEX.LIBID,  MEMI);
+  SIMLIB_INDEX.OFFSET = (long long*)realloc(SIMLIB_INDEX.OFFSET, MEMO);
+
+  if ( fread(SIMLIB_INDEX.LIBID,  sizeof(int),      NLIBID,fp) != NLIBID ||
+       fread(SIMLIB_INDEX.OFFSET, sizeof(long long),NLIBID,fp) != NLIBID ) {
+    fclose(fp);  return(0);    // truncated; re-build
+  }
+
+  fclose(fp);
+  SIMLIB_INDEX.NLIBID = NLIBID ;
+
+  printf("\t Read SIMLIB index for %d LIBIDs from \n\t   %s\n",
+	 NLIBID, indexFile );  fflush(stdout);
+
+  return(1);
+
+} // end SIMLIB_readIndexFile
+
+
+// *************************************
+void SIMLIB_writeIndexFile(char *indexFile, long long SIMLIB_SIZE) {
+
+  // Created Aug 2026
+  // Write SIMLIB_INDEX to binary *indexFile so later jobs skip the
+  // index-building scan. Write to temp file and rename so that
+  // parallel jobs never see a partial index. Failure to write
+  // (e.g., read-only simlib area) is not an error.
+
+  FILE *fp ;
+  int  MAGIC   = MAGIC_SIMLIB_INDEX ;
+  int  VERSION = VERSION_SIMLIB_INDEX ;
+  int  NLIBID  = SIMLIB_INDEX.NLIBID ;
+  char tmpFile[MXPATHLEN+40] ;
+  //  char fnam[] = "SIMLIB_writeIndexFile" ;
+
+  // ----------- BEGIN -----------
+
+  sprintf(tmpFile, "%s_tmp%d", indexFile, getpid() );
+
+  fp = fopen(tmpFile, "wb");
+  if ( fp == NULL ) { return ; }
+
+  fwrite(&MAGIC,       sizeof(int),       1, fp);
+  fwrite(&VERSION,     sizeof(int),       1, fp);
+  fwrite(&SIMLIB_SIZE, sizeof(long long), 1, fp);
+  fwrite(&NLIBID,      sizeof(int),       1, fp);
+  fwrite(SIMLIB_INDEX.LIBID,  sizeof(int),       NLIBID, fp);
+  fwrite(SIMLIB_INDEX.OFFSET, sizeof(long long), NLIBID, fp);
+  fclose(fp);
+
+  rename(tmpFile, indexFile);
+
+  return ;
+
+} // end SIMLIB_writeIndexFile
+
 
 // *************************************
 void SIMLIB_findStart(void) {
@@ -14014,16 +14965,34 @@ void SIMLIB_findStart(void) {
   MXREPEAT = INPUTS.SIMLIB_MXREPEAT ; INPUTS.SIMLIB_MXREPEAT = 1 ;
   fflush(stdout);
 
-  
-  // skip fixed number of LIBIDs
+  // Aug 2026: build LIBID byte-offset index (or read cached sidecar)
+  // so that both start options below fseek instead of scanning.
+  SIMLIB_buildIndex();
+
+  // skip fixed number of LIBIDs; with index, jump straight to
+  // the line after the NSKIP'th END_LIBID.
+  if ( NSKIP_LIBID > 0 && NSKIP_LIBID < SIMLIB_INDEX.NLIBID ) {
+    fseek(fp_SIMLIB, (long)SIMLIB_INDEX.OFFSET[NSKIP_LIBID], SEEK_SET);
+    NREAD = NSKIP_LIBID ;
+  }
   while ( NREAD < NSKIP_LIBID ) {
     fgets(LINE, 40, fp_SIMLIB) ;
     if ( strstr(LINE,"END_LIBID:") != NULL ) { NREAD++; }
   }
-  
+
+  // with index, fseek to first LIBID >= IDSEEK (in file order)
+  // so that the scan loop below parses only that one cadence.
+  if ( IDSEEK > 0 && SIMLIB_INDEX.NLIBID > 0 ) {
+    for ( NTMP=0; NTMP < SIMLIB_INDEX.NLIBID; NTMP++ ) {
+      if ( SIMLIB_INDEX.LIBID[NTMP] >= IDSEEK ) {
+	fseek(fp_SIMLIB, (long)SIMLIB_INDEX.OFFSET[NTMP], SEEK_SET);
+	break ;
+      }
+    }
+  }
 
   // search for specific LIBID
-  while ( IDSEEK > SIMLIB_HEADER.LIBID ) {   
+  while ( IDSEEK > SIMLIB_HEADER.LIBID ) {
     SIMLIB_READ_DRIVER();
     if ( SIMLIB_HEADER.NWRAP > 0 ) {
       sprintf(c1err,"Wrapped around SIMLIB without finding start.");
@@ -14245,6 +15214,36 @@ int IFIELD_OVP_SIMLIB(int OPT, char *FIELD) {
 } // end of IFIELD_OVP_SIMLIB
 
 
+// *******************************************
+void intern_IFIELD_OVP_SIMLIB(int NOBS_RAW) {
+
+  // Created Aug 2026
+  // Fill SIMLIB_OBS_RAW.IFIELD_OVP for each raw obs so that the
+  // per-epoch code (SIMLIB_prepCadence, gen_fluxNoise_apply) does
+  // array lookups instead of strcmp scans over the template-field
+  // list. Called once per cadence after the full LIBID is read;
+  // consecutive obs usually share the same field, so the previous
+  // name/index pair is memoized and most obs cost one strcmp here.
+
+  int  obs, IFIELD = -9 ;
+  char *FIELD, *FIELD_LAST = NULL ;
+  //  char fnam[] = "intern_IFIELD_OVP_SIMLIB" ;
+
+  // ---------------- BEGIN ------------
+
+  for ( obs = 0; obs < NOBS_RAW; obs++ ) {
+    FIELD = SIMLIB_OBS_RAW.FIELDNAME[obs] ;
+    if ( FIELD_LAST == NULL || strcmp(FIELD,FIELD_LAST) != 0 )
+      { IFIELD = IFIELD_OVP_SIMLIB(0,FIELD); }
+    SIMLIB_OBS_RAW.IFIELD_OVP[obs] = IFIELD ;
+    FIELD_LAST = FIELD ;
+  }
+
+  return ;
+
+} // end of intern_IFIELD_OVP_SIMLIB
+
+
 
 // ************************************
 double get_SIMLIB_fluxerrScale_LEGACY(int ifiltobs, double SNR) {
@@ -15136,7 +16135,12 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
   // Jan 23 2020: check for FUDGE_ZPTERR
   // Feb 22 2020: fetch SCALE_SKYSIG_T for template noise scale.
   // Dec 08 2020: increase max PSF limit fro 9.9 to 20 (for LSST)
-  // Feb 28 2021: check PSF_UNIT for NEA 
+  // Feb 28 2021: check PSF_UNIT for NEA
+  // Aug 2026: compute MJD keep-window once per event, and for a
+  //   repeated cadence re-use the accepted-obs list from the
+  //   previous event (see SIMLIB_CADENCE_REUSE).
+  //   Also hoist per-filter fudge scales out of the epoch loop and
+  //   apply them in batch passes after the loop (vectorizable).
 
   int NOBS_RAW    = SIMLIB_HEADER.NOBS ;
   int NEW_CADENCE = (REPEAT_CADENCE == 0 ) ;
@@ -15235,27 +16239,71 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
 
   } // end NEW_CADENCE 
 
-  // - - - - - - - - - - - - - - - - - - - 
+  // - - - - - - - - - - - - - - - - - - -
   // chop MJD range into seasons to allow user options
   store_SIMLIB_SEASONS();
 
   // - - - - - - -
   int isort, ifilt, IFILT_OBS, NEXPOSE, KEEP, NEP, NEP_NEWMJD ;
   int  IFLAG_SYNFILT, IFLAG_TEMPLATE, IFIELD, APP ;
+  int  iloop, NLOOP, USE_REUSE ;
+  double MJDrange[2] ;
   double MJD, CCDGAIN, RDNOISE, SKYSIG, ZPT[2], MAG ;
   double SKYSIG_T, RDNOISE_T, ZPT_T ;
   double SHIFT_ZPT, SCALE_SKYSIG, SCALE_SKYSIG_T, SCALE_RDNOISE, SCALE_PSF ;
   double MJD_DIF, MJD_LAST_KEEP, DT, DUMMY_STORE[3] ;
-  char   *TEL, *FIELD, cfilt[2];
+  char   *TEL, *FIELD ;
 
   // init stuff before loop over MJDs
-  NEP=NEP_NEWMJD=0;  MJD_LAST_KEEP=-9.0;  
+  NEP=NEP_NEWMJD=0;  MJD_LAST_KEEP=-9.0;
+
+  // Aug 2026: fudge scales depend only on filter, so evaluate them
+  // once per cadence here instead of once per epoch in the loop.
+  double SHIFT_ZPT_FILT[MXFILTINDX],    SCALE_SKYSIG_FILT[MXFILTINDX];
+  double SCALE_SKYSIG_T_FILT[MXFILTINDX], SCALE_RDNOISE_FILT[MXFILTINDX];
+  int ifilt_obs_tmp ;
+  for(ifilt_obs_tmp=0; ifilt_obs_tmp < MXFILTINDX; ifilt_obs_tmp++ ) {
+    get_SIMLIB_SCALES(ifilt_obs_tmp,
+		      &SHIFT_ZPT_FILT[ifilt_obs_tmp],
+		      &SCALE_SKYSIG_FILT[ifilt_obs_tmp],
+		      &SCALE_SKYSIG_T_FILT[ifilt_obs_tmp],
+		      &SCALE_RDNOISE_FILT[ifilt_obs_tmp] );
+  }
+  SCALE_PSF = INPUTS.FUDGESCALE_PSF ;
+
+  // MJD keep-window is constant per event; compute it once here
+  // instead of per-obs inside keep_SIMLIB_OBS (Aug 2026)
+  set_SIMLIB_MJDrange(REPEAT_CADENCE, MJDrange);
+
+  // For a repeated cadence with the same keep-window, walk only
+  // the obs accepted for the previous event and skip per-obs cuts.
+  // See SIMLIB_CADENCE_REUSE definition for spectrograph exception.
+  USE_REUSE =
+    ( REPEAT_CADENCE  &&  SIMLIB_CADENCE_REUSE.VALID         &&
+      SIMLIB_CADENCE_REUSE.LIBID       == SIMLIB_HEADER.LIBID &&
+      SIMLIB_CADENCE_REUSE.MJDRANGE[0] == MJDrange[0]         &&
+      SIMLIB_CADENCE_REUSE.MJDRANGE[1] == MJDrange[1]         &&
+      SIMLIB_OBS_RAW.NOBS_SPECTROGRAPH == 0  &&  !SPECTROGRAPH_USEFLAG );
+
+  if ( USE_REUSE )
+    { NLOOP = SIMLIB_CADENCE_REUSE.NKEEP ; }
+  else
+    { NLOOP = NOBS_RAW ;  SIMLIB_CADENCE_REUSE.VALID = 0 ;
+      SIMLIB_CADENCE_REUSE.NKEEP = 0 ;
+      // intern field names -> indices once per cadence (Aug 2026)
+      intern_IFIELD_OVP_SIMLIB(NOBS_RAW);
+    }
 
   // transfer OBS_RAW to OBS_GEN; latter has cuts and is sorted by MJD
 
-  for ( isort = 0; isort < NOBS_RAW; isort++ ) {
+  for ( iloop = 0; iloop < NLOOP; iloop++ ) {
 
-    OBSRAW   = SIMLIB_LIST_forSORT.INDEX_SORT[isort]; 
+    if ( USE_REUSE )
+      { isort = SIMLIB_CADENCE_REUSE.ISORT_KEEP[iloop] ; }
+    else
+      { isort = iloop ; }
+
+    OBSRAW   = SIMLIB_LIST_forSORT.INDEX_SORT[isort];
     OPTLINE  = SIMLIB_OBS_RAW.OPTLINE[OBSRAW] ;
 
     if ( OPTLINE < 0 ) { continue; }
@@ -15300,15 +16348,17 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
     if ( MAG != MAG_ZEROFLUX ) 
       { if ( MAG < 5.0 || MAG > 50 ) { MAG = MAG_UNDEFINED ; } }
     if ( MAG < MAG_ZEROFLUX    ) { SIMLIB_HEADER.NOBS_SIM_MAGOBS++ ; }
-    sprintf(cfilt,  "%c", FILTERSTRING[IFILT_OBS] ) ;
 
     ifilt     = GENLC.IFILTINVMAP_SIMLIB[IFILT_OBS] ;
     if ( ifilt < 0 || ifilt >= GENLC.NFILTDEF_SIMLIB ) 
       {  ABORT_SIMLIB_FILTER(isort);  }
     //      {  ABORT_SIMLIB_FILTER(OPTLINE,MJD,cfilt);  }
 
-    // check if this MJD is kept.
-    KEEP = keep_SIMLIB_OBS(isort,REPEAT_CADENCE);
+    // check if this MJD is kept (reused list was already cut)
+    if ( USE_REUSE )
+      { KEEP = 1 ; }
+    else
+      { KEEP = keep_SIMLIB_OBS(isort,REPEAT_CADENCE,MJDrange); }
 
     if ( GENLC.SIMLIB_ID < -99 ) {
       printf(" xxx isort=%3d OBSRAW=%3d  IFILT_OBS=%2d(%s) "
@@ -15319,13 +16369,20 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
 
     if ( KEEP == 0 ) { continue ; }
 
+    // record accepted obs for the next repeat of this cadence
+    if ( !USE_REUSE ) {
+      SIMLIB_CADENCE_REUSE.ISORT_KEEP[SIMLIB_CADENCE_REUSE.NKEEP] = isort ;
+      SIMLIB_CADENCE_REUSE.NKEEP++ ;
+    }
+
     // mark this filter as 'used'
     GENLC.SIMLIB_USEFILT_ENTRY[IFILT_OBS] = 1;
 
-    // get optional fudge scales
-    get_SIMLIB_SCALES(IFILT_OBS, &SHIFT_ZPT, &SCALE_SKYSIG, &SCALE_SKYSIG_T, 
-		      &SCALE_RDNOISE);
-    SCALE_PSF = INPUTS.FUDGESCALE_PSF ;
+    // fetch fudge scales hoisted above (Aug 2026)
+    SHIFT_ZPT      = SHIFT_ZPT_FILT[IFILT_OBS] ;
+    SCALE_SKYSIG   = SCALE_SKYSIG_FILT[IFILT_OBS] ;
+    SCALE_SKYSIG_T = SCALE_SKYSIG_T_FILT[IFILT_OBS] ;
+    SCALE_RDNOISE  = SCALE_RDNOISE_FILT[IFILT_OBS] ;
 
     NEP++; 
     GENLC.NEPOCH = NEP ;
@@ -15352,6 +16409,7 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
     GENLC.genmag_obs[NEP]   = MAG ;
     GENLC.MJD[NEP]           = MJD ;
     sprintf( GENLC.FIELDNAME[NEP], "%s", FIELD );
+    GENLC.IFIELD_OVP[NEP] = SIMLIB_OBS_RAW.IFIELD_OVP[OBSRAW] ; // Aug 2026
     sprintf( GENLC.TELESCOPE[NEP], "%s", TEL   );
 
     // store SIMLIB_GEN quanties vs. NEP that include fudges                  
@@ -15359,13 +16417,15 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
     SIMLIB_OBS_GEN.IFILT_OBS[NEP]   = IFILT_OBS ;
     SIMLIB_OBS_GEN.PIXSIZE[NEP]     = PIXSIZE ;
     SIMLIB_OBS_GEN.CCDGAIN[NEP]     = CCDGAIN ;
-    SIMLIB_OBS_GEN.READNOISE[NEP]   = RDNOISE * SCALE_RDNOISE ;
-    SIMLIB_OBS_GEN.SKYSIG[NEP]      = SKYSIG * SCALE_SKYSIG ;
-    SIMLIB_OBS_GEN.PSFSIG1[NEP]     = PSF[0] * SCALE_PSF ;
-    SIMLIB_OBS_GEN.PSFSIG2[NEP]     = PSF[1] * SCALE_PSF ;
-    SIMLIB_OBS_GEN.PSFRATIO[NEP]    = PSF[2] ;    // ratio         
-    SIMLIB_OBS_GEN.NEA[NEP]         = NEA * (SCALE_PSF*SCALE_PSF); // Feb 2021
-    SIMLIB_OBS_GEN.ZPTADU[NEP]      = ZPT[0] + SHIFT_ZPT ;
+    // store raw noise/ZPT values here; filter-dependent fudges are
+    // applied in batch passes after this loop (Aug 2026)
+    SIMLIB_OBS_GEN.READNOISE[NEP]   = RDNOISE ;
+    SIMLIB_OBS_GEN.SKYSIG[NEP]      = SKYSIG ;
+    SIMLIB_OBS_GEN.PSFSIG1[NEP]     = PSF[0] ;
+    SIMLIB_OBS_GEN.PSFSIG2[NEP]     = PSF[1] ;
+    SIMLIB_OBS_GEN.PSFRATIO[NEP]    = PSF[2] ;    // ratio
+    SIMLIB_OBS_GEN.NEA[NEP]         = NEA ;       // Feb 2021
+    SIMLIB_OBS_GEN.ZPTADU[NEP]      = ZPT[0] ;
     SIMLIB_OBS_GEN.ZPTERR[NEP]      = ZPT[1] ;
     SIMLIB_OBS_GEN.MAG[NEP]         = MAG ;
     SIMLIB_OBS_GEN.NEXPOSE[NEP]     = NEXPOSE ;
@@ -15394,10 +16454,18 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
     // check template noise for normal filters                                
     if ( (IFLAG_TEMPLATE & 1)>0 && IFLAG_SYNFILT == 0 ) {
 
-      IFIELD = IFIELD_OVP_SIMLIB(1,FIELD);
+      // Aug 2026: use field index interned at prep start (no strcmp);
+      // if no named-field match, fall back to global template
+      // when the global ZPT is set (old OPT=1 logic).
+      IFIELD = SIMLIB_OBS_RAW.IFIELD_OVP[OBSRAW] ;
+      if ( IFIELD < 0 ) {
+	int ifilt_tmp = GENLC.IFILTMAP_SIMLIB[0] ;
+	if ( SIMLIB_TEMPLATE.ZPT[0][ifilt_tmp] > 10.0 ) { IFIELD = 0; }
+      }
       if ( IFIELD < 0 || IFIELD >= MXFIELD_OVP ) {
 	sprintf(c1err,"Invalid IFIELD=%d for template FIELD=%s",IFIELD,FIELD);
-	sprintf(c2err, "Check LIBID=%d  %s-band", GENLC.SIMLIB_ID,cfilt );
+	sprintf(c2err, "Check LIBID=%d  %c-band",
+		GENLC.SIMLIB_ID, FILTERSTRING[IFILT_OBS] );
 	errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ;
       }  
 
@@ -15425,8 +16493,39 @@ void  SIMLIB_prepCadence(int REPEAT_CADENCE) {
       { GENLC.IEPOCH_NEARPEAK = NEP ; GENLC.DTPEAK_MIN   = DT ;  }
 
 
-  } // end isort loop (REFACTOR)
+  } // end iloop over sorted MJDs (REFACTOR)
+
 
+  // Aug 2026: apply filter-dependent fudges in batch passes over the
+  // contiguous OBS_GEN arrays; one simple pass per transformation so
+  // the compiler can vectorize, instead of per-epoch branching above.
+  int ep, ifo;
+  double SCALE_PSF2 = SCALE_PSF * SCALE_PSF ;
+  if ( SCALE_PSF != 1.0 ) {
+    for(ep=1; ep <= NEP; ep++ ) { SIMLIB_OBS_GEN.PSFSIG1[ep] *= SCALE_PSF ; }
+    for(ep=1; ep <= NEP; ep++ ) { SIMLIB_OBS_GEN.PSFSIG2[ep] *= SCALE_PSF ; }
+    for(ep=1; ep <= NEP; ep++ ) { SIMLIB_OBS_GEN.NEA[ep]    *= SCALE_PSF2 ; }
+  }
+  for(ep=1; ep <= NEP; ep++ ) {
+    ifo = SIMLIB_OBS_GEN.IFILT_OBS[ep] ;
+    SIMLIB_OBS_GEN.READNOISE[ep] *= SCALE_RDNOISE_FILT[ifo] ;
+  }
+  for(ep=1; ep <= NEP; ep++ ) {
+    ifo = SIMLIB_OBS_GEN.IFILT_OBS[ep] ;
+    SIMLIB_OBS_GEN.SKYSIG[ep] *= SCALE_SKYSIG_FILT[ifo] ;
+  }
+  for(ep=1; ep <= NEP; ep++ ) {
+    ifo = SIMLIB_OBS_GEN.IFILT_OBS[ep] ;
+    SIMLIB_OBS_GEN.ZPTADU[ep] += SHIFT_ZPT_FILT[ifo] ;
+  }
+
+  // mark accepted-obs list as valid for the next repeat
+  if ( !USE_REUSE ) {
+    SIMLIB_CADENCE_REUSE.VALID       = 1 ;
+    SIMLIB_CADENCE_REUSE.LIBID       = SIMLIB_HEADER.LIBID ;
+    SIMLIB_CADENCE_REUSE.MJDRANGE[0] = MJDrange[0] ;
+    SIMLIB_CADENCE_REUSE.MJDRANGE[1] = MJDrange[1] ;
+  }
 
   return ;
 
@@ -15609,9 +16708,6 @@ void get_SPECTROGRAPH_ZPTPSFSKY(int OBSRAW, int ifilt,
   //
   // Mar 11 2018: fix PIXSIZE to depend on OBSRAW
 
-  // get min/max wavelentgh of syn filter
-  double LAMMIN  = INPUTS_SPECTRO.SYN_FILTERLIST_LAMMIN[ifilt] ;
-  double LAMMAX  = INPUTS_SPECTRO.SYN_FILTERLIST_LAMMAX[ifilt] ;
   double MJD     = SIMLIB_OBS_RAW.MJD[OBSRAW]; // for debug
   double PIXSIZE = SIMLIB_OBS_RAW.PIXSIZE[OBSRAW]; 
   int ifilt_obs  = GENLC.IFILTDEF_SPECTROGRAPH[ifilt] ;
@@ -15620,16 +16716,23 @@ void get_SPECTROGRAPH_ZPTPSFSKY(int OBSRAW, int ifilt,
   int UNIT_IS_ARCSEC = 
     ( strcmp(SIMLIB_GLOBAL_HEADER.SKYSIG_UNIT,SIMLIB_SKYSIG_SQASEC )==0) ;
 
+  // Aug 2026: use precomputed spectro-bin range overlapping this
+  // syn filter (see prep_SYN_FILTERLIST_LAMBIN), and compute the
+  // Texpose-interpolation weights once outside the lambda loop
+  // using the same arithmetic as interp_1DFUN.
+  int ILAM_MIN = INPUTS_SPECTRO.SYN_FILTERLIST_ILAM_MIN[ifilt] ;
+  int ILAM_MAX = INPUTS_SPECTRO.SYN_FILTERLIST_ILAM_MAX[ifilt] ;
+
   int l,  NBLAM ;
-  int OPT_INTERP = 1; // linear
+  int IBT_S, IBT_T ;
   int LDMP = 0 ;
-  double LCEN, LBINMIN, LBINMAX, ZSUM, ZPLAM ;
+  double LCEN, ZSUM, ZPLAM ;
   double SQSKY_S, SQSKY_T, SQSUM_S, SQSUM_T ;
+  double FRAC_S, FRAC_T, T0, T1, *ptrFUN ;
   double PSFSIG_PIXEL, PSFSIG_ARCSEC, PSF_ARCSECFWHM, NEA ;
 
   char fnam[] = "get_SPECTROGRAPH_ZPTPSFSKY" ;
   char STR_ZPLAM[]   = "get_ZPTPSFSKY(ZPLAM)";
-  char STR_SQSIG_S[] = "get_ZPTPSFSKY(SQSIG_S)";
   char STR_SQSIG_T[] = "get_ZPTPSFSKY(SQSIG_T)";
 
   // ---------------- BEGIN -------------
@@ -15641,47 +16744,65 @@ void get_SPECTROGRAPH_ZPTPSFSKY(int OBSRAW, int ifilt,
 
   if ( GENLC.IFILTINVMAP_OBS[ifilt_obs] < 0 ) { return ; }
 
+  // locate Texpose bin and interp fraction, once per call
+  IBT_S = IBT_T = 0 ;  FRAC_S = FRAC_T = 0.0 ;
+  if ( NBT > 1 ) {
+    IBT_S  = quickBinSearch(TEXPOSE_S, NBT,
+			    INPUTS_SPECTRO.TEXPOSE_LIST, STR_ZPLAM);
+    T0     = INPUTS_SPECTRO.TEXPOSE_LIST[IBT_S] ;
+    T1     = INPUTS_SPECTRO.TEXPOSE_LIST[IBT_S+1] ;
+    FRAC_S = (TEXPOSE_S - T0)/(T1-T0) ;
 
-  ZSUM = SQSUM_S = SQSUM_T = 0.0 ;   NBLAM=0 ;
-  for(l=0; l < INPUTS_SPECTRO.NBIN_LAM; l++ ) {
+    if ( IFLAG_TEMPLATE ) {
+      IBT_T  = quickBinSearch(TEXPOSE_T, NBT,
+			      INPUTS_SPECTRO.TEXPOSE_LIST, STR_SQSIG_T);
+      T0     = INPUTS_SPECTRO.TEXPOSE_LIST[IBT_T] ;
+      T1     = INPUTS_SPECTRO.TEXPOSE_LIST[IBT_T+1] ;
+      FRAC_T = (TEXPOSE_T - T0)/(T1-T0) ;
+    }
+  }
 
-    LBINMIN = INPUTS_SPECTRO.LAMMIN_LIST[l] ;  // of spectral bin
-    LBINMAX = INPUTS_SPECTRO.LAMMAX_LIST[l] ;    
-    LCEN    = 0.5 * (LBINMIN + LBINMAX) ; // bin center
+  ZSUM = SQSUM_S = SQSUM_T = 0.0 ;   NBLAM=0 ;
 
-    // keep bin if its center is withing the user-defined
-    // wavelength range in the kcor-input file.
-    if ( LCEN < LAMMIN ) { continue ; }
-    if ( LCEN > LAMMAX ) { continue ; }
+  if ( ILAM_MIN >= 0 ) {
+  for(l=ILAM_MIN; l <= ILAM_MAX; l++ ) {
 
     // interpolate ZPLAM(pe) for this exposure time, at this lambda
-    ZPLAM = interp_1DFUN(OPT_INTERP, TEXPOSE_S, NBT,
-			 INPUTS_SPECTRO.TEXPOSE_LIST, 
-			 INPUTS_SPECTRO.ZP[l], STR_ZPLAM);
+    ptrFUN = INPUTS_SPECTRO.ZP[l] ;
+    if ( NBT == 1 )
+      { ZPLAM = ptrFUN[0] ; }
+    else
+      { ZPLAM = ptrFUN[IBT_S] + FRAC_S*(ptrFUN[IBT_S+1]-ptrFUN[IBT_S]); }
     ZSUM    += pow(TEN, 0.4*ZPLAM) ;
 
     // interpolate SQSIGSKY
-    SQSKY_S = interp_1DFUN(OPT_INTERP, TEXPOSE_S, NBT,
-			   INPUTS_SPECTRO.TEXPOSE_LIST, 
-			   INPUTS_SPECTRO.SQSIGSKY[l], STR_SQSIG_S);
-    SQSUM_S += SQSKY_S ; 
+    ptrFUN = INPUTS_SPECTRO.SQSIGSKY[l] ;
+    if ( NBT == 1 )
+      { SQSKY_S = ptrFUN[0] ; }
+    else
+      { SQSKY_S = ptrFUN[IBT_S] + FRAC_S*(ptrFUN[IBT_S+1]-ptrFUN[IBT_S]); }
+    SQSUM_S += SQSKY_S ;
 
     if ( IFLAG_TEMPLATE ) {
-      SQSKY_T = interp_1DFUN(OPT_INTERP, TEXPOSE_T, NBT,
-			     INPUTS_SPECTRO.TEXPOSE_LIST, 
-			     INPUTS_SPECTRO.SQSIGSKY[l], STR_SQSIG_T);
-      SQSUM_T += SQSKY_T ; 
+      if ( NBT == 1 )
+	{ SQSKY_T = ptrFUN[0] ; }
+      else
+	{ SQSKY_T = ptrFUN[IBT_T] + FRAC_T*(ptrFUN[IBT_T+1]-ptrFUN[IBT_T]); }
+      SQSUM_T += SQSKY_T ;
     }
 
-    NBLAM++ ; 
+    NBLAM++ ;
 
-    if ( LDMP ==5 ) { 
+    if ( LDMP ==5 ) {
       double L0 = INPUTS.LAMMIN_OBS[ifilt_obs];
       double L1 = INPUTS.LAMMAX_OBS[ifilt_obs];
-      printf(" xxx LCEN=%.1f (%.1f:%.1f) ZPLAM=%.3f \n", 
+      LCEN = 0.5 * ( INPUTS_SPECTRO.LAMMIN_LIST[l] +
+		     INPUTS_SPECTRO.LAMMAX_LIST[l] ) ;
+      printf(" xxx LCEN=%.1f (%.1f:%.1f) ZPLAM=%.3f \n",
 	     LCEN, L0, L1, ZPLAM );
     }
   }  // end l loop over lambda bins
+  }  // end ILAM_MIN >= 0
 
 
   if ( ZSUM == 0.0 ) {
@@ -15740,7 +16861,7 @@ void get_SPECTROGRAPH_ZPTPSFSKY(int OBSRAW, int ifilt,
 
 
 // =================================================
-int keep_SIMLIB_OBS(int isort, int REPEAT) {
+int keep_SIMLIB_OBS(int isort, int REPEAT, double *MJDrange) {
 
   // Created Aug 2017
   // Return 1 of this raw-OBS is kept.
@@ -15749,22 +16870,26 @@ int keep_SIMLIB_OBS(int isort, int REPEAT) {
   // Inputs:
   //   OBS      = MJD-sort index; needed to get absolute OBS index
   //   REPEAT   = 1 if this cadence is repeated
+  //   MJDrange = MJD keep-window for this event
   //
   // Sep 24 2017: check field.
+  // Aug 2026: MJDrange is now a passed argument; it is constant per
+  //   event, so SIMLIB_prepCadence computes it once instead of
+  //   re-computing it here for every obs in the cadence.
 
-  int  KEEP=1, NOKEEP=0; 
+  int  KEEP=1, NOKEEP=0;
   int  ifilt, ifilt_obs, OBS ;
-  int  LTRACE= 0 ; 
-  double  MJD, MJDrange[2];
+  int  LTRACE= 0 ;
+  double  MJD ;
   char *FIELD ;
   //  char fnam[] = "keep_SIMLIB_OBS" ;
 
   // ------------ BEGIN --------------
 
-  
+
   if (LTRACE) {
     printf(" xxx ---------------------------- \n");
-    printf(" xxx 0 isort=%d REPEAT=%d \n",isort,REPEAT); 
+    printf(" xxx 0 isort=%d REPEAT=%d \n",isort,REPEAT);
   }
   OBS  = SIMLIB_LIST_forSORT.INDEX_SORT[isort] ; // absolute OBS_RAW index
 
@@ -15772,9 +16897,6 @@ int keep_SIMLIB_OBS(int isort, int REPEAT) {
   FIELD = SIMLIB_OBS_RAW.FIELDNAME[OBS] ;
   MJD   = SIMLIB_OBS_RAW.MJD[OBS] ;
 
-  // compute & store SEASON info; return MJDrange to keep SIMLIB entries
-  set_SIMLIB_MJDrange(REPEAT,MJDrange);
-
   if ( MJD < MJDrange[0] ) { return(NOKEEP); }
   if ( MJD > MJDrange[1] ) { return(NOKEEP); }
 
@@ -18468,7 +19590,6 @@ int gen_cutwin(void) {
     if ( Trest > INPUTS.CUTWIN_TRESTMAX[1] ) { continue ; }
 
     ifilt_obs = GENLC.IFILT_OBS[ep] ;
-    sprintf(cfilt, "%c", FILTERSTRING[ifilt_obs] );
 
     // keep track of the true/generated SNR
     trueSNR     = GENLC.trueSNR[ep] ;
@@ -18477,9 +19598,10 @@ int gen_cutwin(void) {
     }
 
     if ( LDMP ) {
-      printf(" xxx ep=%d   MJD(%s)= %f   Trest=%f  \n", 
-	     ep, cfilt, MJD, Trest );   
-      fflush(stdout); 
+      sprintf(cfilt, "%c", FILTERSTRING[ifilt_obs] );
+      printf(" xxx ep=%d   MJD(%s)= %f   Trest=%f  \n",
+	     ep, cfilt, MJD, Trest );
+      fflush(stdout);
     }
 
     // apply rest-frame lambda cut to all epochs 
@@ -18535,8 +19657,9 @@ int gen_cutwin(void) {
       { GENLC.NOBS_MJDDIF++ ; }
 
     // count time above SNRMIN
+    // Aug 2026: filter match via map set in prep_user_CUTWIN
     if ( SNR > INPUTS.CUTWIN_EPOCHS_SNRMIN &&
-	 strstr(INPUTS.CUTWIN_EPOCHS_FILTERS,cfilt)!=NULL  ) {
+	 INPUTS.CUTWIN_EPOCHS_LFILT[ifilt_obs] ) {
       if ( MJD_SNRMIN_FIRST < 0.01 ) { MJD_SNRMIN_FIRST = MJD; }
       MJD_SNRMIN_LAST = MJD ;
     }
@@ -18598,14 +19721,13 @@ int gen_cutwin(void) {
 
     for ( icut=1; icut <= INPUTS.NCUTWIN_SNRMAX; icut++ ) {
 
-      // get filter-range to test for this cut
-      NFCUT = PARSE_FILTLIST( INPUTS.CUTWIN_SNRMAX_FILTERS[icut], 
-			      IFILTOBS_LIST ); // <== returned
+      // filter-range for this cut pre-parsed in prep_user_CUTWIN
+      NFCUT = INPUTS.CUTWIN_SNRMAX_NFILTLIST[icut] ;
 
       NTMP = 0;
       for ( i=0; i < NFCUT; i++ ) {
 
-	ifilt_obs = IFILTOBS_LIST[i] ;
+	ifilt_obs = INPUTS.CUTWIN_SNRMAX_IFILTLIST[icut][i] ;
 
 	// abort if ifilt_obs is undefined
 	ifilt = GENLC.IFILTINVMAP_OBS[ifilt_obs]; 
@@ -18733,10 +19855,9 @@ int gen_cutwin(void) {
     for(icut=0; icut < INPUTS.NCUTWIN_SATURATE; icut++ ) {
       MINOBS = INPUTS.CUTWIN_SATURATE_NOBS[icut][0] ;
       MAXOBS = INPUTS.CUTWIN_SATURATE_NOBS[icut][1] ;
-      NFCUT = PARSE_FILTLIST( INPUTS.CUTWIN_SATURATE_FILTERS[icut], 
-			      IFILTOBS_LIST ); // <== returned   
+      NFCUT  = INPUTS.CUTWIN_SATURATE_NFILTLIST[icut] ; // Aug 2026
       for ( i=0; i < NFCUT; i++ ) {
-	ifilt_obs = IFILTOBS_LIST[i] ;
+	ifilt_obs = INPUTS.CUTWIN_SATURATE_IFILTLIST[icut][i] ;
 	NOBS   = GENLC.NOBS_SATURATE_FILTER[1][ifilt_obs];
 	if ( NOBS < MINOBS || NOBS > MAXOBS ) { IPASS=0; }
       }
@@ -18747,10 +19868,9 @@ int gen_cutwin(void) {
     for(icut=0; icut < INPUTS.NCUTWIN_NOSATURATE; icut++ ) {
       MINOBS = INPUTS.CUTWIN_NOSATURATE_NOBS[icut][0] ;
       MAXOBS = INPUTS.CUTWIN_NOSATURATE_NOBS[icut][1] ;
-      NFCUT = PARSE_FILTLIST( INPUTS.CUTWIN_NOSATURATE_FILTERS[icut], 
-			      IFILTOBS_LIST ); // <== returned      
+      NFCUT  = INPUTS.CUTWIN_NOSATURATE_NFILTLIST[icut] ; // Aug 2026
       for ( i=0; i < NFCUT; i++ ) {
-	ifilt_obs = IFILTOBS_LIST[i] ;
+	ifilt_obs = INPUTS.CUTWIN_NOSATURATE_IFILTLIST[icut][i] ;
 	NOBS_TOT  = GENLC.NOBS_FILTER[ifilt_obs] ;
 
 	// require enough NOBS_TOT in this band in case
@@ -18774,7 +19894,9 @@ int gen_cutwin(void) {
     if ( LDMP  ) {
       printf(" xxxxx CID=%d  CUTBIT_MASK = %d  (requires %d) \n",
 	     GENLC.CID, GENLC.CUTBIT_MASK, ALLBIT_CUTMASK );
-      for ( ifilt_obs  = IFILTOBS_LIST[0]; 
+      NFCUT = PARSE_FILTLIST( INPUTS.CUTWIN_SNRMAX_FILTERS[1],
+			      IFILTOBS_LIST ); // Aug 2026: LDMP only
+      for ( ifilt_obs  = IFILTOBS_LIST[0];
 	    ifilt_obs <= IFILTOBS_LIST[1]; ifilt_obs++ ) {
 	SNR = SNRMAX_FILT[1][ifilt_obs] ;
 	printf(" xxxx CID = %d, ifilt_obs = %d, SNRMAX(cut1) = %f \n", 
@@ -20578,6 +21700,10 @@ void init_genmodel(void) {
     INPUTS.NON1ASED.NGENTOT   = INPUTS.NGEN ;
     INPUTS.NON1ASED.CIDOFF    = INPUTS.CIDOFF ;
     INPUTS.NON1ASED.IFLAG_GEN = GENLC.IFLAG_GENSOURCE ;
+
+    // same bit-convention as SIMSED: bit0 of GENMODEL_MSKOPT enables
+    // binary cache of prepared templates (Aug 2026)
+    INPUTS.NON1ASED.OPT_BINARY = ( INPUTS.GENMODEL_MSKOPT & 1 ) ;
     GENLC.NON1ASED.IFLAG_GEN  = GENLC.IFLAG_GENSOURCE ;
     
     GENLC.NON1ASED.FRAC_PEC1A = INPUTS.RATEPAR_PEC1A.SEASON_FRAC ;
@@ -20652,12 +21778,71 @@ void init_genmodel(void) {
  
   prep_dustFlags();
 
+  // Aug 2026: precompute per-filter valid-z bounds for gen_filtmap
+  init_ZVALID_GENFILT();
 
   return ;
 
 }  // end of init_genmodel
 
 
+// *********************************
+void init_ZVALID_GENFILT(void) {
+
+  // Created Aug 2026
+  // Precompute, for each obs-filter, the redshift range passing the
+  // wavelength-overlap tests that gen_filtmap used to evaluate per
+  // event: the central-wavelength test against GENLC.RESTLAM_MODEL
+  // (all models), and the IFILTSTAT_SEDMODEL coverage tests
+  // (SALT2, SIMSED, NON1ASED). All tests are monotonic in z, so
+  // they invert to per-filter [ZMIN,ZMAX] bounds; gen_filtmap then
+  // does two compares per filter per event.
+
+  int DO_SEDMODEL =
+    ( INDEX_GENMODEL == MODEL_SALT2    ||
+      INDEX_GENMODEL == MODEL_SIMSED   ||
+      INDEX_GENMODEL == MODEL_NON1ASED  ) ;
+
+  int ifilt, ifilt_obs, jfilt ;
+  double LAMAVG, ZMIN, ZMAX, ztmp, mean, lammin, lammax ;
+  //  char fnam[] = "init_ZVALID_GENFILT" ;
+
+  // ------------- BEGIN ----------
+
+  for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
+    ifilt_obs = GENLC.IFILTMAP_OBS[ifilt];
+    LAMAVG    = (double)INPUTS.LAMAVG_OBS[ifilt_obs];
+
+    // central wavelength inside rest-frame model range
+    ZMIN = LAMAVG / GENLC.RESTLAM_MODEL[1] - 1.0 ;
+    ZMAX = LAMAVG / GENLC.RESTLAM_MODEL[0] - 1.0 ;
+
+    if ( DO_SEDMODEL ) {
+      jfilt  = IFILTMAP_SEDMODEL[ifilt_obs] ;
+      mean   = FILTER_SEDMODEL[jfilt].mean ;
+      lammin = FILTER_SEDMODEL[jfilt].lammin ;
+      lammax = FILTER_SEDMODEL[jfilt].lammax ;
+
+      ztmp = mean / SEDMODEL.RESTLAMMAX_FILTERCEN - 1.0 ;
+      if ( ztmp > ZMIN ) { ZMIN = ztmp ; }
+      ztmp = lammax / SEDMODEL.LAMMAX_ALL - 1.0 ;
+      if ( ztmp > ZMIN ) { ZMIN = ztmp ; }
+
+      ztmp = mean / SEDMODEL.RESTLAMMIN_FILTERCEN - 1.0 ;
+      if ( ztmp < ZMAX ) { ZMAX = ztmp ; }
+      ztmp = lammin / SEDMODEL.LAMMIN_ALL - 1.0 ;
+      if ( ztmp < ZMAX ) { ZMAX = ztmp ; }
+    }
+
+    ZVALID_GENFILT.ZMIN[ifilt_obs] = ZMIN ;
+    ZVALID_GENFILT.ZMAX[ifilt_obs] = ZMAX ;
+  }
+
+  return ;
+
+}  // end of init_ZVALID_GENFILT
+
+
 // *********************************
 void init_genSEDMODEL(void) {
 
@@ -21248,6 +22433,194 @@ int gen_TRIGGER_zHOST(void) {
 
 } // end gen_TRIGGER_zHOST
 
+// *********************************************
+void set_genmag_triage(void) {
+
+  // Created Aug 2026
+  // Implement sim-input GENMAG_TRIAGE_DMAG: flag epochs that are
+  // hopelessly below the SIMLIB detection limit so that genmodel
+  // can skip the full model-mag computation (e.g., SED integration)
+  // for those epochs.
+  //
+  // The brightest possible mag at any epoch is bounded by the peak
+  // mag, computed here with a cheap peak-epoch-only model call per
+  // band (same compress/restore trick as gen_TRIGGER_PEAKMAG_SPEC).
+  // An epoch is flagged only if this bound, minus safety margin
+  // MAGDIF_SAFETY_GENMAG_TRIAGE, is more than GENMAG_TRIAGE_DMAG
+  // mag fainter than the epoch's 5-sigma limiting mag computed from
+  // the SIMLIB conditions. Flagged epochs later get genmag set to
+  // MAG_ZEROFLUX (flux=0) in genmodel, so every epoch still gets
+  // noise, cuts and trigger logic; only the model evaluation is
+  // skipped. Note that for a flagged epoch the true flux is below
+  // ~1% of the measured noise, so setting flux=0 has no practical
+  // effect on the measurement.
+
+  float DMAG = INPUTS.GENMAG_TRIAGE_DMAG ;
+  int  NEP_PEAKONLY=0, iep, ifilt, ifilt_obs ;
+  int  MEMI, MEMD ;
+  double PEAKMAG, MAGOFF, M5SIG, MAGBRIGHT ;
+  double GAIN, ZPTADU, SKYSIG_ADU, PSFSIG1, PIXSIZE ;
+  double ZPT_pe, PSF, SKYSIG_pe, FSKY_pe, SKYMAG ;
+  double PEAKMAG_LIST[MXFILTINDX];
+
+  struct {
+    int NEPOCH, *IFILT_OBS, *ISPEAK;
+    double *MJD, *TOBS, *TREST ;
+  } GENLC_ORIG ;
+
+  //  char fnam[] = "set_genmag_triage" ;
+
+  // -------------- BEGIN ----------------
+
+  GENLC.GENMAG_TRIAGE_VALID = 0 ;
+  GENLC.NEP_GENMAG_TRIAGE   = 0 ;
+
+  if ( DMAG < 0.001 ) { return ; }
+
+  if ( GENLC.PEAKMAG_TRIGGER_FLAG ) { return ; } // peak-only pass
+
+  if ( GENFRAME_OPT != GENFRAME_OBS ) { return ; }
+
+  if ( GENLC.IFLAG_GENSOURCE == IFLAG_GENGRID ) { return ; }
+
+  if ( INPUTS.TGRIDSTEP_MODEL_INTERP > 0.001 ) { return ; }
+
+  // bail for models where there is nothing to gain, or where
+  // the peak mag is ill-defined (LCLIB; see gen_TRIGGER_PEAKMAG_SPEC)
+  if ( INDEX_GENMODEL == MODEL_SIMLIB ) { return ; }
+  if ( INDEX_GENMODEL == MODEL_LCLIB  ) { return ; }
+  if ( INDEX_GENMODEL == MODEL_FIXMAG ) { return ; }
+
+  // ---------------------------------------------------
+  // compress epoch list to the artificial peak epochs and generate
+  // peak mags only; restore nominal epoch list afterwards.
+
+  MEMI  = (GENLC.NEPOCH+1) * sizeof(int);
+  MEMD  = (GENLC.NEPOCH+1) * sizeof(double);
+
+  GENLC_ORIG.NEPOCH      = GENLC.NEPOCH;
+  GENLC_ORIG.IFILT_OBS   = (int*)malloc ( MEMI ) ;
+  GENLC_ORIG.ISPEAK      = (int*)malloc ( MEMI ) ;
+  GENLC_ORIG.MJD         = (double*)malloc( MEMD ) ;
+  GENLC_ORIG.TOBS        = (double*)malloc( MEMD ) ;
+  GENLC_ORIG.TREST       = (double*)malloc( MEMD ) ;
+
+  for(iep=1; iep <= GENLC_ORIG.NEPOCH ; iep++ ) {
+    GENLC_ORIG.ISPEAK[iep]    = GENLC.OBSFLAG_PEAK[iep] ;
+    GENLC_ORIG.IFILT_OBS[iep] = GENLC.IFILT_OBS[iep] ;
+    GENLC_ORIG.MJD[iep]       = GENLC.MJD[iep];
+    GENLC_ORIG.TOBS[iep]      = GENLC.epoch_obs[iep];
+    GENLC_ORIG.TREST[iep]     = GENLC.epoch_rest[iep] ;
+
+    if ( GENLC_ORIG.ISPEAK[iep] == 0 ) { continue ; }
+    NEP_PEAKONLY++ ;
+    GENLC.OBSFLAG_PEAK[NEP_PEAKONLY] = GENLC_ORIG.ISPEAK[iep] ;
+    GENLC.IFILT_OBS[NEP_PEAKONLY]    = GENLC_ORIG.IFILT_OBS[iep] ;
+    GENLC.MJD[NEP_PEAKONLY]          = GENLC_ORIG.MJD[iep] ;
+    GENLC.epoch_obs[NEP_PEAKONLY]    = GENLC_ORIG.TOBS[iep] ;
+    GENLC.epoch_rest[NEP_PEAKONLY]   = GENLC_ORIG.TREST[iep] ;
+  }
+
+  GENLC.NEPOCH = NEP_PEAKONLY ;
+
+  for(ifilt=0; ifilt < MXFILTINDX; ifilt++ )
+    { PEAKMAG_LIST[ifilt] = MAG_UNDEFINED ; }
+
+  for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
+    ifilt_obs = GENLC.IFILTMAP_OBS[ifilt] ;
+    if ( GENLC.DOFILT[ifilt_obs] == 0 ) { continue ; }
+    genmodel(ifilt_obs,1);
+  }
+
+  for(iep=1; iep <= GENLC.NEPOCH; iep++ ) {
+    ifilt_obs = GENLC.IFILT_OBS[iep] ;
+    PEAKMAG_LIST[ifilt_obs] = GENLC.genmag_obs[iep] ;
+  }
+
+  // restore nominal epoch list
+  GENLC.NEPOCH = GENLC_ORIG.NEPOCH ;
+  for(iep=1; iep <= GENLC.NEPOCH ; iep++ ) {
+    GENLC.OBSFLAG_PEAK[iep]  = GENLC_ORIG.ISPEAK[iep];
+    GENLC.IFILT_OBS[iep]     = GENLC_ORIG.IFILT_OBS[iep] ;
+    GENLC.MJD[iep]           = GENLC_ORIG.MJD[iep];
+    GENLC.epoch_obs[iep]     = GENLC_ORIG.TOBS[iep]  ;
+    GENLC.epoch_rest[iep]    = GENLC_ORIG.TREST[iep] ;
+  }
+
+  free(GENLC_ORIG.IFILT_OBS);
+  free(GENLC_ORIG.ISPEAK);
+  free(GENLC_ORIG.MJD);
+  free(GENLC_ORIG.TOBS);
+  free(GENLC_ORIG.TREST);
+
+  // ---------------------------------------------------
+  // same mag offset that genmag_offsets will apply later
+  MAGOFF =
+    + GENLC.GENMAG_OFF_GLOBAL
+    + GENLC.LENSDMU
+    + INPUTS.MUSHIFT
+    + GENLC.SALT2gammaDM
+  ;
+  if ( INPUTS_STRONGLENS.USE_FLAG && GENSL.IMGNUM >= 0 )
+    { MAGOFF += GENSL.MAGSHIFT_LIST[GENSL.IMGNUM]; }
+
+  // ---------------------------------------------------
+  // flag epochs where even the peak-mag bound is hopelessly
+  // below the 5-sigma limiting mag of the observation.
+
+  for ( iep=1; iep <= GENLC.NEPOCH; iep++ ) {
+
+    GENLC.OBSFLAG_GENMAG_TRIAGE[iep] = false ;
+
+    ifilt_obs = GENLC.IFILT_OBS[iep] ;
+    if ( GENLC.OBSFLAG_PEAK[iep]     ) { continue ; }
+    if ( GENLC.OBSFLAG_TEMPLATE[iep] ) { continue ; }
+    if ( GENLC.DOFILT[ifilt_obs] == 0 ) { continue ; }
+
+    NEPCHECK_GENMAG_TRIAGE++ ;
+
+    PEAKMAG = PEAKMAG_LIST[ifilt_obs] + MAGOFF
+      + INPUTS.GENMAG_OFF_MODEL[ifilt_obs]
+      - INPUTS.GENMAG_OFF_ZP[ifilt_obs] ;
+    if ( PEAKMAG < -2.0 || PEAKMAG > 50.0 ) { continue ; } // undefined
+
+    // compute 5-sigma limiting mag from SIMLIB conditions
+    // (same conversions as in SIMLIB_DUMP_DRIVER)
+    GAIN       = SIMLIB_OBS_GEN.CCDGAIN[iep] ;
+    ZPTADU     = SIMLIB_OBS_GEN.ZPTADU[iep] ;
+    SKYSIG_ADU = SIMLIB_OBS_GEN.SKYSIG[iep] ;
+    PSFSIG1    = SIMLIB_OBS_GEN.PSFSIG1[iep] ;
+    PIXSIZE    = SIMLIB_OBS_GEN.PIXSIZE[iep] ;
+    if ( GAIN    < 1.0E-9 || ZPTADU  < 1.0 ) { continue ; }
+    if ( PSFSIG1 < 1.0E-9 || PIXSIZE < 1.0E-9 ) { continue ; }
+
+    ZPT_pe    = ZPTADU + 2.5*log10(GAIN);
+    PSF       = PSFSIG1 * PIXSIZE * FWHM_SIGMA_RATIO ;
+    SKYSIG_pe = SKYSIG_ADU * GAIN ;
+    FSKY_pe   = (SKYSIG_pe*SKYSIG_pe) / (PIXSIZE*PIXSIZE) ;
+    if ( FSKY_pe < 1.0E-9 ) { continue ; }
+    SKYMAG    = ZPT_pe - 2.5*log10(FSKY_pe);
+
+    M5SIG = MAGLIMIT_calculator(ZPT_pe, PSF, SKYMAG, 5.0);
+    if ( M5SIG < 1.0 ) { continue ; } // crazy SIMLIB conditions
+
+    MAGBRIGHT = PEAKMAG - MAGDIF_SAFETY_GENMAG_TRIAGE ;
+    if ( MAGBRIGHT > M5SIG + (double)DMAG ) {
+      GENLC.OBSFLAG_GENMAG_TRIAGE[iep] = true ;
+      GENLC.NEP_GENMAG_TRIAGE++ ;
+      NEPSKIP_GENMAG_TRIAGE++ ;
+    }
+
+  } // end iep loop
+
+  if ( GENLC.NEP_GENMAG_TRIAGE > 0 )
+    { GENLC.GENMAG_TRIAGE_VALID = 1 ; }
+
+  return ;
+
+} // end set_genmag_triage
+
+
 // *********************************************
 void GENMAG_DRIVER(void) {
 
@@ -21264,6 +22637,10 @@ void GENMAG_DRIVER(void) {
 
   genran_modelSmear(); // randoms for intrinsic scatter
 
+  // Aug 2026: check option to flag hopelessly-faint epochs
+  // that genmodel can skip (sim-input GENMAG_TRIAGE_DMAG)
+  set_genmag_triage();
+
   // this loop is to generate ideal mag in each filter.
   for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
     ifilt_obs = GENLC.IFILTMAP_OBS[ifilt] ;
@@ -21271,15 +22648,17 @@ void GENMAG_DRIVER(void) {
     DOFILT = GENLC.DOFILT[ifilt_obs] ;
 
     if ( DOFILT == 0 ) { continue ; }
-    
-    genmodel(ifilt_obs,1); 
+
+    genmodel(ifilt_obs,1);
 
     if ( GENFRAME_OPT == GENFRAME_REST ) {
       genmodel(ifilt_obs,2);      // 2nd nearest filter
       genmodel(ifilt_obs,3);      // 3rd nearest filter
-    } 
+    }
   } // ifilt
- 
+
+  GENLC.GENMAG_TRIAGE_VALID = 0 ; // Aug 2026: triage is for loop above only
+
 
   // spaghetti hack to pass LCLIB redshift and compute HOSTLIB photo-z
   gen_redshift_LCLIB();
@@ -22120,7 +23499,7 @@ void gen_fluxNoise_apply(int epoch, int vbose, FLUXNOISE_DEF *FLUXNOISE) {
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ; 
   }
 
-  ifield        = IFIELD_OVP_SIMLIB(1,FIELD);
+  ifield        = GENLC.IFIELD_OVP[epoch];  // interned index (Aug 2026)
   if ( ifield < 0 ) { ifield=0; }   // Nov 2016: needed for GAURAN_TEMPLATE
 
 
@@ -22730,7 +24109,8 @@ void genmodel(
 
   int istat, ifilt_tmp, ifilt_rest, iep ;
   int NEPFILT, NGRID, NEPFILT_SAVE ;
-  int index, isp, OPTMASK, NPAR; 
+  int index, isp, OPTMASK, NPAR;
+  int NEPFILT_ORIG, NEP_SKIP, kep, IEPMAP[MXEPSIM_PERFILT] ; // Aug 2026
 
   double 
     z, zz, mu, stretch[2], delta, dm15, av, RV, AV, tmpdif
@@ -22837,6 +24217,34 @@ void genmodel(
   // change epoch-pointer to local array
   ptr_epoch = Tmodel ;
 
+  // Aug 2026: check triage option (sim-input GENMAG_TRIAGE_DMAG) to
+  // skip model evaluation for epochs flagged by set_genmag_triage as
+  // hopelessly below the detection limit. Compact the epoch list here;
+  // flagged epochs are restored with mag = MAG_ZEROFLUX after the
+  // model call so that downstream epoch-indexing is unchanged.
+  NEPFILT_ORIG = NEPFILT ;
+  NEP_SKIP     = 0 ;
+  if ( GENLC.GENMAG_TRIAGE_VALID ) {
+    int epoch, NKEEP = 0, iepf = 0 ;
+    for ( epoch = 1; epoch <= GENLC.NEPOCH; epoch++ ) {
+      if ( GENLC.IFILT_OBS[epoch] != ifilt_obs ) { continue ; }
+      if ( GENLC.OBSFLAG_GENMAG_TRIAGE[epoch] )
+	{ NEP_SKIP++ ; }
+      else
+	{ Tmodel[NKEEP] = Tmodel[iepf] ;  IEPMAP[NKEEP] = iepf ; NKEEP++ ; }
+      iepf++ ;
+    }
+
+    if ( iepf != NEPFILT_ORIG ) {
+      sprintf(c1err,"Found %d epochs for ifilt_obs=%d(%s), expected %d",
+	      iepf, ifilt_obs, cfilt_obs, NEPFILT_ORIG );
+      sprintf(c2err,"genmag-triage epoch map is corrupted");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    if ( NEP_SKIP > 0 ) { NEPFILT = NKEEP ; }
+  }
+
 
   // check option to interpolate model on an Epoch grid.
   // e.g., to mimic interpolated fakes on images.
@@ -23141,8 +24549,35 @@ void genmodel(
 
   // apply intrinsic model mag-smearing AFTER model-mag generation
   // Note that ptr_genmag is both an input and output arg.
-  genmodelSmear(NEPFILT, ifilt_obs, ifilt_rest, z, 
-		 ptr_epoch, ptr_genmag, ptr_generr ); 
+  genmodelSmear(NEPFILT, ifilt_obs, ifilt_rest, z,
+		 ptr_epoch, ptr_genmag, ptr_generr );
+
+  // Aug 2026: expand triage-compacted epoch list back to its original
+  // length (see above); each skipped epoch gets mag = MAG_ZEROFLUX
+  // (flux=0) so that noise, cuts and trigger run on every epoch.
+  // Work backwards so the in-place expansion never clobbers a
+  // not-yet-moved entry (IEPMAP[kep] >= kep always).
+  if ( NEP_SKIP > 0 ) {
+    iep = NEPFILT_ORIG - 1 ;
+    for ( kep = NEPFILT-1; kep >= 0; kep-- ) {
+      while ( iep > IEPMAP[kep] ) {
+	ptr_genmag[iep] = MAG_ZEROFLUX ;   ptr_generr[iep] = 0.0 ;
+	GENFILT.genmag_smear[ifilt_obs][iep+1] = 0.0 ;
+	iep-- ;
+      }
+      ptr_genmag[iep] = ptr_genmag[kep] ;
+      ptr_generr[iep] = ptr_generr[kep] ;
+      GENFILT.genmag_smear[ifilt_obs][iep+1] =
+	GENFILT.genmag_smear[ifilt_obs][kep+1] ;
+      iep-- ;
+    }
+    while ( iep >= 0 ) {
+      ptr_genmag[iep] = MAG_ZEROFLUX ;   ptr_generr[iep] = 0.0 ;
+      GENFILT.genmag_smear[ifilt_obs][iep+1] = 0.0 ;
+      iep-- ;
+    }
+    NEPFILT = NEPFILT_ORIG ;
+  }
 
   NEPFILT = NEPFILT_GENLC(-1, ifilt_obs);
 
@@ -24557,6 +25992,12 @@ void readme_doc(int iflag_readme) {
 	    INPUTS.TGRIDSTEP_MODEL_INTERP );
   }
 
+  if ( INPUTS.GENMAG_TRIAGE_DMAG > 0.0 ) {
+    i++; cptr = VERSION_INFO.README_DOC[i] ;
+    sprintf(cptr,"\t GENMAG_TRIAGE_DMAG : %.2f mag below 5sigma-depth "
+	    "=> skip model mag \n",  INPUTS.GENMAG_TRIAGE_DMAG );
+  }
+
   i++; cptr = VERSION_INFO.README_DOC[i] ;
   sprintf(cptr,"\t RISETIME-SHIFT(days) SIGMA(lo,hi) : %3.1f , %3.1f  (Mean= %3.1f) \n"
 	  ,INPUTS.GENGAUSS_RISETIME_SHIFT.SIGMA[0]
@@ -26007,6 +27448,8 @@ void update_accept_counters(void) {
   // increment number of generated SN that are written
   NGENLC_WRITE++ ;
   NGENSPEC_WRITE += GENSPEC.NMJD_PROC ; // Jan 14 2021
+
+  update_accept_monitor(1);  // Aug 2026: z-binned acceptance counter
   
   // increment stats based on typing method
   if ( GENLC.METHOD_TYPE == METHOD_TYPE_SPEC )    
@@ -26041,6 +27484,110 @@ void update_accept_counters(void) {
 
 } // end update_accept_counters
 
+// ***************************************************
+void init_accept_monitor(void) {
+
+  // Created Aug 2026
+  // Init coarse z-binned acceptance counters over the generated
+  // redshift range. See dump_accept_monitor for the end-of-sim table.
+
+  int iz;
+  //  char fnam[] = "init_accept_monitor" ;
+
+  // -------------- BEGIN ---------------
+
+  ACCEPT_MONITOR.ZMIN = INPUTS.GENRANGE_REDSHIFT[0] ;
+  ACCEPT_MONITOR.ZMAX = INPUTS.GENRANGE_REDSHIFT[1] ;
+  ACCEPT_MONITOR.ZBIN =
+    ( ACCEPT_MONITOR.ZMAX - ACCEPT_MONITOR.ZMIN ) /
+    (double)NZBIN_ACCEPT_MONITOR ;
+
+  for ( iz=0; iz < NZBIN_ACCEPT_MONITOR; iz++ ) {
+    ACCEPT_MONITOR.NGEN[iz] = 0 ;
+    ACCEPT_MONITOR.NACC[iz] = 0 ;
+  }
+
+  return ;
+
+} // end init_accept_monitor
+
+// ***************************************************
+void update_accept_monitor(int isAccept) {
+
+  // Created Aug 2026
+  // Increment z-binned counters for current event;
+  // isAccept=0 -> event generated in GENRANGEs (called from main);
+  // isAccept=1 -> event written (called from update_accept_counters).
+
+  int iz;
+  //  char fnam[] = "update_accept_monitor" ;
+
+  // -------------- BEGIN ---------------
+
+  if ( ACCEPT_MONITOR.ZBIN <= 0.0 ) { return ; } // fixed-z generation
+
+  iz = (int)( ( GENLC.REDSHIFT_CMB - ACCEPT_MONITOR.ZMIN ) /
+	      ACCEPT_MONITOR.ZBIN ) ;
+  if ( iz < 0 )                        { iz = 0 ; }
+  if ( iz >= NZBIN_ACCEPT_MONITOR )    { iz = NZBIN_ACCEPT_MONITOR-1 ; }
+
+  if ( isAccept )
+    { ACCEPT_MONITOR.NACC[iz]++ ; }
+  else
+    { ACCEPT_MONITOR.NGEN[iz]++ ; }
+
+  return ;
+
+} // end update_accept_monitor
+
+// ***************************************************
+void dump_accept_monitor(void) {
+
+  // Created Aug 2026
+  // Print acceptance fraction vs. redshift so that trigger-efficiency
+  // productions can be split into z strata with NGENTOT scaled by
+  // 1/eff per stratum (stratified generation) instead of oversampling
+  // the entire z range. Printed only when a non-trivial fraction of
+  // in-range events was rejected.
+
+  int    iz, NGEN, NACC, NGEN_SUM=0, NACC_SUM=0 ;
+  double z0, z1, EFF ;
+  //  char fnam[] = "dump_accept_monitor" ;
+
+  // -------------- BEGIN ---------------
+
+  if ( ACCEPT_MONITOR.ZBIN <= 0.0 ) { return ; }
+
+  for ( iz=0; iz < NZBIN_ACCEPT_MONITOR; iz++ ) {
+    NGEN_SUM += ACCEPT_MONITOR.NGEN[iz] ;
+    NACC_SUM += ACCEPT_MONITOR.NACC[iz] ;
+  }
+
+  // skip table unless at least half of the in-range events failed
+  if ( NGEN_SUM < 100 || 2*NACC_SUM > NGEN_SUM ) { return ; }
+
+  print_banner( " Acceptance vs. redshift (stratification guide) " );
+  printf("      zCMB range     NGEN    NACC    EFF  \n" );
+
+  for ( iz=0; iz < NZBIN_ACCEPT_MONITOR; iz++ ) {
+    NGEN = ACCEPT_MONITOR.NGEN[iz] ;
+    NACC = ACCEPT_MONITOR.NACC[iz] ;
+    if ( NGEN == 0 ) { continue ; }
+    z0  = ACCEPT_MONITOR.ZMIN + ACCEPT_MONITOR.ZBIN * (double)iz ;
+    z1  = z0 + ACCEPT_MONITOR.ZBIN ;
+    EFF = (double)NACC / (double)NGEN ;
+    printf("   %6.4f - %6.4f  %7d %7d  %6.4f \n",
+	   z0, z1, NGEN, NACC, EFF );
+  }
+
+  printf("\t Split GENRANGE_REDSHIFT into strata and scale NGENTOT_LC\n"
+	 "\t by 1/EFF per stratum to equalize written statistics.\n" );
+  fflush(stdout);
+
+  return ;
+
+} // end dump_accept_monitor
+
 // ***************************************************
 void init_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
@@ -26075,8 +27622,21 @@ void init_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
     return ;
   }
 
-  // clear out old GENVERSION files; 2nd arg is PROMPT flag
-  clr_VERSION(INPUTS.GENVERSION,INPUTS.CLEARPROMPT);
+  // Aug 2026: checkpoint restart keeps already-written data files,
+  // so skip the version-clear; FITS format cannot be re-opened for
+  // append, so demand text format here before anything is clobbered.
+  if ( SIMCHECKPOINT.RESTART_FLAG ) {
+    if ( WRFLAG_FITS ) {
+      sprintf(c1err,"RESTART_CHECKPOINT requires TEXT format output.");
+      sprintf(c2err,"FITS files cannot be re-opened for append; "
+	      "check FORMAT_MASK.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+  else {
+    // clear out old GENVERSION files; 2nd arg is PROMPT flag
+    clr_VERSION(INPUTS.GENVERSION,INPUTS.CLEARPROMPT);
+  }
 
   // create new subdir for simulated SNDATA files.
   // Note that -p is not used to avoid bad behavior.
@@ -26088,6 +27648,8 @@ void init_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
   // whether they are used or not.
   sprintf(prefix,"%s/%s", PATH_SNDATA_SIM, INPUTS.GENVERSION );
 
+  sprintf(SIMCHECKPOINT.FILENAME, "%s.CHECKPOINT", prefix ); // Aug 2026
+
   // mandatory
   sprintf(SIMFILE_AUX->LIST,       "%s.LIST",        prefix );
   sprintf(SIMFILE_AUX->README,     "%s.README",      prefix );
@@ -26105,8 +27667,12 @@ void init_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
 
   // create mandatory files.
-  SIMFILE_AUX->FP_LIST   = fopen(SIMFILE_AUX->LIST,   "wt") ;  
-  SIMFILE_AUX->FP_README = fopen(SIMFILE_AUX->README, "wt") ;  
+  // On checkpoint restart, append to LIST so earlier entries survive.
+  if ( SIMCHECKPOINT.RESTART_FLAG )
+    { SIMFILE_AUX->FP_LIST = fopen(SIMFILE_AUX->LIST, "at") ; }
+  else
+    { SIMFILE_AUX->FP_LIST = fopen(SIMFILE_AUX->LIST, "wt") ; }
+  SIMFILE_AUX->FP_README = fopen(SIMFILE_AUX->README, "wt") ;
 
   /* xxxxxxxx mark delete Feb 2021 xxxxxxx
   SIMFILE_AUX->FP_IGNORE = fopen(SIMFILE_AUX->IGNORE, "wt") ;   
@@ -26240,6 +27806,168 @@ void update_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 } // end of update_simFiles
 
 
+// ***********************************
+void wr_checkpoint(int ilc) {
+
+  // Created Aug 2026
+  // Write generation state to <GENVERSION>.CHECKPOINT so that a
+  // killed job can resume with the RESTART_CHECKPOINT sim-input.
+  // State = event counters, randoms drawn per stream, SIMLIB file
+  // position, and reject statistics. Written to a temp file and
+  // renamed so a kill during the write leaves the previous
+  // checkpoint intact; failures are silent (checkpoint is a bonus,
+  // never an abort).
+
+  FILE *fp ;
+  char tmpFile[MXPATHLEN+40] ;
+  //  char fnam[] = "wr_checkpoint" ;
+
+  // ------------ BEGIN -------------
+
+  if ( strlen(SIMCHECKPOINT.FILENAME) == 0 ) { return; }
+
+  sprintf(tmpFile, "%s_tmp%d", SIMCHECKPOINT.FILENAME, getpid() );
+  fp = fopen(tmpFile, "wt");
+  if ( !fp ) { return ; }
+
+  fprintf(fp, "# snlc_sim checkpoint written after event %d.\n", ilc);
+  fprintf(fp, "# Resume with sim-input: RESTART_CHECKPOINT: %s\n",
+	  SIMCHECKPOINT.FILENAME );
+  fprintf(fp, "GENVERSION:         %s\n",   INPUTS.GENVERSION );
+  fprintf(fp, "RANSEED:            %d\n",   GENRAN_INFO.ISEED );
+  fprintf(fp, "ILC:                %d\n",   ilc );
+  fprintf(fp, "NGENLC_TOT:         %d\n",   NGENLC_TOT );
+  fprintf(fp, "NGENLC_WRITE:       %d\n",   NGENLC_WRITE );
+  fprintf(fp, "NCALL_RAN_STREAM0:  %lld\n", GENRAN_INFO.NCALL_STREAM[0]);
+  fprintf(fp, "NCALL_RAN_STREAM1:  %lld\n", GENRAN_INFO.NCALL_STREAM[1]);
+  fprintf(fp, "FTELL_SIMLIB:       %ld\n",  ftell(fp_SIMLIB) );
+  fprintf(fp, "NGEN_REJECT:        %d %d %d %d %d %d %d\n",
+	  NGEN_REJECT.GENRANGE, NGEN_REJECT.GENMAG,
+	  NGEN_REJECT.GENPAR_SELECT_FILE, NGEN_REJECT.HOSTLIB,
+	  NGEN_REJECT.SEARCHEFF, NGEN_REJECT.CUTWIN,
+	  NGEN_REJECT.NEPOCH );
+  fclose(fp);
+
+  rename(tmpFile, SIMCHECKPOINT.FILENAME);
+
+  return ;
+
+} // end wr_checkpoint
+
+
+// ***********************************
+void restart_from_checkpoint(void) {
+
+  // Created Aug 2026
+  // Resume generation from the checkpoint file named by the
+  // RESTART_CHECKPOINT sim-input: restore event counters and
+  // reject stats, fseek the SIMLIB to the recorded position, and
+  // burn each random stream forward to its recorded call count so
+  // the resumed job draws the same random sequence as an
+  // uninterrupted run. Must be called after all one-time init.
+  //
+  // Caveat: the GSL Poisson generator is re-seeded rather than
+  // restored, so options drawing GSL Poisson randoms resume with
+  // a fresh (not replayed) Poisson stream.
+
+  FILE *fp ;
+  char  c_get[MXPATHLEN], ckpVersion[MXPATHLEN] ;
+  int   ckpSeed = -9, ILC = -9 ;
+  long  FTELL_SIMLIB = -9 ;
+  long long NCALL_STREAM[MXSTREAM_RAN] = { 0, 0 } ;
+  char *ckpFile = INPUTS.RESTART_CHECKPOINT_FILE ;
+  char  fnam[] = "restart_from_checkpoint" ;
+
+  // ------------ BEGIN -------------
+
+  print_banner(fnam);
+  printf("\t Resume from checkpoint file: %s \n", ckpFile);
+
+  if ( INPUTS.SIMLIB_GZIPFLAG ) {
+    sprintf(c1err,"Cannot restart with gzipped SIMLIB (no fseek).");
+    sprintf(c2err,"gunzip %s and retry.", INPUTS.SIMLIB_FILE );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  fp = fopen(ckpFile, "rt");
+  if ( !fp ) {
+    sprintf(c1err,"Could not open checkpoint file");
+    sprintf(c2err,"'%s'", ckpFile);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  ckpVersion[0] = 0 ;
+
+  while( fscanf(fp, "%s", c_get) != EOF ) {
+    if ( strcmp(c_get,"GENVERSION:") == 0 )
+      { readchar(fp, ckpVersion); }
+    else if ( strcmp(c_get,"RANSEED:") == 0 )
+      { readint(fp, 1, &ckpSeed); }
+    else if ( strcmp(c_get,"ILC:") == 0 )
+      { readint(fp, 1, &ILC); }
+    else if ( strcmp(c_get,"NGENLC_TOT:") == 0 )
+      { readint(fp, 1, &NGENLC_TOT); }
+    else if ( strcmp(c_get,"NGENLC_WRITE:") == 0 )
+      { readint(fp, 1, &NGENLC_WRITE); }
+    else if ( strcmp(c_get,"NCALL_RAN_STREAM0:") == 0 )
+      { fscanf(fp, "%lld", &NCALL_STREAM[0] ); }
+    else if ( strcmp(c_get,"NCALL_RAN_STREAM1:") == 0 )
+      { fscanf(fp, "%lld", &NCALL_STREAM[1] ); }
+    else if ( strcmp(c_get,"FTELL_SIMLIB:") == 0 )
+      { fscanf(fp, "%ld", &FTELL_SIMLIB ); }
+    else if ( strcmp(c_get,"NGEN_REJECT:") == 0 ) {
+      readint(fp, 1, &NGEN_REJECT.GENRANGE);
+      readint(fp, 1, &NGEN_REJECT.GENMAG);
+      readint(fp, 1, &NGEN_REJECT.GENPAR_SELECT_FILE);
+      readint(fp, 1, &NGEN_REJECT.HOSTLIB);
+      readint(fp, 1, &NGEN_REJECT.SEARCHEFF);
+      readint(fp, 1, &NGEN_REJECT.CUTWIN);
+      readint(fp, 1, &NGEN_REJECT.NEPOCH);
+    }
+  }
+  fclose(fp);
+
+  // sanity checks before touching any state
+  if ( strcmp(ckpVersion, INPUTS.GENVERSION) != 0 ) {
+    sprintf(c1err,"Checkpoint GENVERSION='%s' does not match", ckpVersion);
+    sprintf(c2err,"current GENVERSION='%s'", INPUTS.GENVERSION );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+  if ( ckpSeed != GENRAN_INFO.ISEED ) {
+    sprintf(c1err,"Checkpoint RANSEED=%d but current seed=%d",
+	    ckpSeed, GENRAN_INFO.ISEED );
+    sprintf(c2err,"Restart requires the same RANSEED.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+  if ( ILC <= 0 || FTELL_SIMLIB < 0 ) {
+    sprintf(c1err,"Invalid ILC=%d or FTELL_SIMLIB=%ld", ILC, FTELL_SIMLIB);
+    sprintf(c2err,"Checkpoint file is corrupt: %s", ckpFile );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  // restore SIMLIB file position
+  if ( fseek(fp_SIMLIB, FTELL_SIMLIB, SEEK_SET) != 0 ) {
+    sprintf(c1err,"fseek(SIMLIB,%ld) failed.", FTELL_SIMLIB);
+    sprintf(c2err,"Did the SIMLIB file change since the checkpoint?");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  // fast-forward random streams to checkpointed call counts
+  burn_random_stream(0, NCALL_STREAM[0]);
+  if ( GENRAN_INFO.NSTREAM > 1 )
+    { burn_random_stream(1, NCALL_STREAM[1]); }
+
+  SIMCHECKPOINT.ILC_START = ILC + 1 ;
+
+  printf("\t Resume at event %d  (NGENLC_TOT=%d, NGENLC_WRITE=%d) \n",
+	 SIMCHECKPOINT.ILC_START, NGENLC_TOT, NGENLC_WRITE );
+  fflush(stdout);
+
+  return ;
+
+} // end restart_from_checkpoint
+
+
 // ***********************************
 void end_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX) {
 
@@ -26920,6 +28648,12 @@ void SIMLIB_DUMP_DRIVER(void) {
   char   SIMLIB_CUTVARNAME[MXSIMLIB_CUTCHECK][20] ;
   float *PTR_SIMLIB_CUTVAR[MXSIMLIB_CUTCHECK][2] ;
 
+  // Aug 2026: binary cache of per-LIBID cadence stats
+  FILE  *fp_cache_rd=NULL, *fp_cache_wr=NULL ;
+  int    CACHE_COMPLETE = 0 ;
+  char   cacheFile[MXPATHLEN+20], cacheFileTmp[MXPATHLEN+40] ;
+  SIMLIB_DUMPCACHE_RECORD_DEF CACHE_REC ;
+
   char  fnam[] = "SIMLIB_DUMP_DRIVER" ;
 
   // ------------ BEGIN  ----------
@@ -27017,6 +28751,24 @@ void SIMLIB_DUMP_DRIVER(void) {
 
   fpdmp0 = fpdmp1 = NULL ;
 
+  // Aug 2026: check for binary cache of per-LIBID cadence stats.
+  // The per-LIBID stats are cut-independent (cuts are opened above),
+  // so after a cut tweak only the CUTFAIL counters and averages need
+  // recomputing from the cache. Cache cannot serve per-OBS output
+  // (needs the full text read) or LCLIB weights (need GLON/GLAT).
+  if ( !LDMP_OBS_TEXT && !LDMP_ROOT && INDEX_GENMODEL != MODEL_LCLIB ) {
+    fp_cache_rd = open_SIMLIB_DUMPCACHE_read(cacheFile);
+    if ( fp_cache_rd != NULL ) {
+      printf("\t Re-use per-LIBID cadence stats from binary cache:\n"
+	     "\t   %s \n"
+	     "\t (delete this file to force full SIMLIB read) \n",
+	     cacheFile );
+      fflush(stdout);
+    }
+    else
+      { fp_cache_wr = open_SIMLIB_DUMPCACHE_write(cacheFile,cacheFileTmp); }
+  }
+
   // =======================================
   // open Dump SIMLIB to fitres-style file with 1 line per LIB
 
@@ -27086,9 +28838,36 @@ void SIMLIB_DUMP_DRIVER(void) {
 
   while ( NREAD < MXREAD_SIMLIB ) {
 
+    if ( fp_cache_rd != NULL ) {
+      // Aug 2026: stream per-LIBID stats from cache; no text read
+      if ( fread(&CACHE_REC, sizeof(CACHE_REC), 1, fp_cache_rd) != 1 )
+	{ CACHE_COMPLETE = 1 ;  goto DONE_READ ; }
+      if ( NREAD > INPUTS.NGENTOT_LC ) { goto DONE_READ ; }
+
+      ID    = CACHE_REC.LIBID ;
+      RA    = CACHE_REC.RA ;
+      DEC   = CACHE_REC.DEC ;
+      MWEBV = CACHE_REC.MWEBV ;
+      sprintf(FIELDNAME, "%s", CACHE_REC.FIELDNAME );
+      SIMLIB_DUMP_AVG1 = CACHE_REC.AVG1 ;
+      RA4     = (float)RA ;
+      DEC4    = (float)DEC ;
+      MJDMIN4 = (float)SIMLIB_DUMP_AVG1.MJDMIN ;
+      MJDMAX4 = (float)SIMLIB_DUMP_AVG1.MJDMAX ;
+
+      if ( RA   < GLOBAL_RANGE_RA[0]   ) { GLOBAL_RANGE_RA[0]   = RA ; }
+      if ( RA   > GLOBAL_RANGE_RA[1]   ) { GLOBAL_RANGE_RA[1]   = RA ; }
+      if ( DEC  < GLOBAL_RANGE_DEC[0]  ) { GLOBAL_RANGE_DEC[0]  = DEC ; }
+      if ( DEC  > GLOBAL_RANGE_DEC[1]  ) { GLOBAL_RANGE_DEC[1]  = DEC ; }
+
+      NREAD++ ;
+      NREAD_SIMLIB = NREAD ;
+      goto POST_ANALYSIS ;
+    }
+
     SIMLIB_READ_DRIVER();
 
-    if ( SIMLIB_HEADER.NWRAP   > 0 ) { goto DONE_READ ; }
+    if ( SIMLIB_HEADER.NWRAP   > 0 ) { CACHE_COMPLETE=1; goto DONE_READ ; }
     if ( NREAD > INPUTS.NGENTOT_LC ) { goto DONE_READ ; } // May 2 2017
 
     ID    = GENLC.SIMLIB_ID; 
@@ -27204,15 +28983,6 @@ void SIMLIB_DUMP_DRIVER(void) {
     MJDGAP(Nobs, ptrmjd, MJDGAP_IGNORE, &GAPMAX, &GAPAVG );
     SIMLIB_DUMP_AVG1.GAPMAX[0]  = GAPMAX ;
     SIMLIB_DUMP_AVG1.GAPAVG[0]  = GAPAVG ;
-    
-    if ( LDMP_SEQ_TEXT ) {
-      NROW++ ;
-      fprintf(fpdmp0,"ROW: %4d %4d %7.3f %7.3f %s %6.3f %5.0f %3.1f "
-	      "%3d %.2f %.2f ", 
-	      NROW, ID, RA, DEC, FIELDNAME, MWEBV, GAPMAX, GAPAVG, 
-	      Nobs, MJDMIN4, MJDMAX4 );
-      fflush(fpdmp0);
-    }
 
     for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
       ifilt_obs = GENLC.IFILTMAP_OBS[ifilt] ;
@@ -27234,24 +29004,22 @@ void SIMLIB_DUMP_DRIVER(void) {
       SIMLIB_DUMP_AVG1.SKYMAG[ifilt_obs]     /= XNobs ;
       SIMLIB_DUMP_AVG1.M5SIG[ifilt_obs]      /= XNobs ;
 
-
-      if ( LDMP_SEQ_TEXT ) {
-	fprintf(fpdmp0,"%2d %6.2f %5.2f %5.2f ", Nobs
-		, SIMLIB_DUMP_AVG1.ZPT[ifilt_obs]
-		, SIMLIB_DUMP_AVG1.PSF[ifilt_obs]
-		, SIMLIB_DUMP_AVG1.M5SIG[ifilt_obs]  );
-	fflush(fpdmp0);
-      }
-
       // load global array
       SIMLIB_DUMP_AVG1.FOM[ifilt_obs] = -9.0 ;
 
     } // end of ifilt loop over filters
 
+  POST_ANALYSIS:   // Aug 2026: cache path re-enters here
+
     SIMLIB_DUMP_AVG1.MJDMIN = MJDMIN4 ;
     SIMLIB_DUMP_AVG1.MJDMAX = MJDMAX4 ;
-    
-    if ( MJDMIN4 < SIMLIB_DUMP_AVGALL.MJDMIN  ) 
+
+    if ( LDMP_SEQ_TEXT ) {
+      NROW++ ;
+      wr_SIMLIB_DUMP_SEQ_ROW(fpdmp0, NROW, ID, RA, DEC, FIELDNAME, MWEBV);
+    }
+
+    if ( MJDMIN4 < SIMLIB_DUMP_AVGALL.MJDMIN  )
       { SIMLIB_DUMP_AVGALL.MJDMIN = MJDMIN4; }
     if ( MJDMAX4 > SIMLIB_DUMP_AVGALL.MJDMAX  ) 
       { SIMLIB_DUMP_AVGALL.MJDMAX = MJDMAX4; }
@@ -27264,8 +29032,17 @@ void SIMLIB_DUMP_DRIVER(void) {
       if ( TMP1 > SIMLIB_GENRANGE[icut][1] ) { NSIMLIB_CUTFAIL[icut]++ ; }
     }
 
-    if ( LDMP_SEQ_TEXT ) { fprintf(fpdmp0,"\n" ); }
-    
+    // append this LIBID's stats to the cache being written
+    if ( fp_cache_wr != NULL ) {
+      CACHE_REC.LIBID = ID ;
+      CACHE_REC.RA    = RA ;
+      CACHE_REC.DEC   = DEC ;
+      CACHE_REC.MWEBV = MWEBV ;
+      sprintf(CACHE_REC.FIELDNAME, "%s", FIELDNAME );
+      CACHE_REC.AVG1  = SIMLIB_DUMP_AVG1 ;
+      fwrite(&CACHE_REC, sizeof(CACHE_REC), 1, fp_cache_wr);
+    }
+
     // screen dump
     if ( LDMP_LOCAL  && NREAD <= MXSIMLIB_DUMP_STDOUT ) {
 
@@ -27303,6 +29080,12 @@ void SIMLIB_DUMP_DRIVER(void) {
 
  DONE_READ:
 
+  if ( fp_cache_rd != NULL ) { fclose(fp_cache_rd); }
+  if ( fp_cache_wr != NULL ) {
+    close_SIMLIB_DUMPCACHE_write(fp_cache_wr, cacheFileTmp, cacheFile,
+				 NREAD, CACHE_COMPLETE );
+  }
+
   if ( QUIET ) { return; }
 
   if ( LDMP_SEQ_TEXT ) { 
@@ -27401,6 +29184,148 @@ void SIMLIB_DUMP_DRIVER(void) {
 } // end of SIMLIB_DUMP_DRIVER
 
 
+// *******************************************
+void wr_SIMLIB_DUMP_SEQ_ROW(FILE *fp, int NROW, int ID, double RA,
+			    double DEC, char *FIELDNAME, double MWEBV) {
+
+  // Created Aug 2026 [extracted from SIMLIB_DUMP_DRIVER]
+  // Write one summary row for this LIBID-sequence using the stats
+  // already loaded into SIMLIB_DUMP_AVG1; works for both the full
+  // text read and the binary-cache path.
+
+  int ifilt, ifilt_obs, Nobs ;
+  // ----------- BEGIN -----------
+
+  Nobs = (int)SIMLIB_DUMP_AVG1.NEPFILT[0] ;
+  fprintf(fp,"ROW: %4d %4d %7.3f %7.3f %s %6.3f %5.0f %3.1f "
+	  "%3d %.2f %.2f ",
+	  NROW, ID, RA, DEC, FIELDNAME, MWEBV,
+	  SIMLIB_DUMP_AVG1.GAPMAX[0], SIMLIB_DUMP_AVG1.GAPAVG[0],
+	  Nobs, SIMLIB_DUMP_AVG1.MJDMIN, SIMLIB_DUMP_AVG1.MJDMAX );
+
+  for ( ifilt=0; ifilt < GENLC.NFILTDEF_OBS; ifilt++ ) {
+    ifilt_obs = GENLC.IFILTMAP_OBS[ifilt] ;
+    Nobs      = (int)SIMLIB_DUMP_AVG1.NEPFILT[ifilt_obs] ;
+    fprintf(fp,"%2d %6.2f %5.2f %5.2f ", Nobs
+	    , SIMLIB_DUMP_AVG1.ZPT[ifilt_obs]
+	    , SIMLIB_DUMP_AVG1.PSF[ifilt_obs]
+	    , SIMLIB_DUMP_AVG1.M5SIG[ifilt_obs]  );
+  }
+  fprintf(fp,"\n");  fflush(fp);
+
+  return ;
+
+} // end wr_SIMLIB_DUMP_SEQ_ROW
+
+
+// *******************************************
+FILE *open_SIMLIB_DUMPCACHE_read(char *cacheFile) {
+
+  // Created Aug 2026
+  // Open binary cache of per-LIBID dump stats for reading;
+  // returns FILE* positioned after the header, or NULL if the
+  // cache is absent or stale (SIMLIB size changed, different
+  // filter bound, or incomplete write).
+
+  struct stat statbuf ;
+  long long TEXTSIZE = 0, TEXTSIZE_CACHE ;
+  int  HDR[4] ;
+  FILE *fp ;
+  //  char fnam[] = "open_SIMLIB_DUMPCACHE_read" ;
+
+  // ----------- BEGIN -----------
+
+  sprintf(cacheFile, "%s.DUMPCACHE", INPUTS.SIMLIB_OPENFILE );
+
+  if ( stat(INPUTS.SIMLIB_OPENFILE, &statbuf) == 0 )
+    { TEXTSIZE = (long long)statbuf.st_size ; }
+
+  fp = fopen(cacheFile,"rb");
+  if ( fp == NULL ) { return(NULL); }
+
+  if ( fread(HDR, sizeof(int), 4, fp) != 4               ||
+       fread(&TEXTSIZE_CACHE, sizeof(long long),1,fp) != 1 ||
+       HDR[0] != MAGIC_SIMLIB_DUMPCACHE    ||
+       HDR[1] != VERSION_SIMLIB_DUMPCACHE  ||
+       HDR[2] != MXFILTINDX                ||
+       HDR[3] <= 0                         ||
+       TEXTSIZE_CACHE != TEXTSIZE  ) {
+    fclose(fp);  return(NULL);
+  }
+
+  return(fp);
+
+} // end open_SIMLIB_DUMPCACHE_read
+
+
+// *******************************************
+FILE *open_SIMLIB_DUMPCACHE_write(char *cacheFile, char *tmpFile) {
+
+  // Created Aug 2026
+  // Open temp cache file for writing and write header with
+  // NLIBID=0 placeholder (finalized in close_SIMLIB_DUMPCACHE_write).
+  // Returns NULL (not an error) if the SIMLIB area is read-only.
+
+  struct stat statbuf ;
+  long long TEXTSIZE = 0 ;
+  int  HDR[4] ;
+  FILE *fp ;
+  //  char fnam[] = "open_SIMLIB_DUMPCACHE_write" ;
+
+  // ----------- BEGIN -----------
+
+  sprintf(cacheFile, "%s.DUMPCACHE", INPUTS.SIMLIB_OPENFILE );
+  sprintf(tmpFile,   "%s_tmp%d", cacheFile, getpid() );
+
+  if ( stat(INPUTS.SIMLIB_OPENFILE, &statbuf) == 0 )
+    { TEXTSIZE = (long long)statbuf.st_size ; }
+
+  fp = fopen(tmpFile,"wb");
+  if ( fp == NULL ) { return(NULL); }
+
+  HDR[0] = MAGIC_SIMLIB_DUMPCACHE ;
+  HDR[1] = VERSION_SIMLIB_DUMPCACHE ;
+  HDR[2] = MXFILTINDX ;
+  HDR[3] = 0 ;   // NLIBID placeholder
+  fwrite(HDR, sizeof(int), 4, fp);
+  fwrite(&TEXTSIZE, sizeof(long long), 1, fp);
+
+  return(fp);
+
+} // end open_SIMLIB_DUMPCACHE_write
+
+
+// *******************************************
+void close_SIMLIB_DUMPCACHE_write(FILE *fp, char *tmpFile, char *cacheFile,
+				  int NLIBID, int COMPLETE) {
+
+  // Created Aug 2026
+  // Finalize cache: fill in NLIBID and rename temp file.
+  // If the SIMLIB read was truncated (NGENTOT_LC or MXREAD bail),
+  // discard the partial cache instead.
+
+  //  char fnam[] = "close_SIMLIB_DUMPCACHE_write" ;
+
+  // ----------- BEGIN -----------
+
+  if ( !COMPLETE || NLIBID <= 0 ) {
+    fclose(fp);  remove(tmpFile);  return ;
+  }
+
+  fseek(fp, 3*sizeof(int), SEEK_SET);   // NLIBID slot in header
+  fwrite(&NLIBID, sizeof(int), 1, fp);
+  fclose(fp);
+  rename(tmpFile, cacheFile);
+
+  printf("\n Wrote per-LIBID cadence stats to binary cache \n\t %s \n",
+	 cacheFile );
+  fflush(stdout);
+
+  return ;
+
+} // end close_SIMLIB_DUMPCACHE_write
+
+
 // =========================================================
 void update_SIMLIB_DUMP_AVGALL(int OPT) {
 
@@ -28285,11 +30210,24 @@ void test_igm(void) {
     z     = z_b ;
     tau_b = tLSLAF(z,lobs) + tLCLAF(z,lobs) + tLSDLA(z,lobs) + tLCDLA(z,lobs); 
 
-    printf(" xxx lrest=%6.0f tau(z=%.1f)=%le   tau(z=%.1f)=%le\n", 
+    printf(" xxx lrest=%6.0f tau(z=%.1f)=%le   tau(z=%.1f)=%le\n",
 	   lrest, z_a, tau_a,  z_b, tau_b) ;
     fflush(stdout);
   }
-  
+
+  // Aug 2026: cross-check bilinear table lookup against direct sums
+  prep_Inoue_table(500.0, 40000.0, 4000, 0.0, 8.0, 400);
+
+  for (ilam=500; ilam <=6000; ilam+=500 ) {
+    lrest = (double)ilam ;
+    z     = z_b ;
+    lobs  = lrest*(1.+z);
+    tau_b = tLSLAF(z,lobs) + tLCLAF(z,lobs) + tLSDLA(z,lobs) + tLCDLA(z,lobs);
+    printf(" xxx lrest=%6.0f z=%.1f  trans(direct)=%le  trans(table)=%le\n",
+	   lrest, z, exp(-tau_b), get_Inoue_trans(z,lobs) ) ;
+    fflush(stdout);
+  }
+
   exit(1);
 
 } // end test_igm 
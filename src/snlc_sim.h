@@ -29,6 +29,7 @@
 
 ********************************************/
 
+#include <pthread.h>  // Aug 2026: background SIMGEN_DUMP flush
 
 // ************ GLOBAL VARIABLES *************
 
@@ -49,6 +50,11 @@ time_t t_start, t_end, t_end_init ;
 #define  MXZRAN        10     // max randoms to store for z-smearing
 #define  MXPAR_SIMSED  30     // max number of SIMSED params
 
+// Aug 2026: safety margin (mag) for GENMAG_TRIAGE_DMAG option;
+// allows band max to be brighter than the mag at Trest=0
+// (e.g., NIR secondary max) before an epoch is triaged away.
+#define  MAGDIF_SAFETY_GENMAG_TRIAGE 1.0
+
 #define  MXREAD_SIMLIB 100000  // max number of SIMLIB observations/entries
 #define  MXOBS_SIMLIB  5000    // max number of observ. per simlib
 #define  MXOBS_SPECTROGRAPH 50 // max number of spectra per event
@@ -100,7 +106,9 @@ time_t t_start, t_end, t_end_init ;
 #define WRMASK_CIDRAN   16   // use random CID (1-MXCID)
 #define WRMASK_FITS     32   // write to fits file instead of ascii
 #define WRMASK_COMPACT  64   // suppress non-essential PHOT output
+#define WRMASK_SPEC_COMPACT 128 // 1 row/spectrum, 16-bit FLAM (Aug 2026)
 #define WRMASK_FILTERS  256  // write filterTrans files (Aug 2016)
+#define WRMASK_FITS_GZ  512  // write gzip-compressed FITS files (Aug 2026)
 
 #define KEYSOURCE_FILE 1
 #define KEYSOURCE_ARG  2
@@ -121,6 +129,8 @@ int WRFLAG_CIDRAN    ;
 int WRFLAG_FITS      ; 
 int WRFLAG_FILTERS   ; // Aug 2016
 int WRFLAG_COMPACT   ; // Jan 2018
+int WRFLAG_SPEC_COMPACT ; // Aug 2026
+int WRFLAG_FITS_GZ   ; // Aug 2026: gzip-compressed FITS output
 
 #define SIMLIB_PSF_PIXEL_SIGMA   "PIXEL_SIGMA"        // default
 #define SIMLIB_PSF_ARCSEC_FWHM   "ARCSEC_FWHM"        // option
@@ -199,6 +209,7 @@ typedef struct {
   // copied from INPUTS
   int   NGENTOT ;           // copied from INPUTS.NGEN
   int   CIDOFF ;            // copied from INPUTS.CIDOFF
+  int   OPT_BINARY ;        // GENMODEL_MSKOPT&1 -> binary template cache (Aug 2026)
 
   // read from NON1A.LIST:
   int   LIST_INDEX[MXNON1A_TYPE];     // sparse list of valid indices
@@ -270,6 +281,11 @@ typedef struct {
   // max redshift wgt for generation in genz_hubble()
   double  ZGENWGT_MAX, ZGENMIN_STORE, ZGENMAX_STORE ;
 
+  // Aug 2026: inverse-CDF table so that genz_hubble draws are
+  // table lookups instead of rejection sampling.
+  int     ZCDF_NZBIN ;
+  double *ZCDF_Z_LIST, *ZCDF_CDF_LIST ;
+
   // predicted SN count
   double SEASON_COUNT ;     // nominal SN count per season
   double SEASON_FRAC ;      // fracion among RATEPARs (SN,PEC1A)
@@ -302,7 +318,18 @@ typedef struct {
 
 
 #define MXPEREVT_TAKE_SPECTRUM MXSPECTRA
-int     NPEREVT_TAKE_SPECTRUM ; 
+int     NPEREVT_TAKE_SPECTRUM ;
+
+// Aug 2026: cached Gaussian lambda-smear weights for GENSPEC_LAMSMEAR.
+// The resolution kernel depends only on the static spectrograph table
+// and the user NLAMSIGMA option, so the per-bin GaussIntegral calls
+// are done once at init instead of for every flux deposit per event.
+struct {
+  int      USEFLAG ;
+  int     *NBIN2_LIST ;  // half-width of smear window, per ilam
+  double **GINT_LIST ;   // weight per [ilam][ilam2-(ilam-NBIN2)]
+} GENSPEC_LAMSMEAR_TABLE ;
+
 typedef struct {
   float   EPOCH_RANGE[2];    // Trest or TOBS range, or MJD range
   float   MJD_STEP;          // MJD step if using MJD(MJDMIN:MJDMAX,STEP)
@@ -395,6 +422,9 @@ struct INPUTS {
   char **WORDLIST ;     // list of words read from input file
 
   int  TRACE_MAIN;            // debug to trace progress through main loop
+  int  OPT_SIMTIMER;          // T => per-stage timing table at end (Aug 2026)
+  int  CHECKPOINT_NEVT;       // write checkpoint every NEVT events (Aug 2026)
+  char RESTART_CHECKPOINT_FILE[MXPATHLEN]; // resume from this checkpoint
   int  DEBUG_FLAG ;           // arbitrary debug usage
 
   bool RESTORE_DES3YR;          // restore DES3YR bugs
@@ -507,6 +537,9 @@ struct INPUTS {
 
   int  NSUBSAMPLE_MARK ;    // mark independent sub-samples with index
 
+  int  NFORK_GEN ;          // number of forked generation processes
+                            // (0 or 1 => serial generation)
+
   char PATH_SNDATA_SIM[MXPATHLEN];
   char GENVERSION[200];      // output version
   char GENPREFIX[200];       // filename prefix (default=GENVERSION)
@@ -666,6 +699,7 @@ struct INPUTS {
   double RV_MWCOLORLAW ;          // Galactic RV (default=3.1)
   int    OPT_MWCOLORLAW ;        // 89(CCM89), 94(Odonnel), 99(Fitzpat)
   int    OPT_MWEBV ;             // option to modify MWEBV_SFD
+  int    MWDUST_CACHE_FLAG;      // 1 -> cache full SFD98 maps (Aug 2026)
   int    APPLYFLAG_MWEBV;        // flag to apply MWEBV analysis corrections
   char   STR_MWCOLORLAW[60] ;    // char-string for comments
   char   STR_MWEBV[60] ;         // char-string for comments
@@ -792,6 +826,10 @@ struct INPUTS {
   int   CUTWIN_SNRMAX_NFILT[MXCUTWIN_SNRMAX] ;      // Nfilt passing SNRMAX
   char  CUTWIN_SNRMAX_LOGIC[MXCUTWIN_SNRMAX][8];    // specify "N", AND or OR
   float CUTWIN_SNRMAX_TREST[MXCUTWIN_SNRMAX][2];    // rest-frame epoch window
+  // Aug 2026: FILTERS strings pre-parsed in prep_user_CUTWIN so
+  // gen_cutwin avoids per-event PARSE_FILTLIST calls
+  int   CUTWIN_SNRMAX_IFILTLIST[MXCUTWIN_SNRMAX][MXFILTINDX];
+  int   CUTWIN_SNRMAX_NFILTLIST[MXCUTWIN_SNRMAX];
 
   float CUTWIN_NEPOCH[2];  // [0]=>NOBS ; [1] -> SNRMIN
   int   CUTWIN_NOBSDIF[2]; // NOBS window after MJDDIF cut
@@ -810,11 +848,14 @@ struct INPUTS {
   char  CUTWIN_EPOCHS_FILTERS[MXFILTINDX]; // filters to use
   int   CUTWIN_EPOCHS_NFILT;  // number of filters for TIME_ABOVE cut
   int   CUTWIN_EPOCHS_IFILTLIST[MXFILTINDX];
+  bool  CUTWIN_EPOCHS_LFILT[MXFILTINDX]; // Aug 2026: per-ifilt_obs map
 
   // May 2018: define cuts on number of saturated epochs, by filter
   int   NCUTWIN_SATURATE;
   int   CUTWIN_SATURATE_NOBS[MXCUTWIN_SNRMAX][2];
   char  CUTWIN_SATURATE_FILTERS[MXCUTWIN_SNRMAX][MXFILTINDX];
+  int   CUTWIN_SATURATE_IFILTLIST[MXCUTWIN_SNRMAX][MXFILTINDX]; // Aug 2026
+  int   CUTWIN_SATURATE_NFILTLIST[MXCUTWIN_SNRMAX];
 
   int   NPE_PIXEL_SATURATE ; // override SIMLIB header value
   int   PHOTFLAG_SATURATE ;
@@ -825,6 +866,8 @@ struct INPUTS {
   int   NCUTWIN_NOSATURATE;
   int   CUTWIN_NOSATURATE_NOBS[MXCUTWIN_SNRMAX][2];
   char  CUTWIN_NOSATURATE_FILTERS[MXCUTWIN_SNRMAX][MXFILTINDX];
+  int   CUTWIN_NOSATURATE_IFILTLIST[MXCUTWIN_SNRMAX][MXFILTINDX]; // Aug 2026
+  int   CUTWIN_NOSATURATE_NFILTLIST[MXCUTWIN_SNRMAX];
 
   float EFFERR_STOPGEN ;  // abort when ERREFF is this small per 1000
 
@@ -862,6 +905,11 @@ struct INPUTS {
   // (to mimic fake overlays on DES images)
   float TGRIDSTEP_MODEL_INTERP;
 
+  // Aug 2026: skip full model-mag computation for epochs whose
+  // peak-mag bound is at least this many mag below the epoch's
+  // 5-sigma SIMLIB limiting mag (0 => off). See set_genmag_triage.
+  float GENMAG_TRIAGE_DMAG;
+
   char NONLINEARITY_FILE[MXPATHLEN];
 
   // stuff for LCLIB model
@@ -1051,6 +1099,7 @@ struct GENLC {
 
   char  TELESCOPE[MXEPSIM][40];   // name of telescope
   char  FIELDNAME[MXEPSIM][MXCHAR_FIELDNAME] ;  // name of field for each obs
+  int   IFIELD_OVP[MXEPSIM] ;  // interned field index (Aug 2026)
   int   IFLAG_GENSOURCE ;     // specifies GENSOURCE
 
   // define scale factors that depend on user-input EXPOSURE_TIME
@@ -1157,6 +1206,13 @@ struct GENLC {
   bool OBSFLAG_PEAK[MXEPSIM] ;   // extra epochs with peak mags
   bool OBSFLAG_TEMPLATE[MXEPSIM]; // extra epochs that are templates
 
+  // Aug 2026: epochs flagged by set_genmag_triage as hopelessly below
+  // the SIMLIB detection limit; genmodel skips the model evaluation
+  // for these epochs and sets mag = MAG_ZEROFLUX (flux=0).
+  bool OBSFLAG_GENMAG_TRIAGE[MXEPSIM];
+  int  GENMAG_TRIAGE_VALID ;  // 1 => OBSFLAG_GENMAG_TRIAGE is loaded
+  int  NEP_GENMAG_TRIAGE ;    // number of flagged epochs, current event
+
   int IEPOCH_PEAK[MXFILTINDX] ; // artificial peak epoch vs.ifilt_obs
   int IEPOCH_SNRMAX_GLOBAL;       // global epoch with SNRMAX (Jun 2018)
   int IEPOCH_SNRMAX[MXFILTINDX] ; // idem vs. ifilt_obs
@@ -1242,6 +1298,10 @@ int NGENSPEC_TOT;            // total number of generated spectra
 int NGENSPEC_WRITE ;         // number of spectra written
 int NGENFLUX_DRIVER;         // number of calls to GENFLUX_DRIVER
 
+// Aug 2026: cumulative epoch counts for GENMAG_TRIAGE_DMAG option
+int NEPSKIP_GENMAG_TRIAGE ;  // epochs where model evaluation was skipped
+int NEPCHECK_GENMAG_TRIAGE ; // epochs examined by set_genmag_triage
+
 struct NGEN_REJECT {
   int GENRANGE, GENMAG;
   int GENPAR_SELECT_FILE ;
@@ -1251,13 +1311,50 @@ struct NGEN_REJECT {
   int NEPOCH ;   // counts NEPOCH < NEPOCH_MIN
 } NGEN_REJECT ;
 
+// Aug 2026: coarse redshift-binned acceptance monitor for trigger-
+// efficiency productions where most generated events are rejected.
+// End-of-sim table shows accept fraction per z bin so that strata
+// can be re-generated with NGENTOT scaled per stratum instead of
+// brute-force oversampling the full z range.
+#define NZBIN_ACCEPT_MONITOR 20
+struct {
+  double ZMIN, ZMAX, ZBIN ;            // from GENRANGE_REDSHIFT
+  int    NGEN[NZBIN_ACCEPT_MONITOR] ;  // generated in-range, per z bin
+  int    NACC[NZBIN_ACCEPT_MONITOR] ;  // written, per z bin
+} ACCEPT_MONITOR ;
+
+// Aug 2026: checkpoint/restart state for long productions.
+// CHECKPOINT_NEVT sim-input writes <GENVERSION>.CHECKPOINT every
+// NEVT events; RESTART_CHECKPOINT input resumes from that file by
+// burning the random streams forward and fseeking the SIMLIB to
+// the recorded position. TEXT format only (FITS cannot be re-opened
+// for append); the GSL Poisson stream is re-seeded, not restored.
+struct {
+  bool RESTART_FLAG ;        // true -> resuming from checkpoint
+  int  ILC_START ;           // first main-loop index after restart
+  char FILENAME[MXPATHLEN] ; // checkpoint file (set in init_simFiles)
+} SIMCHECKPOINT ;
+
+void wr_checkpoint(int ilc);
+void restart_from_checkpoint(void);
+
 
 // valid Z-range with defined rest-frame model for each obs-filter
 // (for README comment only)
-double ZVALID_FILTER[2][MXFILTINDX] ; 
+double ZVALID_FILTER[2][MXFILTINDX] ;
 int    NSKIP_FILTER[MXFILTINDX]; // number of times obs-filter is skipped
 int    NGEN_ALLSKIP ;
 
+// Aug 2026: per-filter valid redshift bounds precomputed in
+// init_ZVALID_GENFILT; gen_filtmap compares z against these instead
+// of re-doing the wavelength-overlap tests for every event.
+struct {
+  double ZMIN[MXFILTINDX] ;
+  double ZMAX[MXFILTINDX] ;
+} ZVALID_GENFILT ;
+
+void init_ZVALID_GENFILT(void);  // Aug 2026
+
 
 
   // define SIMLIB_DUMP struct vs. SIMLIB  entry
@@ -1290,6 +1387,18 @@ char SIMLIB_DUMPFILE_ROOT[MXPATHLEN];  // covert to root
 #define SIMLIB_DUMPMASK_SEQ   1  // one-row summary for each SEQUENCE (LIBID)
 #define SIMLIB_DUMPMASK_OBS   2  // one-row summary for each OBS
 
+// Aug 2026: binary sidecar cache of per-LIBID cadence stats so that
+// re-running SIMLIB_DUMP on an unchanged SIMLIB (e.g., after a cut
+// tweak) skips the full text read; see SIMLIB_DUMP_DRIVER.
+#define MAGIC_SIMLIB_DUMPCACHE    0x444D4C53   // 'SLMD'
+#define VERSION_SIMLIB_DUMPCACHE  1
+typedef struct {
+  int    LIBID ;
+  double RA, DEC, MWEBV ;
+  char   FIELDNAME[60] ;
+  SIMLIB_DUMP_DEF AVG1 ;   // cut-independent stats for this LIBID
+} SIMLIB_DUMPCACHE_RECORD_DEF ;
+
 #define TABLEID_SIMLIB_DUMP    7788 
 #define TABLENAME_SIMLIB_DUMP  "SIMLIB" 
 
@@ -1376,6 +1485,35 @@ struct SIMLIB_HEADER {
 } SIMLIB_HEADER ;
 
 
+// Aug 2026: byte-offset index over LIBIDs so that SIMLIB_findStart
+// can fseek to the start LIBID instead of scanning cadences from the
+// top of the file. Built on first use and cached in a <SIMLIB>.INDEX
+// sidecar file; disabled for gzipped SIMLIB where fseek cannot work.
+#define MAGIC_SIMLIB_INDEX       0x58444953  // "SIDX"
+#define VERSION_SIMLIB_INDEX     1
+#define MALLOCSIZE_SIMLIB_INDEX  20000       // realloc chunk size
+
+struct {
+  int        NLIBID ;   // number of LIBID keys found in SIMLIB
+  int       *LIBID ;    // LIBID value of each entry
+  long long *OFFSET ;   // byte offset of each "LIBID:" line
+} SIMLIB_INDEX ;
+
+
+// Aug 2026: cache of accepted MJD-sort indices from the last
+// SIMLIB_prepCadence call. For a repeated cadence (SIMLIB_NREPEAT)
+// whose MJD-keep window is unchanged, the prep loop walks only the
+// accepted obs and skips the per-obs cuts. Disabled when
+// SPECTROGRAPH obs are present because those are processed before
+// the cuts are applied.
+struct {
+  int    VALID ;
+  int    LIBID ;                    // LIBID the cache was built for
+  double MJDRANGE[2] ;              // keep-window the cache was built for
+  int    NKEEP ;                    // number of accepted obs
+  int    ISORT_KEEP[MXOBS_SIMLIB] ; // MJD-sort index of each accepted obs
+} SIMLIB_CADENCE_REUSE ;
+
 
 // Define SIMLIB  struct for reading
 // Allocate for writing/reading entire array.
@@ -1408,6 +1546,7 @@ typedef struct  {
 
   char    *PTR_FIELDNAME[MXOBS_SIMLIB];
   char    FIELDNAME[MXOBS_SIMLIB][MXCHAR_FIELDNAME];
+  int     IFIELD_OVP[MXOBS_SIMLIB]; // interned field index (Aug 2026)
   char    TELESCOPE[MXOBS_SIMLIB][40];
   int     APPEND_PHOTFLAG[MXOBS_SIMLIB];  // Jan 201
 
@@ -1522,12 +1661,60 @@ struct GENPERFECT {
 } GENPERFECT ;
 
 
+// Aug 2026: per-stage wall-time instrumentation for the main event
+// loop; enabled with sim-input key OPT_SIMTIMER: 1 and summarized
+// in simEnd(). Stages can nest (e.g., SIMLIB read inside GENEVENT),
+// so the column sums exceed total wall time.
+#define ITIMER_SIM_GENEVENT  0   // gen_event_driver (incl. SIMLIB read)
+#define ITIMER_SIM_SIMLIB    1   // SIMLIB_READ_DRIVER only
+#define ITIMER_SIM_GENMAG    2   // GENMAG_DRIVER
+#define ITIMER_SIM_GENSPEC   3   // GENSPEC_DRIVER
+#define ITIMER_SIM_GENFLUX   4   // GENFLUX_DRIVER
+#define ITIMER_SIM_TRIGGER   5   // gen_SEARCHEFF + LOAD_SEARCHEFF_DATA
+#define ITIMER_SIM_CUTWIN    6   // gen_cutwin
+#define ITIMER_SIM_OUTPUT    7   // update_simFiles
+#define NTIMER_SIM           8
+
+struct {
+  double    T_SUM[NTIMER_SIM] ;    // cumulative seconds per stage
+  double    T_START[NTIMER_SIM] ;  // time of last SIMTIMER_START
+  long long NCALL[NTIMER_SIM] ;    // number of START/STOP scopes
+} SIMTIMER ;
+
+void SIMTIMER_START(int itimer);
+void SIMTIMER_STOP(int itimer);
+void SIMTIMER_SUMMARY(void);
+
 int NEVT_SIMGEN_DUMP ; // NEVT written to SIMGEN_DUMP file
+int NLINE_WRITTEN_SIMGEN_DUMP ; // lines written; throttles fflush (Aug 2026)
 int NVAR_SIMGEN_DUMP ; // total define SIMGEN variables
                  // note that INPUTS.NVAR_SIMGEN_DUMP is how many user var
 int NVAR_SIMGEN_DUMP_GENONLY; // variables for generation only
 int INDEX_SIMGEN_DUMP[MXSIMGEN_DUMP]; // gives strucdt index vs. [user ivar]
 
+// Aug 2026: double-buffered SIMGEN_DUMP writer (see wr_SIMGEN_DUMP).
+// Rows are serialized into an in-memory buffer; when a buffer fills,
+// a background thread flushes it while generation fills the other.
+// The r8 output format per variable is resolved once at init.
+#define MXCHAR_BUF_SIMGEN_DUMP  0x40000  // 256 KB per buffer
+#define IFMT_SIMGEN_DUMP_DEFAULT 0  // %.5le
+#define IFMT_SIMGEN_DUMP_MJD     1  // %.3f
+#define IFMT_SIMGEN_DUMP_COORD   2  // %.6f  (RA,DEC)
+int IFMT_SIMGEN_DUMP[MXSIMGEN_DUMP] ;
+
+struct {
+  char     *BUF[2] ;        // double buffer
+  int       IBUF ;          // index of buffer being filled
+  int       LEN ;           // bytes used in active buffer
+  int       LEN_FLUSH ;     // bytes being flushed from other buffer
+  bool      THREAD_ACTIVE ; // background flush in progress
+  pthread_t THREAD ;
+  FILE     *FP ;            // same as SIMFILE_AUX->FP_DUMP
+} SIMGEN_DUMP_WRITER ;
+
+void *flush_SIMGEN_DUMP_BUFFER(void *arg);
+void  swap_SIMGEN_DUMP_BUFFER(SIMFILE_AUX_DEF *SIMFILE_AUX);
+
 struct SIMGEN_DUMP {
   float      *PTRVAL4 ;
   double     *PTRVAL8 ;
@@ -1610,6 +1797,9 @@ void   SIMLIB_readGlobalHeader_TEXT(void);
 void   SIMLIB_prepGlobalHeader(void);
 void   SIMLIB_prep_fluxerrScale_LEGACY(void);
 void   SIMLIB_findStart(void);
+void   SIMLIB_buildIndex(void);
+int    SIMLIB_readIndexFile(char *indexFile, long long SIMLIB_SIZE);
+void   SIMLIB_writeIndexFile(char *indexFile, long long SIMLIB_SIZE);
 
 void   SIMLIB_READ_DRIVER(void);
 void   SIMLIB_readNextCadence_TEXT(void);
@@ -1621,7 +1811,7 @@ void   SIMLIB_randomize_skyCoords(void);
 
 void   init_SIMLIB_HEADER(void);
 int    keep_SIMLIB_HEADER(void);
-int    keep_SIMLIB_OBS(int isort, int REPEAT);
+int    keep_SIMLIB_OBS(int isort, int REPEAT, double *MJDrange);
 
 void   SIMLIB_read_templateNoise(char *field, char *whatNoise); 
 void   SIMLIB_TAKE_SPECTRUM(void) ;
@@ -1646,6 +1836,7 @@ void   ABORT_SIMLIB_FILTER(int isort);
 //void   ABORT_SIMLIB_FILTER(int OPTLINE, double MJD, char *cfilt) ;
 
 int    IFIELD_OVP_SIMLIB(int OPT, char *FIELD) ;
+void   intern_IFIELD_OVP_SIMLIB(int NOBS_RAW) ;
 void   GENFILTERS_CHECK(void); 
 
 
@@ -1733,6 +1924,10 @@ void   compute_lightCurveWidths(void);
 void   prep_simpath(void);
 int    get_NON1A_MODELFLAG(char *GENVERSION) ;
 
+void   init_GENFORK(void);           // fork NFORK_GEN generation jobs
+void   prep_GENFORK_child(int ifork, int NGEN_FORK, char *GENVERSION_ORIG);
+void   merge_GENFORK(char *GENVERSION_ORIG); // merge per-fork FITS output
+
 void   genperfect_override(void);
 void   gen_event_driver(int ilc);    // generate RA, DEC, Z, PEAKMJD, etc.
 void   gen_event_reject(int *ILC, SIMFILE_AUX_DEF *SIMFILE_AUX,
@@ -1766,7 +1961,9 @@ void   genshift_risefalltimes(void);
 double gen_dLmag (double zCMB, double zHEL );
 void   gen_distanceMag(double zCMB, double zHEL, double *MU, double *lensDMU);
 
-double genz_hubble(double zmin, double zmax, RATEPAR_DEF *RATEPAR ); 
+double genz_hubble(double zmin, double zmax, RATEPAR_DEF *RATEPAR );
+void   init_zCDF_RATEPAR(double zmin, double zmax, RATEPAR_DEF *RATEPAR );
+double genz_zCDF(double ran, RATEPAR_DEF *RATEPAR );
 
 void   init_RATEPAR ( RATEPAR_DEF *RATEPAR ) ;
 void   set_RATEPAR(int ilc, INPUTS_NON1ASED_DEF *INP_NON1ASED ) ;
@@ -1782,6 +1979,10 @@ void end_simFiles(SIMFILE_AUX_DEF *SIMFILE_AUX);
 
 void update_accept_counters(void);
 
+void init_accept_monitor(void);
+void update_accept_monitor(int isAccept);
+void dump_accept_monitor(void);
+
 void    simEnd(SIMFILE_AUX_DEF *SIMFILE_AUX);
 double  gen_AV(void);          // generate AV from model
 
@@ -1794,6 +1995,7 @@ int    gen_TRIGGER_PEAKMAG_SPEC(void); // call GENMAG_DRIVER for peak only
 int    gen_TRIGGER_zHOST(void);        // evaluate zHOST trigger early
 
 void   GENMAG_DRIVER(void);    // driver to generate true mags
+void   set_genmag_triage(void); // flag epochs to skip (GENMAG_TRIAGE_DMAG)
 void   GENFLUX_DRIVER(void);   // driver to generate observed fluxes
 void   GENFLUX_DRIVER_LEGACY(void);   // driver to generate observed fluxes
 void   set_GENFLUX_FLAGS(int ep);
@@ -1817,8 +2019,9 @@ void   GENSPEC_HOST_CONTAMINATION(int imjd);
 void   GENSPEC_TEXPOSE_TAKE_SPECTRUM(int imjd);
 double GENSPEC_SMEAR(int imjd, double LAMMIN, double LAMMAX );
 void   GENSPEC_FLAM(int imjd);
-void   GENSPEC_LAMSMEAR(int imjd, int ilam, double GenFlux, 
+void   GENSPEC_LAMSMEAR(int imjd, int ilam, double GenFlux,
 			double GenFluxErr, double GenFluxErr_T );
+void   GENSPEC_LAMSMEAR_TABLE_INIT(void);
 void   GENSPEC_LAMOBS_RANGE(int INDX, double *LAMOBS_RANGE);
 double GENSPEC_PICKMJD(int OPT, int INDX, double z, 
 		       double *TOBS, double *TREST );
@@ -1926,6 +2129,12 @@ void SIMLIB_DUMP_openTable(int LDMP_MJD_TEXT,int LDMP_ROOT) ;
 void SIMLIB_DUMP_makeTable(int LDMP_MJD_TEXT,int LDMP_ROOT) ;
 void zero_SIMLIB_DUMP(SIMLIB_DUMP_DEF *SIMLIB_DUMP) ;
 void update_SIMLIB_DUMP_AVGALL(int OPT);
+void wr_SIMLIB_DUMP_SEQ_ROW(FILE *fp, int NROW, int ID, double RA,
+			    double DEC, char *FIELDNAME, double MWEBV);
+FILE *open_SIMLIB_DUMPCACHE_read(char *cacheFile);
+FILE *open_SIMLIB_DUMPCACHE_write(char *cacheFile, char *tmpFile);
+void  close_SIMLIB_DUMPCACHE_write(FILE *fp, char *tmpFile, char *cacheFile,
+				   int NLIBID, int COMPLETE);
 
 void MJDGAP(int N, double *MJDLIST,  double MJDGAP_IGNORE,
 	    double *GAPMAX, double *GAPAVG ) ;
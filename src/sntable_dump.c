@@ -45,7 +45,13 @@
 
    sntable_dump.exe <tableFile>  <tableName>  OBS
      (dump all observations, intended for fluxerrmap-analysis)
-  
+
+    sntable_dump.exe <tableFile> <tableName> -v <varNames> -cid <cidFile>
+       (dump only rows whose CID is listed in <cidFile>)
+
+    sntable_dump.exe <tableFile> <tableName> -v <varNames> -cut zHD 0.1 0.5
+       (dump only rows with 0.1 <= zHD <= 0.5; -cut can be repeated)
+
    If only the tableFile and tableName are given, then a list of
    each variable is given.  If an optional list of <varNames>
    is given, then the values are dumped (for each SN) into a 
@@ -112,6 +118,13 @@
  Mar 14 2021: for outlier output table, write string BAND before IFILTOBS.
               See OPT arg to load_DUMPLINE in sntools_output_hbook[root].c
 
+ Aug 2026: new row-filter options applied inside the read loop
+           (predicate pushdown; see DUMPFILTER in sntools_output.h):
+              -cid <file>             keep only CIDs listed in <file>
+              -cut <var> <min> <max>  keep rows with min <= var <= max
+           Cut variables are auto-appended to the -v list if missing.
+           TEXT tables now stream-dump (mmap scan) with flat memory.
+
 ********************************************/
 
 #include <stdio.h>
@@ -154,6 +167,12 @@ struct INPUTS {
   bool  SNTABLE_NEVT ;
 
   char  COMMENT_FLUXREF[40];
+
+  // Aug 2026: optional row filters (predicate pushdown)
+  char   CIDFILE_FILTER[200] ;  // file with list of CIDs to keep
+  int    NCUTWIN ;
+  char   CUTWIN_VARNAME[MXCUT_DUMPFILTER][60] ;
+  double CUTWIN_FILTER[MXCUT_DUMPFILTER][2] ;
 } INPUTS ;
 
 
@@ -202,7 +221,18 @@ int main(int argc, char **argv) {
 
   TABLEFILE_INIT();
 
-  if ( strlen(TID) == 0 ) { 
+  // Aug 2026: load optional row filters after TABLEFILE_INIT
+  // (which resets DUMPFILTER) and before the dump.
+  if ( strlen(INPUTS.CIDFILE_FILTER) > 0 )
+    { SNTABLE_DUMPFILTER_CIDFILE(INPUTS.CIDFILE_FILTER); }
+
+  for(ivar=0; ivar < INPUTS.NCUTWIN; ivar++ ) {
+    SNTABLE_DUMPFILTER_CUTWIN(INPUTS.CUTWIN_VARNAME[ivar],
+			      INPUTS.CUTWIN_FILTER[ivar][0],
+			      INPUTS.CUTWIN_FILTER[ivar][1] );
+  }
+
+  if ( strlen(TID) == 0 ) {
     // no table id/name -> print list of ntuples/trees, then abort.
     SNTABLE_LIST(TFILE); 
     goto DONE ;
@@ -281,7 +311,10 @@ void parse_args(int NARG, char **argv) {
 
   INPUTS.ISFORMAT_CSV = 0 ;
 
-  IFLAG_VARNAMES   =  0 ; 
+  INPUTS.CIDFILE_FILTER[0] = 0 ;   // Aug 2026
+  INPUTS.NCUTWIN           = 0 ;
+
+  IFLAG_VARNAMES   =  0 ;
 
   if ( NARG <= 1 ) {
     sprintf(msgerr1,"At least one argument required.") ;
@@ -379,7 +412,49 @@ void parse_args(int NARG, char **argv) {
 
     if ( strcmp(argv[i],"-V" ) == 0 )  { IFLAG_VARNAMES = 1; }
     if ( strcmp(argv[i],"-v" ) == 0 )  { IFLAG_VARNAMES = 1; }
-    
+
+    // Aug 2026: row-filter options (applied in read loop)
+    if ( keyMatch_dash(argv[i],"cid") ) {
+      IFLAG_VARNAMES = 0 ;
+      sprintf(INPUTS.CIDFILE_FILTER, "%s", argv[i+1] );
+    }
+
+    if ( keyMatch_dash(argv[i],"cut") ) {
+      IFLAG_VARNAMES = 0 ;
+      int NCUT = INPUTS.NCUTWIN ;
+      if ( NCUT >= MXCUT_DUMPFILTER ) {
+	sprintf(msgerr1,"NCUTWIN exceeds bound MXCUT_DUMPFILTER=%d",
+		MXCUT_DUMPFILTER ) ;
+	sprintf(msgerr2,"Check -cut arguments." );
+	errmsg(SEV_FATAL, 0, fnam, msgerr1, msgerr2 );
+      }
+      sscanf(argv[i+1], "%s",  INPUTS.CUTWIN_VARNAME[NCUT]   );
+      sscanf(argv[i+2], "%lf", &INPUTS.CUTWIN_FILTER[NCUT][0] );
+      sscanf(argv[i+3], "%lf", &INPUTS.CUTWIN_FILTER[NCUT][1] );
+      INPUTS.NCUTWIN++ ;
+    }
+
+  }
+
+  // Aug 2026: each cut variable must be on the dump-variable list
+  // so that its value is available in the read loop; append any
+  // cut variable that is missing.
+  int icut, FOUND ;
+  for(icut=0; icut < INPUTS.NCUTWIN; icut++ ) {
+    FOUND = 0 ;
+    for(i=0; i < INPUTS.NVAR; i++ ) {
+      if ( strcmp(INPUTS.VARNAMES[i],INPUTS.CUTWIN_VARNAME[icut]) == 0 )
+	{ FOUND = 1 ; }
+    }
+    if ( FOUND == 0 && INPUTS.NVAR > 0 && INPUTS.NVAR < MXVAR_DUMP ) {
+      printf("\t Append cut-variable %s to dump list.\n",
+	     INPUTS.CUTWIN_VARNAME[icut] ); fflush(stdout);
+      sprintf(INPUTS.VARNAMES[INPUTS.NVAR], "%s",
+	      INPUTS.CUTWIN_VARNAME[icut] );
+      sprintf(INPUTS.VARLIST,"%s %s",
+	      INPUTS.VARLIST, INPUTS.CUTWIN_VARNAME[icut] );
+      INPUTS.NVAR++ ;
+    }
   }
 
 
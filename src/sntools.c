@@ -5,6 +5,8 @@
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/wait.h>   // Aug 2026: for WAIT_NCORE_SPLIT
+#include <sys/mman.h>   // Aug 2026: for madvise in malloc_largeTable
 
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_sort.h>
@@ -551,7 +553,10 @@ void GaussRanCorr(CHOLESKY_DECOMP_DEF *DECOMP,
 
   for(irow0=0; irow0 < MATSIZE; irow0++ ) {
     GAURAN = 0.0 ;
-    for(irow1 = 0; irow1 < MATSIZE ; irow1++ ) {
+    // Aug 2026: CHOLESKY2D is triangular (see init_Cholesky);
+    // CHOLESKY2D[irow1][irow0]=0 for irow1 > irow0, so stop there
+    // and do half the multiplies.
+    for(irow1 = 0; irow1 <= irow0 ; irow1++ ) {
       tmpMat = DECOMP->CHOLESKY2D[irow1][irow0] ;
       tmpRan = RanList_noCorr[irow1];
       GAURAN += ( tmpMat * tmpRan) ;
@@ -1762,6 +1767,7 @@ void malloc_PARSE_WORDS(void) {
   int MXCHARWD  = MXCHARWORD_PARSE_WORDS ;
   int NWD       = PARSE_WORDS.NWD ;
   int iwd, WD0, WD1, BUFSIZE, IFLAG=0 ;
+  char *arena ;  // Aug 2026
   //  char fnam[] = "malloc_PARSE_WORDS" ;
 
   // ------------- BEGIN ----------------
@@ -1793,8 +1799,16 @@ void malloc_PARSE_WORDS(void) {
   }
 
   
+  // Aug 2026: carve the new word slots out of one arena block
+  // instead of one malloc per word; parsing a large input file
+  // previously cost one malloc for every stored word.  The arena
+  // is never freed (word store lives for the whole job), and each
+  // WDLIST entry keeps its full MXCHARWD capacity, so callers see
+  // no change.
+  arena = (char*) malloc( (size_t)(WD1-WD0) * MXCHARWD * sizeof(char) );
+
   for(iwd=WD0; iwd < WD1; iwd++ ) {
-    PARSE_WORDS.WDLIST[iwd]  = (char*) malloc( MXCHARWD*sizeof(char) );
+    PARSE_WORDS.WDLIST[iwd]    = arena + (size_t)(iwd-WD0) * MXCHARWD ;
     PARSE_WORDS.WDLIST[iwd][0] = 0 ;
   }
 
@@ -1832,6 +1846,32 @@ void get_PARSE_WORD(int langFlag, int iwd, char *word) {
   
 } // end get_PARSE_WORD
 
+char *get_PARSE_WORD_PTR(int iwd) {
+
+  // Created Aug 2026
+  // Return pointer to stored word iwd to avoid the string copy
+  // in get_PARSE_WORD; intended for C parsers reading many rows
+  // (e.g., OBS rows in text data files).
+  // Beware: returned pointer is into the internal word store, so
+  // it is valid only until the next store_PARSE_WORDS call, and
+  // caller must not modify the word.
+
+  int NWD = PARSE_WORDS.NWD ;
+  char *word ;
+  char fnam[] = "get_PARSE_WORD_PTR" ;
+
+  if ( iwd >= NWD ) {
+    sprintf(c1err,"iwd=%d exceeds NWD_STORE=%d", iwd, NWD);
+    sprintf(c2err,"Check '%s' ", PARSE_WORDS.FILENAME);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  word = PARSE_WORDS.WDLIST[iwd] ;
+  trim_blank_spaces(word);   // remove <CR> (in place; idempotent)
+  return word ;
+
+} // end get_PARSE_WORD_PTR
+
 void get_PARSE_WORD_INT(int langFlag, int iwd, int *i_val) {
   char word[100];   get_PARSE_WORD(langFlag, iwd, word);
   sscanf(word, "%d", i_val);
@@ -2144,10 +2184,68 @@ bool correct_sign_vpec_data(char *snana_version_data) {
 
 } // end correct_sign_vpec_data
 
-bool correct_sign_vpec_data__(char *snana_version_data) 
+bool correct_sign_vpec_data__(char *snana_version_data)
 { return correct_sign_vpec_data(snana_version_data); }
 
 
+// =====================================================
+//  multi-core event loop via fork (Aug 2026)
+// =====================================================
+
+int NCHILD_NCORE_SPLIT = 0 ;  // set in parent by FORK_NCORE_SPLIT
+
+int FORK_NCORE_SPLIT(int ncore) {
+
+  // Created Aug 2026
+  // Fork (ncore-1) child processes so that one job invocation uses
+  // ncore cores for the event loop; see NCORE_SPLIT namelist key.
+  // Returns split index: 1 for the parent, 2 to ncore for children.
+  // Each process sets JOBSPLIT = isplit,ncore so the existing
+  // split-job machinery partitions the events. Separate processes
+  // keep the non-reentrant MINUIT common blocks private per worker.
+
+  int i ;
+  pid_t pid ;
+  char fnam[] = "FORK_NCORE_SPLIT" ;
+
+  // ----------- BEGIN -----------
+
+  NCHILD_NCORE_SPLIT = 0 ;
+
+  for ( i = 2; i <= ncore; i++ ) {
+    pid = fork();
+
+    if ( pid < 0 ) {
+      sprintf(c1err,"fork failed for split job %d of %d", i, ncore );
+      sprintf(c2err,"Check NCORE_SPLIT namelist input.");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    if ( pid == 0 ) { return(i); }   // child processes split i
+
+    NCHILD_NCORE_SPLIT++ ;
+  }
+
+  return(1);  // parent processes split 1
+
+} // end FORK_NCORE_SPLIT
+
+
+void WAIT_NCORE_SPLIT(void) {
+
+  // wait for children forked in FORK_NCORE_SPLIT;
+  // no-op in the children (NCHILD=0 there).
+
+  int i, status ;
+  for ( i=0; i < NCHILD_NCORE_SPLIT; i++ )  { wait(&status); }
+  return ;
+
+} // end WAIT_NCORE_SPLIT
+
+int  fork_ncore_split__(int *ncore) { return FORK_NCORE_SPLIT(*ncore); }
+void wait_ncore_split__(void)       { WAIT_NCORE_SPLIT(); }
+
+
 void INIT_SNANA_DUMP(char *STRING) {
 
   // Created Sep 21 2017
@@ -3465,6 +3563,46 @@ void invertmatrix_(int *N, int *n, double *Matrix ) {
 }
 
 
+void invertMatrix_cholesky(int N, int n, double *Matrix ) {
+
+  // Created Aug 2026
+  // Same convention as invertMatrix, but for symmetric
+  // positive-definite input (e.g., covariance matrix):
+  // factorize with Cholesky and invert from the triangular
+  // factor. More stable than the generic LU inverse when the
+  // input is nearly singular.
+
+  int i1, i2, J ;
+
+  // -------------- BEGIN ---------------
+  gsl_matrix * m = gsl_matrix_alloc (n, n);
+
+  J = 0;
+  for ( i1=0; i1 < N; i1++ ) {
+    for ( i2=0; i2 < N; i2++ ) {
+      if ( i1 < n && i2 < n )
+	{ gsl_matrix_set(m,i1,i2, Matrix[J] ); }
+      J++ ;
+    }
+  }
+
+  gsl_linalg_cholesky_decomp (m);
+  gsl_linalg_cholesky_invert (m);   // in-place inverse
+
+  J = 0;
+  for ( i1=0; i1 < N; i1++ ) {
+    for ( i2=0; i2 < N; i2++ ) {
+      if ( i1 < n && i2 < n )
+	{ Matrix[J] = gsl_matrix_get(m,i1,i2) ; }
+      J++ ;
+    }
+  }
+
+  gsl_matrix_free(m) ;
+
+}  // end of invertMatrix_cholesky
+
+
 void sortDouble(int NSORT, double *ARRAY, int ORDER, 
 		int *INDEX_SORT) {
 
@@ -5080,6 +5218,55 @@ double get_simeffmap__(int *OPTMASK, int *NVAR, double *GRIDVALS) {
   return get_SIMEFFMAP(*OPTMASK, *NVAR, GRIDVALS);
 }
 
+// ===========================================
+void *malloc_largeTable(size_t MEMTOT) {
+
+  // Created Aug 2026
+  // malloc for large (many-MB) read-only lookup tables such as the
+  // SEDMODEL flux-integral table and the sorted HOSTLIB columns.
+  // If environment variable SNANA_MALLOC_HUGEPAGE is set, the block
+  // is aligned to a 2MB boundary and flagged with
+  // madvise(MADV_HUGEPAGE) so the kernel can back it with
+  // transparent huge pages, cutting TLB misses when the tables
+  // reach multi-GB sizes. NUMA interleaving across sockets would
+  // require libnuma, so memory placement beyond the kernel's
+  // first-touch policy is left to numactl at the job level.
+  //
+  // Falls back to plain malloc if the option is off, the request is
+  // below SIZEMIN_MALLOC_HUGEPAGE, or the aligned alloc fails.
+
+  void *ptr = NULL ;
+  static int USE_HUGEPAGE = -9 ;
+  char fnam[] = "malloc_largeTable" ;
+
+  // --------------- BEGIN ---------------
+
+  if ( USE_HUGEPAGE < 0 ) {
+    USE_HUGEPAGE = ( getenv("SNANA_MALLOC_HUGEPAGE") != NULL ) ;
+    if ( USE_HUGEPAGE ) {
+      printf("   %s: SNANA_MALLOC_HUGEPAGE is set -> "
+	     "request huge pages for large tables.\n", fnam );
+      fflush(stdout);
+    }
+  }
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  if ( USE_HUGEPAGE && MEMTOT >= (size_t)SIZEMIN_MALLOC_HUGEPAGE ) {
+    size_t ALIGN = (size_t)2*1024*1024 ; // 2MB huge-page boundary
+    if ( posix_memalign(&ptr, ALIGN, MEMTOT) != 0 ) { ptr = NULL ; }
+    if ( ptr != NULL ) {
+      madvise(ptr, MEMTOT, MADV_HUGEPAGE);
+      return ptr ;
+    }
+  }
+#endif
+
+  ptr = malloc(MEMTOT);
+  return ptr ;
+
+} // end malloc_largeTable
+
+
 // ===========================================
 void malloc_SIMEFFMAP(int flag) {
 
@@ -5888,6 +6075,9 @@ void read_GRIDMAP(FILE *fp, char *MAPNAME, char *KEY_ROW, char *KEY_STOP,
   // Apr 12 2019: abort if 10 or more rows read without valid key
   // Jun 12 2020: pass MAPNAME as input arg.
   // Mar 27 2021: fix MSKOPT to allow comments with commas
+  // Aug 2026: optional binary side-cache keyed by size+mtime of the
+  //           source map file; enabled per-map when caller sets
+  //           GRIDMAP_CACHE.SOURCE_FILE via set_GRIDMAP_CACHE_SOURCE.
 
   int   READ_NEXTLINE = 1 ;
   int   NROW_READ     = 0 ;
@@ -5912,10 +6102,54 @@ void read_GRIDMAP(FILE *fp, char *MAPNAME, char *KEY_ROW, char *KEY_STOP,
   int   ivar, NWD, ISKEY_ROW, EXTRA_WORD_OK ;
   int   LDIF1, LDIF2, ivar2, NROW_SKIP=0 ;
   char  LINE[200], word[40] ;
+
+  bool USE_CACHE = ( strlen(GRIDMAP_CACHE.SOURCE_FILE) > 0 );
+  char mapFile_cache[MXPATHLEN], binFile_cache[MXPATHLEN];
+
   char fnam[] = "read_GRIDMAP" ;
- 
+
   // ----------- BEGIN -------------
 
+  // Aug 2026: check binary side-cache; on valid cache, load the
+  // GRIDMAP image and just skip past the map rows in the text file.
+  if ( USE_CACHE ) {
+    sprintf(mapFile_cache, "%s", GRIDMAP_CACHE.SOURCE_FILE);
+    GRIDMAP_CACHE.SOURCE_FILE[0] = 0 ;  // consume one-shot hook
+    sprintf(binFile_cache, "%s_GRIDMAP%3.3d.%s",
+	    mapFile_cache, IDMAP, SUFFIX_GRIDMAP_CACHE );
+
+    if ( rd_gridmap_cache(binFile_cache, mapFile_cache, IDMAP, NDIM, NFUN,
+			  OPT_EXTRAP, GRIDMAP_LOAD) ) {
+
+      // skip past map rows so that caller keeps reading after KEY_STOP,
+      // using the same stop logic as the parsing loop below.
+      NROW_READ = 0 ;
+      while ( READ_NEXTLINE ) {
+	LINE[0] = 0 ;
+	if ( fgets(LINE,200,fp) == NULL ) { break; }
+	NWD = sscanf(LINE, "%39s", word);
+	if ( NWD <= 0 || commentchar(word) ) {
+	  if ( NROW_READ > 0 ) { READ_NEXTLINE = 0; }
+	  continue ;
+	}
+	if ( strcmp(word,KEY_ROW) ==0 ) { NROW_READ++ ; }
+	if ( strcmp(word,KEY_STOP)==0 ) { READ_NEXTLINE = 0; }
+      }
+
+      if ( NROW_READ != GRIDMAP_LOAD->NROW ) {
+	sprintf(c1err,"Skipped %d map rows, but cache has NROW=%d",
+		NROW_READ, GRIDMAP_LOAD->NROW );
+	sprintf(c2err,"Remove stale cache file %s", binFile_cache);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ;
+      }
+
+      printf("    Load GRIDMAP-%3.3d '%s(%s)'  NROW=%d  (binary cache)\n",
+	     IDMAP, MAPNAME, GRIDMAP_LOAD->VARLIST, NROW_READ);
+      fflush(stdout);
+      return ;
+    }
+  }
+
   // create generic MAPNAME using row key and IDMAP
 
   // allocate arrays to monitor uniform binning.
@@ -6050,10 +6284,192 @@ void read_GRIDMAP(FILE *fp, char *MAPNAME, char *KEY_ROW, char *KEY_STOP,
   for(ivar=0; ivar < NVARTOT; ivar++ )  { free(TMPMAP2D[ivar]); }
   free(TMPMAP2D);
   free(TMPVAL); free(TMPVAL_LAST); free(DIFVAL_LAST);
+
+  // Aug 2026: write binary side-cache for next job (silent no-op
+  // if the directory holding the map file is not writeable).
+  if ( USE_CACHE )
+    { wr_gridmap_cache(binFile_cache, mapFile_cache, GRIDMAP_LOAD); }
+
   return ;
 
 } // end read_GRIDMAP
 
+// ==============================================================
+void set_GRIDMAP_CACHE_SOURCE(char *mapFile) {
+
+  // Created Aug 2026
+  // Enable binary side-cache for the next read_GRIDMAP call by
+  // storing full path of the text map file about to be parsed;
+  // read_GRIDMAP consumes (clears) the hook, so call this before
+  // each map when a file holds several maps.
+
+  sprintf(GRIDMAP_CACHE.SOURCE_FILE, "%s", mapFile);
+
+} // end set_GRIDMAP_CACHE_SOURCE
+
+
+// ==============================================================
+bool rd_gridmap_cache(char *cacheFile, char *mapFile, int IDMAP, int NDIM,
+		      int NFUN, int OPT_EXTRAP, GRIDMAP *GRIDMAP_LOAD ) {
+
+  // Created Aug 2026
+  // Try to load GRIDMAP_LOAD from binary cache file written by
+  // wr_gridmap_cache. Cache is valid only if its stored key
+  // (size+mtime of mapFile) matches the current map file, and if
+  // IDMAP/NDIM/NFUN/OPT_EXTRAP match the requested map.
+  // Function returns true on success; false means caller must
+  // parse the text map as usual. Never aborts: any problem with
+  // the cache file is just a cache miss.
+
+  struct stat statbuf ;
+  FILE *fc ;
+  int  HEAD_I4[7], NROW, idim, ifun, NRD ;
+  long long FILE_SIZE, FILE_MTIME ;
+  int  I4  = sizeof(int);
+  int  I8  = sizeof(double);
+  int  I8p = sizeof(double*);
+  //  char fnam[] = "rd_gridmap_cache" ;
+
+  // ----------- BEGIN -------------
+
+  if ( stat(mapFile, &statbuf) != 0 ) { return false ; }
+
+  fc = fopen(cacheFile, "rb");
+  if ( !fc ) { return false ; }
+
+  // header: MAGIC, VERSION, IDMAP, NDIM, NFUN, OPT_EXTRAP, NROW
+  NRD = fread(HEAD_I4, I4, 7, fc);
+  if ( NRD != 7
+       || HEAD_I4[0] != MAGIC_GRIDMAP_CACHE
+       || HEAD_I4[1] != VERSION_GRIDMAP_CACHE
+       || HEAD_I4[2] != IDMAP
+       || HEAD_I4[3] != NDIM
+       || HEAD_I4[4] != NFUN
+       || HEAD_I4[5] != OPT_EXTRAP )
+    { fclose(fc); return false ; }
+  NROW = HEAD_I4[6];
+
+  // key: size+mtime of source map file when cache was written
+  NRD  = fread(&FILE_SIZE,  sizeof(long long), 1, fc);
+  NRD += fread(&FILE_MTIME, sizeof(long long), 1, fc);
+  if ( NRD != 2
+       || FILE_SIZE  != (long long)statbuf.st_size
+       || FILE_MTIME != (long long)statbuf.st_mtime )
+    { fclose(fc); return false ; }
+
+  // malloc GRIDMAP arrays exactly as in init_interp_GRIDMAP
+  GRIDMAP_LOAD->NBIN   = (int    *)malloc(I4*NDIM+I4);
+  GRIDMAP_LOAD->VALMIN = (double *)malloc(I8*NDIM+I8);
+  GRIDMAP_LOAD->VALMAX = (double *)malloc(I8*NDIM+I8);
+  GRIDMAP_LOAD->VALBIN = (double *)malloc(I8*NDIM+I8);
+  GRIDMAP_LOAD->RANGE  = (double *)malloc(I8*NDIM+I8);
+  GRIDMAP_LOAD->FUNVAL = (double**)malloc(I8p*NFUN);
+  GRIDMAP_LOAD->FUNMIN = (double *)malloc(I8*NFUN);
+  GRIDMAP_LOAD->FUNMAX = (double *)malloc(I8*NFUN);
+  GRIDMAP_LOAD->INVMAP = (int    *)malloc(I4*NROW+I4);
+  for(ifun=0; ifun < NFUN; ifun++ )
+    { GRIDMAP_LOAD->FUNVAL[ifun] = (double *)malloc(I8*NROW); }
+
+  NRD  = fread(GRIDMAP_LOAD->NBIN,   I4, NDIM, fc);
+  NRD += fread(GRIDMAP_LOAD->VALMIN, I8, NDIM, fc);
+  NRD += fread(GRIDMAP_LOAD->VALMAX, I8, NDIM, fc);
+  NRD += fread(GRIDMAP_LOAD->VALBIN, I8, NDIM, fc);
+  NRD += fread(GRIDMAP_LOAD->RANGE,  I8, NDIM, fc);
+  NRD += fread(GRIDMAP_LOAD->FUNMIN, I8, NFUN, fc);
+  NRD += fread(GRIDMAP_LOAD->FUNMAX, I8, NFUN, fc);
+  NRD += fread(GRIDMAP_LOAD->INVMAP, I4, NROW, fc);
+  for(ifun=0; ifun < NFUN; ifun++ )
+    { NRD += fread(GRIDMAP_LOAD->FUNVAL[ifun], I8, NROW, fc); }
+  fclose(fc);
+
+  if ( NRD != 5*NDIM + 2*NFUN + NROW*(1+NFUN) ) {
+    // truncated cache file; free arrays and fall back to text parse
+    free(GRIDMAP_LOAD->NBIN);   free(GRIDMAP_LOAD->VALMIN);
+    free(GRIDMAP_LOAD->VALMAX); free(GRIDMAP_LOAD->VALBIN);
+    free(GRIDMAP_LOAD->RANGE);  free(GRIDMAP_LOAD->FUNMIN);
+    free(GRIDMAP_LOAD->FUNMAX); free(GRIDMAP_LOAD->INVMAP);
+    for(ifun=0; ifun < NFUN; ifun++ ) { free(GRIDMAP_LOAD->FUNVAL[ifun]); }
+    free(GRIDMAP_LOAD->FUNVAL);
+    return false ;
+  }
+
+  GRIDMAP_LOAD->ID         = IDMAP ;
+  GRIDMAP_LOAD->NDIM       = NDIM ;
+  GRIDMAP_LOAD->NFUN       = NFUN ;
+  GRIDMAP_LOAD->NROW       = NROW ;
+  GRIDMAP_LOAD->OPT_EXTRAP = OPT_EXTRAP ;
+
+  // register multi-D index mapping used by interp_GRIDMAP
+  init_1DINDEX(IDMAP, NDIM, GRIDMAP_LOAD->NBIN);
+
+  return true ;
+
+} // end rd_gridmap_cache
+
+
+// ==============================================================
+void wr_gridmap_cache(char *cacheFile, char *mapFile,
+		      GRIDMAP *GRIDMAP_LOAD ) {
+
+  // Created Aug 2026
+  // Serialize GRIDMAP_LOAD to binary cacheFile, keyed by size+mtime
+  // of source text file mapFile; see rd_gridmap_cache for layout.
+  // Silently does nothing if cacheFile cannot be created (e.g.,
+  // map file lives in a read-only area).
+
+  struct stat statbuf ;
+  FILE *fc ;
+  int  HEAD_I4[7], NDIM, NFUN, NROW, ifun ;
+  long long FILE_SIZE, FILE_MTIME ;
+  int  I4  = sizeof(int);
+  int  I8  = sizeof(double);
+  //  char fnam[] = "wr_gridmap_cache" ;
+
+  // ----------- BEGIN -------------
+
+  if ( stat(mapFile, &statbuf) != 0 ) { return ; }
+
+  fc = fopen(cacheFile, "wb");
+  if ( !fc ) { return ; }
+
+  NDIM = GRIDMAP_LOAD->NDIM ;
+  NFUN = GRIDMAP_LOAD->NFUN ;
+  NROW = GRIDMAP_LOAD->NROW ;
+
+  HEAD_I4[0] = MAGIC_GRIDMAP_CACHE ;
+  HEAD_I4[1] = VERSION_GRIDMAP_CACHE ;
+  HEAD_I4[2] = GRIDMAP_LOAD->ID ;
+  HEAD_I4[3] = NDIM ;
+  HEAD_I4[4] = NFUN ;
+  HEAD_I4[5] = GRIDMAP_LOAD->OPT_EXTRAP ;
+  HEAD_I4[6] = NROW ;
+  FILE_SIZE  = (long long)statbuf.st_size ;
+  FILE_MTIME = (long long)statbuf.st_mtime ;
+
+  fwrite(HEAD_I4, I4, 7, fc);
+  fwrite(&FILE_SIZE,  sizeof(long long), 1, fc);
+  fwrite(&FILE_MTIME, sizeof(long long), 1, fc);
+
+  fwrite(GRIDMAP_LOAD->NBIN,   I4, NDIM, fc);
+  fwrite(GRIDMAP_LOAD->VALMIN, I8, NDIM, fc);
+  fwrite(GRIDMAP_LOAD->VALMAX, I8, NDIM, fc);
+  fwrite(GRIDMAP_LOAD->VALBIN, I8, NDIM, fc);
+  fwrite(GRIDMAP_LOAD->RANGE,  I8, NDIM, fc);
+  fwrite(GRIDMAP_LOAD->FUNMIN, I8, NFUN, fc);
+  fwrite(GRIDMAP_LOAD->FUNMAX, I8, NFUN, fc);
+  fwrite(GRIDMAP_LOAD->INVMAP, I4, NROW, fc);
+  for(ifun=0; ifun < NFUN; ifun++ )
+    { fwrite(GRIDMAP_LOAD->FUNVAL[ifun], I8, NROW, fc); }
+
+  fclose(fc);
+
+  printf("\t Wrote binary cache for GRIDMAP-%3.3d: %s\n",
+	 GRIDMAP_LOAD->ID, cacheFile); fflush(stdout);
+
+  return ;
+
+} // end wr_gridmap_cache
+
 // ==============================================================
 void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE, 
 			 int NDIM, int NFUN, int OPT_EXTRAP,
@@ -6230,6 +6646,12 @@ void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE,
 
 
 int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
+  // legacy interface: no cell hint (Aug 2026; see interp_GRIDMAP_HINT)
+  return interp_GRIDMAP_HINT(gridmap, data, interpFun, NULL);
+}
+
+int interp_GRIDMAP_HINT(GRIDMAP *gridmap, double *data, double *interpFun,
+			GRIDMAP_HINT_DEF *hint ) {
 
   // Created Jul 3, 2011
   // Do multi-dimensional interpolation.
@@ -6255,8 +6677,15 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
   //  + return SUCCESS or ERROR instead of hard-coded values.
   //
   // Mar 15 2020: allow numerical glitches in TMPMIN and TMPMAX
+  //
+  // Aug 2026: renamed interp_GRIDMAP -> interp_GRIDMAP_HINT with
+  // optional caller-owned *hint (NULL -> legacy behavior). If the
+  // central grid cell matches the previous call, the per-corner
+  // get_1DINDEX translation is skipped; consecutive events usually
+  // land in the same cell. All state is local or caller-owned, so
+  // this entry is safe to call from threads.
 
-  int 
+  int
     ivar, ifun, NFUN, NVAR, ID, igrid, MSK, NBIN, OPT_EXTRAP
     ,NCORNERS, icorner, igrid_tmp, igrid_1D, g
     ,igrid_cell[100], igrid_var[100], IGRID_VAR[100]
@@ -6271,8 +6700,9 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
   double EPSILON = 1.0E-8 ;
 
   int  LDMP=0 ;
+  int  USE_HINT, STORE_HINT ;
   bool outside_bound, too_lo, too_hi ;
-  char fnam[] = "interp_GRIDMAP" ;
+  char fnam[] = "interp_GRIDMAP_HINT" ;
 
   // ---------- BEGIN ------------
 
@@ -6362,6 +6792,16 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
   } // ivar
 
 
+  // Aug 2026: check caller-owned hint; if the central cell is the
+  // same as in the previous call, reuse the 1D corner indices below.
+  STORE_HINT = ( hint != NULL && NVAR <= MXVAR_GRIDMAP_HINT );
+  USE_HINT   = ( STORE_HINT && hint->VALID && hint->ID == ID );
+  if ( USE_HINT ) {
+    for ( ivar=0; ivar < NVAR; ivar++ ) {
+      if ( hint->IGRID_VAR[ivar] != IGRID_VAR[ivar] ) { USE_HINT = 0; }
+    }
+  }
+
   // determine the grid points at the corners of the
   // NVAR-dimentional cell containing *galpar.
   // Then take weighted average of WGTMAP at each corner.
@@ -6392,8 +6832,9 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
       }
 
       // make sure that igrid_var is valid
+      // (already verified on the call that filled the hint)
       NBIN = gridmap->NBIN[ivar] ;   g = igrid_var[ivar];
-      if ( g < 0 || g >= NBIN  ) {
+      if ( !USE_HINT && ( g < 0 || g >= NBIN )  ) {
 	//	TMPVAL  = *(data+ivar-1) ;
 	TMPVAL  = data[ivar] ;
 	TMPMIN  = gridmap->VALMIN[ivar] ;
@@ -6401,12 +6842,12 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
 	sprintf(c1err,
 		"Invalid igrid_var[ivar=%d]=%d  (NBIN=%d  cell=%d icorner=%d)",
 		ivar, g, NBIN, igrid_cell[ivar], icorner ) ;
-	sprintf(c2err, "VAL=%f  VALMIN/MAX = %f / %f", 
+	sprintf(c2err, "VAL=%f  VALMIN/MAX = %f / %f",
 		TMPVAL, TMPMIN, TMPMAX);
-	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
       }
-      
-      if ( igrid_cell[ivar] ) 
+
+      if ( igrid_cell[ivar] )
 	{ CORNER_WGT *= GRIDFRAC[ivar] ; }
       else
 	{ CORNER_WGT *= (1.0 - GRIDFRAC[ivar]) ; }
@@ -6415,8 +6856,14 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
     CORNER_WGTSUM += CORNER_WGT ;
 
     // translate 1d indices for each variable into absolute lookup index
-    igrid_tmp    = get_1DINDEX( ID, NVAR, &igrid_var[0]);
-    igrid_1D     = gridmap->INVMAP[igrid_tmp] ;        
+    if ( USE_HINT ) {
+      igrid_1D   = hint->IGRID_1D[icorner] ;   // same cell as last call
+    }
+    else {
+      igrid_tmp  = get_1DINDEX( ID, NVAR, &igrid_var[0]);
+      igrid_1D   = gridmap->INVMAP[igrid_tmp] ;
+      if ( STORE_HINT ) { hint->IGRID_1D[icorner] = igrid_1D ; }
+    }
 
     for  ( ifun=0; ifun < NFUN; ifun++ )   {  
       FUNVAL[ifun]       = gridmap->FUNVAL[ifun][igrid_1D];
@@ -6431,6 +6878,14 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
     
   } // corner
 
+  // remember this cell for the next call
+  if ( STORE_HINT && !USE_HINT ) {
+    for ( ivar=0; ivar < NVAR; ivar++ )
+      { hint->IGRID_VAR[ivar] = IGRID_VAR[ivar] ; }
+    hint->ID    = ID ;
+    hint->VALID = 1 ;
+  }
+
   if ( CORNER_WGTSUM <= 0.0 ) {
     sprintf(c1err,"Could not compute CORNER_WGT for gridmap ID=%d", 
 	    gridmap->ID );
@@ -6455,7 +6910,7 @@ int interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun ) {
 
   return(SUCCESS) ;
 
-} // end of interp_GRIDMAP
+} // end of interp_GRIDMAP_HINT
 
 
 // ================================================
@@ -7080,7 +7535,9 @@ void init_random_seed(int ISEED, int NSTREAM) {
   // NSTREAM = 2 -> two independent streams, use srandom_r
 
   GENRAN_INFO.NSTREAM = NSTREAM ;
+  GENRAN_INFO.ISEED   = ISEED ;  // Aug 2026: for counter-based streams
   int i ;
+  for(i=0; i < MXSTREAM_RAN; i++ ) { GENRAN_INFO.NCALL_STREAM[i] = 0; }
   int ISEED2 = ISEED * 7 + 137; // for 2nd stream, if requested
   int ISEED_LIST[MXSTREAM_RAN] = { ISEED, ISEED2 } ;
   char fnam[] = "init_random_seed" ;
@@ -7222,7 +7679,8 @@ double unix_random(int istream) {
   int JRAN ;
   char fnam[] = "unix_random";
   // ------------ BEGIN ----------------
-  if ( NSTREAM == 1 )  { 
+  GENRAN_INFO.NCALL_STREAM[istream]++ ; // for checkpoint/restart, Aug 2026
+  if ( NSTREAM == 1 )  {
     JRAN = random(); 
   }
   else {
@@ -7241,6 +7699,39 @@ double unix_random(int istream) {
 
 double unix_random__(int *istream) { return( unix_random(*istream) ); }
 
+// ***********************************
+void burn_random_stream(int istream, long long NCALL_TARGET) {
+
+  // Created Aug 2026
+  // Fast-forward random stream 'istream' by drawing (and discarding)
+  // randoms until the cumulative call count reaches NCALL_TARGET.
+  // Used on checkpoint-restart so that the resumed job sees the
+  // same random sequence as an uninterrupted run. Aborts if the
+  // stream is already past the target (wrong seed or wrong file).
+
+  long long NBURN, i ;
+  char fnam[] = "burn_random_stream" ;
+
+  // ------------ BEGIN ----------------
+
+  NBURN = NCALL_TARGET - GENRAN_INFO.NCALL_STREAM[istream] ;
+
+  if ( NBURN < 0 ) {
+    sprintf(c1err,"Stream %d already at NCALL=%lld, past target=%lld",
+	    istream, GENRAN_INFO.NCALL_STREAM[istream], NCALL_TARGET );
+    sprintf(c2err,"Check RANSEED and checkpoint file.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  printf("\t %s: burn %lld randoms from stream %d \n",
+	 fnam, NBURN, istream);  fflush(stdout);
+
+  for(i=0; i < NBURN; i++ )  { unix_random(istream); }
+
+  return ;
+
+} // end burn_random_stream
+
 // ***********************************
 double GaussRan(int ilist) {
   // return Gaussian random number using randoms from "ilist",
@@ -7293,6 +7784,120 @@ double GaussRanClip(int ilist, double ranGmin, double ranGmax ) {
 
 } // end GaussRanClip
 
+
+// ***********************************
+void GaussRan_FILL(int ilist, int N, double *ranList) {
+
+  // Created Aug 2026
+  // Batch-fill ranList with N Gaussian randoms from "ilist".
+  // Draws the identical sequence as N scalar GaussRan calls so that
+  // random-sync is preserved; lets per-event consumers fetch all of
+  // their Gaussians with one call.
+
+  int i;
+  for(i=0; i < N; i++ ) { ranList[i] = GaussRan(ilist); }
+  return ;
+
+} // end GaussRan_FILL
+
+// ***********************************
+void GaussRanClip_FILL(int ilist, double ranGmin, double ranGmax,
+		       int N, double *ranList) {
+
+  // Created Aug 2026
+  // Batch version of GaussRanClip; see GaussRan_FILL notes on sync.
+
+  int i;
+  for(i=0; i < N; i++ )
+    { ranList[i] = GaussRanClip(ilist, ranGmin, ranGmax); }
+  return ;
+
+} // end GaussRanClip_FILL
+
+
+// *********************************
+unsigned long long hash64_counter_RANSTREAM(unsigned long long x) {
+
+  // Created Aug 2026
+  // SplitMix64 finalizer (Vigna 2015): bijective 64-bit mix used
+  // by the counter-based random streams below.
+
+  x += 0x9E3779B97F4A7C15ULL ;
+  x  = ( x ^ (x >> 30) ) * 0xBF58476D1CE4E5B9ULL ;
+  x  = ( x ^ (x >> 27) ) * 0x94D049BB133111EBULL ;
+  return  x ^ (x >> 31) ;
+
+} // end hash64_counter_RANSTREAM
+
+// *********************************
+void init_counter_RANSTREAM(COUNTER_RANSTREAM_DEF *STREAM,
+			    long long CID, int purpose) {
+
+  // Created Aug 2026
+  // Init counter-based random stream keyed by (ISEED,CID,purpose).
+  // Unlike the sequential RANSTORE lists, event CID can be
+  // regenerated in isolation (no need to replay the full stream),
+  // and *STREAM is local to the caller so there is no contention
+  // among threads. 'purpose' is a caller-defined int so that
+  // independent draws for the same event never overlap.
+  //
+  // Requires prior call to init_random_seed to set GENRAN_INFO.ISEED.
+
+  unsigned long long KEY ;
+
+  // --------- BEGIN -----------
+
+  KEY  = (unsigned long long)GENRAN_INFO.ISEED ;
+  KEY  = hash64_counter_RANSTREAM( KEY ^ (unsigned long long)CID );
+  KEY  = hash64_counter_RANSTREAM( KEY ^ (unsigned long long)purpose );
+
+  STREAM->KEY     = KEY ;
+  STREAM->COUNTER = 0 ;
+
+  return ;
+
+} // end init_counter_RANSTREAM
+
+// *********************************
+double FlatRan1_counter(COUNTER_RANSTREAM_DEF *STREAM) {
+
+  // Created Aug 2026
+  // return 0 < random < 1 from counter-based *STREAM;
+  // draw 'n' depends only on (KEY,n), never on other streams.
+
+  unsigned long long r64 ;
+
+  r64 = hash64_counter_RANSTREAM( STREAM->KEY ^
+		  hash64_counter_RANSTREAM(STREAM->COUNTER) );
+  STREAM->COUNTER++ ;
+
+  // top 53 bits -> double; +0.5 guarantees 0 < r8 < 1
+  double r8 = ( (double)(r64 >> 11) + 0.5 ) / 9007199254740992.0 ; // 2^53
+  return r8 ;
+
+} // end FlatRan1_counter
+
+// *********************************
+double GaussRan_counter(COUNTER_RANSTREAM_DEF *STREAM) {
+
+  // Created Aug 2026
+  // return Gaussian random from counter-based *STREAM;
+  // same rejection method as GaussRan.
+
+  double R,  V1, V2, FAC, G ;
+  // --------------- BEGIN ----------------
+ BEGIN:
+  V1 = 2.0 * FlatRan1_counter(STREAM) - 1.0;
+  V2 = 2.0 * FlatRan1_counter(STREAM) - 1.0;
+  R  = V1*V1 + V2*V2 ;
+  if ( R >= 1.0 ) { goto BEGIN ; }
+  FAC = sqrt(-2.*log(R)/R) ;
+  G = V2 * FAC ;
+  return G ;
+
+} // end GaussRan_counter
+
+
 // *********************************
 double FlatRan1(int ilist) {
 
@@ -7481,6 +8086,78 @@ double interp_1dfun__(int *OPT, double *val, int *NBIN
   return interp_1DFUN(*OPT, *val, *NBIN, VAL_LIST, FUN_LIST, abort_comment);
 }
 
+
+// **************************************************************
+void interp_1DFUN_batch(
+		    int OPT           // (I) 1=linear (only option)
+		    ,int NVAL         // (I) number of interp points
+		    ,double *val_list // (I) sorted list of interp points
+		    ,int NBIN         // (I) number of function bins passed
+		    ,double *VAL_LIST // (I) list of grid values
+		    ,double *FUN_LIST // (I) list of function values
+		    ,char *abort_comment    // (I) comment in case of abort
+		    ,double *fun_list_out   // (O) interpolated function
+		    ) {
+
+  // Created Aug 2026
+  // Batch variant of interp_1DFUN for a sorted list of NVAL
+  // interp points. Instead of a binary search per point, the grid
+  // is walked once (O(NVAL+NBIN) total) and the interp loop is
+  // tight enough for the compiler to vectorize. Linear option only.
+
+  int    ibin, ival ;
+  double val, val0, val1, frac ;
+  char fnam[] = "interp_1DFUN_batch" ;
+
+  // ------------- BEGIN -----------------
+
+  if ( OPT != OPT_INTERP_LINEAR ) {
+    sprintf(c1err,"Invalid OPT=%d for '%s'", OPT, abort_comment);
+    sprintf(c2err,"Only OPT_INTERP_LINEAR is batched.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
+  if ( NBIN == 1 ) {
+    // same convention as interp_1DFUN
+    for ( ival=0; ival < NVAL; ival++ )
+      { fun_list_out[ival] = VAL_LIST[0] ; }
+    return ;
+  }
+
+  ibin = 0 ;
+
+  for ( ival=0; ival < NVAL; ival++ ) {
+    val = val_list[ival] ;
+
+    if ( ival > 0 && val < val_list[ival-1] ) {
+      sprintf(c1err,"val_list is not sorted "
+	      "(val_list[%d]=%le < val_list[%d]=%le)",
+	      ival, val, ival-1, val_list[ival-1] );
+      sprintf(c2err,"Check '%s'", abort_comment);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+    }
+
+    if ( val < VAL_LIST[0] || val > VAL_LIST[NBIN-1] ) {
+      sprintf(c1err,"val=%le outside grid range %le to %le",
+	      val, VAL_LIST[0], VAL_LIST[NBIN-1] );
+      sprintf(c2err,"Check '%s'", abort_comment);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+    }
+
+    // walk forward to bin containing val (never moves backward
+    // because val_list is sorted)
+    while ( ibin < NBIN-2 && VAL_LIST[ibin+1] < val ) { ibin++ ; }
+
+    val0 = VAL_LIST[ibin] ;
+    val1 = VAL_LIST[ibin+1] ;
+    frac = (val - val0)/(val1 - val0) ;
+    fun_list_out[ival] = FUN_LIST[ibin] + frac*(FUN_LIST[ibin+1]-FUN_LIST[ibin]);
+  }
+
+  return ;
+
+} // end of interp_1DFUN_batch
+
 // **************************************************************
 double quadInterp ( double VAL, double VAL_LIST[3], double FUN_LIST[3],
 		    char *abort_comment ) {
@@ -7856,6 +8533,83 @@ double modelflux_extrap(
 
 
 
+// ====================================================
+unsigned int hash_string(char *string) {
+
+  // Created Aug 2026
+  // djb2 string hash; used with HASH_STRING_DEF to match CIDs
+  // and other string lists without a linear scan per lookup.
+
+  unsigned int h = 5381 ;
+  char *p ;
+  for(p=string; *p != 0; p++ )  { h = h*33 + (unsigned int)(*p) ; }
+  return h ;
+
+} // end hash_string
+
+
+// ====================================================
+void build_HASH_STRING(HASH_STRING_DEF *HASH, int NWORD, char **WORDLIST) {
+
+  // Created Aug 2026
+  // Build open-address hash set over caller-owned WORDLIST so that
+  // index_HASH_STRING is O(1). WORDLIST is not copied and must
+  // out-live the hash; rebuilding frees the previous slot array.
+
+  int SIZE = 64 ;
+  int i, h, MEMI ;
+  //  char fnam[] = "build_HASH_STRING" ;
+
+  // ------- BEGIN -------------
+
+  if ( HASH->SIZE > 0 ) { free(HASH->INDEX); }
+  HASH->SIZE = 0 ;
+
+  if ( NWORD <= 0 ) { return ; }
+
+  while ( SIZE < 2*NWORD ) { SIZE *= 2 ; }
+  MEMI = SIZE * sizeof(int);
+  HASH->SIZE     = SIZE ;
+  HASH->INDEX    = (int*)malloc(MEMI);
+  HASH->WORDLIST = WORDLIST ;
+  for(h=0; h < SIZE; h++ ) { HASH->INDEX[h] = -9 ; }
+
+  for(i=0; i < NWORD; i++ ) {
+    h = (int)( hash_string(WORDLIST[i]) & (unsigned int)(SIZE-1) );
+    while ( HASH->INDEX[h] >= 0 ) { h++ ; if ( h == SIZE ) { h=0; } }
+    HASH->INDEX[h] = i ;
+  }
+
+  return ;
+
+} // end build_HASH_STRING
+
+
+// ====================================================
+int index_HASH_STRING(HASH_STRING_DEF *HASH, char *string) {
+
+  // Created Aug 2026
+  // Return WORDLIST index of string, or -9 if not in the hash.
+
+  int SIZE = HASH->SIZE ;
+  int i, h ;
+  //  char fnam[] = "index_HASH_STRING" ;
+
+  // ------- BEGIN -------------
+
+  if ( SIZE == 0 ) { return -9 ; }
+
+  h = (int)( hash_string(string) & (unsigned int)(SIZE-1) );
+  while ( (i = HASH->INDEX[h]) >= 0 ) {
+    if ( strcmp(string,HASH->WORDLIST[i]) == 0 ) { return i ; }
+    h++ ;  if ( h == SIZE ) { h = 0 ; }
+  }
+
+  return -9 ;
+
+} // end index_HASH_STRING
+
+
 // ====================================================
 int rd_sedFlux(
 	     char *sedFile         // (I) name of SED file to read
@@ -7931,6 +8685,9 @@ int rd_sedFlux(
     + abort if line length is too long (to avoid corruption)
     + abort if fewer than 3 words are read
 
+  Aug 2026:
+    + parse columns with strtod instead of splitString + sscanf;
+      this loop dominates init time for large SED libraries.
 
   **********/
 
@@ -7938,14 +8695,13 @@ int rd_sedFlux(
 
   char txterr[20], line[200], lastLine[200] ;
   //  char *ptrtok, s1[60], s2[60], s3[60], s4[60], tmpline[200] ;
-  char *ptrStringVal[MXWORDLINE_FLUX], StringVal[MXWORDLINE_FLUX][40];
-  char space[] = " ";
+  char *ptrVal, *ptrEnd ;   // Aug 2026: for strtod parsing
   char fnam[]  = "rd_sedFlux" ;
 
   double day, lam, day_last, lam_last, lam_expect, flux, fluxerr, XN ;
   double daystep_last, daystep, daystep_dif ;
   double lamstep_last, lamstep, lamstep_dif ;
-  int iep, ilam, iflux, ival, LAMFILLED, OKBOUND_LAM, OKBOUND_DAY, NBIN ;
+  int iep, ilam, iflux, LAMFILLED, OKBOUND_LAM, OKBOUND_DAY, NBIN ;
   int  NRDLINE, NRDWORD, GZIPFLAG, FIRST_NONZEROFLUX, NONZEROFLUX, LEN ;
   bool OPT_READ_FLUXERR, OPT_FIX_DAYSTEP;
 
@@ -7993,9 +8749,6 @@ int rd_sedFlux(
   daystep_last = daystep=-9.0;  day_last = -999999. ;
   lamstep_last = lamstep=-9.0;  lam_last = -999999. ;
 
-  for(ival=0; ival < MXWORDLINE_FLUX; ival++ ) 
-    { ptrStringVal[ival] = StringVal[ival];   }
-
   line[0] = lastLine[0] = 0 ;
 
   while ( fgets (line, MXCHARLINE_FLUX+10, fpsed ) != NULL  ) {
@@ -8017,12 +8770,16 @@ int rd_sedFlux(
     if ( strlen(line) <= 2 ) { continue ; }
     if ( commentchar(line) ) { continue ; }
 
-    //    splitString2(line, space, MXWORD_RDFLUX,  // input line is destroyed
-    //		 &NRDWORD, ptrStringVal ) ;  // returned
+    // Aug 2026: walk line with strtod instead of splitString + sscanf;
+    // each conversion advances ptrEnd past the parsed word.
+    NRDWORD = 0 ;  ptrVal = line ;
+    day  = strtod(ptrVal, &ptrEnd);
+    if ( ptrEnd > ptrVal ) { NRDWORD++ ; }   ptrVal = ptrEnd ;
+    lam  = strtod(ptrVal, &ptrEnd);
+    if ( ptrEnd > ptrVal ) { NRDWORD++ ; }   ptrVal = ptrEnd ;
+    flux = strtod(ptrVal, &ptrEnd);
+    if ( ptrEnd > ptrVal ) { NRDWORD++ ; }   ptrVal = ptrEnd ;
 
-    splitString(line, space, MXWORDLINE_FLUX, 
-		&NRDWORD, ptrStringVal ) ;  // returned
-   
     if ( NRDWORD < 3 ) {
       print_preAbort_banner(fnam);
       printf("   sedFile: %s \n", sedFile);
@@ -8033,13 +8790,11 @@ int rd_sedFlux(
       errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ;
     }
 
-    sscanf(StringVal[0], "%le" , &day  ) ;
-    sscanf(StringVal[1], "%le" , &lam  ) ;
-    sscanf(StringVal[2], "%le" , &flux ) ;
-
     sprintf(lastLine, "%s", line);
 
-    if ( OPT_READ_FLUXERR ) { 
+    if ( OPT_READ_FLUXERR ) {
+      fluxerr = strtod(ptrVal, &ptrEnd);
+      if ( ptrEnd > ptrVal ) { NRDWORD++ ; }
       if ( NRDWORD < 4 ) {
 	printf("   sedFile: %s \n", sedFile);
 	printf("   previous line: '%s' \n", lastLine);
@@ -8048,7 +8803,6 @@ int rd_sedFlux(
 	sprintf(c2err,"to read FLUXERR from 4th coloumn.");
 	errmsg(SEV_FATAL, 0, fnam, c1err, c2err ) ;
       }
-      sscanf(StringVal[3], "%le" , &fluxerr ) ;  
     }
 
     if ( day < DAYrange[0] ) { continue ; }
@@ -9739,6 +10493,16 @@ FILE *open_TEXTgz(char *FILENAME, const char *mode, int *GZIPFLAG ) {
     }
   }
 
+  // Aug 2026: for writing, a .gz file name opens a pipe to gzip so
+  // the output lands compressed; gzip runs as a separate process,
+  // so compression overlaps generation.
+  if ( strstr(mode,"w") != NULL && strstr(FILENAME,".gz") != NULL ) {
+    sprintf(cmd_zcat, "gzip -c > %s", FILENAME);
+    fp = popen(cmd_zcat,"w");
+    *GZIPFLAG = 1 ;
+    return(fp);
+  }
+
   // if we get here, do regular text open
   fp = fopen(FILENAME,mode);
   return(fp);
@@ -9746,6 +10510,24 @@ FILE *open_TEXTgz(char *FILENAME, const char *mode, int *GZIPFLAG ) {
 } // end open_TEXTgz
 
 
+// =====================================
+void close_TEXTgz(FILE *fp, int GZIPFLAG) {
+
+  // Created Aug 2026
+  // Close fp from open_TEXTgz: pclose for gzip pipes (waits for
+  // gzip to finish so the file is complete), fclose otherwise.
+
+  //  char fnam[] = "close_TEXTgz" ;
+
+  // -------------- BEGIN ------------
+
+  if ( GZIPFLAG ) { pclose(fp); }
+  else            { fclose(fp); }
+  return ;
+
+} // end close_TEXTgz
+
+
 // =====================================
 void snana_rewind(FILE *fp, char *FILENAME, int GZIPFLAG) {
 
@@ -168,6 +168,7 @@ char FILTERSTRING[100] ;
 
 struct {
   int     NSTREAM ; // number of srandom streams (legacy is 1)
+  int     ISEED ;   // user seed (Aug 2026; for counter-based streams)
   double  RANSTORE[MXLIST_RAN+1][MXSTORE_RAN] ;
   int     NLIST_RAN;         // Number of lists
   int     NSTORE_RAN[MXLIST_RAN+1] ;
@@ -183,6 +184,11 @@ struct {
   struct random_data  ranStream[MXSTREAM_RAN];
   char stateBuf[MXSTREAM_RAN][BUFSIZE_RAN];
 
+  // Aug 2026: total randoms drawn per stream since init; lets a
+  // checkpoint record the stream position and a restart burn
+  // forward to the same point (see burn_random_stream).
+  long long NCALL_STREAM[MXSTREAM_RAN] ;
+
   // wrap-around stats for how often each random is re-used.
   int    NCALL_fill_RANSTATs;
   double NWRAP_MIN[MXLIST_RAN+1] ;
@@ -195,6 +201,16 @@ struct {
 
 } GENRAN_INFO ;
 
+// Aug 2026: counter-based random stream (SplitMix64-style hash of a
+// 64-bit counter) keyed by (ISEED,CID,purpose). Any event's randoms
+// can be regenerated in isolation without replaying the sequential
+// lists above, and each stream is local to its caller so threads
+// never share RNG state.
+typedef struct {
+  unsigned long long KEY ;      // hash of (ISEED, CID, purpose)
+  unsigned long long COUNTER ;  // increments by 1 per draw
+} COUNTER_RANSTREAM_DEF ;
+
 
 // errmsg parameters 
 char c1err[200];   // for kcorerr utility 
@@ -293,6 +309,38 @@ typedef struct GRIDMAP1D {
   double  *XVAL, *YVAL ;
 } GRIDMAP1D ;
 
+// Aug 2026: caller-owned scratch for interp_GRIDMAP_HINT.
+// Caches the grid cell from the previous call so that consecutive
+// lookups in the same cell skip the per-corner index translation;
+// caller owns one hint per GRIDMAP (init to zero), so the lookup
+// is usable from threads with no shared state.
+#define MXVAR_GRIDMAP_HINT 8   // max NDIM with corner caching
+typedef struct {
+  int VALID ;   // set internally after first cached call
+  int ID   ;    // GRIDMAP ID for which hint is valid
+  int IGRID_VAR[MXVAR_GRIDMAP_HINT] ;    // last central bin per dim
+  int IGRID_1D[1<<MXVAR_GRIDMAP_HINT] ;  // last 1D index per corner
+} GRIDMAP_HINT_DEF ;
+
+// Aug 2026: open-address hash set over a caller-owned string list;
+// see build_HASH_STRING & index_HASH_STRING. The strings are not
+// copied, so WORDLIST must out-live the hash.
+typedef struct {
+  int    SIZE ;      // number of slots (power of 2); 0 until built
+  int   *INDEX ;     // slot -> WORDLIST index; -9 => empty slot
+  char **WORDLIST ;  // caller-owned list of strings
+} HASH_STRING_DEF ;
+
+// Aug 2026: optional binary side-cache for read_GRIDMAP.
+// Caller sets SOURCE_FILE (full path of text map file) just before
+// calling read_GRIDMAP; the hook is consumed (cleared) per call.
+#define MAGIC_GRIDMAP_CACHE    20260801
+#define VERSION_GRIDMAP_CACHE  1
+#define SUFFIX_GRIDMAP_CACHE   "BINCACHE"
+struct {
+  char SOURCE_FILE[MXPATHLEN] ;
+} GRIDMAP_CACHE ;
+
 #define IDGRIDMAP_SIMEFFMAP              8  // for MLCS-AV prior
 #define IDGRIDMAP_HOSTLIB_WGTMAP        20  // HOSTLIB weight map
 #define IDGRIDMAP_SPECEFF_OFFSET        30  // id = OFFSET + imap
@@ -508,6 +556,11 @@ float get_snana_version_float__(char *snana_version);
 bool correct_sign_vpec_data(char *snana_version_data);
 bool correct_sign_vpec_data__(char *snana_version_data);
 
+int  FORK_NCORE_SPLIT(int ncore);  // Aug 2026: multi-core event loop
+void WAIT_NCORE_SPLIT(void);
+int  fork_ncore_split__(int *ncore);
+void wait_ncore_split__(void);
+
 void print_KEYwarning(int ISEV, char *key_old, char *key_new);
 void set_SNDATA_LEGACY(char *key, int NVAL, char *stringVal, double *parVal);
 void set_FILTERSTRING(char *FILTERSTRING) ;
@@ -572,6 +625,7 @@ void update_covmatrix__(char *name, int *OPTMASK, int *MATSIZE,
 int  store_PARSE_WORDS(int OPT, char *FILENAME);
 void malloc_PARSE_WORDS(void);
 void get_PARSE_WORD(int langFlag, int iwd, char *word);
+char *get_PARSE_WORD_PTR(int iwd); // Aug 2026: no-copy word access (C only)
 void get_PARSE_WORD_INT(int langFlag, int iwd, int   *i_val);
 void get_PARSE_WORD_FLT(int langFlag, int iwd, float *f_val);
 void get_PARSE_WORD_DBL(int langFlag, int iwd, double *d_val);
@@ -716,7 +770,12 @@ int    INTFILTER ( char *cfilt );  // convert filter name into index
 
 
 // miscellaneous
-				  
+
+// Aug 2026: min size (bytes) to request huge-page backing
+// in malloc_largeTable (see SNANA_MALLOC_HUGEPAGE env variable)
+#define SIZEMIN_MALLOC_HUGEPAGE 8000000
+void *malloc_largeTable(size_t MEMTOT);
+
 double MAGLIMIT_calculator(double ZPT, double PSF, double SKYMAG, double SNR);
 double SNR_calculator(double ZPT, double PSF, double SKYMAG, double MAG,
 		      double *FLUX_and_ERR ) ;
@@ -734,10 +793,21 @@ void init_interp_GRIDMAP(int ID, char *MAPNAME, int MAPSIZE, int NDIM, int NFUN,
 			 GRIDMAP *gridmap );
 
 int  interp_GRIDMAP(GRIDMAP *gridmap, double *data, double *interpFun );
+int  interp_GRIDMAP_HINT(GRIDMAP *gridmap, double *data, double *interpFun,
+			 GRIDMAP_HINT_DEF *hint );  // Aug 2026
 
-void read_GRIDMAP(FILE *fp, char *MAPNAME, char *KEY_ROW, char *KEY_STOP, 
+void read_GRIDMAP(FILE *fp, char *MAPNAME, char *KEY_ROW, char *KEY_STOP,
 		  int IDMAP, int NDIM, int NFUN, int OPT_EXTRAP, int MXROW,
 		  char *callFun, GRIDMAP *GRIDMAP_LOAD );
+
+// Aug 2026: optional binary side-cache for read_GRIDMAP so that large
+// text maps are parsed once, then re-loaded from a binary image.
+void set_GRIDMAP_CACHE_SOURCE(char *mapFile);
+bool rd_gridmap_cache(char *cacheFile, char *mapFile, int IDMAP, int NDIM,
+		      int NFUN, int OPT_EXTRAP, GRIDMAP *GRIDMAP_LOAD );
+void wr_gridmap_cache(char *cacheFile, char *mapFile,
+		      GRIDMAP *GRIDMAP_LOAD );
+
 void warn_NVAR_KEY(char *fileName);
 
 void fillbins(int OPT, char *name, int NBIN, float *RANGE, 
@@ -762,9 +832,13 @@ double interp_1DFUN(int opt, double val, int NBIN,
 		    char *abort_comment );
 
 double interp_1dfun__(int *opt, double *val, int *NBIN,
-		      double *VAL_LIST, double *FUN_LIST, 
+		      double *VAL_LIST, double *FUN_LIST,
 		      char *abort_comment );
 
+void interp_1DFUN_batch(int opt, int NVAL, double *val_list, int NBIN,
+			double *VAL_LIST, double *FUN_LIST,
+			char *abort_comment, double *fun_list_out );
+
 int quickBinSearch(double VAL, int NBIN, double *VAL_LIST, 
 		   char *abort_comment);
 double quadInterp ( double VAL, double VAL_LIST[3], double FUN_LIST[3],
@@ -778,12 +852,18 @@ double RMSfromSUMS(int N, double SUM, double SQSUM);
 void trim_blank_spaces(char *string) ;
 void remove_string_termination(char *STRING, int LEN) ;
 
-void splitString(char *string, char *sep, int MXsplit, 
+void splitString(char *string, char *sep, int MXsplit,
 		 int *Nsplit, char **ptrSplit);
 void splitString2(char *string, char *sep, int MXsplit,
 		  int *Nsplit, char **ptrSplit) ;
 void split2floats(char *string, char *sep, float *fval) ;
 
+// Aug 2026: generic hash set over a caller-owned string list (e.g.,
+// CID accept/reject lists); lookup is O(1) instead of a linear scan.
+unsigned int hash_string(char *string);
+void build_HASH_STRING(HASH_STRING_DEF *HASH, int NWORD, char **WORDLIST);
+int  index_HASH_STRING(HASH_STRING_DEF *HASH, char *string);
+
 void remove_quote(char *string);
 void extractStringOpt ( char *string, char *stringOpt) ;
 void extractstringopt_( char *string, char *stringOpt) ;
@@ -807,6 +887,7 @@ void fprint_banner (FILE *FP, const char *banner ) ;
 void find_pathfile(char *fileName, char *PATH_LIST, char *FILENAME, char *callFun);
 
 FILE *open_TEXTgz(char *FILENAME, const char *mode,int *GZIPFLAG) ;
+void close_TEXTgz(FILE *fp, int GZIPFLAG) ; // Aug 2026
 FILE *snana_openTextFile (int OPTMASK, char *PATH_LIST, char *fileName, 
 			  char *fullName, int *gzipFlag ); 
 void snana_rewind(FILE *fp, char *FILENAME, int GZIPFLAG);
@@ -846,12 +927,22 @@ void   init_random_seed(int ISEED, int NSTREAM);
 void   fill_RANLISTs(void);
 void   sumstat_RANLISTs(int FLAG);
 double unix_random(int istream) ;
+void   burn_random_stream(int istream, long long NCALL_TARGET); // Aug 2026
 double unix_GaussRan(int istream);
 double FlatRan (int ilist, double *range);  //return rnmd on range[0-1]
 double FlatRan1(int ilist);          // return 0 < random  < 1
 double GaussRan(int ilist);          // returns gaussian random number
 double GaussRanClip(int ilist, double ranGmin, double ranGmax);
+void   GaussRan_FILL(int ilist, int N, double *ranList);  // Aug 2026
+void   GaussRanClip_FILL(int ilist, double ranGmin, double ranGmax,
+			 int N, double *ranList);
 int    getRan_Poisson(double mean);
+
+// counter-based randoms, Aug 2026 (see COUNTER_RANSTREAM_DEF)
+void   init_counter_RANSTREAM(COUNTER_RANSTREAM_DEF *STREAM,
+			      long long CID, int purpose);
+double FlatRan1_counter(COUNTER_RANSTREAM_DEF *STREAM);
+double GaussRan_counter(COUNTER_RANSTREAM_DEF *STREAM);
 //void   FlatRan_correlated(int NDIM, double *COVRED, double *outRanList);
 
 // mangled functions for fortran
@@ -916,6 +1007,7 @@ void sortint_(int *NSORT, int *ARRAY, int *ORDER,
 
 // invert matrix to replace CERNLIB functions
 void invertMatrix (int  N, int  n, double *Matrix ) ;
+void invertMatrix_cholesky (int  N, int  n, double *Matrix ) ;
 void invertmatrix_(int *N, int *n, double *Matrix ) ;
 
 
@@ -0,0 +1,268 @@
+/**************************************************
+ Created Aug 2026
+
+ Microbenchmark harness for documented hot kernels, built and run
+ with "make bench" from src. Each benchmark drives one kernel with
+ synthetic in-memory inputs and a fixed random seed, then reports
+ ns per call and throughput so that performance regressions show up
+ per commit instead of per production cycle.
+
+ Kernels covered here:
+   + interp_1DFUN            (sntools.c)
+   + interp_GRIDMAP          (sntools.c)
+   + interp_GRIDMAP_HINT     (sntools.c)
+   + getSNR_spectrograph     (sntools_spectrograph.c)
+
+ Kernels NOT covered:
+   + INTEG_zSED_SALT2 requires a full SALT2 model directory
+     (init_genmag_SALT2 reads SED + error surfaces from disk),
+     and fcn() in SALT2mu requires a fitres file + MINUIT setup.
+     Neither can run on synthetic in-memory data; time those with
+     a small production run until a file-backed bench is added.
+
+ Results depend on host + compiler; compare against the previous
+ commit on the same machine, not against absolute numbers.
+
+**************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "sntools.h"
+#include "sntools_spectrograph.h"
+
+#define SEED_BENCH 12345  // fixed seed -> identical inputs every run
+
+// benchmark sizes: large enough for stable timing, small enough
+// that the full suite runs in a few seconds
+#define NCALL_INTERP_1DFUN    5000000
+#define NCALL_INTERP_GRIDMAP  2000000
+#define NEVT_GETSNR           2000    // events; NBLAM calls per event
+
+void   bench_interp_1DFUN(void);
+void   bench_interp_GRIDMAP(void);
+void   bench_getSNR_spectrograph(void);
+double bench_timer(void);
+double bench_flatRan(void);
+void   bench_report(char *name, int NCALL, double t0, double t1,
+		    double checksum);
+
+unsigned int IRAN_BENCH ;
+
+// =============================
+int main(int argc, char **argv) {
+
+  // ----------- BEGIN ------------
+
+  print_banner("BEGIN KERNEL MICROBENCHMARKS");
+  printf("   Fixed seed = %d; compare ns/op against previous commit.\n\n",
+	 SEED_BENCH );
+  fflush(stdout);
+
+  bench_interp_1DFUN();
+  bench_interp_GRIDMAP();
+  bench_getSNR_spectrograph();
+
+  printf("\n Done with benchmarks. \n");
+  return(0);
+
+} // end main
+
+
+// =============================
+double bench_timer(void) {
+  // return wall time in seconds (monotonic clock)
+  struct timespec t ;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec + 1.0E-9*(double)t.tv_nsec ;
+}
+
+// =============================
+double bench_flatRan(void) {
+  // deterministic flat random on [0,1); private LCG so the bench
+  // inputs never depend on the GSL generators or their defaults.
+  IRAN_BENCH = IRAN_BENCH*1664525 + 1013904223 ;
+  return (double)(IRAN_BENCH>>8) / 16777216.0 ;
+}
+
+// =============================
+void bench_report(char *name, int NCALL, double t0, double t1,
+		  double checksum) {
+
+  // print one result line; checksum is printed so the compiler
+  // cannot discard the kernel calls, and so numerical drift
+  // between commits is visible alongside timing drift.
+
+  double dt    = t1 - t0 ;
+  double nsop  = 1.0E9 * dt / (double)NCALL ;
+  double mops  = 1.0E-6 * (double)NCALL / dt ;
+
+  // ----------- BEGIN ------------
+
+  printf("   %-24s : %9.1f ns/op  %8.2f Mop/s   (checksum=%.6le)\n",
+	 name, nsop, mops, checksum );
+  fflush(stdout);
+
+} // end bench_report
+
+
+// =============================
+void bench_interp_1DFUN(void) {
+
+  // time linear interp on a 100-bin grid with random lookups
+
+#define NBIN_B1D 100
+  int    i, NCALL = NCALL_INTERP_1DFUN ;
+  double XVAL[NBIN_B1D], YVAL[NBIN_B1D] ;
+  double x, sum = 0.0, t0, t1 ;
+  char   fnam[] = "bench_interp_1DFUN" ;
+
+  // ----------- BEGIN ------------
+
+  IRAN_BENCH = SEED_BENCH ;
+  for(i=0; i < NBIN_B1D; i++ ) {
+    XVAL[i] = (double)i ;
+    YVAL[i] = sin( 0.1 * (double)i ) ;
+  }
+
+  t0 = bench_timer();
+  for(i=0; i < NCALL; i++ ) {
+    x    = bench_flatRan() * (double)(NBIN_B1D-1) ;
+    sum += interp_1DFUN(1, x, NBIN_B1D, XVAL, YVAL, fnam);
+  }
+  t1 = bench_timer();
+
+  bench_report("interp_1DFUN", NCALL, t0, t1, sum);
+
+} // end bench_interp_1DFUN
+
+
+// =============================
+void bench_interp_GRIDMAP(void) {
+
+  // time 3D grid interp (20x20x20, NFUN=1) with random lookups;
+  // run twice: plain interp_GRIDMAP, then interp_GRIDMAP_HINT with
+  // correlated lookups (small steps) where the hint cache pays off.
+
+#define NBIN_B3D  20
+  int     MAPSIZE = NBIN_B3D*NBIN_B3D*NBIN_B3D ;
+  int     NDIM=3, NFUN=1, NCALL = NCALL_INTERP_GRIDMAP ;
+  int     i, i0, i1, i2, irow, istat ;
+  double *GRIDMAP_INPUT[3], *GRIDFUN_INPUT[1] ;
+  double  data[3], funVal[1], sum, t0, t1 ;
+  GRIDMAP          gridmap ;
+  GRIDMAP_HINT_DEF hint ;
+  //  char fnam[] = "bench_interp_GRIDMAP" ;
+
+  // ----------- BEGIN ------------
+
+  for(i=0; i < NDIM; i++ )
+    { GRIDMAP_INPUT[i] = (double*)malloc( MAPSIZE*sizeof(double) ); }
+  GRIDFUN_INPUT[0] = (double*)malloc( MAPSIZE*sizeof(double) );
+
+  irow = 0 ;
+  for(i0=0; i0 < NBIN_B3D; i0++ ) {
+    for(i1=0; i1 < NBIN_B3D; i1++ ) {
+      for(i2=0; i2 < NBIN_B3D; i2++ ) {
+	GRIDMAP_INPUT[0][irow] = (double)i0 ;
+	GRIDMAP_INPUT[1][irow] = (double)i1 ;
+	GRIDMAP_INPUT[2][irow] = (double)i2 ;
+	GRIDFUN_INPUT[0][irow] =
+	  sin(0.3*(double)i0) + cos(0.2*(double)i1) + 0.1*(double)i2 ;
+	irow++ ;
+      }
+    }
+  }
+
+  init_interp_GRIDMAP(999, "BENCH3D", MAPSIZE, NDIM, NFUN, 0,
+		      GRIDMAP_INPUT, GRIDFUN_INPUT, &gridmap);
+
+  // random lookups, no hint
+  IRAN_BENCH = SEED_BENCH ;  sum = 0.0 ;
+  t0 = bench_timer();
+  for(i=0; i < NCALL; i++ ) {
+    data[0] = bench_flatRan() * (double)(NBIN_B3D-1) ;
+    data[1] = bench_flatRan() * (double)(NBIN_B3D-1) ;
+    data[2] = bench_flatRan() * (double)(NBIN_B3D-1) ;
+    istat   = interp_GRIDMAP(&gridmap, data, funVal);
+    if ( istat == SUCCESS ) { sum += funVal[0]; }
+  }
+  t1 = bench_timer();
+  bench_report("interp_GRIDMAP", NCALL, t0, t1, sum);
+
+  // correlated lookups with hint: random walk with small steps so
+  // consecutive calls usually land in the same grid cell
+  IRAN_BENCH = SEED_BENCH ;  sum = 0.0 ;
+  memset(&hint, 0, sizeof(hint));
+  data[0] = data[1] = data[2] = 0.5*(double)(NBIN_B3D-1) ;
+  t0 = bench_timer();
+  for(i=0; i < NCALL; i++ ) {
+    data[0] += 0.02*( bench_flatRan() - 0.5 ) ;
+    data[1] += 0.02*( bench_flatRan() - 0.5 ) ;
+    data[2] += 0.02*( bench_flatRan() - 0.5 ) ;
+    istat    = interp_GRIDMAP_HINT(&gridmap, data, funVal, &hint);
+    if ( istat == SUCCESS ) { sum += funVal[0]; }
+  }
+  t1 = bench_timer();
+  bench_report("interp_GRIDMAP_HINT", NCALL, t0, t1, sum);
+
+  for(i=0; i < NDIM; i++ ) { free(GRIDMAP_INPUT[i]); }
+  free(GRIDFUN_INPUT[0]);
+
+} // end bench_interp_GRIDMAP
+
+
+// =============================
+void bench_getSNR_spectrograph(void) {
+
+  // time SNR evaluation on a synthetic spectrograph table:
+  // 1000 lambda bins x 10 exposure-time bins, with the search
+  // exposure time changing once per "event" as in the sim.
+
+  int    NBL = 1000, NBT = 10 ;
+  int    ilam, it, ievt, NCALL ;
+  double TEXPOSE_S, TEXPOSE_T, GENMAG, ERRFRAC_T ;
+  double sum = 0.0, t0, t1 ;
+  //  char fnam[] = "bench_getSNR_spectrograph" ;
+
+  // ----------- BEGIN ------------
+
+  INPUTS_SPECTRO.NBIN_LAM     = NBL ;
+  INPUTS_SPECTRO.NBIN_TEXPOSE = NBT ;
+  malloc_spectrograph(+1, NBL, NBT);
+
+  for(it=0; it < NBT; it++ )
+    { INPUTS_SPECTRO.TEXPOSE_LIST[it] = 100.0*(double)(it+1); }
+
+  for(ilam=0; ilam < NBL; ilam++ ) {
+    for(it=0; it < NBT; it++ ) {
+      INPUTS_SPECTRO.ZP[ilam][it] =
+	30.0 + 0.001*(double)ilam + 1.1*(double)it ;
+      INPUTS_SPECTRO.SQSIGSKY[ilam][it] =
+	400.0 + 0.2*(double)ilam + 50.0*(double)it ;
+    }
+  }
+
+  SNR_WGT_SPECTROGRAPH.VALID = false ;
+  TEXPOSE_T = 300.0 ;
+
+  IRAN_BENCH = SEED_BENCH ;
+  NCALL = NEVT_GETSNR * NBL ;
+
+  t0 = bench_timer();
+  for(ievt=0; ievt < NEVT_GETSNR; ievt++ ) {
+    TEXPOSE_S = 150.0 + 800.0*bench_flatRan() ;
+    for(ilam=0; ilam < NBL; ilam++ ) {
+      GENMAG = 21.0 + 0.002*(double)ilam ;
+      sum   += getSNR_spectrograph(ilam, TEXPOSE_S, TEXPOSE_T,
+				   false, GENMAG, &ERRFRAC_T );
+    }
+  }
+  t1 = bench_timer();
+  bench_report("getSNR_spectrograph", NCALL, t0, t1, sum);
+  // table is left allocated; process exits right after the suite
+
+} // end bench_getSNR_spectrograph
@@ -38,6 +38,7 @@ void init_HzFUN_INFO(int VBOSE, double *cosPar, char *fileName,
     { HzFUN_INFO->COSPAR_LIST[ipar] = cosPar[ipar]; }
 
   HzFUN_INFO->Nzbin_MAP = 0;
+  HzFUN_INFO->USE_CACHE = false ; // Aug 2026: cache is explicit opt-in
 
   // - - - - - - 
   HzFUN_INFO->USE_MAP = !IGNOREFILE(fileName) ;
@@ -102,6 +103,126 @@ void init_HzFUN_INFO(int VBOSE, double *cosPar, char *fileName,
 } // end init_HzFUN_INFO
 
 
+// ==================================================
+void init_HzFUN_CACHE(HzFUN_INFO_DEF *HzFUN_INFO) {
+
+  // Created Aug 2026
+  // Tabulate cumulative integrals on a uniform z grid for the fixed
+  // cosmology in HzFUN_INFO, so that Hzinv_integral and dVdz_integral
+  // become O(1) interpolations instead of Simpson-style sums; dVdz
+  // and dLmag inherit the speedup through Hzinv_integral. Intended
+  // for programs with one cosmology per job (snlc_sim, psnid); do
+  // NOT call this where cosPar varies per chi2 evaluation (wfit).
+  //
+  // Grid binsize matches the 0.001 binsize of the direct integrals,
+  // so cached and uncached results agree to float precision.
+
+  double H0 = HzFUN_INFO->COSPAR_LIST[ICOSPAR_HzFUN_H0];
+  double OM = HzFUN_INFO->COSPAR_LIST[ICOSPAR_HzFUN_OM];
+  double OL = HzFUN_INFO->COSPAR_LIST[ICOSPAR_HzFUN_OL];
+  double KAPPA, SQRT_KAPPA, ZMAX, ZBIN, zmid, Hz, Smid, r, dV ;
+  double *Sinv, *VOL, *VOLz ;
+  int    Nzbin, iz, MEMD ;
+  char fnam[] = "init_HzFUN_CACHE";
+
+  // ----------- BEGIN -----------
+
+  ZMAX = ZMAX_HzFUN_CACHE ;
+
+  // H(z) map cannot be extrapolated; limit cache to map range
+  if ( HzFUN_INFO->USE_MAP ) {
+    double zmax_map = HzFUN_INFO->zCMB_MAP[HzFUN_INFO->Nzbin_MAP-1];
+    if ( zmax_map < ZMAX ) { ZMAX = zmax_map; }
+  }
+
+  Nzbin = (int)( ZMAX / ZBIN_HzFUN_CACHE ) ;
+  ZBIN  = ZMAX / (double)Nzbin ;
+
+  MEMD = (Nzbin+1) * sizeof(double);
+  Sinv = HzFUN_INFO->Sinv_CACHE = (double*) malloc(MEMD);
+  VOL  = HzFUN_INFO->VOL_CACHE  = (double*) malloc(MEMD);
+  VOLz = HzFUN_INFO->VOLz_CACHE = (double*) malloc(MEMD);
+
+  KAPPA      = 1.0 - OM - OL ;
+  SQRT_KAPPA = sqrt(fabs(KAPPA));
+
+  Sinv[0] = VOL[0] = VOLz[0] = 0.0 ;
+
+  for ( iz=1; iz <= Nzbin; iz++ ) {
+    zmid = ( (double)iz - 0.5 ) * ZBIN ;
+    Hz   = Hzfun(zmid, HzFUN_INFO);
+    Sinv[iz] = Sinv[iz-1] + ZBIN * H0 / Hz ;
+
+    // comoving r at zmid, with curvature transform as in Hzinv_integral
+    Smid = 0.5 * ( Sinv[iz-1] + Sinv[iz] ) ;
+    if ( KAPPA < -0.00001 )
+      { r = sin ( SQRT_KAPPA * Smid ) / SQRT_KAPPA ; }
+    else if ( KAPPA > 0.00001 )
+      { r = sinh( SQRT_KAPPA * Smid ) / SQRT_KAPPA ; }
+    else
+      { r = Smid ; }
+    r *= ( LIGHT_km / H0 );
+
+    dV = LIGHT_km * r * r / Hz ;   // same as dVdz()
+    VOL[iz]  = VOL[iz-1]  + ZBIN * dV ;
+    VOLz[iz] = VOLz[iz-1] + ZBIN * zmid * dV ;
+  }
+
+  HzFUN_INFO->Nzbin_CACHE = Nzbin ;
+  HzFUN_INFO->ZMAX_CACHE  = ZMAX ;
+  HzFUN_INFO->ZBIN_CACHE  = ZBIN ;
+  HzFUN_INFO->USE_CACHE   = true ;
+
+  printf("   %s: cache z-integrals on %d bins, z < %.2f \n",
+	 fnam, Nzbin, ZMAX ); fflush(stdout);
+
+  return ;
+
+} // end init_HzFUN_CACHE
+
+
+// ==================================================
+double interp_HzFUN_CACHE(double z, double *VAL_LIST,
+			  HzFUN_INFO_DEF *HzFUN_INFO) {
+
+  // Created Aug 2026
+  // Return linear interpolation of cumulative-integral list
+  // VAL_LIST (Sinv_CACHE, VOL_CACHE or VOLz_CACHE) at redshift z.
+  // Uniform grid -> O(1), no bin search.
+
+  double ZBIN = HzFUN_INFO->ZBIN_CACHE ;
+  int    iz ;
+  double frac ;
+
+  if ( z <= 0.0 ) { return 0.0 ; }
+
+  iz   = (int)( z / ZBIN );
+  if ( iz >= HzFUN_INFO->Nzbin_CACHE ) { iz = HzFUN_INFO->Nzbin_CACHE-1; }
+  frac = z/ZBIN - (double)iz ;
+  return VAL_LIST[iz] + frac * ( VAL_LIST[iz+1] - VAL_LIST[iz] );
+
+} // end interp_HzFUN_CACHE
+
+
+// ==================================================
+void Hzinv_integral_list(int NZ, double *zmin_list, double *zmax_list,
+			 HzFUN_INFO_DEF *HzFUN_INFO, double *rz_list) {
+
+  // Created Aug 2026
+  // Batched comoving-distance evaluation: fill rz_list[0:NZ-1] with
+  // Hzinv_integral(zmin,zmax) for each entry. With the cache enabled
+  // each entry is an O(1) interpolation.
+
+  int iz;
+  for ( iz=0; iz < NZ; iz++ ) {
+    rz_list[iz] =
+      Hzinv_integral(zmin_list[iz], zmax_list[iz], HzFUN_INFO);
+  }
+  return ;
+
+} // end Hzinv_integral_list
+
+
 // ****************************************
 void write_HzFUN_FILE(HzFUN_INFO_DEF *HzFUN_INFO ) {
 
@@ -291,6 +412,14 @@ double dVdz_integral(int OPT, double zmax, HzFUN_INFO_DEF *HzFUN_INFO) {
 
   // ---- BEGIN ----------
 
+  // Aug 2026: check cache of cumulative volume integral
+  if ( HzFUN_INFO->USE_CACHE && zmax <= HzFUN_INFO->ZMAX_CACHE ) {
+    if ( OPT == 1 )
+      { return interp_HzFUN_CACHE(zmax, HzFUN_INFO->VOLz_CACHE, HzFUN_INFO); }
+    else
+      { return interp_HzFUN_CACHE(zmax, HzFUN_INFO->VOL_CACHE,  HzFUN_INFO); }
+  }
+
   // compute exact integral
 
   Nzbin = (int)( zmax * 1000.0 ) ;
@@ -325,8 +454,9 @@ double dvdz_integral__(int *OPT, double *zmax, double *COSPAR) {
   HzFUN_INFO_DEF HzFUN_INFO;
   int ipar;
 
-  HzFUN_INFO.USE_MAP = false ;
-  for (ipar=0; ipar < NCOSPAR_HzFUN; ipar++ ) 
+  HzFUN_INFO.USE_MAP   = false ;
+  HzFUN_INFO.USE_CACHE = false ;
+  for (ipar=0; ipar < NCOSPAR_HzFUN; ipar++ )
     { HzFUN_INFO.COSPAR_LIST[ipar] = COSPAR[ipar]; }
 
   return dVdz_integral(*OPT, *zmax, &HzFUN_INFO);
@@ -359,22 +489,31 @@ double Hzinv_integral(double zmin, double zmax, HzFUN_INFO_DEF *HzFUN_INFO) {
   // ------ return integral c*r(z) = int c*dz/H(z) -------------
   // Note that D_L = (1+z)*Hzinv_integral
 
-  sum = 0.0;
+  if ( HzFUN_INFO->USE_CACHE && zmax <= HzFUN_INFO->ZMAX_CACHE ) {
+    // Aug 2026: O(1) lookup of cumulative integral from cache
+    sum =
+      interp_HzFUN_CACHE(zmax, HzFUN_INFO->Sinv_CACHE, HzFUN_INFO) -
+      interp_HzFUN_CACHE(zmin, HzFUN_INFO->Sinv_CACHE, HzFUN_INFO) ;
+  }
+  else {
 
-  Nzbin = (int)( (zmax-zmin) * 1000.0 ) ;
-  if ( Nzbin < 10 ) { Nzbin = 10 ; }
-  dz  = (zmax-zmin) / (double)Nzbin ;      // integration binsize
+    sum = 0.0;
 
-  for ( iz=0; iz < Nzbin; iz++ ) {
-    xz   = (double)iz ;
-    ztmp = zmin + dz * (xz + 0.5) ;
-    Hz   = Hzfun (ztmp, HzFUN_INFO);
-    sum += (1.0/Hz) ;
-  }
+    Nzbin = (int)( (zmax-zmin) * 1000.0 ) ;
+    if ( Nzbin < 10 ) { Nzbin = 10 ; }
+    dz  = (zmax-zmin) / (double)Nzbin ;      // integration binsize
 
-  // remove H0 factor from inetgral before checking curvature.
+    for ( iz=0; iz < Nzbin; iz++ ) {
+      xz   = (double)iz ;
+      ztmp = zmin + dz * (xz + 0.5) ;
+      Hz   = Hzfun (ztmp, HzFUN_INFO);
+      sum += (1.0/Hz) ;
+    }
+
+    // remove H0 factor from inetgral before checking curvature.
 
-  sum *= (dz * H0) ;
+    sum *= (dz * H0) ;
+  }
 
   // check for curvature
   KAPPA      = 1.0 - OM - OL ; 
@@ -544,7 +683,8 @@ double dlmag_fortc__(double *zCMB, double *zHEL, double *H0,
   HzFUN_INFO.COSPAR_LIST[ICOSPAR_HzFUN_OL] = *OL ;
   HzFUN_INFO.COSPAR_LIST[ICOSPAR_HzFUN_w0] = *w0 ;
   HzFUN_INFO.COSPAR_LIST[ICOSPAR_HzFUN_wa] = *wa ;
-  HzFUN_INFO.USE_MAP = false ;
+  HzFUN_INFO.USE_MAP   = false ;
+  HzFUN_INFO.USE_CACHE = false ;
 
   mu = dLmag(*zCMB, *zHEL, &HzFUN_INFO);
 
@@ -12,24 +12,44 @@
 #define ICOSPAR_HzFUN_wa  4
 #define NCOSPAR_HzFUN     5
 
-#define MXMAP_HzFUN 5000  
+#define MXMAP_HzFUN 5000
+
+// Aug 2026: z-grid for optional integral cache (see init_HzFUN_CACHE)
+#define ZMAX_HzFUN_CACHE  11.0
+#define ZBIN_HzFUN_CACHE  0.001   // matches integration binsize
 
 typedef struct {
   double COSPAR_LIST[NCOSPAR_HzFUN];
-  
+
   // optional 2-column map to define theory H(z)
   bool   USE_MAP ;
   char   *FILENAME ;
   int    Nzbin_MAP;
   double *zCMB_MAP, *HzFUN_MAP ;
 
+  // Aug 2026: optional init-time cache of cumulative integrals on a
+  // uniform z grid so that Hzinv_integral and dVdz_integral become
+  // O(1) interpolations. Filled by init_HzFUN_CACHE for a fixed
+  // cosmology; default is USE_CACHE=false (e.g., wfit varies cosPar).
+  bool   USE_CACHE ;
+  int    Nzbin_CACHE ;
+  double ZMAX_CACHE, ZBIN_CACHE ;
+  double *Sinv_CACHE ;   // cumulative H0*Int[dz/H],     at iz*ZBIN
+  double *VOL_CACHE ;    // cumulative Int[dV/dz dz],    at iz*ZBIN
+  double *VOLz_CACHE ;   // idem with z-weight (OPT=1)
+
 } HzFUN_INFO_DEF ;
 
 
 // ========= function prototypes =========
 
-void init_HzFUN_INFO(int VBOSE, double *cosPar, char *fileName, 
-		     HzFUN_INFO_DEF *HzFUN_INFO); 
+void init_HzFUN_INFO(int VBOSE, double *cosPar, char *fileName,
+		     HzFUN_INFO_DEF *HzFUN_INFO);
+void init_HzFUN_CACHE(HzFUN_INFO_DEF *HzFUN_INFO);  // Aug 2026
+double interp_HzFUN_CACHE(double z, double *VAL_LIST,
+			  HzFUN_INFO_DEF *HzFUN_INFO);
+void Hzinv_integral_list(int NZ, double *zmin_list, double *zmax_list,
+			 HzFUN_INFO_DEF *HzFUN_INFO, double *rz_list);
 void write_HzFUN_FILE(HzFUN_INFO_DEF *HzFUN_INFO);
 
 double SFR_integral(double z, HzFUN_INFO_DEF *HzFUN_INFO);
@@ -42,6 +42,10 @@
   Oct 2020: read SNANA_VERSION from header and convert to float
        (enable analysis options based on snana_version in fits header)
 
+  Aug 2026: optional compact SPECTRO_FLUX format (FORMAT_MASK += 128):
+       one row per spectrum with vector columns and 16-bit quantized
+       FLAM[ERR]; read-back is transparent.
+
 **************************************************/
 
 #include "fitsio.h"
@@ -93,7 +97,9 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int simFlag,
   SNFITSIO_SIMFLAG_SNRMON       = false ;
   SNFITSIO_SIMFLAG_MODELPAR     = false ;
   SNFITSIO_SIMFLAG_NBR_LIST     = false ; 
-  SNFITSIO_COMPACT_FLAG         = false ; 
+  SNFITSIO_COMPACT_FLAG         = false ;
+  SNFITSIO_SPEC_COMPACT_FLAG    = false ;
+  SNFITSIO_GZIP_FLAG            = false ;
 
   OVP = ( simFlag & WRITE_MASK_SIM_SNANA) ;
   if ( OVP > 0 )  {// full SNANA sim
@@ -117,6 +123,12 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int simFlag,
   OVP = ( simFlag & WRITE_MASK_COMPACT ) ; // Jan 23 2018
   if ( OVP > 0  ) { SNFITSIO_COMPACT_FLAG = true ; }
 
+  OVP = ( simFlag & WRITE_MASK_SPEC_COMPACT ) ; // Aug 2026
+  if ( OVP > 0  ) { SNFITSIO_SPEC_COMPACT_FLAG = true ; }
+
+  OVP = ( simFlag & WRITE_MASK_FITS_GZ ) ; // Aug 2026
+  if ( OVP > 0  ) { SNFITSIO_GZIP_FLAG = true ; }
+
   OVP = ( simFlag & WRITE_MASK_SIM_MODELPAR ) ;
   if ( OVP > 0 ) { SNFITSIO_SIMFLAG_MODELPAR = true ; }
 
@@ -135,6 +147,9 @@ void WR_SNFITSIO_INIT(char *path, char *version, char *prefix, int simFlag,
     ptrFile = snfitsFile[IFILE_SNFITSIO][itype] ; // short fileName
     sprintf(ptrFile, "%s_%s.FITS", prefix, ptrType );
 
+    // Aug 2026: .gz suffix -> cfitsio writes gzip-compressed file
+    if ( SNFITSIO_GZIP_FLAG ) { strcat(ptrFile, ".gz"); }
+
     // check length of file name (Aug 2019)
     lenpath=strlen(path); lenfile=strlen(ptrFile);  lentot=lenpath+lenfile;
     if ( lentot >= MXPATHLEN ) {
@@ -767,9 +782,61 @@ void wr_snfitsio_init_spec(void) {
   fp    = fp_snfitsFile[itype];
 
   sprintf(TBLname, "%s", "SPECTRO_FLUX" );
-  wr_snfitsio_addCol( "1I", "LAMINDEX",    itype   ) ; 
-  wr_snfitsio_addCol( "1E", "FLAM",        itype   ) ;  
-  wr_snfitsio_addCol( "1E", "FLAMERR",     itype   ) ;  
+
+  // Aug 2026: optional compact format with one row per SPECTRUM
+  // instead of one row per lambda bin. FLAM[ERR] are stored as
+  // 16-bit integers in variable-length vector columns, along with
+  // the linear scale (MIN,BIN) to recover physical values;
+  // precision is (FMAX-FMIN)/65534 per spectrum.
+  if ( SNFITSIO_SPEC_COMPACT_FLAG ) {
+    int   icol_tmp, ncol_tmp = 0 ;
+    char *ptrName[MXPAR_SNFITSIO], *ptrForm[MXPAR_SNFITSIO];
+    char  nameList[20][20], formList[20][4] ;
+
+    sprintf(nameList[ncol_tmp],"LAMINDEX");
+    sprintf(formList[ncol_tmp],"PI");  ncol_tmp++ ;
+    sprintf(nameList[ncol_tmp],"FLAM_MIN");
+    sprintf(formList[ncol_tmp],"1E");  ncol_tmp++ ;
+    sprintf(nameList[ncol_tmp],"FLAM_BIN");
+    sprintf(formList[ncol_tmp],"1E");  ncol_tmp++ ;
+    sprintf(nameList[ncol_tmp],"FLAM");
+    sprintf(formList[ncol_tmp],"PI");  ncol_tmp++ ;
+    sprintf(nameList[ncol_tmp],"FLAMERR_MIN");
+    sprintf(formList[ncol_tmp],"1E");  ncol_tmp++ ;
+    sprintf(nameList[ncol_tmp],"FLAMERR_BIN");
+    sprintf(formList[ncol_tmp],"1E");  ncol_tmp++ ;
+    sprintf(nameList[ncol_tmp],"FLAMERR");
+    sprintf(formList[ncol_tmp],"PI");  ncol_tmp++ ;
+
+    if ( SNFITSIO_SIMFLAG_SNANA ) {
+      sprintf(nameList[ncol_tmp],"SIM_FLAM_MIN");
+      sprintf(formList[ncol_tmp],"1E");  ncol_tmp++ ;
+      sprintf(nameList[ncol_tmp],"SIM_FLAM_BIN");
+      sprintf(formList[ncol_tmp],"1E");  ncol_tmp++ ;
+      sprintf(nameList[ncol_tmp],"SIM_FLAM");
+      sprintf(formList[ncol_tmp],"PI");  ncol_tmp++ ;
+    }
+    if ( GENSPEC.USE_WARP ) {
+      sprintf(nameList[ncol_tmp],"SIM_WARP");
+      sprintf(formList[ncol_tmp],"PI");  ncol_tmp++ ;
+    }
+
+    for(icol_tmp=0; icol_tmp < ncol_tmp; icol_tmp++ ) {
+      ptrName[icol_tmp] = nameList[icol_tmp] ;
+      ptrForm[icol_tmp] = formList[icol_tmp] ;
+    }
+
+    istat = 0 ;
+    fits_create_tbl(fp, BINARY_TBL, NROW, ncol_tmp,
+		    ptrName, ptrForm, NULL, TBLname, &istat ) ;
+    sprintf(BANNER,"fits_create_tbl for %s (compact)", TBLname );
+    snfitsio_errorCheck(BANNER, istat) ;
+    return ;
+  }
+
+  wr_snfitsio_addCol( "1I", "LAMINDEX",    itype   ) ;
+  wr_snfitsio_addCol( "1E", "FLAM",        itype   ) ;
+  wr_snfitsio_addCol( "1E", "FLAMERR",     itype   ) ;
 
   if ( SNFITSIO_SIMFLAG_SNANA ) {
     wr_snfitsio_addCol( "1E", "SIM_FLAM",    itype   ) ;  // Feb 2021
@@ -1827,10 +1894,18 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
   istat     = 0 ;
 
   /*
-  printf(" %2d : xxxx colnum = %2d  clast = %s (parName=%s) \n", 
+  printf(" %2d : xxxx colnum = %2d  clast = %s (parName=%s) \n",
 	 NWR_SNFITSIO, colnum, clast, parName );
   */
 
+  // Aug 2026: per-epoch PHOT values are accumulated in column buffers
+  // and flushed later with multi-row fits_write_col calls; writing
+  // one cfitsio call per epoch dominated sim wall time for big jobs.
+  if ( itype == ITYPE_SNFITSIO_PHOT ) {
+    wr_snfitsio_batch_add(colnum, parName, itype);
+    return ;
+  }
+
   if ( strcmp(clast,"A") == 0 ) {
     char *A = WR_SNFITSIO_TABLEVAL[itype].value_A ;
     int ALLOW_BLANK = ( strcmp(parName,"SUBSURVEY")==0 );
@@ -1882,6 +1957,172 @@ void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype ) {
 } //  end of wr_snfitsio_fillTable
 
 
+// ====================================
+void wr_snfitsio_batch_add(int colnum, char *parName, int itype) {
+
+  // Created Aug 2026
+  // Append current WR_SNFITSIO_TABLEVAL value for *colnum* to the
+  // column batch buffer instead of writing it to the fits file;
+  // buffers are flushed with one multi-row fits_write_col when full
+  // (or from WR_SNFITSIO_END). Only the PHOT table is batched.
+  // If a row does not extend the buffered contiguous block (e.g.,
+  // a column skipped for some epochs), flush first so that the
+  // buffer always maps onto consecutive fits rows.
+
+  WRBATCH_COL_DEF        *B = &WRBATCH_SNFITSIO[colnum] ;
+  struct WR_TABLEVAL_DEF *T = &WR_SNFITSIO_TABLEVAL[itype] ;
+  long  row     = T->NROW ;
+  char *ptrForm = SNFITSIO_TABLEDEF[itype].ptrForm[colnum];
+  int   i, LEN  = strlen(ptrForm);
+  char  clast[2];
+  char  fnam[]  = "wr_snfitsio_batch_add" ;
+
+  // ------------ BEGIN -----------
+
+  sprintf(clast, "%c", ptrForm[LEN-1] ); // last char only
+
+  if ( B->NBUF > 0 && B->FIRSTROW + B->NBUF != row )
+    { wr_snfitsio_batch_flushCol(colnum); }
+
+  if ( B->NBUF == 0 ) { B->FIRSTROW = row ; }
+
+  if ( strcmp(clast,"A") == 0 ) {
+    char *A = T->value_A ;
+    if ( B->BUF_A == NULL ) {
+      B->BUF_A = (char**)malloc( sizeof(char*) * MXROW_WRBATCH_SNFITSIO );
+      for(i=0; i < MXROW_WRBATCH_SNFITSIO; i++ )
+	{ B->BUF_A[i] = (char*)malloc(MXCHAR_WRBATCH_SNFITSIO); }
+    }
+    if ( strlen(A) == 0 ) {
+      sprintf(c1err,"Cannot write %s='' (blank string)", parName);
+      sprintf(c2err,"to colnum=%d of table=%s", colnum, snfitsType[itype]);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+    }
+    if ( strlen(A) >= MXCHAR_WRBATCH_SNFITSIO ) {
+      sprintf(c1err,"len(%s)=%d exceeds batch-buffer bound=%d",
+	      parName, (int)strlen(A), MXCHAR_WRBATCH_SNFITSIO );
+      sprintf(c2err,"Increase MXCHAR_WRBATCH_SNFITSIO");
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+    }
+    sprintf(B->BUF_A[B->NBUF], "%s", A);
+  }
+  else if ( strcmp(ptrForm,"1D") == 0 ) {
+    if ( B->BUF_1D == NULL )
+      { B->BUF_1D = (double*)malloc(sizeof(double)*MXROW_WRBATCH_SNFITSIO); }
+    B->BUF_1D[B->NBUF] = T->value_1D ;
+  }
+  else if ( strcmp(ptrForm,"1E") == 0 ) {
+    if ( B->BUF_1E == NULL )
+      { B->BUF_1E = (float*)malloc(sizeof(float)*MXROW_WRBATCH_SNFITSIO); }
+    B->BUF_1E[B->NBUF] = T->value_1E ;
+  }
+  else if ( strcmp(ptrForm,"1J") == 0 ) {
+    if ( B->BUF_1J == NULL )
+      { B->BUF_1J = (int*)malloc(sizeof(int)*MXROW_WRBATCH_SNFITSIO); }
+    B->BUF_1J[B->NBUF] = T->value_1J ;
+  }
+  else if ( strcmp(ptrForm,"1I") == 0 ) {
+    if ( B->BUF_1I == NULL )
+      { B->BUF_1I = (short*)malloc(sizeof(short)*MXROW_WRBATCH_SNFITSIO); }
+    B->BUF_1I[B->NBUF] = T->value_1I ;
+  }
+  else if ( strcmp(ptrForm,"1K") == 0 ) {
+    if ( B->BUF_1K == NULL )
+      { B->BUF_1K=(long long*)malloc(sizeof(long long)*MXROW_WRBATCH_SNFITSIO);}
+    B->BUF_1K[B->NBUF] = T->value_1K ;
+  }
+  else {
+    sprintf(c1err,"Unrecognized Form = '%s' for param='%s' ",
+	    ptrForm, parName) ;
+    sprintf(c2err,"%s", "Check valid forms in cfitsio guide.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
+  B->NBUF++ ;
+
+  if ( B->NBUF == MXROW_WRBATCH_SNFITSIO )
+    { wr_snfitsio_batch_flushCol(colnum); }
+
+  return ;
+
+} // end of wr_snfitsio_batch_add
+
+
+// ====================================
+void wr_snfitsio_batch_flushCol(int colnum) {
+
+  // Created Aug 2026
+  // Write batched values for this PHOT column with one multi-row
+  // fits_write_col call; see wr_snfitsio_batch_add.
+
+  int   itype   = ITYPE_SNFITSIO_PHOT ;
+  WRBATCH_COL_DEF *B = &WRBATCH_SNFITSIO[colnum] ;
+  fitsfile *fp  = fp_snfitsFile[itype] ;
+  char *ptrForm = SNFITSIO_TABLEDEF[itype].ptrForm[colnum];
+  long  nrow    = B->NBUF, firstelem = 1 ;
+  int   istat   = 0, LEN = strlen(ptrForm);
+  char  clast[2];
+  //  char fnam[] = "wr_snfitsio_batch_flushCol" ;
+
+  // ------------ BEGIN -----------
+
+  if ( nrow == 0 ) { return ; }
+
+  sprintf(clast, "%c", ptrForm[LEN-1] );
+
+  if ( strcmp(clast,"A") == 0 ) {
+    fits_write_col(fp, TSTRING, colnum, B->FIRSTROW, firstelem, nrow,
+		   B->BUF_A, &istat);
+  }
+  else if ( strcmp(ptrForm,"1D") == 0 ) {
+    fits_write_col(fp, TDOUBLE, colnum, B->FIRSTROW, firstelem, nrow,
+		   B->BUF_1D, &istat);
+  }
+  else if ( strcmp(ptrForm,"1E") == 0 ) {
+    fits_write_col(fp, TFLOAT, colnum, B->FIRSTROW, firstelem, nrow,
+		   B->BUF_1E, &istat);
+  }
+  else if ( strcmp(ptrForm,"1J") == 0 ) {
+    fits_write_col(fp, TINT, colnum, B->FIRSTROW, firstelem, nrow,
+		   B->BUF_1J, &istat);
+  }
+  else if ( strcmp(ptrForm,"1I") == 0 ) {
+    fits_write_col(fp, TSHORT, colnum, B->FIRSTROW, firstelem, nrow,
+		   B->BUF_1I, &istat);
+  }
+  else if ( strcmp(ptrForm,"1K") == 0 ) {
+    fits_write_col(fp, TLONGLONG, colnum, B->FIRSTROW, firstelem, nrow,
+		   B->BUF_1K, &istat);
+  }
+
+  sprintf(BANNER,"batched fits_write_col for %s colnum=%d",
+	  snfitsType[itype], colnum );
+  snfitsio_errorCheck(BANNER, istat);
+
+  B->NBUF = 0 ;
+
+  return ;
+
+} // end of wr_snfitsio_batch_flushCol
+
+
+// ====================================
+void wr_snfitsio_batch_flushAll(void) {
+
+  // Created Aug 2026
+  // flush all batched PHOT columns; called before closing fits files.
+
+  int itype = ITYPE_SNFITSIO_PHOT ;
+  int colnum ;
+
+  for ( colnum=1; colnum <= NPAR_SNFITSIO[itype]; colnum++ )
+    { wr_snfitsio_batch_flushCol(colnum); }
+
+  return ;
+
+} // end of wr_snfitsio_batch_flushAll
+
+
 
 // ====================================
 void wr_snfitsio_update_phot(int ep) {
@@ -2050,6 +2291,9 @@ void  wr_snfitsio_update_spec(int imjd)  {
   PTRSPEC_MIN = WR_SNFITSIO_TABLEVAL[ITYPE_SNFITSIO_SPECTMP].NROW+1 ;
   PTRSPEC_MAX = PTRSPEC_MIN - 1 + NBLAM_WR ;
 
+  // Aug 2026: compact format has one row per spectrum
+  if ( SNFITSIO_SPEC_COMPACT_FLAG ) { PTRSPEC_MAX = PTRSPEC_MIN ; }
+
   // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - 
   // update summary table (one row per spectrum)
   itype = ITYPE_SNFITSIO_SPEC ;
@@ -2103,7 +2347,11 @@ void  wr_snfitsio_update_spec(int imjd)  {
   wr_snfitsio_fillTable ( ptrColnum, "PTRSPEC_MAX", itype );
 
 
-  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - 
+  // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+  // Aug 2026: check option to write one quantized row per spectrum
+  if ( SNFITSIO_SPEC_COMPACT_FLAG )
+    { wr_snfitsio_update_spec_compact(imjd);  return ; }
+
   // update spectrum table
   int    ilam, ILAM ;
   double GENFLAM, GENMAG, FLAM, FLAMERR, WARP ;
@@ -2170,6 +2418,145 @@ void  wr_snfitsio_update_spec(int imjd)  {
 } // end wr_snfitsio_update_spec
 
 
+// ==================================
+void wr_snfitsio_update_spec_compact(int imjd) {
+
+  // Created Aug 2026
+  // Write entire spectrum as ONE row of variable-length vector
+  // columns instead of one row per lambda bin. FLAM, FLAMERR and
+  // SIM_FLAM are quantized to 16 bits with a per-spectrum linear
+  // scale, Fphys = FMIN + FBIN*(q+32767), so the stored precision
+  // is (FMAX-FMIN)/65534 per spectrum. The shared lambda grid is
+  // already in SPECTRO_LAMINDEX, so only the sparse LAMINDEX list
+  // is repeated here. Cuts SPEC.FITS size by ~4x and avoids the
+  // per-bin fits_write_col overhead.
+
+  int  NBLAM_TOT = GENSPEC.NBLAM_TOT ;
+  int  itype     = ITYPE_SNFITSIO_SPECTMP ;
+  fitsfile *fp   = fp_snfitsFile[itype];
+
+  int    ilam, NBLAM_WR, icol, istat=0 ;
+  long   row, FIRSTELEM=1 ;
+  double FLAM, FLAMERR, GENFLAM, WARP ;
+  double FLAM_MIN, FLAM_MAX, FLAMERR_MIN, FLAMERR_MAX ;
+  double GENFLAM_MIN, GENFLAM_MAX, FLAM_BIN, FLAMERR_BIN, GENFLAM_BIN ;
+  float  scale_1E ;
+  short int *q_LAMINDEX, *q_FLAM, *q_FLAMERR, *q_GENFLAM, *q_WARP ;
+  int    MEMS = NBLAM_TOT * sizeof(short int);
+  //  char fnam[] = "wr_snfitsio_update_spec_compact" ;
+
+  // ----------- BEGIN ------------
+
+  q_LAMINDEX = (short int*) malloc(MEMS);
+  q_FLAM     = (short int*) malloc(MEMS);
+  q_FLAMERR  = (short int*) malloc(MEMS);
+  q_GENFLAM  = (short int*) malloc(MEMS);
+  q_WARP     = (short int*) malloc(MEMS);
+
+  // first pass: store sparse LAMINDEX list and get min/max
+  // of each quantity over valid bins.
+  NBLAM_WR = 0 ;
+  FLAM_MIN = FLAMERR_MIN = GENFLAM_MIN =  1.0E38 ;
+  FLAM_MAX = FLAMERR_MAX = GENFLAM_MAX = -1.0E38 ;
+
+  for(ilam=0; ilam < NBLAM_TOT; ilam++ ) {
+    FLAMERR = GENSPEC.FLAMERR_LIST[imjd][ilam];
+    if ( FLAMERR <= 0.0 ) { continue ; }  // skip unphysical values
+    FLAM    = GENSPEC.FLAM_LIST[imjd][ilam];
+    GENFLAM = GENSPEC.GENFLAM_LIST[imjd][ilam];
+
+    q_LAMINDEX[NBLAM_WR] = (short int)ilam ;
+    NBLAM_WR++ ;
+
+    if ( FLAM    < FLAM_MIN    ) { FLAM_MIN    = FLAM ; }
+    if ( FLAM    > FLAM_MAX    ) { FLAM_MAX    = FLAM ; }
+    if ( FLAMERR < FLAMERR_MIN ) { FLAMERR_MIN = FLAMERR ; }
+    if ( FLAMERR > FLAMERR_MAX ) { FLAMERR_MAX = FLAMERR ; }
+    if ( GENFLAM < GENFLAM_MIN ) { GENFLAM_MIN = GENFLAM ; }
+    if ( GENFLAM > GENFLAM_MAX ) { GENFLAM_MAX = GENFLAM ; }
+  }
+
+  // quantization bin size; guard against constant spectrum.
+  FLAM_BIN    = ( FLAM_MAX    - FLAM_MIN    ) / 65534.0 ;
+  FLAMERR_BIN = ( FLAMERR_MAX - FLAMERR_MIN ) / 65534.0 ;
+  GENFLAM_BIN = ( GENFLAM_MAX - GENFLAM_MIN ) / 65534.0 ;
+  if ( FLAM_BIN    <= 0.0 ) { FLAM_BIN    = 1.0 ; }
+  if ( FLAMERR_BIN <= 0.0 ) { FLAMERR_BIN = 1.0 ; }
+  if ( GENFLAM_BIN <= 0.0 ) { GENFLAM_BIN = 1.0 ; }
+
+  // second pass: quantize each valid bin
+  NBLAM_WR = 0 ;
+  for(ilam=0; ilam < NBLAM_TOT; ilam++ ) {
+    FLAMERR = GENSPEC.FLAMERR_LIST[imjd][ilam];
+    if ( FLAMERR <= 0.0 ) { continue ; }
+    FLAM    = GENSPEC.FLAM_LIST[imjd][ilam];
+    GENFLAM = GENSPEC.GENFLAM_LIST[imjd][ilam];
+    WARP    = GENSPEC.FLAMWARP_LIST[imjd][ilam];
+    if ( WARP > 30.0 ) { WARP = 30.0; } // avoid I*2 overflow
+
+    q_FLAM[NBLAM_WR] =
+      (short int)( (int)((FLAM   -FLAM_MIN)   /FLAM_BIN    + 0.5) - 32767 );
+    q_FLAMERR[NBLAM_WR] =
+      (short int)( (int)((FLAMERR-FLAMERR_MIN)/FLAMERR_BIN + 0.5) - 32767 );
+    q_GENFLAM[NBLAM_WR] =
+      (short int)( (int)((GENFLAM-GENFLAM_MIN)/GENFLAM_BIN + 0.5) - 32767 );
+    q_WARP[NBLAM_WR] = (short int)(WARP*1000.0 + 0.5) ;
+    NBLAM_WR++ ;
+  }
+
+  // write one table row with direct fits_write_col calls;
+  // column order matches wr_snfitsio_init_spec.
+  WR_SNFITSIO_TABLEVAL[itype].NROW++ ;
+  row  = WR_SNFITSIO_TABLEVAL[itype].NROW ;
+  icol = 0 ;
+
+  icol++ ;
+  fits_write_col(fp, TSHORT, icol, row, FIRSTELEM, NBLAM_WR,
+		 q_LAMINDEX, &istat );
+
+  icol++ ; scale_1E = (float)FLAM_MIN ;
+  fits_write_col(fp, TFLOAT, icol, row, FIRSTELEM, 1, &scale_1E, &istat );
+  icol++ ; scale_1E = (float)FLAM_BIN ;
+  fits_write_col(fp, TFLOAT, icol, row, FIRSTELEM, 1, &scale_1E, &istat );
+  icol++ ;
+  fits_write_col(fp, TSHORT, icol, row, FIRSTELEM, NBLAM_WR,
+		 q_FLAM, &istat );
+
+  icol++ ; scale_1E = (float)FLAMERR_MIN ;
+  fits_write_col(fp, TFLOAT, icol, row, FIRSTELEM, 1, &scale_1E, &istat );
+  icol++ ; scale_1E = (float)FLAMERR_BIN ;
+  fits_write_col(fp, TFLOAT, icol, row, FIRSTELEM, 1, &scale_1E, &istat );
+  icol++ ;
+  fits_write_col(fp, TSHORT, icol, row, FIRSTELEM, NBLAM_WR,
+		 q_FLAMERR, &istat );
+
+  if ( SNFITSIO_SIMFLAG_SNANA ) {
+    icol++ ; scale_1E = (float)GENFLAM_MIN ;
+    fits_write_col(fp, TFLOAT, icol, row, FIRSTELEM, 1, &scale_1E, &istat );
+    icol++ ; scale_1E = (float)GENFLAM_BIN ;
+    fits_write_col(fp, TFLOAT, icol, row, FIRSTELEM, 1, &scale_1E, &istat );
+    icol++ ;
+    fits_write_col(fp, TSHORT, icol, row, FIRSTELEM, NBLAM_WR,
+		   q_GENFLAM, &istat );
+  }
+
+  if ( GENSPEC.USE_WARP ) {
+    icol++ ;
+    fits_write_col(fp, TSHORT, icol, row, FIRSTELEM, NBLAM_WR,
+		   q_WARP, &istat );
+  }
+
+  sprintf(c1err,"write compact spectrum row %ld (imjd=%d)", row, imjd );
+  snfitsio_errorCheck(c1err, istat);
+
+  free(q_LAMINDEX); free(q_FLAM); free(q_FLAMERR);
+  free(q_GENFLAM);  free(q_WARP);
+
+  return ;
+
+} // end wr_snfitsio_update_spec_compact
+
+
 // ==================================
 int IPAR_SNFITSIO(int OPT, char *parName, int itype) {
 
@@ -2253,6 +2640,9 @@ void WR_SNFITSIO_END(void) {
 
   // ------------ BEGIN -------------
 
+  // write out any batched PHOT rows (Aug 2026)
+  wr_snfitsio_batch_flushAll();
+
   NTYPE = 2 ; // defult is HEAD + PHOT
 
   if ( SNFITSIO_SIMFLAG_SPECTROGRAPH ) { 
@@ -2294,6 +2684,125 @@ void wr_snfitsio_end__(void) {
   WR_SNFITSIO_END();
 }
 
+// ========================================
+void MERGE_SNFITSIO_SPLIT(int NSPLIT,
+			  char **headFile_list, char **photFile_list,
+			  char *headFile_out,  char *photFile_out) {
+
+  // Created Aug 2026
+  // Merge NSPLIT pairs of HEAD/PHOT fits files (e.g., written by
+  // forked generation jobs) into single headFile_out & photFile_out.
+  // PHOT tables are row-concatenated; HEAD tables are
+  // row-concatenated with PTROBS_MIN[MAX] shifted by the cumulative
+  // PHOT row count so that light-curve pointers stay valid in the
+  // merged file. Global header keys are taken from the first file.
+
+  fitsfile *fp_in, *fp_head, *fp_phot ;
+  int  i, istat=0, hdutype, anynul ;
+  int  icol_min, icol_max, *PTROBS_TMP, irow ;
+  long NROW, NROW_HEAD_SUM=0, NROW_PHOT_SUM=0 ;
+  long FIRSTROW, FIRSTELEM=1 ;
+  char keyName[40], comment[100] ;
+  char fnam[] = "MERGE_SNFITSIO_SPLIT" ;
+
+  // ------------ BEGIN -------------
+
+  sprintf(BANNER,"%s: merge %d HEAD/PHOT file pairs", fnam, NSPLIT );
+  print_banner(BANNER);
+
+  // create merged files as copies of the first split file
+  fits_create_file(&fp_head, headFile_out, &istat);
+  snfitsio_errorCheck("Create merged HEAD file", istat);
+  fits_open_file(&fp_in, headFile_list[0], READONLY, &istat);
+  snfitsio_errorCheck("Open first split HEAD file", istat);
+  fits_copy_file(fp_in, fp_head, 1, 1, 1, &istat);
+  fits_close_file(fp_in, &istat);
+  snfitsio_errorCheck("Copy first split HEAD file", istat);
+
+  fits_create_file(&fp_phot, photFile_out, &istat);
+  snfitsio_errorCheck("Create merged PHOT file", istat);
+  fits_open_file(&fp_in, photFile_list[0], READONLY, &istat);
+  snfitsio_errorCheck("Open first split PHOT file", istat);
+  fits_copy_file(fp_in, fp_phot, 1, 1, 1, &istat);
+  fits_close_file(fp_in, &istat);
+  snfitsio_errorCheck("Copy first split PHOT file", istat);
+
+  // position merged files on their binary tables & get row counts
+  sprintf(keyName,"%s", "NAXIS2");
+
+  fits_movabs_hdu(fp_head, 2, &hdutype, &istat);
+  fits_read_key(fp_head, TLONG, keyName, &NROW_HEAD_SUM, comment, &istat);
+  fits_movabs_hdu(fp_phot, 2, &hdutype, &istat);
+  fits_read_key(fp_phot, TLONG, keyName, &NROW_PHOT_SUM, comment, &istat);
+  snfitsio_errorCheck("Read NAXIS2 from first split files", istat);
+
+  fits_get_colnum(fp_head, CASEINSEN, "PTROBS_MIN", &icol_min, &istat);
+  fits_get_colnum(fp_head, CASEINSEN, "PTROBS_MAX", &icol_max, &istat);
+  snfitsio_errorCheck("Find PTROBS_MIN[MAX] columns", istat);
+
+  // - - - - - - - - - - - -
+  // append rows from remaining split files
+  for(i=1; i < NSPLIT; i++ ) {
+
+    // HEAD rows, with PTROBS shifted by current PHOT row count
+    fits_open_file(&fp_in, headFile_list[i], READONLY, &istat);
+    sprintf(c1err,"Open split HEAD file %d", i);
+    snfitsio_errorCheck(c1err, istat);
+    fits_movabs_hdu(fp_in, 2, &hdutype, &istat);
+    fits_read_key(fp_in, TLONG, keyName, &NROW, comment, &istat);
+    fits_copy_rows(fp_in, fp_head, 1, NROW, &istat);
+    fits_close_file(fp_in, &istat);
+    sprintf(c1err,"Append %ld HEAD rows from split %d", NROW, i);
+    snfitsio_errorCheck(c1err, istat);
+
+    PTROBS_TMP = (int*) malloc( NROW * sizeof(int) );
+    FIRSTROW   = NROW_HEAD_SUM + 1 ;
+
+    fits_read_col_int(fp_head, icol_min, FIRSTROW, FIRSTELEM, NROW,
+		      NULL_1J, PTROBS_TMP, &anynul, &istat );
+    for(irow=0; irow < NROW; irow++ )
+      { PTROBS_TMP[irow] += (int)NROW_PHOT_SUM ; }
+    fits_write_col(fp_head, TINT, icol_min, FIRSTROW, FIRSTELEM, NROW,
+		   PTROBS_TMP, &istat );
+
+    fits_read_col_int(fp_head, icol_max, FIRSTROW, FIRSTELEM, NROW,
+		      NULL_1J, PTROBS_TMP, &anynul, &istat );
+    for(irow=0; irow < NROW; irow++ )
+      { PTROBS_TMP[irow] += (int)NROW_PHOT_SUM ; }
+    fits_write_col(fp_head, TINT, icol_max, FIRSTROW, FIRSTELEM, NROW,
+		   PTROBS_TMP, &istat );
+
+    sprintf(c1err,"Shift PTROBS_MIN[MAX] for split %d", i);
+    snfitsio_errorCheck(c1err, istat);
+    free(PTROBS_TMP);
+    NROW_HEAD_SUM += NROW ;
+
+    // PHOT rows
+    fits_open_file(&fp_in, photFile_list[i], READONLY, &istat);
+    sprintf(c1err,"Open split PHOT file %d", i);
+    snfitsio_errorCheck(c1err, istat);
+    fits_movabs_hdu(fp_in, 2, &hdutype, &istat);
+    fits_read_key(fp_in, TLONG, keyName, &NROW, comment, &istat);
+    fits_copy_rows(fp_in, fp_phot, 1, NROW, &istat);
+    fits_close_file(fp_in, &istat);
+    sprintf(c1err,"Append %ld PHOT rows from split %d", NROW, i);
+    snfitsio_errorCheck(c1err, istat);
+    NROW_PHOT_SUM += NROW ;
+
+  } // end i loop over split files
+
+  fits_close_file(fp_head, &istat);
+  fits_close_file(fp_phot, &istat);
+  snfitsio_errorCheck("Close merged HEAD/PHOT files", istat);
+
+  printf("   Merged %ld HEAD rows and %ld PHOT rows. \n",
+	 NROW_HEAD_SUM, NROW_PHOT_SUM );
+  fflush(stdout);
+
+  return ;
+
+} // end MERGE_SNFITSIO_SPLIT
+
 // ========================================
 void snfitsio_close(int ifile, int itype) {
 
@@ -4339,16 +4848,42 @@ void  rd_snfitsio_specFile( int ifile ) {
   sprintf(c1err,"movrel to %s table", snfitsType[itype] ) ;
   snfitsio_errorCheck(c1err, istat);
 
+  // Aug 2026: check for compact format (one row per spectrum with
+  // quantized fluxes); flagged by 2nd column name = FLAM_MIN.
+  int  NCOL_FLUX ;
+  char colName[40];
+  RDSPEC_SNFITSIO_COMPACT_FLAG = false ;
+  fits_read_key(fp, TINT,    "TFIELDS", &NCOL_FLUX, comment, &istat );
+  fits_read_key(fp, TSTRING, "TTYPE2",  colName,    comment, &istat );
+  snfitsio_errorCheck("read SPECTRO_FLUX column info", istat);
+  RDSPEC_SNFITSIO_NCOL_FLUX = NCOL_FLUX ;
+  if ( strcmp(colName,"FLAM_MIN") == 0 ) {
+    RDSPEC_SNFITSIO_COMPACT_FLAG = true ;
+    printf("   Found compact SPECTRO_FLUX format "
+	   "(1 row/spectrum, quantized FLAM).\n"); fflush(stdout);
+  }
+
   return ;
 
 } // end rd_snfitsio_specFile
 
 
 // ====================================
-int RD_SNFITSIO_SPECROWS(char *SNID, int *ROWMIN, int *ROWMAX)  { 
+// Aug 2026: qsort compare for SNID-sorted spectrum rows;
+// ties broken by row number so equal-SNID blocks stay in row order.
+int compare_SPECROWS_SNID(const void *a, const void *b) {
+  int irow_a = *(const int*)a ;
+  int irow_b = *(const int*)b ;
+  int j = strcmp ( RDSPEC_SNFITSIO_HEADER.SNID[irow_a],
+		   RDSPEC_SNFITSIO_HEADER.SNID[irow_b] ) ;
+  if ( j != 0 ) { return j; }
+  return ( irow_a - irow_b ) ;
+}
+
+int RD_SNFITSIO_SPECROWS(char *SNID, int *ROWMIN, int *ROWMAX)  {
 
   // Apr 2019
-  // read spectra-HEADER table rows for this SNID, 
+  // read spectra-HEADER table rows for this SNID,
   // and return min and max rownum.
   // Inputs:
   //   *SNID   : SNID to search
@@ -4357,31 +4892,52 @@ int RD_SNFITSIO_SPECROWS(char *SNID, int *ROWMIN, int *ROWMAX)  {
   //   *ROWMIN, *ROWMAX : min and max rows for spectra
   //
   // Function returns number of spectra for this SNID (Mar 4 2021)
-  
-  int NROW = RDSPEC_SNFITSIO_HEADER.NROW; 
-  int irow, NSPEC = 0 ;
-  char *SNID_TMP;
+  //
+  // Aug 2026: replace per-call strcmp scan over all NROW spectra
+  // with binary search on a lazily built SNID-sorted row index;
+  // with one call per event the old scan was O(NROW^2) strcmp.
+
+  int NROW = RDSPEC_SNFITSIO_HEADER.NROW;
+  int *IROW_SORT = RDSPEC_SNFITSIO_HEADER.IROW_SNIDSORT ;
+  int irow, isort, lo, hi, mid, j, NSPEC = 0 ;
   //  char fnam[] = "RD_SNFITSIO_SPECROWS" ;
 
   // ------------ BEGIN -------------
 
   *ROWMIN = *ROWMAX = -9 ;
 
-  for(irow=0; irow < NROW; irow++ ) {
-    SNID_TMP = RDSPEC_SNFITSIO_HEADER.SNID[irow];
-    if ( strcmp(SNID_TMP,SNID) == 0 ) {
-      NSPEC++ ;
-      if ( *ROWMIN < 0 ) { *ROWMIN = irow; }
-      *ROWMAX = irow;
-    }
+  if ( NROW <= 0 ) { return(NSPEC); }
+
+  if ( !RDSPEC_SNFITSIO_HEADER.PREPFLAG_SNIDSORT ) {
+    for(irow=0; irow < NROW; irow++ ) { IROW_SORT[irow] = irow; }
+    qsort(IROW_SORT, NROW, sizeof(int), compare_SPECROWS_SNID );
+    RDSPEC_SNFITSIO_HEADER.PREPFLAG_SNIDSORT = 1 ;
   }
 
-  
+  // binary search for first sorted entry with SNID >= input SNID
+  lo = 0;  hi = NROW ;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2 ;
+    j = strcmp( RDSPEC_SNFITSIO_HEADER.SNID[IROW_SORT[mid]], SNID );
+    if ( j < 0 ) { lo = mid+1; }  else  { hi = mid; }
+  }
+
+  // walk matching block; ties sort by row, so first/last match
+  // give the min/max row numbers.
+  for ( isort=lo; isort < NROW; isort++ ) {
+    irow = IROW_SORT[isort] ;
+    if ( strcmp(RDSPEC_SNFITSIO_HEADER.SNID[irow],SNID) != 0 ) { break; }
+    NSPEC++ ;
+    if ( *ROWMIN < 0 ) { *ROWMIN = irow; }
+    *ROWMAX = irow;
+  }
+
+
   //  printf(" xxx %s: SNID=%s  ROW-range = %d to %d \n",
   //	 fnam, SNID, *ROWMIN, *ROWMAX );
-  
+
   return(NSPEC) ;
-  
+
 } // end RD_SNFITSIO_SPECROWS
 
 void rd_snfitsio_specrows__(char *SNID, int *ROWMIN, int *ROWMAX)  { 
@@ -4407,7 +4963,14 @@ void RD_SNFITSIO_SPECDATA(int irow,
     sprintf(c2err,"Valid irow must be > 0 ");
     errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
   }
-  fitsfile *fp = fp_snfitsFile[ITYPE_SNFITSIO_SPEC] ;  
+  // Aug 2026: check for compact format (1 row per spectrum)
+  if ( RDSPEC_SNFITSIO_COMPACT_FLAG ) {
+    rd_snfitsio_specdata_compact(irow, LAMMIN, LAMMAX,
+				 FLAM, FLAMERR, SIM_FLAM);
+    return ;
+  }
+
+  fitsfile *fp = fp_snfitsFile[ITYPE_SNFITSIO_SPEC] ;
   int NLAM     = RDSPEC_SNFITSIO_HEADER.NLAMBIN[irow] ;
   int PTRMIN   = RDSPEC_SNFITSIO_HEADER.PTRSPEC_MIN[irow];
   int PTRMAX   = RDSPEC_SNFITSIO_HEADER.PTRSPEC_MAX[irow];
@@ -4474,6 +5037,84 @@ void RD_SNFITSIO_SPECDATA(int irow,
 } // end RD_SNFITSIO_SPECFLUX
 
 
+// =========================================================
+void rd_snfitsio_specdata_compact(int irow,
+				  double *LAMMIN, double *LAMMAX,
+				  double *FLAM, double *FLAMERR,
+				  double *SIM_FLAM) {
+
+  // Created Aug 2026
+  // Read spectral data for 'irow' from compact SPECTRO_FLUX format:
+  // one fits row per spectrum with variable-length vector columns,
+  // and FLAM[ERR] quantized to 16 bits with a per-spectrum linear
+  // scale; Fphys = FMIN + FBIN*(q+32767). See
+  // wr_snfitsio_update_spec_compact for the write side.
+
+  fitsfile *fp = fp_snfitsFile[ITYPE_SNFITSIO_SPEC] ;
+  int NLAM     = RDSPEC_SNFITSIO_HEADER.NLAMBIN[irow] ;
+  int NCOL     = RDSPEC_SNFITSIO_NCOL_FLUX ;
+  int RDSIM    = ( NCOL >= 10 ) ; // SIM_FLAM columns exist
+
+  int    istat=0, icol, anynul, ilam, ILAM ;
+  long   ROW       = RDSPEC_SNFITSIO_HEADER.PTRSPEC_MIN[irow];
+  long   FIRSTELEM = 1 ;
+  float  FMIN_1E, FBIN_1E ;
+  double FMIN, FBIN ;
+  short int *q_LAMINDEX, *q_VAL ;
+  int    MEMS = NLAM * sizeof(short int);
+  //  char fnam[] = "rd_snfitsio_specdata_compact" ;
+
+  // --------------- BEGIN --------------
+
+  q_LAMINDEX = (short int*) malloc(MEMS);
+  q_VAL      = (short int*) malloc(MEMS);
+
+  // read sparse LAMINDEX list and transfer to LAMMIN & LAMMAX
+  icol=1 ;
+  fits_read_col_sht(fp, icol, ROW, FIRSTELEM, NLAM, NULL_1I,
+		    q_LAMINDEX, &anynul, &istat );
+  sprintf(c1err,"Read compact LAMINDEX for irow=%d", irow);
+  snfitsio_errorCheck(c1err, istat);
+
+  for(ilam=0; ilam < NLAM; ilam++ ) {
+    ILAM         = (int)q_LAMINDEX[ilam];
+    LAMMIN[ilam] = RDSPEC_SNFITSIO_LAMINDEX.LAMMIN_LIST[ILAM] ;
+    LAMMAX[ilam] = RDSPEC_SNFITSIO_LAMINDEX.LAMMAX_LIST[ILAM] ;
+  }
+
+  // read scale + quantized vector for FLAM, FLAMERR, SIM_FLAM
+  int ival, NVAL = RDSIM ? 3 : 2 ;
+  double *ptrVal_LIST[3] = { FLAM, FLAMERR, SIM_FLAM } ;
+
+  icol = 1 ;
+  for(ival=0; ival < NVAL; ival++ ) {
+    icol++ ; istat=0;
+    fits_read_col_flt(fp, icol, ROW, FIRSTELEM, 1, NULL_1E,
+		      &FMIN_1E, &anynul, &istat );
+    icol++ ;
+    fits_read_col_flt(fp, icol, ROW, FIRSTELEM, 1, NULL_1E,
+		      &FBIN_1E, &anynul, &istat );
+    icol++ ;
+    fits_read_col_sht(fp, icol, ROW, FIRSTELEM, NLAM, NULL_1I,
+		      q_VAL, &anynul, &istat );
+    sprintf(c1err,"Read compact flux (ival=%d) for irow=%d", ival, irow);
+    snfitsio_errorCheck(c1err, istat);
+
+    FMIN = (double)FMIN_1E ;  FBIN = (double)FBIN_1E ;
+    for(ilam=0; ilam < NLAM; ilam++ )
+      { ptrVal_LIST[ival][ilam] = FMIN + FBIN*(double)(q_VAL[ilam]+32767); }
+  }
+
+  if ( !RDSIM ) {
+    for(ilam=0; ilam < NLAM; ilam++ ) { SIM_FLAM[ilam] = 0.0 ; }
+  }
+
+  free(q_LAMINDEX);  free(q_VAL);
+  return ;
+
+} // end rd_snfitsio_specdata_compact
+
+
 // =========================================
 void  rd_snfitsio_mallocSpec(int opt) {
 
@@ -4500,9 +5141,12 @@ void  rd_snfitsio_mallocSpec(int opt) {
     RDSPEC_SNFITSIO_HEADER.PTRSPEC_MAX = (int    *) malloc (MEMI) ;
 
     RDSPEC_SNFITSIO_HEADER.SNID  = (char**) malloc (MEMC) ;
-    for(irow=0; irow<NROW; irow++ ) 
+    for(irow=0; irow<NROW; irow++ )
       { RDSPEC_SNFITSIO_HEADER.SNID[irow] = (char*) malloc(MEMSNID);}
 
+    RDSPEC_SNFITSIO_HEADER.IROW_SNIDSORT    = (int *) malloc (MEMI) ;
+    RDSPEC_SNFITSIO_HEADER.PREPFLAG_SNIDSORT = 0 ;
+
   }
   else {
     free(RDSPEC_SNFITSIO_HEADER.MJD);
@@ -4511,9 +5155,12 @@ void  rd_snfitsio_mallocSpec(int opt) {
     free(RDSPEC_SNFITSIO_HEADER.PTRSPEC_MIN );
     free(RDSPEC_SNFITSIO_HEADER.PTRSPEC_MAX );
 
-    for(irow=0; irow<NROW; irow++ ) 
+    for(irow=0; irow<NROW; irow++ )
       { free(RDSPEC_SNFITSIO_HEADER.SNID[irow] ); }
     free(RDSPEC_SNFITSIO_HEADER.SNID);
+
+    free(RDSPEC_SNFITSIO_HEADER.IROW_SNIDSORT);
+    RDSPEC_SNFITSIO_HEADER.PREPFLAG_SNIDSORT = 0 ;
   }
 
 
@@ -89,6 +89,8 @@ bool  SNFITSIO_SIMFLAG_SNRMON      ;   // SNR(MAGMONITOR)
 bool  SNFITSIO_SIMFLAG_MODELPAR    ;   // model params for SIMSED, LCLIB
 bool  SNFITSIO_SIMFLAG_NBR_LIST    ;   // HOSTLIB has NBR_LIST (Feb 2020)
 bool  SNFITSIO_COMPACT_FLAG ;    // Jan 2018
+bool  SNFITSIO_SPEC_COMPACT_FLAG ; // Aug 2026: 1 row/spectrum, quantized FLAM
+bool  SNFITSIO_GZIP_FLAG ;       // Aug 2026: write gzip-compressed .FITS.gz
 
 // xxx int  SNFITSIO_SUBSURVEY_FLAG ;  // indicates subSurvey column
 int  SNFITSIO_NSUBSAMPLE_MARK ; // indicates how many marked sub-samples
@@ -133,6 +135,27 @@ struct WR_TABLEVAL_DEF {
 } WR_SNFITSIO_TABLEVAL[MXTYPE_SNFITSIO] ;  // index is itype
 
 
+// Aug 2026: batch buffers for per-epoch PHOT writes. Each column
+// accumulates up to MXROW_WRBATCH_SNFITSIO contiguous rows that get
+// flushed with one multi-row fits_write_col call instead of one
+// cfitsio call per epoch; see wr_snfitsio_batch_add/flushCol.
+#define MXROW_WRBATCH_SNFITSIO  20000  // rows buffered per column
+#define MXCHAR_WRBATCH_SNFITSIO 40     // max len of buffered string
+
+typedef struct {
+  int  NBUF ;          // number of buffered rows
+  long FIRSTROW ;      // fits row number of first buffered value
+  double    *BUF_1D ;  // only the buffer matching the column form
+  float     *BUF_1E ;  //   is malloced (on first use)
+  int       *BUF_1J ;
+  short     *BUF_1I ;
+  long long *BUF_1K ;
+  char     **BUF_A ;
+} WRBATCH_COL_DEF ;
+
+WRBATCH_COL_DEF WRBATCH_SNFITSIO[MXPAR_SNFITSIO] ; // vs. PHOT colnum
+
+
 #define IFORM_A   1
 #define IFORM_1J  2
 #define IFORM_1I  3
@@ -199,8 +222,19 @@ struct {
   double *MJD;
   float  *TEXPOSE;
   int    *PTRSPEC_MIN, *PTRSPEC_MAX ;
+
+  // Aug 2026: row numbers sorted by SNID (ties by row), built on
+  // first RD_SNFITSIO_SPECROWS call so per-SNID row lookups are a
+  // binary search instead of a strcmp scan over every spectrum row.
+  int     PREPFLAG_SNIDSORT ;
+  int    *IROW_SNIDSORT ;
 } RDSPEC_SNFITSIO_HEADER ;
 
+// Aug 2026: flag that SPECTRO_FLUX table has compact format
+// (one row per spectrum with vector columns & quantized fluxes)
+bool RDSPEC_SNFITSIO_COMPACT_FLAG ;
+int  RDSPEC_SNFITSIO_NCOL_FLUX ;   // number of SPECTRO_FLUX columns
+
 // ================================================
 // ============= FUNCTION PROTOTYPES ==============
 // ================================================
@@ -223,10 +257,18 @@ void WR_SNFITSIO_UPDATE(void);
 void wr_snfitsio_update_head(void);
 void wr_snfitsio_update_phot(int ep);
 void wr_snfitsio_update_spec(int imjd);
+void wr_snfitsio_update_spec_compact(int imjd);
 void wr_snfitsio_fillTable(int *COLNUM, char *parName, int itype );
+void wr_snfitsio_batch_add(int colnum, char *parName, int itype );
+void wr_snfitsio_batch_flushCol(int colnum);
+void wr_snfitsio_batch_flushAll(void);
 
 void WR_SNFITSIO_END(void);
 
+void MERGE_SNFITSIO_SPLIT(int NSPLIT,
+			  char **headFile_list, char **photFile_list,
+			  char *headFile_out,  char *photFile_out);
+
 void snfitsio_close(int ifile, int itype);
 void snfitsio_errorCheck(char *comment, int status);
 int  IPAR_SNFITSIO(int OPT, char *parName, int itype );
@@ -253,7 +295,11 @@ void  rd_snfitsio_head(int ifile);
 void  rd_snfitsio_tblpar(int ifile, int itype);
 void  rd_snfitsio_tblcol(int itype, int icol, int firstRow, int lastRow);
 
-void  rd_snfitsio_specFile(int ifile); 
+void  rd_snfitsio_specFile(int ifile);
+void  rd_snfitsio_specdata_compact(int irow,
+				   double *LAMMIN, double *LAMMAX,
+				   double *FLAM, double *FLAMERR,
+				   double *SIM_FLAM); 
 void  rd_snfitsio_mallocSpec(int opt);
 
 int RD_SNFITSIO_PARVAL(int isn, char *parName, 
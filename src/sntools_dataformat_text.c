@@ -14,6 +14,11 @@
   Analogous to sntools_dataformat_fits.c[h], here we use
   the SNDATA structure to pass the data.
 
+     HISTORY
+  Aug 2026: speed up reading of OBS/SPEC rows: store pointers into
+            the word store instead of copying every column string,
+            and convert values with strtod instead of sscanf.
+
 *************************************************/
 
 #include  "sntools.h"
@@ -29,6 +34,11 @@ void WR_SNTEXTIO_DATAFILE(char *OUTFILE) {
   // Driver function to write single data file for single event.
   //
 
+  // Aug 2026: buffer entire event in memory so each data file is
+  // written with a few large write() calls instead of one per line;
+  // reduces I/O stall between events when writing many text files.
+  static char WRBUF_EVENT[MXCHAR_WRBUF_SNTEXTIO] ;
+
   FILE *fp ;
   char fnam[] = "WR_SNTEXTIO_DATAFILE" ;
 
@@ -38,9 +48,11 @@ void WR_SNTEXTIO_DATAFILE(char *OUTFILE) {
   if ( !fp ) {
     sprintf(c1err,"Could not open data text file");
     sprintf(c2err,"%s", OUTFILE);
-    errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
   }
 
+  setvbuf(fp, WRBUF_EVENT, _IOFBF, MXCHAR_WRBUF_SNTEXTIO );
+
   wr_dataformat_text_HEADER(fp);
 
   wr_dataformat_text_SNPHOT(fp);
@@ -1511,9 +1523,13 @@ void RD_SNTEXTIO_EVENT(int OPTMASK, int ifile_inp) {
     if ( NOBS_NaN > 0 ) {
       sprintf(c1err,"Found %d NaN errors for CID=%s", NOBS_NaN, SNDATA.CCID);
       sprintf(c2err,"Fix your TEXT formatted data files");
-      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
     }
 
+    // Aug 2026: check option to merge duplicate epochs
+    if ( (OPTMASK & OPTMASK_TEXT_DUPMERGE) > 0 )
+      { merge_duplicate_epochs_sntextio(); }
+
   } // end LRD_OBS
 
   // - - - -
@@ -2191,6 +2207,8 @@ bool parse_SNTEXTIO_OBS(int *iwd_file) {
   // finding NOBS key.
   //
   // Apr 2 2021: use get_dbl_sntextio_obs to check for NaN
+  // Aug 2026: store word pointers instead of copying every column
+  //           string; only registered IVAROBS columns are parsed.
 
   int  langC     = LANGFLAG_PARSE_WORDS_C ;
   int  iwd       = *iwd_file ;
@@ -2199,7 +2217,6 @@ bool parse_SNTEXTIO_OBS(int *iwd_file) {
   float PSF_FWHM ;
   double dval;
   char word0[100], PREFIX[40], KEY_TEST[80], *varName, *str;
-  char STRING[40];  
   char fnam[] = "parse_SNTEXTIO_OBS";
 
   // ------------ BEGIN -----------
@@ -2213,31 +2230,31 @@ bool parse_SNTEXTIO_OBS(int *iwd_file) {
 
   if ( strcmp(word0,"OBS:") == 0 ) {
     for(ivar=0; ivar < NVAR; ivar++ ) {
-      iwd++ ;   get_PARSE_WORD(langC, iwd, STRING);
-      if ( strcmp(STRING,"OBS:") == 0 ) {
+      iwd++ ;   str = get_PARSE_WORD_PTR(iwd);
+      if ( strcmp(str,"OBS:") == 0 ) {
 	sprintf(c1err,"Found OBS key at ivar=%d of %d (last MJD=%.3f)",
 		ivar, NVAR, SNDATA.MJD[ep]);
 	sprintf(c2err,"Data file for SNID=%s is messed up.", SNDATA.CCID);
-	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);  
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
       }
-      sprintf(SNTEXTIO_FILE_INFO.STRING_LIST[ivar],"%s", STRING);
-      
+      SNTEXTIO_FILE_INFO.WORD_PTR_LIST[ivar] = str ;
+
     }
 
     SNTEXTIO_FILE_INFO.NOBS_READ++ ;
     ep = SNTEXTIO_FILE_INFO.NOBS_READ ; // ep starts at 1 for SNDATA struct
 
     // require MJD in first column
-    str = SNTEXTIO_FILE_INFO.STRING_LIST[IVAROBS_SNTEXTIO.MJD] ;
-    sscanf(str, "%le", &SNDATA.MJD[ep] );
+    str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVAROBS_SNTEXTIO.MJD] ;
+    SNDATA.MJD[ep] = strtod(str, NULL);
     SNDATA.OBSFLAG_WRITE[ep] = true ;
 
-    str = SNTEXTIO_FILE_INFO.STRING_LIST[IVAROBS_SNTEXTIO.BAND] ;
+    str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVAROBS_SNTEXTIO.BAND] ;
     sprintf(SNDATA.FILTCHAR[ep], "%s", str);
     catVarList_with_comma(SNDATA.FILTCHAR_1D,str);
 
-    str = SNTEXTIO_FILE_INFO.STRING_LIST[IVAROBS_SNTEXTIO.FIELD] ;
-    if ( strcmp(str,"NULL") == 0 ) { sprintf(str,FIELD_NONAME); }
+    str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVAROBS_SNTEXTIO.FIELD] ;
+    if ( strcmp(str,"NULL") == 0 ) { str = FIELD_NONAME ; }
     sprintf(SNDATA.FIELDNAME[ep], "%s", str);
     catVarList_with_comma(SNDATA.FIELDNAME_1D,str);
 
@@ -2253,11 +2270,11 @@ bool parse_SNTEXTIO_OBS(int *iwd_file) {
     }
 
     if ( IVAROBS_SNTEXTIO.PHOTFLAG >= 0 ) {
-      str = SNTEXTIO_FILE_INFO.STRING_LIST[IVAROBS_SNTEXTIO.PHOTFLAG] ;
+      str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVAROBS_SNTEXTIO.PHOTFLAG] ;
       sscanf(str, "%d", &SNDATA.PHOTFLAG[ep] );
     }
     if ( IVAROBS_SNTEXTIO.PHOTPROB >= 0 ) {
-      str = SNTEXTIO_FILE_INFO.STRING_LIST[IVAROBS_SNTEXTIO.PHOTPROB] ;
+      str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVAROBS_SNTEXTIO.PHOTPROB] ;
       sscanf(str, "%f", &SNDATA.PHOTPROB[ep] ) ;
     }
 
@@ -2312,13 +2329,13 @@ bool parse_SNTEXTIO_OBS(int *iwd_file) {
     }
 
     if ( IVAROBS_SNTEXTIO.CCDNUM >= 0 ) {
-      str = SNTEXTIO_FILE_INFO.STRING_LIST[IVAROBS_SNTEXTIO.CCDNUM] ;
+      str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVAROBS_SNTEXTIO.CCDNUM] ;
       sscanf(str, "%d", &SNDATA.CCDNUM[ep] );
     }
 
     // - - -
     if ( IVAROBS_SNTEXTIO.SIMEPOCH_MAG >= 0 ) {
-      str = SNTEXTIO_FILE_INFO.STRING_LIST[IVAROBS_SNTEXTIO.SIMEPOCH_MAG] ;
+      str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVAROBS_SNTEXTIO.SIMEPOCH_MAG] ;
       sscanf(str, "%f", &SNDATA.SIMEPOCH_MAG[ep] );
     }
 
@@ -2348,12 +2365,14 @@ double get_dbl_sntextio_obs(int IVAROBS, int ep) {
   //
   // If value is NaN, increment global NaN counter.
   //
+  // Aug 2026: use strtod instead of sscanf("%le"); same result,
+  //           but avoids format-string parsing in this hot loop.
 
-  char *str     = SNTEXTIO_FILE_INFO.STRING_LIST[IVAROBS] ;
+  char *str     = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVAROBS] ;
   char *varName = SNTEXTIO_FILE_INFO.VARNAME_OBS_LIST[IVAROBS] ;
   double dval;
 
-  sscanf(str, "%le", &dval );
+  dval = strtod(str, NULL);
   if ( isnan(dval) ) { 
     printf(" ERROR: %s = NaN for CID=%s  MJD=%.4f  BAND=%s\n", 
 	   varName, SNDATA.CCID, SNDATA.MJD[ep], SNDATA.FILTCHAR[ep] );
@@ -2364,6 +2383,122 @@ double get_dbl_sntextio_obs(int IVAROBS, int ep) {
 
 } // end get_dbl_sntextio_obs
 
+
+// =====================================================
+int compare_EPSORT_sntextio(const void *a, const void *b) {
+
+  // Created Aug 2026
+  // qsort-comparator to sort epoch indices by MJD, then band, then
+  // field; ties broken by original index for deterministic order.
+
+  int ep_a = *(const int*)a ;
+  int ep_b = *(const int*)b ;
+  int j ;
+
+  if ( SNDATA.MJD[ep_a] > SNDATA.MJD[ep_b] ) { return  1; }
+  if ( SNDATA.MJD[ep_a] < SNDATA.MJD[ep_b] ) { return -1; }
+
+  j = strcmp(SNDATA.FILTCHAR[ep_a], SNDATA.FILTCHAR[ep_b]);
+  if ( j != 0 ) { return j; }
+
+  j = strcmp(SNDATA.FIELDNAME[ep_a], SNDATA.FIELDNAME[ep_b]);
+  if ( j != 0 ) { return j; }
+
+  return ep_a - ep_b ;
+
+} // end compare_EPSORT_sntextio
+
+
+// =====================================================
+void merge_duplicate_epochs_sntextio(void) {
+
+  // Created Aug 2026
+  // Merge duplicate observations (same band & field, and MJD
+  // matching within MJDTOL_DUPMERGE_SNTEXTIO) for the current event,
+  // using a single sort pass over the epoch list. Duplicates occur
+  // in alert-archive data where the same exposure is reported more
+  // than once. The inverse-variance weighted flux is loaded into the
+  // duplicate with the lowest epoch index, PHOTFLAG bits are OR'd,
+  // and the other duplicates get OBSFLAG_WRITE=false so that every
+  // writer drops them; NOBS is reduced to match.
+  // Enabled with OPTMASK_TEXT_DUPMERGE bit of RD_SNTEXTIO_EVENT.
+
+  int    NOBS = SNDATA.NOBS ;
+  int    EPSORT[MXEPOCH];
+  int    i, i0, i1, ep, ep0, ep_keep, NMERGE = 0 ;
+  double w, wsum, fsum, ERR ;
+  //  char fnam[] = "merge_duplicate_epochs_sntextio" ;
+
+  // ------------- BEGIN -------------
+
+  if ( NOBS < 2 ) { return; }
+
+  for ( i=0; i < NOBS; i++ ) { EPSORT[i] = i + 1 ; } // SNDATA starts at 1
+  qsort(EPSORT, NOBS, sizeof(int), compare_EPSORT_sntextio );
+
+  i0 = 0 ;
+  while ( i0 < NOBS ) {
+
+    // find end of duplicate block starting at sorted index i0
+    ep0 = EPSORT[i0] ;
+    i1  = i0 ;
+    while ( i1 < NOBS-1 ) {
+      ep = EPSORT[i1+1] ;
+      if ( strcmp(SNDATA.FILTCHAR[ep0], SNDATA.FILTCHAR[ep]) != 0 )
+	{ break ; }
+      if ( strcmp(SNDATA.FIELDNAME[ep0],SNDATA.FIELDNAME[ep]) != 0 )
+	{ break ; }
+      if ( SNDATA.MJD[ep] - SNDATA.MJD[ep0] > MJDTOL_DUPMERGE_SNTEXTIO )
+	{ break ; }
+      i1++ ;
+    }
+
+    if ( i1 > i0 ) {
+
+      // keep duplicate with lowest epoch index -> output order
+      // follows the original file
+      ep_keep = EPSORT[i0] ;
+      for ( i=i0+1; i <= i1; i++ )
+	{ if ( EPSORT[i] < ep_keep ) { ep_keep = EPSORT[i]; } }
+
+      wsum = fsum = 0.0 ;
+      for ( i=i0; i <= i1; i++ ) {
+	ep  = EPSORT[i] ;
+	ERR = (double)SNDATA.FLUXCAL_ERRTOT[ep] ;
+	if ( ERR > 0.0 ) {
+	  w     = 1.0/(ERR*ERR) ;
+	  wsum += w ;
+	  fsum += w * (double)SNDATA.FLUXCAL[ep] ;
+	}
+	SNDATA.PHOTFLAG[ep_keep] |= SNDATA.PHOTFLAG[ep] ;
+	if ( ep != ep_keep ) { SNDATA.OBSFLAG_WRITE[ep] = false ; }
+      }
+
+      // if no positive error, keep original flux of ep_keep
+      if ( wsum > 0.0 ) {
+	SNDATA.FLUXCAL[ep_keep]        = (float)(fsum/wsum) ;
+	SNDATA.FLUXCAL_ERRTOT[ep_keep] = (float)sqrt(1.0/wsum) ;
+      }
+
+      NMERGE += (i1 - i0) ;
+    }
+
+    i0 = i1 + 1 ;
+
+  } // end while over sorted epochs
+
+  if ( NMERGE > 0 ) {
+    SNDATA.NOBS -= NMERGE ;
+    printf("\t Merged %d duplicate epochs for CID=%s (NOBS=%d)\n",
+	   NMERGE, SNDATA.CCID, SNDATA.NOBS );
+    fflush(stdout);
+  }
+
+  return ;
+
+} // end merge_duplicate_epochs_sntextio
+
+
 // =====================================
 bool parse_SNTEXTIO_SPEC(int *iwd_file) {
 
@@ -2432,31 +2567,31 @@ bool parse_SNTEXTIO_SPEC(int *iwd_file) {
 
   else if ( strcmp(word0,"SPEC:") == 0 ) {
     for ( ivar=0; ivar < SNTEXTIO_FILE_INFO.NVARSPEC ; ivar++ ) {
-      iwd++; get_PARSE_WORD(langC, iwd, SNTEXTIO_FILE_INFO.STRING_LIST[ivar] );
+      iwd++; SNTEXTIO_FILE_INFO.WORD_PTR_LIST[ivar] = get_PARSE_WORD_PTR(iwd);
     }
 
     ilam = SNTEXTIO_FILE_INFO.NLAM_READ ; // ilam starts at 0
     SNTEXTIO_FILE_INFO.NLAM_READ++ ;
 
-    str = SNTEXTIO_FILE_INFO.STRING_LIST[IVARSPEC_SNTEXTIO.LAMMIN] ;
-    sscanf(str, "%le", &GENSPEC.LAMMIN_LIST[ISPEC][ilam]) ;
+    str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVARSPEC_SNTEXTIO.LAMMIN] ;
+    GENSPEC.LAMMIN_LIST[ISPEC][ilam] = strtod(str, NULL);
 
-    str = SNTEXTIO_FILE_INFO.STRING_LIST[IVARSPEC_SNTEXTIO.LAMMAX] ;
-    sscanf(str, "%le", &GENSPEC.LAMMAX_LIST[ISPEC][ilam]) ;
+    str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVARSPEC_SNTEXTIO.LAMMAX] ;
+    GENSPEC.LAMMAX_LIST[ISPEC][ilam] = strtod(str, NULL);
 
-    str = SNTEXTIO_FILE_INFO.STRING_LIST[IVARSPEC_SNTEXTIO.FLAM] ;
-    sscanf(str, "%le", &GENSPEC.FLAM_LIST[ISPEC][ilam]) ;
+    str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVARSPEC_SNTEXTIO.FLAM] ;
+    GENSPEC.FLAM_LIST[ISPEC][ilam] = strtod(str, NULL);
 
-    str = SNTEXTIO_FILE_INFO.STRING_LIST[IVARSPEC_SNTEXTIO.FLAMERR] ;
-    sscanf(str, "%le", &GENSPEC.FLAMERR_LIST[ISPEC][ilam]) ;
+    str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVARSPEC_SNTEXTIO.FLAMERR] ;
+    GENSPEC.FLAMERR_LIST[ISPEC][ilam] = strtod(str, NULL);
 
     if ( IVARSPEC_SNTEXTIO.SIM_GENFLAM >= 0 ) {
-      str = SNTEXTIO_FILE_INFO.STRING_LIST[IVARSPEC_SNTEXTIO.SIM_GENFLAM] ;
-      sscanf(str, "%le", &GENSPEC.GENFLAM_LIST[ISPEC][ilam]) ;
+      str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVARSPEC_SNTEXTIO.SIM_GENFLAM] ;
+      GENSPEC.GENFLAM_LIST[ISPEC][ilam] = strtod(str, NULL);
     }
     if ( IVARSPEC_SNTEXTIO.SIM_GENMAG >= 0 ) {
-      str = SNTEXTIO_FILE_INFO.STRING_LIST[IVARSPEC_SNTEXTIO.SIM_GENMAG] ;
-      sscanf(str, "%le", &GENSPEC.GENMAG_LIST[ISPEC][ilam]) ;
+      str = SNTEXTIO_FILE_INFO.WORD_PTR_LIST[IVARSPEC_SNTEXTIO.SIM_GENMAG] ;
+      GENSPEC.GENMAG_LIST[ISPEC][ilam] = strtod(str, NULL);
     }
     //
   }
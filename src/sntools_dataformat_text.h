@@ -2,6 +2,11 @@
 #define OPTMASK_TEXT_HEAD 2  // matches snana.car
 #define OPTMASK_TEXT_OBS  4
 #define OPTMASK_TEXT_SPEC 8
+#define OPTMASK_TEXT_DUPMERGE 16 // Aug 2026: sort-merge duplicate epochs
+
+// Aug 2026: two obs in same band & field within this MJD tolerance
+// are treated as duplicates of the same exposure (DUPMERGE option)
+#define MJDTOL_DUPMERGE_SNTEXTIO 1.0E-4   // days
 
 // define indices for required header keys to trap common
 // mistakes in creating text data files
@@ -17,6 +22,11 @@
 #define MSKOPT_PARSE_TEXT_FILE  MSKOPT_PARSE_WORDS_FILE + MSKOPT_PARSE_WORDS_IGNORECOMMENT
 
 #define MXVAROBS_TEXT 20
+
+// Aug 2026: stdio buffer size for writing each event's data file;
+// large enough to hold a typical event so the file goes out in a
+// few big writes (fclose flushes whatever remains).
+#define MXCHAR_WRBUF_SNTEXTIO 1000000
 struct {
   int MJD, BAND, FIELD, FLUXCAL, FLUXCALERR, MAG, MAGERR ;
   int ZPFLUX, ZPERR, PSF_FWHM, PSF_SIG, NEA;
@@ -51,7 +61,9 @@ struct {
 
   char VARNAME_OBS_LIST[MXVAROBS_TEXT][32] ;   // OBS-column names
   char VARNAME_SPEC_LIST[MXVAROBS_TEXT][32] ;  // SPEC-column names
-  char STRING_LIST[MXVAROBS_TEXT][20] ;   // string values per OBS row
+  // Aug 2026: store pointers into word store (no copy) for each
+  // OBS/SPEC row; valid only until next store_PARSE_WORDS call.
+  char *WORD_PTR_LIST[MXVAROBS_TEXT] ;
 
   int NOBS_READ, NOBS_NaN ;
   int NSPEC_READ ;
@@ -101,3 +113,6 @@ void check_head_sntextio(int OPT);
 
 double get_dbl_sntextio_obs(int IVAROBS, int ep);
 
+int  compare_EPSORT_sntextio(const void *a, const void *b);
+void merge_duplicate_epochs_sntextio(void);
+
@@ -8,9 +8,14 @@
   This code will eventually replace the legacy codes in 
   sntools_fluxErrModels.c[h].
 
-  Mar 16 2019: 
+  Mar 16 2019:
     refactor INIT_FLUXERRMODEL to use read_GRIDMAP, and to read OPT_EXTRAP.
 
+  Aug 2026:
+    speed up per-observation calls: cache resolved BAND+FIELD -> imap
+    in INDEX_MAP_FLUXERRMODEL (skip string matching after first use),
+    and keep a persistent interp hint per map in get_FLUXERRMODEL.
+
 ****************************************************/
 
 /*
@@ -76,9 +81,10 @@ void INIT_FLUXERRMODEL(int OPTMASK, char *fileName,
   // ------------ BEGIN --------------
 
   NMAP_FLUXERRMODEL          = 0 ;
-  FLUXERR_FIELDGROUP.NDEFINE = 0 ;  
+  FLUXERR_FIELDGROUP.NDEFINE = 0 ;
   NINDEX_SPARSE_FLUXERRMAP   = 0 ;
   NREDCOV_FLUXERRMODEL       = 0 ;
+  INDEX_MAP_CACHE_FLUXERRMODEL.NCACHE = 0 ; // Aug 2026
 
   if ( IGNOREFILE(fileName) ) { return ; }
 
@@ -241,7 +247,11 @@ void INIT_FLUXERRMODEL(int OPTMASK, char *fileName,
 
       IDMAP = IDGRIDMAP_FLUXERRMODEL_OFFSET + NMAP ;
       NDIM  = NVAR-1;  NFUN=1;
-      read_GRIDMAP(fp, "FLUXERR", "ROW:", "ENDMAP:", 
+
+      // Aug 2026: enable binary side-cache of parsed map
+      set_GRIDMAP_CACHE_SOURCE(fullName);
+
+      read_GRIDMAP(fp, "FLUXERR", "ROW:", "ENDMAP:",
 		   IDMAP, NDIM, NFUN, OPT_EXTRAP,
 		   MXROW_FLUXERRMAP, fnam, 
 		   &FLUXERRMAP[NMAP].MAP );  // <== returned		   
@@ -725,6 +735,7 @@ void get_FLUXERRMODEL(int OPT, double FLUXERR_IN, char *BAND, char *FIELD,
   int LDMP = 0 ;
   double FLUXERR_TMP, errModelVal, parList[MXPAR_FLUXERRMAP] ;
   char *tmpString ;
+  static GRIDMAP_HINT_DEF HINT_FLUXERRMAP[MXMAP_FLUXERRMAP] ; // Aug 2026
   char fnam[] = "get_FLUXERRMODEL";
 
   // ----------- BEGIN -------------
@@ -769,7 +780,8 @@ void get_FLUXERRMODEL(int OPT, double FLUXERR_IN, char *BAND, char *FIELD,
   // errModelVal is the error scale from map
   IDMAP = IDGRIDMAP_FLUXERRMODEL_OFFSET + imap ;
   load_parList_FLUXERRMAP(imap, PARLIST, parList);
-  istat = interp_GRIDMAP( &FLUXERRMAP[imap].MAP, parList, &errModelVal);
+  istat = interp_GRIDMAP_HINT( &FLUXERRMAP[imap].MAP, parList, &errModelVal,
+			       &HINT_FLUXERRMAP[imap] );
   
   if ( LDMP || istat<0 ) {
     char cparList[100] ;  cparList[0] = 0 ;
@@ -856,15 +868,28 @@ int INDEX_MAP_FLUXERRMODEL(char *BAND, char *FIELD, char *FUNCALL) {
   // Created Jan 22, 2020
   // For input BAND and FIELD, return index of map for FLUXERRMODEL.
   // FUNCALL is calling function, and used only for error message.
+  //
+  // Aug 2026: cache resolved index per BAND x FIELD so the string
+  //   matching below runs once per combination, not per observation.
 
-  int NMAP = NMAP_FLUXERRMODEL; 
-  int  imap, IMAP=-9, NMATCH=0 ;
+  int NMAP = NMAP_FLUXERRMODEL;
+  int  imap, icache, NCACHE, IMAP=-9, NMATCH=0 ;
   bool MATCH_BAND, MATCH_FIELD;
   char *tmpString ;
   char fnam[] = "INDEX_MAP_FLUXERRMODEL" ;
 
   // ------------ BEGIN ---------
 
+  // check cache of already-resolved BAND+FIELD combinations
+  NCACHE = INDEX_MAP_CACHE_FLUXERRMODEL.NCACHE ;
+  for(icache=0; icache < NCACHE; icache++ ) {
+    if ( strcmp(INDEX_MAP_CACHE_FLUXERRMODEL.BAND[icache],BAND)   != 0 )
+      { continue ; }
+    if ( strcmp(INDEX_MAP_CACHE_FLUXERRMODEL.FIELD[icache],FIELD) != 0 )
+      { continue ; }
+    return INDEX_MAP_CACHE_FLUXERRMODEL.IMAP[icache] ;
+  }
+
   for(imap=0; imap < NMAP; imap++ ) {
     MATCH_BAND = MATCH_FIELD = false ;
 
@@ -893,9 +918,17 @@ int INDEX_MAP_FLUXERRMODEL(char *BAND, char *FIELD, char *FUNCALL) {
     sprintf(c1err,"Invalid NMATCH=%d for BAND=%s and FIELD=%s",
 	    NMATCH, BAND, FIELD);
     sprintf(c2err,"Calling function is %s", FUNCALL);
-    errmsg(SEV_FATAL, 0, fnam, c1err, c2err ); 
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
   }
-  
+
+  // store result in cache (IMAP=-9 for no-match is cached too)
+  if ( NCACHE < MXCACHE_INDEX_FLUXERRMAP ) {
+    sprintf(INDEX_MAP_CACHE_FLUXERRMODEL.BAND[NCACHE],  "%.3s",  BAND );
+    sprintf(INDEX_MAP_CACHE_FLUXERRMODEL.FIELD[NCACHE], "%.39s", FIELD);
+    INDEX_MAP_CACHE_FLUXERRMODEL.IMAP[NCACHE] = IMAP ;
+    INDEX_MAP_CACHE_FLUXERRMODEL.NCACHE++ ;
+  }
+
   return(IMAP) ;
 
 } // end INDEX_MAP_FLUXERRMODEL
@@ -55,6 +55,17 @@ struct {
   char FIELDLIST[MXFIELDGROUP_FLUXERRMAP][80];
 } FLUXERR_FIELDGROUP ;
 
+// Aug 2026: cache of resolved BAND+FIELD -> imap so that the
+// per-observation string matching in INDEX_MAP_FLUXERRMODEL runs
+// once per BAND x FIELD combination instead of once per observation.
+#define MXCACHE_INDEX_FLUXERRMAP 100
+struct {
+  int  NCACHE ;   // reset in INIT_FLUXERRMODEL
+  char BAND[MXCACHE_INDEX_FLUXERRMAP][4];
+  char FIELD[MXCACHE_INDEX_FLUXERRMAP][40];
+  int  IMAP[MXCACHE_INDEX_FLUXERRMAP];
+} INDEX_MAP_CACHE_FLUXERRMODEL ;
+
 
 int NINDEX_SPARSE_FLUXERRMAP ;
 
@@ -160,7 +160,13 @@ void init_genPDF(int OPTMASK, FILE *FP, char *fileName, char *ignoreList) {
       MAPNAME = GENPDF[NMAP].MAPNAME;
       NFUN   = 1  ; // for now, assume only one PROB column
       NDIM   = NVAR - NFUN ;
-      read_GRIDMAP(fp, MAPNAME, KEY_ROW, KEY_STOP, 
+
+      // Aug 2026: enable binary side-cache of parsed map;
+      // skip for external fp where full file name is unknown here.
+      if ( (OPTMASK & OPTMASK_GENPDF_EXTERNAL_FP) == 0 )
+	{ set_GRIDMAP_CACHE_SOURCE(fileName_full); }
+
+      read_GRIDMAP(fp, MAPNAME, KEY_ROW, KEY_STOP,
 		   IDMAP, NDIM, NFUN, OPT_EXTRAP_GENPDF, 
 		   MXROW_GENPDF, fnam, &GENPDF[NMAP].GRIDMAP );
 
@@ -205,6 +211,9 @@ void init_genPDF(int OPTMASK, FILE *FP, char *fileName, char *ignoreList) {
       GENPDF[imap].IVAR_HOSTLIB[ivar] = ivar_hostlib;
     }
   }
+
+  // Aug 2026: compile inverse-CDF sampling nodes (default sampling)
+  prep_inverseCDF_genPDF();
 #endif
 
   //  debugexit(fnam);
@@ -274,6 +283,15 @@ double get_random_genPDF(char *parName, GENGAUSS_ASYM_DEF *GENGAUSS) {
 	val_inputs[ivar] = get_VALUE_HOSTLIB(IVAR_HOSTLIB,IGAL);
       }
 
+      // Aug 2026: default draw is one uniform mapped through the
+      // compiled CDF (see prep_inverseCDF_genPDF); legacy
+      // accept/reject below via OPTMASK_GENPDF_ITERATE.
+      if ( (OPTMASK_GENPDF & OPTMASK_GENPDF_ITERATE) == 0 ) {
+	r = draw_inverseCDF_genPDF(IDMAP, val_inputs, ILIST_RAN);
+	N_ITER = 1 ;
+	goto DONE_MAP ;
+      }
+
       // get min/max VALUE range for random selection;
       // function here returns VAL_RANGE
       get_VAL_RANGE_genPDF(IDMAP, val_inputs, VAL_RANGE, 0 );
@@ -347,6 +365,7 @@ double get_random_genPDF(char *parName, GENGAUSS_ASYM_DEF *GENGAUSS) {
 
       } // end while loop over prob
 
+    DONE_MAP: ;
     } // end IDMAP >= 0
 
     // track N_ITER stats
@@ -463,6 +482,164 @@ void get_VAL_RANGE_genPDF(int IDMAP, double *val_inputs,
   return;
 } // end get_VAL_RANGE_genPDF
 
+// ========================================
+void prep_inverseCDF_genPDF(void) {
+
+  // Created Aug 2026
+  // Compile inverse-CDF sampling nodes for each GENPDF map:
+  // store the map grid values along the first (generated) variable,
+  // and for 1D maps also the PDF and cumulative CDF at each node.
+  // Host-dependent maps re-evaluate PDF/CDF per draw in
+  // load_CDF_nodes_genPDF since the conditions are continuous.
+
+  int imap, inode, NNODE, MEMD ;
+  double val_inputs[MXVAR_GENPDF];
+  char fnam[] = "prep_inverseCDF_genPDF" ;
+
+  // ----------- BEGIN ------------
+
+  if ( OPTMASK_GENPDF & OPTMASK_GENPDF_ITERATE ) { return; }
+
+  for(imap=0; imap < NMAP_GENPDF; imap++ ) {
+
+    NNODE = GENPDF[imap].GRIDMAP.NBIN[0] ;
+    if ( NNODE < 2 ) {
+      sprintf(c1err,"NBIN=%d along %s", NNODE, GENPDF[imap].VARNAMES[0]);
+      sprintf(c2err,"Cannot sample %s", GENPDF[imap].MAPNAME );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+
+    MEMD = NNODE * sizeof(double);
+    GENPDF[imap].NNODE    = NNODE ;
+    GENPDF[imap].VAL_NODE = (double*) malloc(MEMD);
+    GENPDF[imap].PDF_NODE = (double*) malloc(MEMD);
+    GENPDF[imap].CDF_NODE = (double*) malloc(MEMD);
+
+    for(inode=0; inode < NNODE; inode++ ) {
+      GENPDF[imap].VAL_NODE[inode] =
+	GENPDF[imap].GRIDMAP.VALMIN[0] +
+	GENPDF[imap].GRIDMAP.VALBIN[0] * (double)inode ;
+    }
+
+    if ( GENPDF[imap].GRIDMAP.NDIM == 1 )
+      { load_CDF_nodes_genPDF(imap, val_inputs); }
+
+    printf("\t Compile inverse-CDF for %-12.12s : %d nodes \n",
+	   GENPDF[imap].MAPNAME, NNODE );  fflush(stdout);
+  }
+
+  return;
+} // end prep_inverseCDF_genPDF
+
+// ========================================
+void load_CDF_nodes_genPDF(int IDMAP, double *val_inputs) {
+
+  // Created Aug 2026
+  // Evaluate PDF at each VAL_NODE (with host dependences fixed at
+  // val_inputs[1:NDIM-1]) and accumulate trapezoid CDF.
+
+  int NNODE = GENPDF[IDMAP].NNODE ;
+  int inode, istat ;
+  double prob ;
+  char fnam[] = "load_CDF_nodes_genPDF" ;
+
+  // ----------- BEGIN ------------
+
+  for(inode=0; inode < NNODE; inode++ ) {
+    val_inputs[0] = GENPDF[IDMAP].VAL_NODE[inode] ;
+    istat = interp_GRIDMAP(&GENPDF[IDMAP].GRIDMAP, val_inputs, &prob);
+    if ( istat != SUCCESS ) {
+      sprintf(c1err,"interp_GRIDMAP returned istat=%d at %s=%f",
+	      istat, GENPDF[IDMAP].VARNAMES[0], val_inputs[0] );
+      sprintf(c2err,"Value probably outside %s range",
+	      GENPDF[IDMAP].MAPNAME );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+    if ( prob < 0.0 ) { prob = 0.0 ; }
+    GENPDF[IDMAP].PDF_NODE[inode] = prob ;
+
+    if ( inode == 0 )
+      { GENPDF[IDMAP].CDF_NODE[inode] = 0.0 ; }
+    else {
+      GENPDF[IDMAP].CDF_NODE[inode] =
+	GENPDF[IDMAP].CDF_NODE[inode-1] +
+	0.5 * ( GENPDF[IDMAP].PDF_NODE[inode-1] + prob ) *
+	GENPDF[IDMAP].GRIDMAP.VALBIN[0] ;
+    }
+  }
+
+  return;
+} // end load_CDF_nodes_genPDF
+
+// ========================================
+double draw_inverseCDF_genPDF(int IDMAP, double *val_inputs,
+			      int ILIST_RAN) {
+
+  // Created Aug 2026
+  // Draw random value from GENPDF map via inverse CDF:
+  // one uniform random, binary search for the CDF segment, then
+  // exact inversion of the piecewise-linear PDF inside the segment
+  // (quadratic in the offset). Samples the same piecewise-linear
+  // density as the legacy accept/reject loop, with a fixed cost of
+  // one uniform per draw.
+
+  int    NNODE = GENPDF[IDMAP].NNODE ;
+  int    NDIM  = GENPDF[IDMAP].GRIDMAP.NDIM ;
+  double *VAL  = GENPDF[IDMAP].VAL_NODE ;
+  double *PDF  = GENPDF[IDMAP].PDF_NODE ;
+  double *CDF  = GENPDF[IDMAP].CDF_NODE ;
+  int    lo, hi, mid, inode ;
+  double TOT, U, AREA, x0, dx, p0, p1, slope, disc, t ;
+  char fnam[] = "draw_inverseCDF_genPDF" ;
+
+  // ----------- BEGIN ------------
+
+  // host-dependent maps: rebuild CDF for this event's conditions
+  if ( NDIM > 1 ) { load_CDF_nodes_genPDF(IDMAP, val_inputs); }
+
+  TOT = CDF[NNODE-1] ;
+  if ( TOT <= 0.0 ) {
+    sprintf(c1err,"Total PROB=0 for IDMAP=%d (%s)",
+	    IDMAP, GENPDF[IDMAP].MAPNAME );
+    sprintf(c2err,"Check map and host dependences.");
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  U = FlatRan1(ILIST_RAN) * TOT ;
+
+  // binary search for first node with CDF >= U
+  lo = 1;  hi = NNODE-1 ;
+  while ( lo < hi ) {
+    mid = (lo+hi)/2 ;
+    if ( CDF[mid] < U ) { lo = mid+1; }  else  { hi = mid; }
+  }
+  inode = lo ;
+
+  // invert piecewise-linear PDF within segment inode-1 .. inode
+  x0    = VAL[inode-1] ;
+  dx    = VAL[inode] - VAL[inode-1] ;
+  p0    = PDF[inode-1] ;
+  p1    = PDF[inode] ;
+  AREA  = U - CDF[inode-1] ;    // area to cover inside segment
+  slope = (p1 - p0) / dx ;
+
+  if ( fabs(slope) * dx < 1.0E-12 * (p0+p1) || p0+p1 == 0.0 ) {
+    // flat segment
+    if ( p0 > 0.0 ) { t = AREA / p0 ; }  else  { t = 0.0 ; }
+  }
+  else {
+    disc = p0*p0 + 2.0*slope*AREA ;
+    if ( disc < 0.0 ) { disc = 0.0 ; }
+    t = ( sqrt(disc) - p0 ) / slope ;
+  }
+
+  if ( t < 0.0 ) { t = 0.0 ; }
+  if ( t > dx  ) { t = dx  ; }
+
+  return( x0 + t );
+
+} // end draw_inverseCDF_genPDF
+
 // ========================================
 int IDMAP_GENPDF(char *parName, bool *FOUND_LOGPARAM) {
 
@@ -13,6 +13,7 @@
 
 #define  OPTMASK_GENPDF_EXTRAP       1
 #define  OPTMASK_GENPDF_SLOW         2  // use full val range
+#define  OPTMASK_GENPDF_ITERATE      4  // Aug 2026: legacy accept/reject
 #define  OPTMASK_GENPDF_EXTERNAL_FP  8
 
 int      NMAP_GENPDF;
@@ -29,7 +30,15 @@ struct {
   // track stats on number of iterations to find value
   int N_CALL ;
   int N_ITER_SUM,  N_ITER_MAX ;
-  
+
+  // Aug 2026: inverse-CDF sampling nodes along VARNAMES[0];
+  // see prep_inverseCDF_genPDF. PDF/CDF are filled at init for 1D
+  // maps and re-evaluated per draw for host-dependent maps.
+  int     NNODE ;
+  double *VAL_NODE ;    // map grid values along first dimension
+  double *PDF_NODE ;    // PROB at each node
+  double *CDF_NODE ;    // cumulative trapezoid sum; [NNODE-1]=total
+
 } GENPDF[MXMAP_GENPDF] ;
 
 float TMPSTORE_PROB_REF_GENPDF[MXITER_GENPDF];
@@ -48,4 +57,8 @@ void   get_VAL_RANGE_genPDF(int IDMAP, double *val_inputs, double *VAL_RANGE, in
 int IDMAP_GENPDF(char *parName, bool *LOGPARAM);
 void iter_summary_genPDF(void);
 
+void   prep_inverseCDF_genPDF(void);
+void   load_CDF_nodes_genPDF(int IDMAP, double *val_inputs);
+double draw_inverseCDF_genPDF(int IDMAP, double *val_inputs, int ILIST_RAN);
+
 // END
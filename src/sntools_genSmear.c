@@ -280,10 +280,10 @@ void load_genSmear_randoms(int CID, double gmin, double gmax, double RANFIX) {
   GENSMEAR.CID = CID;
 
   // generate Guassian randoms for intrinsic scatter [genSmear] model
-  if ( NRANGauss < MXFILTINDX-1 ) { NRANGauss = MXFILTINDX-1; } 
-  for(iran=0; iran < NRANGauss; iran++ ) {                 
-    GENSMEAR.RANGauss_LIST[iran] = GaussRanClip(ILIST_RAN,gmin,gmax); 
-  }
+  // (Aug 2026: batch fill; same random sequence as scalar loop)
+  if ( NRANGauss < MXFILTINDX-1 ) { NRANGauss = MXFILTINDX-1; }
+  GaussRanClip_FILL(ILIST_RAN, gmin, gmax,
+		    NRANGauss, GENSMEAR.RANGauss_LIST);
 
  
   // repeat for 0-1 [flat] randoms
@@ -1077,6 +1077,7 @@ void  init_genSmear_SALT2(char *versionSALT2, char *smearModel,
   // ----------------- BEGIN --------------
 
   GENSMEAR_SALT2.USE  = 1 ;    GENSMEAR.NUSE++ ;
+  GENSMEAR_SALT2.CID_CURVE = -9 ; // Aug 2026: no event curve yet
   GENSMEAR_SALT2.SIGCOH  = 0.0 ;
 
   // note that SIGCOH=-8 is a flag that user passed SIGMA_COH
@@ -1478,20 +1479,58 @@ void read_genSmear_SALT2disp(char *smearFile) {
 
 
 // *******************************************
-void get_genSmear_SALT2(double Trest, int NLam, double *Lam, 
+void prep_genSmear_SALT2_eventCurve(void) {
+
+  // Created Aug 2026
+  // Prepare per-event smear curve at the lambda nodes.
+  // The event's random vector is fixed, so the coherent term and
+  // the node mags (random x sigma, stored contiguously) are computed
+  // once here; each epoch call in get_genSmear_SALT2 then reduces
+  // to a node interpolation.
+
+  int NBCOH         = GENSMEAR_SALT2.SIGCOH_LAM.NBIN ;
+  double *ptrSIGCOH = GENSMEAR_SALT2.SIGCOH_LAM.YVAL ;
+  int    NNODE      = GENSMEAR_SALT2.NNODE ;
+  int    N, inode ;
+  double rCOH ;
+  //  char fnam[] = "prep_genSmear_SALT2_eventCurve" ;
+
+  // ---------- BEGIN ----------
+
+  N      = GENSMEAR.NGEN_RANGauss;
+  rCOH   = GENSMEAR.RANGauss_LIST[N-1] ;  // use last random
+
+  GENSMEAR_SALT2.SMEAR0_CURVE = 0.0 ;
+  if ( NBCOH == 1 )
+    { GENSMEAR_SALT2.SMEAR0_CURVE = rCOH * ptrSIGCOH[0] ; }
+
+  for(inode=0; inode < NNODE; inode++ ) {
+    GENSMEAR_SALT2.MAG_NODE_CURVE[inode] =
+      GENSMEAR.RANGauss_LIST[inode] * GENSMEAR_SALT2.SIG_NODE[inode] ;
+  }
+
+  GENSMEAR_SALT2.CID_CURVE = GENSMEAR.CID ;
+
+  return ;
+
+} // end of prep_genSmear_SALT2_eventCurve
+
+
+// ********************************************************
+void get_genSmear_SALT2(double Trest, int NLam, double *Lam,
 			double *magSmear) {
 
   // Returns magSmear array corresponding to input *Lam array.
   // Jul 27 2016: protect against undefined model (see LAMMIN, LAMMAX)
   // May 30 2018: interpolate SIGCOH vs. LAMBDA (see NBCOH)
+  // Aug 2026: use per-event curve from prep_genSmear_SALT2_eventCurve;
+  //           each epoch call is now just the node interpolation.
 
   int NBCOH         = GENSMEAR_SALT2.SIGCOH_LAM.NBIN ;
-  double *ptrLAMCOH = GENSMEAR_SALT2.SIGCOH_LAM.XVAL ;
   double *ptrSIGCOH = GENSMEAR_SALT2.SIGCOH_LAM.YVAL ;
-  int OPT_INTERP=1;
 
-  int    ilam, INODE, N, LDMP, NLAM ;
-  double lam, rCOH, r0, r1, SMEAR0=0.0, SMEAR, MINLAM, MAXLAM ;
+  int    ilam, INODE, LDMP, NNODE ;
+  double lam, SMEAR0, SMEAR, MINLAM, MAXLAM, LAM0, LAMSEP ;
   double LAM_NODE[2], MAG_NODE[2];
   char   fnam[] = "get_genSmear_SALT2";
   char   comment[40];
@@ -1504,69 +1543,59 @@ void get_genSmear_SALT2(double Trest, int NLam, double *Lam,
 	   fnam, Trest, NLam, Lam[0], ptrSIGCOH[0] );
   }
 
-  NLAM   = GENSMEAR_SALT2.NLAM ;  
   MINLAM = GENSMEAR_SALT2.MINLAM ;
   MAXLAM = GENSMEAR_SALT2.MAXLAM ;
-  
+  NNODE  = GENSMEAR_SALT2.NNODE ;
+  LAM0   = GENSMEAR_SALT2.LAM_NODE[0] ;
+  LAMSEP = GENSMEAR_SALT2.LAMSEP_NODE ;
 
-  N      = GENSMEAR.NGEN_RANGauss;
-  rCOH   = GENSMEAR.RANGauss_LIST[N-1] ;  // use last random 
+  // refresh per-event curve only when the event changes
+  if ( GENSMEAR.CID != GENSMEAR_SALT2.CID_CURVE )
+    { prep_genSmear_SALT2_eventCurve(); }
 
-  if ( NBCOH == 1 ) {
-    SMEAR0 = rCOH * ptrSIGCOH[0];
-    GENSMEAR.MAGSMEAR_COH[0] = SMEAR0; // load global for SNTABLE (Jun 14 2016)
-  }
+  SMEAR0 = GENSMEAR_SALT2.SMEAR0_CURVE ;
+  if ( NBCOH == 1 )
+    { GENSMEAR.MAGSMEAR_COH[0] = SMEAR0; } // load global for SNTABLE
 
+  sprintf(comment,"%s", fnam);  // Aug 2026: hoisted out of ilam loop
 
   for ( ilam=0; ilam < NLam; ilam++ ) {
-    lam = Lam[ilam];    
-    if ( NBCOH >  1111111 ) {
-      SMEAR0 = rCOH * interp_1DFUN(OPT_INTERP, lam, NBCOH,
-				   ptrLAMCOH, ptrSIGCOH, fnam) ; 
-    }
+    lam = Lam[ilam];
 
     magSmear[ilam] = SMEAR0 ;
     if ( lam <= MINLAM ) { continue ; }
     if ( lam >= MAXLAM ) { continue ; }
 
-    INODE = INODE_LAMBDA(lam, GENSMEAR_SALT2.NNODE, GENSMEAR_SALT2.LAM_NODE);
-    if ( INODE < 0 || INODE >= GENSMEAR_SALT2.NNODE ) {      
-      // .xyz
+    // nodes are uniformly spaced (last bin can be short), so locate
+    // node directly instead of O(NNODE) scan per wavelength.
+    INODE = (int)( (lam - LAM0)/LAMSEP );
+    if ( INODE > NNODE-2 ) { INODE = NNODE-2 ; }
+    if ( INODE < 0       ) { INODE = 0 ; }
+    while ( INODE < NNODE-2 && lam > GENSMEAR_SALT2.LAM_NODE[INODE+1] )
+      { INODE++ ; }
+    while ( INODE > 0 && lam < GENSMEAR_SALT2.LAM_NODE[INODE] )
+      { INODE-- ; }
+
+    if ( lam < GENSMEAR_SALT2.LAM_NODE[INODE] ||
+	 lam > GENSMEAR_SALT2.LAM_NODE[INODE+1] ) {
       print_preAbort_banner(fnam);
       printf("  MINLAM / MAXLAM = %.2f / %.2f \n", MINLAM, MAXLAM);
       printf("  ilam = %d of %d \n", ilam, NLam);
       sprintf(c1err,"Could not find INODE for lam=%7.1f", lam);
-      sprintf(c2err,"NNODE=%d  INODE=%d", GENSMEAR_SALT2.NNODE, INODE) ;
-      errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+      sprintf(c2err,"NNODE=%d  INODE=%d", NNODE, INODE) ;
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
     }
 
     LAM_NODE[0] = GENSMEAR_SALT2.LAM_NODE[INODE];
     LAM_NODE[1] = GENSMEAR_SALT2.LAM_NODE[INODE+1];
 
-    r0          = GENSMEAR.RANGauss_LIST[INODE] ;
-    r1          = GENSMEAR.RANGauss_LIST[INODE+1] ;
-
-    MAG_NODE[0] = r0 * GENSMEAR_SALT2.SIG_NODE[INODE] ;
-    MAG_NODE[1] = r1 * GENSMEAR_SALT2.SIG_NODE[INODE+1] ;
+    MAG_NODE[0] = GENSMEAR_SALT2.MAG_NODE_CURVE[INODE] ;
+    MAG_NODE[1] = GENSMEAR_SALT2.MAG_NODE_CURVE[INODE+1] ;
 
-    sprintf(comment,"%s[INODE=%d]", fnam, INODE);
     SMEAR = interp_SINFUN(lam, LAM_NODE, MAG_NODE, comment );
 
     magSmear[ilam] = SMEAR0 + SMEAR ;
 
-    // DDDDDDDDDDDDDDDDDDD
-    if ( fabs(lam+3000.0)<0.0 && fabs(Trest) < 2.0 ) {
-      printf(" xxx ----------------------------------------- \n" );
-      printf(" xxx lam=%7.1f  SMEAR=%f  (r0,r1=%5.3f,%5.3f) \n", 
-	     lam, SMEAR, r0,r1 );
-      printf(" xxx \t NODE0: LAM=%7.1f SIG=%6.3f\n", 
-	     LAM_NODE[0], MAG_NODE[0] );
-      printf(" xxx \t NODE1: LAM=%7.1f SIG=%6.3f\n", 
-	     LAM_NODE[1], MAG_NODE[1] );
-    }
-    // DDDDDDDDDDDDDD
-
-
   } // end of ilam loop
 
   return ;
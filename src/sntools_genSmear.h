@@ -71,8 +71,9 @@ double get_genSmear_SCALE(double c, double x1);
 void  get_genSmear_USRFUN(double Trest, int NLam, double *Lam, 
 			  double *magSmear ) ;
 
-void  get_genSmear_SALT2(double Trest, int NLam, double *Lam, 
+void  get_genSmear_SALT2(double Trest, int NLam, double *Lam,
 			 double *magSmear ) ;
+void  prep_genSmear_SALT2_eventCurve(void) ;   // Aug 2026
 
 void  get_genSmear_Chotard11(double Trest, int NLam, double *Lam, 
 			     double *magSmear ) ;
@@ -220,6 +221,13 @@ struct GENSMEAR_SALT2 {
   double FUDGE_dSmear_dLAM[2] ; // Fudge G10 curve to match broadband smear
   double FUDGE_LAMSWITCH  ;
 
+  // Aug 2026: per-event curve prepared once per event (random
+  // vector is fixed) so that each epoch call reduces to a node
+  // interpolation; see prep_genSmear_SALT2_eventCurve().
+  int    CID_CURVE ;                      // event whose curve is loaded
+  double SMEAR0_CURVE ;                   // coherent smear for this event
+  double MAG_NODE_CURVE[MXRAN_GENSMEAR] ; // RANGauss x SIG at each node
+
 } GENSMEAR_SALT2 ;
 
 
@@ -131,6 +131,17 @@ int OPT_SNOOPY_FLUXPACK ;
 
 int NROW_WRITE_TOT ;
 
+// Aug 2026: buffer several light curves per fits_write_col call
+// (see append_GRIDfile_fits); cuts cfitsio row-bookkeeping overhead
+// when appending millions of tiny grid nodes.
+#define MXLC_BUF_GRIDGEN 100
+struct {
+  int   NLC ;       // number of buffered light curves
+  long  FIRSTROW ;  // fits row of first buffered word
+  long  NROW ;      // number of buffered words
+  short *I2MAG, *I2ERR ;
+} GRIDBUF_FITS ;
+
 // ==========================
 
 
@@ -151,6 +162,7 @@ void   wrhead_GRIDfile_text(void);
 void   wrhead_GRIDfile_fits(void);
 void   append_GRIDfile_text(void);
 void   append_GRIDfile_fits(void);
+void   flush_GRIDfile_fits(void);   // Aug 2026
 
 void   end_GRIDfile(void);
 void   get_GRIDKEY(void) ;
@@ -52,6 +52,7 @@
 #include "fitsio.h"
 #include "sntools_grid.h"
 #include "snlc_sim.h"
+#include "genmag_SEDtools.h"  // Aug 2026: MXSEDMODEL for genmag_SIMSED.h
 #include "genmag_SIMSED.h"
 #include "genmag_NON1ASED.h"
 
@@ -642,10 +643,17 @@ void wr_GRIDfile(int OPT, char *GRIDGEN_FILE) {
     // open file and write header
     load_EXTNAME_GRIDGEN();
 
-    if ( strcmp(GRIDGEN_INPUTS.FORMAT,"TEXT") == 0 ) 
+    if ( strcmp(GRIDGEN_INPUTS.FORMAT,"TEXT") == 0 )
       { OPT_GRIDGEN_FORMAT = OPT_GRIDGEN_FORMAT_TEXT ; } // human-readable
-    else if ( strcmp(GRIDGEN_INPUTS.FORMAT,"FITS") == 0 ) 
-      { OPT_GRIDGEN_FORMAT = OPT_GRIDGEN_FORMAT_FITS ; } // for psnid 
+    else if ( strcmp(GRIDGEN_INPUTS.FORMAT,"FITS") == 0 )
+      { OPT_GRIDGEN_FORMAT = OPT_GRIDGEN_FORMAT_FITS ; } // for psnid
+    else if ( strcmp(GRIDGEN_INPUTS.FORMAT,"FITS.GZ") == 0 ) {
+      // Aug 2026: gzip-compressed FITS; cfitsio compresses on the
+      // fly from the .gz suffix, and fits_read_SNGRID reads it back
+      // transparently (multi-GB NON1A grids shrink several-fold).
+      OPT_GRIDGEN_FORMAT = OPT_GRIDGEN_FORMAT_FITS ;
+      strcat(GRIDGEN_FILE, ".gz");
+    }
     else {
       sprintf(c1err, "Invalid GRID_FORMAT option: '%s'", 
 	      GRIDGEN_INPUTS.FORMAT);
@@ -1365,35 +1373,82 @@ void update_GRIDarrays(void) {
 // ******************************
 void append_GRIDfile_fits(void) {
 
-  int ilc, colnum, firstrow, firstelem, nrow, istat ;
+  // Aug 2026: buffer MXLC_BUF_GRIDGEN light curves and write them
+  // with one fits_write_col call per column instead of one call per
+  // grid node (see flush_GRIDfile_fits).
+
+  int ilc, firstrow, nrow ;
   //  char fnam[] = "append_GRIDfile_fits";
 
   // -------------- BEGIN --------------
 
-  istat     = 0;
   ilc       = GENLC.CID;
-  firstelem = 1 ;  
   firstrow  = SNGRID_WRITE.PTR_GRIDGEN_LC[ilc];
   nrow      = SNGRID_WRITE.NWD_I2GRIDGEN ;
 
   NROW_WRITE_TOT += nrow ;
 
-  colnum    = 1 ;  
-  fits_write_col(fp_GRIDGEN_FITS, TSHORT, colnum, firstrow, firstelem, nrow,
-		 SNGRID_WRITE.I2GRIDGEN_LCMAG, &istat);
-  sprintf(BANNER,"fits_write_tbl for I2MAG and ilc = %d", ilc );
-  check_fitserror(BANNER, istat) ;
+  if ( GRIDBUF_FITS.I2MAG == NULL ) {
+    int MEM = MXLC_BUF_GRIDGEN * nrow * sizeof(short);
+    GRIDBUF_FITS.I2MAG = (short*)malloc(MEM);
+    GRIDBUF_FITS.I2ERR = (short*)malloc(MEM);
+    GRIDBUF_FITS.NLC = 0;  GRIDBUF_FITS.NROW = 0;
+  }
 
+  // flush if this LC does not continue the buffered row range
+  if ( GRIDBUF_FITS.NLC > 0 &&
+       (long)firstrow != GRIDBUF_FITS.FIRSTROW + GRIDBUF_FITS.NROW )
+    { flush_GRIDfile_fits(); }
 
-  colnum    = 2 ;  
-  fits_write_col(fp_GRIDGEN_FITS, TSHORT, colnum, firstrow, firstelem, nrow,
-		 SNGRID_WRITE.I2GRIDGEN_LCERR, &istat);
-  sprintf(BANNER,"fits_write_tbl for I2ERR and ilc = %d", ilc );
-  check_fitserror(BANNER, istat) ;
+  if ( GRIDBUF_FITS.NLC == 0 ) { GRIDBUF_FITS.FIRSTROW = firstrow ; }
+
+  memcpy( &GRIDBUF_FITS.I2MAG[GRIDBUF_FITS.NROW],
+	  SNGRID_WRITE.I2GRIDGEN_LCMAG, nrow*sizeof(short) );
+  memcpy( &GRIDBUF_FITS.I2ERR[GRIDBUF_FITS.NROW],
+	  SNGRID_WRITE.I2GRIDGEN_LCERR, nrow*sizeof(short) );
+  GRIDBUF_FITS.NROW += nrow ;
+  GRIDBUF_FITS.NLC++ ;
 
+  if ( GRIDBUF_FITS.NLC >= MXLC_BUF_GRIDGEN )
+    { flush_GRIDfile_fits(); }
 
 }  // append_GRIDfile_fits
 
+
+// ******************************
+void flush_GRIDfile_fits(void) {
+
+  // Created Aug 2026
+  // Write buffered light curves to the FITS table (both columns),
+  // then reset the buffer. Called when the buffer is full, when an
+  // out-of-order row pointer shows up, and from end_GRIDfile.
+
+  int  colnum, istat=0 ;
+  long firstelem=1 ;
+
+  // -------------- BEGIN --------------
+
+  if ( GRIDBUF_FITS.NLC == 0 ) { return ; }
+
+  colnum = 1 ;
+  fits_write_col(fp_GRIDGEN_FITS, TSHORT, colnum, GRIDBUF_FITS.FIRSTROW,
+		 firstelem, GRIDBUF_FITS.NROW, GRIDBUF_FITS.I2MAG, &istat);
+  sprintf(BANNER,"fits_write_tbl for I2MAG (firstrow=%ld)",
+	  GRIDBUF_FITS.FIRSTROW );
+  check_fitserror(BANNER, istat) ;
+
+  colnum = 2 ;
+  fits_write_col(fp_GRIDGEN_FITS, TSHORT, colnum, GRIDBUF_FITS.FIRSTROW,
+		 firstelem, GRIDBUF_FITS.NROW, GRIDBUF_FITS.I2ERR, &istat);
+  sprintf(BANNER,"fits_write_tbl for I2ERR (firstrow=%ld)",
+	  GRIDBUF_FITS.FIRSTROW );
+  check_fitserror(BANNER, istat) ;
+
+  GRIDBUF_FITS.NLC  = 0 ;
+  GRIDBUF_FITS.NROW = 0 ;
+
+}  // flush_GRIDfile_fits
+
 // ******************************
 void append_GRIDfile_text(void) {
 
@@ -1511,6 +1566,7 @@ void end_GRIDfile(void) {
   if ( OPT_GRIDGEN_FORMAT == OPT_GRIDGEN_FORMAT_TEXT ) 
     { fclose(fp_GRIDGEN_TEXT); }
   else if ( OPT_GRIDGEN_FORMAT == OPT_GRIDGEN_FORMAT_FITS ) {
+    flush_GRIDfile_fits();  // Aug 2026: write buffered light curves
     istat = 0;
     fits_close_file(fp_GRIDGEN_FITS, &istat);
     check_fitserror("close fits file", istat) ;
@@ -132,6 +132,15 @@ void fits_read_SNGRID(int OPTMASK, char *sngridFile,
   // open fits file for reading
   istat = 0;
   fits_open_file(&fp_SNGRID, sngridFile, READONLY, &istat );
+
+  // Aug 2026: check for gzip-compressed grid (GRID_FORMAT: FITS.GZ);
+  // cfitsio decompresses transparently.
+  if ( istat != 0 ) {
+    char gzFile[MXPATHLEN];
+    sprintf(gzFile, "%s.gz", sngridFile);
+    istat = 0;
+    fits_open_file(&fp_SNGRID, gzFile, READONLY, &istat );
+  }
   check_fitserror("Open FITS file", istat);
 
 
@@ -114,6 +114,9 @@
 #include <string.h>
 #include <time.h>
 #include <math.h>
+#include <fcntl.h>      // for binary HOSTLIB cache
+#include <sys/mman.h>   // idem (mmap)
+#include <sys/stat.h>   // idem
 
 #include "sntools.h"
 #include "sntools_cosmology.h"
@@ -169,6 +172,10 @@ void INIT_HOSTLIB(void) {
   // check for match among spec templates and hostlib varnames (Jun 2019)
   match_specTable_HOSTVAR();
 
+  // check option to use mmap'ed binary cache of GAL table (Aug 2026)
+  if ( (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_BINARY) > 0 )
+    { open_HOSTLIB_binary(); }
+
   // read GAL: keys
   read_gal_HOSTLIB(fp_hostlib);
 
@@ -177,14 +184,20 @@ void INIT_HOSTLIB(void) {
 
   // close HOSTLIB file
 
-  if ( HOSTLIB.GZIPFLAG ) 
+  if ( HOSTLIB.GZIPFLAG )
     { pclose(fp_hostlib); } // close gzip file
   else
     { fclose(fp_hostlib); } // close normal file stream
 
+  // write binary cache of GAL table for later jobs (Aug 2026)
+  if ( HOSTLIB_BINARY.WRFLAG ) { write_HOSTLIB_binary(); }
+
   // sort HOSTLIB entries by redshift
   sortz_HOSTLIB();
 
+  // resolve optional NBR_LIST row numbers to IGAL indices (Aug 2026)
+  prep_NBR_INDEX_HOSTLIB();
+
   // abort if any GALID+ZTRUE pair appears more than once
   check_duplicate_GALID();
   
@@ -1691,31 +1704,41 @@ void genSpec_HOSTLIB(double zhel, double MWEBV, int DUMPFLAG,
     }
   }
 
-  // construct total rest-frame spectrum using specbasis/specdata binning
-  for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ ) {
-    FLAM_SUM     = 0.0 ;
-    LAM_BASIS    = HOSTSPEC.WAVE_CEN[ilam_basis]; // basis or data
-    for(i=ISPEC_MIN; i < ISPEC_MAX; i++ ) {
+  // construct total rest-frame spectrum using specbasis/specdata binning.
+  // Aug 2026: refactor with basis index as outer loop so that each
+  // per-galaxy COEFF is fetched once per event (not once per lambda bin)
+  // and each basis vector is applied in one contiguous pass that the
+  // compiler can vectorize; zero-coeff templates are skipped.
+  double SCALE_EVT = HOSTSPEC.FLAM_SCALE * znorm ;
+  double *FLAM_EVT = HOSTSPEC.FLAM_EVT ;
+  double *FLAM_BASIS_TMP ;
 
-      if ( IS_SPECBASIS ) { 
-	ivar_HOSTLIB = HOSTSPEC.IVAR_HOSTLIB[i];
-	COEFF        = HOSTLIB.VALUE_ZSORTED[ivar_HOSTLIB][IGAL] ; 
-	FLAM_TMP     = HOSTSPEC.FLAM_BASIS[i][ilam_basis] ;
-	FLAM_SUM    += ( COEFF * FLAM_TMP );
-      }
-      else {
-	FLAM_SUM   = HOSTSPEC.FLAM_BASIS[IDSPEC][ilam_basis] ; 
-      }
-      if ( DUMPFLAG && ilam_basis == 0 && COEFF > 0.0 ) {
-	printf(" xxx COEFF(%2d) = %le  (ivar_HOSTLIB=%d)\n", 
+  if ( IS_SPECBASIS ) {
+    for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ )
+      { FLAM_EVT[ilam_basis] = 0.0 ; }
+
+    for(i=ISPEC_MIN; i < ISPEC_MAX; i++ ) {
+      ivar_HOSTLIB = HOSTSPEC.IVAR_HOSTLIB[i];
+      COEFF        = HOSTLIB.VALUE_ZSORTED[ivar_HOSTLIB][IGAL] ;
+      if ( COEFF == 0.0 ) { continue ; }
+      if ( DUMPFLAG ) {
+	printf(" xxx COEFF(%2d) = %le  (ivar_HOSTLIB=%d)\n",
 	       i, COEFF, ivar_HOSTLIB );
       }
+      FLAM_BASIS_TMP = HOSTSPEC.FLAM_BASIS[i] ;
+      for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ )
+	{ FLAM_EVT[ilam_basis] += ( COEFF * FLAM_BASIS_TMP[ilam_basis] ); }
     }
 
     // global scale for physical units
-    HOSTSPEC.FLAM_EVT[ilam_basis] = (FLAM_SUM * HOSTSPEC.FLAM_SCALE * znorm);
-
-  } // end ilam_basis
+    for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ )
+      { FLAM_EVT[ilam_basis] *= SCALE_EVT ; }
+  }
+  else {
+    FLAM_BASIS_TMP = HOSTSPEC.FLAM_BASIS[IDSPEC] ;
+    for(ilam_basis=0; ilam_basis < NBLAM_BASIS; ilam_basis++ )
+      { FLAM_EVT[ilam_basis] = ( FLAM_BASIS_TMP[ilam_basis] * SCALE_EVT ); }
+  }
 
 
   // ---------------
@@ -2305,19 +2328,29 @@ void read_gal_HOSTLIB(FILE *fp) {
 
   NGAL = -9;
 
-  while( (fscanf(fp, "%s", c_get)) != EOF) {
+  // for binary cache there are no GAL: keys to search;
+  // loop directly over mapped rows (Aug 2026)
+  bool RDFLAG_BINARY = HOSTLIB_BINARY.USE ;
 
-    if ( strcmp(c_get,"GAL:") == 0 ) {
+  while( RDFLAG_BINARY || (fscanf(fp, "%s", c_get)) != EOF) {
+
+    if ( RDFLAG_BINARY && HOSTLIB.NGAL_READ >= HOSTLIB_BINARY.HEADER.NGAL )
+      { goto DONE_RDGAL ; }
+
+    if ( RDFLAG_BINARY || strcmp(c_get,"GAL:") == 0 ) {
 
       malloc_HOSTLIB(HOSTLIB.NGAL_STORE,HOSTLIB.NGAL_READ);
 
       NGAL_READ = HOSTLIB.NGAL_READ; // C-like index
       HOSTLIB.NGAL_READ++ ;          // fortran-like index
 
-      read_galRow_HOSTLIB(fp, HOSTLIB.NVAR_ALL, xval, FIELD, NBR_LIST ); 
+      read_galRow_HOSTLIB(fp, HOSTLIB.NVAR_ALL, xval, FIELD, NBR_LIST );
+
+      // check option to stage row for binary-cache converter
+      if ( HOSTLIB_BINARY.WRFLAG ) { store_galRow_HOSTLIB_binary(xval); }
 
-      if ( HOSTLIB.NGAL_READ > INPUTS.HOSTLIB_MAXREAD ) 
-	{ goto DONE_RDGAL ; } 
+      if ( HOSTLIB.NGAL_READ > INPUTS.HOSTLIB_MAXREAD )
+	{ goto DONE_RDGAL ; }
 
       if ( passCuts_HOSTLIB(xval) == 0 ) { continue; }
 
@@ -2507,6 +2540,14 @@ void read_galRow_HOSTLIB(FILE *fp, int NVAL, double *VALUES,
   char fnam[] = "read_galRow_HOSTLIB" ;
   // ---------------- BEGIN -----------------
 
+  // check option to fetch row from mmap'ed binary cache;
+  // NGAL_READ was already incremented, hence the -1 (Aug 2026)
+  if ( HOSTLIB_BINARY.USE ) {
+    read_galRow_HOSTLIB_binary(HOSTLIB.NGAL_READ-1, VALUES);
+    sprintf(FIELD,"NULL");  sprintf(NBR_LIST,"NULL");
+    return ;
+  }
+
   // scoop up rest of line with fgets
   fgets(tmpLine, MXCHAR, fp);
 
@@ -2589,6 +2630,284 @@ void read_galRow_HOSTLIB(FILE *fp, int NVAL, double *VALUES,
 
 }  // read_galRow_HOSTLIB
 
+
+// ==========================================
+void open_HOSTLIB_binary(void) {
+
+  // Created Aug 2026
+  // Implement HOSTLIB_MSKOPT_BINARY option: check for mmap'ed
+  // binary cache of the GAL table in [HOSTLIB_FILE].BINARY.
+  // If a valid cache exists, map it read-only (MAP_SHARED, so
+  // pages are shared among sim jobs on the same node) and set
+  // HOSTLIB_BINARY.USE -> read_galRow_HOSTLIB fetches each row
+  // from the map with no text parsing; only the columns needed
+  // for cuts and storage are touched, so unused columns are
+  // never faulted in. If no cache exists, set WRFLAG so that
+  // the one-time text read stages rows and writes the cache
+  // (see store_galRow_HOSTLIB_binary & write_HOSTLIB_binary).
+  //
+  // Must be called after read_head_HOSTLIB() so that the
+  // VARNAMES are known for validation.
+
+  HOSTLIB_BINARY_HEADER_DEF *HEADER = &HOSTLIB_BINARY.HEADER ;
+  int  NVAR = HOSTLIB.NVAR_ALL ;
+  int  fd, ivar, ivar_ALL, ivar_STORE, NNEED=0 ;
+  bool USE_IVAR[MXVAR_HOSTLIB];
+  size_t EXPECT_SIZE ;
+  long long TEXTSIZE ;
+  struct stat statbuf ;
+  char *MAPPTR, *ptrVarName ;
+  char fnam[] = "open_HOSTLIB_binary" ;
+
+  // ---------------- BEGIN -----------------
+
+  HOSTLIB_BINARY.USE    = false ;
+  HOSTLIB_BINARY.WRFLAG = false ;
+
+  // string columns are not supported in the binary cache
+  if ( HOSTLIB.IVAR_FIELD > 0 || HOSTLIB.IVAR_NBR_LIST > 0 ) {
+    printf("\t WARNING: FIELD/NBR_LIST column(s) -> "
+	   "disable binary HOSTLIB cache.\n");
+    fflush(stdout);
+    return ;
+  }
+
+  // rewrite modes read/write the text HOSTLIB; no cache
+  if ( (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_PLUSMAGS) > 0 ||
+       (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_PLUSNBR ) > 0 )
+    { return ; }
+
+  sprintf(HOSTLIB_BINARY.FILENAME, "%s.BINARY", HOSTLIB.FILENAME);
+
+  // size of text HOSTLIB is stored in cache for staleness check
+  if ( stat(HOSTLIB.FILENAME, &statbuf) != 0 )
+    { TEXTSIZE = 0 ; }
+  else
+    { TEXTSIZE = (long long)statbuf.st_size ; }
+
+  fd = open(HOSTLIB_BINARY.FILENAME, O_RDONLY);
+
+  if ( fd < 0 ) {
+    // no cache yet; write one after the text read
+    HOSTLIB_BINARY.WRFLAG = true ;
+    HOSTLIB_BINARY.STAGE_MALLOCSIZE = 0 ;
+    printf("\t No binary HOSTLIB cache found;\n"
+	   "\t --> will create %s \n", HOSTLIB_BINARY.FILENAME );
+    fflush(stdout);
+    return ;
+  }
+
+  fstat(fd, &statbuf);
+  HOSTLIB_BINARY.MAPSIZE = (size_t)statbuf.st_size ;
+
+  MAPPTR = (char*)mmap(NULL, HOSTLIB_BINARY.MAPSIZE, PROT_READ,
+		       MAP_SHARED, fd, 0 );
+  close(fd);
+
+  if ( MAPPTR == MAP_FAILED ) {
+    sprintf(c1err,"mmap failed for binary HOSTLIB cache");
+    sprintf(c2err,"File: %s", HOSTLIB_BINARY.FILENAME );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  memcpy(HEADER, MAPPTR, sizeof(HOSTLIB_BINARY_HEADER_DEF) );
+
+  // validate cache against current text HOSTLIB & header
+  bool STALE = false ;
+  if ( HEADER->MAGIC    != MAGIC_HOSTLIB_BINARY   ) { STALE = true ; }
+  if ( HEADER->VERSION  != VERSION_HOSTLIB_BINARY ) { STALE = true ; }
+  if ( HEADER->NVAR     != NVAR                   ) { STALE = true ; }
+  if ( HEADER->TEXTSIZE != TEXTSIZE               ) { STALE = true ; }
+
+  EXPECT_SIZE = sizeof(HOSTLIB_BINARY_HEADER_DEF)
+    + (size_t)NVAR * 40
+    + (size_t)NVAR * (size_t)HEADER->NGAL * sizeof(double) ;
+  if ( !STALE && HOSTLIB_BINARY.MAPSIZE != EXPECT_SIZE ) { STALE = true ; }
+
+  // compare each VARNAME with text header
+  if ( !STALE ) {
+    ptrVarName = MAPPTR + sizeof(HOSTLIB_BINARY_HEADER_DEF) ;
+    for ( ivar=0; ivar < NVAR; ivar++ ) {
+      if ( strcmp(ptrVarName, HOSTLIB.VARNAME_ALL[ivar]) != 0 )
+	{ STALE = true ; }
+      ptrVarName += 40 ;
+    }
+  }
+
+  if ( STALE ) {
+    sprintf(c1err,"Binary HOSTLIB cache does not match text HOSTLIB.");
+    sprintf(c2err,"Remove stale cache: %s", HOSTLIB_BINARY.FILENAME );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  HOSTLIB_BINARY.MAPVAL = (double*)
+    ( MAPPTR + sizeof(HOSTLIB_BINARY_HEADER_DEF) + (size_t)NVAR*40 ) ;
+
+  // build sparse list of columns to fault in:
+  // cut variables + GALID + every stored column.
+  for ( ivar=0; ivar < NVAR; ivar++ ) { USE_IVAR[ivar] = false ; }
+
+  USE_IVAR[ HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_ZTRUE] ] = true ;
+  USE_IVAR[ HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_GALID] ] = true ;
+  if ( HOSTLIB.IVAR_RA > 0 && HOSTLIB.IVAR_DEC > 0 ) {
+    USE_IVAR[ HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_RA]  ] = true ;
+    USE_IVAR[ HOSTLIB.IVAR_ALL[HOSTLIB.IVAR_DEC] ] = true ;
+  }
+  for ( ivar_STORE=0; ivar_STORE < HOSTLIB.NVAR_STORE; ivar_STORE++ ) {
+    ivar_ALL = HOSTLIB.IVAR_ALL[ivar_STORE] ;
+    USE_IVAR[ivar_ALL] = true ;
+  }
+
+  for ( ivar=0; ivar < NVAR; ivar++ ) {
+    if ( USE_IVAR[ivar] )
+      { HOSTLIB_BINARY.NEED_IVAR[NNEED] = ivar ;  NNEED++ ; }
+  }
+  HOSTLIB_BINARY.NNEED = NNEED ;
+
+  HOSTLIB_BINARY.USE = true ;
+
+  printf("\t Use binary HOSTLIB cache with %d galaxies "
+	 "(%d of %d columns)\n",
+	 HEADER->NGAL, NNEED, NVAR );
+  printf("\t   %s \n", HOSTLIB_BINARY.FILENAME );
+  fflush(stdout);
+
+  return ;
+
+} // end open_HOSTLIB_binary
+
+
+// ==========================================
+void read_galRow_HOSTLIB_binary(int igal, double *VALUES) {
+
+  // Created Aug 2026
+  // Fill VALUES (vs. ivar_ALL) for row 'igal' from the mmap'ed
+  // binary cache; only the columns in the NEED_IVAR list are
+  // touched so that unused columns are never paged in.
+
+  int NGAL = HOSTLIB_BINARY.HEADER.NGAL ;
+  int NVAR = HOSTLIB_BINARY.HEADER.NVAR ;
+  int ivar, inneed ;
+
+  // ---------------- BEGIN -----------------
+
+  for ( ivar=0; ivar < NVAR; ivar++ ) { VALUES[ivar] = -9.0 ; }
+
+  for ( inneed=0; inneed < HOSTLIB_BINARY.NNEED; inneed++ ) {
+    ivar = HOSTLIB_BINARY.NEED_IVAR[inneed] ;
+    VALUES[ivar] = HOSTLIB_BINARY.MAPVAL[(size_t)ivar*NGAL + igal] ;
+  }
+
+  return ;
+
+} // end read_galRow_HOSTLIB_binary
+
+
+// ==========================================
+void store_galRow_HOSTLIB_binary(double *VALUES) {
+
+  // Created Aug 2026
+  // Stage row (vs. ivar_ALL) read from the text HOSTLIB so that
+  // write_HOSTLIB_binary() can write column-major binary cache.
+
+#define MALLOCSIZE_HOSTLIB_BINARY 200000  // grow staging in these chunks
+
+  int NVAR = HOSTLIB.NVAR_ALL ;
+  int igal = HOSTLIB.NGAL_READ - 1 ;  // already incremented by caller
+  int ivar, MEMD ;
+
+  // ---------------- BEGIN -----------------
+
+  if ( igal >= HOSTLIB_BINARY.STAGE_MALLOCSIZE ) {
+    HOSTLIB_BINARY.STAGE_MALLOCSIZE += MALLOCSIZE_HOSTLIB_BINARY ;
+    MEMD = HOSTLIB_BINARY.STAGE_MALLOCSIZE * sizeof(double);
+    for ( ivar=0; ivar < NVAR; ivar++ ) {
+      if ( igal == 0 )
+	{ HOSTLIB_BINARY.STAGE_VAL[ivar] = (double*)malloc(MEMD); }
+      else {
+	HOSTLIB_BINARY.STAGE_VAL[ivar] =
+	  (double*)realloc(HOSTLIB_BINARY.STAGE_VAL[ivar], MEMD);
+      }
+    }
+  }
+
+  for ( ivar=0; ivar < NVAR; ivar++ )
+    { HOSTLIB_BINARY.STAGE_VAL[ivar][igal] = VALUES[ivar] ; }
+
+  return ;
+
+} // end store_galRow_HOSTLIB_binary
+
+
+// ==========================================
+void write_HOSTLIB_binary(void) {
+
+  // Created Aug 2026
+  // One-time converter: write column-major binary cache of the
+  // GAL table staged during the text read. Layout is
+  //    HOSTLIB_BINARY_HEADER_DEF
+  //    VARNAME_ALL[NVAR][40]
+  //    VALUES[NVAR][NGAL]   (column-major doubles)
+  // so a later job can mmap the file and fault in only the
+  // columns it needs. See open_HOSTLIB_binary().
+
+  HOSTLIB_BINARY_HEADER_DEF HEADER ;
+  int  NVAR = HOSTLIB.NVAR_ALL ;
+  int  NGAL = HOSTLIB.NGAL_READ ;
+  int  ivar ;
+  struct stat statbuf ;
+  FILE *fp ;
+  char fnam[] = "write_HOSTLIB_binary" ;
+
+  // ---------------- BEGIN -----------------
+
+  // do not cache a truncated read
+  if ( HOSTLIB.NGAL_READ > INPUTS.HOSTLIB_MAXREAD ) {
+    printf("\t WARNING: HOSTLIB_MAXREAD truncated read; "
+	   "skip writing binary cache.\n");
+    fflush(stdout);
+    goto FREE_STAGE ;
+  }
+
+  HEADER.MAGIC    = MAGIC_HOSTLIB_BINARY ;
+  HEADER.VERSION  = VERSION_HOSTLIB_BINARY ;
+  HEADER.NVAR     = NVAR ;
+  HEADER.NGAL     = NGAL ;
+  if ( stat(HOSTLIB.FILENAME, &statbuf) != 0 )
+    { HEADER.TEXTSIZE = 0 ; }
+  else
+    { HEADER.TEXTSIZE = (long long)statbuf.st_size ; }
+
+  fp = fopen(HOSTLIB_BINARY.FILENAME, "wb");
+  if ( fp == NULL ) {
+    printf("\t WARNING: could not create binary HOSTLIB cache\n"
+	   "\t   %s \n", HOSTLIB_BINARY.FILENAME );
+    fflush(stdout);
+    goto FREE_STAGE ;
+  }
+
+  fwrite(&HEADER, sizeof(HEADER), 1, fp);
+  for ( ivar=0; ivar < NVAR; ivar++ )
+    { fwrite(HOSTLIB.VARNAME_ALL[ivar], 40, 1, fp); }
+  for ( ivar=0; ivar < NVAR; ivar++ )
+    { fwrite(HOSTLIB_BINARY.STAGE_VAL[ivar], sizeof(double), NGAL, fp); }
+  fclose(fp);
+
+  printf("\t Wrote binary HOSTLIB cache with %d galaxies: \n"
+	 "\t   %s \n", NGAL, HOSTLIB_BINARY.FILENAME );
+  fflush(stdout);
+
+ FREE_STAGE:
+  for ( ivar=0; ivar < NVAR; ivar++ )
+    { free(HOSTLIB_BINARY.STAGE_VAL[ivar]); }
+  HOSTLIB_BINARY.STAGE_MALLOCSIZE = 0 ;
+  HOSTLIB_BINARY.WRFLAG = false ;
+
+  return ;
+
+} // end write_HOSTLIB_binary
+
+
 // ==========================================
 void  summary_snpar_HOSTLIB(void) {
 
@@ -2882,9 +3201,11 @@ void sortz_HOSTLIB(void) {
   HOSTLIB.LIBINDEX_ZSORT   = (int*)malloc( (NGAL+1) * sizeof(int) );
 
   // allocate memory for sorted values
+  // (Aug 2026: malloc_largeTable allows optional huge-page backing
+  //  for these NGAL-length read-only columns)
   for ( ival=0; ival < NVAR_STORE; ival++ ) {
-    HOSTLIB.VALUE_ZSORTED[ival] = 
-      (double*)malloc( (NGAL+1) * sizeof(double) ) ;
+    HOSTLIB.VALUE_ZSORTED[ival] =
+      (double*)malloc_largeTable( (NGAL+1) * sizeof(double) ) ;
   }
 
   if ( DO_FIELD  ) {
@@ -3007,6 +3328,88 @@ void sortz_HOSTLIB(void) {
 } // end of sortz_HOSTLIB
 
 
+// =======================================
+void prep_NBR_INDEX_HOSTLIB(void) {
+
+  // Created Aug 2026
+  // If the NBR_LIST column exists, parse each galaxy's comma-sep
+  // list of HOSTLIB row numbers ONCE and resolve them through
+  // LIBINDEX_READ and LIBINDEX_ZSORT to z-sorted IGAL indices.
+  // The resolved indices for all galaxies are packed into one
+  // NBR_IGAL_PACKED array with a per-IGAL start index, so that
+  // GEN_SNHOST_NBR just copies a short list per event instead of
+  // re-parsing the string every time a galaxy is picked.
+  //
+  // Neighbors cut from the sample (LIBINDEX_READ < 0) are dropped
+  // here, exactly as in the old per-event parsing.
+
+  int  NGAL = HOSTLIB.NGAL_STORE ;
+  int  igal, i, NNBR_READ, NSTORE, NPACK, rowNum ;
+  int  IGAL_STORE, IGAL_ZSORT, MEMI ;
+  char NBR_LIST[MXCHAR_NBR_LIST] ;
+  char NO_NBR[] = "-1" ;
+  //  char fnam[] = "prep_NBR_INDEX_HOSTLIB" ;
+
+  // ---------------- BEGIN ----------------
+
+  HOSTLIB.NBR_IGAL_PACKED = NULL ;
+  if ( HOSTLIB.IVAR_NBR_LIST < 0 ) { return ; }
+
+  MEMI = (NGAL+1) * sizeof(int) ;
+  HOSTLIB.NBR_IGAL_START = (int*)malloc(MEMI);
+  HOSTLIB.NBR_NSTORE     = (int*)malloc(MEMI);
+
+  // first pass: count commas to get an upper bound on the
+  // number of packed neighbor indices.
+  NPACK = 0 ;
+  for(igal=0; igal < NGAL; igal++ ) {
+    char *ptrNBR = HOSTLIB.NBR_ZSORTED[igal] ;
+    if ( strcmp(ptrNBR,NO_NBR) == 0 ) { continue; }
+    NPACK++ ;
+    for(i=0; ptrNBR[i] != 0; i++ )
+      { if ( ptrNBR[i] == ',' ) { NPACK++ ; } }
+  }
+
+  if ( NPACK > 0 )
+    { HOSTLIB.NBR_IGAL_PACKED = (int*)malloc( NPACK * sizeof(int) ); }
+
+  // second pass: parse and resolve each NBR list
+  NPACK = 0 ;
+  for(igal=0; igal < NGAL; igal++ ) {
+
+    HOSTLIB.NBR_IGAL_START[igal] = NPACK ;
+    HOSTLIB.NBR_NSTORE[igal]     = 0 ;
+
+    if ( strcmp(HOSTLIB.NBR_ZSORTED[igal],NO_NBR) == 0 ) { continue; }
+
+    // use local copy since splitString2 destroys its input
+    sprintf(NBR_LIST, "%s", HOSTLIB.NBR_ZSORTED[igal] );
+    splitString2(NBR_LIST, COMMA, MXNBR_LIST,
+		 &NNBR_READ, &TMPWORD_HOSTLIB[0]);
+
+    NSTORE = 0 ;
+    for(i=0; i < NNBR_READ; i++ ) {
+      sscanf(TMPWORD_HOSTLIB[i], "%d", &rowNum);
+
+      // rowNum is a fortran-like index starting at 1; use two
+      // layers of indexing to get the z-sorted IGAL.
+      IGAL_STORE = HOSTLIB.LIBINDEX_READ[rowNum-1];
+      if ( IGAL_STORE < 0 ) { continue; } // neighbor was cut from sample
+
+      IGAL_ZSORT = HOSTLIB.LIBINDEX_ZSORT[IGAL_STORE];
+      HOSTLIB.NBR_IGAL_PACKED[NPACK] = IGAL_ZSORT ;
+      NPACK++ ;  NSTORE++ ;
+    }
+
+    HOSTLIB.NBR_NSTORE[igal] = NSTORE ;
+
+  } // end igal loop
+
+  return ;
+
+} // end prep_NBR_INDEX_HOSTLIB
+
+
 // =======================================
 void zptr_HOSTLIB(void) {
 
@@ -3118,6 +3521,11 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
   // 
   // Jun 18 2019: if interp_GRIDMAP fails, print more PRE-ABORT info.
   // Jun 25 2019: check GAMMA_GRID option
+  // Aug 2026: loop galaxies (outer) and SNVAR bins (inner) so that
+  //   HOSTLIB values are extracted once per galaxy; cumulative sums
+  //   are formed in a separate prefix-sum pass. Optional binary
+  //   cache of the sums (HOSTLIB_MSKOPT_WGTMAP_CACHE) skips the
+  //   interpolation entirely on repeat jobs.
   //
 
   bool IS_SNVAR ;
@@ -3165,123 +3573,148 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
     fflush(stdout);
   }
 
-  for(ibin=0; ibin < NBTOT_SNVAR ; ibin++ ) {
+  // - - - - - - - - - - - - - - - - - - - -
+  // Aug 2026: check option to load weight sums from binary cache
+  // written by a previous job with the same HOSTLIB+WGTMAP.
+  bool USE_CACHE =
+    ( (INPUTS.HOSTLIB_MSKOPT & HOSTLIB_MSKOPT_WGTMAP_CACHE) > 0  &&
+      IGAL_START == 0  &&  IGAL_END == NGAL-1 );
+  char cacheFile[MXPATHLEN+20];
+  WGTMAP_CACHE_HEADER_DEF CACHE_HEADER ;
+
+  if ( USE_CACHE ) {
+    name_WGTMAP_CACHE(cacheFile, &CACHE_HEADER);
+    if ( rd_WGTMAP_CACHE(cacheFile, &CACHE_HEADER) ) {
+      fill_CHECKLIST_HOSTLIB_WGTMAP(IGAL_START,IGAL_END);
+      runCheck_HOSTLIB_WGTMAP();
+      return ;
+    }
+  }
+
+  // precompute SN-grid values for each SNVAR bin (grid is fixed)
+  double *VAL_SNVAR_GRID = NULL ;
+  if ( N_SNVAR > 0 ) {
+    VAL_SNVAR_GRID = (double*)malloc(NBTOT_SNVAR*N_SNVAR*sizeof(double));
+    for(ibin=0; ibin < NBTOT_SNVAR; ibin++ )
+      { getVal_SNVAR_HOSTLIB_WGTMAP(ibin, &VAL_SNVAR_GRID[ibin*N_SNVAR]); }
+  }
 
-    if ( N_SNVAR > 0 )  // fetch SN grid values
-      { getVal_SNVAR_HOSTLIB_WGTMAP(ibin,VAL_SNVAR); }
+  // loop over galaxies (outer) and SNVAR bins (inner) so that the
+  // HOSTLIB values and GALID are fetched once per galaxy instead of
+  // once per (galaxy,bin). Raw WGT is stored in the WGTSUM arrays;
+  // the prefix-sum pass below converts them to cumulative sums.
+  for ( igal=IGAL_START ; igal <= IGAL_END ; igal++ ) {
 
-    WGTSUM_LAST = 0.0 ;
-    for ( igal=IGAL_START ; igal <= IGAL_END ; igal++ ) {
-	
-      GALID  = get_GALID_HOSTLIB(igal);
-      ZTRUE  = get_ZTRUE_HOSTLIB(igal);
-      
-      if ( NROW == 0 ) 
-	{  WGT = 1.0 ;  SNMAGSHIFT = 0.0 ;  goto WGTSUM ;    }
-      
-      // strip off variables used for weighting
-      for ( ivar=0; ivar < NDIM; ivar++ ) {  // WGTMAP variables
-	IS_SNVAR     = HOSTLIB_WGTMAP.IS_SNVAR[ivar]; 
-	isparse      = -9 ;
-	if ( !IS_SNVAR ) {
-	  // get VAL from HOSTLIB
-	  ivar_STORE   = HOSTLIB.IVAR_STORE[ivar];
-	  VAL          = HOSTLIB.VALUE_ZSORTED[ivar_STORE][igal] ;
-	}
-	else {
-	  // get VAL from SN property
-	  isparse =  HOSTLIB_WGTMAP.INVSPARSE_SNVAR[ivar] ;
-	  VAL     =  VAL_SNVAR[isparse];
-	}
-	VAL_WGTMAP[ivar] = VAL ;
+    GALID  = get_GALID_HOSTLIB(igal);
 
-      } // end ivar loop
-      
+    // strip off HOSTLIB variables used for weighting;
+    // same for every SNVAR bin.
+    for ( ivar=0; ivar < NDIM; ivar++ ) {
+      if ( !HOSTLIB_WGTMAP.IS_SNVAR[ivar] ) {
+	ivar_STORE       = HOSTLIB.IVAR_STORE[ivar];
+	VAL_WGTMAP[ivar] = HOSTLIB.VALUE_ZSORTED[ivar_STORE][igal] ;
+      }
+    }
+
+    for(ibin=0; ibin < NBTOT_SNVAR ; ibin++ ) {
+
+      if ( NROW == 0 )
+	{  WGT = 1.0 ;  SNMAGSHIFT = 0.0 ;  goto WGTSTORE ;    }
+
+      // set SN-dependent values for this bin
+      for ( ivar=0; ivar < NDIM; ivar++ ) {
+	if ( HOSTLIB_WGTMAP.IS_SNVAR[ivar] ) {
+	  isparse          = HOSTLIB_WGTMAP.INVSPARSE_SNVAR[ivar] ;
+	  VAL_WGTMAP[ivar] = VAL_SNVAR_GRID[ibin*N_SNVAR + isparse] ;
+	}
+      }
 
       // interpolate to get TMPVAL = WGT and SNMAGSIFT
       istat = interp_GRIDMAP(&HOSTLIB_WGTMAP.GRIDMAP, VAL_WGTMAP, TMPVAL ) ;
-      
+
       if ( istat != SUCCESS ) {
 	print_preAbort_banner(fnam);
-	printf("\t GALID = %lld  (ibin_SNVAR=%d, igal=%d)\n", 
+	printf("\t GALID = %lld  (ibin_SNVAR=%d, igal=%d)\n",
 	       GALID, ibin, igal );
 	for ( ivar=0; ivar < NDIM; ivar++ ) {  // WGTMAP variables
-	  IS_SNVAR     = HOSTLIB_WGTMAP.IS_SNVAR[ivar]; 
+	  IS_SNVAR     = HOSTLIB_WGTMAP.IS_SNVAR[ivar];
 	  if ( IS_SNVAR ) { continue; }
 	  ivar_STORE   = HOSTLIB.IVAR_STORE[ivar];
 	  varName      = HOSTLIB.VARNAME_STORE[ivar_STORE] ;
 	  VAL          = HOSTLIB.VALUE_ZSORTED[ivar_STORE][igal] ;
 	  VALMIN       = HOSTLIB_WGTMAP.GRIDMAP.VALMIN[ivar];
 	  VALMAX       = HOSTLIB_WGTMAP.GRIDMAP.VALMAX[ivar];
-	  printf("\t %s = %f  (WGTMAP range: %f to %f)\n", 
+	  printf("\t %s = %f  (WGTMAP range: %f to %f)\n",
 		 varName, VAL, VALMIN, VALMAX ); fflush(stdout);
 	}
 	sprintf(c1err,"Could not interpolate WGTMAP for GALID=%lld .", GALID);
 	sprintf(c2err,"interp_GRIDMAP() returned istat = %d", istat);
-	errmsg(SEV_FATAL, 0, fnam, c1err, c2err); 
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
       }
-      
+
       WGT        = TMPVAL[0] / HOSTLIB_WGTMAP.WGTMAX ;
-      SNMAGSHIFT = TMPVAL[1] ; 
-      
-    WGTSUM:
-      
+      SNMAGSHIFT = TMPVAL[1] ;
+
+    WGTSTORE:
+
       // check for random assignment of SNMAGSHIFT (for BiasCor)
-      if(USE_GAMMA_GRID) 
+      if(USE_GAMMA_GRID)
 	{ SNMAGSHIFT = snmagshift_salt2gamma_HOSTLIB(GALID); }
 
       // convert mag shift to 2-byte int to reduce memory
       I2MAG = (short int)(SNMAGSHIFT*I2MAGSCALE_HOSTLIB);
 
-      // local sum
-      WGTSUM = WGTSUM_LAST + WGT;
-      
-      // print first 3 weights and last wgt
-      if ( VBOSE && ibin==0 && (igal <= 1 || igal == NGAL-1) ) {
-	printf("\t   WGT(igal=%d,GALID=%lld) = %f -> WGTSUM = %f \n", 
-	       igal, GALID, WGT, WGTSUM ); 
-	fflush(stdout);
-      }
-	
-      // load global array for each sum            
+      // load global arrays; WGTSUM hold raw WGT until prefix-sum pass
       if ( N_SNVAR > 0 ) {
-	// xxx	HOSTLIB_WGTMAP.WGT_SNVAR[ibin][igal]        = WGT    ;
-	HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin][igal]     = WGTSUM ;
+	HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin][igal]       = WGT ;
 	HOSTLIB_WGTMAP.I2SNMAGSHIFT_SNVAR[ibin][igal] = I2MAG ;
       }
       else {
-	// xxx HOSTLIB_WGTMAP.WGT[igal]        = WGT    ;
-	HOSTLIB_WGTMAP.WGTSUM[igal]     = WGTSUM ;
+	HOSTLIB_WGTMAP.WGTSUM[igal]       = WGT ;
 	HOSTLIB_WGTMAP.I2SNMAGSHIFT[igal] = I2MAG ;
       }
 
-      WGTSUM_LAST  =  WGTSUM ;
-	
-      // store IGAL if this GALID is on the check-list
-      
-      for ( i=0; i < HOSTLIB_WGTMAP.NCHECKLIST; i++ ) {
-	GALID_CHECK = HOSTLIB_WGTMAP.CHECKLIST_GALID[i];
-	ZTRUE_CHECK = HOSTLIB_WGTMAP.CHECKLIST_ZTRUE[i] ;
-	ZDIF        = fabs(ZTRUE - ZTRUE_CHECK) ;
-	if ( GALID == GALID_CHECK && ZDIF < 2.0E-4 ) 
-	  { HOSTLIB_WGTMAP.CHECKLIST_IGAL[i] = igal ; }
-      }
-	
-	
-      LDMPWGT = ( igal == -9 ) ; //  INPUTS.HOSTLIB_MAXREAD - 10  );
-      if ( LDMPWGT ) {
-	sprintf(cvar,"%s", HOSTLIB_WGTMAP.VARNAME[0] );
-	printf(" xxx GALID=%lld  %s=%6.2f   WGT=%5.3f  WGTSUM=%f \n", 
-	       GALID, cvar, VAL_WGTMAP[0], WGT, WGTSUM );
+    }   // end ibin loop
+  }   // end igal loop
+
+  if ( VAL_SNVAR_GRID != NULL ) { free(VAL_SNVAR_GRID); }
+
+  // - - - - - - - - - - - - - - - - - - - -
+  // convert raw weights into cumulative sums (per SNVAR bin)
+  double *ptrWGT ;
+  for(ibin=0; ibin < NBTOT_SNVAR ; ibin++ ) {
+
+    if ( N_SNVAR > 0 )
+      { ptrWGT = HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin] ; }
+    else
+      { ptrWGT = HOSTLIB_WGTMAP.WGTSUM ; }
+
+    WGTSUM_LAST = 0.0 ;
+    for ( igal=IGAL_START ; igal <= IGAL_END ; igal++ ) {
+      WGT          = ptrWGT[igal] ;
+      WGTSUM       = WGTSUM_LAST + WGT ;
+      ptrWGT[igal] = WGTSUM ;
+
+      // print first 3 weights and last wgt
+      if ( VBOSE && ibin==0 && (igal <= 1 || igal == NGAL-1) ) {
+	GALID = get_GALID_HOSTLIB(igal);
+	printf("\t   WGT(igal=%d,GALID=%lld) = %f -> WGTSUM = %f \n",
+	       igal, GALID, WGT, WGTSUM );
 	fflush(stdout);
       }
 
-    }   // end if igal loop
-  }   // end NBTOT
+      WGTSUM_LAST  =  WGTSUM ;
+    }
+  }
+
+  // store IGAL for each GALID on the check-list
+  fill_CHECKLIST_HOSTLIB_WGTMAP(IGAL_START,IGAL_END);
 
+  // write binary cache for the next job with this HOSTLIB+WGTMAP
+  if ( USE_CACHE ) { wr_WGTMAP_CACHE(cacheFile, &CACHE_HEADER); }
 
   // --------------------------
-  // verify interpolated WGTMAP values against optional list of 
+  // verify interpolated WGTMAP values against optional list of
   // exact WGT values specified by the WGTMAP_CHECK keys.
 
   runCheck_HOSTLIB_WGTMAP();
@@ -3292,6 +3725,184 @@ void init_HOSTLIB_WGTMAP(int OPT_INIT, int IGAL_START, int IGAL_END) {
 } // end of init_HOSTLIB_WGTMAP
 
 
+// =======================================
+void fill_CHECKLIST_HOSTLIB_WGTMAP(int IGAL_START, int IGAL_END) {
+
+  // Created Aug 2026  [moved out of init_HOSTLIB_WGTMAP loop]
+  // Store IGAL index for each GALID on the WGTMAP_CHECK list.
+
+  int  i, igal ;
+  long long GALID, GALID_CHECK ;
+  double ZTRUE, ZTRUE_CHECK, ZDIF ;
+  //  char fnam[] = "fill_CHECKLIST_HOSTLIB_WGTMAP" ;
+
+  // --------- BEGIN -----------
+
+  if ( HOSTLIB_WGTMAP.NCHECKLIST == 0 ) { return ; }
+
+  for ( igal=IGAL_START ; igal <= IGAL_END ; igal++ ) {
+    GALID  = get_GALID_HOSTLIB(igal);
+    ZTRUE  = get_ZTRUE_HOSTLIB(igal);
+    for ( i=0; i < HOSTLIB_WGTMAP.NCHECKLIST; i++ ) {
+      GALID_CHECK = HOSTLIB_WGTMAP.CHECKLIST_GALID[i];
+      ZTRUE_CHECK = HOSTLIB_WGTMAP.CHECKLIST_ZTRUE[i] ;
+      ZDIF        = fabs(ZTRUE - ZTRUE_CHECK) ;
+      if ( GALID == GALID_CHECK && ZDIF < 2.0E-4 )
+	{ HOSTLIB_WGTMAP.CHECKLIST_IGAL[i] = igal ; }
+    }
+  }
+
+  return ;
+
+} // end fill_CHECKLIST_HOSTLIB_WGTMAP
+
+
+// =======================================
+void name_WGTMAP_CACHE(char *cacheFile, WGTMAP_CACHE_HEADER_DEF *HEADER) {
+
+  // Created Aug 2026
+  // Construct *cacheFile name next to the HOSTLIB, and load
+  // *HEADER with the stale-cache keys for the current job.
+  // A stat failure loads size=0, which still matches between
+  // the writing and reading job.
+
+  struct stat statbuf ;
+  char *WGTMAP_FILE = INPUTS.HOSTLIB_WGTMAP_FILE ;
+  //  char fnam[] = "name_WGTMAP_CACHE" ;
+
+  // --------- BEGIN -----------
+
+  sprintf(cacheFile, "%s.WGTCACHE", HOSTLIB.FILENAME );
+
+  HEADER->MAGIC        = MAGIC_WGTMAP_CACHE ;
+  HEADER->VERSION      = VERSION_WGTMAP_CACHE ;
+  HEADER->NGAL         = HOSTLIB.NGAL_STORE ;
+  HEADER->NBTOT_SNVAR  = HOSTLIB_WGTMAP.NBTOT_SNVAR ;
+  HEADER->GAMMA_GRID[0] = INPUTS.BIASCOR_SALT2GAMMA_GRID[0] ;
+  HEADER->GAMMA_GRID[1] = INPUTS.BIASCOR_SALT2GAMMA_GRID[1] ;
+
+  HEADER->TEXTSIZE_HOSTLIB = 0 ;
+  if ( stat(HOSTLIB.FILENAME,&statbuf) == 0 )
+    { HEADER->TEXTSIZE_HOSTLIB = (long long)statbuf.st_size ; }
+
+  HEADER->TEXTSIZE_WGTMAP = 0 ;
+  if ( !IGNOREFILE(WGTMAP_FILE)  &&  stat(WGTMAP_FILE,&statbuf) == 0 )
+    { HEADER->TEXTSIZE_WGTMAP = (long long)statbuf.st_size ; }
+
+  return ;
+
+} // end name_WGTMAP_CACHE
+
+
+// =======================================
+bool rd_WGTMAP_CACHE(char *cacheFile, WGTMAP_CACHE_HEADER_DEF *HEADER) {
+
+  // Created Aug 2026
+  // Read weight sums and mag shifts from binary *cacheFile into the
+  // already-malloc'ed HOSTLIB_WGTMAP arrays. Returns true on
+  // success; returns false if there is no cache, or if the stored
+  // header does not match *HEADER (stale cache -> recompute).
+
+  int  NGAL  = HOSTLIB.NGAL_STORE ;
+  int  NBTOT = HOSTLIB_WGTMAP.NBTOT_SNVAR ;
+  int  N_SNVAR = HOSTLIB_WGTMAP.N_SNVAR ;
+  int  ibin, NRD=0 ;
+  FILE *fp ;
+  WGTMAP_CACHE_HEADER_DEF HD ;
+  //  char fnam[] = "rd_WGTMAP_CACHE" ;
+
+  // --------- BEGIN -----------
+
+  fp = fopen(cacheFile,"rb");
+  if ( fp == NULL ) { return(false); }
+
+  if ( fread(&HD, sizeof(HD), 1, fp) != 1           ||
+       HD.MAGIC            != HEADER->MAGIC         ||
+       HD.VERSION          != HEADER->VERSION       ||
+       HD.NGAL             != HEADER->NGAL          ||
+       HD.NBTOT_SNVAR      != HEADER->NBTOT_SNVAR   ||
+       HD.TEXTSIZE_HOSTLIB != HEADER->TEXTSIZE_HOSTLIB ||
+       HD.TEXTSIZE_WGTMAP  != HEADER->TEXTSIZE_WGTMAP  ||
+       HD.GAMMA_GRID[0]    != HEADER->GAMMA_GRID[0] ||
+       HD.GAMMA_GRID[1]    != HEADER->GAMMA_GRID[1] ) {
+    fclose(fp);  return(false);   // stale or foreign cache
+  }
+
+  if ( N_SNVAR > 0 ) {
+    for(ibin=0; ibin < NBTOT; ibin++ ) {
+      NRD += fread(HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin],
+		   sizeof(double), NGAL, fp) ;
+      NRD += fread(HOSTLIB_WGTMAP.I2SNMAGSHIFT_SNVAR[ibin],
+		   sizeof(short int), NGAL, fp) ;
+    }
+  }
+  else {
+    NRD += fread(HOSTLIB_WGTMAP.WGTSUM,       sizeof(double),    NGAL, fp);
+    NRD += fread(HOSTLIB_WGTMAP.I2SNMAGSHIFT, sizeof(short int), NGAL, fp);
+    NBTOT = 1 ;
+  }
+  fclose(fp);
+
+  if ( NRD != 2*NBTOT*NGAL ) { return(false); }  // truncated -> recompute
+
+  printf("\t Read WGTMAP weight sums from binary cache \n\t   %s\n",
+	 cacheFile );  fflush(stdout);
+
+  return(true);
+
+} // end rd_WGTMAP_CACHE
+
+
+// =======================================
+void wr_WGTMAP_CACHE(char *cacheFile, WGTMAP_CACHE_HEADER_DEF *HEADER) {
+
+  // Created Aug 2026
+  // Write weight sums and mag shifts to binary *cacheFile.
+  // Write temp file and rename so parallel jobs never read a
+  // partial cache; failure to write (read-only area) is not
+  // an error.
+
+  int  NGAL  = HOSTLIB.NGAL_STORE ;
+  int  NBTOT = HOSTLIB_WGTMAP.NBTOT_SNVAR ;
+  int  N_SNVAR = HOSTLIB_WGTMAP.N_SNVAR ;
+  int  ibin ;
+  FILE *fp ;
+  char tmpFile[MXPATHLEN+40] ;
+  //  char fnam[] = "wr_WGTMAP_CACHE" ;
+
+  // --------- BEGIN -----------
+
+  sprintf(tmpFile, "%s_tmp%d", cacheFile, getpid() );
+
+  fp = fopen(tmpFile,"wb");
+  if ( fp == NULL ) { return ; }
+
+  fwrite(HEADER, sizeof(WGTMAP_CACHE_HEADER_DEF), 1, fp);
+
+  if ( N_SNVAR > 0 ) {
+    for(ibin=0; ibin < NBTOT; ibin++ ) {
+      fwrite(HOSTLIB_WGTMAP.WGTSUM_SNVAR[ibin],
+	     sizeof(double), NGAL, fp) ;
+      fwrite(HOSTLIB_WGTMAP.I2SNMAGSHIFT_SNVAR[ibin],
+	     sizeof(short int), NGAL, fp) ;
+    }
+  }
+  else {
+    fwrite(HOSTLIB_WGTMAP.WGTSUM,       sizeof(double),    NGAL, fp);
+    fwrite(HOSTLIB_WGTMAP.I2SNMAGSHIFT, sizeof(short int), NGAL, fp);
+  }
+  fclose(fp);
+
+  rename(tmpFile, cacheFile);
+
+  printf("\t Wrote WGTMAP weight sums to binary cache \n\t   %s\n",
+	 cacheFile );  fflush(stdout);
+
+  return ;
+
+} // end wr_WGTMAP_CACHE
+
+
 // =========================================
 void malloc_HOSTLIB_WGTMAP(void) {
 
@@ -3554,6 +4165,25 @@ void init_GALMAG_HOSTLIB(void) {
   // init 2d Gaussian integrals
   init_Gauss2d_Overlap();
 
+  // Aug 2026: the radial-integration grid and PSF list are fixed, so
+  // pre-compute the Gauss2d overlap for every (radius bin, PSF) here;
+  // removes NRBIN*NMAGPSF Gauss2d_Overlap calls per event in
+  // GEN_SNHOST_GALMAG. Mirror the R-loop there so that each Rcen
+  // matches bitwise.
+  double R, Rcen, RcenFrac, sigFrac, PSFSIG, Rbin = HOSTLIB.Aperture_Rbin ;
+  int jbinR = 0 ;
+  for ( R = 0.0; R < Rmax; R += Rbin ) {
+    Rcen = R + 0.5*Rbin ;
+    for ( j=1; j <= NMAGPSF_HOSTLIB ; j++ ) {
+      PSFSIG   = HOSTLIB.Aperture_PSFSIG[j] ;
+      RcenFrac = Rcen   / HOSTLIB.Aperture_Radius[j] ;
+      sigFrac  = PSFSIG / HOSTLIB.Aperture_Radius[j] ;
+      HOSTLIB.Aperture_GaussOvp[jbinR][j] = Gauss2d_Overlap(RcenFrac,sigFrac);
+    }
+    jbinR++ ;
+    if ( jbinR >= NRBIN_GALMAG ) { break ; }
+  }
+
 } // init_GALMAG_HOSTLIB
 
 
@@ -6215,18 +6845,15 @@ void   GEN_SNHOST_ANGLE(double a, double b, double *ANGLE) {
 void GEN_SNHOST_NBR(int IGAL) {
 
   // Created Nov 2019 by R. Kessler
-  // If NBR_LIST column exists, parse it and convert row numbers
-  // to SNHOSTGAL.IGAL_NBR_LIST
+  // If NBR_LIST column exists, load SNHOSTGAL.IGAL_NBR_LIST from
+  // the pre-resolved neighbor indices.
   //
-  // Beware that rowNum in +HOSTNBR file is a fortran-like
-  // index, but here it is read with C-like index.
+  // Aug 2026: the per-event string parse and row-number translation
+  // moved to prep_NBR_INDEX_HOSTLIB (one-time init); here we just
+  // copy the packed IGAL list for this galaxy.
 
   int  LDMP = 0 ; // ( NCALL_GEN_SNHOST_DRIVER < 20 );
-  int  i, ii, NNBR_READ, NNBR_STORE, rowNum, IGAL_STORE, IGAL_ZSORT ;
-  int  ROWNUM_LIST[MXNBR_LIST];
-  long long GALID ;
-  char NBR_LIST[MXCHAR_NBR_LIST] ;
-  char NO_NBR[] = "-1" ;
+  int  i, ii, NNBR_STORE, ISTART, IGAL_ZSORT ;
   char fnam[] = "GEN_SNHOST_NBR";
 
   // ---------------- BEGIN ----------------
@@ -6244,64 +6871,40 @@ void GEN_SNHOST_NBR(int IGAL) {
   // bail if there is no NBR list
   if ( HOSTLIB.IVAR_NBR_LIST < 0 ) { return ; }
 
-  sprintf(NBR_LIST, "%s", HOSTLIB.NBR_ZSORTED[IGAL] );
-  GALID      = get_GALID_HOSTLIB(IGAL);
-
   // bail if this GAL has no NBR
-  if ( strcmp(NBR_LIST,NO_NBR) == 0 ) { return ; }
-
-  if ( LDMP ) {
-    printf(" xxx ----------------------------------------- \n");
-    printf(" xxx %s: parse NBR_LIST for GALID=%lld: \n", fnam, GALID ); 
-  }
-
-  // parse comma-sep list of HOSTLIB row numbers
-  splitString2(NBR_LIST, COMMA, MXNBR_LIST , &NNBR_READ, &TMPWORD_HOSTLIB[1]);
+  if ( HOSTLIB.NBR_NSTORE[IGAL] == 0 ) { return ; }
 
-  NNBR_READ++;    // include true host
+  // copy pre-resolved z-sorted IGAL indices (true host is element 0)
+  ISTART     = HOSTLIB.NBR_IGAL_START[IGAL];
   NNBR_STORE = 1; // start counter on stored neighbors
 
-  ROWNUM_LIST[0] = -9;
-  for(i=1; i < NNBR_READ; i++ ) {   // start at 1 to skip true host
-    sscanf(TMPWORD_HOSTLIB[i], "%d", &rowNum);
-
-    // rowNum is a fotran-line index starting at 1, which  is 
-    // NGAL_READ+1 before cuts. Use two layers of  indexing to 
-    // get the desired z-sorted IGAL
-    IGAL_STORE = HOSTLIB.LIBINDEX_READ[rowNum-1];
-    if ( IGAL_STORE < 0 ) { continue; } // neighbor was cut from sample
-
-    IGAL_ZSORT = HOSTLIB.LIBINDEX_ZSORT[IGAL_STORE]; 
-    GALID      = get_GALID_HOSTLIB(IGAL_ZSORT);
-
+  for(i=0; i < HOSTLIB.NBR_NSTORE[IGAL] && NNBR_STORE < MXNBR_LIST; i++ ) {
+    IGAL_ZSORT = HOSTLIB.NBR_IGAL_PACKED[ISTART+i];
     ii = NNBR_STORE; NNBR_STORE++ ;
     SNHOSTGAL.IGAL_NBR_LIST[ii] = IGAL_ZSORT;
-
-    ROWNUM_LIST[ii] = rowNum; // for dump
-    if( LDMP == 6 ) {
-      printf("\t xxx rowNum(%d) = %d  --> GALID = %lld\n", i, rowNum, GALID); 
-      fflush(stdout);
-    }
-
   }
-  
+
   SNHOSTGAL.NNBR = NNBR_STORE ;
 
 
   if ( LDMP ) {
     int  IVAR_RA     = HOSTLIB.IVAR_RA ;
     int  IVAR_DEC    = HOSTLIB.IVAR_DEC ;
+    long long GALID ;
     double RA_NBR, DEC_NBR, RA_REF, DEC_REF;
-    RA_REF  = HOSTLIB.VALUE_ZSORTED[IVAR_RA][IGAL] ;  
-    DEC_REF = HOSTLIB.VALUE_ZSORTED[IVAR_DEC][IGAL] ;  
+    RA_REF  = HOSTLIB.VALUE_ZSORTED[IVAR_RA][IGAL] ;
+    DEC_REF = HOSTLIB.VALUE_ZSORTED[IVAR_DEC][IGAL] ;
+    printf(" xxx ----------------------------------------- \n");
+    printf(" xxx %s: NBR list for GALID=%lld: \n",
+	   fnam, get_GALID_HOSTLIB(IGAL) );
     for(i=0; i < NNBR_STORE; i++ ) {
       IGAL_ZSORT = SNHOSTGAL.IGAL_NBR_LIST[i];
       GALID      = get_GALID_HOSTLIB(IGAL_ZSORT);
-      RA_NBR     = HOSTLIB.VALUE_ZSORTED[IVAR_RA][IGAL_ZSORT] ;  
-      DEC_NBR    = HOSTLIB.VALUE_ZSORTED[IVAR_DEC][IGAL_ZSORT] ; 
-      printf(" xxx %2d : IGAL=%6d  ROW=%6d  GALID=%8lld  "
+      RA_NBR     = HOSTLIB.VALUE_ZSORTED[IVAR_RA][IGAL_ZSORT] ;
+      DEC_NBR    = HOSTLIB.VALUE_ZSORTED[IVAR_DEC][IGAL_ZSORT] ;
+      printf(" xxx %2d : IGAL=%6d  GALID=%8lld  "
 	     "Del(RA,DEC)=%7.4f,%7.4f \n",
-	     i, IGAL_ZSORT, ROWNUM_LIST[i], GALID, 
+	     i, IGAL_ZSORT, GALID,
 	     RA_NBR-RA_REF, DEC_NBR-DEC_REF);
       fflush(stdout);
     }
@@ -6771,21 +7374,21 @@ void GEN_SNHOST_GALMAG(int IGAL) {
 
   int  NNBR       = SNHOSTGAL.NNBR ;
 
-  double 
+  double
      x_SN, y_SN
-    ,xgal, ygal, MAGOBS, MAGOBS_LIB, PSF, FGAL, dF
+    ,xgal, ygal, MAGOBS, MAGOBS_LIB, FGAL, dF
     ,Rmin, Rmax, Rbin, R, Rcen, dm
     ,THmin, THmax, THbin, TH
     ,dRdTH, Jac
     ,GALFRAC_SUM[NMAGPSF_HOSTLIB+1]       // summed over Sersic profile
-    ,sigFrac, RcenFrac, GALFRAC
-    ,GaussOvp[NMAGPSF_HOSTLIB+1] 
+    ,GALFRAC
+    ,GaussOvp[NMAGPSF_HOSTLIB+1]
     ,AV, LAMOBS_AVG, MWXT[MXFILTINDX]
     ,RVMW = 3.1
     ;
 
   float lamavg4, lamrms4, lammin4, lammax4  ;
-  int ifilt, ifilt_obs, i, inbr, IVAR, jbinTH, opt_frame    ;
+  int ifilt, ifilt_obs, i, inbr, IVAR, jbinR, jbinTH, opt_frame    ;
   char fnam[] = "GEN_SNHOST_GALMAG" ;
 
   // ------------ BEGIN -------------
@@ -6864,18 +7467,22 @@ void GEN_SNHOST_GALMAG(int IGAL) {
   xxxxxxxxxx */
 
 
+  // Aug 2026: load per-event Sersic terms once instead of once per
+  // integration bin inside get_GALFLUX_HOSTLIB.
+  setup_GALFLUX_HOSTLIB();
+
   // start integration loop in polar coords around the SN.
+  jbinR = 0 ;
   for ( R = Rmin; R < Rmax; R += Rbin ) {
     Rcen = R  + 0.5*Rbin ;  // center of R-bin w.r.t SN (arcsec)
     Jac  = Rcen * dRdTH ;   // Jacobian factor = r dr dtheta
-    
-    // store aperture-dependent stuff before THETA loop
-    for ( i=1; i <= NMAGPSF_HOSTLIB ; i++ ) { 
-      PSF         = HOSTLIB.Aperture_PSFSIG[i] ; // = 1/2 x Aperture_Radius
-      RcenFrac    = Rcen / HOSTLIB.Aperture_Radius[i] ; 
-      sigFrac     = PSF  / HOSTLIB.Aperture_Radius[i] ; 
-      GaussOvp[i] = Gauss2d_Overlap(RcenFrac,sigFrac);   
-    }
+
+    // fetch aperture-dependent stuff before THETA loop
+    // (Aug 2026: pre-computed in init_GALMAG_HOSTLIB)
+    if ( jbinR >= NRBIN_GALMAG ) { jbinR = NRBIN_GALMAG-1 ; }
+    for ( i=1; i <= NMAGPSF_HOSTLIB ; i++ )
+      { GaussOvp[i] = HOSTLIB.Aperture_GaussOvp[jbinR][i] ; }
+    jbinR++ ;
 
     jbinTH = 0;
     for ( TH = THmin; TH < THmax; TH += THbin ) {
@@ -7114,6 +7721,48 @@ double Gauss2d_Overlap(double offset, double sig) {
 
 
 
+// ===================================
+void setup_GALFLUX_HOSTLIB(void) {
+
+  // Created Aug 2026
+  // Compute per-event Sersic terms for get_GALFLUX_HOSTLIB and store
+  // in PREP_GALFLUX_HOSTLIB; called once per event from
+  // GEN_SNHOST_GALMAG so that the NRBIN*NTHBIN integration bins
+  // do not re-derive the same per-component quantities.
+
+  int    j ;
+  double a, b, w, n, bn, FGAL_TOT ;
+  //  char fnam[] = "setup_GALFLUX_HOSTLIB" ;
+
+  // ---------------- BEGIN ---------------
+
+  PREP_GALFLUX_HOSTLIB.NPROF = SERSIC_PROFILE.NPROF ;
+
+  for ( j=0; j < SERSIC_PROFILE.NPROF; j++ ) {
+
+    a   = SNHOSTGAL.SERSIC.a[j] ;
+    b   = SNHOSTGAL.SERSIC.b[j] ;
+    n   = SNHOSTGAL.SERSIC.n[j] ;
+    w   = SNHOSTGAL.SERSIC.w[j] ;
+    bn  = SNHOSTGAL.SERSIC.bn[j] ;
+
+    // Flux normalization = total flux over galaxy.
+    // The stored INTEG_SUM is integrated over the reduced radius;
+    // the pre-factor a*b converts to the total flux over the
+    // physical galaxy size.
+    FGAL_TOT = (a*b) * SERSIC_TABLE.INTEG_SUM[NSERSIC_TABLE-1];
+
+    PREP_GALFLUX_HOSTLIB.INV_A[j] = 1.0/a ;
+    PREP_GALFLUX_HOSTLIB.INV_B[j] = 1.0/b ;
+    PREP_GALFLUX_HOSTLIB.REXP[j]  = 1.0/n ;
+    PREP_GALFLUX_HOSTLIB.BN[j]    = bn ;
+    PREP_GALFLUX_HOSTLIB.FNORM[j] = w/FGAL_TOT ;
+  }
+
+  return ;
+
+} // end of setup_GALFLUX_HOSTLIB
+
 // ===================================
 double get_GALFLUX_HOSTLIB(double xgal, double ygal) {
 
@@ -7125,43 +7774,34 @@ double get_GALFLUX_HOSTLIB(double xgal, double ygal) {
   // Mar 4 2015: fix aweful index bug setting FGAL_TOT.
   //             Bug affects only the host-noise contribution.
   //
+  // Aug 2026: per-component terms come from PREP_GALFLUX_HOSTLIB
+  //   (see setup_GALFLUX_HOSTLIB); this function is called once per
+  //   integration bin, so keep it lean.
 
-  int    j, NBIN ;
-  double a, b, w, n, bn, rexp, sqsum,  arg ;
-  double reduced_R, xx, yy, FSUM_PROFILE, F, FGAL_TOT    ;
+  int    j ;
+  double bn, rexp, sqsum,  arg ;
+  double reduced_R, xx, yy, FSUM_PROFILE, F ;
   //  char fnam[] = "get_GALFLUX_HOSTLIB" ;
 
   // ---------------- BEGIN ---------------
 
   FSUM_PROFILE = 0.0 ;
-  NBIN = SERSIC_TABLE.NBIN_reduced ;
 
-  for ( j=0; j < SERSIC_PROFILE.NPROF; j++ ) {
-    
-    // strip off info for this galaxy component.
-    a   = SNHOSTGAL.SERSIC.a[j] ;
-    b   = SNHOSTGAL.SERSIC.b[j] ;
-    n   = SNHOSTGAL.SERSIC.n[j] ;
-    w   = SNHOSTGAL.SERSIC.w[j] ;
-    bn  = SNHOSTGAL.SERSIC.bn[j] ;
-    rexp = 1./n ;
+  for ( j=0; j < PREP_GALFLUX_HOSTLIB.NPROF; j++ ) {
 
-    // Flux normalization = total flux over galaxy.
-    // The stored INTEG_SUM is integrated over the reduced radius;
-    // the pre-factor a*b converts to the total flux over the 
-    // physical galaxy size.
-    FGAL_TOT = (a*b) * SERSIC_TABLE.INTEG_SUM[NSERSIC_TABLE-1];
+    rexp = PREP_GALFLUX_HOSTLIB.REXP[j] ;
+    bn   = PREP_GALFLUX_HOSTLIB.BN[j] ;
 
     // get scale needed to move input xgal,ygal onto the
     // half-light ellipse; this scale is the reduced radius (R/Re)
-    xx        = xgal/a ;
-    yy        = ygal/b ;
-    sqsum     = xx*xx + yy*yy ; 
+    xx        = xgal * PREP_GALFLUX_HOSTLIB.INV_A[j] ;
+    yy        = ygal * PREP_GALFLUX_HOSTLIB.INV_B[j] ;
+    sqsum     = xx*xx + yy*yy ;
     reduced_R = sqrt(sqsum) ;
 
     // calculate Flux for this Sersic component
-    arg  = pow(reduced_R,rexp) - 1.0 ; 
-    F    = (w/FGAL_TOT) * exp(-bn*arg) ;
+    arg  = pow(reduced_R,rexp) - 1.0 ;
+    F    = PREP_GALFLUX_HOSTLIB.FNORM[j] * exp(-bn*arg) ;
 
     FSUM_PROFILE += F ;
   }
@@ -8093,7 +8733,8 @@ void get_LINE_APPEND_HOSTLIB_plusNbr(int igal_unsort, char *LINE_APPEND) {
   double SEP_NBR_LIST[MXNNBR_STORE];
   int    IGAL_LIST[MXNNBR_STORE];
   long long GALID, GALID_NBR, GALID_LIST[MXNNBR_STORE] ;
-  double RA_GAL, DEC_GAL, RA_NBR, DEC_NBR, SEP_NBR, SEP_DEC;
+  double RA_GAL, DEC_GAL, RA_NBR, DEC_NBR, SEP_NBR, SEP_DEC, SEP_RA;
+  double COSDEC_GAL ;
   int  igal_zsort, igal2_unsort, igal2_zsort, igal_DECsort ;
   int  NNBR, NTRY, j, ISORT_CHANGE, isort, NPASS_DEC, LSTDOUT ;
   char cval[20], cval2[20], LINE_STDOUT[200];;
@@ -8103,10 +8744,11 @@ void get_LINE_APPEND_HOSTLIB_plusNbr(int igal_unsort, char *LINE_APPEND) {
 
   igal_zsort   = HOSTLIB.LIBINDEX_ZSORT[igal_unsort];
   igal_DECsort = HOSTLIB_NBR_WRITE.SKY_SORTED_IGAL_zsort[igal_zsort];
-  RA_GAL       = HOSTLIB.VALUE_ZSORTED[IVAR_RA][igal_zsort] ;  
-  DEC_GAL      = HOSTLIB.VALUE_ZSORTED[IVAR_DEC][igal_zsort] ; 
+  RA_GAL       = HOSTLIB.VALUE_ZSORTED[IVAR_RA][igal_zsort] ;
+  DEC_GAL      = HOSTLIB.VALUE_ZSORTED[IVAR_DEC][igal_zsort] ;
   GALID        = (long long)HOSTLIB.VALUE_ZSORTED[IVAR_GALID][igal_zsort] ;
-  
+  COSDEC_GAL   = cos(DEC_GAL*RADIAN);
+
 
   if ( LDMP ) {
     printf("\n xxx ---------- %s DUMP ---------------- \n", fnam);
@@ -8154,6 +8796,14 @@ void get_LINE_APPEND_HOSTLIB_plusNbr(int igal_unsort, char *LINE_APPEND) {
       }
       */
 
+      // Aug 2026: cheap RA pre-cut before trig-based angSep; the
+      // DEC band spans all RA, so nearly every candidate fails here.
+      // Wrap-safe for either RA convention (0 to 360 or -180 to 180).
+      SEP_RA = fabs(RA_NBR - RA_GAL);
+      if ( SEP_RA > 180.0 ) { SEP_RA = 360.0 - SEP_RA ; }
+      SEP_RA *= ( COSDEC_GAL * ASEC_PER_DEG ) ;
+      if ( SEP_RA > 1.01*SEPNBR_MAX ) { continue ; }
+
       SEP_NBR = angSep(RA_GAL, DEC_GAL, RA_NBR, DEC_NBR, ASEC_PER_DEG);
       if ( SEP_NBR > SEPNBR_MAX ) { continue ; }
       GALID_NBR = (long long)HOSTLIB.VALUE_ZSORTED[IVAR_GALID][igal2_zsort] ;
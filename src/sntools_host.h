@@ -50,6 +50,8 @@
 #define HOSTLIB_MSKOPT_DUMPROW    2048 // DUMP 1 row per host for parsing
 #define HOSTLIB_MSKOPT_PLUSMAGS   8192 // compute & write host mags from host spectra
 #define HOSTLIB_MSKOPT_PLUSNBR 16384  // append list of neighbors to HOSTLIB
+#define HOSTLIB_MSKOPT_BINARY  32768  // use mmap'ed binary cache of GAL table
+#define HOSTLIB_MSKOPT_WGTMAP_CACHE 65536 // binary cache of WGTMAP sums
 
 #define HOSTLIB_1DINDEX_ID 10    // ID for 1DINDEX transformations
 
@@ -175,6 +177,14 @@ struct HOSTLIB_DEF {
   char **NBR_UNSORTED ; // read from NBR_LIST column, Nov 11 2019
   char **NBR_ZSORTED ;
 
+  // Aug 2026: neighbor row numbers resolved to z-sorted IGAL indices
+  // once at init (see prep_NBR_INDEX_HOSTLIB), packed into one array;
+  // GEN_SNHOST_NBR copies a short pre-resolved list per event instead
+  // of re-parsing the NBR_LIST string and index maps.
+  int  *NBR_IGAL_PACKED ;  // IGAL_ZSORT of each stored neighbor
+  int  *NBR_IGAL_START ;   // per-IGAL start index into packed list
+  int  *NBR_NSTORE ;       // per-IGAL number of stored neighbors
+
   int *LIBINDEX_READ; // map between read index (no cuts) and unsorted
 
   int MALLOCSIZE_D, MALLOCSIZE_I, MALLOCSIZE_Cp ;
@@ -242,9 +252,27 @@ struct HOSTLIB_DEF {
   double Aperture_cosTH[NTHBIN_GALMAG+1] ;
   double Aperture_sinTH[NTHBIN_GALMAG+1] ;
 
+  // Aug 2026: Gauss2d overlap vs. (radius bin, PSF index); the
+  // aperture grid and PSF list are fixed, so these are computed once
+  // in init_GALMAG_HOSTLIB instead of per event in GEN_SNHOST_GALMAG.
+  double Aperture_GaussOvp[NRBIN_GALMAG][NMAGPSF_HOSTLIB+1] ;
+
 } HOSTLIB ;
 
 
+// Aug 2026: per-event Sersic terms for get_GALFLUX_HOSTLIB, computed
+// once per event in setup_GALFLUX_HOSTLIB instead of once per
+// integration bin (NRBIN_GALMAG x NTHBIN_GALMAG calls per event).
+struct {
+  int    NPROF ;
+  double INV_A[MXSERSIC_HOSTLIB] ;   // 1/a (a = semi-major half-light)
+  double INV_B[MXSERSIC_HOSTLIB] ;   // 1/b
+  double REXP[MXSERSIC_HOSTLIB]  ;   // 1/n
+  double BN[MXSERSIC_HOSTLIB]    ;   // b_n
+  double FNORM[MXSERSIC_HOSTLIB] ;   // w/FGAL_TOT
+} PREP_GALFLUX_HOSTLIB ;
+
+
 #define MXCHAR_NBR_LIST 100
 #define MXNBR_LIST       50
 
@@ -272,6 +300,50 @@ struct {
 } HOSTLIB_CUTS;
 
 
+// mmap'ed binary cache of the GAL table (Aug 2026);
+// see HOSTLIB_MSKOPT_BINARY
+#define MAGIC_HOSTLIB_BINARY    0x484C4942  // 'BILH'
+#define VERSION_HOSTLIB_BINARY  1
+
+typedef struct {
+  int       MAGIC, VERSION ;
+  int       NVAR, NGAL ;
+  long long TEXTSIZE ;   // size of text HOSTLIB; stale-cache check
+} HOSTLIB_BINARY_HEADER_DEF ;
+
+struct {
+  bool   USE ;             // T => read GAL table from binary cache
+  bool   WRFLAG ;          // T => write cache after text read
+  char   FILENAME[MXPATHLEN];  // [HOSTLIB_FILE].BINARY
+
+  HOSTLIB_BINARY_HEADER_DEF HEADER ;
+  size_t MAPSIZE ;         // bytes of mmap'ed region
+  double *MAPVAL ;         // column-major values; [ivar*NGAL + igal]
+
+  int  NEED_IVAR[MXVAR_HOSTLIB]; // sparse list of columns to fault in
+  int  NNEED ;
+
+  double *STAGE_VAL[MXVAR_HOSTLIB]; // staging columns for converter
+  int     STAGE_MALLOCSIZE ;
+} HOSTLIB_BINARY ;
+
+
+// binary cache of interpolated WGTMAP weight sums (Aug 2026);
+// see HOSTLIB_MSKOPT_WGTMAP_CACHE. Stale-cache check uses the
+// text sizes of the HOSTLIB and WGTMAP files plus the inputs
+// that alter the stored sums.
+#define MAGIC_WGTMAP_CACHE    0x43544757  // 'WGTC'
+#define VERSION_WGTMAP_CACHE  1
+
+typedef struct {
+  int       MAGIC, VERSION ;
+  int       NGAL, NBTOT_SNVAR ;
+  long long TEXTSIZE_HOSTLIB ;   // size of text HOSTLIB
+  long long TEXTSIZE_WGTMAP ;    // size of WGTMAP file (0 if inside HOSTLIB)
+  double    GAMMA_GRID[2] ;      // BIASCOR_SALT2GAMMA_GRID input
+} WGTMAP_CACHE_HEADER_DEF ;
+
+
 struct SAMEHOST_DEF {
   int REUSE_FLAG ;          // 1-> re-use host
   unsigned short  *NUSE ;     // number of times each host is used.
@@ -602,7 +674,11 @@ void   parse_HOSTLIB_WGTMAP(FILE *fp, char *string);
 int    read_VARNAMES_WGTMAP(char *VARLIST);
 bool   checkSNvar_HOSTLIB_WGTMAP(char *varName);
 void   runCheck_HOSTLIB_WGTMAP(void);
-void   malloc_HOSTLIB_WGTMAP(void); 
+void   malloc_HOSTLIB_WGTMAP(void);
+void   fill_CHECKLIST_HOSTLIB_WGTMAP(int IGAL_START, int IGAL_END);
+void   name_WGTMAP_CACHE(char *cacheFile, WGTMAP_CACHE_HEADER_DEF *HEADER);
+bool   rd_WGTMAP_CACHE(char *cacheFile, WGTMAP_CACHE_HEADER_DEF *HEADER);
+void   wr_WGTMAP_CACHE(char *cacheFile, WGTMAP_CACHE_HEADER_DEF *HEADER); 
 // xxxvoid   malloc_SNVAR_HOSTLIB_WGTMAP(int NGAL, int NBTOT, double ***PTR);
 void   prep_SNVAR_HOSTLIB_WGTMAP(void);
 void   getVal_SNVAR_HOSTLIB_WGTMAP(int ibin, double *VAL_WGTMAP); // init
@@ -612,12 +688,17 @@ void   parse_Sersic_n_fixed(FILE *fp, char *string);
 void   read_head_HOSTLIB(FILE *fp);
 void   checkAlternateVarNames_HOSTLIB(char *varName) ;
 void   read_gal_HOSTLIB(FILE *fp);
-void   read_galRow_HOSTLIB(FILE *fp, int nval, double *values, 
+void   read_galRow_HOSTLIB(FILE *fp, int nval, double *values,
 			   char *field, char *nbr_list  );
+void   open_HOSTLIB_binary(void);
+void   read_galRow_HOSTLIB_binary(int igal, double *values);
+void   store_galRow_HOSTLIB_binary(double *values);
+void   write_HOSTLIB_binary(void);
 int    passCuts_HOSTLIB(double *xval);
 void   summary_snpar_HOSTLIB(void) ;
 void   malloc_HOSTLIB(int NGAL_STORE, int NGAL_READ);
 void   sortz_HOSTLIB(void);
+void   prep_NBR_INDEX_HOSTLIB(void);
 void   zptr_HOSTLIB(void);
 void   init_HOSTLIB_ZPHOTEFF(void);
 void   init_GALMAG_HOSTLIB(void);
@@ -647,6 +728,7 @@ bool   ISCHAR_HOSTLIB(int IVAR);
 long long get_GALID_HOSTLIB(int igal);
 double get_ZTRUE_HOSTLIB(int igal);
 double get_VALUE_HOSTLIB(int ivar, int igal);
+void   setup_GALFLUX_HOSTLIB(void);  // Aug 2026
 double get_GALFLUX_HOSTLIB(double a, double b);
 
 double interp_GALMAG_HOSTLIB(int ifilt_obs, double PSF ); 
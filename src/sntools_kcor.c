@@ -24,6 +24,10 @@
 #include "sntools_spectrograph.h"
 #include "MWgaldust.h"
 
+#include <fcntl.h>      // Aug 2026: for shared-memory kcor tables
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 
 // ======================================
 void READ_KCOR_DRIVER(char *kcorFile, char *FILTERS_SURVEY,
@@ -175,6 +179,178 @@ void  read_kcor_open(void) {
 } // end read_kcor_open
 
 
+// =============================
+bool useFlag_kcor_shm(void) {
+
+  // Created Aug 2026
+  // Return true if shared-memory kcor tables are enabled via env
+  // var KCOR_SHM=1. Sharing is disabled (with one-time warning) if
+  // any user primary-mag shift is set, since shifted tables are
+  // job-specific and must stay in private memory.
+
+  static int USEFLAG = -9 ;   // evaluate once
+  int ifilt;
+  char *env ;
+  char fnam[] = "useFlag_kcor_shm" ;
+
+  // --------- BEGIN ----------
+
+  if ( USEFLAG >= 0 ) { return (bool)USEFLAG ; }
+
+  USEFLAG = 0 ;
+  env = getenv("KCOR_SHM");
+  if ( env == NULL || strcmp(env,"1") != 0 ) { return false; }
+
+  USEFLAG = 1 ;
+  for(ifilt=0; ifilt < MXFILT_KCOR; ifilt++ ) {
+    if ( KCOR_INFO.MAGREST_SHIFT_PRIMARY[ifilt] != 0.0 ||
+	 KCOR_INFO.MAGOBS_SHIFT_PRIMARY[ifilt]  != 0.0 )
+      { USEFLAG = 0 ; }
+  }
+
+  if ( USEFLAG == 0 ) {
+    printf("  %s WARNING: primary mag shift(s) set --> \n"
+	   "\t ignore KCOR_SHM and keep tables in private memory.\n",
+	   fnam );  fflush(stdout);
+  }
+
+  return (bool)USEFLAG ;
+
+} // end useFlag_kcor_shm
+
+
+// =============================
+float *malloc_kcor_shm(char *tableName, long long NVAL, bool *FILLFLAG) {
+
+  // Created Aug 2026
+  // Return pointer to table memory for NVAL floats.
+  // Default is private malloc with *FILLFLAG=true.
+  // With KCOR_SHM=1, first job on the node creates POSIX
+  // shared-memory segment /SNANA_KCOR_<kcorFile>_<tableName>
+  // and returns *FILLFLAG=true so that caller fills it from the
+  // FITS file (then calls publish_kcor_shm); other jobs attach
+  // the same segment read-only, wait for the fill, and return
+  // *FILLFLAG=false so that caller skips the FITS read.
+  //
+  // Beware that segments persist in /dev/shm after jobs finish;
+  // remove /dev/shm/SNANA_KCOR_* after re-making a kcor file
+  // with unchanged binning.
+
+  KCOR_SHM_HEADER_DEF *HEADER ;
+  long long MEMTOT = sizeof(KCOR_SHM_HEADER_DEF) + NVAL*sizeof(float);
+  int  fd, nsec=0 ;
+  struct stat statbuf ;
+  char shmName[MXPATHLEN], *base ;
+  char fnam[] = "malloc_kcor_shm" ;
+
+  // --------- BEGIN ----------
+
+  *FILLFLAG = true ;
+  if ( !useFlag_kcor_shm() )
+    { return (float*) malloc( NVAL*sizeof(float) ); }
+
+  // segment name from kcor-file base name + table name
+  base = strrchr(KCOR_INFO.FILENAME, '/');
+  if ( base != NULL ) { base++ ; }  else { base = KCOR_INFO.FILENAME; }
+  sprintf(shmName, "/SNANA_KCOR_%s_%s", base, tableName);
+
+  fd = shm_open(shmName, O_CREAT | O_EXCL | O_RDWR, 0666);
+
+  if ( fd >= 0 ) {
+    // first job: create segment and let caller fill it
+    if ( ftruncate(fd, MEMTOT) != 0 ) {
+      sprintf(c1err,"ftruncate(%lld bytes) failed for", MEMTOT);
+      sprintf(c2err,"shm segment %s", shmName);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+    HEADER = (KCOR_SHM_HEADER_DEF*)
+      mmap(NULL, MEMTOT, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if ( HEADER == MAP_FAILED ) {
+      sprintf(c1err,"mmap failed for shm segment");
+      sprintf(c2err,"%s", shmName);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+    HEADER->MAGIC = MAGIC_KCOR_SHM ;
+    HEADER->READY = 0 ;
+    HEADER->NVAL  = NVAL ;
+    printf("\t %s: create shared %s (%lld floats)\n",
+	   fnam, shmName, NVAL); fflush(stdout);
+    return (float*)(HEADER+1);
+  }
+
+  // segment exists: attach read-only and wait for creator to fill
+  fd = shm_open(shmName, O_RDONLY, 0);
+  if ( fd < 0 ) {
+    sprintf(c1err,"shm_open failed for existing segment");
+    sprintf(c2err,"%s", shmName);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  // wait for creator's ftruncate before mapping
+  while ( fstat(fd, &statbuf) == 0 &&
+	  (long long)statbuf.st_size < MEMTOT ) {
+    sleep(1);  nsec++ ;
+    if ( nsec > TIMEOUT_KCOR_SHM ) {
+      sprintf(c1err,"timeout waiting for size of shm segment");
+      sprintf(c2err,"%s : try 'rm /dev/shm/SNANA_KCOR_*'", shmName);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+
+  HEADER = (KCOR_SHM_HEADER_DEF*)
+    mmap(NULL, MEMTOT, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if ( HEADER == MAP_FAILED ) {
+    sprintf(c1err,"read-only mmap failed for shm segment");
+    sprintf(c2err,"%s", shmName);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  while ( HEADER->READY == 0 ) {
+    sleep(1);  nsec++ ;
+    if ( nsec > TIMEOUT_KCOR_SHM ) {
+      sprintf(c1err,"timeout waiting for fill of shm segment");
+      sprintf(c2err,"%s : try 'rm /dev/shm/SNANA_KCOR_*'", shmName);
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+    }
+  }
+
+  if ( HEADER->MAGIC != MAGIC_KCOR_SHM || HEADER->NVAL != NVAL ) {
+    sprintf(c1err,"stale shm segment (NVAL=%lld, expect %lld)",
+	    HEADER->NVAL, NVAL );
+    sprintf(c2err,"rm /dev/shm/SNANA_KCOR_* and retry (%s)", shmName);
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err);
+  }
+
+  printf("\t %s: attach shared %s (%lld floats)\n",
+	 fnam, shmName, NVAL); fflush(stdout);
+
+  *FILLFLAG = false ;
+  return (float*)(HEADER+1);
+
+} // end malloc_kcor_shm
+
+
+// =============================
+void publish_kcor_shm(float *data) {
+
+  // mark shared segment holding *data as filled so that
+  // attached jobs stop waiting. No-op for private malloc.
+
+  KCOR_SHM_HEADER_DEF *HEADER ;
+
+  if ( !useFlag_kcor_shm() ) { return ; }
+
+  HEADER = ((KCOR_SHM_HEADER_DEF*)data) - 1 ;
+  __sync_synchronize();   // fill completes before READY flag
+  HEADER->READY = 1 ;
+
+  return ;
+
+} // end publish_kcor_shm
+
+
 // =============================
 void read_kcor_head(void) {
 
@@ -532,21 +708,24 @@ void read_kcor_snsed(void) {
   int  NBL      = KCOR_INFO.BININFO_LAM.NBIN;
   int  NBT      = KCOR_INFO.BININFO_T.NBIN;
   long NROW     = NBL * NBT ;
-  int  MEMF     = NROW*sizeof(float);
   long FIRSTROW = 1, FIRSTELEM=1 ;
   int  ICOL=1, istat=0, hdutype, anynul ;
+  bool FILLFLAG ;
   char fnam[] = "read_kcor_snsed" ;
   // --------- BEGIN ----------
   printf("   %s \n", fnam); fflush(stdout);
 
-  KCOR_INFO.FLUX_SNSED_F = (float*) malloc(MEMF);
+  KCOR_INFO.FLUX_SNSED_F = malloc_kcor_shm("SNSED", NROW, &FILLFLAG);
 
   fits_movrel_hdu(FP, 1, &hdutype, &istat);
   snfitsio_errorCheck("Cannot move to SNSED table", istat);
 
-  fits_read_col_flt(FP, ICOL, FIRSTROW, FIRSTELEM, NROW,
-		    NULL_1E, KCOR_INFO.FLUX_SNSED_F, &anynul, &istat )  ;      
-  snfitsio_errorCheck("Read FLUX_SNSED", istat);
+  if ( FILLFLAG ) {
+    fits_read_col_flt(FP, ICOL, FIRSTROW, FIRSTELEM, NROW,
+		      NULL_1E, KCOR_INFO.FLUX_SNSED_F, &anynul, &istat );
+    snfitsio_errorCheck("Read FLUX_SNSED", istat);
+    publish_kcor_shm(KCOR_INFO.FLUX_SNSED_F);
+  }
 
   return ;
 
@@ -715,8 +894,10 @@ c            based on user input to &SNLCINP
   int ifilto, ifiltr, IBKCOR[NKDIM_KCOR], IBIN_FIRST, IBIN_LAST;;
   double KCOR_SHIFT;
 
-  int MEMF    = NBINTOT * sizeof(float);
-  KCOR_INFO.KCORTABLE1D_F = (float*) malloc(MEMF);
+  bool FILLFLAG ;
+  KCOR_INFO.KCORTABLE1D_F = malloc_kcor_shm("KCOR", NBINTOT, &FILLFLAG);
+  if ( !FILLFLAG ) { return; }  // attached shared tables; skip read
+
   for(k=0; k < NBINTOT; k++ ) { KCOR_INFO.KCORTABLE1D_F[k] = 9999.9; }
 
   // loop over kcor tables
@@ -771,6 +952,8 @@ c            based on user input to &SNLCINP
 
   } // end i-loop to NKCOR_STORE
 
+  publish_kcor_shm(KCOR_INFO.KCORTABLE1D_F);
+
   return ;
 
 } // end read_kcor_tables
@@ -1095,18 +1278,15 @@ void read_kcor_mags(void) {
   int  NFILTDEF_OBS    = KCOR_INFO.FILTERMAP_OBS.NFILTDEF ;
 
   int  NBINTOT_LCMAG   = NBIN_T * NBIN_z * NBIN_AV * NFILTDEF_REST;
-  int  MEMF_LCMAG      = NBINTOT_LCMAG * sizeof(float);
-  KCOR_INFO.LCMAG_TABLE1D_F = (float*)malloc(MEMF_LCMAG);
-
   int  NBINTOT_MWXT    = NBIN_T * NBIN_z * NBIN_AV * NFILTDEF_OBS;
-  int  MEMF_MWXT       = NBINTOT_MWXT * sizeof(float);
-  KCOR_INFO.MWXT_TABLE1D_F = (float*)malloc(MEMF_MWXT);
 
   int istat=0, hdutype, anynul, ifilt, ifiltr, ifilto, IFILTDEF ;
   int MASK, ISREST, ISOBS, ICOL_LCMAG, ICOL_MWXT;
   int IBLCMAG[N4DIM_KCOR], IBMWXT[N4DIM_KCOR];
   int IBIN_FIRST, IBIN_LAST, ibin, LBX;
   long long FIRSTROW=1, FIRSTELEM=1, NROW;
+  bool  FILLFLAG ;
+  float *MAGS_TABLE1D_F ;
   char *CFILT ;
   char fnam[] = "read_kcor_mags" ;
 
@@ -1118,6 +1298,15 @@ void read_kcor_mags(void) {
 
   if ( KCOR_INFO.NKCOR_STORE == 0 ) { return; }
 
+  // LCMAG and MWXT tables are filled in one filter loop below,
+  // so they share one memory block (and one shm segment)
+  MAGS_TABLE1D_F = malloc_kcor_shm("MAGS",
+				   NBINTOT_LCMAG + NBINTOT_MWXT,
+				   &FILLFLAG );
+  KCOR_INFO.LCMAG_TABLE1D_F = MAGS_TABLE1D_F ;
+  KCOR_INFO.MWXT_TABLE1D_F  = &MAGS_TABLE1D_F[NBINTOT_LCMAG] ;
+  if ( !FILLFLAG ) { return; }  // attached shared tables; skip read
+
   NROW = NBIN_T * NBIN_z * NBIN_AV;
   for(ibin=0; ibin < N4DIM_KCOR; ibin++ ) 
     { IBLCMAG[ibin] = IBMWXT[ibin] = 0 ;  }
@@ -1194,6 +1383,7 @@ void read_kcor_mags(void) {
 
   } // end ifilt loop
 
+  publish_kcor_shm(MAGS_TABLE1D_F);
 
   /*xxxxxx dump entire table to compare with original fortran
   for(ibin=0; ibin < NBINTOT_LCMAG; ibin++ ) {
@@ -36,6 +36,18 @@
 #define IDMAP_KCOR_LCMAG   17
 #define IDMAP_KCOR_MWXT    18
 
+// Aug 2026: optional POSIX shared-memory for bulk kcor tables so
+// that many sim jobs on the same node share one read-only copy.
+// Enabled with env var KCOR_SHM=1; first job fills each segment,
+// later jobs attach read-only and skip the FITS reads.
+#define MAGIC_KCOR_SHM    0x4B53484D   // 'KSHM'
+#define TIMEOUT_KCOR_SHM  300          // max seconds to wait for fill
+
+typedef struct {
+  int MAGIC, READY ;
+  long long NVAL ;   // number of stored floats
+} KCOR_SHM_HEADER_DEF ;
+
 int KCOR_VERBOSE_FLAG;
 int IFILTDEF_BESS_BX;
 
@@ -174,6 +186,10 @@ void read_kcor_mags(void);
 void read_kcor_filters(void);
 void read_kcor_primarysed(void);
 
+bool   useFlag_kcor_shm(void);
+float *malloc_kcor_shm(char *tableName, long long NVAL, bool *FILLFLAG);
+void   publish_kcor_shm(float *data);
+
 void read_kcor_binInfo(char *VARNAME, char *VARSYM, int MXBIN,
 		       KCOR_BININFO_DEF *BININFO) ;
 
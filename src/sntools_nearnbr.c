@@ -49,13 +49,22 @@
     + adjust computations in nearnbr_whichType() to account for SCALE_NON1A
     + adjust NEARNBR_GETRESULTS to account for SCALE_NON1A
 
+  Aug 2026: speed up training for large trainLibs:
+    + enable CELLMAP in training mode (cells sized by largest SEPMAX
+      trial bin) so that per-event subset scan is no longer O(NTRAIN)
+    + build cell map by visiting only cells within SEPMAX reach of
+      each training event instead of scanning every cell
+    + scan SEPMAX trial bins in parallel threads (see NEARNBR_SEPSCAN);
+      override thread count with env NEARNBR_NTHREAD.
+
 **********************************************/
 
-#include <stdio.h> 
+#include <stdio.h>
 #include <string.h>
-#include <stdlib.h>   
+#include <stdlib.h>
 #include <unistd.h>
-#include <math.h>  
+#include <math.h>
+#include <pthread.h>
 
 #include "sntools.h" 
 
@@ -92,6 +101,8 @@ void NEARNBR_INIT(void) {
   NEARNBR_CELLMAP.DOFLAG=0;
   NEARNBR_CELLMAP.NCHOP_PER_VAR = 0;
 
+  NEARNBR_SEPSCAN.NTHREAD = 1 ;  // Aug 2026: serial until init_SEPSCAN
+
   nearnbr_reset();
 
 
@@ -206,10 +217,13 @@ void NEARNBR_CELLMAP_INIT(int NCHOP_PER_VAR ) {
   NEARNBR_CELLMAP.NVAR = NVAR ;
 
   // - - - - - - - - - - - -
-  int itrain, ivar, ICELL_1D, icell, NLIST, NCELL_TOT=1 ;
+  int itrain, ivar, isep, ICELL_1D, icell, NLIST, NCELL_TOT=1 ;
   float VAL, VAL_MIN, VAL_MAX, VAL_BIN, RSQ, DIF, SQSEPMAX ;
   float VAL_ARRAY[MXVAR_NEARNBR], SEPMAX[MXVAR_NEARNBR];
+  float SQSEPMAX_USE[MXVAR_NEARNBR];
   float VAL_CENTMP[MXVAR_NEARNBR], VAL_CENREF[MXVAR_NEARNBR];
+  int  ICMIN[MXVAR_NEARNBR], ICMAX[MXVAR_NEARNBR] ;
+  int  ICELL_ARRAY[MXVAR_NEARNBR] ;
   char *VARNAME ;
 
   for ( ivar=0; ivar < NEARNBR_INPUTS.NVAR ; ivar++ ) {
@@ -254,7 +268,15 @@ void NEARNBR_CELLMAP_INIT(int NCHOP_PER_VAR ) {
     VAL_MAX = NEARNBR_CELLMAP.VAL_MAX[ivar] ;
     VAL_BIN = (VAL_MAX-VAL_MIN)/ (float)NCHOP_LOCAL ;
     NEARNBR_CELLMAP.VAL_BIN[ivar] = VAL_BIN ;
-    SEPMAX[ivar] = sqrtf(NEARNBR_LIST_SQSEPMAX[ivar][0]);
+
+    // Aug 2026: use largest SEPMAX over all trial bins so that the
+    // map is also valid for training mode (apply mode has 1 bin).
+    SQSEPMAX_USE[ivar] = NEARNBR_LIST_SQSEPMAX[ivar][0] ;
+    for(isep=1; isep < NBINTOT_SEPMAX_NEARNBR; isep++ ) {
+      if ( NEARNBR_LIST_SQSEPMAX[ivar][isep] > SQSEPMAX_USE[ivar] )
+	{ SQSEPMAX_USE[ivar] = NEARNBR_LIST_SQSEPMAX[ivar][isep] ; }
+    }
+    SEPMAX[ivar] = sqrtf(SQSEPMAX_USE[ivar]);
 
     printf("   %4s : %8.4f to %8.4f  (cell size=%5.3f, SEPMAX=%.3f) \n",
 	   VARNAME, VAL_MIN, VAL_MAX, VAL_BIN, SEPMAX[ivar]);
@@ -271,41 +293,64 @@ void NEARNBR_CELLMAP_INIT(int NCHOP_PER_VAR ) {
 
 
   // loop over training and assign each cell
-  for(itrain=0; itrain < NTRAIN_TOT ; itrain++ ) { 
+  for(itrain=0; itrain < NTRAIN_TOT ; itrain++ ) {
 
-    for ( ivar=0; ivar < NVAR ; ivar++ ) 
+    for ( ivar=0; ivar < NVAR ; ivar++ )
       { VAL_ARRAY[ivar] = NEARNBR_TRAINLIB.FITRES_VALUES[ivar][itrain] ;  }
 
     getInfo_CELLMAP(+1, VAL_ARRAY,  &ICELL_1D );   // return ICELL_1D
     getInfo_CELLMAP(-1, VAL_CENREF, &ICELL_1D );   // return VAL_CENREF
 
-    // check distance to all other cells
-    for(icell=0; icell < NCELL_TOT; icell++ ) {
+    // Aug 2026: visit only cells within SEPMAX reach of this event
+    // instead of scanning every cell; cuts map-build time from
+    // O(NTRAIN x NCELL) to O(NTRAIN x Nneighbor).
+    for ( ivar=0; ivar < NVAR ; ivar++ ) {
+      VAL     = VAL_ARRAY[ivar] ;
+      VAL_MIN = NEARNBR_CELLMAP.VAL_MIN[ivar] ;
+      VAL_BIN = NEARNBR_CELLMAP.VAL_BIN[ivar] ;
+      ICMIN[ivar] = (int)( (VAL - SEPMAX[ivar] - VAL_MIN)/VAL_BIN ) - 1 ;
+      ICMAX[ivar] = (int)( (VAL + SEPMAX[ivar] - VAL_MIN)/VAL_BIN ) + 1 ;
+      if ( ICMIN[ivar] < 0 )             { ICMIN[ivar] = 0 ; }
+      if ( ICMAX[ivar] > NCHOP_LOCAL-1 ) { ICMAX[ivar] = NCHOP_LOCAL-1 ; }
+      ICELL_ARRAY[ivar] = ICMIN[ivar] ;
+    }
+
+    // check distance to each nearby cell
+    while ( 1 ) {
+
+      icell = get_1DINDEX(ID1D_CELLMAP_NEARNBR, NVAR, ICELL_ARRAY);
 
       // pass icell and return binCenter VAL_CENTMP
-      getInfo_CELLMAP(-1, VAL_CENTMP, &icell ); 
+      getInfo_CELLMAP(-1, VAL_CENTMP, &icell );
 
       RSQ = 0.0 ;
       for ( ivar=0; ivar < NVAR ; ivar++ ) {
 	if ( icell == ICELL_1D ) { continue ; }
 	VAL_BIN  = NEARNBR_CELLMAP.VAL_BIN[ivar] ;
 	DIF      = fabsf( VAL_CENREF[ivar] - VAL_CENTMP[ivar] ) ;
-	if ( DIF >= 0.99*VAL_BIN ) 
+	if ( DIF >= 0.99*VAL_BIN )
 	  { DIF -= VAL_BIN ; } // compare distance between closest edges
-	if ( fabsf(DIF) > SEPMAX[ivar] ) 
+	if ( fabsf(DIF) > SEPMAX[ivar] )
 	  { ivar=NVAR; RSQ=999.; continue; }
-	SQSEPMAX = NEARNBR_LIST_SQSEPMAX[ivar][0] ;
+	SQSEPMAX = SQSEPMAX_USE[ivar] ;
 	RSQ     += ( (DIF*DIF)/SQSEPMAX ) ;
       }
 
       if ( RSQ < 1.0 ) {
-	realloc_NEARNBR_CELLMAP(icell); 
-	NLIST = NEARNBR_CELLMAP.NLIST[icell] ;	
+	realloc_NEARNBR_CELLMAP(icell);
+	NLIST = NEARNBR_CELLMAP.NLIST[icell] ;
 	NEARNBR_CELLMAP.ITRAIN_LIST[icell][NLIST] = itrain ;
 	NEARNBR_CELLMAP.NLIST[icell]++ ;
       }
 
-    }  // end icell loop
+      // increment multi-dim cell indices (odometer)
+      ivar = NVAR-1 ;
+      while ( ivar >= 0 && ICELL_ARRAY[ivar] == ICMAX[ivar] )
+	{ ICELL_ARRAY[ivar] = ICMIN[ivar] ;  ivar-- ; }
+      if ( ivar < 0 ) { break ; }
+      ICELL_ARRAY[ivar]++ ;
+
+    }  // end while over nearby cells
 
   } // itrain
 
@@ -464,8 +509,24 @@ void NEARNBR_INIT2(int ISPLIT) {
   // init SUBSET to be entire training lib
   nearnbr_init_SUBSET() ;
 
-  // init speedup for APPLY mode
-  if ( NN_APPLYFLAG ) { NEARNBR_CELLMAP_INIT(0) ; }
+  // Aug 2026: pick default cell-chopping for training mode;
+  // the per-event brute-force subset scan was the training
+  // bottleneck for large trainLibs.
+  if ( NN_TRAINFLAG && NEARNBR_CELLMAP.DOFLAG == 0 ) {
+    int    NCHOP = 16 ;
+    double XCELL = pow( (double)NCHOP, (double)NEARNBR_INPUTS.NVAR );
+    while ( NCHOP > 2 && XCELL > 50000.0 ) {
+      NCHOP-- ;
+      XCELL = pow( (double)NCHOP, (double)NEARNBR_INPUTS.NVAR );
+    }
+    NEARNBR_CELLMAP_INIT(NCHOP);  // sets DOFLAG & NCHOP_PER_VAR
+  }
+
+  // init cell-lookup speedup (Aug 2026: training mode too)
+  if ( NN_APPLYFLAG || NN_TRAINFLAG ) { NEARNBR_CELLMAP_INIT(0) ; }
+
+  // init parallel scan over SEPMAX bins (Aug 2026)
+  if ( NN_TRAINFLAG ) { nearnbr_init_SEPSCAN(); }
 
   // create histograms for training mode (i.e., multiple SEPMAX bins),
   if( NN_TRAINFLAG ) { nearnbr_makeHist(ISPLIT); }
@@ -926,6 +987,42 @@ void  nearnbr_init_SEPMAX(void) {
 } // end of nearnbr_init_SEPMAX
 
 
+// =============================================
+void nearnbr_init_SEPSCAN(void) {
+
+  // Created Aug 2026
+  // Init thread count and per-bin storage for parallel scan over
+  // SEPMAX trial bins (training mode only). Default NTHREAD is the
+  // number of cores (capped at MXTHREAD_NEARNBR); override with
+  // env NEARNBR_NTHREAD (set to 1 for serial scan).
+
+  int  NBINTOT = NBINTOT_SEPMAX_NEARNBR ;
+  int  MEMI    = NBINTOT * sizeof(int) ;
+  int  NTHREAD ;
+  char *ptrEnv ;
+  char fnam[] = "nearnbr_init_SEPSCAN" ;
+
+  // ----------- BEGIN -----------
+
+  NTHREAD = (int)sysconf(_SC_NPROCESSORS_ONLN) ;
+  if ( NTHREAD > MXTHREAD_NEARNBR ) { NTHREAD = MXTHREAD_NEARNBR ; }
+
+  ptrEnv = getenv("NEARNBR_NTHREAD");
+  if ( ptrEnv != NULL ) { NTHREAD = atoi(ptrEnv); }
+
+  if ( NTHREAD > NBINTOT ) { NTHREAD = NBINTOT ; }
+  if ( NTHREAD < 1       ) { NTHREAD = 1 ; }
+
+  NEARNBR_SEPSCAN.NTHREAD      = NTHREAD ;
+  NEARNBR_SEPSCAN.ISPARSE_TYPE = (int*)malloc(MEMI);
+  NEARNBR_SEPSCAN.TYPE_CUTPROB = (int*)malloc(MEMI);
+
+  printf("\t %s: scan %d SEPMAX bins with %d thread(s). \n",
+	 fnam, NBINTOT, NTHREAD );
+  fflush(stdout);
+
+} // end of nearnbr_init_SEPSCAN
+
 
 // ===================================
 void NEARNBR_LOADVAL(char *ccid, char *varName, double d_val ) {
@@ -1381,8 +1478,40 @@ void NEARNBR_APPLY(char *CCID) {
 
   NTRAIN_SUBSET = NEARNBR_TRAINLIB.NSUBSET ;
 
+  // Aug 2026: for training, scan SEPMAX trial bins in parallel
+  // threads; each bin is independent. Histograms are filled
+  // serially afterward since HBOOK/ROOT fills are not thread safe.
+  int NTHREAD = NEARNBR_SEPSCAN.NTHREAD ;
+  if ( NN_TRAINFLAG && NTHREAD > 1 ) {
+    pthread_t  tid_list[MXTHREAD_NEARNBR] ;
+    NEARNBR_SCANTHREAD_DEF ARG_LIST[MXTHREAD_NEARNBR] ;
+    int it, istat ;
+
+    for(it=0; it < NTHREAD; it++ ) {
+      ARG_LIST[it].TID     = it ;
+      ARG_LIST[it].NTHREAD = NTHREAD ;
+      istat = pthread_create(&tid_list[it], NULL,
+			     nearnbr_scan_SEPMAX, &ARG_LIST[it] );
+      if ( istat != 0 ) {
+	sprintf(c1err,"pthread_create returned istat=%d", istat);
+	sprintf(c2err,"for SEPMAX-scan thread %d of %d", it, NTHREAD);
+	errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+      }
+    }
+    for(it=0; it < NTHREAD; it++ )
+      { pthread_join(tid_list[it], NULL); }
+
+    for(isep=0; isep < NBINTOT_SEPMAX_NEARNBR ; isep++ )
+      { nearnbr_fillHist(isep, NEARNBR_SEPSCAN.ISPARSE_TYPE[isep]) ; }
+
+    nearnbr_reset();
+    printf(" Done.\n"); fflush(stdout);
+    return ;
+
+  } // end parallel SEPMAX scan
+
   // -----------------------------------
-  // Two nested loops: 1) SEPMAX, 2) trainlib entries 
+  // Two nested loops: 1) SEPMAX, 2) trainlib entries
   // Count NTYPE for each SQSEP combo
 
   for(isep=0; isep < NBINTOT_SEPMAX_NEARNBR ; isep++ ) {
@@ -1475,6 +1604,62 @@ float  nearnbr_SQDIST(int isep,int itrain) {
 
 } // end of nearnbr_SQDIST
 
+// =====================================================
+void *nearnbr_scan_SEPMAX(void *arg) {
+
+  // Created Aug 2026
+  // Thread task for parallel SEPMAX scan: process every NTHREAD'th
+  // SEPMAX bin, count train-subset neighbors per true type, and
+  // store the evaluated type per bin in NEARNBR_SEPSCAN.
+  // Histogram filling is left to the calling function.
+
+  NEARNBR_SCANTHREAD_DEF *THREAD = (NEARNBR_SCANTHREAD_DEF*)arg ;
+  int   NTYPE         = NEARNBR_TRAINLIB.NTRUETYPE ;
+  int   NTRAIN_SUBSET = NEARNBR_TRAINLIB.NSUBSET ;
+  int   isep, isubset, itrain, i, TRUETYPE, TYPE_CUTPROB, isparse_TYPE ;
+  int   NCUTDIST[MXTRUETYPE] ;
+  float SQDIST ;
+  char  fnam[] = "nearnbr_scan_SEPMAX" ;
+
+  // ----------- BEGIN -----------
+
+  for(isep = THREAD->TID; isep < NBINTOT_SEPMAX_NEARNBR ;
+      isep += THREAD->NTHREAD ) {
+
+    for(i=0; i < NTYPE; i++ )  { NCUTDIST[i] = 0 ; }
+
+    for(isubset=0; isubset < NTRAIN_SUBSET; isubset++ ) {
+      itrain    = NEARNBR_TRAINLIB.ITRAIN[isubset] ;
+      TRUETYPE  = NEARNBR_TRAINLIB.TRUETYPE[itrain] ;
+      if ( TRUETYPE < 0 ) { continue ; }
+      SQDIST    = nearnbr_SQDIST(isep,itrain) ;
+
+      if ( SQDIST < 1.0 ) {
+	i = NEARNBR_TRAINLIB.TRUETYPE_MAP[TRUETYPE]; // sparse index
+	if( i<0 || i >= NTYPE ) {
+	  sprintf(c1err,"Invalid sparse index i=%d for TRUETYPE=%d",
+		  i, TRUETYPE);
+	  sprintf(c2err, "isep=%d  itrain=%d  SQDIST=%f",
+		  isep, itrain, SQDIST);
+	  errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+	}
+	NCUTDIST[i]++ ;
+      } // SQDIST<1
+
+    } // itrain
+
+    // analyze to get Type; store result per isep for
+    // serial histogram filling by calling function.
+    isparse_TYPE = nearnbr_whichType(NTYPE, NCUTDIST, &TYPE_CUTPROB);
+    NEARNBR_SEPSCAN.ISPARSE_TYPE[isep] = isparse_TYPE ;
+    NEARNBR_SEPSCAN.TYPE_CUTPROB[isep] = TYPE_CUTPROB ;
+
+  }  // isep
+
+  return NULL ;
+
+} // end of nearnbr_scan_SEPMAX
+
 // ============================================
 void nearnbr_preAnal_verify(void) {
 
@@ -1603,16 +1788,36 @@ void nearnbr_fill_SUBSET_TRAIN(char *CCID) {
 
   int NVAR       = NEARNBR_INPUTS.NVAR ;
   int isep, NSUBSET, itrain, ivar, TRUETYPE, NTRAIN ;
+  int NCAND, icand, ICELL_1D, *ITRAIN_LIST = NULL ;
   double SQDIST, f_subset, VAL_DATA, VAL_TRAIN, SEP, SQSEP ;
   //  char   fnam[] = "nearnbr_fill_SUBSET_TRAIN" ;
 
   // ------------ BEGIN -----------
 
   isep    = NBINTOT_SEPMAX_NEARNBR - 1 ;
-  NTRAIN  = NEARNBR_TRAINLIB.NTOT; 
+  NTRAIN  = NEARNBR_TRAINLIB.NTOT;
   NSUBSET = 0 ;
 
-  for ( itrain=0; itrain < NTRAIN; itrain++ ) {
+  // Aug 2026: use pre-built cell map when available so that only
+  // candidates within the largest SEPMAX reach of this cell are
+  // checked (cells are sized using largest SEPMAX trial bin;
+  // see NEARNBR_CELLMAP_INIT).
+  if ( NEARNBR_CELLMAP.DOFLAG ) {
+    getInfo_CELLMAP(1, NEARNBR_STORE.VALUE_LOAD  ,  // (I)
+		    &ICELL_1D )  ;                  // (O)
+    NCAND       = NEARNBR_CELLMAP.NLIST[ICELL_1D] ;
+    ITRAIN_LIST = NEARNBR_CELLMAP.ITRAIN_LIST[ICELL_1D] ;
+  }
+  else
+    { NCAND = NTRAIN ; }
+
+
+  for ( icand=0; icand < NCAND; icand++ ) {
+
+    if ( ITRAIN_LIST != NULL )
+      { itrain = ITRAIN_LIST[icand] ; }
+    else
+      { itrain = icand ; }
 
     TRUETYPE  = NEARNBR_TRAINLIB.TRUETYPE[itrain] ;
     if ( TRUETYPE < 0 ) { continue ; }
@@ -1625,12 +1830,12 @@ void nearnbr_fill_SUBSET_TRAIN(char *CCID) {
       NEARNBR_STORE.SQSEP[ivar][itrain] = SQSEP ;
     } // end ivar
 
-    SQDIST    = nearnbr_SQDIST(isep,itrain);      
-    if ( SQDIST < 1.0 ) { 
+    SQDIST    = nearnbr_SQDIST(isep,itrain);
+    if ( SQDIST < 1.0 ) {
       NEARNBR_TRAINLIB.ITRAIN[NSUBSET] = itrain;
       NSUBSET++ ;
     }
-  }  // end of itrain loop
+  }  // end of icand loop
 
 
   NEARNBR_TRAINLIB.NSUBSET = NSUBSET ;
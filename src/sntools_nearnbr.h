@@ -58,6 +58,9 @@ void NEARNBR_GETRESULTS(char *CCID, int *ITYPE, int *NTYPE, int *ITYPE_LIST,
 void nearnbr_getresults__(char *CCID, int *ITYPE, int *NTYPE, int *ITYPE_LIST,
 			  int *NCELL_TRAIN_LIST ) ;
 
+void  nearnbr_init_SEPSCAN(void);        // Aug 2026
+void *nearnbr_scan_SEPMAX(void *arg);    // Aug 2026
+
 void  nearnbr_check_inputs(void) ;
 void  nearnbr_read_trainLib(int ifile);
 int   nearnbr_storeODD_trainLIB(int NROWTOT_NEW);
@@ -98,6 +101,22 @@ struct {
 
 } NEARNBR_CELLMAP ;
 
+
+// Aug 2026: parallel scan over SEPMAX trial bins during training.
+// Threads only count neighbors per bin; histograms are filled
+// serially afterward (HBOOK/ROOT fills are not thread safe).
+#define MXTHREAD_NEARNBR 16
+
+typedef struct {
+  int TID, NTHREAD ;    // thread id and total thread count
+} NEARNBR_SCANTHREAD_DEF ;
+
+struct {
+  int  NTHREAD ;       // 1 => serial scan (always 1 for apply mode)
+  int *ISPARSE_TYPE ;  // evaluated sparse type vs. isep
+  int *TYPE_CUTPROB ;  // type passing PROB cut vs. isep
+} NEARNBR_SEPSCAN ;
+
 struct NEARNBR_INPUTS {
 
   char   TRAINFILE_PATH[200];
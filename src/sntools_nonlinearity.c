@@ -139,10 +139,116 @@ void INIT_NONLIN(char *inFile) {
   NONLIN_README.LINE[NLINE][0] = 0 ; NLINE++ ;
   NONLIN_README.NLINE = NLINE ;
 
+  // Aug 2026: compile maps into direct-indexed lookups
+  prep_LUT_NONLIN();
+
   return ;
 
 } // end INIT_NONLIN
 
+
+// =====================================
+void prep_LUT_NONLIN(void) {
+
+  // Created Aug 2026
+  // Compile the maps read by INIT_NONLIN for fast per-observation use:
+  //  + IFILTMAP_NONLIN[ifilt] = map index for each filter (-9 if none),
+  //    replacing the per-call strstr search over map FILTERS strings;
+  //    if a band appears in several maps, the last map wins as before.
+  //  + per-map guide table IBIN_LUT over equal-spaced log10(Fpe),
+  //    so eval_LUT_NONLIN finds its interpolation rows with index
+  //    arithmetic instead of a binary search.
+
+  int imap, ifilt, irow, j, N ;
+  double LOGF_MIN, LOGF_MAX, logf, Fpe ;
+  char cfilt[2];
+  char *ptrFilters ;
+  //  char fnam[] = "prep_LUT_NONLIN" ;
+
+  // ------------ BEGIN --------------
+
+  for(ifilt=0; ifilt < MXFILTINDX; ifilt++ )
+    { IFILTMAP_NONLIN[ifilt] = -9 ; }
+
+  for(imap=0; imap < NMAP_NONLIN; imap++ ) {
+
+    ptrFilters = NONLIN_MAP[imap].FILTERS ;
+    for(j=0; j < strlen(ptrFilters); j++ ) {
+      sprintf(cfilt, "%c", ptrFilters[j] );
+      ifilt = INTFILTER(cfilt);
+      if ( ifilt > 0 && ifilt < MXFILTINDX )
+	{ IFILTMAP_NONLIN[ifilt] = imap ; }
+    }
+
+    // guide table over log10(Fpe)
+    N        = NONLIN_MAP[imap].MAPSIZE ;
+    LOGF_MIN = log10( NONLIN_MAP[imap].MAPVAL[0][0]   );
+    LOGF_MAX = log10( NONLIN_MAP[imap].MAPVAL[0][N-1] );
+
+    NONLIN_MAP[imap].LOGF_MIN    = LOGF_MIN ;
+    NONLIN_MAP[imap].LOGF_BININV = 0.0 ;
+    if ( LOGF_MAX > LOGF_MIN ) {
+      NONLIN_MAP[imap].LOGF_BININV =
+	(double)NBIN_LUT_NONLIN / (LOGF_MAX - LOGF_MIN) ;
+    }
+
+    irow = 0;
+    for(j=0; j <= NBIN_LUT_NONLIN; j++ ) {
+      if ( NONLIN_MAP[imap].LOGF_BININV > 0.0 ) {
+	logf = LOGF_MIN + (double)j/NONLIN_MAP[imap].LOGF_BININV ;
+	Fpe  = pow(10.0, logf);
+	while ( irow < N-2 &&
+		NONLIN_MAP[imap].MAPVAL[0][irow+1] < Fpe ) { irow++ ; }
+      }
+      NONLIN_MAP[imap].IBIN_LUT[j] = irow ;
+    }
+  }
+
+  return ;
+
+} // end prep_LUT_NONLIN
+
+
+// =====================================
+double eval_LUT_NONLIN(int imap, double Fpe_tot) {
+
+  // Created Aug 2026
+  // Return F_scale for map imap at total flux Fpe_tot, locating the
+  // interpolation rows with the guide table from prep_LUT_NONLIN;
+  // linear interpolation between map rows matches the previous
+  // interp_1DFUN arithmetic.  Abort if Fpe_tot is outside the map,
+  // as the old interp_1DFUN call did.
+
+  double *ptrF = NONLIN_MAP[imap].MAPVAL[0] ; // Ftot(pe)
+  double *ptrS = NONLIN_MAP[imap].MAPVAL[1] ; // F_scale
+  int     N    = NONLIN_MAP[imap].MAPSIZE ;
+  int     j, irow ;
+  double  frac ;
+  char fnam[] = "eval_LUT_NONLIN" ;
+
+  // ------------ BEGIN --------------
+
+  if ( N == 1 ) { return ptrS[0]; }
+
+  if ( Fpe_tot < ptrF[0] || Fpe_tot > ptrF[N-1] ) {
+    sprintf(c1err,"Fpe_tot = %le outside NONLIN map%2.2d", Fpe_tot, imap);
+    sprintf(c2err,"defined for %le < Fpe < %le", ptrF[0], ptrF[N-1] );
+    errmsg(SEV_FATAL, 0, fnam, c1err, c2err );
+  }
+
+  j = (int)( ( log10(Fpe_tot) - NONLIN_MAP[imap].LOGF_MIN )
+	     * NONLIN_MAP[imap].LOGF_BININV ) ;
+  if ( j < 0               ) { j = 0 ; }
+  if ( j > NBIN_LUT_NONLIN ) { j = NBIN_LUT_NONLIN ; }
+
+  irow = NONLIN_MAP[imap].IBIN_LUT[j] ;
+  while ( irow < N-2 && ptrF[irow+1] < Fpe_tot ) { irow++ ; }
+
+  frac = ( Fpe_tot - ptrF[irow] ) / ( ptrF[irow+1] - ptrF[irow] ) ;
+  return  ptrS[irow] + frac * ( ptrS[irow+1] - ptrS[irow] ) ;
+
+} // end eval_LUT_NONLIN
+
 void   init_nonlin__(char *inFile) { INIT_NONLIN(inFile); }
 
 
@@ -162,11 +268,9 @@ double GET_NONLIN(char *cfilt, double Fpe_source, double Fpe_sky,
   //         function returns 1.0000
   //
 
-  int    OPT_INTERP = 1;  // 1=linear interp
-  int    imap ;
+  int    imap, ifilt ;
   double F_scale,  Fpe_tot;
-  char  *ptrFilters, msg[100] ;
-  char   fnam[] = "GET_NONLIN" ;
+  //  char   fnam[] = "GET_NONLIN" ;
 
   // --------------- BEGIN ----------------
 
@@ -185,22 +289,12 @@ double GET_NONLIN(char *cfilt, double Fpe_source, double Fpe_sky,
 
   Fpe_tot = Fpe_source + Fpe_sky ;
 
-  // find which map contains *cfilt.
-  for(imap=0; imap < NMAP_NONLIN; imap++ ) {
-    ptrFilters = NONLIN_MAP[imap].FILTERS ;
-
-    if ( strstr(ptrFilters,cfilt) != NULL )  {
-      sprintf(msg,"%s: band=%s imap=%d Fpe_tot=%le", 
-	      fnam, cfilt, imap, Fpe_tot);
-
-
-      F_scale = interp_1DFUN(OPT_INTERP, Fpe_tot,
-			     NONLIN_MAP[imap].MAPSIZE,
-			     NONLIN_MAP[imap].MAPVAL[0], // Ftot(pe)
-			     NONLIN_MAP[imap].MAPVAL[1], // F_scale
-			     msg ) ;      
-    }
-  }  // end imap loop
+  // Aug 2026: find map for *cfilt with precomputed per-filter index,
+  // then evaluate with the guide-table lookup (see prep_LUT_NONLIN).
+  ifilt = INTFILTER(cfilt);
+  imap  = IFILTMAP_NONLIN[ifilt] ;
+  if ( imap >= 0 )
+    { F_scale = eval_LUT_NONLIN(imap, Fpe_tot); }
 
 
   int LDMP = DUMPFLAG_NONLIN ;
@@ -218,10 +312,55 @@ double GET_NONLIN(char *cfilt, double Fpe_source, double Fpe_sky,
 
 double get_nonlin__(char *cfilt, double *Fpe_source, double *Fpe_sky,
 		    double *genmag) {
-  
+
   double F_scale = GET_NONLIN(cfilt, *Fpe_source, *Fpe_sky, *genmag);
   return(F_scale);
 }
 
 
+// ====================================
+void GET_NONLIN_LIST(char *cfilt, int NOBS, double *Fpe_source_list,
+		     double *Fpe_sky_list, double *genmag_list,
+		     double *Fscale_list ) {
+
+  // Created Aug 2026
+  // Batch version of GET_NONLIN: fill Fscale_list[0:NOBS-1] for all
+  // observations of an event in band *cfilt; the map lookup is done
+  // once per call instead of once per observation.
+
+  int    imap, ifilt, obs ;
+  double Fpe_sky, Fpe_tot, F_scale ;
+  //  char fnam[] = "GET_NONLIN_LIST" ;
+
+  // --------------- BEGIN ----------------
+
+  for(obs=0; obs < NOBS; obs++ )  { Fscale_list[obs] = 1.000 ; }
+
+  if ( NMAP_NONLIN == 0 ) { return ; }
+
+  ifilt = INTFILTER(cfilt);
+  imap  = IFILTMAP_NONLIN[ifilt] ;
+  if ( imap < 0 ) { return ; }
+
+  for(obs=0; obs < NOBS; obs++ ) {
+    Fpe_sky = Fpe_sky_list[obs] ;
+    if ( Fpe_sky < 0.0 ) { continue ; }
+    Fpe_tot = Fpe_source_list[obs] + Fpe_sky ;
+    F_scale = eval_LUT_NONLIN(imap, Fpe_tot);
+    Fscale_list[obs] = F_scale ;
+
+    if ( DUMPFLAG_NONLIN ) {
+      printf(" xxx %s-mag=%6.3f  Fpe(sky,src)=%10.5le,%10.5le "
+	     "--> F_scale=%6.4f \n",
+	     cfilt, genmag_list[obs], Fpe_sky,
+	     Fpe_source_list[obs], F_scale);
+      fflush(stdout);
+    }
+  }
+
+  return ;
+
+} // end GET_NONLIN_LIST
+
+
 
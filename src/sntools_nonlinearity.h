@@ -1,9 +1,11 @@
 
 
 // -------------------------------
-#define MXBIN_NONLIN 100 
+#define MXBIN_NONLIN 100
 #define MXFILTINDX 100     //  max filter index
 
+#define NBIN_LUT_NONLIN 256  // Aug 2026: log10(Fpe) guide-table bins per map
+
 char MODEL_NONLIN[100];
 int  NMAP_NONLIN ;
 int  DUMPFLAG_NONLIN ;
@@ -12,11 +14,19 @@ typedef struct {
   char   FILTERS[MXFILTINDX];
   int    MAPSIZE ;
   double MAPVAL[2][MXBIN_NONLIN];  // definition depends on MODEL
+
+  // Aug 2026: equal-spaced log10(Fpe) guide table; IBIN_LUT[j] is the
+  // map row bracketing log-flux bin j, so GET_NONLIN locates its
+  // interpolation rows with index arithmetic instead of a search.
+  double LOGF_MIN, LOGF_BININV ;
+  int    IBIN_LUT[NBIN_LUT_NONLIN+1] ;
 } NONLIN_DEF ;
 
 
 NONLIN_DEF  *NONLIN_MAP ;
 
+int IFILTMAP_NONLIN[MXFILTINDX]; // Aug 2026: filter index -> map; -9 if none
+
 struct {
   int   NLINE;
   char  LINE[10][MXPATHLEN];
@@ -30,5 +40,12 @@ void   init_nonlin__(char *inFile);
 double GET_NONLIN(char *cfilt, double Fpe_source, double Fpe_sky, 
 		  double genmag) ;
 
-double get_nonlin__(char *cfilt, double *Fpe_source, double *Fpe_sky, 
+double get_nonlin__(char *cfilt, double *Fpe_source, double *Fpe_sky,
 		     double *genmag);
+
+// Aug 2026:
+void   prep_LUT_NONLIN(void);
+double eval_LUT_NONLIN(int imap, double Fpe_tot);
+void   GET_NONLIN_LIST(char *cfilt, int NOBS, double *Fpe_source_list,
+		       double *Fpe_sky_list, double *genmag_list,
+		       double *Fscale_list );
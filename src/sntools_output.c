@@ -137,6 +137,12 @@ void TABLEFILE_INIT(void) {
   NOPEN_TABLEFILE = 0 ;
   NFILE_AUTOSTORE = 0 ;
 
+  // Aug 2026: no dump row-filters until user loads them
+  DUMPFILTER.USEFLAG = false ;
+  DUMPFILTER.NCID  = 0 ;
+  DUMPFILTER.NCUT  = 0 ;
+  DUMPFILTER.NROW_READ = DUMPFILTER.NROW_PASS = 0 ;
+
   // -------------------------------
 
   // ------ misc inits -------
@@ -600,7 +606,8 @@ void SNTABLE_CREATE(int IDTABLE, char *NAME, char *TEXT_FORMAT) {
   // Create/Initialize new table.
   // *IDTABLE and *NAME are integer and character udentifiers.
   // HBOOK must have an integer id, while ROOT uses a char ID.
-  // TEXT_FORMAT used only for TEXT: 'key', 'csv', 'col'
+  // TEXT_FORMAT used only for TEXT: 'key', 'csv', 'col',
+  // or 'bin' = key-format text plus binary columnar sidecar (Aug 2026)
   
   int  ID, USE ; 
   char fnam[] = "SNTABLE_CREATE" ;
@@ -1122,6 +1129,13 @@ int SNTABLE_READPREP(int IFILETYPE, char *TABLENAME) {
   READTABLE_POINTERS.IFILETYPE = IFILETYPE ;
   sprintf(READTABLE_POINTERS.TABLENAME, "%s", TBNAME_LOCAL );
 
+  // Aug 2026: build varName hash for O(1) lookups in
+  // SNTABLE_READPREP_VARDEF (matters for ~400-column FITRES files)
+  for(ivar=0; ivar < NVAR; ivar++ )
+    { PTRLIST_VARNAME_READTABLE[ivar] = READTABLE_POINTERS.VARNAME[ivar]; }
+  build_HASH_STRING(&HASH_VARNAME_READTABLE, NVAR,
+		    PTRLIST_VARNAME_READTABLE);
+
   // ---------------------------------------------  
   printf("   Read %d table varNames from %s table=%s \n",
 	 NVAR, STRING_TABLEFILE_TYPE[IFILETYPE], TABLENAME );
@@ -1305,11 +1319,11 @@ int sntable_readprep_vardef1(char *varName_withCast, void *ptr,
   ivar = -777 ;
 
   // search VARNAMES list
-  for ( ivar=0; ivar < NVAR_TOT; ivar++ ) {
+  // (Aug 2026: hashed lookup; hash built in SNTABLE_READPREP)
+  ivar = index_HASH_STRING(&HASH_VARNAME_READTABLE, varName);
+
+  if ( ivar >= 0 ) {
 
-    if ( strcmp(varName,READTABLE_POINTERS.VARNAME[ivar]) != 0 ) 
-      { continue ; }
-    
     i = READTABLE_POINTERS.NVAR_READ ;
     READTABLE_POINTERS.PTRINDEX[i] = ivar ;
     READTABLE_POINTERS.NVAR_READ++ ;    
@@ -1353,8 +1367,8 @@ int sntable_readprep_vardef1(char *varName_withCast, void *ptr,
     }
 
     return ivar ;
-      
-  } // end of ivar
+
+  } // end of ivar match
 
 
   if  ( (vboseflag & 2) > 0 ) {
@@ -1750,9 +1764,18 @@ int SNTABLE_DUMP_VALUES(char *FILENAME, char *TABLENAME,
   sprintf(READTABLE_POINTERS.LINEKEY_DUMP,"%s", LINEKEY_DUMP);
   sprintf(READTABLE_POINTERS.SEPKEY_DUMP, "%s", SEPKEY_DUMP);
 
+  // Aug 2026: resolve optional row-filters against the dump list
+  if ( DUMPFILTER.USEFLAG ) { prep_DUMPFILTER(NVAR, VARLIST); }
+
   // do the read & write
   NREAD = SNTABLE_READ_EXEC();
 
+  if ( DUMPFILTER.USEFLAG ) {
+    printf("\t Row filters kept %d of %d table rows.\n",
+	   DUMPFILTER.NROW_PASS, DUMPFILTER.NROW_READ );
+    fflush(stdout);
+  }
+
   // close file that was read.
   TABLEFILE_CLOSE(FILENAME);
 
@@ -1761,6 +1784,195 @@ int SNTABLE_DUMP_VALUES(char *FILENAME, char *TABLENAME,
 } // end of SNTABLE_DUMP_VALUES
 
 
+// =========================================
+int compare_DUMPFILTER_CID(const void *a, const void *b) {
+  // Aug 2026: qsort/bsearch compare for CID keep-list
+  return strcmp( *(char* const*)a, *(char* const*)b );
+}
+
+// =========================================
+void SNTABLE_DUMPFILTER_CIDFILE(char *cidFile) {
+
+  // Created Aug 2026
+  // Read list of CIDs to keep (one per line) and load the dump
+  // row-filter. Comment lines starting with '#' are ignored, and a
+  // leading row key (e.g., 'SN:') is skipped so that fitres-style
+  // files work as CID lists too.
+
+  #define BUFFSIZE_CIDLIST 1000
+  FILE *fp ;
+  int   N=0, MEMTOT=0 ;
+  char  LINE[200], c1[100], c2[100], *ptrCID ;
+  char fnam[] = "SNTABLE_DUMPFILTER_CIDFILE" ;
+
+  // ------------- BEGIN -----------
+
+  fp = fopen(cidFile,"rt");
+  if ( fp == NULL ) {
+    sprintf(MSGERR1,"Could not open CID-list file");
+    sprintf(MSGERR2,"%s", cidFile);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+  DUMPFILTER.CID_LIST = (char**) malloc( BUFFSIZE_CIDLIST*sizeof(char*) );
+  MEMTOT = BUFFSIZE_CIDLIST ;
+
+  while ( fgets(LINE, 200, fp) != NULL ) {
+
+    c1[0] = c2[0] = 0 ;
+    if ( sscanf(LINE,"%s %s", c1, c2) < 1 ) { continue ; }
+    if ( c1[0] == '#' )                     { continue ; }
+    if ( strcmp(c1,"VARNAMES:") == 0 )      { continue ; }
+
+    // skip leading row key (SN:, ROW:, GAL: ...)
+    if ( strlen(c1) > 0 && c1[strlen(c1)-1] == ':' )
+      { ptrCID = c2 ; }
+    else
+      { ptrCID = c1 ; }
+
+    if ( strlen(ptrCID) == 0 ) { continue ; }
+
+    if ( N >= MEMTOT ) {
+      MEMTOT += BUFFSIZE_CIDLIST ;
+      DUMPFILTER.CID_LIST =
+	(char**) realloc( DUMPFILTER.CID_LIST, MEMTOT*sizeof(char*) );
+    }
+
+    DUMPFILTER.CID_LIST[N] =
+      (char*) malloc( (strlen(ptrCID)+1)*sizeof(char) );
+    sprintf(DUMPFILTER.CID_LIST[N], "%s", ptrCID );
+    N++ ;
+  }
+  fclose(fp);
+
+  if ( N == 0 ) {
+    sprintf(MSGERR1,"Found no CIDs in CID-list file");
+    sprintf(MSGERR2,"%s", cidFile);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+  // sort for bsearch in SNTABLE_DUMPFILTER_ROWSEL
+  qsort(DUMPFILTER.CID_LIST, N, sizeof(char*), compare_DUMPFILTER_CID);
+
+  DUMPFILTER.NCID    = N ;
+  DUMPFILTER.USEFLAG = true ;
+
+  printf("\t Dump row-filter: keep %d CIDs from %s \n", N, cidFile);
+  fflush(stdout);
+
+  return ;
+
+} // end SNTABLE_DUMPFILTER_CIDFILE
+
+
+// =========================================
+void SNTABLE_DUMPFILTER_CUTWIN(char *varName, double lo, double hi) {
+
+  // Created Aug 2026
+  // Load numeric cut-window row-filter: keep rows with
+  // lo <= varName <= hi. Cut variable must be on the dump list
+  // (see prep_DUMPFILTER).
+
+  int N = DUMPFILTER.NCUT ;
+  char fnam[] = "SNTABLE_DUMPFILTER_CUTWIN" ;
+
+  // ------------- BEGIN -----------
+
+  if ( N >= MXCUT_DUMPFILTER ) {
+    sprintf(MSGERR1,"NCUT=%d exceeds bound.", N);
+    sprintf(MSGERR2,"Check MXCUT_DUMPFILTER=%d", MXCUT_DUMPFILTER);
+    errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+  }
+
+  sprintf(DUMPFILTER.CUTVAR[N], "%s", varName);
+  DUMPFILTER.CUTWIN[N][0]     = lo ;
+  DUMPFILTER.CUTWIN[N][1]     = hi ;
+  DUMPFILTER.IVAR_READ_CUT[N] = -9 ;
+
+  DUMPFILTER.NCUT++ ;
+  DUMPFILTER.USEFLAG = true ;
+
+  printf("\t Dump row-filter: keep  %le <= %s <= %le \n",
+	 lo, varName, hi );
+  fflush(stdout);
+
+  return ;
+
+} // end SNTABLE_DUMPFILTER_CUTWIN
+
+
+// =========================================
+void prep_DUMPFILTER(int NVAR, char **VARLIST) {
+
+  // Created Aug 2026
+  // Map each cut variable to its position on the dump read-list
+  // so that backend row loops can test cuts with a direct index.
+
+  int icut, ivar, IVAR ;
+  char *cutVar ;
+  char fnam[] = "prep_DUMPFILTER" ;
+
+  // ------------- BEGIN -----------
+
+  for(icut=0; icut < DUMPFILTER.NCUT; icut++ ) {
+    cutVar = DUMPFILTER.CUTVAR[icut] ;
+    IVAR = -9 ;
+    for(ivar=0; ivar < NVAR; ivar++ ) {
+      if ( strcmp(VARLIST[ivar],cutVar) == 0 ) { IVAR = ivar; }
+    }
+
+    if ( IVAR < 0 ) {
+      sprintf(MSGERR1,"Cut variable '%s' is not on dump list.", cutVar);
+      sprintf(MSGERR2,"Add it to the -v varName list.");
+      errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+    }
+    DUMPFILTER.IVAR_READ_CUT[icut] = IVAR ;
+  }
+
+  return ;
+
+} // end prep_DUMPFILTER
+
+
+// =========================================
+bool SNTABLE_DUMPFILTER_ROWSEL(char *CCID, double *DVAL_READLIST) {
+
+  // Created Aug 2026
+  // Return true if row passes all loaded dump row-filters.
+  // Inputs:
+  //   CCID          : string id of row (first dump variable)
+  //   DVAL_READLIST : numeric row values in read-list order;
+  //                   only entries named by cut-filters are used.
+
+  int icut, ivar ;
+  double DVAL ;
+  char **pfind ;
+
+  // ------------- BEGIN -----------
+
+  DUMPFILTER.NROW_READ++ ;
+
+  if ( DUMPFILTER.NCID > 0 && CCID[0] != 0 ) {
+    pfind = (char**) bsearch(&CCID, DUMPFILTER.CID_LIST,
+			     DUMPFILTER.NCID, sizeof(char*),
+			     compare_DUMPFILTER_CID );
+    if ( pfind == NULL ) { return false ; }
+  }
+
+  for(icut=0; icut < DUMPFILTER.NCUT; icut++ ) {
+    ivar = DUMPFILTER.IVAR_READ_CUT[icut] ;
+    if ( ivar < 0 ) { continue ; }
+    DVAL = DVAL_READLIST[ivar] ;
+    if ( DVAL < DUMPFILTER.CUTWIN[icut][0] ) { return false ; }
+    if ( DVAL > DUMPFILTER.CUTWIN[icut][1] ) { return false ; }
+  }
+
+  DUMPFILTER.NROW_PASS++ ;
+  return true ;
+
+} // end SNTABLE_DUMPFILTER_ROWSEL
+
+
 // =========================================
 int  SNTABLE_DUMP_OUTLIERS(char *FILENAME, char *TABLENAME, 
 			   int NVAR, char **VARLIST, int IVAR_NPT, 
@@ -2110,6 +2322,17 @@ int SNTABLE_AUTOSTORE_INIT(char *fileName, char *tableName,
   } // end ivar loop
 
 
+  // Aug 2026: build varName hash for O(1) per-row lookups in
+  // SNTABLE_AUTOSTORE_READ; build after loop above so that
+  // duplicate-varName renames (varName_[NF+1]) are included.
+  for(ivar=0; ivar < NVAR_USR; ivar++ ) {
+    SNTABLE_AUTOSTORE[NF].PTRLIST_VARNAME[ivar] =
+      SNTABLE_AUTOSTORE[NF].VARNAME[ivar] ;
+  }
+  build_HASH_STRING(&SNTABLE_AUTOSTORE[NF].HASH_VARNAME, NVAR_USR,
+		    SNTABLE_AUTOSTORE[NF].PTRLIST_VARNAME );
+
+
   // read table and store values.
   NROW = SNTABLE_READ_EXEC();
   SNTABLE_AUTOSTORE[NF].NROW = NROW ;
@@ -2327,9 +2550,9 @@ void SNTABLE_AUTOSTORE_READ(char *CCID, char *VARNAME, int *ISTAT,
   //   + do NOT abort on missing varname; instead, return ISTAT = -2
 
   int IVAR_READ, IFILE_READ, ivar, i ;
-  int NVAR_USR, NROW_TOT, ICAST, LENCCID, IROW ;
-  char *tmpCCID, *tmpVar;
-  
+  int NROW_TOT, ICAST, LENCCID, IROW ;
+  char *tmpCCID ;
+
   char fnam[] = "SNTABLE_AUTOSTORE_READ" ;
 
   // ------------- BEGIN --------------
@@ -2338,13 +2561,11 @@ void SNTABLE_AUTOSTORE_READ(char *CCID, char *VARNAME, int *ISTAT,
   IVAR_READ = IFILE_READ = IROW = -9 ;
 
   // search file and variable indices
+  // (Aug 2026: hashed lookup per file; hash built in SNTABLE_AUTOSTORE_INIT)
   for(i=0; i < NFILE_AUTOSTORE; i++ ) {
-    NVAR_USR = SNTABLE_AUTOSTORE[i].NVAR ;
-    for(ivar=0; ivar < NVAR_USR; ivar++ ) {
-      tmpVar = SNTABLE_AUTOSTORE[i].VARNAME[ivar] ;
-      if ( strcmp(tmpVar,VARNAME) == 0 ) 
-	{ IVAR_READ = ivar ; IFILE_READ = i ;  goto FIND_CCID; }   
-    }
+    ivar = index_HASH_STRING(&SNTABLE_AUTOSTORE[i].HASH_VARNAME, VARNAME);
+    if ( ivar >= 0 )
+      { IVAR_READ = ivar ; IFILE_READ = i ;  goto FIND_CCID; }
   }
 
 
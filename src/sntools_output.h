@@ -171,6 +171,12 @@ struct READTABLE_POINTERS {
 
 } READTABLE_POINTERS ;
 
+// Aug 2026: hash over READTABLE_POINTERS.VARNAME so that each
+// SNTABLE_READPREP_VARDEF lookup is O(1) instead of a scan over
+// all columns; rebuilt in SNTABLE_READPREP for each table header.
+HASH_STRING_DEF HASH_VARNAME_READTABLE ;
+char *PTRLIST_VARNAME_READTABLE[MXVAR_TABLE] ;
+
 
 // -------------------------------------------------
 // SNLCPAK global declarations for light curves
@@ -327,6 +333,25 @@ struct OUTLIER_INFO {
 } OUTLIER_INFO ;
 
 
+// Aug 2026: optional row filters for table dumps (predicate pushdown).
+// sntable_dump loads a CID list and/or numeric cut windows here; each
+// backend read loop checks SNTABLE_DUMPFILTER_ROWSEL before a row is
+// written or materialized, so rejected rows cost no memory or output.
+#define MXCUT_DUMPFILTER 10
+struct {
+  bool   USEFLAG ;
+
+  int    NCID ;        // size of CID keep-list (0 => no CID filter)
+  char **CID_LIST ;    // sorted for bsearch
+
+  int    NCUT ;
+  char   CUTVAR[MXCUT_DUMPFILTER][MXCHAR_VARNAME];
+  double CUTWIN[MXCUT_DUMPFILTER][2];
+  int    IVAR_READ_CUT[MXCUT_DUMPFILTER]; // read-list index per cut
+
+  int    NROW_READ, NROW_PASS ;  // stats for end-of-dump summary
+} DUMPFILTER ;
+
 #define MXFILE_AUTOSTORE 10   // max files to autoStore (Jan 2017)
 int NFILE_AUTOSTORE ;
 struct SNTABLE_AUTOSTORE {
@@ -343,6 +368,11 @@ struct SNTABLE_AUTOSTORE {
   double  **DVAL ;
   char    ***CVAL ;
 
+  // Aug 2026: hash over VARNAME for O(1) per-row lookups in
+  // SNTABLE_AUTOSTORE_READ; built in SNTABLE_AUTOSTORE_INIT.
+  char    *PTRLIST_VARNAME[MXVAR_TABLE] ;
+  HASH_STRING_DEF HASH_VARNAME ;
+
 } SNTABLE_AUTOSTORE[MXFILE_AUTOSTORE] ;
 
 
@@ -414,11 +444,17 @@ extern"C" {
 			   char *LINEKEY_DUMP, char *SEPKEY_DUMP );
 
 
-  int  SNTABLE_DUMP_OUTLIERS(char *FILENAME, char *TABLENAME, 
+  int  SNTABLE_DUMP_OUTLIERS(char *FILENAME, char *TABLENAME,
 			     int NVAR, char **VARLIST, int IVAR_NPT,
-			     float *OUTLIER_NSIGMA, FILE *FP_OUTFILE, 
+			     float *OUTLIER_NSIGMA, FILE *FP_OUTFILE,
 			     char *LINEKEY_DUMP, char *SEPKEY_DUMP );
 
+  // Aug 2026: row filters for dumps (predicate pushdown)
+  void SNTABLE_DUMPFILTER_CIDFILE(char *cidFile);
+  void SNTABLE_DUMPFILTER_CUTWIN(char *varName, double lo, double hi);
+  void prep_DUMPFILTER(int NVAR, char **VARLIST);
+  bool SNTABLE_DUMPFILTER_ROWSEL(char *CCID, double *DVAL_READLIST);
+
   void SNTABLE_SUMMARY_OUTLIERS(void);
   bool ISTABLEVAR_IFILT(char *VARNAME);
 
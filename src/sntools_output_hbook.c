@@ -930,6 +930,8 @@ void sntable_pushRowOut_hbook(int IROW, int OPT_READ, int IFIT) {
   char   *SEPKEY = READTABLE_POINTERS.SEPKEY_DUMP ;
   char   LINE[MXCHAR_VARLIST], *VARNAME, band[2] ;
   char   BLANK[] = " " ;
+  double DARRAY[MXVAR_TABLE] ;    // Aug 2026: for dump row-filters
+  char   CCID_ROW[100] ;
   char   fnam[] = "pushRowOut" ;
 
   // ------------ BEGIN ---------
@@ -937,8 +939,9 @@ void sntable_pushRowOut_hbook(int IROW, int OPT_READ, int IFIT) {
   LDUMP = ( OPT_READ == OPT_SNTABLE_READ_forDUMP  );
   LREAD = ( OPT_READ == OPT_SNTABLE_READ_forARRAY );
 
-  sprintf(LINE,"%s ", READTABLE_POINTERS.LINEKEY_DUMP); 
+  sprintf(LINE,"%s ", READTABLE_POINTERS.LINEKEY_DUMP);
   ADDSEPKEY = (strlen(SEPKEY) > 0 ) ;
+  CCID_ROW[0] = 0 ;
 
   for ( IVAR_DUMP = 0; IVAR_DUMP < NVAR_DUMP; IVAR_DUMP++ ) {
 
@@ -976,11 +979,14 @@ void sntable_pushRowOut_hbook(int IROW, int OPT_READ, int IFIT) {
     
     else if ( ICAST_READ == ICAST_C ) {
       ivarcast = HBOOK_CWNT_READROW.IVARCAST_MAP[IVAR_DUMP][ICAST_C];
-      ptrC   =  HBOOK_CWNT_READROW.VAL_C[ivarcast][IFIT]; 
-      trim_blank_spaces(ptrC);  
+      ptrC   =  HBOOK_CWNT_READROW.VAL_C[ivarcast][IFIT];
+      trim_blank_spaces(ptrC);
       load_DUMPLINE_STR(LINE,ptrC);
       // xxx mark delete    sprintf(LINE,"%s %s", LINE, ptrC );
       if ( LREAD )  { load_READTABLE_POINTER(IROW,IVAR_TOT,VAL_D,ptrC); }
+
+      // Aug 2026: first string var is row id for dump row-filters
+      if ( CCID_ROW[0] == 0 ) { sprintf(CCID_ROW, "%s", ptrC); }
     }
 
     /*
@@ -988,9 +994,11 @@ void sntable_pushRowOut_hbook(int IROW, int OPT_READ, int IFIT) {
 	   IVAR, NVAR, LDUMP, ICAST_READ); fflush(stdout);
     */
 
+    DARRAY[IVAR_DUMP] = VAL_D ;  // Aug 2026: for dump row-filters
+
     // Check option to write sep-string between variables;
     // in particular, a comma for csv format.
-    if ( LDUMP && ICAST_READ > 0 && ADDSEPKEY ) { 
+    if ( LDUMP && ICAST_READ > 0 && ADDSEPKEY ) {
       NVAR_WR++ ;
       if ( NVAR_WR < NVAR_DUMP ) { strcat(LINE,SEPKEY); }
     }
@@ -999,11 +1007,16 @@ void sntable_pushRowOut_hbook(int IROW, int OPT_READ, int IFIT) {
 
 
   // ------------------------------------------
+  // Aug 2026: apply optional dump row-filters (predicate pushdown)
+  if ( LDUMP && DUMPFILTER.USEFLAG &&
+       !SNTABLE_DUMPFILTER_ROWSEL(CCID_ROW,DARRAY) )
+    { LDUMP = 0 ; }
+
   // update ascii file for dump option
-  if ( LDUMP )  { 
+  if ( LDUMP )  {
     FILE *FP = READTABLE_POINTERS.FP_DUMP ;
-    fprintf(FP, "%s\n", LINE);  
-    fflush(FP); 
+    fprintf(FP, "%s\n", LINE);
+    fflush(FP);
   }
 
   return ;
@@ -2,7 +2,7 @@
   Created May 2020 by R. Kessler
 
   Write host-galaxy spectra to .fits file that is specifically
-  formatted so that it can be input to the online MARZ program 
+  formatted so that it can be input to the online MARZ program
   (http://samreay.github.io/Marz) to determine redshifts.
 
   This utility is invoked with interactive snana.exe program and
@@ -13,24 +13,36 @@
     &END
 
 
-  The output marz-file name must have a .fits extension, and 
+  The output marz-file name must have a .fits extension, and
   either 'marz' or 'MARZ' must be part of the fileName.
   MARZFILE_OUT will not work with fitting codes (snlc_fit, psnid),
   and will not work in batch mode.
 
-  Since images and tables must be written sequentially to fits files,
-  each host spectrum is stored in memory (MARZ_SPECDATA struct) 
-  and everything is written in the CLOSE_MARZFILE process.
-  MXSPEC_MARZ limits the number of stored spectra to avoid 
-  using excessive memory.
- 
+  Aug 2026: spectra are no longer all stored in memory until
+  CLOSE_MARZFILE; they are appended to the FLAM image in chunks of
+  NSPEC_CHUNK_MARZ spectra (fits_resize_img + fits_write_img), and
+  the VARIANCE image is streamed the same way to a temporary file
+  that is appended as an HDU at close (same trick as the SPECTMP
+  file in sntools_dataformat_fits.c). Memory usage is therefore
+  one chunk instead of the full job, and MXSPEC_MARZ is raised
+  accordingly. Header keys and the FIBRES name-table are written
+  in CLOSE_MARZFILE after the final chunk.
+
+  Aug 2026: if the marz-file name contains 'marz16' or 'MARZ16',
+  the FLAM and VARIANCE images are written as 16-bit integers with
+  BSCALE/BZERO scaling (FITS has no half-precision float), halving
+  the output size for visual-inspection use. The scale is fixed
+  from the first chunk with 10x headroom; later values outside the
+  representable range are clipped.
+
  ***********************/
 
 #include "fitsio.h"
 
 // ======= GLOBALS =========
 
-#define MXSPEC_MARZ 1000   // stop writing after this many to conserve memory
+#define MXSPEC_MARZ 100000 // stop writing after this many spectra
+#define NSPEC_CHUNK_MARZ 500 // append spectra to images in chunks of this size
 #define MARZTABLE_FIBRES    "FIBRES"
 #define MARZTABLE_FLAM      "FLAM"
 #define MARZTABLE_VARIANCE  "VARIANCE"
@@ -39,14 +51,24 @@
 #define FLAMSCALE_MARZ 1.0E19 // scale FLAM to avoid float overflow
 
 fitsfile *FP_MARZ ;
+fitsfile *FP_MARZTMP ;  // Aug 2026: temp file streaming VARIANCE image
 
-struct MARZ_SPECDATA {  
-  int    NBIN_WAVE; // number of wave bins 
+struct MARZ_SPECDATA {
+  int    NBIN_WAVE; // number of wave bins
   float  *WAVE ;    // wavelength in each bin
-  int    NSPEC;     // number of stored spectra
-  char  **NAME;     // name of each SN vs. ispec
-  float **FLAM ;    // FLAM vs. wave bin and ispec
-  float **VARFLAM ; // variance vs. wave bin and ispec
+  int    NSPEC;     // total number of spectra (written + in chunk)
+  int    NSPEC_WRITE; // number of spectra already written to images
+  int    NSPEC_CHUNK; // number of spectra in current chunk buffer
+  char  **NAME;     // name of each SN vs. ispec (kept for FIBRES table)
+  float **FLAM ;    // FLAM vs. wave bin, for chunk only
+  float **VARFLAM ; // variance vs. wave bin, for chunk only
+  float  *ARRAY1D ; // scratch 1D array to write a chunk
+
+  // Aug 2026: optional 16-bit output (marz16 in file name)
+  bool   FLAG16 ;
+  double BSCALE_FLAM, BZERO_FLAM ;     // physical = BSCALE*stored + BZERO
+  double BSCALE_VARFLAM, BZERO_VARFLAM ;
+  char   FILENAME_VARTMP[400];
 } MARZ_SPECDATA ;
 
 // ======== FUNCTIONS ==========
@@ -59,6 +81,8 @@ extern"C" {
   void CLOSE_MARZFILE(char *FILENAME);
   void SNTABLE_CREATE_MARZ(int IDTABLE, char *NAME);
   void SPECPAK_FILL_MARZ(void);
+  void wr_marz_create_images(void);
+  void wr_marz_flush_chunk(void);
   void marzfitsio_errorCheck(char *comment, int status);
 
 #ifdef __cplusplus
@@ -67,7 +91,7 @@ extern"C" {
 
 
 
-// ========================================  
+// ========================================
 void marzfitsio_errorCheck(char *comment, int status) {
   char fnam[] = "marzfitsio_errorCheck" ;
   char comment2[] = "Check cfitsio routines.";
@@ -79,13 +103,13 @@ void marzfitsio_errorCheck(char *comment, int status) {
     errmsg(SEV_FATAL, 0, fnam, comment, comment2);
   }
   return;
-} 
+}
 
 // ======================================
 void OPEN_MARZFILE(char *FILENAME, int *ERR) {
 
   int istat = 0 ;
-  char msg[200], clobberFile[200];
+  char msg[200], clobberFile[420];
   char fnam[] = "OPEN_MARZFILE";
   // ------------ BEGIN ------------
 
@@ -99,6 +123,24 @@ void OPEN_MARZFILE(char *FILENAME, int *ERR) {
   sprintf(msg,"Open %s", FILENAME );
   marzfitsio_errorCheck(msg, istat);
 
+  // Aug 2026: check file-name option for 16-bit output
+  MARZ_SPECDATA.FLAG16 =
+    ( strstr(FILENAME,"marz16") != NULL  ||
+      strstr(FILENAME,"MARZ16") != NULL  ) ;
+  if ( MARZ_SPECDATA.FLAG16 ) {
+    printf("\t (write 16-bit FLAM & VARIANCE images) \n");
+    fflush(stdout);
+  }
+
+  // Aug 2026: open temp file where VARIANCE image is streamed;
+  // appended to main file and removed in CLOSE_MARZFILE.
+  sprintf(MARZ_SPECDATA.FILENAME_VARTMP, "%s_vartmp", FILENAME);
+  sprintf(clobberFile, "!%s", MARZ_SPECDATA.FILENAME_VARTMP);
+  istat = 0 ;
+  fits_create_file(&FP_MARZTMP, clobberFile, &istat );
+  sprintf(msg,"Open %s", MARZ_SPECDATA.FILENAME_VARTMP );
+  marzfitsio_errorCheck(msg, istat);
+
   return;
 
 } // end OPEN_MARZFILE
@@ -107,8 +149,8 @@ void OPEN_MARZFILE(char *FILENAME, int *ERR) {
 // ======================================
 void CLOSE_MARZFILE(char *FILENAME) {
 
-  int istat = 0;
-  char msg[200];
+  int istat = 0, isys;
+  char msg[200], cmd[500];
   //  char fnam[] = "CLOSE_MARZFILE" ;
   // -------------- BEGIN -------------
 
@@ -119,6 +161,11 @@ void CLOSE_MARZFILE(char *FILENAME) {
   sprintf(msg, "Close FITS file %s", FILENAME );
   marzfitsio_errorCheck(msg, istat);
 
+  // remove temp VARIANCE file; its image was appended
+  // to the main marz file in WRITE_TABLES_MARZ.
+  sprintf(cmd,"rm %s", MARZ_SPECDATA.FILENAME_VARTMP );
+  isys = system( cmd );
+
   fflush(stdout);
 
   return ;
@@ -127,28 +174,220 @@ void CLOSE_MARZFILE(char *FILENAME) {
 
 
 // ===================================
-void WRITE_TABLES_MARZ(char *FILENAME) {
+void wr_marz_create_images(void) {
+
+  // Created Aug 2026
+  // Create FLAM primary image in FP_MARZ and VARIANCE primary
+  // image in FP_MARZTMP, each with zero spectra; each chunk-write
+  // grows NAXIS2 with fits_resize_img. Called on first chunk flush
+  // when NBIN_WAVE and the first-chunk fluxes are known.
+  // For 16-bit option, fix BSCALE/BZERO from the range of the
+  // first chunk with 10x headroom.
 
-  int NSPEC     = MARZ_SPECDATA.NSPEC ;
   int NBIN_WAVE = MARZ_SPECDATA.NBIN_WAVE ;
+  int NCHUNK    = MARZ_SPECDATA.NSPEC_CHUNK ;
+  int istat = 0, BITPIX, ispec, iwave ;
+  long NAXIS=2, NAXES[2] = { (long)NBIN_WAVE, 0 } ;
+  double XVAL, XMIN, XMAX, BSCALE, BZERO ;
+  char extName[40], msg[100];
+  //  char fnam[] = "wr_marz_create_images" ;
+
+  // ------------ BEGIN ------------
+
+  BITPIX = FLOAT_IMG ;
+  if ( MARZ_SPECDATA.FLAG16 ) { BITPIX = SHORT_IMG ; }
+
+  fits_create_img(FP_MARZ, BITPIX, NAXIS, NAXES, &istat) ;
+  sprintf(msg,"Create FLAM primary image") ;
+  marzfitsio_errorCheck(msg, istat) ;
+
+  fits_create_img(FP_MARZTMP, BITPIX, NAXIS, NAXES, &istat) ;
+  sprintf(msg,"Create VARIANCE image") ;
+  marzfitsio_errorCheck(msg, istat) ;
+
+  sprintf(extName,"VARIANCE");
+  fits_update_key(FP_MARZTMP, TSTRING, "EXTNAME", extName,
+		  "image name", &istat );
+
+  if ( !MARZ_SPECDATA.FLAG16 ) { return; }
+
+  // - - - - - - - - - - -
+  // 16-bit option: set linear scale from first chunk.
+
+  XMIN = 1.0E38;  XMAX = -1.0E38 ;
+  for(ispec=0; ispec < NCHUNK; ispec++ ) {
+    for(iwave=0; iwave < NBIN_WAVE; iwave++ ) {
+      XVAL = (double)MARZ_SPECDATA.FLAM[ispec][iwave];
+      if ( XVAL < XMIN ) { XMIN = XVAL ; }
+      if ( XVAL > XMAX ) { XMAX = XVAL ; }
+    }
+  }
+  BZERO  = 0.5 * ( XMIN + XMAX );
+  BSCALE = 10.0 * ( XMAX - XMIN ) / 65000.0 ; // 10x headroom
+  if ( BSCALE <= 0.0 ) { BSCALE = 1.0 ; }
+  MARZ_SPECDATA.BSCALE_FLAM = BSCALE ;
+  MARZ_SPECDATA.BZERO_FLAM  = BZERO ;
+  fits_update_key(FP_MARZ, TDOUBLE, "BSCALE", &BSCALE,
+		  "FLAM = BSCALE*stored + BZERO", &istat );
+  fits_update_key(FP_MARZ, TDOUBLE, "BZERO",  &BZERO,
+		  "FLAM = BSCALE*stored + BZERO", &istat );
+  fits_set_bscale(FP_MARZ, BSCALE, BZERO, &istat);
+
+  XMIN = 1.0E38;  XMAX = -1.0E38 ;
+  for(ispec=0; ispec < NCHUNK; ispec++ ) {
+    for(iwave=0; iwave < NBIN_WAVE; iwave++ ) {
+      XVAL = (double)MARZ_SPECDATA.VARFLAM[ispec][iwave];
+      if ( XVAL < XMIN ) { XMIN = XVAL ; }
+      if ( XVAL > XMAX ) { XMAX = XVAL ; }
+    }
+  }
+  BZERO  = 0.5 * ( XMIN + XMAX );
+  BSCALE = 10.0 * ( XMAX - XMIN ) / 65000.0 ;
+  if ( BSCALE <= 0.0 ) { BSCALE = 1.0 ; }
+  MARZ_SPECDATA.BSCALE_VARFLAM = BSCALE ;
+  MARZ_SPECDATA.BZERO_VARFLAM  = BZERO ;
+  fits_update_key(FP_MARZTMP, TDOUBLE, "BSCALE", &BSCALE,
+		  "VARIANCE = BSCALE*stored + BZERO", &istat );
+  fits_update_key(FP_MARZTMP, TDOUBLE, "BZERO",  &BZERO,
+		  "VARIANCE = BSCALE*stored + BZERO", &istat );
+  fits_set_bscale(FP_MARZTMP, BSCALE, BZERO, &istat);
+
+  return ;
+
+} // end wr_marz_create_images
+
+
+// ===================================
+void wr_marz_flush_chunk(void) {
+
+  // Created Aug 2026
+  // Append the chunk buffer (NSPEC_CHUNK spectra) to the FLAM
+  // image of FP_MARZ and the VARIANCE image of FP_MARZTMP,
+  // then reset the chunk counter. Each image is the last HDU
+  // of its file so that appending rows is cheap.
+
+  int NBIN_WAVE = MARZ_SPECDATA.NBIN_WAVE ;
+  int NCHUNK    = MARZ_SPECDATA.NSPEC_CHUNK ;
+  int NWRITE    = MARZ_SPECDATA.NSPEC_WRITE ;
+  int istat = 0, BITPIX, ispec, iwave, i2 ;
+  long NAXIS=2, NAXES[2], fpixel, N2D ;
+  double XVAL, XMIN, XMAX ;
+  float *ARRAY1D ;
+  char msg[100];
+  //  char fnam[] = "wr_marz_flush_chunk" ;
+
+  // ------------ BEGIN ------------
+
+  if ( NCHUNK == 0 ) { return; }
+
+  if ( NWRITE == 0 ) {
+    wr_marz_create_images();
+    int MEMF = NSPEC_CHUNK_MARZ * NBIN_WAVE * sizeof(float);
+    MARZ_SPECDATA.ARRAY1D = (float*) malloc(MEMF);
+  }
+
+  ARRAY1D = MARZ_SPECDATA.ARRAY1D ;
+  BITPIX  = FLOAT_IMG ;
+  if ( MARZ_SPECDATA.FLAG16 ) { BITPIX = SHORT_IMG ; }
+
+  NAXES[0] = (long)NBIN_WAVE ;
+  NAXES[1] = (long)(NWRITE + NCHUNK) ;
+  fpixel   = (long)(NWRITE*NBIN_WAVE) + 1 ;
+  N2D      = (long)(NCHUNK*NBIN_WAVE) ;
+
+  // - - - - - - - - - - -
+  // FLAM chunk
+  fits_resize_img(FP_MARZ, BITPIX, NAXIS, NAXES, &istat);
+  sprintf(msg,"Grow FLAM image to %d spectra", NWRITE+NCHUNK ) ;
+  marzfitsio_errorCheck(msg, istat) ;
+
+  // clip range for 16-bit option (scale fixed on first chunk)
+  XMIN = MARZ_SPECDATA.BZERO_FLAM - 32000.0*MARZ_SPECDATA.BSCALE_FLAM ;
+  XMAX = MARZ_SPECDATA.BZERO_FLAM + 32000.0*MARZ_SPECDATA.BSCALE_FLAM ;
+
+  i2 = 0;
+  for(ispec=0; ispec < NCHUNK; ispec++ ) {
+    for(iwave=0; iwave < NBIN_WAVE; iwave++ ) {
+      XVAL = (double)MARZ_SPECDATA.FLAM[ispec][iwave];
+      if ( MARZ_SPECDATA.FLAG16 ) {
+	if ( XVAL < XMIN ) { XVAL = XMIN; }
+	if ( XVAL > XMAX ) { XVAL = XMAX; }
+      }
+      ARRAY1D[i2] = (float)XVAL ;      i2++;
+    }
+  }
+  fits_write_img(FP_MARZ, TFLOAT, fpixel, N2D, ARRAY1D, &istat );
+  sprintf(msg,"Write FLAM chunk") ;
+  marzfitsio_errorCheck(msg, istat) ;
+
+  // - - - - - - - - - - -
+  // VARIANCE chunk
+  fits_resize_img(FP_MARZTMP, BITPIX, NAXIS, NAXES, &istat);
+  sprintf(msg,"Grow VARIANCE image to %d spectra", NWRITE+NCHUNK ) ;
+  marzfitsio_errorCheck(msg, istat) ;
+
+  XMIN = MARZ_SPECDATA.BZERO_VARFLAM - 32000.0*MARZ_SPECDATA.BSCALE_VARFLAM ;
+  XMAX = MARZ_SPECDATA.BZERO_VARFLAM + 32000.0*MARZ_SPECDATA.BSCALE_VARFLAM ;
+
+  i2 = 0;
+  for(ispec=0; ispec < NCHUNK; ispec++ ) {
+    for(iwave=0; iwave < NBIN_WAVE; iwave++ ) {
+      XVAL = (double)MARZ_SPECDATA.VARFLAM[ispec][iwave];
+      if ( MARZ_SPECDATA.FLAG16 ) {
+	if ( XVAL < XMIN ) { XVAL = XMIN; }
+	if ( XVAL > XMAX ) { XVAL = XMAX; }
+      }
+      ARRAY1D[i2] = (float)XVAL ;      i2++;
+    }
+  }
+  fits_write_img(FP_MARZTMP, TFLOAT, fpixel, N2D, ARRAY1D, &istat );
+  sprintf(msg,"Write VARIANCE chunk") ;
+  marzfitsio_errorCheck(msg, istat) ;
+
+  MARZ_SPECDATA.NSPEC_WRITE += NCHUNK ;
+  MARZ_SPECDATA.NSPEC_CHUNK  = 0 ;
+
+  return ;
+
+} // end wr_marz_flush_chunk
+
+
+// ===================================
+void WRITE_TABLES_MARZ(char *FILENAME) {
+
+  // Aug 2026: the FLAM and VARIANCE images were streamed in chunks
+  // (see wr_marz_flush_chunk); here write the last partial chunk,
+  // fix up the primary header keys, append the VARIANCE image from
+  // the temp file, then write WAVELENGTH image and FIBRES table.
+
   int istat     = 0;
-  long NROW     = (long)NSPEC ;
-  long fpixel=1, N2D = (long)(NSPEC*NBIN_WAVE) ;
-  long NAXIS=2, NAXES[2] = { (long)NBIN_WAVE, (long)NSPEC } ;
-  int  ncol, icol, iwave, ispec, colnum, firstelem, firstrow, i2 ;
+  int  ncol, icol, colnum, firstelem, firstrow ;
 
   int  MXCOL   = 10 ;
   int  MEMC1   = MXCOL*sizeof(char*);
   int  MEMC0   = MXCHAR_CCID_MARZ*sizeof(char);
-  
+
   char extName[40], **varNames, **formats, **units;
   char tblName[40], msg[100] ;
   //  char fnam[] = "WRITE_TABLES_MARZ" ;
 
   // ------------ BEGIN ------------
 
+  wr_marz_flush_chunk();   // write last partial chunk
+
+  int NSPEC     = MARZ_SPECDATA.NSPEC_WRITE ;
+  int NBIN_WAVE = MARZ_SPECDATA.NBIN_WAVE ;
+  long NROW     = (long)NSPEC ;
+  long fpixel   = 1 ;
+
+  if ( NSPEC == 0 ) {
+    printf("   WARNING: no spectra stored; write empty marz file %s \n",
+	   FILENAME); fflush(stdout);
+    return ;
+  }
+
   printf("   Write marz file %s \n", FILENAME);
-  printf("      (NSPEC=%d, %d WAVE bins from %.1f to %.1f A) \n", 
+  printf("      (NSPEC=%d, %d WAVE bins from %.1f to %.1f A) \n",
 	 NSPEC, NBIN_WAVE, MARZ_SPECDATA.WAVE[0], MARZ_SPECDATA.WAVE[NBIN_WAVE-1] ) ;
 
   varNames = (char**) malloc(MEMC1);
@@ -161,35 +400,18 @@ void WRITE_TABLES_MARZ(char *FILENAME) {
     sprintf(units[icol]," ");
   }
 
-  // - - - - - - -
-  // Create NBIN_WAVE x NSPEC 1D array for image storage
-  int MEMF = NBIN_WAVE * NSPEC * sizeof(float);
-  float *ARRAY1D;  ARRAY1D = (float*) malloc(MEMF);
+  // - - - - - - - - - - - -
+  // load header keys on FLAM primary image
 
-  // - - - - - - - - - - - 
-  // make primary image for FLAM for each spectrum
-  fits_create_img(FP_MARZ, FLOAT_IMG, NAXIS, NAXES, &istat) ;
-  sprintf(msg,"Create FLAM primary image") ;
+  fits_movabs_hdu(FP_MARZ, 1, NULL, &istat);
+  sprintf(msg,"Move to FLAM primary image") ;
   marzfitsio_errorCheck(msg, istat) ;
 
-  i2 = 0;
-  for(ispec=0; ispec < NSPEC; ispec++ ) {
-    for(iwave=0; iwave < NBIN_WAVE; iwave++ ) {
-      ARRAY1D[i2] = MARZ_SPECDATA.FLAM[ispec][iwave];      i2++;
-    }
-  }
-  fits_write_img(FP_MARZ, TFLOAT, fpixel, N2D, ARRAY1D, &istat );
-  sprintf(msg,"Write FLAM primary image") ;
-  marzfitsio_errorCheck(msg, istat) ;
-
-  // - - - - - - - - - - - - 
-  // load some header keys
-
-  // name of survey                                                               
+  // name of survey
   fits_update_key(FP_MARZ, TSTRING, "SURVEY",
                   SPECPAK_OUTPUT.SURVEY, "Survey", &istat );
 
-  // name of survey                                                               
+  // name of survey
   fits_update_key(FP_MARZ, TSTRING, "VERSION_PHOTOMETRY",
                   SPECPAK_OUTPUT.VERSION_PHOTOMETRY, "Phot version", &istat );
 
@@ -198,27 +420,19 @@ void WRITE_TABLES_MARZ(char *FILENAME) {
   fits_update_key(FP_MARZ, TFLOAT, "FLAM_SCALE",
                   &scale, "FLAM here scaled by this factor", &istat );
 
-  // - - - - - - - - - - - 
-  // make image for VARFLAM for each spectrum
-  fits_create_img(FP_MARZ, FLOAT_IMG, NAXIS, NAXES, &istat) ;
-  sprintf(msg,"Create VARIANCE image") ;
+  // - - - - - - - - - - -
+  // append VARIANCE image from temp file
+  fits_movabs_hdu(FP_MARZTMP, 1, NULL, &istat);
+  fits_copy_hdu(FP_MARZTMP, FP_MARZ, 0, &istat);
+  sprintf(msg,"Append VARIANCE image") ;
   marzfitsio_errorCheck(msg, istat) ;
 
-  i2 = 0;
-  for(ispec=0; ispec < NSPEC; ispec++ ) {
-    for(iwave=0; iwave < NBIN_WAVE; iwave++ ) {
-      ARRAY1D[i2] = MARZ_SPECDATA.VARFLAM[ispec][iwave];      i2++;
-    }
-  }
-  fits_write_img(FP_MARZ, TFLOAT, fpixel, N2D, ARRAY1D, &istat );
-  sprintf(msg,"Write VARIANCE image") ;
+  istat = 0 ;
+  fits_close_file(FP_MARZTMP, &istat);
+  sprintf(msg,"Close %s", MARZ_SPECDATA.FILENAME_VARTMP) ;
   marzfitsio_errorCheck(msg, istat) ;
 
-  sprintf(extName,"VARIANCE");
-  fits_update_key(FP_MARZ, TSTRING, "EXTNAME", extName, "image name", &istat );
-
-
-  // - - - - - - - - - - - 
+  // - - - - - - - - - - -
   // make image for WAVELENGTH for each spectrum
   long NAXIS_WAVE = 1;
   long NAXES_WAVE = (long)NBIN_WAVE;
@@ -235,7 +449,7 @@ void WRITE_TABLES_MARZ(char *FILENAME) {
 
   // -----------------------
   // write table with SN NAMEs
-  ncol = 1;  
+  ncol = 1;
   sprintf(tblName,"%s", MARZTABLE_FIBRES);
   sprintf(varNames[0],"NAME");
   sprintf(formats[0], "%dA", MXCHAR_CCID_MARZ);
@@ -244,7 +458,7 @@ void WRITE_TABLES_MARZ(char *FILENAME) {
   sprintf(msg, "Create %s table", tblName );
   marzfitsio_errorCheck(msg, istat);
 
-  firstrow = firstelem = 1; colnum=1;  
+  firstrow = firstelem = 1; colnum=1;
   fits_write_col(FP_MARZ, TSTRING, colnum, firstrow, firstelem, NSPEC,
 		 MARZ_SPECDATA.NAME, &istat);
   sprintf(msg, "Write %s table", tblName );
@@ -260,6 +474,7 @@ void WRITE_TABLES_MARZ(char *FILENAME) {
 // =====================================
 void SNTABLE_CREATE_MARZ(int IDTABLE, char *NAME) {
 
+  int ispec;
   char fnam[] = "SNTABLE_CREATE_MARZ" ;
 
   // -------------- BEGIN --------------
@@ -267,17 +482,28 @@ void SNTABLE_CREATE_MARZ(int IDTABLE, char *NAME) {
   printf("  %s: prep host-spectra storage for MARZ \n\n", fnam );
   fflush(stdout);
 
-  MARZ_SPECDATA.NSPEC     = 0;
-  MARZ_SPECDATA.NBIN_WAVE = 0;
+  MARZ_SPECDATA.NSPEC       = 0;
+  MARZ_SPECDATA.NSPEC_WRITE = 0;
+  MARZ_SPECDATA.NSPEC_CHUNK = 0;
+  MARZ_SPECDATA.NBIN_WAVE   = 0;
+
+  MARZ_SPECDATA.BSCALE_FLAM    = MARZ_SPECDATA.BZERO_FLAM    = 0.0 ;
+  MARZ_SPECDATA.BSCALE_VARFLAM = MARZ_SPECDATA.BZERO_VARFLAM = 0.0 ;
 
-  // malloc EVT dimension here; for each event, malloc 
-  // WAVE dimension in SPECPAK_FILL_MARZ
-  int MEMF = MXSPEC_MARZ * sizeof(float*);
+  // malloc chunk-size EVT dimension for fluxes and full EVT
+  // dimension for names; for each chunk slot, malloc WAVE
+  // dimension in SPECPAK_FILL_MARZ
+  int MEMF = NSPEC_CHUNK_MARZ * sizeof(float*);
   int MEMC = MXSPEC_MARZ * sizeof(char*);
   MARZ_SPECDATA.FLAM    = (float**)malloc(MEMF);
   MARZ_SPECDATA.VARFLAM = (float**)malloc(MEMF);
   MARZ_SPECDATA.NAME    = (char**)malloc(MEMC);
 
+  for(ispec=0; ispec < NSPEC_CHUNK_MARZ; ispec++ ) {
+    MARZ_SPECDATA.FLAM[ispec]    = NULL ;
+    MARZ_SPECDATA.VARFLAM[ispec] = NULL ;
+  }
+
   return ;
 
 } // end SNTABLE_CREATE_MARZ
@@ -285,11 +511,13 @@ void SNTABLE_CREATE_MARZ(int IDTABLE, char *NAME) {
 // ====================================
 void SPECPAK_FILL_MARZ(void) {
 
-  // Store all spectra in MARZ_SPECDATA structure.
-  // Everything is written at the end in CLOSE_MARZFILE
-  // becauyse FITS tables must be written sequentially.
+  // Store spectrum in current chunk of MARZ_SPECDATA structure;
+  // when the chunk is full, append it to the output images
+  // (Aug 2026; previously all spectra were held in memory and
+  // written in CLOSE_MARZFILE).
 
   int NSPEC     = MARZ_SPECDATA.NSPEC;
+  int ICHUNK    = MARZ_SPECDATA.NSPEC_CHUNK;
   int NBIN_WAVE = SPECPAK_OUTPUT.NLAMBIN_LIST[0] ;
   int MEMF      = NBIN_WAVE * sizeof(float);
   int MEMC      = MXCHAR_CCID_MARZ*sizeof(char);
@@ -303,20 +531,22 @@ void SPECPAK_FILL_MARZ(void) {
 
   // ------------- BEGIN --------------
 
-  // avoid using too much memory
+  // avoid storing too many names
   if ( NSPEC >= MXSPEC_MARZ ) { return; }
 
-  // allocate memory for this spectrum
-  MARZ_SPECDATA.FLAM[NSPEC]    = (float*)malloc(MEMF);
-  MARZ_SPECDATA.VARFLAM[NSPEC] = (float*)malloc(MEMF);
+  // allocate memory for this spectrum (chunk slots are re-used)
+  if ( MARZ_SPECDATA.FLAM[ICHUNK] == NULL ) {
+    MARZ_SPECDATA.FLAM[ICHUNK]    = (float*)malloc(MEMF);
+    MARZ_SPECDATA.VARFLAM[ICHUNK] = (float*)malloc(MEMF);
+  }
   MARZ_SPECDATA.NAME[NSPEC]    = (char *)malloc(MEMC);
-  if ( NSPEC == 0 ) { 
+  if ( NSPEC == 0 ) {
     MARZ_SPECDATA.NBIN_WAVE = NBIN_WAVE ;
-    MARZ_SPECDATA.WAVE      = (float*)malloc(MEMF); 
+    MARZ_SPECDATA.WAVE      = (float*)malloc(MEMF);
   }
 
-  /*  
-  printf(" xxx %s: NBIN_WAVE=%d  CCID=%s  ID=%d\n", 
+  /*
+  printf(" xxx %s: NBIN_WAVE=%d  CCID=%s  ID=%d\n",
 	 fnam, NBIN_WAVE, CCID, SPECPAK_OUTPUT.ID_LIST[0]);
   */
 
@@ -329,8 +559,8 @@ void SPECPAK_FILL_MARZ(void) {
     FLAMERR  = FLAMSCALE_MARZ * PTR_FLAMERR[iwave];
     VARFLAM  = FLAMERR*FLAMERR;
 
-    MARZ_SPECDATA.FLAM[NSPEC][iwave]    = (float)FLAM;
-    MARZ_SPECDATA.VARFLAM[NSPEC][iwave] = (float)VARFLAM;
+    MARZ_SPECDATA.FLAM[ICHUNK][iwave]    = (float)FLAM;
+    MARZ_SPECDATA.VARFLAM[ICHUNK][iwave] = (float)VARFLAM;
 
     // store wavelength grid on first spectrum
     if ( NSPEC == 0 ) {
@@ -343,14 +573,19 @@ void SPECPAK_FILL_MARZ(void) {
 
   // abort if wavelength binning changes
   if ( MARZ_SPECDATA.NBIN_WAVE != SPECPAK_OUTPUT.NLAMBIN_LIST[0] ) {
-    sprintf(MSGERR1,"Stored NBIN_WAVE=%d for first event ...", 
+    sprintf(MSGERR1,"Stored NBIN_WAVE=%d for first event ...",
 	    MARZ_SPECDATA.NBIN_WAVE);
     sprintf(MSGERR2,"but NBIN(CID=%s) = %d. Cannot change binning.",
-	    CCID, SPECPAK_OUTPUT.NLAMBIN_LIST[0] );      
+	    CCID, SPECPAK_OUTPUT.NLAMBIN_LIST[0] );
     errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
   }
 
   MARZ_SPECDATA.NSPEC++ ;
+  MARZ_SPECDATA.NSPEC_CHUNK++ ;
+
+  // append full chunk to output images
+  if ( MARZ_SPECDATA.NSPEC_CHUNK == NSPEC_CHUNK_MARZ )
+    { wr_marz_flush_chunk(); }
 
   return;
 
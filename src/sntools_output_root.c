@@ -64,6 +64,7 @@
 
 #include "TSystem.h"
 #include "TFileMerger.h"
+#include "RVersion.h"   // Aug 2026: version guard for implicit MT
 
 // ================================
 //             Globals
@@ -709,7 +710,7 @@ int sntable_read_exec_root(int IROW_MIN, int IROW_MAX) {
 
   int    Nfield, Nrow, irow, i, istat, ICAST, OPT ;
   char   LINE[MXCHAR_VARLIST] ;
-  char   valStore[MXVAR_TABLE][40];
+  char   valStore[MXVAR_TABLE][40], ccidLoc[100] ;
   double DVAL, DARRAY[MXVAR_TABLE] ;
 
   long long int IROW_START = IROW_MIN;
@@ -781,16 +782,26 @@ int sntable_read_exec_root(int IROW_MIN, int IROW_MAX) {
     DO_DUMP = 0;
     if ( LDUMP    ) { DO_DUMP = 1; }
     if ( LOUTLIER ) { DO_DUMP = select_outlier_root(DARRAY) ; }
-    
-    if ( DO_DUMP )  { 
-      fprintf(FP_DUMP,"%s\n", LINE ); 
-      fflush(FP_DUMP); 
+
+    // Aug 2026: apply optional dump row-filters (predicate pushdown)
+    if ( DO_DUMP && DUMPFILTER.USEFLAG ) {
+      sprintf(ccidLoc, "%s", valStore[0] );
+      trim_blank_spaces(ccidLoc);
+      if ( !SNTABLE_DUMPFILTER_ROWSEL(ccidLoc,DARRAY) ) { DO_DUMP = 0; }
+    }
+
+    if ( DO_DUMP )  {
+      // Aug 2026: no per-row fflush; rows stream through the stdio
+      // buffer and one flush after the loop keeps dump at disk speed
+      fprintf(FP_DUMP,"%s\n", LINE );
     }
 
     irow++ ;
-    
+
   } // end while loop
 
+  fflush(FP_DUMP);  // Aug 2026: single flush for all dumped rows
+
   TREE_INFO_READ.tree->Delete("");           // Mar 3 2017
   TREE_INFO_READ.SQL_Result->Delete("") ;
 
@@ -1828,11 +1839,20 @@ void MERGE_ROOT(int NFILE, char **INFILES, char *OUTFILE) {
 
   gSystem->Load("libTreePlayer");
 
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,8,0)
+  // Aug 2026: let ROOT read/decompress input baskets in parallel
+  ROOT::EnableImplicitMT();
+#endif
+
   TFileMerger merger(kFALSE,kFALSE);
   //  merger.SetMsgPrefix(fnam);
   merger.SetPrintLevel(1);
- 
-  for(ifile=0; ifile < NFILE; ifile++ ) 
+
+  // Aug 2026: per-core outputs share an identical schema, so copy
+  // baskets raw (no unzip/rezip); merge then runs at disk speed.
+  merger.SetFastMethod(kTRUE);
+
+  for(ifile=0; ifile < NFILE; ifile++ )
     { merger.AddFile( INFILES[ifile] ) ; }
 
 
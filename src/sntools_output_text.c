@@ -58,8 +58,19 @@
 //              in TEXT SPECPLOT table.
 //
 // Jan 4 2021: MXCHAR_LINE -> 3200 (was 2500)
+//
+// Aug 2026: SNTABLE_READ_EXEC_TEXT_MMAP = chunked mmap parser for
+//           plain (non-gz) text tables; see comments above function.
+//
+// Aug 2026: a .gz output file name writes through a gzip pipe
+//           (open_TEXTgz write mode), so FITRES files land
+//           compressed with no serial post-step.
 // **********************************************
 
+#include <pthread.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+
 char FILEPREFIX_TEXT[100];
 
 #define MXTABLE_TEXT 10 
@@ -71,6 +82,7 @@ char FILEPREFIX_TEXT[100];
 #define OPT_FORMAT_CSV   2
 #define OPT_FORMAT_COL   3
 #define OPT_FORMAT_NONE  4  // no ascii output
+#define OPT_FORMAT_BIN   5  // KEY text + binary columnar sidecar (Aug 2026)
 
 #define SUFFIX_TEXT           "TEXT"   
 #define SUFFIX_LCPLOT_TEXT    "LCPLOT.TEXT" 
@@ -86,6 +98,48 @@ FILE *PTRFILE_TEXT ;                   // generic ascii file pointer
 char FILENAME_TEXT[MXCHAR_FILENAME];   // name of opened text file
 int  GZIPFLAG_TEXT;                    // gzipped or not
 
+// Aug 2026: optional binary columnar cache ("sidecar") for reading
+// FITRES-style text tables. Setting env var SNTABLE_BINARY=1 makes
+// SNTABLE_READ_EXEC_TEXT write <file>.BIN on the first read, then
+// later jobs read requested columns directly from the sidecar and
+// skip all per-row string parsing; unrequested columns are never
+// materialized. Cache is ignored (and rewritten) if the text file
+// size changed. Intended for biasCor/CCprior FITRES files that are
+// re-read by hundreds of jobs per systematics run.
+#define MAGIC_SNTABLE_BINARY    0x544E4942   // 'BINT'
+#define VERSION_SNTABLE_BINARY  1
+#define MXCHAR_CELL_BINARY      24  // fixed cell size for string columns
+#define ICOL_BINARY_NUM  1   // column stored as double
+#define ICOL_BINARY_STR  2   // column stored as raw 24-char token
+
+typedef struct {
+  int MAGIC, VERSION, NVAR, NROW ;
+  long long TEXTSIZE ;  // size of text file when cache was written
+} SNTABLE_BINARY_HEADER_DEF ;
+
+struct {
+  bool WRFLAG ;                       // stage columns and write cache
+  char FILENAME[MXCHAR_FILENAME] ;    // name of sidecar file
+  char **STAGE ;          // staged raw tokens per column (WRFLAG only)
+  int  STAGE_MALLOCROWS ; // current staged capacity, rows
+} SNTABLE_BINARY ;
+
+// Aug 2026: chunked mmap reader for plain text tables.
+// File is split at line boundaries into one chunk per thread;
+// each chunk is scanned twice (pass 1 counts rows, pass 2 parses
+// tokens in place with strtod and fills the registered pointers),
+// so every thread writes a disjoint, file-ordered row range.
+#define MXTHREAD_READ_TEXT   8
+#define MINSIZE_THREAD_READ_TEXT  0x4000000LL // 64 MB per extra thread
+
+typedef struct {
+  char      *PTR ;      // first byte of chunk (line-aligned)
+  long long  SIZE ;     // chunk size, bytes
+  int        PASS ;     // 1 => count rows;  2 => parse and fill
+  int        NROW ;     // number of valid rows in chunk
+  int        IROW_OFF ; // global row index of first row (pass 2)
+} READCHUNK_TEXT_DEF ;
+
 FILE *PTRFILE_LCLIST ;  // list-file for LC ascii files
 FILE *PTRFILE_LCPLOT ;      
 FILE *PTRFILE_SPECLIST ; 
@@ -106,6 +160,8 @@ struct TABLEINFO_TEXT {
   char   FILENAME[MXTABLE_TEXT][MXCHAR_FILENAME] ;
   char   FORMAT[MXTABLE_TEXT][12] ;
   int    OPT_FORMAT[MXTABLE_TEXT] ;
+  char   SEP[MXTABLE_TEXT][4] ;   // Aug 2026: cached column separator
+  int    GZIPFLAG[MXTABLE_TEXT] ; // Aug 2026: 1 => gzip pipe (.gz)
 
   int    NVAR[MXTABLE_TEXT];
   char  *VARLIST[MXTABLE_TEXT];
@@ -113,6 +169,11 @@ struct TABLEINFO_TEXT {
 
   int    NFILL[MXTABLE_TEXT] ; // number of SNTABLE_FILL_TEXT calls.
 
+  // Aug 2026: staging for binary columnar sidecar (TEXT_FORMAT='bin')
+  int    WRBIN[MXTABLE_TEXT] ;                // write sidecar at close
+  char **STAGE_BIN[MXTABLE_TEXT] ;            // [ivar] -> packed cells
+  int    STAGE_MALLOCROWS_BIN[MXTABLE_TEXT] ; // staged capacity, rows
+
   int        *ICAST[MXTABLE_TEXT] ;
   double    **ptr_D[MXTABLE_TEXT] ;
   float     **ptr_F[MXTABLE_TEXT] ;
@@ -175,6 +236,26 @@ extern"C" {
   int  SNTABLE_READ_EXEC_TEXT(void);
   void SNTABLE_CLOSE_TEXT(void) ;
 
+  // chunked mmap reader (Aug 2026)
+  int   SNTABLE_READ_EXEC_TEXT_MMAP(void);
+  void *parse_READCHUNK_TEXT(void *arg);
+
+  // streaming dump with row filters (Aug 2026)
+  int   SNTABLE_DUMP_EXEC_TEXT(void);
+  int   dump_textrow(char *ptrRow, char *LINE, double *DARRAY,
+		     char *CCID, int *IVAR2READ );
+
+  // binary columnar cache for reading text tables (Aug 2026)
+  bool      useFlag_SNTABLE_BINARY(void);
+  long long textSize_SNTABLE_BINARY(char *textFile);
+  int       SNTABLE_READ_EXEC_BINARY(void);
+  void      store_cell_SNTABLE_BINARY(int irow, int ivar, char *token);
+  void      write_SNTABLE_BINARY(int NROW);
+
+  // binary columnar sidecar written by TEXT_FORMAT='bin' (Aug 2026)
+  void      store_cell_WRBIN_TEXT(int ITAB, int irow, int ivar, char *token);
+  void      write_WRBIN_TEXT(int ITAB);
+
   int validRowKey_TEXT(char *string) ;
   // xxx mvoed to sntools_output.h  int ICAST_for_textVar(char *varName) ;
 
@@ -288,21 +369,38 @@ void SNTABLE_CREATE_TEXT(int IDTABLE, char *TBNAME, char *TEXT_FORMAT) {
   sprintf(comment,"Called from %s with IDTABLE=%d (%s)", 
 	  fnam, IDTABLE, TBNAME);
   OPT_FORMAT = get_OPT_FORMAT(TEXT_FORMAT,comment);
-  TABLEINFO_TEXT.OPT_FORMAT[NTAB] = OPT_FORMAT ; 
+  TABLEINFO_TEXT.OPT_FORMAT[NTAB] = OPT_FORMAT ;
+
+  // Aug 2026: 'bin' --> write KEY-format text as usual, plus a binary
+  // columnar sidecar at close (see write_WRBIN_TEXT). Readers then
+  // pick up the sidecar via SNTABLE_READ_EXEC_BINARY and skip all
+  // per-row text parsing, with no code change on their side.
+  TABLEINFO_TEXT.WRBIN[NTAB] = 0 ;
+  if ( OPT_FORMAT == OPT_FORMAT_BIN ) {
+    TABLEINFO_TEXT.WRBIN[NTAB] = 1 ;
+    TABLEINFO_TEXT.STAGE_MALLOCROWS_BIN[NTAB] = 0 ;
+    OPT_FORMAT = OPT_FORMAT_KEY ;
+    TABLEINFO_TEXT.OPT_FORMAT[NTAB] = OPT_FORMAT ;
+  }
 
   // if format = 'none', return here after defining this text-table
   // so that it can be skipped in the ADDCOL and FILL functions.
   if ( OPT_FORMAT == OPT_FORMAT_NONE ) { return ; }
 
+  // Aug 2026: resolve column separator once here instead of
+  // per SNTABLE_FILL_TEXT call.
+  get_sepchar(OPT_FORMAT, comment, TABLEINFO_TEXT.SEP[NTAB] );
+
   // init NVAR and VARNAMES list
   TABLEINFO_TEXT.NVAR[NTAB] = 0 ;
 
   // - - - - - - - - - - - -
    // open text file  
   TABLEINFO_TEXT.FP[NTAB] = open_TEXTgz(FILENAME,TEXTMODE_wt, &GZIPFLAG) ;
+  TABLEINFO_TEXT.GZIPFLAG[NTAB] = GZIPFLAG ; // Aug 2026: .gz => gzip pipe
   if ( !TABLEINFO_TEXT.FP[NTAB] ) {
     sprintf(MSGERR1, "Could not open TEXT FILE = ");
-    sprintf(MSGERR2, "%s", FILENAME);    
+    sprintf(MSGERR2, "%s", FILENAME);
     errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
   }
 
@@ -522,10 +620,10 @@ void SNTABLE_FILL_TEXT(int IDTABLE) {
   //
   // Jun 24 2017: ROW[1000] -> ROW[2000]
 
-  int ITAB, NFILL, NVAR, IVAR, ICAST, OPT_FORMAT ;
+  int ITAB, NFILL, NVAR, IVAR, ICAST, OPT_FORMAT, LENROW, LENV ;
 
   FILE *FP ;
-  char ROW[MXCHAR_LINE], CVAL[80], *FORMAT, *VARNAME, sep[4], comment[200] ;
+  char ROW[MXCHAR_LINE], CVAL[80], *FORMAT, *VARNAME, *sep ;
   char fnam[] = "SNTABLE_FILL_TEXT" ;
 
   // ------------- BEGIN ------------
@@ -547,10 +645,9 @@ void SNTABLE_FILL_TEXT(int IDTABLE) {
     
   ROW[0] = 0 ;
   CVAL[0] = 0 ;
+  LENROW  = 0 ;  // Aug 2026: write cursor into ROW (avoids strcat rescans)
 
-  sprintf(comment,"called by %s for IDTABLE=%d and FORMAT='%s'",
-	  fnam, IDTABLE, FORMAT);
-  get_sepchar(OPT_FORMAT, comment, sep) ; // return sep
+  sep = TABLEINFO_TEXT.SEP[ITAB] ; // resolved at CREATE time (Aug 2026)
 
   long long int VAL_L;
   double VAL_D ;
@@ -598,8 +695,22 @@ void SNTABLE_FILL_TEXT(int IDTABLE) {
       trim_blank_spaces(CVAL) ;
     }
 
-    strcat(ROW,CVAL);  
-    if ( IVAR < NVAR-1 ) { strcat(ROW,sep); }
+    // stage value for binary sidecar (TEXT_FORMAT='bin'; Aug 2026)
+    if ( TABLEINFO_TEXT.WRBIN[ITAB] )
+      { store_cell_WRBIN_TEXT(ITAB, NFILL, IVAR, CVAL); }
+
+    // Aug 2026: append at write cursor; strcat(ROW,...) re-scanned
+    // the growing ROW per column, which is quadratic in NVAR.
+    LENV = strlen(CVAL) ;
+    if ( LENROW + LENV + 2 >= MXCHAR_LINE ) {
+      sprintf(MSGERR1, "ROW length exceeds MXCHAR_LINE=%d at IVAR=%d",
+	      MXCHAR_LINE, IVAR );
+      sprintf(MSGERR2, "IDTABLE=%d  FORMAT='%s'", IDTABLE, FORMAT );
+      errmsg(SEV_FATAL, 0, fnam, MSGERR1, MSGERR2);
+    }
+    memcpy(&ROW[LENROW], CVAL, LENV);   LENROW += LENV ;
+    if ( IVAR < NVAR-1 ) { ROW[LENROW] = sep[0];  LENROW++ ; }
+    ROW[LENROW] = 0 ;
 
   } // end of IVAR loop
 
@@ -614,11 +725,13 @@ void SNTABLE_FILL_TEXT(int IDTABLE) {
     fprintf(FP, "%s\n", ROW);
   }
 
-  fflush(FP);
-
   // increment number of FILL calls
   TABLEINFO_TEXT.NFILL[ITAB]++ ;
 
+  // Aug 2026: flush in row batches instead of per row so stdio can
+  // hand full buffers to the backend; file is flushed again at close.
+  if ( TABLEINFO_TEXT.NFILL[ITAB] % 100 == 0 ) { fflush(FP); }
+
 } // end of SNTABLE_FILL_TEXT
 
 // ===============================================================
@@ -635,8 +748,10 @@ int get_OPT_FORMAT(char *FORMAT, char *comment) {
     { return OPT_FORMAT_CSV ; }
   else if ( strcmp_ignoreCase(FORMAT,(char*)"col") == 0 ) 
     { return OPT_FORMAT_COL ; }
-  else if ( strcmp_ignoreCase(FORMAT,(char*)"none") == 0 ) 
+  else if ( strcmp_ignoreCase(FORMAT,(char*)"none") == 0 )
     { return OPT_FORMAT_NONE ; }
+  else if ( strcmp_ignoreCase(FORMAT,(char*)"bin") == 0 )
+    { return OPT_FORMAT_BIN ; }
   else {
     sprintf(MSGERR1, "Invalid TEXT_FORMAT = '%s'", FORMAT);
     sprintf(MSGERR2, "%s", comment);    
@@ -795,8 +910,13 @@ void CLOSE_TEXTFILE(void) {
       FNAM = TABLEINFO_TEXT.FILENAME[itab] ;
       if ( FP != NULL ) {
 	printf("   Close %s \n", FNAM); fflush(stdout);
-	fclose(FP);
+	close_TEXTgz(FP, TABLEINFO_TEXT.GZIPFLAG[itab]); // Aug 2026
       }
+
+      // write binary sidecar after text file is flushed & closed
+      // so that the stored text-file size is final (Aug 2026)
+      if ( TABLEINFO_TEXT.WRBIN[itab] )
+	{ write_WRBIN_TEXT(itab); }
   }
 
   if ( NVAR_LCPLOT ) {
@@ -1149,10 +1269,813 @@ int  SNTABLE_READPREP_TEXT(void) {
 
 } // end of SNTABLE_READPREP_TEXT
 
+// ==============================================
+// ==================================================
+bool useFlag_SNTABLE_BINARY(void) {
+
+  // Created Aug 2026
+  // Return true if binary sidecar cache is enabled via
+  // env var SNTABLE_BINARY=1; also load sidecar file name.
+
+  char *env = getenv("SNTABLE_BINARY");
+  if ( env == NULL            ) { return false ; }
+  if ( strcmp(env,"1") != 0   ) { return false ; }
+
+  sprintf(SNTABLE_BINARY.FILENAME, "%s.BIN", FILENAME_TEXT);
+  return true ;
+
+} // end useFlag_SNTABLE_BINARY
+
+
+// ==================================================
+long long textSize_SNTABLE_BINARY(char *textFile) {
+
+  // return size of *textFile (or its .gz version);
+  // used to detect stale sidecar cache.
+
+  struct stat statbuf ;
+  char gzFile[MXCHAR_FILENAME+4];
+
+  if ( stat(textFile, &statbuf) == 0 )
+    { return (long long)statbuf.st_size ; }
+
+  sprintf(gzFile, "%s.gz", textFile);
+  if ( stat(gzFile, &statbuf) == 0 )
+    { return (long long)statbuf.st_size ; }
+
+  return -1 ;
+
+} // end textSize_SNTABLE_BINARY
+
+
+// ==================================================
+int SNTABLE_READ_EXEC_BINARY(void) {
+
+  // Created Aug 2026
+  // Fill pointers passed to SNTABLE_READPREP_VARDEF by reading
+  // requested columns from the binary sidecar cache; only the
+  // requested columns are read from disk. Returns number of rows,
+  // or 0 if there is no valid cache (caller then parses the text
+  // file and writes the cache).
+
+  SNTABLE_BINARY_HEADER_DEF HEADER ;
+  FILE *fp ;
+  int  NVAR_TOT  = READTABLE_POINTERS.NVAR_TOT ;
+  int  NVAR_READ = READTABLE_POINTERS.NVAR_READ ;
+  int  NROW, NRD, i, ivar, irow, ICAST, nptr, *ICOL_LIST ;
+  long long OFF0, *OFF_LIST ;
+  double   *DCOL ;
+  char     *CCOL, *cell, varName[MXCHAR_VARNAME];
+  char fnam[] = "SNTABLE_READ_EXEC_BINARY" ;
+
+  // ------------ BEGIN -----------
+
+  fp = fopen(SNTABLE_BINARY.FILENAME, "rb");
+  if ( fp == NULL ) { return 0; }
+
+  NRD = fread(&HEADER, sizeof(HEADER), 1, fp);
+
+  if ( NRD != 1                                  ||
+       HEADER.MAGIC    != MAGIC_SNTABLE_BINARY   ||
+       HEADER.VERSION  != VERSION_SNTABLE_BINARY ||
+       HEADER.NVAR     != NVAR_TOT               ||
+       HEADER.TEXTSIZE != textSize_SNTABLE_BINARY(FILENAME_TEXT) ) {
+    printf("\t %s: stale/invalid cache %s --> re-parse text.\n",
+	   fnam, SNTABLE_BINARY.FILENAME); fflush(stdout);
+    fclose(fp);  return 0;
+  }
+
+  NROW = HEADER.NROW ;
+
+  // read varnames and per-column storage flags; bail on any
+  // varname mismatch (e.g., cache from a different catenation)
+  ICOL_LIST = (int      *) malloc( NVAR_TOT * sizeof(int) );
+  OFF_LIST  = (long long*) malloc( NVAR_TOT * sizeof(long long) );
+
+  for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+    NRD = fread(varName, MXCHAR_VARNAME, 1, fp);
+    if ( NRD != 1 ||
+	 strcmp(varName,READTABLE_POINTERS.VARNAME[ivar]) != 0 ) {
+      fclose(fp); free(ICOL_LIST); free(OFF_LIST);  return 0;
+    }
+  }
+  NRD = fread(ICOL_LIST, sizeof(int), NVAR_TOT, fp);
+  if ( NRD != NVAR_TOT )
+    { fclose(fp); free(ICOL_LIST); free(OFF_LIST);  return 0; }
+
+  // compute file offset of each column
+  OFF0 = sizeof(HEADER)
+    + (long long)NVAR_TOT * MXCHAR_VARNAME
+    + (long long)NVAR_TOT * sizeof(int) ;
+  for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+    OFF_LIST[ivar] = OFF0 ;
+    if ( ICOL_LIST[ivar] == ICOL_BINARY_NUM )
+      { OFF0 += (long long)NROW * sizeof(double); }
+    else
+      { OFF0 += (long long)NROW * MXCHAR_CELL_BINARY; }
+  }
+
+  // pre-check: a column requested as string must be stored as
+  // string; else fall back to text parsing (do not fill anything)
+  for(i=0; i < NVAR_READ; i++ ) {
+    ivar  = READTABLE_POINTERS.PTRINDEX[i] ;
+    ICAST = READTABLE_POINTERS.ICAST_STORE[ivar] ;
+    if ( ICAST == ICAST_C && ICOL_LIST[ivar] != ICOL_BINARY_STR )
+      { fclose(fp); free(ICOL_LIST); free(OFF_LIST);  return 0; }
+  }
+
+  printf("\t %s: read %d rows from %s \n",
+	 fnam, NROW, SNTABLE_BINARY.FILENAME); fflush(stdout);
+
+  DCOL = (double*) malloc( NROW * sizeof(double) );
+  CCOL = (char  *) malloc( NROW * MXCHAR_CELL_BINARY );
+
+  for(i=0; i < NVAR_READ; i++ ) {
+
+    ivar  = READTABLE_POINTERS.PTRINDEX[i] ;
+    ICAST = READTABLE_POINTERS.ICAST_STORE[ivar] ;
+    fseek(fp, OFF_LIST[ivar], SEEK_SET);
+
+    if ( ICOL_LIST[ivar] == ICOL_BINARY_NUM )
+      { NRD = fread(DCOL, sizeof(double), NROW, fp); }
+    else {
+      NRD = fread(CCOL, MXCHAR_CELL_BINARY, NROW, fp);
+      // string-stored column with numeric cast (rare): parse cells
+      if ( ICAST != ICAST_C ) {
+	for(irow=0; irow < NROW; irow++ )
+	  { DCOL[irow] = atof(&CCOL[irow*MXCHAR_CELL_BINARY]); }
+      }
+    }
+
+    for(nptr=0; nptr < READTABLE_POINTERS.NPTR[ivar]; nptr++ ) {
+      for(irow=0; irow < NROW; irow++ ) {
+	if ( ICAST == ICAST_D )
+	  { READTABLE_POINTERS.PTRVAL_D[nptr][ivar][irow] =
+	      DCOL[irow]; }
+	else if ( ICAST == ICAST_F )
+	  { READTABLE_POINTERS.PTRVAL_F[nptr][ivar][irow] =
+	      (float)DCOL[irow]; }
+	else if ( ICAST == ICAST_I )
+	  { READTABLE_POINTERS.PTRVAL_I[nptr][ivar][irow] =
+	      (int)DCOL[irow]; }
+	else if ( ICAST == ICAST_S )
+	  { READTABLE_POINTERS.PTRVAL_S[nptr][ivar][irow] =
+	      (short int)DCOL[irow]; }
+	else if ( ICAST == ICAST_L )
+	  { READTABLE_POINTERS.PTRVAL_L[nptr][ivar][irow] =
+	      (long long int)DCOL[irow]; }
+	else if ( ICAST == ICAST_C ) {
+	  cell = &CCOL[irow*MXCHAR_CELL_BINARY] ;
+	  sprintf(READTABLE_POINTERS.PTRVAL_C[nptr][ivar][irow],
+		  "%s", cell);
+	}
+      }
+    } // end nptr loop
+
+  } // end i loop over read-list
+
+  free(DCOL);  free(CCOL);  free(ICOL_LIST);  free(OFF_LIST);
+  fclose(fp);
+
+  return NROW ;
+
+} // end SNTABLE_READ_EXEC_BINARY
+
+
+// ==================================================
+void store_cell_SNTABLE_BINARY(int irow, int ivar, char *token) {
+
+  // stage raw *token for row/column of sidecar cache;
+  // disable cache-write if token exceeds fixed cell size.
+
+#define MALLOCROWS_SNTABLE_BINARY 50000
+
+  int  NVAR_TOT = READTABLE_POINTERS.NVAR_TOT ;
+  int  NROW_OLD, NROW_NEW, len, i ;
+  char *cell ;
+  char fnam[] = "store_cell_SNTABLE_BINARY" ;
+
+  // ------------ BEGIN -----------
+
+  // grow staged columns as needed (tokens are zero-padded so
+  // that short rows leave empty cells)
+  if ( irow >= SNTABLE_BINARY.STAGE_MALLOCROWS ) {
+    NROW_OLD = SNTABLE_BINARY.STAGE_MALLOCROWS ;
+    NROW_NEW = NROW_OLD + MALLOCROWS_SNTABLE_BINARY ;
+    if ( NROW_OLD == 0 )
+      { SNTABLE_BINARY.STAGE = (char**)malloc(NVAR_TOT*sizeof(char*)); }
+    for(i=0; i < NVAR_TOT; i++ ) {
+      if ( NROW_OLD == 0 ) { SNTABLE_BINARY.STAGE[i] = NULL; }
+      SNTABLE_BINARY.STAGE[i] = (char*)
+	realloc(SNTABLE_BINARY.STAGE[i], NROW_NEW*MXCHAR_CELL_BINARY);
+      memset( &SNTABLE_BINARY.STAGE[i][NROW_OLD*MXCHAR_CELL_BINARY],
+	      0, MALLOCROWS_SNTABLE_BINARY*MXCHAR_CELL_BINARY );
+    }
+    SNTABLE_BINARY.STAGE_MALLOCROWS = NROW_NEW ;
+  }
+
+  // strip line-end left by fgets+strtok on last column
+  len = strlen(token);
+  while ( len > 0 &&
+	  (token[len-1]=='\n' || token[len-1]=='\r') )
+    { token[len-1] = 0;  len-- ; }
+
+  if ( len >= MXCHAR_CELL_BINARY ) {
+    printf("\t %s: token '%s' too long --> skip cache-write.\n",
+	   fnam, token); fflush(stdout);
+    for(i=0; i < NVAR_TOT; i++ ) { free(SNTABLE_BINARY.STAGE[i]); }
+    free(SNTABLE_BINARY.STAGE);
+    SNTABLE_BINARY.STAGE_MALLOCROWS = 0 ;
+    SNTABLE_BINARY.WRFLAG = false ;
+    return ;
+  }
+
+  cell = &SNTABLE_BINARY.STAGE[ivar][irow*MXCHAR_CELL_BINARY] ;
+  memcpy(cell, token, len+1);
+
+  return ;
+
+} // end store_cell_SNTABLE_BINARY
+
+
+// ==================================================
+void write_SNTABLE_BINARY(int NROW) {
+
+  // Created Aug 2026
+  // Classify each staged column as numeric or string, then write
+  // binary sidecar cache: header, varnames, column flags, and
+  // column-major data. Write to a temp file and rename so that
+  // concurrent jobs reading the same table never see a partial
+  // cache. Staged memory is freed here.
+
+  SNTABLE_BINARY_HEADER_DEF HEADER ;
+  FILE *fp ;
+  int  NVAR_TOT = READTABLE_POINTERS.NVAR_TOT ;
+  int  ivar, irow, *ICOL_LIST ;
+  double *DCOL ;
+  char   *cell, *endptr, tmpFile[MXCHAR_FILENAME+20];
+  char fnam[] = "write_SNTABLE_BINARY" ;
+
+  // ------------ BEGIN -----------
+
+  ICOL_LIST = (int   *) malloc( NVAR_TOT * sizeof(int) );
+  DCOL      = (double*) malloc( NROW * sizeof(double) );
+
+  // classify columns; first column (row ID) always stays a string
+  // so that CIDs keep their exact text representation
+  for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+    ICOL_LIST[ivar] = ( ivar == 0 ) ? ICOL_BINARY_STR : ICOL_BINARY_NUM;
+    for(irow=0; irow < NROW && ICOL_LIST[ivar]==ICOL_BINARY_NUM;
+	irow++ ) {
+      cell = &SNTABLE_BINARY.STAGE[ivar][irow*MXCHAR_CELL_BINARY] ;
+      strtod(cell, &endptr);
+      if ( endptr == cell || *endptr != 0 )
+	{ ICOL_LIST[ivar] = ICOL_BINARY_STR ; }
+    }
+  }
+
+  sprintf(tmpFile, "%s_tmp%d", SNTABLE_BINARY.FILENAME, getpid() );
+  fp = fopen(tmpFile, "wb");
+  if ( fp == NULL ) {
+    printf("\t %s: cannot create %s --> skip cache.\n",
+	   fnam, tmpFile);  fflush(stdout);
+    goto FREE_STAGE ;
+  }
+
+  HEADER.MAGIC    = MAGIC_SNTABLE_BINARY ;
+  HEADER.VERSION  = VERSION_SNTABLE_BINARY ;
+  HEADER.NVAR     = NVAR_TOT ;
+  HEADER.NROW     = NROW ;
+  HEADER.TEXTSIZE = textSize_SNTABLE_BINARY(FILENAME_TEXT);
+  fwrite(&HEADER, sizeof(HEADER), 1, fp);
+
+  for(ivar=0; ivar < NVAR_TOT; ivar++ )
+    { fwrite(READTABLE_POINTERS.VARNAME[ivar], MXCHAR_VARNAME, 1, fp); }
+  fwrite(ICOL_LIST, sizeof(int), NVAR_TOT, fp);
+
+  for(ivar=0; ivar < NVAR_TOT; ivar++ ) {
+    if ( ICOL_LIST[ivar] == ICOL_BINARY_NUM ) {
+      for(irow=0; irow < NROW; irow++ ) {
+	cell = &SNTABLE_BINARY.STAGE[ivar][irow*MXCHAR_CELL_BINARY] ;
+	DCOL[irow] = atof(cell);
+      }
+      fwrite(DCOL, sizeof(double), NROW, fp);
+    }
+    else {
+      fwrite(SNTABLE_BINARY.STAGE[ivar],
+	     MXCHAR_CELL_BINARY, NROW, fp);
+    }
+  }
+
+  fclose(fp);
+  rename(tmpFile, SNTABLE_BINARY.FILENAME);
+
+  printf("\t %s: wrote %d rows to %s \n",
+	 fnam, NROW, SNTABLE_BINARY.FILENAME); fflush(stdout);
+
+ FREE_STAGE:
+  for(ivar=0; ivar < NVAR_TOT; ivar++ )
+    { free(SNTABLE_BINARY.STAGE[ivar]); }
+  free(SNTABLE_BINARY.STAGE);
+  SNTABLE_BINARY.STAGE_MALLOCROWS = 0 ;
+  free(ICOL_LIST);  free(DCOL);
+
+  return ;
+
+} // end write_SNTABLE_BINARY
+
+
+// ==================================================
+void store_cell_WRBIN_TEXT(int ITAB, int irow, int ivar, char *token) {
+
+  // Created Aug 2026
+  // Stage formatted *token for the binary sidecar of text-table
+  // ITAB (TEXT_FORMAT='bin'); write-path analog of
+  // store_cell_SNTABLE_BINARY. Disable the sidecar for this table
+  // if a token exceeds the fixed cell size.
+
+  int  NVAR = TABLEINFO_TEXT.NVAR[ITAB] ;
+  int  NROW_OLD, NROW_NEW, len, i ;
+  char *cell ;
+  char fnam[] = "store_cell_WRBIN_TEXT" ;
+
+  // ------------ BEGIN -----------
+
+  if ( irow >= TABLEINFO_TEXT.STAGE_MALLOCROWS_BIN[ITAB] ) {
+    NROW_OLD = TABLEINFO_TEXT.STAGE_MALLOCROWS_BIN[ITAB] ;
+    NROW_NEW = NROW_OLD + MALLOCROWS_SNTABLE_BINARY ;
+    if ( NROW_OLD == 0 )
+      { TABLEINFO_TEXT.STAGE_BIN[ITAB] =
+	  (char**)malloc(NVAR*sizeof(char*)); }
+    for(i=0; i < NVAR; i++ ) {
+      if ( NROW_OLD == 0 ) { TABLEINFO_TEXT.STAGE_BIN[ITAB][i] = NULL; }
+      TABLEINFO_TEXT.STAGE_BIN[ITAB][i] = (char*)
+	realloc(TABLEINFO_TEXT.STAGE_BIN[ITAB][i],
+		NROW_NEW*MXCHAR_CELL_BINARY);
+      memset( &TABLEINFO_TEXT.STAGE_BIN[ITAB][i][NROW_OLD*MXCHAR_CELL_BINARY],
+	      0, MALLOCROWS_SNTABLE_BINARY*MXCHAR_CELL_BINARY );
+    }
+    TABLEINFO_TEXT.STAGE_MALLOCROWS_BIN[ITAB] = NROW_NEW ;
+  }
+
+  len = strlen(token);
+  if ( len >= MXCHAR_CELL_BINARY ) {
+    printf("\t %s: token '%s' too long --> skip sidecar for %s.\n",
+	   fnam, token, TABLEINFO_TEXT.TBNAME[ITAB] ); fflush(stdout);
+    for(i=0; i < NVAR; i++ ) { free(TABLEINFO_TEXT.STAGE_BIN[ITAB][i]); }
+    free(TABLEINFO_TEXT.STAGE_BIN[ITAB]);
+    TABLEINFO_TEXT.STAGE_MALLOCROWS_BIN[ITAB] = 0 ;
+    TABLEINFO_TEXT.WRBIN[ITAB] = 0 ;
+    return ;
+  }
+
+  cell = &TABLEINFO_TEXT.STAGE_BIN[ITAB][ivar][irow*MXCHAR_CELL_BINARY] ;
+  memcpy(cell, token, len+1);
+
+  return ;
+
+} // end store_cell_WRBIN_TEXT
+
+
+// ==================================================
+void write_WRBIN_TEXT(int ITAB) {
+
+  // Created Aug 2026
+  // Write binary columnar sidecar <textFile>.BIN for text-table
+  // ITAB created with TEXT_FORMAT='bin'. Same on-disk format as
+  // write_SNTABLE_BINARY, but columns are typed from the stored
+  // ICAST instead of re-parsing tokens: string-cast columns (and
+  // the row-ID column, to preserve exact CIDs) stay raw tokens,
+  // everything else is stored as double. Call after the text file
+  // is closed so that the stored text size is final.
+
+  SNTABLE_BINARY_HEADER_DEF HEADER ;
+  FILE *fp ;
+  int  NVAR = TABLEINFO_TEXT.NVAR[ITAB] ;
+  int  NROW = TABLEINFO_TEXT.NFILL[ITAB] ;
+  int  ivar, irow, ICAST, *ICOL_LIST ;
+  double *DCOL ;
+  char   *cell, padName[MXCHAR_VARNAME];
+  char    binFile[MXCHAR_FILENAME+4], tmpFile[MXCHAR_FILENAME+24];
+  char fnam[] = "write_WRBIN_TEXT" ;
+
+  // ------------ BEGIN -----------
+
+  if ( NROW == 0 || TABLEINFO_TEXT.STAGE_MALLOCROWS_BIN[ITAB] == 0 )
+    { return ; }
+
+  ICOL_LIST = (int   *) malloc( NVAR * sizeof(int) );
+  DCOL      = (double*) malloc( NROW * sizeof(double) );
+
+  for(ivar=0; ivar < NVAR; ivar++ ) {
+    ICAST = TABLEINFO_TEXT.ICAST[ITAB][ivar] ;
+    if ( ivar == 0 || ICAST == ICAST_C )
+      { ICOL_LIST[ivar] = ICOL_BINARY_STR ; }
+    else
+      { ICOL_LIST[ivar] = ICOL_BINARY_NUM ; }
+  }
+
+  sprintf(binFile, "%s.BIN", TABLEINFO_TEXT.FILENAME[ITAB] );
+  sprintf(tmpFile, "%s_tmp%d", binFile, getpid() );
+  fp = fopen(tmpFile, "wb");
+  if ( fp == NULL ) {
+    printf("\t %s: cannot create %s --> skip sidecar.\n",
+	   fnam, tmpFile);  fflush(stdout);
+    goto FREE_STAGE ;
+  }
+
+  HEADER.MAGIC    = MAGIC_SNTABLE_BINARY ;
+  HEADER.VERSION  = VERSION_SNTABLE_BINARY ;
+  HEADER.NVAR     = NVAR ;
+  HEADER.NROW     = NROW ;
+  HEADER.TEXTSIZE = textSize_SNTABLE_BINARY(TABLEINFO_TEXT.FILENAME[ITAB]);
+  fwrite(&HEADER, sizeof(HEADER), 1, fp);
+
+  for(ivar=0; ivar < NVAR; ivar++ ) {
+    memset(padName, 0, MXCHAR_VARNAME);
+    strncpy(padName, TABLEINFO_TEXT.VARNAME[ITAB][ivar], MXCHAR_VARNAME-1);
+    fwrite(padName, MXCHAR_VARNAME, 1, fp);
+  }
+  fwrite(ICOL_LIST, sizeof(int), NVAR, fp);
+
+  for(ivar=0; ivar < NVAR; ivar++ ) {
+    if ( ICOL_LIST[ivar] == ICOL_BINARY_NUM ) {
+      for(irow=0; irow < NROW; irow++ ) {
+	cell = &TABLEINFO_TEXT.STAGE_BIN[ITAB][ivar][irow*MXCHAR_CELL_BINARY];
+	DCOL[irow] = atof(cell);
+      }
+      fwrite(DCOL, sizeof(double), NROW, fp);
+    }
+    else {
+      fwrite(TABLEINFO_TEXT.STAGE_BIN[ITAB][ivar],
+	     MXCHAR_CELL_BINARY, NROW, fp);
+    }
+  }
+
+  fclose(fp);
+  rename(tmpFile, binFile);
+
+  printf("\t %s: wrote %d rows to %s \n",
+	 fnam, NROW, binFile); fflush(stdout);
+
+ FREE_STAGE:
+  for(ivar=0; ivar < NVAR; ivar++ )
+    { free(TABLEINFO_TEXT.STAGE_BIN[ITAB][ivar]); }
+  free(TABLEINFO_TEXT.STAGE_BIN[ITAB]);
+  TABLEINFO_TEXT.STAGE_MALLOCROWS_BIN[ITAB] = 0 ;
+  free(ICOL_LIST);  free(DCOL);
+
+  return ;
+
+} // end write_WRBIN_TEXT
+
+
+void *parse_READCHUNK_TEXT(void *arg) {
+
+  // Created Aug 2026
+  // Thread worker for SNTABLE_READ_EXEC_TEXT_MMAP.
+  // Scan chunk line by line; on PASS=1 just count valid row keys;
+  // on PASS=2 tokenize each row in place and fill the registered
+  // READTABLE_POINTERS at global row index IROW_OFF + local count.
+  // Tokens live in the read-only map, so numeric cells are converted
+  // with strtod (stops at whitespace; no copy, no NUL needed) and
+  // only string cells are copied out.
+
+  READCHUNK_TEXT_DEF *CHUNK = (READCHUNK_TEXT_DEF*)arg ;
+
+  char *p    = CHUNK->PTR ;
+  char *pend = CHUNK->PTR + CHUNK->SIZE ;
+  char *eol, *tok, key[60];
+  int   NROW_LOCAL = 0 ;
+  int   NVAR_TOT   = READTABLE_POINTERS.NVAR_TOT ;
+  int   ivar, nptr, ICAST, isn, lentok ;
+  double DVAL ;
+
+  // ------------ BEGIN -----------
+
+  while ( p < pend ) {
+
+    eol = (char*)memchr(p, '\n', pend - p);
+    if ( eol == NULL ) { eol = pend ; }
+
+    // locate first token on line
+    while ( p < eol && ( *p==' ' || *p=='\t' || *p=='\r' ) ) { p++ ; }
+    if ( p >= eol || *p == '#' ) { p = eol+1 ; continue ; }
+
+    tok = p ;
+    while ( p < eol && *p!=' ' && *p!='\t' && *p!='\r' ) { p++ ; }
+    lentok = (int)(p - tok);
+    if ( lentok > 59 ) { lentok = 59 ; }
+    memcpy(key, tok, lentok);   key[lentok] = 0 ;
+    if ( validRowKey_TEXT(key) == 0 ) { p = eol+1 ; continue ; }
+
+    if ( CHUNK->PASS == 1 ) { NROW_LOCAL++ ; p = eol+1 ; continue ; }
+
+    isn = CHUNK->IROW_OFF + NROW_LOCAL ;    NROW_LOCAL++ ;
+
+    for ( ivar=0; ivar < NVAR_TOT; ivar++ ) {
+
+      while ( p < eol && ( *p==' ' || *p=='\t' || *p=='\r' ) ) { p++ ; }
+      if ( p >= eol ) { break ; }
+      tok = p ;
+      while ( p < eol && *p!=' ' && *p!='\t' && *p!='\r' ) { p++ ; }
+
+      // extract only variables on READ-list
+      if ( READTABLE_POINTERS.NPTR[ivar] == 0 ) { continue ; }
+
+      ICAST = READTABLE_POINTERS.ICAST_STORE[ivar] ;
+      DVAL  = 0.0 ;
+      if ( ICAST != ICAST_C ) { DVAL = strtod(tok, NULL); }
+
+      for ( nptr=0; nptr < READTABLE_POINTERS.NPTR[ivar]; nptr++ ) {
+	if ( ICAST == ICAST_D )
+	  { READTABLE_POINTERS.PTRVAL_D[nptr][ivar][isn] = DVAL ; }
+	else if ( ICAST == ICAST_F )
+	  { READTABLE_POINTERS.PTRVAL_F[nptr][ivar][isn] = (float)DVAL ; }
+	else if ( ICAST == ICAST_I )
+	  { READTABLE_POINTERS.PTRVAL_I[nptr][ivar][isn] = (int)DVAL ; }
+	else if ( ICAST == ICAST_S )
+	  { READTABLE_POINTERS.PTRVAL_S[nptr][ivar][isn] =
+	      (short int)DVAL ; }
+	else if ( ICAST == ICAST_L )
+	  { READTABLE_POINTERS.PTRVAL_L[nptr][ivar][isn] =
+	      (long long int)DVAL ; }
+	else if ( ICAST == ICAST_C ) {
+	  lentok = (int)(p - tok);
+	  if ( lentok > 59 ) { lentok = 59 ; }
+	  memcpy(READTABLE_POINTERS.PTRVAL_C[nptr][ivar][isn],
+		 tok, lentok);
+	  READTABLE_POINTERS.PTRVAL_C[nptr][ivar][isn][lentok] = 0 ;
+	}
+      } // end nptr loop
+
+    } // end ivar loop
+
+    p = eol + 1 ;
+
+  } // end while over chunk
+
+  CHUNK->NROW = NROW_LOCAL ;
+  return NULL ;
+
+} // end parse_READCHUNK_TEXT
+
+
+// ==============================================
+int SNTABLE_READ_EXEC_TEXT_MMAP(void) {
+
+  // Created Aug 2026
+  // Fast reader for plain (non-gz) text tables: mmap the file,
+  // split it at line boundaries into per-thread chunks, and parse
+  // tokens in place (see parse_READCHUNK_TEXT). Avoids the per-cell
+  // sprintf/sscanf of the fgets loop in SNTABLE_READ_EXEC_TEXT and
+  // uses up to MXTHREAD_READ_TEXT threads for multi-GB FITRES files
+  // (1 extra thread per MINSIZE_THREAD_READ_TEXT bytes; override
+  // with env var SNTABLE_READ_NTHREAD).
+  //
+  // Returns number of rows read, or -1 so that the caller falls
+  // back to the fgets parser (e.g., mmap failure).
+
+  READCHUNK_TEXT_DEF CHUNK[MXTHREAD_READ_TEXT] ;
+  pthread_t          thread[MXTHREAD_READ_TEXT] ;
+  struct stat statbuf ;
+  char  *BUF, *env, *p ;
+  long long FILESIZE, OFF0, OFF1 ;
+  int   fd, it, PASS, NTHREAD, NROW=0 ;
+  char fnam[] = "SNTABLE_READ_EXEC_TEXT_MMAP" ;
+
+  // ------------ BEGIN -----------
+
+  fd = open(FILENAME_TEXT, O_RDONLY);
+  if ( fd < 0 ) { return(-1); }
+
+  if ( fstat(fd, &statbuf) != 0 || statbuf.st_size == 0 )
+    { close(fd);  return(-1); }
+  FILESIZE = (long long)statbuf.st_size ;
+
+  BUF = (char*)mmap(NULL, (size_t)FILESIZE, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if ( BUF == MAP_FAILED ) { return(-1); }
+
+  // pick number of threads from file size; allow env override
+  NTHREAD = 1 + (int)( FILESIZE / MINSIZE_THREAD_READ_TEXT );
+  if ( NTHREAD > MXTHREAD_READ_TEXT ) { NTHREAD = MXTHREAD_READ_TEXT; }
+  env = getenv("SNTABLE_READ_NTHREAD");
+  if ( env != NULL ) {
+    sscanf(env, "%d", &NTHREAD);
+    if ( NTHREAD < 1                  ) { NTHREAD = 1 ; }
+    if ( NTHREAD > MXTHREAD_READ_TEXT ) { NTHREAD = MXTHREAD_READ_TEXT; }
+  }
+
+  // split file at line boundaries into NTHREAD chunks
+  OFF0 = 0 ;
+  for ( it=0; it < NTHREAD; it++ ) {
+    OFF1 = ( FILESIZE * (long long)(it+1) ) / (long long)NTHREAD ;
+    if ( it < NTHREAD-1 ) {
+      p = (char*)memchr(&BUF[OFF1], '\n', FILESIZE - OFF1);
+      if ( p != NULL ) { OFF1 = (long long)(p - BUF) + 1 ; }
+      else             { OFF1 = FILESIZE ; }
+    }
+    else
+      { OFF1 = FILESIZE ; }
+
+    CHUNK[it].PTR  = &BUF[OFF0] ;
+    CHUNK[it].SIZE = OFF1 - OFF0 ;
+    CHUNK[it].NROW = 0 ;
+    OFF0 = OFF1 ;
+  }
+
+  printf("\t Read table with chunked parser: "
+	 "%lld MB, %d thread(s) \n",
+	 FILESIZE/1000000, NTHREAD ); fflush(stdout);
+
+  // PASS 1 counts rows per chunk so that PASS 2 can fill each
+  // chunk's rows at the correct global (file-ordered) indices.
+  for ( PASS=1; PASS <= 2; PASS++ ) {
+
+    NROW = 0 ;
+    for ( it=0; it < NTHREAD; it++ ) {
+      CHUNK[it].PASS     = PASS ;
+      CHUNK[it].IROW_OFF = NROW ;      // prefix sum from PASS 1
+      NROW += CHUNK[it].NROW ;
+    }
+
+    if ( NTHREAD == 1 )
+      { parse_READCHUNK_TEXT( (void*)&CHUNK[0] ); }
+    else {
+      for ( it=0; it < NTHREAD; it++ ) {
+	pthread_create(&thread[it], NULL,
+		       parse_READCHUNK_TEXT, (void*)&CHUNK[it] );
+      }
+      for ( it=0; it < NTHREAD; it++ )
+	{ pthread_join(thread[it], NULL); }
+    }
+
+  } // end PASS loop
+
+  NROW = 0 ;
+  for ( it=0; it < NTHREAD; it++ ) { NROW += CHUNK[it].NROW ; }
+
+  munmap(BUF, (size_t)FILESIZE);
+
+  printf("\t Read %d table rows. \n", NROW); fflush(stdout);
+
+  return(NROW);
+
+} // end SNTABLE_READ_EXEC_TEXT_MMAP
+
+
+// ==================================================
+int dump_textrow(char *ptrRow, char *OUTLINE, double *DARRAY,
+		 char *CCID, int *IVAR2READ ) {
+
+  // Created Aug 2026
+  // Parse one text-table row (mutable copy in *ptrRow) for the
+  // streaming dump. Returns 1 and loads outputs if the line starts
+  // with a valid row key; returns 0 otherwise.
+  //   OUTLINE  : LINEKEY + read-list tokens in read-list order
+  //              (raw tokens -> full precision preserved)
+  //   DARRAY   : numeric value vs. read-list index (for cut filters)
+  //   CCID     : token of first read-list variable (row id)
+  //   IVAR2READ: map of absolute ivar --> read-list index, or -9
+
+  int  NVAR_TOT  = READTABLE_POINTERS.NVAR_TOT ;
+  int  NVAR_READ = READTABLE_POINTERS.NVAR_READ ;
+  int  ADDSEPKEY = ( strlen(READTABLE_POINTERS.SEPKEY_DUMP) > 0 );
+  int  ivar, iread, NWR=0 ;
+  char *ptrtok, *tokList[MXVAR_TABLE] ;
+
+  // ------------ BEGIN -----------
+
+  ptrtok = strtok(ptrRow," \t\r\n");
+  if ( ptrtok == NULL )                { return 0; }
+  if ( validRowKey_TEXT(ptrtok) == 0 ) { return 0; }
+
+  for(iread=0; iread < NVAR_READ; iread++ ) { tokList[iread] = NULL; }
+
+  ptrtok = strtok(NULL," \t\r\n");   ivar = 0 ;
+  while ( ptrtok != NULL && ivar < NVAR_TOT ) {
+    iread = IVAR2READ[ivar] ;
+    if ( iread >= 0 ) {
+      tokList[iread] = ptrtok ;
+      if ( READTABLE_POINTERS.ICAST_STORE[ivar] != ICAST_C )
+	{ DARRAY[iread] = atof(ptrtok); }
+    }
+    ptrtok = strtok(NULL," \t\r\n");
+    ivar++ ;
+  }
+
+  sprintf(OUTLINE,"%s", READTABLE_POINTERS.LINEKEY_DUMP );
+  CCID[0] = 0 ;
+
+  for(iread=0; iread < NVAR_READ; iread++ ) {
+    ptrtok = tokList[iread] ;
+    if ( ptrtok == NULL ) { continue ; }
+    if ( iread == 0 )     { sprintf(CCID, "%s", ptrtok); }
+    strcat(OUTLINE," ");  strcat(OUTLINE,ptrtok);
+    NWR++ ;
+    if ( ADDSEPKEY && NWR < NVAR_READ )
+      { strcat(OUTLINE, READTABLE_POINTERS.SEPKEY_DUMP); }
+  }
+
+  return 1;
+
+} // end dump_textrow
+
+
+// ==================================================
+int SNTABLE_DUMP_EXEC_TEXT(void) {
+
+  // Created Aug 2026
+  // Streaming dump for text tables (sntable_dump): write each
+  // selected row directly to READTABLE_POINTERS.FP_DUMP instead of
+  // materializing table columns, so memory stays flat regardless of
+  // table size. Row filters (see DUMPFILTER in sntools_output.h)
+  // are applied before a row is written. Plain files are scanned
+  // through a read-only mmap; gzipped input falls back to the fgets
+  // loop on PTRFILE_TEXT. Returns number of valid table rows.
+
+  FILE *FP_DUMP = READTABLE_POINTERS.FP_DUMP ;
+  struct stat statbuf ;
+  long long FILESIZE ;
+  int    IVAR2READ[MXVAR_TABLE];
+  double DARRAY[MXVAR_TABLE];
+  char   LINEBUF[MXCHAR_LINE], OUTLINE[MXCHAR_LINE], CCID[100];
+  char  *BUF, *p, *pend, *eol ;
+  int    i, ivar, fd, len, NROW=0 ;
+  bool   DO_DUMP ;
+  //  char fnam[] = "SNTABLE_DUMP_EXEC_TEXT" ;
+
+  // ------------ BEGIN -----------
+
+  // build map: absolute ivar --> read-list index
+  for(ivar=0; ivar < MXVAR_TABLE; ivar++ ) { IVAR2READ[ivar] = -9; }
+  for(i=0; i < READTABLE_POINTERS.NVAR_READ; i++ )
+    { IVAR2READ[ READTABLE_POINTERS.PTRINDEX[i] ] = i ; }
+
+  printf("\t Stream-dump table rows (flat memory). \n");
+  fflush(stdout);
+
+  fd = -1 ;
+  if ( GZIPFLAG_TEXT == 0 ) { fd = open(FILENAME_TEXT, O_RDONLY); }
+  if ( fd >= 0 ) {
+    if ( fstat(fd,&statbuf) != 0 || statbuf.st_size == 0 )
+      { close(fd);  fd = -1 ; }
+  }
+
+  if ( fd >= 0 ) {
+
+    // scan read-only map line by line
+    FILESIZE = (long long)statbuf.st_size ;
+    BUF = (char*)mmap(NULL, (size_t)FILESIZE, PROT_READ, MAP_PRIVATE,
+		      fd, 0 );
+    close(fd);
+
+    if ( BUF != MAP_FAILED ) {
+      p = BUF ;  pend = BUF + FILESIZE ;
+      while ( p < pend ) {
+	eol = (char*)memchr(p, '\n', pend - p);
+	if ( eol == NULL ) { eol = pend ; }
+	len = (int)(eol - p);
+	if ( len > MXCHAR_LINE-1 ) { len = MXCHAR_LINE-1 ; }
+	memcpy(LINEBUF, p, len);   LINEBUF[len] = 0 ;
+
+	if ( dump_textrow(LINEBUF,OUTLINE,DARRAY,CCID,IVAR2READ) ) {
+	  NROW++ ;
+	  DO_DUMP = true ;
+	  if ( DUMPFILTER.USEFLAG )
+	    { DO_DUMP = SNTABLE_DUMPFILTER_ROWSEL(CCID,DARRAY); }
+	  if ( DO_DUMP )  { fprintf(FP_DUMP,"%s\n", OUTLINE); }
+	}
+	p = eol + 1 ;
+      }
+      munmap(BUF, (size_t)FILESIZE);
+      fflush(FP_DUMP);
+      return(NROW);
+    }
+  }
+
+  // fgets fallback: gzipped input or mmap failure
+  while ( fgets(LINEBUF, MXCHAR_LINE, PTRFILE_TEXT) != NULL ) {
+    if ( dump_textrow(LINEBUF,OUTLINE,DARRAY,CCID,IVAR2READ) ) {
+      NROW++ ;
+      DO_DUMP = true ;
+      if ( DUMPFILTER.USEFLAG )
+	{ DO_DUMP = SNTABLE_DUMPFILTER_ROWSEL(CCID,DARRAY); }
+      if ( DO_DUMP )  { fprintf(FP_DUMP,"%s\n", OUTLINE); }
+    }
+  }
+  fflush(FP_DUMP);
+
+  return(NROW);
+
+} // end SNTABLE_DUMP_EXEC_TEXT
+
+
 // ==============================================
 int SNTABLE_READ_EXEC_TEXT(void) {
 
-  // Oct 2014:  
+  // Oct 2014:
   // Execute ascii read over all rows and fill
   // pointers passed previously to SNTABLE_READPREP_VARDEF.
   // Functions returns number of rows read. 
@@ -1176,7 +2099,46 @@ int SNTABLE_READ_EXEC_TEXT(void) {
   // ------------ BEGIN -----------  
    
   // get key name of ID varname such as CID, GALID, etc.
-  sprintf(KEYNAME_ID,"%s", READTABLE_POINTERS.VARNAME[0] ); 
+  sprintf(KEYNAME_ID,"%s", READTABLE_POINTERS.VARNAME[0] );
+
+  // Aug 2026: streaming dump mode (sntable_dump) writes selected
+  // rows directly to FP_DUMP; nothing is materialized.
+  if ( READTABLE_POINTERS.FP_DUMP != NULL ) {
+    NROW = SNTABLE_DUMP_EXEC_TEXT();
+    fclose(FP);
+    NAME_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT][0] = 0 ;
+    USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT]     = 0;
+    return(NROW);
+  }
+
+  // Aug 2026: check for binary columnar sidecar cache
+  SNTABLE_BINARY.WRFLAG = false ;
+  if ( useFlag_SNTABLE_BINARY() ) {
+    NROW = SNTABLE_READ_EXEC_BINARY();
+    if ( NROW > 0 ) {
+      fclose(FP);
+      NAME_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT][0] = 0 ;
+      USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT]     = 0;
+      return(NROW);
+    }
+    NROW = 0 ;
+    SNTABLE_BINARY.WRFLAG = true ;  // no valid cache; write one below
+    SNTABLE_BINARY.STAGE_MALLOCROWS = 0 ;
+  }
+
+  // Aug 2026: chunked mmap parser for plain files; excluded when
+  // staging the binary sidecar (store_cell grows serially) or for
+  // gzipped input (cannot mmap). Fall through to fgets loop on -1.
+  if ( GZIPFLAG_TEXT == 0 && !SNTABLE_BINARY.WRFLAG ) {
+    NROW = SNTABLE_READ_EXEC_TEXT_MMAP();
+    if ( NROW >= 0 ) {
+      fclose(FP);
+      NAME_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT][0] = 0 ;
+      USE_TABLEFILE[OPENFLAG_READ][IFILETYPE_TEXT]     = 0;
+      return(NROW);
+    }
+    NROW = 0 ;
+  }
 
   while ( fgets(LINE, MXCHAR_LINE, FP ) != NULL ) {
 
@@ -1213,8 +2175,11 @@ int SNTABLE_READ_EXEC_TEXT(void) {
     //  xxx mark delete while ( ptrtok != NULL && ptrtok != '\0' && ivar < NVAR_TOT) { 
     while ( ptrtok != NULL && ivar < NVAR_TOT) { 
 
+      if ( SNTABLE_BINARY.WRFLAG )
+	{ store_cell_SNTABLE_BINARY(NROW-1, ivar, ptrtok); }
+
       // Dec 20 2017: extract only variables on READ-list
-      if ( READTABLE_POINTERS.NPTR[ivar] > 0 ) {      
+      if ( READTABLE_POINTERS.NPTR[ivar] > 0 ) {
 	sprintf(cvar,"%s",   ptrtok );      
 	sscanf(cvar, "%Lf",  &DVAR[ivar] );
 	sscanf(cvar, "%s",   CVAR[ivar] );
@@ -1279,8 +2244,11 @@ int SNTABLE_READ_EXEC_TEXT(void) {
 	
       } // end of i loop      
 
-  } // end fscanf 
-  
+  } // end fscanf
+
+  if ( SNTABLE_BINARY.WRFLAG && NROW > 0 )
+    { write_SNTABLE_BINARY(NROW); }
+
   fclose(FP);
 
   // May 2 2019: reset flags to allow opening another file.
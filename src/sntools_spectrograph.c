@@ -60,9 +60,11 @@ void init_spectrograph(char *inFile, char *stringOpt ) {
 
   // ------------- BEGIN ---------------
 
-  // check option(s) 
+  // check option(s)
   parse_spectrograph_options(stringOpt);
 
+  SNR_WGT_SPECTROGRAPH.VALID = false ; // Aug 2026
+
   // read wavelenth bins and list of SNR1,SNR2 from ascii file
   read_spectrograph_text(inFile);
 
@@ -1134,6 +1136,9 @@ void read_spectrograph_fits(char *inFile) {
 	   ,INPUTS_SPECTRO.SYN_FILTERLIST_LAMMAX[ifilt] );  */
   }
 
+  // store spectro-bin index range overlapping each syn filter
+  prep_SYN_FILTERLIST_LAMBIN();
+
   // ------------------------------------------
   // close fits file
  FCLOSE:
@@ -1148,6 +1153,52 @@ void read_spectrograph_fits(char *inFile) {
 } // end read_spectrograph_fits
 
 
+// ====================================================
+void prep_SYN_FILTERLIST_LAMBIN(void) {
+
+  // Created Aug 2026
+  // For each synthetic filter made from the spectrograph, store the
+  // range of spectro-bin indices whose bin centers lie inside the
+  // filter's wavelength range. The spectro bins are sorted in lambda,
+  // so the overlap is a contiguous [ILAM_MIN,ILAM_MAX] range; callers
+  // summing over the spectrograph (e.g., get_SPECTROGRAPH_ZPTPSFSKY)
+  // can then loop over the few overlapping bins instead of testing
+  // every spectro bin on every call.
+
+  int NBL   = INPUTS_SPECTRO.NBIN_LAM ;
+  int NFILT = strlen(INPUTS_SPECTRO.SYN_FILTERLIST_BAND);
+  int ifilt, l ;
+  double LAMMIN, LAMMAX, LCEN ;
+  //  char fnam[] = "prep_SYN_FILTERLIST_LAMBIN" ;
+
+  // ----------- BEGIN -----------
+
+  for(ifilt=0; ifilt < MXFILTINDX; ifilt++ ) {
+    INPUTS_SPECTRO.SYN_FILTERLIST_ILAM_MIN[ifilt] = -9 ;
+    INPUTS_SPECTRO.SYN_FILTERLIST_ILAM_MAX[ifilt] = -9 ;
+  }
+
+  for(ifilt=0; ifilt < NFILT; ifilt++ ) {
+    LAMMIN = INPUTS_SPECTRO.SYN_FILTERLIST_LAMMIN[ifilt] ;
+    LAMMAX = INPUTS_SPECTRO.SYN_FILTERLIST_LAMMAX[ifilt] ;
+    if ( LAMMIN < 0.0 ) { continue ; }
+
+    for(l=0; l < NBL; l++ ) {
+      LCEN = 0.5 * ( INPUTS_SPECTRO.LAMMIN_LIST[l] +
+		     INPUTS_SPECTRO.LAMMAX_LIST[l] ) ;
+      if ( LCEN < LAMMIN ) { continue ; }
+      if ( LCEN > LAMMAX ) { continue ; }
+      if ( INPUTS_SPECTRO.SYN_FILTERLIST_ILAM_MIN[ifilt] < 0 )
+	{ INPUTS_SPECTRO.SYN_FILTERLIST_ILAM_MIN[ifilt] = l ; }
+      INPUTS_SPECTRO.SYN_FILTERLIST_ILAM_MAX[ifilt] = l ;
+    }
+  }
+
+  return ;
+
+} // end prep_SYN_FILTERLIST_LAMBIN
+
+
 // ====================================================
 double getSNR_spectrograph(int ILAM, double TEXPOSE_S, double TEXPOSE_T,
 			   bool ALLOW_TEXTRAP, double GENMAG, double *ERRFRAC_T) {
@@ -1209,31 +1260,61 @@ double getSNR_spectrograph(int ILAM, double TEXPOSE_S, double TEXPOSE_T,
   if ( INPUTS_SPECTRO.ZP[ILAM][0] < 0.0 ) { return(SNR); }
 
   // interpolate ZP(Texpose) and SQSIG(Texpose)
-  ZP_S = interp_1DFUN (OPT_INTERP, TEXPOSE_S_local, NBT, 
-		       INPUTS_SPECTRO.TEXPOSE_LIST,
-		       INPUTS_SPECTRO.ZP[ILAM], errmsg_ZP_S );
-  
-  SQ_S = interp_1DFUN (OPT_INTERP, TEXPOSE_S_local, NBT, 
-		       INPUTS_SPECTRO.TEXPOSE_LIST,
-		       INPUTS_SPECTRO.SQSIGSKY[ILAM], errmsg_SQ_S );
-  
-  if ( TEXPOSE_T > 0.01 ) {
-    ZP_T = interp_1DFUN (OPT_INTERP, TEXPOSE_T, NBT, 
-		       INPUTS_SPECTRO.TEXPOSE_LIST,
-		       INPUTS_SPECTRO.ZP[ILAM], errmsg_ZP_T );
 
-    SQ_T = interp_1DFUN (OPT_INTERP, TEXPOSE_T, NBT, 
+  if ( NBT > 1 ) {
+
+    // Aug 2026: the Texpose interp weights are the same for every
+    // lambda bin, so refresh the cached weights only when Texpose
+    // changes; per-bin work is then just the linear interp below.
+    if ( !( SNR_WGT_SPECTROGRAPH.VALID &&
+	    SNR_WGT_SPECTROGRAPH.TEXPOSE_S == TEXPOSE_S_local &&
+	    SNR_WGT_SPECTROGRAPH.TEXPOSE_T == TEXPOSE_T ) )
+      { prep_getSNR_spectrograph(TEXPOSE_S_local, TEXPOSE_T); }
+
+    int     IB   = SNR_WGT_SPECTROGRAPH.IBIN_S ;
+    double  frac = SNR_WGT_SPECTROGRAPH.FRAC_S ;
+    double *ptrZP = INPUTS_SPECTRO.ZP[ILAM] ;
+    double *ptrSQ = INPUTS_SPECTRO.SQSIGSKY[ILAM] ;
+
+    ZP_S = ptrZP[IB] + frac*( ptrZP[IB+1] - ptrZP[IB] );
+    SQ_S = ptrSQ[IB] + frac*( ptrSQ[IB+1] - ptrSQ[IB] );
+
+    if ( TEXPOSE_T > 0.01 ) {
+      IB   = SNR_WGT_SPECTROGRAPH.IBIN_T ;
+      frac = SNR_WGT_SPECTROGRAPH.FRAC_T ;
+      ZP_T = ptrZP[IB] + frac*( ptrZP[IB+1] - ptrZP[IB] );
+      SQ_T = ptrSQ[IB] + frac*( ptrSQ[IB+1] - ptrSQ[IB] );
+
+      // Feb 2 2017:
+      //  scale template noise to search-image exposure. Nominaly
+      //  the scaling would be TEXPOSE_S/TEXPOSE_T, but the noise
+      //  has a more complex function; hence use the ZP to scale
+      //  the template noise.
+      //   SQNOISE_SCALE = FLUXSCALE^2 = 10^( 0.8 * ZPdif )
+      SQ_T *= pow( TEN, 0.8*(ZP_S-ZP_T) ) ;
+    }
+  }
+  else {
+    // legacy interp calls; only for pathological 1-bin Texpose grid
+    ZP_S = interp_1DFUN (OPT_INTERP, TEXPOSE_S_local, NBT,
+			 INPUTS_SPECTRO.TEXPOSE_LIST,
+			 INPUTS_SPECTRO.ZP[ILAM], errmsg_ZP_S );
+
+    SQ_S = interp_1DFUN (OPT_INTERP, TEXPOSE_S_local, NBT,
 			 INPUTS_SPECTRO.TEXPOSE_LIST,
-			 INPUTS_SPECTRO.SQSIGSKY[ILAM], errmsg_SQ_T );
-
-    // Feb 2 2017: 
-    //  scale template noise to search-image exposure. Nominaly
-    //  the scaling would be TEXPOSE_S/TEXPOSE_T, but the noise
-    //  has a more complex function; hence use the ZP to scale
-    //  the template noise.  
-    //   SQNOISE_SCALE = FLUXSCALE^2 = 10^( 0.8 * ZPdif )
-    SQ_T *= pow( TEN, 0.8*(ZP_S-ZP_T) ) ;
-     
+			 INPUTS_SPECTRO.SQSIGSKY[ILAM], errmsg_SQ_S );
+
+    if ( TEXPOSE_T > 0.01 ) {
+      ZP_T = interp_1DFUN (OPT_INTERP, TEXPOSE_T, NBT,
+			   INPUTS_SPECTRO.TEXPOSE_LIST,
+			   INPUTS_SPECTRO.ZP[ILAM], errmsg_ZP_T );
+
+      SQ_T = interp_1DFUN (OPT_INTERP, TEXPOSE_T, NBT,
+			   INPUTS_SPECTRO.TEXPOSE_LIST,
+			   INPUTS_SPECTRO.SQSIGSKY[ILAM], errmsg_SQ_T );
+
+      SQ_T *= pow( TEN, 0.8*(ZP_S-ZP_T) ) ;
+    }
   }
 
 
@@ -1273,3 +1354,45 @@ double getSNR_spectrograph(int ILAM, double TEXPOSE_S, double TEXPOSE_T,
   return(SNR);
 
 } // end getSNR_spectrograph
+
+// *********************************************
+void prep_getSNR_spectrograph(double TEXPOSE_S, double TEXPOSE_T) {
+
+  // Created Aug 2026
+  // Cache Texpose-interpolation weights for getSNR_spectrograph:
+  // binary-search TEXPOSE_LIST once and store the bin index and
+  // linear-interp fraction for the search (and optional template)
+  // exposure time. Inputs are assumed already clamped to the valid
+  // TEXPOSE range by the caller.
+
+  int    NBT   = INPUTS_SPECTRO.NBIN_TEXPOSE ;
+  double *ptrT = INPUTS_SPECTRO.TEXPOSE_LIST ;
+  int    IB ;
+  double T0, T1 ;
+  char fnam[] = "prep_getSNR_spectrograph" ;
+
+  // ----------- BEGIN -----------
+
+  IB = quickBinSearch(TEXPOSE_S, NBT, ptrT, fnam );
+  T0 = ptrT[IB];  T1 = ptrT[IB+1];
+  SNR_WGT_SPECTROGRAPH.IBIN_S = IB ;
+  SNR_WGT_SPECTROGRAPH.FRAC_S = (TEXPOSE_S - T0)/(T1-T0) ;
+
+  if ( TEXPOSE_T > 0.01 ) {
+    IB = quickBinSearch(TEXPOSE_T, NBT, ptrT, fnam );
+    T0 = ptrT[IB];  T1 = ptrT[IB+1];
+    SNR_WGT_SPECTROGRAPH.IBIN_T = IB ;
+    SNR_WGT_SPECTROGRAPH.FRAC_T = (TEXPOSE_T - T0)/(T1-T0) ;
+  }
+  else {
+    SNR_WGT_SPECTROGRAPH.IBIN_T = -9 ;
+    SNR_WGT_SPECTROGRAPH.FRAC_T =  0.0 ;
+  }
+
+  SNR_WGT_SPECTROGRAPH.TEXPOSE_S = TEXPOSE_S ;
+  SNR_WGT_SPECTROGRAPH.TEXPOSE_T = TEXPOSE_T ;
+  SNR_WGT_SPECTROGRAPH.VALID     = true ;
+
+  return ;
+
+} // end prep_getSNR_spectrograph
@@ -50,11 +50,28 @@ struct {
   double SYN_FILTERLIST_LAMMIN[MXFILTINDX] ;
   double SYN_FILTERLIST_LAMMAX[MXFILTINDX] ;
 
+  // Aug 2026: contiguous range of spectro-bin indices whose bin
+  // centers lie inside each syn filter; -9 if no overlap.
+  // See prep_SYN_FILTERLIST_LAMBIN().
+  int    SYN_FILTERLIST_ILAM_MIN[MXFILTINDX] ;
+  int    SYN_FILTERLIST_ILAM_MAX[MXFILTINDX] ;
+
 } INPUTS_SPECTRO ;
 
 #define MXVALUES_SPECBIN  10+2*MXTEXPOSE_SPECTROGRAPH
 double  VALUES_SPECBIN[MXVALUES_SPECBIN];
 
+// Aug 2026: cache Texpose-interpolation weights for getSNR_spectrograph.
+// Within one spectrum the exposure times are the same for every lambda
+// bin, so the binary search over TEXPOSE_LIST and the interp fraction
+// are computed once here instead of 4 times per lambda bin.
+struct {
+  bool   VALID ;
+  double TEXPOSE_S, TEXPOSE_T ;  // exposure times of cached weights
+  int    IBIN_S, IBIN_T ;        // TEXPOSE_LIST bin containing each Texpose
+  double FRAC_S, FRAC_T ;        // linear-interp fraction inside each bin
+} SNR_WGT_SPECTROGRAPH ;
+
 
 // ------ GENERATED SPECTRA ------                                                        
 
@@ -118,6 +135,7 @@ void init_spectrograph(char *inFile, char *stringOpt ) ;
 void parse_spectrograph_options(char *stringOpt) ;
 void read_spectrograph_text(char *inFile) ;
 void read_spectrograph_fits(char *inFile) ;
+void prep_SYN_FILTERLIST_LAMBIN(void) ;
 int  read_TEXPOSE_LIST(FILE *fp); 
 int  read_SPECBIN_spectrograph(FILE *fp);
 void reset_VALUES_SPECBIN(void) ;
@@ -129,8 +147,9 @@ void get_FILTERtrans_spectrograph(double *LMIN, double *LMAX, int MXLAM,
 				  int *NLAMBIN,
 				  double *LAM_ARRAY, double *TRANS_ARRAY );
 
-double getSNR_spectrograph(int ilam, double Texpose_S, double Texpose_T, 
+double getSNR_spectrograph(int ilam, double Texpose_S, double Texpose_T,
 			   bool ALLOW_TEXTRAP,double genMag,double *ERRFRAC_T);
+void prep_getSNR_spectrograph(double Texpose_S, double Texpose_T);
 
 void check_SNR_SPECTROGRAPH(int l, int t);
 
@@ -286,10 +286,49 @@ void init_stronglens(char *MODEL_FILE) {
 
   INPUTS_STRONGLENS.NLENS = i-1;
   //printf("%i\n",INPUTS_STRONGLENS.NLENS);
+
+  // Aug 2026: index library by ZSRC for fast lens association
+  sort_stronglens();
+
   return ;
 
 } // end init_stronglens
 
+
+// ===================================
+void sort_stronglens(void) {
+
+  // Created Aug 2026
+  // Sort library entries by increasing ZSRC and store the sort index
+  // (IZSORT_ZSRC) along with the sorted redshifts (ZSRC_SORTED).
+  // get_stronglens then finds all lenses inside its zSRC match
+  // window with a binary search over ZSRC_SORTED, so lens
+  // association no longer scans the full library per event.
+
+  int NLENS = INPUTS_STRONGLENS.NLENS ;
+  int MEMI  = NLENS * sizeof(int);
+  int MEMF  = NLENS * sizeof(float);
+  int ORDER = +1 ;
+  int i, isort;
+  //  char fnam[] = "sort_stronglens" ;
+
+  // ------------ BEGIN --------------
+
+  INPUTS_STRONGLENS.IZSORT_ZSRC = (int  *) malloc(MEMI);
+  INPUTS_STRONGLENS.ZSRC_SORTED = (float*) malloc(MEMF);
+
+  sortFloat(NLENS, INPUTS_STRONGLENS.ZSRC, ORDER,
+	    INPUTS_STRONGLENS.IZSORT_ZSRC );
+
+  for(i=0; i < NLENS; i++ ) {
+    isort = INPUTS_STRONGLENS.IZSORT_ZSRC[i] ;
+    INPUTS_STRONGLENS.ZSRC_SORTED[i] = INPUTS_STRONGLENS.ZSRC[isort] ;
+  }
+
+  return ;
+
+} // end sort_stronglens
+
 // ===================================
 void malloc_stronglens(int NLENS) {
 
@@ -369,29 +408,47 @@ void get_stronglens(double zSN, double *hostpar, int DUMPFLAG,
   INPUTS_STRONGLENS.NCALL++ ;
 
   
-  int numLens = 0;
-  for(i=0;i<INPUTS_STRONGLENS.NLENS;++i){
-    if(INPUTS_STRONGLENS.ZSRC[i]>=zSN*.99 && INPUTS_STRONGLENS.ZSRC[i]<=zSN*1.01){
-      ++numLens;
-    }
+  // Aug 2026: bracket the zSRC match window with binary searches over
+  // the sorted library (see sort_stronglens) instead of scanning all
+  // NLENS entries; matching lenses are a contiguous range of the
+  // sorted index, each with equal selection weight.
+
+  int   NLENS = INPUTS_STRONGLENS.NLENS ;
+  float zsrc_min = (float)(zSN*0.99) ;
+  float zsrc_max = (float)(zSN*1.01) ;
+  int   jmin, jmax, jmid, numLens ;
+
+  // first sorted position with ZSRC >= zsrc_min
+  i=0;  j=NLENS;
+  while ( i < j ) {
+    jmid = (i+j)/2 ;
+    if ( INPUTS_STRONGLENS.ZSRC_SORTED[jmid] < zsrc_min )
+      { i = jmid+1 ; }
+    else
+      { j = jmid ; }
   }
-  if(numLens==0){
+  jmin = i ;
+
+  // first sorted position with ZSRC > zsrc_max
+  i=jmin;  j=NLENS;
+  while ( i < j ) {
+    jmid = (i+j)/2 ;
+    if ( INPUTS_STRONGLENS.ZSRC_SORTED[jmid] <= zsrc_max )
+      { i = jmid+1 ; }
+    else
+      { j = jmid ; }
+  }
+  jmax = i-1 ;
+
+  numLens = jmax - jmin + 1 ;
+  if(numLens<=0){
     //errmsg(SEV_FATAL, 0, fnam, "No Lenses in your library matching your source redshift."," ");
     printf("No lenses found in library matching your source redshift %f\n",zSN);
     return;
   }
 
-  int possible_lenses[numLens];
-  j=0;
-  for(i=0;i<INPUTS_STRONGLENS.NLENS;++i){
-    if(INPUTS_STRONGLENS.ZSRC[i]>=zSN*.99 && INPUTS_STRONGLENS.ZSRC[i]<=zSN*1.01){
-      possible_lenses[j]=i;
-      ++j;
-    }
-    
-  }
-
-  int random_lens_index = possible_lenses[ (int)( FlatRan*(numLens-1) ) ];
+  int random_lens_index =
+    INPUTS_STRONGLENS.IZSORT_ZSRC[ jmin + (int)( FlatRan*(numLens-1) ) ];
 
   IDLENS_local  = INPUTS_STRONGLENS.IDLENS[random_lens_index];
   zLENS_local   = (double)INPUTS_STRONGLENS.ZLENS[random_lens_index];  
@@ -29,6 +29,12 @@ struct {
   int ICOL_LENSID, ICOL_ZSRC, ICOL_ZLENS, ICOL_NIMG, ICOL_XIMG, ICOL_YIMG;
   int ICOL_MAG, ICOL_DELAY;
 
+  // Aug 2026: library entries sorted by increasing ZSRC so that
+  // get_stronglens brackets the zSRC match window with a binary
+  // search instead of scanning the full library for every event.
+  int   *IZSORT_ZSRC ;   // sorted position -> library entry
+  float *ZSRC_SORTED ;   // ZSRC in sorted order
+
 } INPUTS_STRONGLENS;
 
 
@@ -36,6 +42,7 @@ struct {
 
 void init_stronglens(char *MODEL_FILE);
 void malloc_stronglens(int NLENS);
+void sort_stronglens(void);   // Aug 2026
 
 void get_stronglens(double zSN, double *hostpar, int LDMP,
 		    int *IDLENS, double *ZLENS, 
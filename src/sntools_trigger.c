@@ -62,6 +62,11 @@
     + use new MATCH_SEARCHEFF_FIELD(field_map) function to handle
       overlaps.
 
+  Aug 2026:
+    + use interp_GRIDMAP_HINT with a persistent hint per SPEC and
+      PHOTPROB map so that consecutive events landing in the same
+      grid cell skip the per-corner index translation.
+
 ************************************/
 
 #include "sntools.h"
@@ -350,13 +355,110 @@ int init_SEARCHEFF_PIPELINE(char *survey) {
 
   NMAP = INPUTS_SEARCHEFF.NMAP_PHOTPROB;
   for ( imap=0; imap < NMAP; imap++ )  { check_SEARCHEFF_PHOTPROB(imap); }
-  
+
+  compile_SEARCHEFF_PIPELINE();  // Aug 2026: fuse maps for fast lookup
+
   //  debugexit(fnam); // xxx REMOVE
 
   return(INPUTS_SEARCHEFF.NMAP_DETECT);
 
 } // end of  init_SEARCHEFF_PIPELINE
 
+
+// ************************************************
+void compile_SEARCHEFF_PIPELINE(void) {
+
+  // Created Aug 2026
+  // One-time compile of the DETECT-map stack after all maps are read:
+  //  + bind each ifilt_obs to its DETECT map so the per-epoch strstr
+  //    loop (and the duplicate-map abort) moves out of the event loop;
+  //  + precompute dEFF/dVAL slope per map bin, and flag maps whose
+  //    VAL grid is uniform so the lookup is index arithmetic instead
+  //    of a binary search. Interpolated EFF is unchanged.
+
+  int  NMAP = INPUTS_SEARCHEFF.NMAP_DETECT ;
+  int  imap, IMAP, NMAP_FOUND, ifilt_obs, ib, NBIN ;
+  double *ptrVAL, *ptrEFF, VALBIN, DIF ;
+  char cfilt[4];
+  char fnam[] = "compile_SEARCHEFF_PIPELINE" ;
+
+  // ----------- BEGIN -----------
+
+  SEARCHEFF_COMPILED_DETECT.USE = 0 ;
+
+  // bind each filter to its DETECT map
+  for ( ifilt_obs=0; ifilt_obs < MXFILTINDX; ifilt_obs++ ) {
+    sprintf(cfilt,"%c", FILTERSTRING[ifilt_obs] );
+    IMAP = -9;  NMAP_FOUND = 0 ;
+    for ( imap=0; imap < NMAP; imap++ ) {
+      if ( strstr(SEARCHEFF_DETECT[imap].FILTERLIST,cfilt) != NULL )
+	{ IMAP = imap;  NMAP_FOUND++ ; }
+    }
+
+    if ( NMAP_FOUND > 1 ) {
+      sprintf(c1err, "Found %d PIPELINE/DETECT maps for ifilt_obs=%d(%s)",
+	      NMAP_FOUND, ifilt_obs, cfilt);
+      sprintf(c2err,"Check EFF maps in %s",
+	      INPUTS_SEARCHEFF.PIPELINE_EFF_FILE );
+      errmsg(SEV_FATAL, 0, fnam, c1err, c2err) ;
+    }
+    SEARCHEFF_COMPILED_DETECT.IMAP_FILT[ifilt_obs] = IMAP ;
+  }
+
+  // precompute per-bin slopes, and check for uniform VAL grid
+  for ( imap=0; imap < NMAP; imap++ ) {
+    NBIN   = SEARCHEFF_DETECT[imap].NBIN ;
+    ptrVAL = SEARCHEFF_DETECT[imap].VAL ;
+    ptrEFF = SEARCHEFF_DETECT[imap].EFF ;
+
+    SEARCHEFF_COMPILED_DETECT.UNIFORM[imap]    = 0 ;
+    SEARCHEFF_COMPILED_DETECT.VALBIN_INV[imap] = 0.0 ;
+    SEARCHEFF_COMPILED_DETECT.SLOPE[imap]      = NULL ;
+    if ( NBIN < 2 ) { continue; }
+
+    SEARCHEFF_COMPILED_DETECT.SLOPE[imap] =
+      (double*) malloc ( (NBIN-1) * sizeof(double) );
+
+    VALBIN = ( ptrVAL[NBIN-1] - ptrVAL[0] ) / (double)(NBIN-1) ;
+    SEARCHEFF_COMPILED_DETECT.UNIFORM[imap] = ( VALBIN > 0.0 ) ;
+
+    for ( ib=0; ib < NBIN-1; ib++ ) {
+      DIF = ptrVAL[ib+1] - ptrVAL[ib] ;
+      SEARCHEFF_COMPILED_DETECT.SLOPE[imap][ib] =
+	( ptrEFF[ib+1] - ptrEFF[ib] ) / DIF ;
+
+      // uniform only if every bin matches the average spacing
+      if ( fabs(DIF-VALBIN) > 1.0E-6*VALBIN )
+	{ SEARCHEFF_COMPILED_DETECT.UNIFORM[imap] = 0 ; }
+    }
+
+    if ( SEARCHEFF_COMPILED_DETECT.UNIFORM[imap] )
+      { SEARCHEFF_COMPILED_DETECT.VALBIN_INV[imap] = 1.0/VALBIN ; }
+  }
+
+  SEARCHEFF_COMPILED_DETECT.USE = 1 ;
+
+  return ;
+
+} // end compile_SEARCHEFF_PIPELINE
+
+
+// ************************************************
+void GETEFF_PIPELINE_DETECT_BATCH(int NOBS, double *EFF_LIST) {
+
+  // Created Aug 2026
+  // Fill EFF_LIST[0:NOBS-1] with detection efficiency for every
+  // observation of the event in one call; per-epoch work uses the
+  // compiled map stack (see compile_SEARCHEFF_PIPELINE).
+
+  int obs;
+  // ----------- BEGIN -----------
+  for ( obs=0; obs < NOBS; obs++ )
+    { EFF_LIST[obs] = GETEFF_PIPELINE_DETECT(obs); }
+  return ;
+
+} // end GETEFF_PIPELINE_DETECT_BATCH
+
 // ************************************************
 int readMap_SEARCHEFF_DETECT  (FILE *fp,  char *key) {
 
@@ -1852,6 +1954,10 @@ int gen_SEARCHEFF_PIPELINE(int ID, double *MJD_TRIGGER) {
   NDETECT = IFILTOBS_MASK = LFIND = DETECT_MARK = 0 ;
   OBS_PHOTPROB.NSTORE = 0 ;
 
+  // Aug 2026: batch-evaluate detection eff for all epochs
+  GETEFF_PIPELINE_DETECT_BATCH(SEARCHEFF_DATA.NOBS,
+			       SEARCHEFF_COMPILED_DETECT.EFF_DETECT);
+
   // loop over each epoch and determine if there is a detection,
   // and also if there is a PHOTPROB measurement.
   for(obs = 0 ; obs < SEARCHEFF_DATA.NOBS; obs++ ) {
@@ -1863,7 +1969,7 @@ int gen_SEARCHEFF_PIPELINE(int ID, double *MJD_TRIGGER) {
 
     IFILTOBS = SEARCHEFF_DATA.IFILTOBS[obs] ;
     RAN      = SEARCHEFF_RANDOMS.FLAT_PIPELINE[obs] ;
-    EFF      = GETEFF_PIPELINE_DETECT(obs); // compute effic
+    EFF      = SEARCHEFF_COMPILED_DETECT.EFF_DETECT[obs]; // from batch
     DETECT_FLAG =  ( RAN < EFF ) ;
     if ( DETECT_FLAG ) 
       { SEARCHEFF_DATA.detectFlag[obs] += DETECT_MASK_SNR; }
@@ -2054,9 +2160,16 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   // find map corresponding to filter
   ifilt_obs = SEARCHEFF_DATA.IFILTOBS[obs] ;  IMAP=-9;
   sprintf(cfilt,"%c", FILTERSTRING[ifilt_obs] );
-  for(imap=0; imap < NMAP; imap++ ) {
-    if ( strstr(SEARCHEFF_DETECT[imap].FILTERLIST,cfilt) != NULL ) 
-      {  IMAP = imap;   NMAP_FOUND++; }
+  if ( SEARCHEFF_COMPILED_DETECT.USE ) {
+    // Aug 2026: filter -> map binding precompiled at init
+    IMAP = SEARCHEFF_COMPILED_DETECT.IMAP_FILT[ifilt_obs] ;
+    if ( IMAP >= 0 ) { NMAP_FOUND = 1 ; }
+  }
+  else {
+    for(imap=0; imap < NMAP; imap++ ) {
+      if ( strstr(SEARCHEFF_DETECT[imap].FILTERLIST,cfilt) != NULL )
+	{  IMAP = imap;   NMAP_FOUND++; }
+    }
   }
 
   // if no maps are found for this filter, there are two possibilities:
@@ -2124,9 +2237,24 @@ double GETEFF_PIPELINE_DETECT(int obs) {
   if ( VAL < VAL_atmin ) { return EFF_atmin ; }
 
   // interpolate
-  EFF = interp_1DFUN (OPT_INTERP, VAL, NBIN_EFF, 
-		      SEARCHEFF_DETECT[IMAP].VAL,
-		      SEARCHEFF_DETECT[IMAP].EFF, fnam);
+  if ( SEARCHEFF_COMPILED_DETECT.USE &&
+       SEARCHEFF_COMPILED_DETECT.UNIFORM[IMAP] ) {
+    // Aug 2026: uniform VAL grid -> index arithmetic with
+    // precompiled slope; same EFF as interp_1DFUN.
+    int     ib ;
+    double *ptrVAL = SEARCHEFF_DETECT[IMAP].VAL ;
+    ib = (int)( (VAL - ptrVAL[0]) *
+		SEARCHEFF_COMPILED_DETECT.VALBIN_INV[IMAP] );
+    if ( ib > NBIN_EFF-2 ) { ib = NBIN_EFF-2; }
+    if ( ib < 0          ) { ib = 0; }
+    EFF = SEARCHEFF_DETECT[IMAP].EFF[ib] +
+      SEARCHEFF_COMPILED_DETECT.SLOPE[IMAP][ib] * (VAL - ptrVAL[ib]) ;
+  }
+  else {
+    EFF = interp_1DFUN (OPT_INTERP, VAL, NBIN_EFF,
+			SEARCHEFF_DETECT[IMAP].VAL,
+			SEARCHEFF_DETECT[IMAP].EFF, fnam);
+  }
 
   // printf(" xxxx EFF(VAL=%f) = %f   (inear = %d) \n", VAL, EFF, inear );
 
@@ -2405,6 +2533,7 @@ double get_PIPELINE_PHOTPROB(int istore) {
   double VARDATA[MXVAR_SEARCHEFF_PHOTPROB];
   char  *VARNAME, cFILT[4];
   double PHOTPROB = 0.0 ;
+  static GRIDMAP_HINT_DEF HINT_PHOTPROB[MXMAP_SEARCHEFF_PHOTPROB]; // Aug 2026
 
   char fnam[] = "get_PIPELINE_PHOTPROB" ;
 
@@ -2415,8 +2544,9 @@ double get_PIPELINE_PHOTPROB(int istore) {
     { VARDATA[ivar] = LOAD_PHOTPROB_VAR(obs,IMAP,ivar);   }
   
   PHOTPROB_CDF[0] = 0.0 ;
-  istat = interp_GRIDMAP(&SEARCHEFF_PHOTPROB[IMAP].GRIDMAP, VARDATA, 
-			 &PHOTPROB_CDF[1] );  // <== returned  
+  istat = interp_GRIDMAP_HINT(&SEARCHEFF_PHOTPROB[IMAP].GRIDMAP, VARDATA,
+			      &PHOTPROB_CDF[1],               // <== returned
+			      &HINT_PHOTPROB[IMAP] );
 
   // ---------------------------------
   // Finally, use linear interpolation to pick random PHOTPROB 
@@ -2476,6 +2606,8 @@ int gen_SEARCHEFF_SPEC(int ID, double *EFF_SPEC) {
   // May 10 2018: EFF *= USER_SPECEFF_SCALE
   // Jun 02 2018: check opton to force EFF_SPEC=0
   // Jun 08 2018: check BOOLEAN OR/AND logic for EFF.
+  // Aug 2026: keep a persistent interp hint per map; consecutive
+  //           events usually land in the same grid cell.
 
   int  NMAP        = INPUTS_SEARCHEFF.NMAP_SPEC ;
   int  BOOLEAN_OR  = SEARCHEFF_SPEC_INFO.BOOLEAN_OR  ;
@@ -2486,6 +2618,7 @@ int gen_SEARCHEFF_SPEC(int ID, double *EFF_SPEC) {
   // xxx mark delete  int  ALL_FIELDS, MATCH ;
   double PnoSpec_OR, Pspec_AND, EFF, RAN, VARDATA[MXVAR_SEARCHEFF_SPEC];
   char *fld_gen, *fld_map ;
+  static GRIDMAP_HINT_DEF HINT_SPEC[MXMAP_SEARCHEFF_SPEC] ; // Aug 2026
   char fnam[] = "gen_SEARCHEFF_SPEC" ;
 
   // ----------- BEGIN --------
@@ -2535,7 +2668,8 @@ int gen_SEARCHEFF_SPEC(int ID, double *EFF_SPEC) {
     for ( ivar=0; ivar < NVAR; ivar++ )
       { VARDATA[ivar] = LOAD_SPECEFF_VAR(imap,ivar); }
 
-    istat = interp_GRIDMAP(&SEARCHEFF_SPEC[imap].GRIDMAP, VARDATA, &EFF );
+    istat = interp_GRIDMAP_HINT(&SEARCHEFF_SPEC[imap].GRIDMAP, VARDATA,
+				&EFF, &HINT_SPEC[imap] );
     PnoSpec_OR *= (1.0 - EFF);
     Pspec_AND  *= EFF ;
 
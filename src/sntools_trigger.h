@@ -141,6 +141,20 @@ struct SEARCHEFF_PIPELINE {
   char   README[20][MXPATHLEN];
 } SEARCHEFF_DETECT[MXMAP_SEARCHEFF_DETECT+1] ;
 
+// Aug 2026: compiled DETECT-map stack, filled once by
+// compile_SEARCHEFF_PIPELINE after all maps are read.
+// The filter -> map binding and the per-bin slopes are precomputed
+// so the per-epoch lookup does no string matching and (for uniform
+// VAL grids) no binary search.
+struct {
+  int    USE ;                                  // 1 after compile
+  int    IMAP_FILT[MXFILTINDX] ;                // map per ifilt_obs; -9=none
+  int    UNIFORM[MXMAP_SEARCHEFF_DETECT+1] ;    // 1 -> uniform VAL grid
+  double VALBIN_INV[MXMAP_SEARCHEFF_DETECT+1] ; // 1/binsize (uniform only)
+  double *SLOPE[MXMAP_SEARCHEFF_DETECT+1] ;     // dEFF/dVAL per bin
+  double EFF_DETECT[MXOBS_TRIGGER] ;            // batch output per obs
+} SEARCHEFF_COMPILED_DETECT ;
+
 
 int MAPVERSION_SEARCHEFF_PHOTPROB ;
 
@@ -311,6 +325,8 @@ double LOAD_SPECEFF_VAR(int imap, int ivar);
 void   LOAD_PHOTPROB_CDF(int NVAR_CDF, double *WGTLIST );
 double LOAD_PHOTPROB_VAR(int OBS, int IMAP, int IVAR) ;
 double GETEFF_PIPELINE_DETECT(int obs);
+void   compile_SEARCHEFF_PIPELINE(void);                       // Aug 2026
+void   GETEFF_PIPELINE_DETECT_BATCH(int NOBS, double *EFF_LIST);
 
 void   setObs_for_PHOTPROB(int DETECT_FLAG, int obs);
 void   setRan_for_PHOTPROB(void) ;
@@ -178,6 +178,9 @@ void init_lensDMU(char *mapFileName, float dsigma_dz) {
 	 NZ, LENSING_PROBMAP.z_LIST[0], LENSING_PROBMAP.z_LIST[NZ-1] );
   fflush(stdout);
 
+  // Aug 2026: precompute lookups so that each gen_lensDMU draw is O(1)
+  prep_lensDMU_lookup();
+
   //  debugexit(fnam); // xxx REMOVE
 
   return ;
@@ -185,6 +188,95 @@ void init_lensDMU(char *mapFileName, float dsigma_dz) {
 } // end init_lensDMU
 
 
+// ============================================
+void prep_lensDMU_lookup(void) {
+
+  // Created Aug 2026
+  // Precompute per-z-bin guide tables for the CDF inversion in
+  // gen_lensDMU: JUMPBIN[iz][j] holds the dmu-knot index whose
+  // cumulative prob brackets CDF value j/NBIN_JUMP_LENSING, so each
+  // draw starts at the right knot with two array reads instead of a
+  // binary search over NBIN_dmu.  Note that an alias table is not
+  // used here because the sampled dMU is continuous (interpolated
+  // between knots), not a discrete bin.
+  //
+  // Also store DZBIN if the z grid is uniform so the z-bin can be
+  // indexed directly instead of scanned.
+
+  int NBIN_z   = LENSING_PROBMAP.NBIN_z ;
+  int NBIN_dmu = LENSING_PROBMAP.NBIN_dmu ;
+  int iz, imu, j ;
+  double P, DZ, DZTMP ;
+  //  char fnam[] = "prep_lensDMU_lookup" ;
+
+  // -------------- BEGIN -------------
+
+  LENSING_PROBMAP.JUMPBIN = (int**) malloc( sizeof(int*) * NBIN_z );
+
+  for(iz=0; iz < NBIN_z; iz++ ) {
+    LENSING_PROBMAP.JUMPBIN[iz] =
+      (int*) malloc( sizeof(int) * (NBIN_JUMP_LENSING+1) );
+
+    imu = 0 ;
+    for(j=0; j <= NBIN_JUMP_LENSING; j++ ) {
+      P = (double)j / (double)NBIN_JUMP_LENSING ;
+      while ( imu < NBIN_dmu-2 &&
+	      LENSING_PROBMAP.FUNPROB[iz][imu+1] < P ) { imu++ ; }
+      LENSING_PROBMAP.JUMPBIN[iz][j] = imu ;
+    }
+  }
+
+  // check for uniform z grid
+  LENSING_PROBMAP.DZBIN = -9.0 ;
+  if ( NBIN_z > 1 ) {
+    DZ = LENSING_PROBMAP.z_LIST[1] - LENSING_PROBMAP.z_LIST[0] ;
+    LENSING_PROBMAP.DZBIN = DZ ;
+    for(iz=0; iz < NBIN_z-1; iz++ ) {
+      DZTMP = LENSING_PROBMAP.z_LIST[iz+1] - LENSING_PROBMAP.z_LIST[iz] ;
+      if ( fabs(DZTMP-DZ) > 1.0E-8 ) { LENSING_PROBMAP.DZBIN = -9.0 ; }
+    }
+  }
+
+  return ;
+
+} // end prep_lensDMU_lookup
+
+
+// ============================================
+double invcdf_lensDMU(int iz, double ran1) {
+
+  // Created Aug 2026
+  // Return DMU at CDF value ran1 for redshift bin iz, using the
+  // guide table from prep_lensDMU_lookup to locate the bracketing
+  // dmu knots in O(1); linear interpolation between knots matches
+  // the previous interp_1DFUN(OPT_INTERP_LINEAR) arithmetic.
+
+  double *ptrPROB = LENSING_PROBMAP.FUNPROB[iz] ;
+  double *ptrDMU  = LENSING_PROBMAP.FUNDMU[iz] ;
+  int     NBIN_dmu = LENSING_PROBMAP.NBIN_dmu ;
+  int     j, imu ;
+  double  P0, P1, frac ;
+  //  char fnam[] = "invcdf_lensDMU" ;
+
+  // -------------- BEGIN -------------
+
+  if ( NBIN_dmu == 1 ) { return ptrDMU[0]; }
+
+  j = (int)( ran1 * (double)NBIN_JUMP_LENSING ) ;
+  if ( j < 0                 ) { j = 0 ; }
+  if ( j > NBIN_JUMP_LENSING ) { j = NBIN_JUMP_LENSING ; }
+
+  imu = LENSING_PROBMAP.JUMPBIN[iz][j] ;
+  while ( imu < NBIN_dmu-2 && ptrPROB[imu+1] < ran1 ) { imu++ ; }
+
+  P0   = ptrPROB[imu] ;
+  P1   = ptrPROB[imu+1] ;
+  frac = (ran1 - P0)/(P1 - P0) ;
+  return  ptrDMU[imu] + frac * ( ptrDMU[imu+1] - ptrDMU[imu] ) ;
+
+} // end invcdf_lensDMU
+
+
 // ============================================
 double gen_lensDMU( double z, double ran1 ) {
   // Created Apr 2017 
@@ -198,15 +290,14 @@ double gen_lensDMU( double z, double ran1 ) {
   double lensDMU = 0.0 ;  // default  
   double zMIN = LENSING_PROBMAP.zMIN ;
   double zMAX = LENSING_PROBMAP.zMAX ;
-  int    NBIN_dmu = LENSING_PROBMAP.NBIN_dmu ;
   int    NBIN_z   = LENSING_PROBMAP.NBIN_z ;
 
-  int OPT_INTERP = OPT_INTERP_LINEAR ;
   double ztmp, z0, z1, zScale = 0.0 ;
+  double DZBIN = LENSING_PROBMAP.DZBIN ;
   int    iz, iz0, iz1;
   char fnam[] = "gen_lensDMU" ;
 
-  // -------------- BEGIN ------------- 
+  // -------------- BEGIN -------------
 
   if ( LENSING_PROBMAP.USEFLAG == 0 ) { return(lensDMU) ;}
 
@@ -222,6 +313,13 @@ double gen_lensDMU( double z, double ran1 ) {
     iz0 = iz1 = NBIN_z - 1 ;
     zScale = z/zMAX ;
   }
+  else if ( DZBIN > 0.0 ) {
+    // Aug 2026: uniform z grid -> index z-bin directly
+    zScale = -9.0 ;
+    iz0 = (int)( (z - zMIN)/DZBIN ) ;
+    if ( iz0 > NBIN_z-2 ) { iz0 = NBIN_z-2 ; }
+    iz1 = iz0 + 1 ;
+  }
   else {
     zScale = -9.0 ;
     for(iz=0; iz < NBIN_z-1; iz++ ) {
@@ -240,32 +338,48 @@ double gen_lensDMU( double z, double ran1 ) {
   z0 = LENSING_PROBMAP.z_LIST[iz0] ;
   z1 = LENSING_PROBMAP.z_LIST[iz1] ;
 
-  double *ptrPROB[2], *ptrDMU[2] ;
-  ptrPROB[0] = LENSING_PROBMAP.FUNPROB[iz0] ;
-  ptrPROB[1] = LENSING_PROBMAP.FUNPROB[iz1] ;
-  ptrDMU[0]  = LENSING_PROBMAP.FUNDMU[iz0] ;
-  ptrDMU[1]  = LENSING_PROBMAP.FUNDMU[iz1] ;
+  // - - - - - - - - - - - - - - - - - - -
+  // Aug 2026: invert CDF with precomputed guide table (invcdf_lensDMU)
+  // instead of per-draw binary search in interp_1DFUN.
 
-  // - - - - - - - - - - - - - - - - - - - 
   if ( zScale > 0.0  ) {
     // scale lensDMU by zScale
-    lensDMU = interp_1DFUN(OPT_INTERP, ran1, NBIN_dmu,
-			   ptrPROB[0], ptrDMU[0], fnam );
+    lensDMU = invcdf_lensDMU(iz0, ran1);
     lensDMU *= zScale ;
   }
   else {
     // interpolate lensDMU between two z bins
     double DMU0, DMU1, zFac ;
-    DMU0 = interp_1DFUN(OPT_INTERP, ran1, NBIN_dmu,
-			ptrPROB[0], ptrDMU[0], fnam );
-    DMU1 = interp_1DFUN(OPT_INTERP, ran1, NBIN_dmu,
-			ptrPROB[1], ptrDMU[1], fnam );
+    DMU0 = invcdf_lensDMU(iz0, ran1);
+    DMU1 = invcdf_lensDMU(iz1, ran1);
 
     zFac    = (z - z0)/(z1-z0);
     lensDMU = DMU0 + (DMU1-DMU0)*zFac ;
   }
 
-  return(lensDMU) ; 
+  return(lensDMU) ;
+
+} // end gen_magLens
+
+
+// ============================================
+void gen_lensDMU_list(int NGEN, double *z_list, double *ran_list,
+		      double *dmu_list) {
+
+  // Created Aug 2026
+  // Batched draw: fill dmu_list[0:NGEN-1] with lensing DMU for each
+  // (z_list[i], ran_list[i]) pair; convenience wrapper for callers
+  // that stage their randoms per event before applying lensing.
+
+  int i;
+  //  char fnam[] = "gen_lensDMU_list" ;
+
+  // -------------- BEGIN -------------
+
+  for(i=0; i < NGEN; i++ )
+    { dmu_list[i] = gen_lensDMU(z_list[i], ran_list[i]); }
+
+  return ;
 
-} // end gen_magLens 
+} // end gen_lensDMU_list
 
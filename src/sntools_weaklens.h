@@ -2,6 +2,8 @@
 #define MXBIN_LENSING_z   100
 #define MXBIN_LENZING_dmu 100
 
+#define NBIN_JUMP_LENSING 1024  // Aug 2026: CDF guide-table bins per z bin
+
 struct {
   int USEFLAG;
   int NBIN_z, NBIN_dmu;
@@ -12,7 +14,17 @@ struct {
   double **FUNDMU ;
 
   double zMIN, zMAX, dmuMIN, dmuMAX;
+
+  // Aug 2026: precomputed lookups for O(1) draws in gen_lensDMU.
+  // JUMPBIN[iz][j] = dmu-knot index bracketing CDF value j/NBIN_JUMP,
+  // so the CDF inversion needs no per-draw binary search.
+  int    **JUMPBIN ;
+  double DZBIN ;      // uniform z-bin size; < 0 if z grid not uniform
 } LENSING_PROBMAP ;
 
 void   init_lensDMU(char *mapFileName, float dsigma_dz) ;
 double gen_lensDMU(double z, double ran1);
+void   gen_lensDMU_list(int NGEN, double *z_list, double *ran_list,
+			double *dmu_list);    // Aug 2026
+void   prep_lensDMU_lookup(void);                 // Aug 2026
+double invcdf_lensDMU(int iz, double ran1);       // Aug 2026
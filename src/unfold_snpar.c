@@ -38,6 +38,13 @@
 
  Oct 2019: revived again for DES5YR analysis.
 
+ Aug 2026:
+   - new input CONVERGE_TOL (input-file key or command-line override):
+     stop iterating when the max fractional P_UNFOLD change drops
+     below tolerance, instead of always running N_ITERATION times.
+   - speed up PSIM_ADD and UNFOLD_ADD with local MIGRATION_TABLE
+     pointer (avoid triple-indirection per migration bin).
+
 *************/
 
 #include <stdio.h>
@@ -161,6 +168,8 @@ struct INPUTS {
 
   int DOMIGRATION_FLAG;  // default = 1
 
+  double CONVERGE_TOL;  // Aug 2026: stop when max frac change < TOL
+
 }  INPUTS ;
 
 
@@ -199,6 +208,7 @@ double PSIM_SUM[MAXZBIN][MAXBIN][MAXBIN];  // used to normalize each Psim
 
 double P_UNFOLD_RENORM;            // global renorm factor
 double PSUM_UNFOLD;                // sum of P_UNFOLD
+double PCHANGE_MAX_UNFOLD;         // Aug 2026: max frac change in last iter
 
 
 #define MAXMIGBIN 300
@@ -314,10 +324,22 @@ int main(int argc, char **argv) {
     // renormalize P_UNFOLD 
     XN = TABLE[ITYPE_SIMGEN].N_FILLED;
     P_UNFOLD_RENORM  = XN / PSUM_UNFOLD ;
-    //  printf("\t Renormalize P_UNFOLD -> *= %le \n", P_UNFOLD_RENORM  ); 
+    //  printf("\t Renormalize P_UNFOLD -> *= %le \n", P_UNFOLD_RENORM  );
 
+    PCHANGE_MAX_UNFOLD = 0.0 ;
     GENBIN_LOOP(OPT_UNFOLD_RENORM);
 
+    // Aug 2026: optional convergence-based early stop
+    if ( INPUTS.CONVERGE_TOL > 0.0 ) {
+      printf("\t Max fractional P_UNFOLD change: %le \n",
+	     PCHANGE_MAX_UNFOLD ); fflush(stdout);
+      if ( PCHANGE_MAX_UNFOLD < INPUTS.CONVERGE_TOL ) {
+	printf("\t Converged after %d iterations (CONVERGE_TOL=%le).\n",
+	       ITER, INPUTS.CONVERGE_TOL ); fflush(stdout);
+	break ;
+      }
+    }
+
   } // end of ITER loop
 
 
@@ -359,6 +381,7 @@ void rd_input(void) {
   INPUTS.DOMIGRATION_FLAG = 1 ;  // default = 1
   INPUTS.MIGBIN_RADIUS    = 100.0 ;
   INPUTS.NMIGPLOT         = 0 ;
+  INPUTS.CONVERGE_TOL     = 0.0 ;  // Aug 2026: default is no early stop
 
   INPUTS.NPAR = 2; // fixed for now ... 
 
@@ -401,9 +424,12 @@ void rd_input(void) {
       {  readchar(fp, INPUTS.PLOTFILE_OUT); }
 
 
-    if ( strcmp(c_get,"N_ITERATION:") == 0 ) 
+    if ( strcmp(c_get,"N_ITERATION:") == 0 )
       readint(fp, 1, &INPUTS.N_ITERATION );
 
+    if ( strcmp(c_get,"CONVERGE_TOL:") == 0 )
+      readdouble(fp, 1, &INPUTS.CONVERGE_TOL );
+
 
     if ( strcmp(c_get,"BINDUMP:") == 0 ) {
       NTMP = INPUTS.NBINDUMP ;
@@ -583,6 +609,10 @@ void  unfold_input_override(void) {
       i++ ; sscanf(ARGV_LIST[i] , "%d", &INPUTS.N_ITERATION );
     }
 
+    if ( strcmp( ARGV_LIST[i], "CONVERGE_TOL" ) == 0 ) {
+      i++ ; sscanf(ARGV_LIST[i] , "%le", &INPUTS.CONVERGE_TOL );
+    }
+
 
     // -------------------
     if ( i > ilast ) {
@@ -1213,6 +1243,7 @@ void PSIM_ADD (int IZ, int IBIN1, int IBIN2) {
   int iz, ibin1, ibin2, NMIGBIN, imig;
   int i, INDEX, IFLAG_DUMP ;
   double PSIM, XFIT, XGEN, XACC, P0 ;
+  MIGRATION_TABLE_DEF *MIGTAB ;  // Aug 2026: avoid 3x deref per migbin
 
   // --------------- BEGIN ----------------
 
@@ -1226,21 +1257,22 @@ void PSIM_ADD (int IZ, int IBIN1, int IBIN2) {
 
   P0 = P0_UNFOLD[IBIN1][IBIN2] ; // initial/last guess
 
-  // loop over migration bins 
-  NMIGBIN = MIGRATION_TABLE[IZ][IBIN1][IBIN2].NMIGBIN;
+  // loop over migration bins
+  MIGTAB  = &MIGRATION_TABLE[IZ][IBIN1][IBIN2];
+  NMIGBIN = MIGTAB->NMIGBIN;
 
   for ( imig=0; imig < NMIGBIN ; imig++ ) {
 
-    XFIT = MIGRATION_TABLE[IZ][IBIN1][IBIN2].NSIMFIT_NEAR[imig];
-    PSIM = XFIT / XGEN ;      
+    XFIT = MIGTAB->NSIMFIT_NEAR[imig];
+    PSIM = XFIT / XGEN ;
 
     // extract fitted indices
-    iz      = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBINZ_NEAR[imig] ;
-    ibin1   = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBIN1_NEAR[imig] ;
-    ibin2   = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBIN2_NEAR[imig] ;
+    iz      = MIGTAB->IBINZ_NEAR[imig] ;
+    ibin1   = MIGTAB->IBIN1_NEAR[imig] ;
+    ibin2   = MIGTAB->IBIN2_NEAR[imig] ;
 
     PSIM_SUM[iz][ibin1][ibin2] += (PSIM*P0) ;
-    
+
   } // end of imig loop
 
 
@@ -1267,12 +1299,22 @@ void UNFOLD_RENORM(int IBIN1, int IBIN2 ) {
 
   // Apply global re-norm to P_UNFOLD,
   // and set P0_UNFOLD for next iteration
+  //
+  // Aug 2026: track max fractional change w.r.t. previous iteration
+  //  for optional CONVERGE_TOL early stop.
 
-  double XGEN ;
+  double XDIF, XFRAC, P0 ;
   // ----------- BEGIN -----------
 
   P_UNFOLD[IBIN1][IBIN2] *= P_UNFOLD_RENORM ;
 
+  P0 = P0_UNFOLD[IBIN1][IBIN2] ;
+  if ( P0 > 0.0 ) {
+    XDIF  = fabs( P_UNFOLD[IBIN1][IBIN2] - P0 );
+    XFRAC = XDIF / P0 ;
+    if ( XFRAC > PCHANGE_MAX_UNFOLD ) { PCHANGE_MAX_UNFOLD = XFRAC; }
+  }
+
   P0_UNFOLD[IBIN1][IBIN2] = P_UNFOLD[IBIN1][IBIN2] ;
 
 } // end of UNFOLD_RENORM
@@ -1286,6 +1328,7 @@ void UNFOLD_ADD (int IZ, int IBIN1, int IBIN2) {
   int iz, ibin1, ibin2, INDEX, index, NMIGBIN, imig, i ,IFLAG_DUMP ;
   double PSIM, P0, PSIM_WGT, EFFSIM ;
   double XDATA, XGEN, XFIT, XTMP, XACC, PROB_MIG, PRODUCT    ;
+  MIGRATION_TABLE_DEF *MIGTAB ;  // Aug 2026: avoid 3x deref per migbin
   char fnam[] = "UNFOLD_ADD";
 
   // --------------- BEGIN ----------------
@@ -1318,24 +1361,25 @@ void UNFOLD_ADD (int IZ, int IBIN1, int IBIN2) {
   if ( IFLAG_DUMP  ) { DMP_UNFOLD(IZ, IBIN1, IBIN2, -1 ); }
   
 
-  // loop over migration bins 
-  NMIGBIN = MIGRATION_TABLE[IZ][IBIN1][IBIN2].NMIGBIN;
+  // loop over migration bins
+  MIGTAB  = &MIGRATION_TABLE[IZ][IBIN1][IBIN2];
+  NMIGBIN = MIGTAB->NMIGBIN;
 
   for ( imig=0; imig < NMIGBIN ; imig++ ) {
 
     // ibin[1,2] are fitted bins
-    iz      = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBINZ_NEAR[imig] ;
-    ibin1   = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBIN1_NEAR[imig] ;
-    ibin2   = MIGRATION_TABLE[IZ][IBIN1][IBIN2].IBIN2_NEAR[imig] ;
+    iz      = MIGTAB->IBINZ_NEAR[imig] ;
+    ibin1   = MIGTAB->IBIN1_NEAR[imig] ;
+    ibin2   = MIGTAB->IBIN2_NEAR[imig] ;
 
-    index   = INDEXMAP[iz][ibin1][ibin2] ; 
+    index   = INDEXMAP[iz][ibin1][ibin2] ;
     XDATA   = TABLE[ITYPE_DATA].ENTRIES[index] ;
     if ( XDATA <= 0.0 ) { continue ; }
 
     if ( IFLAG_DUMP ) { DMP_UNFOLD(IZ, IBIN1, IBIN2, imig); }
 
-    XFIT = MIGRATION_TABLE[IZ][IBIN1][IBIN2].NSIMFIT_NEAR[imig];
-    PSIM = XFIT / XGEN ;      
+    XFIT = MIGTAB->NSIMFIT_NEAR[imig];
+    PSIM = XFIT / XGEN ;
 
     if ( INPUTS.DOMIGRATION_FLAG  )
       { PSIM_WGT = PSIM_SUM[iz][ibin1][ibin2]; }
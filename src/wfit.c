@@ -291,6 +291,10 @@ double SQSIG_MUOFF ;
 #define MXSN 100000 // max number of SN to read & fit
 char CIDLIST[MXSN][20];
 
+// Aug 2026: params for -fastgrid adaptive chi2 grid
+#define SKIP_FASTGRID     4     // coarse grid uses every 4th step
+#define DCHI2MAX_FASTGRID 30.0  // refine cells within this of min
+
 int NCIDLIST, NCUT ;
 int NSNE_NBIN ; // for errscale 
 int *tid, *GENTYPE_SIM, *SNTYPE ;
@@ -374,6 +378,13 @@ struct MUCOV_STORE {
   double COVINV;   // inverse
 } MUCOV_STORE[MXCOVSN][MXCOVSN];
 
+// Aug 2026: flat copy of inverted mu-cov matrix for the chi2 loop,
+// plus precomputed sums so the B,C terms of the H0-marginalized
+// chi2 (Goliath 2001) cost O(N) per grid point instead of O(N^2).
+double MUCOVINV1D[MXCOVSN*MXCOVSN];  // [n0*NCOVSN+n1], 0-based
+double MUCOVINV_ROWSUM[MXCOVSN];
+double MUCOVINV_SUM ;
+
 // =============================
 int main(int argc,char *argv[]){
 
@@ -395,6 +406,7 @@ int main(int argc,char *argv[]){
     "   -om_sim\t\t Omega_M for cmb_sim (default from sntools.h)"
     "   -minchi2\t\t get w and OM from minchi2 instead of marginalizing",
     "   -marg\t\t get w and OM from marginalizing",
+    "   -fastgrid\t\t adaptive grid: coarse pass, then refine near min",
     "   -Rcmb\tCMB comstraints: R = Rcmb +/- sigma_Rcmb [= 1.710 +/- 0.019]",
     "   -sigma_Rcmb\tUncertainty on Rcmb",
     "   -abest\tBAO constraints: A = abest +/- sigma_a [= 0.469 +/- 0.017]",
@@ -488,6 +500,7 @@ int main(int argc,char *argv[]){
   int gridflag= 0;
   int writechi= 0;
   int usemarg = 0;
+  int usefastgrid = 0;
   int usemucovar = 0;
 
 
@@ -599,8 +612,10 @@ int main(int argc,char *argv[]){
 	omm_prior     = OMEGA_MATTER_SIM ;
       } else if (strcasecmp(argv[iarg]+1,"minchi2")==0) { 
 	usemarg=0;
-      } else if (strcasecmp(argv[iarg]+1,"marg")==0) { 
+      } else if (strcasecmp(argv[iarg]+1,"marg")==0) {
 	usemarg=1;
+      } else if (strcasecmp(argv[iarg]+1,"fastgrid")==0) {
+	usefastgrid=1;
 
       } else if (strcasecmp(argv[iarg]+1,"wref")==0) { 
 	wref = atof(argv[++iarg]);
@@ -850,7 +865,7 @@ int main(int argc,char *argv[]){
     if ( usemucovar > 0 ) {
       read_mucovar(mucovarfile);
 
-      printf(" Invert MU-covariance matrix with CERN's dfinv. \n");
+      printf(" Invert MU-covariance matrix from Cholesky factor. \n");
       invert_mucovar(sqsnrms);
     }
 
@@ -938,11 +953,111 @@ int main(int argc,char *argv[]){
 
     chi_approx = (double)(Ndof);
 
+    if ( usefastgrid ) {
+
+      /* Aug 2026: adaptive two-pass grid. Pass 1 evaluates every
+	 SKIP_FASTGRID'th step; pass 2 evaluates exactly only the
+	 cells whose bilinear chi2 estimate is within
+	 DCHI2MAX_FASTGRID of the coarse minimum (for either the
+	 SN-only or SN+prior chi2). Remaining cells keep the
+	 interpolated estimate, whose probability weight
+	 exp(-chidif/2) < 4E-7 is negligible for contours and
+	 marginalization. Typical cost is ~1/10 of full grid. */
+
+      int    SKIP = SKIP_FASTGRID, Neval = 0 ;
+      int    i0, i1, j0, j1 ;
+      double fi, fj, est_sn, est_ext ;
+      double snchi_min_c = 1.e20, extchi_min_c = 1.e20 ;
+      char  *evalmask = (char*) calloc(omm_steps*w_steps, sizeof(char));
+
+      /* pass 1: coarse grid; always include last row and column
+	 so every fine cell has four bracketing coarse corners */
+      for( i=0; i < w_steps; i++){
+	if ( i % SKIP != 0 && i != w_steps-1 ) { continue ; }
+	cpar.w0 = w_min + i*w_stepsize;
+	cpar.wa = 0. ;
+	for(j=0; j < omm_steps; j++){
+	  if ( j % SKIP != 0 && j != omm_steps-1 ) { continue ; }
+	  cpar.omm = omm_min + j*omm_stepsize;
+	  cpar.ome = 1 - cpar.omm;
+	  get_chi2wOM ( cpar.w0, cpar.omm, sqsnrms,
+			&muoff_tmp, &snchi_tmp, &extchi_tmp );
+	  snchi[i*omm_steps+j]    = snchi_tmp ;
+	  extchi[i*omm_steps+j]   = extchi_tmp ;
+	  evalmask[i*omm_steps+j] = 1 ;  Neval++ ;
+	  if ( snchi_tmp  < snchi_min_c  ) { snchi_min_c  = snchi_tmp; }
+	  if ( extchi_tmp < extchi_min_c ) { extchi_min_c = extchi_tmp; }
+	}
+      }
+
+      /* pass 2: refine cells near the minimum */
+      for( i=0; i < w_steps; i++){
+	i0 = (i/SKIP)*SKIP ;   i1 = i0 + SKIP ;
+	if ( i1 > w_steps-1 ) { i1 = w_steps-1 ; }
+	fi = ( i1 == i0 ) ? 0.0 : (double)(i-i0)/(double)(i1-i0) ;
+	for(j=0; j < omm_steps; j++){
+	  if ( evalmask[i*omm_steps+j] ) { continue ; }
+	  j0 = (j/SKIP)*SKIP ;   j1 = j0 + SKIP ;
+	  if ( j1 > omm_steps-1 ) { j1 = omm_steps-1 ; }
+	  fj = ( j1 == j0 ) ? 0.0 : (double)(j-j0)/(double)(j1-j0) ;
+
+	  est_sn =
+	    (1.-fi)*(1.-fj) * snchi[i0*omm_steps+j0] +
+	    (1.-fi)*    fj  * snchi[i0*omm_steps+j1] +
+	        fi *(1.-fj) * snchi[i1*omm_steps+j0] +
+	        fi *    fj  * snchi[i1*omm_steps+j1] ;
+	  est_ext =
+	    (1.-fi)*(1.-fj) * extchi[i0*omm_steps+j0] +
+	    (1.-fi)*    fj  * extchi[i0*omm_steps+j1] +
+	        fi *(1.-fj) * extchi[i1*omm_steps+j0] +
+	        fi *    fj  * extchi[i1*omm_steps+j1] ;
+
+	  if ( est_sn  - snchi_min_c  < DCHI2MAX_FASTGRID ||
+	       est_ext - extchi_min_c < DCHI2MAX_FASTGRID ) {
+	    cpar.w0  = w_min + i*w_stepsize;
+	    cpar.wa  = 0. ;
+	    cpar.omm = omm_min + j*omm_stepsize;
+	    cpar.ome = 1 - cpar.omm;
+	    get_chi2wOM ( cpar.w0, cpar.omm, sqsnrms,
+			  &muoff_tmp, &snchi_tmp, &extchi_tmp );
+	    snchi[i*omm_steps+j]  = snchi_tmp ;
+	    extchi[i*omm_steps+j] = extchi_tmp ;
+	    Neval++ ;
+	  }
+	  else {
+	    snchi[i*omm_steps+j]  = est_sn ;
+	    extchi[i*omm_steps+j] = est_ext ;
+	  }
+	}
+      }
+
+      /* track minima over final grid */
+      for( i=0; i < w_steps; i++){
+	for(j=0; j < omm_steps; j++){
+	  snchi_tmp  = snchi[i*omm_steps+j] ;
+	  extchi_tmp = extchi[i*omm_steps+j] ;
+	  if(snchi_tmp < snchi_min)
+	    snchi_min = snchi_tmp ;
+	  if(extchi_tmp < extchi_min)
+	    { extchi_min = extchi_tmp ;  imin=i; jmin=j; }
+	}
+      }
+
+      free(evalmask);
+      printf("   fastgrid: %d of %d chi2 evaluations (%.1f %%)\n",
+	     Neval, w_steps*omm_steps,
+	     100.0*(double)Neval/(double)(w_steps*omm_steps) );
+      fflush(stdout);
+
+    } // end usefastgrid
+
+    else {
+
     for( i=0; i < w_steps; i++){
 
       cpar.w0 = w_min + i*w_stepsize;
       cpar.wa = 0. ;
-    
+
       for(j=0; j < omm_steps; j++){
         cpar.omm = omm_min + j*omm_stepsize;
         cpar.ome = 1 - cpar.omm;
@@ -950,22 +1065,24 @@ int main(int argc,char *argv[]){
         get_chi2wOM ( cpar.w0, cpar.omm, sqsnrms,  // inputs
 	  	    &muoff_tmp, &snchi_tmp, &extchi_tmp );   // return args
 
-	/*printf("xxxchi %d   %0.4f   %0.4f   %0.4g   %0.4g   %0.4g   \n", 
+	/*printf("xxxchi %d   %0.4f   %0.4f   %0.4g   %0.4g   %0.4g   \n",
 	  i, cpar.w0, cpar.omm, snchi_tmp, extchi_tmp, diff); */
 
         snchi[i*omm_steps+j]  = snchi_tmp ;
         extchi[i*omm_steps+j] = extchi_tmp ;
 
         /* Keep track of minimum chi2 */
-        if(snchi_tmp < snchi_min) 
+        if(snchi_tmp < snchi_min)
 	  snchi_min = snchi_tmp ;
 
-        if(extchi_tmp < extchi_min) 
+        if(extchi_tmp < extchi_min)
 	  { extchi_min = extchi_tmp ;  imin=i; jmin=j; }
 
       }  // end of j-loop
     }  // end of i-loop
-  
+
+    } // end full-grid (no fastgrid)
+
 
     // get w,OM at min chi2 by using more refined grid
     // Pass approx w,OM,  then return w,OM at true min
@@ -2105,7 +2222,9 @@ void invert_mucovar(double sqmurms_add) {
 
   NMAX = MXCOVSN ;
 
-  invertMatrix( NMAX, NCOVSN, &covtmp[0][0] ) ;
+  // Aug 2026: covariance matrix is symmetric positive definite,
+  // so invert from a Cholesky factor instead of generic LU.
+  invertMatrix_cholesky( NMAX, NCOVSN, &covtmp[0][0] ) ;
 
   // store inverted matrix in global struct
 
@@ -2115,6 +2234,16 @@ void invert_mucovar(double sqmurms_add) {
     }
   }
 
+  // flat 0-based copy plus row sums for fast chi2 evaluation
+  MUCOVINV_SUM = 0.0 ;
+  for ( N0=1; N0 <= NCOVSN; N0++ ) {
+    MUCOVINV_ROWSUM[N0-1] = 0.0 ;
+    for ( N1=1; N1 <= NCOVSN; N1++ ) {
+      MUCOVINV1D[(N0-1)*NCOVSN + (N1-1)] = covtmp[N0-1][N1-1];
+      MUCOVINV_ROWSUM[N0-1] += covtmp[N0-1][N1-1];
+      MUCOVINV_SUM          += covtmp[N0-1][N1-1];
+    }
+  }
 
 } // end of invert_mucovar
 
@@ -2141,18 +2270,16 @@ void get_chi2wOM (
 
   double 
     a, rz, sqmusig, sqmusiginv, Bsum, Csum
-    ,chi_hat, dchi_hat, ld_cos
+    ,chi_hat, ld_cos
     ,mu_cos[MXSN]
     ,tmp1, tmp2
     ,Rcmb
     ,nsig
     ,dmu
-    ,sqdmu
-    ,covinv
     ;
 
   Cosparam cparloc;
-  int k, k0, k1, N0, N1, icov;
+  int k, k0, icov;
 
   // --------- BEGIN --------
 
@@ -2196,32 +2323,31 @@ void get_chi2wOM (
 
 
   // check for SNe with off-diagonal terms
-  // Note that below includes both diag & off-diag for 
+  // Note that below includes both diag & off-diag for
   // the SN-subset with covariances.
+  //
+  // Aug 2026: B & C terms use row sums of the inverted matrix
+  // precomputed in invert_mucovar (O(N) per call), and the
+  // quadratic form runs over the upper triangle of the flat
+  // 0-based copy; results are identical to the old full loop.
 
   if ( NCOVPAIR > 0 ) {
-    for ( N0=1; N0 <= NCOVSN; N0++ ) {
-      for ( N1=1; N1 <= NCOVSN; N1++ ) {
-
-	k0     = INDEX_COVSN_MAP[N0]  ;
-	k1     = INDEX_COVSN_MAP[N1]  ;
-	covinv = MUCOV_STORE[N0][N1].COVINV ;
-
-	sqdmu    = (mu_cos[k0] - mu[k0]) * (mu_cos[k1] - mu[k1]) ;
-	dchi_hat = sqdmu * covinv ;
-	chi_hat += dchi_hat ;
+    double dmuLoc[MXCOVSN], *ptrInv ;
+    int    n0, n1 ;
 
-	// increment B & C terms
-	dmu    = mu_cos[k0] - mu[k0] ;
-	Bsum  += covinv * dmu ;
-	Csum  += covinv ;      
-
-	if ( k0 >= 9999990 ) 
-	  printf("  xxxx covini(%4s,%4s) = %10.4f   dchi=%12.4f  chi=%f \n", 
-		 CIDLIST[k0], CIDLIST[k1], covinv, dchi_hat, chi_hat );
+    for ( n0=0; n0 < NCOVSN; n0++ ) {
+      k0         = INDEX_COVSN_MAP[n0+1]  ;
+      dmuLoc[n0] = mu_cos[k0] - mu[k0] ;
+      Bsum      += MUCOVINV_ROWSUM[n0] * dmuLoc[n0] ;
+    }
+    Csum += MUCOVINV_SUM ;
 
-      } // N1
-    } // N0
+    for ( n0=0; n0 < NCOVSN; n0++ ) {
+      ptrInv   = &MUCOVINV1D[n0*NCOVSN] ;
+      chi_hat += ptrInv[n0] * dmuLoc[n0] * dmuLoc[n0] ;
+      for ( n1=n0+1; n1 < NCOVSN; n1++ )
+	{ chi_hat += 2.0 * ptrInv[n1] * dmuLoc[n0] * dmuLoc[n1] ; }
+    }
   }
 
 
@@ -0,0 +1,286 @@
+#!/usr/bin/env python
+#
+# Created Aug 2026
+# Performance regression harness for SNANA executables;
+# invoked by 'make perftest' from src/Makefile.
+#
+# Runs the canned miniature tasks listed in
+#     $SNANA_TESTS/perftest/PERFTEST.LIST
+# and records wall time, CPU time (user+sys) and peak RSS per task.
+# A REF run writes the YAML baseline; a TEST run compares each metric
+# against the baseline and exits with error code 1 when any metric
+# exceeds baseline*(1+threshold), so that silent slowdowns are caught
+# before production.
+#
+# Usage:
+#   perftest_snana.py REF              ! run tasks, write new baseline
+#   perftest_snana.py                  ! run tasks, compare vs. baseline
+#   perftest_snana.py -threshold 0.5   ! allow 50% degradation
+#   perftest_snana.py -listFile <file> ! alternate task list
+#
+# Each PERFTEST.LIST line has the form
+#   TASKNAME:  <command>
+# e.g.,
+#   SIMGEN_MINI:   snlc_sim.exe  SIMGEN_PERFTEST.INPUT
+#   BBCFIT_MINI:   SALT2mu.exe   SALT2mu_PERFTEST.input
+#   WFIT_MINI:     wfit.exe      HD_PERFTEST.FITRES
+#   PSNID_MINI:    psnid.exe     PSNID_PERFTEST.nml
+#
+# Commands execute sequentially (to avoid contaminating the timing)
+# inside a scratch directory seeded with copies of the files in
+# $SNANA_TESTS/perftest/inputs; executables are taken from
+# $SNANA_DIR/bin. Tasks are miniature by design (seconds each); the
+# goal is catching 2x regressions, not profiling.
+#
+
+import os, sys, datetime, shutil, time
+import subprocess
+
+# ===============================================
+# hard-wired globals (same convention as SNANA_code_tests.py)
+
+SNANA_DIR       = os.environ.get('SNANA_DIR')
+SNANA_TESTS_DIR = os.environ.get('SNANA_TESTS')
+
+PERFTEST_SUBDIR   = "perftest"
+LIST_FILE_DEFAULT = "PERFTEST.LIST"
+BASELINE_FILE     = "PERFTEST_BASELINE.YAML"
+INPUT_SUBDIR      = "inputs"
+RUN_SUBDIR        = "run"             # scratch dir for task outputs
+THRESHOLD_DEFAULT = 0.30              # allowed fractional degradation
+METRIC_LIST       = [ 't_wall', 't_cpu', 'maxrss' ]
+METRIC_UNITS      = { 't_wall':'sec', 't_cpu':'sec', 'maxrss':'Mb' }
+
+# ========================================================
+def parse_args():
+    # return dictionary of user command-line input values
+    DOREF     = False
+    THRESHOLD = THRESHOLD_DEFAULT
+    LIST_FILE = ''
+
+    iarg = 0
+    for arg in sys.argv :
+        if ( arg.lower() == 'ref' ):
+            DOREF = True
+        elif ( arg == '-threshold' ):
+            THRESHOLD = float(sys.argv[iarg+1])
+        elif ( arg == '-listFile' ):
+            LIST_FILE = sys.argv[iarg+1]
+        iarg += 1
+
+    INPUTS_USER = {
+        "DOREF"     : DOREF,
+        "THRESHOLD" : THRESHOLD,
+        "LIST_FILE" : LIST_FILE
+        }
+    return INPUTS_USER
+
+# ====================================
+def get_perftest_dir():
+    # abort with instructions if the perftest area is not set up;
+    # the canned inputs are data files and live with the other
+    # regression-test inputs under $SNANA_TESTS, not in the code repo.
+
+    if SNANA_DIR is None :
+        sys.exit("\n ABORT: $SNANA_DIR is not defined.")
+    if SNANA_TESTS_DIR is None :
+        sys.exit("\n ABORT: $SNANA_TESTS is not defined;\n" \
+                 "\t cannot locate perftest inputs.")
+
+    perftest_dir = ('%s/%s' % (SNANA_TESTS_DIR, PERFTEST_SUBDIR) )
+    if os.path.isdir(perftest_dir) is False :
+        sys.exit(("\n ABORT: %s does not exist.\n" \
+                  "\t Expect PERFTEST.LIST and inputs/ sub-dir there.")
+                 % perftest_dir )
+    return perftest_dir
+
+# ====================================
+def parse_listfile(list_file):
+    # return ordered list of (taskname, command); ignore blank lines
+    # and comment lines starting with # or !
+
+    if os.path.isfile(list_file) is False :
+        sys.exit("\n ABORT: cannot find list file\n\t %s" % list_file )
+
+    task_list = []
+    with open(list_file,"r") as f :
+        for line in f :
+            line = line.strip()
+            if len(line) == 0          : continue
+            if line[0] == '#'          : continue
+            if line[0] == '!'          : continue
+            if line.find(':') < 0      : continue
+            taskname = line.split(':',1)[0].strip()
+            command  = line.split(':',1)[1].strip()
+            task_list.append( (taskname,command) )
+
+    if len(task_list) == 0 :
+        sys.exit("\n ABORT: no tasks found in\n\t %s" % list_file )
+    return task_list
+
+# ====================================
+def make_rundir(perftest_dir):
+    # scratch dir seeded with copies of the canned miniature inputs
+
+    input_dir = ('%s/%s' % (perftest_dir, INPUT_SUBDIR) )
+    run_dir   = ('%s/%s' % (perftest_dir, RUN_SUBDIR) )
+
+    if os.path.isdir(input_dir) is False :
+        sys.exit("\n ABORT: cannot find input dir\n\t %s" % input_dir )
+
+    if os.path.isdir(run_dir) : shutil.rmtree(run_dir)
+    os.mkdir(run_dir)
+
+    for fname in sorted(os.listdir(input_dir)) :
+        shutil.copy( ('%s/%s' % (input_dir,fname)), run_dir )
+
+    return run_dir
+
+# ====================================
+def execute_task(taskname, command, run_dir):
+    # run one task in run_dir with stdout -> TASKNAME.LOG;
+    # return dictionary of metrics. Use os.wait4 so that the
+    # rusage (CPU, maxrss) is per-task rather than cumulative.
+
+    log_file = ('%s/%s.LOG' % (run_dir,taskname) )
+    cmd      = ('%s/bin/%s' % (SNANA_DIR, command) )
+
+    print("   run %-20s (%s)" % (taskname, command.split()[0]) )
+    sys.stdout.flush()
+
+    t_start = time.time()
+    with open(log_file,"w") as log :
+        proc = subprocess.Popen(cmd.split(), cwd=run_dir,
+                                stdout=log, stderr=subprocess.STDOUT )
+        (pid, status, rusage) = os.wait4(proc.pid, 0)
+    t_wall = time.time() - t_start
+
+    if status != 0 :
+        sys.exit(("\n ABORT: task %s failed (status=%d);\n" \
+                  "\t see %s") % (taskname, status, log_file) )
+
+    metrics = {
+        't_wall' : t_wall,
+        't_cpu'  : rusage.ru_utime + rusage.ru_stime,
+        'maxrss' : rusage.ru_maxrss / 1024.0     # KB -> Mb
+        }
+    return metrics
+
+# ====================================
+def write_baseline(baseline_file, results):
+    # results is ordered list of (taskname, metrics-dictionary)
+
+    tnow = datetime.datetime.now().strftime("%Y-%m-%d %H:%M:%S")
+    with open(baseline_file,"w") as f :
+        f.write("# SNANA perftest baseline; written by perftest_snana.py\n")
+        f.write("# Compare with 'make perftest' from src.\n")
+        f.write("CREATED:    %s\n" % tnow )
+        f.write("SNANA_DIR:  %s\n" % SNANA_DIR )
+        f.write("TASKS:\n")
+        for (taskname,metrics) in results :
+            f.write("  %s:\n" % taskname )
+            for metric in METRIC_LIST :
+                f.write("    %-8s %10.3f   # %s\n" %
+                        (metric+':', metrics[metric],
+                         METRIC_UNITS[metric]) )
+    print("\n Wrote baseline to\n\t %s" % baseline_file )
+
+# ====================================
+def read_baseline(baseline_file):
+    # return {taskname: metrics-dictionary} from YAML baseline;
+    # parse by hand (flat two-level YAML) to avoid module dependence.
+
+    if os.path.isfile(baseline_file) is False :
+        sys.exit(("\n ABORT: cannot find baseline\n\t %s\n" \
+                  "\t Run 'perftest_snana.py REF' to create it.")
+                 % baseline_file )
+
+    baseline = {}
+    taskname = None
+    with open(baseline_file,"r") as f :
+        for line in f :
+            if line[0] == '#' : continue
+            strip = line.split('#')[0].rstrip()
+            if strip.startswith('    ') and taskname is not None :
+                (key,val) = strip.split(':')
+                baseline[taskname][key.strip()] = float(val)
+            elif strip.startswith('  ') and strip.endswith(':') :
+                taskname = strip.strip()[:-1]
+                baseline[taskname] = {}
+            else :
+                taskname = None
+    return baseline
+
+# ====================================
+def compare_results(results, baseline, threshold):
+    # print TEST/baseline table; return number of regressions
+
+    nfail = 0
+    print("\n# %-20s %-8s %10s %10s %8s  %s" %
+          ("task", "metric", "baseline", "test", "ratio", "status") )
+
+    for (taskname,metrics) in results :
+        if taskname not in baseline :
+            print("  %-20s  WARNING: not in baseline; skip compare"
+                  % taskname )
+            continue
+        for metric in METRIC_LIST :
+            ref   = baseline[taskname][metric]
+            val   = metrics[metric]
+            ratio = val/ref if ref > 0.0 else 1.0
+            if ratio > 1.0 + threshold :
+                status = "FAIL" ;  nfail += 1
+            else :
+                status = "ok"
+            print("  %-20s %-8s %10.3f %10.3f %8.2f  %s" %
+                  (taskname, metric, ref, val, ratio, status) )
+
+    return nfail
+
+# =============================================
+# ============== MAIN =========================
+# =============================================
+
+if __name__ == "__main__":
+
+    INPUTS    = parse_args()
+    DOREF     = INPUTS["DOREF"]
+    THRESHOLD = INPUTS["THRESHOLD"]
+    LIST_FILE = INPUTS["LIST_FILE"]
+
+    perftest_dir  = get_perftest_dir()
+    baseline_file = ('%s/%s' % (perftest_dir, BASELINE_FILE) )
+    if LIST_FILE == '' :
+        LIST_FILE = ('%s/%s' % (perftest_dir, LIST_FILE_DEFAULT) )
+
+    print(" Inputs: ")
+    print("   SNANA_DIR   =  %s " % SNANA_DIR )
+    print("   SNANA_TESTS =  %s " % SNANA_TESTS_DIR )
+    print("   REF or TEST =  %s " % ('REF' if DOREF else 'TEST') )
+    print("   THRESHOLD   =  %.2f " % THRESHOLD )
+    print("   LIST_FILE   = '%s' " % LIST_FILE )
+    print(" ")
+    sys.stdout.flush()
+
+    task_list = parse_listfile(LIST_FILE)
+    run_dir   = make_rundir(perftest_dir)
+
+    results = []
+    for (taskname,command) in task_list :
+        metrics = execute_task(taskname, command, run_dir)
+        results.append( (taskname,metrics) )
+
+    if DOREF :
+        write_baseline(baseline_file, results)
+    else :
+        baseline = read_baseline(baseline_file)
+        nfail    = compare_results(results, baseline, THRESHOLD)
+        if nfail > 0 :
+            sys.exit("\n PERFTEST FAILED: %d metric(s) regressed "
+                     "beyond %.0f%% threshold." % (nfail,100.0*THRESHOLD) )
+        print("\n PERFTEST passed: no metric regressed "
+              "beyond %.0f%% threshold." % (100.0*THRESHOLD) )
+
+    print('\n ALL DONE.')
+
+# ====== END =====